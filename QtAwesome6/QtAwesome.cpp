@@ -1,94 +1,163 @@
 #include "QtAwesome.h"
 #include "QtAwesomeAnim.h"
+#ifdef QTAWESOME_SUBSET
+#include <enum_name_hash.h>     // the per-application subset created by tools/fasubset
+#else
+#include "enum_name_hash.h"
+#endif
 
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFontDatabase>
 #include <QMutexLocker>
-#include <QMetaEnum>
+#include <QPointer>
+#include <QRawFont>
+#include <QResource>
+#include <QtConcurrent>
 
-/// The font-awesome icon painter
-class QtAwesomeCharIconPainter: public QtAwesomeIconPainter
-{
-
-protected:
-
-    QStringList optionKeysForModeAndState( const QString& key, QIcon::Mode mode, QIcon::State state) {
-        QString modePostfix;
-        switch(mode) {
-        case QIcon::Disabled:
-            modePostfix = "-disabled";
-            break;
-        case QIcon::Active:
-            modePostfix = "-active";
-            break;
-        case QIcon::Selected:
-            modePostfix = "-selected";
-            break;
-        default: // QIcon::Normal:
-            // modePostfix = "";
-            break;
-        }
+#include <algorithm>
 
-        QString statePostfix;
-        if( state == QIcon::Off) {
-            statePostfix = "-off";
-        }
+/// The option keys that are tested for every mode and state of a base option key
+/// The 4 modes x 2 states are stored in a fixed table of QtAwesomeIconOptions::SlotCount slots
+class QtAwesomeOptionKeys
+{
+public:
 
-        // the keys that need to bet tested:   key-mode-state | key-mode | key-state | key
-        QStringList result;
-        if( !modePostfix.isEmpty() ) {
-            if( !statePostfix.isEmpty() ) {
-                result.push_back( key + modePostfix + statePostfix );
+    explicit QtAwesomeOptionKeys( const QString& baseKey )
+        : baseKey_(baseKey) {
+        static const char* const modePostfixes[] = { "", "-disabled", "-active", "-selected" };
+        for( int mode = QIcon::Normal; mode <= QIcon::Selected; ++mode ) {
+            for( int state = QIcon::On; state <= QIcon::Off; ++state ) {
+                QString modePostfix = QLatin1String(modePostfixes[mode]);
+                QString statePostfix = state == QIcon::Off ? QStringLiteral("-off") : QString();
+
+                // the keys that need to bet tested:   key-mode-state | key-mode | key-state | key
+                QStringList& keys = keys_[QtAwesomeIconOptions::slot(QIcon::Mode(mode), QIcon::State(state))];
+                if( !modePostfix.isEmpty() ) {
+                    if( !statePostfix.isEmpty() ) {
+                        keys.push_back( baseKey + modePostfix + statePostfix );
+                    }
+                    keys.push_back( baseKey + modePostfix );
+                }
+                if( !statePostfix.isEmpty() ) {
+                    keys.push_back( baseKey + statePostfix );
+                }
             }
-            result.push_back( key + modePostfix );
         }
-        if( !statePostfix.isEmpty() ) {
-            result.push_back( key + statePostfix );
-        }
-        return result;
     }
 
-
-    QVariant optionValueForModeAndState( const QString& baseKey, QIcon::Mode mode, QIcon::State state, const QVariantMap& options ) {
-        foreach( QString key, optionKeysForModeAndState(baseKey, mode, state) ) {
-//            if ( options.contains(key) && options.value(key).toString().isEmpty()) { qDebug() << "Not found:" << key; }
-            if( options.contains(key) && !(options.value(key).toString().isEmpty()) ) {
-                return options.value(key);
+    /// Returns the value of the most specific key that is set for the given slot
+    /// The options overlay the defaults, a key in the options hides the same key in the defaults
+    QVariant value( int slot, const QVariantMap& options, const QVariantMap& defaults ) const {
+        for( const QString& key : keys_[slot] ) {
+            QVariant value = overlayValue(key, options, defaults);
+            if( !value.toString().isEmpty() ) {
+                return value;
             }
         }
+        return overlayValue(baseKey_, options, defaults);
+    }
 
-        return options.value(baseKey);
+    static QVariant overlayValue( const QString& key, const QVariantMap& options, const QVariantMap& defaults ) {
+        QVariantMap::const_iterator itr = options.constFind(key);
+        return itr != options.constEnd() ? itr.value() : defaults.value(key);
     }
 
-public:
+private:
+
+    QString baseKey_;
+    QStringList keys_[QtAwesomeIconOptions::SlotCount];
+};
+
+
+//---------------------------------------------------------------------------------------
 
 
+/// The font-awesome icon painter
+/// The painting only uses the shared core and a render cache, so an icon keeps painting after its context is gone
+class QtAwesomeCharIconPainter: public QtAwesomeIconPainter
+{
+
+public:
+
     virtual void paint( QtAwesome* awesome, QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state, const QVariantMap& options  ) {
+        paint( awesome->core().data(), painter, rect, mode, state, QtAwesomeIconOptions::fromVariantMap(options) );
+    }
+
+    /// Paints the icon with precompiled options
+    static void paint( QtAwesomeCore* core, QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state, const QtAwesomeIconOptions& options ) {
         painter->save();
 
-        QVariant var = options.value("anim");
-        QtAwesomeAnimation* anim = var.value<QtAwesomeAnimation*>();
-        if( anim ) {
-            anim->setup( *painter, rect );
+        if( options.anim ) {
+            options.anim->setup( *painter, rect );
         }
 
-        // set the default options
-        QColor color = optionValueForModeAndState("color", mode, state, options).value<QColor>();
-        QString text = optionValueForModeAndState("text", mode, state, options).toString();
+        paintGlyph( core, painter, rect, options.text(mode, state), options.style, options.color(mode, state), options.scaleFactor );
+        painter->restore();
+    }
 
+    /// Paints the given glyph text with the font of the given style centered in the rect
+    static void paintGlyph( QtAwesomeCore* core, QPainter* painter, const QRect& rect, const QString& text, fa::style style, const QColor& color, float scaleFactor ) {
         Q_ASSERT(color.isValid());
         Q_ASSERT(!text.isEmpty());
 
-        painter->setPen(color);
-
         // add some 'padding' around the icon
-        int drawSize = qRound(rect.height() * options.value("scale-factor").toFloat());
+        int drawSize = qRound(rect.height() * scaleFactor);
+
+        // a single glyph is filled from its cached outline, the text layout isn't required for that
+        if( text.size() == 1 ) {
+            QtAwesomeGlyph glyph = core->glyph(fa::qualified(style, text.front().unicode()));
+            if( glyph.isValid() ) {
+                qreal scale = qreal(drawSize) / QtAwesomeGlyph::ReferenceSize;
+                qreal x = rect.x() + (rect.width() - glyph.advance * scale) / 2;
+                qreal y = rect.y() + (rect.height() - (glyph.ascent + glyph.descent) * scale) / 2 + glyph.ascent * scale;
+
+                QTransform transform = painter->worldTransform();
+                bool antialiasing = painter->testRenderHint(QPainter::Antialiasing);
+                painter->setRenderHint(QPainter::Antialiasing);
+                painter->translate(x, y);
+                painter->scale(scale, scale);
+                painter->fillPath(glyph.path, color);
+                painter->setWorldTransform(transform);
+                painter->setRenderHint(QPainter::Antialiasing, antialiasing);
+                return;
+            }
+        }
 
-        painter->setFont( awesome->font(text.front().unicode(), drawSize) );
+        painter->setPen(color);
+        painter->setFont( core->font(fa::qualified(style, text.front().unicode()), drawSize) );
 
         painter->drawText( rect, text, QTextOption( Qt::AlignCenter | Qt::AlignVCenter ) );
-        painter->restore();
+    }
+
+    /// Renders the glyph to a premultiplied image of size * devicePixelRatio pixels
+    /// The glyph is rasterized once as coverage mask in the given cache, every color is a tint of that mask.
+    /// The masks are keyed by their size in device pixels, so all device pixel ratios share them.
+    /// Only QImage is used, so this can be called from any thread when the glyph is valid
+    static QImage renderImage( QtAwesomeCore* core, QtAwesomeRenderCache* cache, const QtAwesomeIconOptions& options, const QSize& size,
+                               qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state ) {
+        const QString& text = options.text(mode, state);
+
+        QtAwesomeMaskKey maskKey;
+        maskKey.text = text;
+        maskKey.style = options.style;
+        maskKey.size = size * devicePixelRatio;
+        maskKey.scaleFactor = options.scaleFactor;
+
+        // concurrent misses for the same mask (e.g. by prefetch workers) rasterize it only once
+        QImage mask = cache->findOrCreateMask( maskKey, [&]() {
+            QImage result( maskKey.size, QImage::Format_Alpha8 );
+            result.fill( Qt::transparent );
+            if( !text.isEmpty() ) {
+                QPainter p(&result);
+                paintGlyph( core, &p, QRect(QPoint(0, 0), maskKey.size), text, options.style, Qt::black, options.scaleFactor );
+            }
+            return result;
+        });
+        QImage image = QtAwesomeRenderCache::tint( mask, options.color(mode, state) );
+        image.setDevicePixelRatio( devicePixelRatio );
+        return image;
     }
 
 };
@@ -98,6 +167,8 @@ public:
 
 
 /// The painter icon engine.
+/// A font-awesome icon holds a reference to the shared core and to the render cache of its context, so it stays
+/// valid when the context is destroyed. A custom painter belongs to its context, it isn't painted anymore then.
 class QtAwesomeIconPainterIconEngine : public QIconEngine
 {
 
@@ -109,19 +180,59 @@ public:
         , options_(options) {
     }
 
+    QtAwesomeIconPainterIconEngine( const QSharedPointer<QtAwesomeCore>& core, const QSharedPointer<QtAwesomeRenderCache>& renderCache,
+                                    const QtAwesomeIconOptions& charOptions )
+        : iconPainterRef_(QTAWESOME_NULL)
+        , core_(core)
+        , renderCache_(renderCache)
+        , charOptions_(charOptions) {
+    }
+
     virtual ~QtAwesomeIconPainterIconEngine() {}
 
     QtAwesomeIconPainterIconEngine* clone() const {
-        return new QtAwesomeIconPainterIconEngine( awesomeRef_, iconPainterRef_, options_ );
+        return new QtAwesomeIconPainterIconEngine( *this );
     }
 
     virtual void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) {
-        Q_UNUSED( mode );
-        Q_UNUSED( state );
-        iconPainterRef_->paint( awesomeRef_, painter, rect, mode, state, options_ );
+        if( core_ ) {
+            QtAwesomeCharIconPainter::paint( core_.data(), painter, rect, mode, state, charOptions_ );
+        } else if( awesomeRef_ ) {
+            iconPainterRef_->paint( awesomeRef_.data(), painter, rect, mode, state, options_ );
+        }
     }
 
     virtual QPixmap pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state) {
+        // only the font-awesome glyphs are cached. Custom painters and animations can paint anything
+        if( !core_ || charOptions_.anim ) {
+            return renderPixmap( size, mode, state );
+        }
+
+        const QString& text = charOptions_.text(mode, state);
+
+        // the size is in device pixels
+        QtAwesomeRenderKey key;
+        key.text = text;
+        key.style = charOptions_.style;
+        key.color = charOptions_.color(mode, state).rgba();
+        key.size = size;
+        key.scaleFactor = charOptions_.scaleFactor;
+        key.mode = mode;
+        key.state = state;
+
+        QPixmap pm;
+        if( renderCache_->find( key, &pm ) ) {
+            return pm;
+        }
+
+        pm = QPixmap::fromImage( QtAwesomeCharIconPainter::renderImage( core_.data(), renderCache_.data(), charOptions_, size, 1.0, mode, state ) );
+        renderCache_->insert( key, pm );
+        return pm;
+    }
+
+private:
+
+    QPixmap renderPixmap(const QSize& size, QIcon::Mode mode, QIcon::State state) {
         QPixmap pm(size);
         pm.fill( Qt::transparent ); // we need transparency
         {
@@ -131,61 +242,370 @@ public:
         return pm;
     }
 
-private:
 
-    QtAwesome* awesomeRef_;                  ///< a reference to the QtAwesome instance
-    QtAwesomeIconPainter* iconPainterRef_;   ///< a reference to the icon painter
-    QVariantMap options_;                    ///< the options for this icon painter
+    QPointer<QtAwesome> awesomeRef_;                ///< the context of a custom painter, null when the context is destroyed
+    QtAwesomeIconPainter* iconPainterRef_;          ///< a reference to the custom icon painter
+    QSharedPointer<QtAwesomeCore> core_;            ///< the fonts and glyphs of a font-awesome icon, null for a custom painter
+    QSharedPointer<QtAwesomeRenderCache> renderCache_;  ///< the render cache of the context that created the font-awesome icon
+    QVariantMap options_;                           ///< the options for the custom icon painter
+    QtAwesomeIconOptions charOptions_;              ///< the compiled options for the font-awesome painter
 };
 
 
 //---------------------------------------------------------------------------------------
-QScopedPointer<QtAwesome> QtAwesome::m_instance;
-QtAwesome *QtAwesome::instance()
+
+
+/// Resolves the options for every mode and state
+/// The options overlay the defaults, so the defaults don't need to be copied
+QtAwesomeIconOptions QtAwesomeIconOptions::fromVariantMap( const QVariantMap& options, const QVariantMap& defaults )
+{
+    static const QtAwesomeOptionKeys colorKeys( QStringLiteral("color") );
+    static const QtAwesomeOptionKeys textKeys( QStringLiteral("text") );
+
+    QtAwesomeIconOptions result;
+    for( int slot = 0; slot < SlotCount; ++slot ) {
+        result.colors[slot] = colorKeys.value(slot, options, defaults).value<QColor>();
+        result.texts[slot] = textKeys.value(slot, options, defaults).toString();
+    }
+    result.scaleFactor = QtAwesomeOptionKeys::overlayValue("scale-factor", options, defaults).toFloat();
+    result.anim = QtAwesomeOptionKeys::overlayValue("anim", options, defaults).value<QtAwesomeAnimation*>();
+    result.style = fa::style( QtAwesomeOptionKeys::overlayValue("style", options, defaults).toInt() );
+    return result;
+}
+
+
+//---------------------------------------------------------------------------------------
+
+
+// the innermost option scope of the current thread
+static thread_local const QtAwesomeOptionScope* currentOptionScope = QTAWESOME_NULL;
+
+QtAwesomeOptionScope::QtAwesomeOptionScope( const QVariantMap& options )
+    : parent_( currentOptionScope )
+    , options_( parent_ ? parent_->options_ : QVariantMap() )
+{
+    for( QVariantMap::const_iterator itr = options.constBegin(); itr != options.constEnd(); ++itr ) {
+        options_.insert( itr.key(), itr.value() );
+    }
+    currentOptionScope = this;
+}
+
+QtAwesomeOptionScope::~QtAwesomeOptionScope()
+{
+    Q_ASSERT( currentOptionScope == this );
+    currentOptionScope = parent_;
+}
+
+QVariantMap QtAwesomeOptionScope::currentOptions()
+{
+    return currentOptionScope ? currentOptionScope->options_ : QVariantMap();
+}
+
+
+//---------------------------------------------------------------------------------------
+/// Returns the core that is shared by all QtAwesome contexts
+/// The core is created once and lives until the end of the process: the thread-local raw fonts refer to its font data
+QSharedPointer<QtAwesomeCore> QtAwesomeCore::shared()
+{
+    static QSharedPointer<QtAwesomeCore> core( new QtAwesomeCore() );
+    return core;
+}
+
+QtAwesomeCore::QtAwesomeCore()
+    : initResult_( false )
+    , regularFont_( ":/fonts/fa-regular-400.ttf" )
+    , brandsFont_( ":/fonts/fa-brands-400.ttf" )
+{
+}
+
+/// a specialized init function so font-awesome is loaded and initialized
+/// this method return true on success, it will return false if the fnot cannot be initialized
+/// To initialize QtAwesome with font-awesome you need to call this method
+///
+/// The initialization is done once, calling this method again (from any thread) only returns the first result.
+/// The duration of every phase of the initialization is available via initStats()
+bool QtAwesomeCore::initFontAwesome( )
+{
+    QMutexLocker locker( &initMutex_ );
+    ++initStats_.calls;
+    if( initStats_.initialized ) {
+        return initResult_;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // The macro below internally calls "qInitResources_QtAwesome()". this initializes
+    // the resource system. For a .pri project this isn't required, but when building and using a
+    // static library the resource need to initialized first.
+    ///
+    // I've checked th qInitResource_* code and calling this method mutliple times shouldn't be any problem
+    // (More info about this subject:  http://qt-project.org/wiki/QtResources)
+    Q_INIT_RESOURCE(QtAwesome);
+    initStats_.resourceInitNs = timer.nsecsElapsed();
+
+    // the fonts are registered on the first request for a glyph of their style, see loadFont()
+    initResult_ = QFile(":/fonts/fa-regular-400.ttf").exists() || QFile(":/fonts/fa-brands-400.ttf").exists();
+
+    // the icon names are resolved by the generated perfect hash (enum_name_hash.h), there's no index to build
+    // at runtime, so indexBuildNs stays 0
+
+    initStats_.initialized = true;
+    return initResult_;
+}
+
+
+/// Registers the font of the given style with the font database on first use and returns its family
+/// An empty string is returned when initFontAwesome() isn't called yet or the font cannot be loaded
+QString QtAwesomeCore::loadFont(fa::style style)
 {
-    if(m_instance.isNull()) {
-        static QMutex mutex;
-        QMutexLocker locker(&mutex);
-        if(m_instance.isNull()) {
-            m_instance.reset(new QtAwesome());
+    LazyFont& font = lazyFont(style);
+    if( font.loaded.loadAcquire() ) {
+        return font.family;
+    }
+
+    QMutexLocker locker( &initMutex_ );
+    if( !initStats_.initialized ) {
+        return QString();
+    }
+    if( !font.loaded.loadAcquire() ) {
+        QElapsedTimer timer;
+        timer.start();
+        //判断图形字体是否存在,不存在则加入
+        QFontDatabase fontDb;
+        if( font.mappedFile ) {
+            int fontId = fontDb.addApplicationFontFromData(font.data);
+            font.family = fontDb.applicationFontFamilies(fontId).value(0);
+        } else if (QFile(font.fileName).exists()) {
+            int fontId = fontDb.addApplicationFont(font.fileName);
+            font.family = fontDb.applicationFontFamilies(fontId).value(0);
         }
+        initStats_.fontRegistrationNs += timer.nsecsElapsed();
+        ++initStats_.fontsLoaded;
+        font.loaded.storeRelease(1);
     }
-    return m_instance.data();
+    return font.family;
 }
 
-/// The default icon colors
-QtAwesome::QtAwesome( QObject* parent )
-    : QObject( parent )
-    , namedCodepoints_()
+
+/// Returns the font data of the given style without copying it
+/// The data points directly into the mapped font file or into the (uncompressed) resource data of the binary
+QByteArray QtAwesomeCore::fontData(fa::style style)
+{
+    LazyFont& font = lazyFont(style);
+    if( !font.data.isNull() ) {
+        return font.data;
+    }
+
+    QResource resource( font.fileName );
+    if( !resource.isValid() ) {
+        return QByteArray();
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(5, 13, 0)
+    bool compressed = resource.compressionAlgorithm() != QResource::NoCompression;
+#else
+    bool compressed = resource.isCompressed();
+#endif
+    if( compressed ) {
+        // a compressed resource needs to be uncompressed into memory
+        QFile file( font.fileName );
+        file.open( QIODevice::ReadOnly );
+        font.data = file.readAll();
+    } else {
+        font.data = QByteArray::fromRawData( reinterpret_cast<const char*>(resource.data()), int(resource.size()) );
+    }
+    return font.data;
+}
+
+
+/// Returns the raw font of the given style with a pixel size of QtAwesomeGlyph::ReferenceSize
+/// The raw font is built directly on the font data, the font isn't registered with the font database
+///
+/// A QRawFont may only be used in the thread that created it, so every thread gets its own raw font.
+/// All raw fonts share the same font data.
+QRawFont QtAwesomeCore::rawFont(fa::style style)
 {
-    // initialize the default options
-    setDefaultOption( "color", QColor(50, 50, 50) );
-    setDefaultOption( "color-disabled", QColor(70, 70, 70, 60));
-    setDefaultOption( "color-active", QColor(10, 10, 10));
-    setDefaultOption( "color-selected", QColor(10, 10, 10));
-    setDefaultOption( "scale-factor", 0.9 );
+    LazyFont& font = lazyFont(style);
+    QMutexLocker locker( &initMutex_ );
+    if( !initStats_.initialized ) {
+        return QRawFont();
+    }
+    QByteArray data = fontData(style);
+    font.dataUsed = true;
+
+    // keyed by the font data, which stays at the same address for the lifetime of the process
+    thread_local QHash<const char*, QRawFont> rawFonts;
+    QRawFont& rawFont = rawFonts[data.constData()];
+    if( !rawFont.isValid() ) {
+        QElapsedTimer timer;
+        timer.start();
+        rawFont = QRawFont( data, QtAwesomeGlyph::ReferenceSize );
+        initStats_.rawFontLoadNs += timer.nsecsElapsed();
+    }
+    return rawFont;
+}
+
+
+/// Uses the given font file for the given style instead of the font in the resources
+/// The file is memory mapped, the font data isn't copied. This method must be called before the style is used.
+/// Returns false if the file cannot be mapped
+bool QtAwesomeCore::setFontFile(fa::style style, const QString& fileName)
+{
+    LazyFont& font = lazyFont(style);
+    QMutexLocker locker( &initMutex_ );
+    if( font.loaded.loadAcquire() || font.dataUsed ) {
+        qWarning() << "QtAwesomeCore::setFontFile: the font is already in use" << fileName;
+        return false;
+    }
+
+    QScopedPointer<QFile> file( new QFile(fileName) );
+    if( !file->open( QIODevice::ReadOnly ) ) {
+        return false;
+    }
+    uchar* data = file->map( 0, file->size() );
+    if( !data ) {
+        return false;
+    }
+    font.data = QByteArray::fromRawData( reinterpret_cast<const char*>(data), int(file->size()) );
+    font.mappedFile.reset( file.take() );
+    return true;
+}
+
+
+/// Returns the number of calls and the duration of the phases of initFontAwesome()
+QtAwesomeInitStats QtAwesomeCore::initStats() const
+{
+    QMutexLocker locker( &initMutex_ );
+    return initStats_;
+}
+
+
+/// Returns the outline and metrics of the glyph for the given style-qualified character
+/// The glyph is resolved via QRawFont the first time it's requested and cached afterwards
+///
+/// A QPainterPath builds caches (its bounds and the vector path of the paint engine) inside const calls, so a path
+/// may not be painted by several threads at once. Every thread gets its own deep copy of the shared outline.
+QtAwesomeGlyph QtAwesomeCore::glyph(int character)
+{
+    thread_local QHash<QPair<const QtAwesomeCore*, int>, QtAwesomeGlyph> threadGlyphs;
+    QPair<const QtAwesomeCore*, int> key( this, character );
+    QHash<QPair<const QtAwesomeCore*, int>, QtAwesomeGlyph>::const_iterator itr = threadGlyphs.constFind(key);
+    if( itr != threadGlyphs.constEnd() ) {
+        return itr.value();
+    }
+
+    QtAwesomeGlyph glyph = sharedGlyph( character );
+    if( !glyph.isValid() ) {
+        return glyph;
+    }
+    QPainterPath path;
+    path.setFillRule( glyph.path.fillRule() );
+    path.addPath( glyph.path );
+    glyph.path = path;
+    threadGlyphs.insert( key, glyph );
+    return glyph;
+}
 
-    setDefaultOption( "text", QVariant() );
-    setDefaultOption( "text-disabled", QVariant() );
-    setDefaultOption( "text-active", QVariant() );
-    setDefaultOption( "text-selected", QVariant() );
+/// Returns the glyph from the cache that is shared by all threads, its path is never painted
+QtAwesomeGlyph QtAwesomeCore::sharedGlyph(int character)
+{
+    QMutexLocker locker(&glyphMutex_);
+    QHash<int, QtAwesomeGlyph>::const_iterator itr = glyphs_.constFind(character);
+    if( itr != glyphs_.constEnd() ) {
+        return itr.value();
+    }
 
-    fontIconPainter_ = new QtAwesomeCharIconPainter();
-    QMetaEnum _enum = QMetaEnum::fromType<fa::icon>();
-    int count = _enum.keyCount();
-    bool start = false;
-    for (int i = 0; i < count; ++i) {
-        if(QString(_enum.key(i)) == "_42_group") { start = true; }
-        if(start) { brandsIds.push_back(_enum.value(i)); }
+    // the font cannot be loaded (yet)
+    QRawFont rawFont = this->rawFont( fa::iconStyle(character) );
+    if( !rawFont.isValid() ) {
+        return QtAwesomeGlyph();
+    }
+
+    QtAwesomeGlyph glyph;
+    if( rawFont.isValid() ) {
+        QVector<quint32> indexes = rawFont.glyphIndexesForString( QString(QChar(fa::codepoint(character))) );
+        if( indexes.size() == 1 && indexes.front() != 0 ) {
+            glyph.glyphIndex = indexes.front();
+            glyph.path = rawFont.pathForGlyph( glyph.glyphIndex );
+            glyph.advance = rawFont.advancesForGlyphIndexes( indexes ).front().x();
+            glyph.ascent = rawFont.ascent();
+            glyph.descent = rawFont.descent();
+        }
     }
+    glyphs_.insert( character, glyph );
+    return glyph;
+}
+
+/// Returns the icon font of the given style-qualified character with the given size in pixels
+/// The fonts are cached by family and pixel size for all contexts, so this method is safe and cheap to call while painting
+QFont QtAwesomeCore::font(int character, int size)
+{
+    QPair<QString, int> key( loadFont(fa::iconStyle(character)), size );
+    QMutexLocker locker(&fontMutex_);
+    QHash<QPair<QString, int>, QFont>::const_iterator itr = fonts_.constFind(key);
+    if( itr != fonts_.constEnd() ) {
+        return itr.value();
+    }
+
+    QFont font( key.first );
+    font.setPixelSize(size);
+    fonts_.insert( key, font );
+    return font;
+}
+
+
+//---------------------------------------------------------------------------------------
+QtAwesome *QtAwesome::instance()
+{
+    // the initialization of a function-local static is thread-safe, it happens exactly once
+    static QScopedPointer<QtAwesome> instance( new QtAwesome() );
+    return instance.data();
+}
+
+/// Returns the initial default options, the snapshot is shared by all contexts until they change an option
+static QtAwesomeDefaultOptionsSnapshot initialDefaultOptions()
+{
+    static const QtAwesomeDefaultOptionsSnapshot snapshot = []() {
+        // the default icon colors
+        QtAwesomeDefaultOptions* defaults = new QtAwesomeDefaultOptions();
+        defaults->generation = 0;
+        defaults->options.insert( "color", QColor(50, 50, 50) );
+        defaults->options.insert( "color-disabled", QColor(70, 70, 70, 60));
+        defaults->options.insert( "color-active", QColor(10, 10, 10));
+        defaults->options.insert( "color-selected", QColor(10, 10, 10));
+        defaults->options.insert( "scale-factor", 0.9 );
+
+        defaults->options.insert( "text", QVariant() );
+        defaults->options.insert( "text-disabled", QVariant() );
+        defaults->options.insert( "text-active", QVariant() );
+        defaults->options.insert( "text-selected", QVariant() );
+        return QtAwesomeDefaultOptionsSnapshot( defaults );
+    }();
+    return snapshot;
+}
+
+
+/// Creates a context on the shared core
+/// No font is loaded and no option map is built, the context is usable after the core is initialized
+/// (see initFontAwesome(), which only has to be called once for all contexts)
+QtAwesome::QtAwesome( QObject* parent )
+    : QObject( parent )
+    , core_( QtAwesomeCore::shared() )
+    , defaultOptions_( initialDefaultOptions() )
+    , renderCache_( new QtAwesomeRenderCache() )
+    , internCollectThreshold_( 256 )
+    , internRequests_( 0 )
+    , internHits_( 0 )
+{
 }
 
 
 QtAwesome::~QtAwesome()
 {
-    delete fontIconPainter_;
+    internedIcons_.clear();
 //    delete errorIconPainter_;
-    qDeleteAll(painterMap_);
+    qDeleteAll(*painterMap_.read());
+    qDeleteAll(replacedPainters_);
 }
 
 /// initializes the QtAwesome icon factory with the given fontname
@@ -196,60 +616,185 @@ void QtAwesome::init(const QString& fontname)
 
 
 
-/// a specialized init function so font-awesome is loaded and initialized
-/// this method return true on success, it will return false if the fnot cannot be initialized
-/// To initialize QtAwesome with font-awesome you need to call this method
+/// Initializes the shared core with font-awesome, see QtAwesomeCore::initFontAwesome()
+/// The core is initialized once for all contexts, for every other context this method only returns the first result
 bool QtAwesome::initFontAwesome( )
 {
-    static int fontAwesomeFontId = -1;
-    // only load font-awesome once
-    if( fontAwesomeFontId < 0 ) {
-
-        // The macro below internally calls "qInitResources_QtAwesome()". this initializes
-        // the resource system. For a .pri project this isn't required, but when building and using a
-        // static library the resource need to initialized first.
-        ///
-        // I've checked th qInitResource_* code and calling this method mutliple times shouldn't be any problem
-        // (More info about this subject:  http://qt-project.org/wiki/QtResources)
-        Q_INIT_RESOURCE(QtAwesome);
-        // load the font file
-        //判断图形字体是否存在,不存在则加入
-        QFontDatabase fontDb;
-        if (QFile(":/fonts/fa-regular-400.ttf").exists()) {
-            fontAwesomeFontId = fontDb.addApplicationFont(":/fonts/fa-regular-400.ttf");
-            fontName_regular = fontDb.applicationFontFamilies(fontAwesomeFontId).front();
-        }
-        if (QFile(":/fonts/fa-brands-400.ttf").exists()) {
-            fontAwesomeFontId = fontDb.addApplicationFont(":/fonts/fa-brands-400.ttf");
-            fontName_brands = fontDb.applicationFontFamilies(fontAwesomeFontId).front();
+    return core_->initFontAwesome();
+}
+
+
+/// Registers the font files of all styles now instead of on first use
+/// Returns false if a font cannot be loaded
+bool QtAwesome::loadFonts()
+{
+    return !core_->loadFont(fa::fa_regular).isEmpty() && !core_->loadFont(fa::fa_brands).isEmpty();
+}
+
+
+/// Returns the raw font of the given style, see QtAwesomeCore::rawFont()
+QRawFont QtAwesome::rawFont(fa::style style) const
+{
+    return core_->rawFont( style );
+}
+
+
+/// Uses the given font file for the given style, see QtAwesomeCore::setFontFile()
+/// The fonts are shared, so the file is used by all contexts
+bool QtAwesome::setFontFile(fa::style style, const QString& fileName)
+{
+    return core_->setFontFile( style, fileName );
+}
+
+
+/// Returns the initialization costs of the shared core
+QtAwesomeInitStats QtAwesome::initStats() const
+{
+    return core_->initStats();
+}
+
+
+/// Adds a named code-point. The name hides an icon name with the same name
+/// A new snapshot of the names is published, concurrent lookups are not blocked.
+/// Every call copies the names, use addNamedCodepoints() to add many names
+void QtAwesome::addNamedCodepoint( const QString& name, int codePoint)
+{
+    namedCodepoints_.update( [&]( QHash<QString, int>& names ) {
+        names.insert( name, codePoint );
+    });
+}
+
+/// Adds the given named code-points with a single new snapshot of the names
+void QtAwesome::addNamedCodepoints( const QHash<QString, int>& codePoints )
+{
+    namedCodepoints_.update( [&]( QHash<QString, int>& names ) {
+        for( QHash<QString, int>::const_iterator itr = codePoints.constBegin(); itr != codePoints.constEnd(); ++itr ) {
+            names.insert( itr.key(), itr.value() );
         }
+    });
+}
+
+/// Returns the code-point with the given name, or -1 if the name is unknown
+/// The names added via addNamedCodepoint() are looked up first, then the font-awesome icon names
+int QtAwesome::namedCodepoint( const QString& name ) const
+{
+    QtAwesomeSnapshotRegistry<QHash<QString, int> >::Snapshot names = namedCodepoints_.read();
+    QHash<QString, int>::const_iterator itr = names->constFind( name );
+    if( itr != names->constEnd() ) {
+        return itr.value();
     }
+    return fa::iconByName( name.utf16(), int(name.size()) );
+}
 
-    // intialize the map
-    QHash<QString, int>& m = namedCodepoints_;
-    for (unsigned i = 0; i < sizeof(faNameIconArray) / sizeof(FANameIcon); ++i) {
-        m.insert(faNameIconArray[i].name, faNameIconArray[i].icon);
+/// Returns all named code-points. The map is built on every call, use namedCodepoint() to look up a single name
+QHash<QString, int> QtAwesome::namedCodePoints() const
+{
+    QHash<QString, int> result;
+    QtAwesomeSnapshotRegistry<QHash<QString, int> >::Snapshot names = namedCodepoints_.read();
+    result.reserve( fa::detail::nameCount + names->size() );
+    for( int i = 0; i < fa::detail::nameCount; ++i ) {
+        result.insert( QLatin1String(fa::detail::namePool + fa::detail::nameOffsets[i]), fa::detail::nameIcons[i] );
     }
-    return true;
+    for( QHash<QString, int>::const_iterator itr = names->constBegin(); itr != names->constEnd(); ++itr ) {
+        result.insert( itr.key(), itr.value() );
+    }
+    return result;
 }
 
-void QtAwesome::addNamedCodepoint( const QString& name, int codePoint)
+/// Returns all icons (style-qualified values without the aliases) sorted by value
+/// Together with iconName(), iconNames(), fa::codepoint() and fa::iconStyle() this is the reflection of the icons,
+/// it doesn't need the QMetaEnum of fa::icon (which is only registered with CONFIG += qtawesome_meta_enum)
+QList<int> QtAwesome::icons() const
+{
+    QList<int> result;
+    result.reserve( faIconCount );
+    for( int i = 0; i < faIconCount; ++i ) {
+        result.append( faIcons[i] );
+    }
+    return result;
+}
+
+// the index of the icon in faIcons, or -1 when there's no icon with the given style-qualified value
+static int iconIndex( int character )
 {
-    namedCodepoints_.insert( name, codePoint);
+    fa::style style = fa::iconStyle( character );
+    if( character < 0 || fa::codepoint(character) > 0xffff || (style != fa::fa_regular && style != fa::fa_brands) ) {
+        return -1;
+    }
+    quint16 page = faIconPages[(style == fa::fa_brands ? 256 : 0) + ((character >> 8) & 0xff)];
+    quint16 index = faIconPageEntries[page * 256 + (character & 0xff)];
+    return index == 0xffff ? -1 : int(index);
+}
+
+/// Returns the canonical name of the icon with the given style-qualified value, or an empty string
+/// The lookup is two table reads in the generated reverse index (the aliases are never returned)
+QString QtAwesome::iconName( int character ) const
+{
+    int index = iconIndex( character );
+    return index < 0 ? QString() : QString::fromLatin1( faNameIconArray[faIconNames[index]].name );
+}
+
+/// Returns all names of the icon with the given style-qualified value: the canonical name followed by the aliases
+QStringList QtAwesome::iconNames( int character ) const
+{
+    QStringList result;
+    int index = iconIndex( character );
+    if( index >= 0 ) {
+        for( int i = faIconNames[index]; i < faIconNames[index] + faIconNameCounts[index]; ++i ) {
+            result.append( QString::fromLatin1( faNameIconArray[i].name ) );
+        }
+    }
+    return result;
+}
+
+/// Returns the icons (style-qualified values, sorted) that have the given search keyword
+/// The keywords are the words of the icon names ("arrow" matches arrow_up and circle_arrow_down) and the
+/// search terms of icons.txt. The lookup is a binary search in the generated keyword index
+QList<int> QtAwesome::iconsByKeyword( const QString& keyword ) const
+{
+    const QByteArray word = keyword.toLower().toLatin1();
+    const quint32* begin = faKeywordOffsets;
+    const quint32* end = faKeywordOffsets + faKeywordCount;
+    const quint32* itr = std::lower_bound( begin, end, word, []( quint32 offset, const QByteArray& value ) {
+        return qstrcmp( faKeywordPool + offset, value.constData() ) < 0;
+    });
+
+    QList<int> result;
+    if( itr == end || qstrcmp( faKeywordPool + *itr, word.constData() ) != 0 ) {
+        return result;
+    }
+    const int k = int(itr - begin);
+    for( quint32 j = faKeywordIconBegin[k]; j < faKeywordIconBegin[k + 1]; ++j ) {
+        result.append( faIcons[faKeywordIcons[j]] );
+    }
+    return result;
 }
 
 
 /// Sets a default option. These options are passed on to the icon painters
+/// A new snapshot of the default options is published, icons that are already created are not affected
 void QtAwesome::setDefaultOption(const QString& name, const QVariant& value)
 {
-    defaultOptions_.insert( name, value );
+    QMutexLocker locker( &defaultOptionsMutex_ );
+    QtAwesomeDefaultOptions* defaults = new QtAwesomeDefaultOptions( *defaultOptions_ );
+    ++defaults->generation;
+    defaults->options.insert( name, value );
+    defaultOptions_ = QtAwesomeDefaultOptionsSnapshot( defaults );
 }
 
 
 /// Returns the default option for the given name
 QVariant QtAwesome::defaultOption(const QString& name)
 {
-    return defaultOptions_.value( name );
+    return defaultOptions()->options.value( name );
+}
+
+
+/// Returns the current snapshot of the default options
+QtAwesomeDefaultOptionsSnapshot QtAwesome::defaultOptions() const
+{
+    QMutexLocker locker( &defaultOptionsMutex_ );
+    return defaultOptions_;
 }
 
 
@@ -268,16 +813,121 @@ static QVariantMap mergeOptions( const QVariantMap& defaults, const QVariantMap&
 }
 
 
-/// Creates an icon with the given code-point
+// internal helper method that returns the options of the active option scopes with the given options on top
+static QVariantMap scopedOptions( const QVariantMap& options )
+{
+    QVariantMap scoped = QtAwesomeOptionScope::currentOptions();
+    return scoped.isEmpty() ? options : mergeOptions( scoped, options );
+}
+
+
+// internal helper method that adds the glyph of the given style-qualified icon to the options
+// A 'style' option (of the icon or of an option scope) selects the font, otherwise the style bits of the icon do
+static void insertGlyphOptions( QVariantMap* options, int character )
+{
+    options->insert("text", QString( QChar(fa::codepoint(character)) ) );
+    if( !options->contains("style") ) {
+        options->insert("style", int(fa::iconStyle(character)) );
+    }
+}
+
+
+// internal helper method that renders the given style-qualified icon with the given (scoped) options
+// The text fallback (drawText() and the font registration) requires the GUI thread, so only a single character with
+// a glyph in its font is rendered. Any other text of the mode and state (e.g. a 'text-disabled' option) is a
+// transparent image
+static QImage renderGlyphImage( QtAwesomeCore* core, QtAwesomeRenderCache* cache, int character, const QVariantMap& options,
+                                const QVariantMap& defaults, const QSize& size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state )
+{
+    QVariantMap delta = options;
+    insertGlyphOptions( &delta, character );
+    QtAwesomeIconOptions charOptions = QtAwesomeIconOptions::fromVariantMap( delta, defaults );
+
+    const QString& text = charOptions.text( mode, state );
+    if( text.size() != 1 || !core->glyph(fa::qualified(charOptions.style, text.front().unicode())).isValid() ) {
+        QImage image( size * devicePixelRatio, QImage::Format_ARGB32_Premultiplied );
+        image.fill( Qt::transparent );
+        image.setDevicePixelRatio( devicePixelRatio );
+        return image;
+    }
+    return QtAwesomeCharIconPainter::renderImage( core, cache, charOptions, size, devicePixelRatio, mode, state );
+}
+
+
+/// Creates an icon with the given style-qualified icon (see fa::qualified)
+/// A bare code-point without style bits is painted with the regular font, unless a 'style' option is given
+/// A negative value (an unknown name) or unknown style bits return a null icon with a warning
 /// <code>
-///     awesome->icon( icon_group )
+///     awesome->icon( fa::music )
+///     awesome->icon( 0xf09b, QVariantMap{{"style", fa::fa_brands}} )     // the same icon as fa::github
 /// </code>
 QIcon QtAwesome::icon(int character, const QVariantMap &options)
 {
-    // create a merged QVariantMap to have default options and icon-specific options
-    QVariantMap optionMap = mergeOptions( defaultOptions_, options );
-    optionMap.insert("text", QString( QChar(static_cast<int>(character)) ) );
-    return icon( fontIconPainter_, optionMap );
+    // -1 is the result of an unknown name (see fa::iconByName), other style bits are no font style
+    fa::style style = fa::iconStyle( character );
+    if( character < 0 || (style != fa::fa_regular && style != fa::fa_brands) ) {
+        qWarning() << "QtAwesome::icon: invalid icon" << character;
+        return QIcon();
+    }
+
+    // the icon-specific options overlay the default options snapshot, the engine only keeps the resolved options
+    QtAwesomeDefaultOptionsSnapshot defaults = defaultOptions();
+    QVariantMap delta = scopedOptions( options );
+    insertGlyphOptions( &delta, character );
+
+    // identical icons share the same engine (and cacheKey)
+    QtAwesomeIconOptions charOptions = QtAwesomeIconOptions::fromVariantMap( delta, defaults->options );
+    QMutexLocker locker(&internMutex_);
+    ++internRequests_;
+    QHash<QtAwesomeIconOptions, QIcon>::const_iterator itr = internedIcons_.constFind( charOptions );
+    if( itr != internedIcons_.constEnd() ) {
+        ++internHits_;
+        return itr.value();
+    }
+
+    if( internedIcons_.size() >= internCollectThreshold_ ) {
+        collectInternedIconsLocked();
+    }
+
+    QIcon result( new QtAwesomeIconPainterIconEngine( core_, renderCache_, charOptions ) );
+    internedIcons_.insert( charOptions, result );
+    return result;
+}
+
+
+/// Returns the counters of the icon interning
+QtAwesomeInternStats QtAwesome::internStats() const
+{
+    QMutexLocker locker(&internMutex_);
+    QtAwesomeInternStats result;
+    result.requests = internRequests_;
+    result.hits = internHits_;
+    result.entries = internedIcons_.size();
+    return result;
+}
+
+
+/// Removes the interned icons that are not used anymore outside of QtAwesome
+/// This happens automatically when the table grows, call it to release the memory immediately
+void QtAwesome::collectInternedIcons()
+{
+    QMutexLocker locker(&internMutex_);
+    collectInternedIconsLocked();
+}
+
+
+void QtAwesome::collectInternedIconsLocked()
+{
+    // the table only holds a weak reference: a detached icon isn't referenced by anyone else
+    QHash<QtAwesomeIconOptions, QIcon>::iterator itr = internedIcons_.begin();
+    while( itr != internedIcons_.end() ) {
+        if( itr.value().isDetached() ) {
+            itr = internedIcons_.erase( itr );
+        } else {
+            ++itr;
+        }
+    }
+    internCollectThreshold_ = qMax( 256, internedIcons_.size() * 2 );
 }
 
 
@@ -296,17 +946,19 @@ QIcon QtAwesome::icon(int character, QColor color)
 QIcon QtAwesome::icon(const QString& name, const QVariantMap& options)
 {
     // when it's a named codepoint
-    if( namedCodepoints_.count(name) ) {
-        return icon( namedCodepoints_.value(name), options );
+    int codePoint = namedCodepoint( name );
+    if( codePoint >= 0 ) {
+        return icon( codePoint, options );
     }
 
 
     // create a merged QVariantMap to have default options and icon-specific options
-    QVariantMap optionMap = mergeOptions( defaultOptions_, options );
+    QVariantMap optionMap = mergeOptions( defaultOptions()->options, scopedOptions( options ) );
 
     // this method first tries to retrieve the icon
-    QtAwesomeIconPainter* painter = painterMap_.value(name);
+    QtAwesomeIconPainter* painter = painterMap_.read()->value(name);
     if( !painter ) {
+        qWarning() << "QtAwesome::icon: unknown icon name" << name;
         return QIcon();
     }
 
@@ -332,15 +984,87 @@ QIcon QtAwesome::icon(QtAwesomeIconPainter* painter, const QVariantMap& optionMa
     return QIcon( engine );
 }
 
+/// Renders the given style-qualified icon to a premultiplied image of size * devicePixelRatio pixels
+///
+/// This method is thread-safe and doesn't use QPixmap, it can be called concurrently from worker threads
+/// (for example from a QThreadPool) after initFontAwesome(). The coverage masks are shared with the icons
+/// via the render cache. Animations are not applied. When the text of the mode and state isn't a single character
+/// with a glyph in its font (the icon or a 'text-*' option), a transparent image is returned, because the text
+/// fallback requires the GUI thread.
+QImage QtAwesome::renderImage( int character, const QVariantMap& options, const QSize& size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state )
+{
+    return renderGlyphImage( core_.data(), renderCache_.data(), character, scopedOptions( options ), defaultOptions()->options,
+                             size, devicePixelRatio, mode, state );
+}
+
+
+/// Rasterizes the given icons in all given sizes on worker threads into the shared render cache
+///
+/// Call it before a screen with many icons is shown: the icons then only tint the cached masks while painting.
+/// Icons that are painted before the prefetch is finished are rendered synchronously as usual.
+/// The sizes are the device-independent sizes of the icons, the masks are rendered for size * devicePixelRatio
+/// device pixels: the size an icon requests on a screen with that device pixel ratio. The options are resolved on
+/// the calling thread (including its option scopes and the current default options), so they must match the options
+/// of the icons.
+///
+/// Every icon and size is one step of the returned future: it reports the progress and it can be canceled.
+/// The jobs hold a reference to the core and the render cache, so the context may be destroyed before they are done.
+QFuture<void> QtAwesome::prefetch( const QList<int>& characters, const QList<QSize>& sizes, const QVariantMap& options, qreal devicePixelRatio )
+{
+    struct Job
+    {
+        int character;
+        QSize size;
+    };
+
+    // the jobs are owned by the map functor, which lives until the last job is done
+    QSharedPointer<QVector<Job> > jobs( new QVector<Job>() );
+    jobs->reserve( characters.size() * sizes.size() );
+    for( int character : characters ) {
+        for( const QSize& size : sizes ) {
+            jobs->append( Job{ character, size } );
+        }
+    }
+
+    QSharedPointer<QtAwesomeCore> core = core_;
+    QSharedPointer<QtAwesomeRenderCache> cache = renderCache_;
+    QtAwesomeDefaultOptionsSnapshot defaults = defaultOptions();
+    QVariantMap scoped = scopedOptions( options );
+    return QtConcurrent::map( jobs->begin(), jobs->end(), [core, cache, defaults, jobs, scoped, devicePixelRatio]( Job& job ) {
+        renderGlyphImage( core.data(), cache.data(), job.character, scoped, defaults->options, job.size, devicePixelRatio,
+                          QIcon::Normal, QIcon::Off );
+    });
+}
+
+
 /// Adds a named icon-painter to the QtAwesome icon map
 /// As the name applies the ownership is passed over to QtAwesome
 ///
+/// A new snapshot of the painters is published, concurrent lookups are not blocked.
+/// A replaced painter is deleted when QtAwesome is destroyed, because existing icons may still paint with it.
+/// Every call copies the painter map, use give(QHash) to add many painters
+///
 /// @param name the name of the icon
 /// @param painter the icon painter to add for this name
 void QtAwesome::give(const QString& name, QtAwesomeIconPainter* painter)
 {
-    delete painterMap_.value( name );   // delete the old one
-    painterMap_.insert( name, painter );
+    QHash<QString, QtAwesomeIconPainter*> painters;
+    painters.insert( name, painter );
+    give( painters );
+}
+
+/// Adds the given named icon-painters with a single new snapshot of the painters, see give()
+void QtAwesome::give( const QHash<QString, QtAwesomeIconPainter*>& painters )
+{
+    painterMap_.update( [&]( QHash<QString, QtAwesomeIconPainter*>& current ) {
+        for( QHash<QString, QtAwesomeIconPainter*>::const_iterator itr = painters.constBegin(); itr != painters.constEnd(); ++itr ) {
+            QtAwesomeIconPainter* replaced = current.value( itr.key() );
+            if( replaced && replaced != itr.value() ) {
+                replacedPainters_.append( replaced );
+            }
+            current.insert( itr.key(), itr.value() );
+        }
+    });
 }
 
 /// Creates/Gets the icon font with a given size in pixels. This can be usefull to use a label for displaying icons
@@ -348,15 +1072,40 @@ void QtAwesome::give(const QString& name, QtAwesomeIconPainter* painter)
 ///
 ///    QLabel* label = new QLabel( QChar( icon_group ) );
 ///    label->setFont( awesome->font(16) )
-QFont QtAwesome::font(int character, int size )
+///
+/// The font only depends on the character and size, no state of QtAwesome is changed, see QtAwesomeCore::font()
+QFont QtAwesome::font(int character, int size ) const
 {
-    selectFont(character);
-    QFont font( fontName_);
-    font.setPixelSize(size);
-    return font;
+    return core_->font( character, size );
+}
+
+/// Returns the font family that is used to paint the given style-qualified character
+QString QtAwesome::fontFamily(int character) const
+{
+    return core_->loadFont( fa::iconStyle(character) );
+}
+
+/// Returns the font style of the given style-qualified character
+fa::style QtAwesome::fontStyle(int character) const
+{
+    return fa::iconStyle(character);
+}
+
+/// Returns the outline and metrics of the glyph for the given style-qualified character, see QtAwesomeCore::glyph()
+QtAwesomeGlyph QtAwesome::glyph(int character)
+{
+    return core_->glyph( character );
+}
+
+/// Returns true if the given style-qualified character is painted with the brands font
+bool QtAwesome::isBrand(int character) const
+{
+    return fa::iconStyle(character) == fa::fa_brands;
 }
 
+/// Selects the font-name that is returned by fontName()
+/// This method isn't used for painting, use fontFamily() to get the font without changing the state of QtAwesome
 void QtAwesome::selectFont(int character)
 {
-    fontName_ = brandsIds.contains(character) ? fontName_brands : fontName_regular;
+    fontName_ = fontFamily(character);
 }
@@ -6,13 +6,29 @@
 #ifndef QTAWESOME_H
 #define QTAWESOME_H
 
+#ifdef QTAWESOME_SUBSET
+#include <enum_name_index.h>    // the per-application subset created by tools/fasubset
+#else
 #include "enum_name_index.h"
+#endif
 #include "QtAwesomeAnim.h"
+#include "QtAwesomeRenderCache.h"
 
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QFile>
+#include <QFont>
+#include <QFuture>
 #include <QIcon>
 #include <QIconEngine>
+#include <QMutex>
+#include <QObject>
 #include <QPainter>
+#include <QPainterPath>
+#include <QRawFont>
 #include <QRect>
+#include <QSharedPointer>
+#include <QStringList>
 #include <QVariantMap>
 
 //---------------------------------------------------------------------------------------
@@ -21,25 +37,279 @@
 class QtAwesomeIconPainter;
 class QtAwesome;
 
+/// The options of a font-awesome icon, resolved once when the icon is created
+/// The QVariantMap options are compiled into this struct, so painting requires no map lookups
+struct QtAwesomeIconOptions
+{
+    enum { SlotCount = 8 };     ///< 4 modes x 2 states
+
+    static QtAwesomeIconOptions fromVariantMap( const QVariantMap& options, const QVariantMap& defaults = QVariantMap() );
+
+    /// Returns the table slot of the given mode and state
+    static int slot( QIcon::Mode mode, QIcon::State state ) { return mode * 2 + state; }
+
+    const QColor& color( QIcon::Mode mode, QIcon::State state ) const { return colors[slot(mode, state)]; }
+    const QString& text( QIcon::Mode mode, QIcon::State state ) const { return texts[slot(mode, state)]; }
+
+    QColor colors[SlotCount];                   ///< the color by mode and state slot
+    QString texts[SlotCount];                   ///< the text by mode and state slot
+    float scaleFactor = 0.9f;                   ///< the 'scale-factor' option
+    QtAwesomeAnimation* anim = QTAWESOME_NULL;  ///< the 'anim' option
+    fa::style style = fa::fa_regular;           ///< the 'style' option, the font style of the text
+};
+
+inline bool operator==( const QtAwesomeIconOptions& a, const QtAwesomeIconOptions& b )
+{
+    for( int i = 0; i < QtAwesomeIconOptions::SlotCount; ++i ) {
+        if( a.colors[i] != b.colors[i] || a.texts[i] != b.texts[i] ) {
+            return false;
+        }
+    }
+    return a.scaleFactor == b.scaleFactor && a.anim == b.anim && a.style == b.style;
+}
+
+inline uint qHash( const QtAwesomeIconOptions& options, uint seed = 0 )
+{
+    uint h = seed;
+    for( int i = 0; i < QtAwesomeIconOptions::SlotCount; ++i ) {
+        h = 31 * h + uint(options.colors[i].rgba());
+        h = 31 * h + uint(qHash(options.texts[i]));
+    }
+    h = 31 * h + uint(qRound(options.scaleFactor * 1000));
+    h = 31 * h + uint(qHash(options.anim));
+    h = 31 * h + uint(options.style);
+    return h;
+}
+
+/// The counters of the icon interning. Identical icons share a single icon engine
+struct QtAwesomeInternStats
+{
+    quint64 requests;   ///< number of icons requested via icon(int, ...)
+    quint64 hits;       ///< number of requests that returned an existing icon
+    int entries;        ///< number of interned icons
+
+    /// The fraction of requests that were deduplicated
+    double dedupRatio() const { return requests ? double(hits) / requests : 0.0; }
+};
+
+/// An immutable, generation-numbered snapshot of the default options
+/// Icons resolve their options from the snapshot when they are created; setDefaultOption() publishes a new snapshot
+struct QtAwesomeDefaultOptions
+{
+    quint64 generation;     ///< increased for every change of the default options
+    QVariantMap options;    ///< the default options
+};
+
+typedef QSharedPointer<const QtAwesomeDefaultOptions> QtAwesomeDefaultOptionsSnapshot;
+
+/// A read-mostly value that is published as immutable snapshots (RCU-style)
+/// Readers take no lock and always see a complete snapshot. The writers are serialized and publish a modified copy.
+/// A replaced snapshot is deleted by the first update() that finds no active reader, a reader can't reach it anymore.
+/// Every update() copies the value, use a single update() for many changes.
+template <typename T>
+class QtAwesomeSnapshotRegistry
+{
+public:
+    /// The snapshot of a reader, the snapshot isn't deleted while this object is alive
+    class Snapshot
+    {
+    public:
+        explicit Snapshot( const QtAwesomeSnapshotRegistry& registry ) : registry_(registry) {
+            // announce the reader before the snapshot is loaded, see update()
+            registry_.readers_.ref();
+            value_ = registry_.current_.loadAcquire();
+        }
+        ~Snapshot() { registry_.readers_.deref(); }
+
+        const T& operator*() const { return *value_; }
+        const T* operator->() const { return value_; }
+
+    private:
+        Q_DISABLE_COPY(Snapshot)
+
+        const QtAwesomeSnapshotRegistry& registry_;
+        const T* value_;
+    };
+
+    QtAwesomeSnapshotRegistry() : current_( new T() ) {}
+    ~QtAwesomeSnapshotRegistry() {
+        qDeleteAll( retired_ );
+        delete current_.loadAcquire();
+    }
+
+    /// Returns the current snapshot, keep the result only as long as it's used
+    Snapshot read() const { return Snapshot( *this ); }
+
+    /// Applies the given modification to a copy of the current snapshot and publishes the copy
+    /// The modification is called with the writer lock held
+    template <typename Modify>
+    void update( Modify modify ) {
+        QMutexLocker locker( &mutex_ );
+        const T* current = current_.loadAcquire();
+        T* next = new T( *current );
+        modify( *next );
+        current_.fetchAndStoreOrdered( next );
+        retired_.append( current );
+
+        // a reader that announces itself after this point loads the new snapshot. Without an active reader
+        // nobody holds a retired snapshot anymore
+        if( readers_.fetchAndAddOrdered( 0 ) == 0 ) {
+            qDeleteAll( retired_ );
+            retired_.clear();
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(QtAwesomeSnapshotRegistry)
+
+    QAtomicPointer<const T> current_;   ///< the published snapshot
+    mutable QAtomicInt readers_;        ///< the number of active readers
+    QMutex mutex_;                      ///< serializes the writers
+    QList<const T*> retired_;           ///< the replaced snapshots, an active reader may still use them
+};
+
+/// Temporarily overrides options for all icons created by the current thread, while the scope is alive
+/// The default options are not changed, so other threads are not affected
+/// <code>
+///     QtAwesomeOptionScope scope( QVariantMap{{"scale-factor", 0.7}} );
+///     QIcon icon = awesome->icon( fa::music );    // is created with a scale-factor of 0.7
+/// </code>
+class QtAwesomeOptionScope
+{
+public:
+    explicit QtAwesomeOptionScope( const QVariantMap& options );
+    ~QtAwesomeOptionScope();
+
+    /// Returns the overrides of all active scopes of the current thread
+    static QVariantMap currentOptions();
+
+private:
+    Q_DISABLE_COPY(QtAwesomeOptionScope)
+
+    const QtAwesomeOptionScope* parent_;    ///< the enclosing scope of this thread
+    QVariantMap options_;                   ///< the overrides of this scope merged with the enclosing scopes
+};
+
+/// The startup costs of QtAwesome::initFontAwesome()
+struct QtAwesomeInitStats
+{
+    bool initialized = false;       ///< true when the initialization is done
+    int calls = 0;                  ///< number of calls to initFontAwesome()
+    qint64 resourceInitNs = 0;      ///< the duration of the resource initialization in nanoseconds
+    int fontsLoaded = 0;            ///< number of font files that are registered, the fonts are registered on first use
+    qint64 fontRegistrationNs = 0;  ///< the total duration of the font registrations in nanoseconds
+    qint64 indexBuildNs = 0;        ///< always 0, the name index is generated at build time (enum_name_hash.h)
+    qint64 rawFontLoadNs = 0;       ///< the total duration of loading the raw fonts used for the glyph outlines
+
+    qint64 totalNs() const { return resourceInitNs + fontRegistrationNs + indexBuildNs + rawFontLoadNs; }
+};
+
+/// The outline and metrics of a single glyph, resolved once via QRawFont
+/// All values are in pixels for a font with a pixel size of QtAwesomeGlyph::ReferenceSize.
+/// The path belongs to the thread that requested the glyph, don't pass it to another thread
+struct QtAwesomeGlyph
+{
+    enum { ReferenceSize = 1000 };
+
+    bool isValid() const { return glyphIndex != 0; }
+
+    quint32 glyphIndex = 0;     ///< the glyph index in the font, 0 when the font doesn't contain the glyph
+    QPainterPath path;          ///< the outline, with the origin on the baseline
+    qreal advance = 0;          ///< the horizontal advance
+    qreal ascent = 0;           ///< the ascent of the font
+    qreal descent = 0;          ///< the descent of the font
+};
+
+/// The fonts and glyphs that are shared by all QtAwesome contexts
+/// The core is reference counted and immutable after the initialization: the fonts are registered and the glyphs
+/// are resolved on first use, but the result never changes. A context only holds a reference to the core,
+/// so creating a QtAwesome context doesn't load, map or register any font.
+class QtAwesomeCore
+{
+public:
+    static QSharedPointer<QtAwesomeCore> shared();
+
+    bool initFontAwesome();
+    bool setFontFile(fa::style style, const QString& fileName);
+    QString loadFont(fa::style style);
+    QRawFont rawFont(fa::style style);
+    QtAwesomeGlyph glyph(int character);
+    QFont font(int character, int size);
+    QtAwesomeInitStats initStats() const;
+
+private:
+    Q_DISABLE_COPY(QtAwesomeCore)
+
+    QtAwesomeCore();
+
+    /// A font file that is registered with the font database on the first use of its style
+    struct LazyFont
+    {
+        explicit LazyFont( const char* file ) : fileName( QLatin1String(file) ) {}
+
+        QString fileName;                   ///< the resource file of the font
+        QString family;                     ///< the family, when the font is registered with the font database
+        QAtomicInt loaded;                  ///< true when the font is registered with the font database
+        QByteArray data;                    ///< the font data, not copied from the resource or mapped file
+        bool dataUsed = false;              ///< true when a raw font is built on the data, it cannot be replaced anymore
+        QScopedPointer<QFile> mappedFile;   ///< the external font file set with setFontFile()
+    };
+
+    LazyFont& lazyFont(fa::style style) { return style == fa::fa_brands ? brandsFont_ : regularFont_; }
+    QByteArray fontData(fa::style style);
+    QtAwesomeGlyph sharedGlyph(int character);
+
+    mutable QMutex initMutex_;
+    QtAwesomeInitStats initStats_;                 ///< The costs of initFontAwesome() and the font loading
+    bool initResult_;                              ///< The result of initFontAwesome()
+    LazyFont regularFont_;
+    LazyFont brandsFont_;
+
+    QMutex glyphMutex_;
+    QHash<int, QtAwesomeGlyph> glyphs_;            ///< The resolved glyphs by style-qualified code-point, shared by all threads
+
+    QMutex fontMutex_;
+    QHash<QPair<QString, int>, QFont> fonts_;      ///< The fonts by family and pixel size
+};
+
 /// The main class for managing icons
 /// This class requires a 2-phase construction. You must first create the class and then initialize it via an init* method
+///
+/// QtAwesome::instance() is the application-wide context. More contexts can be created, for example for a plugin
+/// with its own colors or painters. Every context owns its default options, painters and caches; all contexts
+/// share the fonts and glyphs of QtAwesomeCore::shared()
+/// The font-awesome icons of a context share its render cache, they keep painting when the context is destroyed.
+/// Icons of custom painters are transparent then, because the painters are deleted with the context.
 class QtAwesome : public QObject
 {
     Q_OBJECT
 
 public:
+    explicit QtAwesome(QObject *parent = QTAWESOME_NULL);
 
     static QtAwesome *instance();
     virtual ~QtAwesome();
 
     void init( const QString& fontname );
     bool initFontAwesome();
+    bool loadFonts();
+    bool setFontFile(fa::style style, const QString& fileName);
+    QRawFont rawFont(fa::style style) const;
+    QtAwesomeInitStats initStats() const;
+    QSharedPointer<QtAwesomeCore> core() const { return core_; }
 
     void addNamedCodepoint( const QString& name, int codePoint );
-    QHash<QString, int> namedCodePoints() { return namedCodepoints_; }
+    void addNamedCodepoints( const QHash<QString, int>& codePoints );
+    int namedCodepoint( const QString& name ) const;
+    QHash<QString, int> namedCodePoints() const;
+    QList<int> icons() const;
+    QList<int> iconsByKeyword( const QString& keyword ) const;
+    QString iconName( int character ) const;
+    QStringList iconNames( int character ) const;
 
     void setDefaultOption( const QString& name, const QVariant& value  );
     QVariant defaultOption( const QString& name );
+    QtAwesomeDefaultOptionsSnapshot defaultOptions() const;
 
     QIcon icon( int character, const QVariantMap& options = QVariantMap() );
     QIcon icon( int character, QColor color);
@@ -47,28 +317,49 @@ public:
     QIcon icon( const QString& name, QColor color);
     QIcon icon(QtAwesomeIconPainter* painter, const QVariantMap& optionMap = QVariantMap() );
 
+    QImage renderImage( int character, const QVariantMap& options, const QSize& size, qreal devicePixelRatio = 1.0,
+                        QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off );
+    QFuture<void> prefetch( const QList<int>& characters, const QList<QSize>& sizes, const QVariantMap& options = QVariantMap(),
+                            qreal devicePixelRatio = 1.0 );
+
     void give( const QString& name, QtAwesomeIconPainter* painter );
+    void give( const QHash<QString, QtAwesomeIconPainter*>& painters );
 
-    QFont font(int character, int size );
+    QFont font(int character, int size ) const;
+    QString fontFamily(int character) const;
+    fa::style fontStyle(int character) const;
+    bool isBrand(int character) const;
+    QtAwesomeGlyph glyph(int character);
+
+    /// Returns the cache of rendered glyph pixmaps of this context
+    QtAwesomeRenderCache* renderCache() { return renderCache_.data(); }
+
+    QtAwesomeInternStats internStats() const;
+    void collectInternedIcons();
 
     /// Returns the font-name that is used as icon-map
     void selectFont(int character);
     QString fontName() { return fontName_ ; }
 
 private:
-    static QScopedPointer<QtAwesome> m_instance;
-    explicit QtAwesome(QObject *parent = QTAWESOME_NULL);
+    void collectInternedIconsLocked();
 
+    QSharedPointer<QtAwesomeCore> core_;                   ///< The shared fonts and glyphs
     QString fontName_;
-    QString fontName_regular;
-    QString fontName_brands;
     ///< The font name used for this map
-    QHash<QString, int> namedCodepoints_;                  ///< A map with names mapped to code-points
-    QList<int> brandsIds;
+    QtAwesomeSnapshotRegistry<QHash<QString, int> > namedCodepoints_;    ///< The runtime added names mapped to code-points, on top of the generated names
+
+    QtAwesomeSnapshotRegistry<QHash<QString, QtAwesomeIconPainter*> > painterMap_;     ///< A map of custom painters
+    QList<QtAwesomeIconPainter*> replacedPainters_;        ///< The painters replaced by give(), icons may still use them
+    mutable QMutex defaultOptionsMutex_;
+    QtAwesomeDefaultOptionsSnapshot defaultOptions_;       ///< The current snapshot of the default icon options
+    QSharedPointer<QtAwesomeRenderCache> renderCache_;     ///< The cache of rendered glyph pixmaps, shared with the icons of this context
 
-    QHash<QString, QtAwesomeIconPainter*> painterMap_;     ///< A map of custom painters
-    QVariantMap defaultOptions_;                           ///< The default icon options
-    QtAwesomeIconPainter* fontIconPainter_;                ///< A special painter fo painting codepoints
+    mutable QMutex internMutex_;
+    QHash<QtAwesomeIconOptions, QIcon> internedIcons_;     ///< The shared icons by their resolved options
+    int internCollectThreshold_;                           ///< The table size that triggers the next collection
+    quint64 internRequests_;
+    quint64 internHits_;
 };
 
 
@@ -1,13 +1,45 @@
 
+# A per-application subset of the fonts and the icon index can be created with tools/fasubset.
+# Set the output directory of fasubset before including this file:
+#
+#   QTAWESOME_SUBSET_DIR = $$PWD/awesome_subset
+#   include(QtAwesome6/QtAwesome.pri)
+!isEmpty(QTAWESOME_SUBSET_DIR) {
+    DEFINES += QTAWESOME_SUBSET
+    INCLUDEPATH += $$QTAWESOME_SUBSET_DIR
+}
+
 INCLUDEPATH += $$PWD
 
+# the generated index (enum_name_hash.h) uses inline constexpr tables
+CONFIG += c++17
+
+# QtAwesome::prefetch() rasterizes on the global thread pool
+QT += concurrent
+
 SOURCES +=\
     $$PWD/QtAwesome.cpp \
-    $$PWD/QtAwesomeAnim.cpp
+    $$PWD/QtAwesomeAnim.cpp \
+    $$PWD/QtAwesomeRenderCache.cpp
 
 HEADERS +=\
-    $$PWD/enum_name_index.h \
     $$PWD/QtAwesome.h \
-    $$PWD/QtAwesomeAnim.h
+    $$PWD/QtAwesomeAnim.h \
+    $$PWD/QtAwesomeRenderCache.h
     
-RESOURCES += $$PWD/QtAwesome.qrc
+isEmpty(QTAWESOME_SUBSET_DIR): QTAWESOME_INDEX_DIR = $$PWD
+else: QTAWESOME_INDEX_DIR = $$QTAWESOME_SUBSET_DIR
+
+SOURCES += $$QTAWESOME_INDEX_DIR/enum_name_index.cpp
+HEADERS += $$QTAWESOME_INDEX_DIR/enum_name_hash.h
+RESOURCES += $$QTAWESOME_INDEX_DIR/QtAwesome.qrc
+
+# The fa::icon enum is registered in the meta-object system (Q_ENUM_NS, QMetaEnum::fromType<fa::icon>())
+# only with CONFIG += qtawesome_meta_enum. Without it, moc doesn't process the 4571 enumerators;
+# QtAwesome::icons() and QtAwesome::iconName() offer the names without the meta-object system.
+qtawesome_meta_enum {
+    DEFINES += QTAWESOME_META_ENUM
+    HEADERS += $$QTAWESOME_INDEX_DIR/enum_name_index.h
+} else {
+    OTHER_FILES += $$QTAWESOME_INDEX_DIR/enum_name_index.h
+}
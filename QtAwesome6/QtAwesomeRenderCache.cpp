@@ -0,0 +1,278 @@
+#include "QtAwesomeRenderCache.h"
+
+#include <QPainter>
+
+// the cost of a pixmap in the cache in kilobytes (at least 1)
+static int pixmapCost( const QPixmap& pixmap )
+{
+    qint64 bytes = qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+    return qMax( 1, int(bytes / 1024) );
+}
+
+// the cost of an image in the cache in kilobytes (at least 1)
+static int imageCost( const QImage& image )
+{
+    return qMax( 1, int(image.sizeInBytes() / 1024) );
+}
+
+// the expected cost of the pixmap of the given key in kilobytes, the pixmaps are 32-bit
+static int estimatedCost( const QtAwesomeRenderKey& key )
+{
+    qint64 bytes = qint64(key.size.width()) * key.size.height() * 4;
+    return qMax( 1, int(bytes / 1024) );
+}
+
+// the expected cost of the mask of the given key in kilobytes, the Alpha8 lines are 32-bit aligned
+static int estimatedCost( const QtAwesomeMaskKey& key )
+{
+    qint64 bytes = qint64((key.size.width() + 3) & ~3) * key.size.height();
+    return qMax( 1, int(bytes / 1024) );
+}
+
+// the part of the given maximum cost of the given shard, the shards together have the full cost
+// The overflow shard has a quarter, the hashed shards share the rest
+static int shardCost( int kilobytes, int shard )
+{
+    int overflow = kilobytes / 4;
+    if( shard == QtAwesomeRenderCache::OverflowShard ) {
+        return overflow;
+    }
+    int hashed = kilobytes - overflow;
+    return hashed / QtAwesomeRenderCache::ShardCount + (shard < hashed % QtAwesomeRenderCache::ShardCount ? 1 : 0);
+}
+
+
+/// Locks a shard and counts the locks that had to wait for another thread
+class QtAwesomeRenderCache::ShardLocker
+{
+public:
+    explicit ShardLocker( Shard& shard ) : shard_(shard) {
+        relock();
+    }
+    ~ShardLocker() {
+        if( locked_ ) {
+            shard_.mutex.unlock();
+        }
+    }
+
+    void unlock() {
+        shard_.mutex.unlock();
+        locked_ = false;
+    }
+
+    void relock() {
+        if( !shard_.mutex.tryLock() ) {
+            shard_.mutex.lock();
+            ++shard_.contentions;
+        }
+        locked_ = true;
+    }
+
+private:
+    Q_DISABLE_COPY(ShardLocker)
+
+    Shard& shard_;
+    bool locked_ = false;
+};
+
+
+/// Returns the shard of the given key: the overflow shard when the entry doesn't fit in a hashed shard,
+/// otherwise the hashed shard of the key
+template <typename Key>
+QtAwesomeRenderCache::Shard& QtAwesomeRenderCache::shard( const Key& key, int cost, const QAtomicInt& shardMaxCost ) const
+{
+    if( cost > shardMaxCost.loadAcquire() ) {
+        return shards_[OverflowShard];
+    }
+    uint h = qHash( key );
+    return shards_[(h ^ (h >> 16)) % ShardCount];
+}
+
+QtAwesomeRenderCache::Shard& QtAwesomeRenderCache::shard( const QtAwesomeRenderKey& key ) const
+{
+    return shard( key, estimatedCost(key), shardMaxCost_ );
+}
+
+QtAwesomeRenderCache::Shard& QtAwesomeRenderCache::shard( const QtAwesomeMaskKey& key ) const
+{
+    return shard( key, estimatedCost(key), shardMaxMaskCost_ );
+}
+
+
+QtAwesomeRenderCache::QtAwesomeRenderCache( int maxCost, int maxMaskCost )
+{
+    setMaxCost( maxCost );
+    setMaxMaskCost( maxMaskCost );
+}
+
+/// Looks up the pixmap for the given key. Returns true and fills the pixmap on a hit
+/// A hit makes the entry the most recently used one of its shard
+bool QtAwesomeRenderCache::find( const QtAwesomeRenderKey& key, QPixmap* pixmap )
+{
+    Shard& s = shard( key );
+    ShardLocker locker( s );
+    QPixmap* cached = s.cache.object( key );
+    if( !cached ) {
+        ++s.misses;
+        return false;
+    }
+    ++s.hits;
+    *pixmap = *cached;
+    return true;
+}
+
+void QtAwesomeRenderCache::insert( const QtAwesomeRenderKey& key, const QPixmap& pixmap )
+{
+    Shard& s = shard( key );
+    ShardLocker locker( s );
+    s.cache.insert( key, new QPixmap(pixmap), pixmapCost(pixmap) );
+}
+
+/// Looks up the coverage mask for the given key. Returns true and fills the mask on a hit
+bool QtAwesomeRenderCache::findMask( const QtAwesomeMaskKey& key, QImage* mask )
+{
+    Shard& s = shard( key );
+    ShardLocker locker( s );
+    QImage* cached = s.masks.object( key );
+    if( !cached ) {
+        ++s.maskMisses;
+        return false;
+    }
+    ++s.maskHits;
+    *mask = *cached;
+    return true;
+}
+
+void QtAwesomeRenderCache::insertMask( const QtAwesomeMaskKey& key, const QImage& mask )
+{
+    Shard& s = shard( key );
+    ShardLocker locker( s );
+    s.masks.insert( key, new QImage(mask), imageCost(mask) );
+}
+
+/// Returns the coverage mask for the given key, the mask is rasterized with the given function on a miss
+/// Single flight: when another thread is already rasterizing the same key, this thread waits for its result
+/// instead of rasterizing the mask again. The shard isn't locked while rasterizing.
+QImage QtAwesomeRenderCache::findOrCreateMask( const QtAwesomeMaskKey& key, const std::function<QImage()>& rasterize )
+{
+    Shard& s = shard( key );
+    ShardLocker locker( s );
+    for( ;; ) {
+        if( QImage* cached = s.masks.object( key ) ) {
+            ++s.maskHits;
+            return *cached;
+        }
+        if( !s.pendingMasks.contains( key ) ) {
+            break;
+        }
+        ++s.singleFlightWaits;
+        s.maskDone.wait( &s.mutex );
+    }
+
+    // a mask that doesn't even fit in the overflow shard isn't cached, the waiting threads then rasterize it themselves
+    ++s.maskMisses;
+    s.pendingMasks.insert( key );
+    locker.unlock();
+    QImage mask = rasterize();
+    locker.relock();
+    s.masks.insert( key, new QImage(mask), imageCost(mask) );
+    s.pendingMasks.remove( key );
+    s.maskDone.wakeAll();
+    return mask;
+}
+
+/// Creates a colored image by compositing a solid color through the given coverage mask
+QImage QtAwesomeRenderCache::tint( const QImage& mask, const QColor& color )
+{
+    QImage image( mask.size(), QImage::Format_ARGB32_Premultiplied );
+    image.setDevicePixelRatio( mask.devicePixelRatio() );
+    image.fill( color );
+    QPainter p( &image );
+    p.setCompositionMode( QPainter::CompositionMode_DestinationIn );
+    p.drawImage( 0, 0, mask );
+    return image;
+}
+
+/// Sets the maximum size of the cache in kilobytes. 0 disables the cache
+/// The entries that are cached in another shard after the change are rendered again
+void QtAwesomeRenderCache::setMaxCost( int kilobytes )
+{
+    shardMaxCost_.storeRelease( shardCost(kilobytes, ShardCount - 1) );
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        shards_[i].cache.setMaxCost( shardCost(kilobytes, i) );
+    }
+}
+
+int QtAwesomeRenderCache::maxCost() const
+{
+    int result = 0;
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        result += int(shards_[i].cache.maxCost());
+    }
+    return result;
+}
+
+/// Sets the maximum size of the mask cache in kilobytes
+void QtAwesomeRenderCache::setMaxMaskCost( int kilobytes )
+{
+    shardMaxMaskCost_.storeRelease( shardCost(kilobytes, ShardCount - 1) );
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        shards_[i].masks.setMaxCost( shardCost(kilobytes, i) );
+    }
+}
+
+int QtAwesomeRenderCache::maxMaskCost() const
+{
+    int result = 0;
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        result += int(shards_[i].masks.maxCost());
+    }
+    return result;
+}
+
+void QtAwesomeRenderCache::clear()
+{
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        shards_[i].cache.clear();
+        shards_[i].masks.clear();
+    }
+}
+
+void QtAwesomeRenderCache::resetStats()
+{
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        shards_[i].hits = 0;
+        shards_[i].misses = 0;
+        shards_[i].maskHits = 0;
+        shards_[i].maskMisses = 0;
+        shards_[i].contentions = 0;
+        shards_[i].singleFlightWaits = 0;
+    }
+}
+
+/// Returns the counters summed over all shards, including the overflow shard
+QtAwesomeRenderCacheStats QtAwesomeRenderCache::stats() const
+{
+    QtAwesomeRenderCacheStats result = QtAwesomeRenderCacheStats();
+    for( int i = 0; i <= OverflowShard; ++i ) {
+        ShardLocker locker( shards_[i] );
+        const Shard& s = shards_[i];
+        result.hits += s.hits;
+        result.misses += s.misses;
+        result.count += int(s.cache.count());
+        result.totalCost += int(s.cache.totalCost());
+        result.maxCost += int(s.cache.maxCost());
+        result.maskHits += s.maskHits;
+        result.maskMisses += s.maskMisses;
+        result.maskCount += int(s.masks.count());
+        result.contentions += s.contentions;
+        result.singleFlightWaits += s.singleFlightWaits;
+    }
+    return result;
+}
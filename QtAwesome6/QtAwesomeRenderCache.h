@@ -0,0 +1,173 @@
+#ifndef QTAWESOMERENDERCACHE_H
+#define QTAWESOMERENDERCACHE_H
+
+#include <QAtomicInt>
+#include <QCache>
+#include <QColor>
+#include <QHash>
+#include <QIcon>
+#include <QImage>
+#include <QMutex>
+#include <QPixmap>
+#include <QRgb>
+#include <QSet>
+#include <QSize>
+#include <QString>
+#include <QWaitCondition>
+
+#include <functional>
+
+/// The key of a rendered glyph in the render cache
+/// Every field that has influence on the rendered pixels is part of the key.
+/// The size is in device pixels, so the key doesn't need a device pixel ratio
+struct QtAwesomeRenderKey
+{
+    QString text;           ///< the painted text, usually the single code-point of the glyph
+    int style;              ///< the font style used to render the glyph (fa::style)
+    QRgb color;             ///< the resolved color (including alpha)
+    QSize size;             ///< the requested size in device pixels
+    float scaleFactor;      ///< the 'scale-factor' option
+    QIcon::Mode mode;
+    QIcon::State state;
+};
+
+inline bool operator==( const QtAwesomeRenderKey& a, const QtAwesomeRenderKey& b )
+{
+    return a.text == b.text
+            && a.style == b.style
+            && a.color == b.color
+            && a.size == b.size
+            && a.scaleFactor == b.scaleFactor
+            && a.mode == b.mode
+            && a.state == b.state;
+}
+
+inline uint qHash( const QtAwesomeRenderKey& key, uint seed = 0 )
+{
+    uint h = seed;
+    h = 31 * h + uint(qHash(key.text));
+    h = 31 * h + uint(key.style);
+    h = 31 * h + uint(key.color);
+    h = 31 * h + uint(key.size.width());
+    h = 31 * h + uint(key.size.height());
+    h = 31 * h + uint(qRound(key.scaleFactor * 1000));
+    h = 31 * h + uint(key.mode);
+    h = 31 * h + uint(key.state);
+    return h;
+}
+
+
+/// The key of a glyph coverage mask. The mask doesn't depend on the color, mode or state
+/// The size is in device pixels: a mask rendered for 16x16 at a device pixel ratio of 2 is the 32x32 mask
+struct QtAwesomeMaskKey
+{
+    QString text;           ///< the painted text, usually the single code-point of the glyph
+    int style;
+    QSize size;             ///< the size of the mask in device pixels
+    float scaleFactor;
+};
+
+inline bool operator==( const QtAwesomeMaskKey& a, const QtAwesomeMaskKey& b )
+{
+    return a.text == b.text
+            && a.style == b.style
+            && a.size == b.size
+            && a.scaleFactor == b.scaleFactor;
+}
+
+inline uint qHash( const QtAwesomeMaskKey& key, uint seed = 0 )
+{
+    uint h = seed;
+    h = 31 * h + uint(qHash(key.text));
+    h = 31 * h + uint(key.style);
+    h = 31 * h + uint(key.size.width());
+    h = 31 * h + uint(key.size.height());
+    h = 31 * h + uint(qRound(key.scaleFactor * 1000));
+    return h;
+}
+
+
+/// The counters of the render cache. Use them to size the cache with setMaxCost()
+struct QtAwesomeRenderCacheStats
+{
+    quint64 hits;       ///< number of lookups that were served from the cache
+    quint64 misses;     ///< number of lookups that required a rendering
+    int count;          ///< number of pixmaps in the cache
+    int totalCost;      ///< the size of all cached pixmaps in kilobytes
+    int maxCost;        ///< the maximum size of the cache in kilobytes
+    quint64 maskHits;   ///< number of colored pixmaps that were tinted from a cached mask
+    quint64 maskMisses; ///< number of glyphs that had to be rasterized
+    int maskCount;      ///< number of masks in the cache
+    quint64 contentions;        ///< number of shard locks that had to wait for another thread
+    quint64 singleFlightWaits;  ///< number of mask misses that waited for the rasterization by another thread
+};
+
+
+/// A bounded cache of rendered glyph pixmaps, every QtAwesome context has its own cache.
+/// The least recently used pixmaps are evicted when the total size exceeds the maximum cost (in kilobytes)
+///
+/// Next to the colored pixmaps the cache holds the 8-bit coverage masks of the glyphs.
+/// A colored variant of a glyph is created by tinting the mask, so a glyph is only rasterized once
+/// for all its colors.
+///
+/// The cache is split in ShardCount shards by the hash of the key, every shard has its own lock and its own
+/// part of the maximum cost (the eviction is least recently used per shard). An entry that is larger than the
+/// part of a shard goes to the overflow shard instead, which has a quarter of the maximum cost. The route only
+/// depends on the size in the key, so a large glyph is cached as long as it fits in the overflow shard.
+/// findOrCreateMask() rasterizes a mask only once when several threads miss the same key at the same time.
+class QtAwesomeRenderCache
+{
+public:
+    enum { ShardCount = 16, OverflowShard = ShardCount };
+
+    explicit QtAwesomeRenderCache( int maxCost = 8 * 1024, int maxMaskCost = 2 * 1024 );
+
+    bool find( const QtAwesomeRenderKey& key, QPixmap* pixmap );
+    void insert( const QtAwesomeRenderKey& key, const QPixmap& pixmap );
+
+    bool findMask( const QtAwesomeMaskKey& key, QImage* mask );
+    void insertMask( const QtAwesomeMaskKey& key, const QImage& mask );
+    QImage findOrCreateMask( const QtAwesomeMaskKey& key, const std::function<QImage()>& rasterize );
+
+    static QImage tint( const QImage& mask, const QColor& color );
+
+    void setMaxCost( int kilobytes );
+    int maxCost() const;
+    void setMaxMaskCost( int kilobytes );
+    int maxMaskCost() const;
+
+    void clear();
+    void resetStats();
+    QtAwesomeRenderCacheStats stats() const;
+
+private:
+    Q_DISABLE_COPY(QtAwesomeRenderCache)
+
+    struct Shard
+    {
+        QMutex mutex;
+        QCache<QtAwesomeRenderKey, QPixmap> cache;  ///< the cached pixmaps, the cost is the size in kilobytes
+        QCache<QtAwesomeMaskKey, QImage> masks;     ///< the cached Alpha8 coverage masks, the cost is the size in kilobytes
+        QSet<QtAwesomeMaskKey> pendingMasks;        ///< the masks that are being rasterized by a thread
+        QWaitCondition maskDone;                    ///< signalled when a pending mask is finished
+        quint64 hits = 0;
+        quint64 misses = 0;
+        quint64 maskHits = 0;
+        quint64 maskMisses = 0;
+        quint64 contentions = 0;
+        quint64 singleFlightWaits = 0;
+    };
+
+    class ShardLocker;
+
+    Shard& shard( const QtAwesomeRenderKey& key ) const;
+    Shard& shard( const QtAwesomeMaskKey& key ) const;
+    template <typename Key>
+    Shard& shard( const Key& key, int cost, const QAtomicInt& shardMaxCost ) const;
+
+    mutable Shard shards_[ShardCount + 1];      ///< the hashed shards followed by the overflow shard
+    QAtomicInt shardMaxCost_;                   ///< the maximum pixmap cost of the smallest hashed shard
+    QAtomicInt shardMaxMaskCost_;               ///< the maximum mask cost of the smallest hashed shard
+};
+
+#endif // QTAWESOMERENDERCACHE_H
@@ -0,0 +1,42 @@
+#ifndef QTAWESOME_BENCH_H
+#define QTAWESOME_BENCH_H
+
+#include <QElapsedTimer>
+
+#include <cstdio>
+
+/// Returns the average duration of a single call of the given function in nanoseconds
+/// The function is called once to warm up, and then in batches until minimumMs milliseconds have passed
+template <typename Function>
+double benchNs( Function function, int minimumMs = 200 )
+{
+    function();
+
+    QElapsedTimer timer;
+    timer.start();
+    qint64 calls = 0;
+    do {
+        for( int i = 0; i < 16; ++i ) {
+            function();
+        }
+        calls += 16;
+    } while( timer.elapsed() < minimumMs );
+    return double(timer.nsecsElapsed()) / calls;
+}
+
+/// The results of the benchmarked computations, the compiler can't optimize a volatile store away
+inline volatile quint64 benchSink = 0;
+
+/// Keeps the compiler from optimizing a benchmarked computation away
+inline void benchUse( quint64 value )
+{
+    benchSink = value;
+}
+
+/// Prints the header of a result table
+inline void benchHeader( const char* title, const char* columns )
+{
+    std::printf( "\n%s\n%s\n", title, columns );
+}
+
+#endif // QTAWESOME_BENCH_H
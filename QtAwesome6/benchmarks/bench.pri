@@ -0,0 +1,11 @@
+# The common settings of the QtAwesome benchmarks
+
+QT += gui widgets
+
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+include($$PWD/../QtAwesome.pri)
+
+INCLUDEPATH += $$PWD
+HEADERS += $$PWD/bench.h
@@ -0,0 +1,21 @@
+# The benchmarks of QtAwesome, every benchmark is a console application that prints a result table
+#
+#   qmake benchmarks.pro && make && ./glyphpaint/glyphpaint
+#
+# The painting benchmarks paint into QImages. Without a display run them with QT_QPA_PLATFORM=offscreen.
+#   glyphpaint    - drawText() versus the cached QRawFont outline, 12-200 px
+#   optionresolve - the string-key option resolution of every paint versus the 8-slot option table
+#   brandrouting  - the brand font routing: QList scan, private use area bitset and style bits, with a routing check
+#   coldstart     - the cold-start time and resident memory of the font loading modes (lazy, eager, QFontDatabase,
+#                   zero-copy QRawFont and a memory mapped font file), in fresh processes
+#   rendercache   - the throughput, lock contention and single flight waits of the render cache with 1 to
+#                   idealThreadCount threads
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    glyphpaint \
+    optionresolve \
+    brandrouting \
+    coldstart \
+    rendercache
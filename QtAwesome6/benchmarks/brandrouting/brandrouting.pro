@@ -0,0 +1,9 @@
+# The brand font routing: the QList scan, the private use area bitset and the style bits of the icon value
+
+TEMPLATE = app
+TARGET = brandrouting
+
+include(../bench.pri)
+
+SOURCES += \
+    main.cpp
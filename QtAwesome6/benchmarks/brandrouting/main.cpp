@@ -0,0 +1,83 @@
+/**
+ * brandrouting - the cost and the result of routing an icon to the regular or the brands font
+ *
+ * usage: brandrouting
+ *
+ *   list scan - QList<int>::contains() over the brand code-points, the old linear scan in selectFont()
+ *   bitset    - one bit per code-point of the private use area (U+E000 - U+F8FF), the lookup that replaced the scan
+ *   style bit - QtAwesome::isBrand(), a test of the style bits of the style-qualified icon value (the current routing)
+ *
+ * The routings are checked against each other for every icon. The code-point routings can't tell a regular icon
+ * from a brand icon with the same code-point, these icons are reported as misrouted. The exit code is 1 when the
+ * style bit routing disagrees with the code-point routings for an icon with an unambiguous code-point.
+ */
+
+#include "QtAwesome.h"
+#include "bench.h"
+
+#include <QCoreApplication>
+#include <QSet>
+
+#include <bitset>
+
+enum { PrivateUseFirst = 0xe000, PrivateUseEnd = 0xf900 };
+
+int main( int argc, char* argv[] )
+{
+    QCoreApplication app( argc, argv );
+    QtAwesome awesome;
+
+    // the brand code-points, as the constructor collected them for the linear scan in selectFont()
+    QList<int> brandList;
+    std::bitset<PrivateUseEnd - PrivateUseFirst> brandBits;
+    QSet<int> regularCodepoints;
+    for( int i = 0; i < faIconCount; ++i ) {
+        int codepoint = fa::codepoint( faIcons[i] );
+        if( fa::iconStyle(faIcons[i]) == fa::fa_brands ) {
+            brandList.append( codepoint );
+            if( codepoint >= PrivateUseFirst && codepoint < PrivateUseEnd ) {
+                brandBits.set( codepoint - PrivateUseFirst );
+            }
+        } else {
+            regularCodepoints.insert( codepoint );
+        }
+    }
+
+    // the routing check
+    int misrouted = 0;
+    int failures = 0;
+    for( int i = 0; i < faIconCount; ++i ) {
+        int codepoint = fa::codepoint( faIcons[i] );
+        bool listBrand = brandList.contains( codepoint );
+        bool bitBrand = codepoint >= PrivateUseFirst && codepoint < PrivateUseEnd && brandBits.test( codepoint - PrivateUseFirst );
+        bool styleBrand = awesome.isBrand( faIcons[i] );
+        bool ambiguous = listBrand && regularCodepoints.contains( codepoint );
+        if( ambiguous ) {
+            misrouted += styleBrand ? 0 : 1;
+        } else if( listBrand != styleBrand || bitBrand != styleBrand ) {
+            std::fprintf( stderr, "routing mismatch for 0x%x: list %d, bitset %d, style bit %d\n", faIcons[i], listBrand, bitBrand, styleBrand );
+            ++failures;
+        }
+    }
+    std::printf( "%d icons, %d brand icons, %d regular icons are misrouted by the code-point routings, %d mismatches\n",
+                 int(faIconCount), int(brandList.size()), misrouted, failures );
+
+    // the routing cost, over all icons
+    benchHeader( "routing of one icon (ns, average over all icons)", "  list scan      bitset   style bit" );
+    int next = 0;
+    double listNs = benchNs( [&]() {
+        benchUse( brandList.contains( fa::codepoint(faIcons[next]) ) );
+        next = (next + 1) % faIconCount;
+    });
+    double bitNs = benchNs( [&]() {
+        int codepoint = fa::codepoint( faIcons[next] );
+        benchUse( codepoint >= PrivateUseFirst && codepoint < PrivateUseEnd && brandBits.test( codepoint - PrivateUseFirst ) );
+        next = (next + 1) % faIconCount;
+    });
+    double styleNs = benchNs( [&]() {
+        benchUse( awesome.isBrand( faIcons[next] ) );
+        next = (next + 1) % faIconCount;
+    });
+    std::printf( "  %9.1f  %10.1f  %10.1f\n", listNs, bitNs, styleNs );
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,9 @@
+# The cold-start time and resident memory of the font loading modes, every run in a fresh process
+
+TEMPLATE = app
+TARGET = coldstart
+
+include(../bench.pri)
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,158 @@
+/**
+ * coldstart - the cold-start time and the resident memory of the font loading of QtAwesome
+ *
+ * usage: coldstart [runs] [font]           runs every mode in a fresh process (default 5 times) and prints the medians
+ *        coldstart --mode <mode> [font]    runs a single mode and prints "<nanoseconds> <rss kilobytes>"
+ *
+ * A run starts after the QGuiApplication is created and ends when the first icon is painted:
+ *   lazy     - initFontAwesome() and a regular icon, only the font of the used style is loaded
+ *   eager    - initFontAwesome(), loadFonts() and a regular icon, both fonts are registered up front
+ *   database - a regular glyph painted with drawText(), the font is registered with QFontDatabase (a copy of the
+ *              resource data, the platform font database resolves the family)
+ *   rawfont  - a regular glyph rendered by renderImage(), the QRawFont is built on the uncompressed resource data
+ *              without a copy and without the font database
+ *   mapped   - like rawfont, with the regular font memory mapped from the given font file via setFontFile(),
+ *              only when a font file is given (e.g. QtAwesome6/fonts/fa-regular-400.ttf)
+ * The resident memory is the growth of VmRSS during the run (Linux only, -1 elsewhere).
+ */
+
+#include "QtAwesome.h"
+#include "bench.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGuiApplication>
+#include <QImage>
+#include <QPainter>
+#include <QProcess>
+#include <QStringList>
+#include <QTextOption>
+
+#include <algorithm>
+
+// the resident set size of this process in kilobytes, or -1 when it's unknown
+static qint64 residentKb()
+{
+    QFile status( "/proc/self/status" );
+    if( !status.open( QIODevice::ReadOnly ) ) {
+        return -1;
+    }
+    for( const QByteArray& line : status.readAll().split('\n') ) {
+        if( line.startsWith( "VmRSS:" ) ) {
+            return line.mid( 6 ).trimmed().split( ' ' ).value( 0 ).toLongLong();
+        }
+    }
+    return -1;
+}
+
+struct Mode
+{
+    const char* name;
+    void (*run)( QtAwesome* awesome, const QString& fontFile );
+    bool needsFontFile;
+};
+
+static void runLazy( QtAwesome* awesome, const QString& )
+{
+    awesome->initFontAwesome();
+    benchUse( awesome->icon( fa::music ).pixmap( 32, 32 ).cacheKey() );
+}
+
+static void runEager( QtAwesome* awesome, const QString& )
+{
+    awesome->initFontAwesome();
+    awesome->loadFonts();
+    benchUse( awesome->icon( fa::music ).pixmap( 32, 32 ).cacheKey() );
+}
+
+static void runDatabase( QtAwesome* awesome, const QString& )
+{
+    awesome->initFontAwesome();
+    QImage image( 32, 32, QImage::Format_ARGB32_Premultiplied );
+    image.fill( Qt::transparent );
+    QPainter painter( &image );
+    painter.setFont( awesome->font( fa::music, 29 ) );
+    painter.drawText( QRect(0, 0, 32, 32), QString(QChar(fa::codepoint(fa::music))), QTextOption( Qt::AlignCenter | Qt::AlignVCenter ) );
+}
+
+static void runRawFont( QtAwesome* awesome, const QString& )
+{
+    awesome->initFontAwesome();
+    benchUse( awesome->renderImage( fa::music, QVariantMap(), QSize(32, 32) ).sizeInBytes() );
+}
+
+static void runMapped( QtAwesome* awesome, const QString& fontFile )
+{
+    if( !awesome->setFontFile( fa::fa_regular, fontFile ) ) {
+        std::fprintf( stderr, "%s cannot be mapped\n", qPrintable(fontFile) );
+    }
+    awesome->initFontAwesome();
+    benchUse( awesome->renderImage( fa::music, QVariantMap(), QSize(32, 32) ).sizeInBytes() );
+}
+
+static const Mode modes[] = {
+    { "lazy", runLazy, false },
+    { "eager", runEager, false },
+    { "database", runDatabase, false },
+    { "rawfont", runRawFont, false },
+    { "mapped", runMapped, true },
+};
+
+// runs a single mode in this process
+static int runMode( const QString& name, const QString& fontFile )
+{
+    for( const Mode& mode : modes ) {
+        if( name == QLatin1String(mode.name) ) {
+            qint64 rssBefore = residentKb();
+            QElapsedTimer timer;
+            timer.start();
+            mode.run( QAwesome, fontFile );
+            qint64 ns = timer.nsecsElapsed();
+            qint64 rssAfter = residentKb();
+            std::printf( "%lld %lld\n", (long long)ns, (long long)(rssBefore < 0 ? -1 : rssAfter - rssBefore) );
+            return 0;
+        }
+    }
+    std::fprintf( stderr, "unknown mode %s\n", qPrintable(name) );
+    return 1;
+}
+
+// the median of the given values
+static qint64 median( QList<qint64> values )
+{
+    std::sort( values.begin(), values.end() );
+    return values.isEmpty() ? -1 : values.at( values.size() / 2 );
+}
+
+int main( int argc, char* argv[] )
+{
+    QGuiApplication app( argc, argv );
+    QStringList args = app.arguments();
+    if( args.size() >= 3 && args.at(1) == "--mode" ) {
+        return runMode( args.at(2), args.value(3) );
+    }
+
+    int runs = args.size() > 1 ? qMax( 1, args.at(1).toInt() ) : 5;
+    QString fontFile = args.value( 2 );
+    benchHeader( "cold start until the first icon is painted (median of fresh processes)", "  mode         time (us)   RSS growth (KB)" );
+    for( const Mode& mode : modes ) {
+        if( mode.needsFontFile && fontFile.isEmpty() ) {
+            continue;
+        }
+        QList<qint64> times;
+        QList<qint64> rss;
+        for( int i = 0; i < runs; ++i ) {
+            QProcess process;
+            process.start( app.applicationFilePath(), QStringList() << "--mode" << mode.name << fontFile );
+            if( !process.waitForFinished() || process.exitCode() != 0 ) {
+                std::fprintf( stderr, "mode %s failed\n", mode.name );
+                return 1;
+            }
+            QList<QByteArray> result = process.readAllStandardOutput().trimmed().split( ' ' );
+            times.append( result.value( 0 ).toLongLong() );
+            rss.append( result.value( 1 ).toLongLong() );
+        }
+        std::printf( "  %-10s %11.0f %17lld\n", mode.name, median(times) / 1000.0, (long long)median(rss) );
+    }
+    return 0;
+}
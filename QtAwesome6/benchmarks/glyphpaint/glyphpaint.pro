@@ -0,0 +1,9 @@
+# drawText() versus the cached QRawFont outline of a glyph
+
+TEMPLATE = app
+TARGET = glyphpaint
+
+include(../bench.pri)
+
+SOURCES += \
+    main.cpp
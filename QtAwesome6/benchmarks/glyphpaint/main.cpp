@@ -0,0 +1,76 @@
+/**
+ * glyphpaint - the per-paint cost of a font-awesome glyph, drawText() versus the cached outline
+ *
+ * usage: glyphpaint
+ *
+ * Every paint renders one glyph centered in a transparent image, like QtAwesomeCharIconPainter does:
+ *   drawText - QPainter::drawText() with the icon font (the text layout and shaping of QFont)
+ *   outline  - QPainter::fillPath() with the QRawFont outline of QtAwesome::glyph(), resolved once per glyph
+ * The sizes are the range of the pixmap-size spin box of the demo.
+ */
+
+#include "QtAwesome.h"
+#include "bench.h"
+
+#include <QApplication>
+#include <QImage>
+#include <QPainter>
+#include <QTextOption>
+
+static const float ScaleFactor = 0.9f;
+
+// paints the glyph with the text layout of the icon font
+static void paintText( QtAwesome* awesome, QImage* image, int character, const QColor& color )
+{
+    image->fill( Qt::transparent );
+    QPainter painter( image );
+    QRect rect( QPoint(0, 0), image->size() );
+    painter.setPen( color );
+    painter.setFont( awesome->font(character, qRound(rect.height() * ScaleFactor)) );
+    painter.drawText( rect, QString(QChar(fa::codepoint(character))), QTextOption( Qt::AlignCenter | Qt::AlignVCenter ) );
+}
+
+// fills the cached outline of the glyph, centered like QtAwesomeCharIconPainter
+static void paintOutline( QtAwesome* awesome, QImage* image, int character, const QColor& color )
+{
+    image->fill( Qt::transparent );
+    QPainter painter( image );
+    QRect rect( QPoint(0, 0), image->size() );
+    QtAwesomeGlyph glyph = awesome->glyph( character );
+    qreal scale = qRound(rect.height() * ScaleFactor) / qreal(QtAwesomeGlyph::ReferenceSize);
+    painter.setRenderHint( QPainter::Antialiasing );
+    painter.translate( (rect.width() - glyph.advance * scale) / 2,
+                       (rect.height() - (glyph.ascent + glyph.descent) * scale) / 2 + glyph.ascent * scale );
+    painter.scale( scale, scale );
+    painter.fillPath( glyph.path, color );
+}
+
+int main( int argc, char* argv[] )
+{
+    QApplication app( argc, argv );
+    QtAwesome* awesome = QAwesome;
+    if( !awesome->initFontAwesome() ) {
+        std::fprintf( stderr, "The fonts cannot be loaded\n" );
+        return 1;
+    }
+
+    const int sizes[] = { 12, 16, 24, 32, 48, 64, 96, 128, 160, 200 };
+    const int characters[] = { fa::music, fa::house, fa::github };
+    const QColor color( 50, 50, 50 );
+
+    benchHeader( "per-paint cost of one glyph (ns, average of fa::music, fa::house and fa::github)",
+                 "  size    drawText     outline     speedup" );
+    for( int size : sizes ) {
+        QImage image( size, size, QImage::Format_ARGB32_Premultiplied );
+        double textNs = 0;
+        double outlineNs = 0;
+        for( int character : characters ) {
+            textNs += benchNs( [&]() { paintText( awesome, &image, character, color ); } );
+            outlineNs += benchNs( [&]() { paintOutline( awesome, &image, character, color ); } );
+        }
+        textNs /= sizeof(characters) / sizeof(characters[0]);
+        outlineNs /= sizeof(characters) / sizeof(characters[0]);
+        std::printf( "  %4d  %10.0f  %10.0f  %9.2fx\n", size, textNs, outlineNs, textNs / outlineNs );
+    }
+    return 0;
+}
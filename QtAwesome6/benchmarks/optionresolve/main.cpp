@@ -0,0 +1,101 @@
+/**
+ * optionresolve - the per-paint cost of resolving the color and text options of an icon
+ *
+ * usage: optionresolve
+ *
+ *   string keys - the resolution before the option table: for every paint the "-disabled"/"-active"/"-selected"
+ *                 and "-off" keys are built and probed in the merged option map (optionKeysForModeAndState())
+ *   slot table  - QtAwesomeIconOptions, resolved once when the icon is created; a paint is an array index
+ * Every paint resolves the color, the text, the scale-factor and the animation for one mode and state.
+ */
+
+#include "QtAwesome.h"
+#include "bench.h"
+
+#include <QCoreApplication>
+
+// the keys that need to be tested:   key-mode-state | key-mode | key-state | key
+static QStringList optionKeysForModeAndState( const QString& key, QIcon::Mode mode, QIcon::State state )
+{
+    QString modePostfix;
+    switch( mode ) {
+    case QIcon::Disabled:
+        modePostfix = "-disabled";
+        break;
+    case QIcon::Active:
+        modePostfix = "-active";
+        break;
+    case QIcon::Selected:
+        modePostfix = "-selected";
+        break;
+    default:
+        break;
+    }
+
+    QString statePostfix;
+    if( state == QIcon::Off ) {
+        statePostfix = "-off";
+    }
+
+    QStringList result;
+    if( !modePostfix.isEmpty() ) {
+        if( !statePostfix.isEmpty() ) {
+            result.push_back( key + modePostfix + statePostfix );
+        }
+        result.push_back( key + modePostfix );
+    }
+    if( !statePostfix.isEmpty() ) {
+        result.push_back( key + statePostfix );
+    }
+    return result;
+}
+
+static QVariant optionValueForModeAndState( const QString& baseKey, QIcon::Mode mode, QIcon::State state, const QVariantMap& options )
+{
+    for( const QString& key : optionKeysForModeAndState(baseKey, mode, state) ) {
+        if( options.contains(key) && !(options.value(key).toString().isEmpty()) ) {
+            return options.value(key);
+        }
+    }
+    return options.value(baseKey);
+}
+
+int main( int argc, char* argv[] )
+{
+    QCoreApplication app( argc, argv );
+    QtAwesome awesome;
+
+    QVariantMap options = awesome.defaultOptions()->options;
+    options.insert( "text", QString(QChar(fa::codepoint(fa::music))) );
+    options.insert( "color-disabled", QColor(120, 120, 120) );
+
+    const QIcon::Mode modes[] = { QIcon::Normal, QIcon::Disabled, QIcon::Active, QIcon::Selected };
+    const QIcon::State states[] = { QIcon::On, QIcon::Off };
+
+    benchHeader( "option resolution of one paint (ns)", "  mode/state     string keys   slot table     speedup" );
+    const QtAwesomeIconOptions resolved = QtAwesomeIconOptions::fromVariantMap( options );
+    for( QIcon::Mode mode : modes ) {
+        for( QIcon::State state : states ) {
+            double stringNs = benchNs( [&]() {
+                QColor color = optionValueForModeAndState( "color", mode, state, options ).value<QColor>();
+                QString text = optionValueForModeAndState( "text", mode, state, options ).toString();
+                float scaleFactor = options.value( "scale-factor" ).toFloat();
+                QtAwesomeAnimation* anim = options.value( "anim" ).value<QtAwesomeAnimation*>();
+                benchUse( color.rgba() + quint64(text.size()) + quint64(scaleFactor * 1000) + quint64(anim != QTAWESOME_NULL) );
+            });
+            double tableNs = benchNs( [&]() {
+                const QColor& color = resolved.color( mode, state );
+                const QString& text = resolved.text( mode, state );
+                benchUse( color.rgba() + quint64(text.size()) + quint64(resolved.scaleFactor * 1000) + quint64(resolved.anim != QTAWESOME_NULL) );
+            });
+            std::printf( "  %d/%d        %12.1f %12.1f %10.1fx\n", int(mode), int(state), stringNs, tableNs, stringNs / tableNs );
+        }
+    }
+
+    double createNs = benchNs( [&]() {
+        QtAwesomeIconOptions table = QtAwesomeIconOptions::fromVariantMap( options );
+        benchUse( table.colors[0].rgba() );
+    });
+    std::printf( "\none-time resolution of the slot table when the icon is created: %.0f ns\n", createNs );
+    return 0;
+}
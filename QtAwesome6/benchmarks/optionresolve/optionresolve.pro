@@ -0,0 +1,9 @@
+# The string-key option resolution of every paint versus the resolved 8-slot option table
+
+TEMPLATE = app
+TARGET = optionresolve
+
+include(../bench.pri)
+
+SOURCES += \
+    main.cpp
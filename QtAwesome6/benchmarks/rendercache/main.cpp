@@ -0,0 +1,107 @@
+/**
+ * rendercache - the throughput and the lock contention of the sharded render cache under concurrent rendering
+ *
+ * usage: rendercache
+ *
+ * Every thread renders the same icon set with QtAwesome::renderImage() in a different order, for 1 up to
+ * QThread::idealThreadCount() threads. Every run starts with a new context, so the cache starts empty and
+ * the first renderings of a mask race for the single flight.
+ * The sizes include 512 px, the masks of that size don't fit in a hashed shard and are cached in the
+ * overflow shard.
+ */
+
+#include "QtAwesome.h"
+#include "bench.h"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <thread>
+#include <vector>
+
+static const int RunMs = 500;
+
+struct Job
+{
+    int character;
+    QSize size;
+    QVariantMap options;
+};
+
+// renders the jobs, starting at the given offset, until the time is up. Returns the number of renderings
+static quint64 renderLoop( QtAwesome* awesome, const QVector<Job>& jobs, int offset, const QElapsedTimer& timer )
+{
+    quint64 renderings = 0;
+    quint64 pixels = 0;
+    for( int i = offset; timer.elapsed() < RunMs; ++i ) {
+        const Job& job = jobs.at( i % jobs.size() );
+        pixels += quint64(awesome->renderImage( job.character, job.options, job.size ).width());
+        ++renderings;
+    }
+    benchUse( pixels );
+    return renderings;
+}
+
+int main( int argc, char* argv[] )
+{
+    QApplication app( argc, argv );
+    if( !QAwesome->initFontAwesome() ) {
+        std::fprintf( stderr, "The fonts cannot be loaded\n" );
+        return 1;
+    }
+
+    const int characters[] = { fa::music, fa::house, fa::github, fa::user, fa::gear, fa::star, fa::heart, fa::trash };
+    const int sizes[] = { 16, 24, 32, 64, 128, 512 };
+    const QColor colors[] = { QColor(50, 50, 50), QColor(0, 120, 215), QColor(200, 40, 40) };
+
+    QVector<Job> jobs;
+    for( int character : characters ) {
+        for( int size : sizes ) {
+            for( const QColor& color : colors ) {
+                Job job;
+                job.character = character;
+                job.size = QSize( size, size );
+                job.options.insert( "color", color );
+                jobs.append( job );
+            }
+        }
+    }
+
+    QList<int> threadCounts;
+    for( int threads = 1; threads < QThread::idealThreadCount(); threads *= 2 ) {
+        threadCounts.append( threads );
+    }
+    threadCounts.append( qMax(1, QThread::idealThreadCount()) );
+
+    benchHeader( "renderImage() throughput with a shared render cache (icon set of 8 glyphs x 6 sizes x 3 colors)",
+                 "  threads   renderings/s   per thread   mask hits  mask misses  contentions  single-flight waits" );
+    for( int threadCount : threadCounts ) {
+        QtAwesome awesome;
+
+        QElapsedTimer timer;
+        std::vector<quint64> renderings( threadCount, 0 );
+        std::vector<std::thread> threads;
+        timer.start();
+        for( int t = 0; t < threadCount; ++t ) {
+            threads.emplace_back( [&, t]() {
+                renderings[t] = renderLoop( &awesome, jobs, t * jobs.size() / threadCount, timer );
+            });
+        }
+        for( std::thread& thread : threads ) {
+            thread.join();
+        }
+        double seconds = timer.nsecsElapsed() / 1e9;
+
+        quint64 total = 0;
+        for( quint64 count : renderings ) {
+            total += count;
+        }
+        QtAwesomeRenderCacheStats stats = awesome.renderCache()->stats();
+        std::printf( "  %7d  %13.0f  %11.0f  %10llu  %11llu  %11llu  %19llu\n", threadCount, total / seconds,
+                     total / seconds / threadCount, (unsigned long long)stats.maskHits,
+                     (unsigned long long)stats.maskMisses, (unsigned long long)stats.contentions,
+                     (unsigned long long)stats.singleFlightWaits );
+    }
+    return 0;
+}
@@ -0,0 +1,9 @@
+# the throughput and the lock contention of the sharded render cache with 1 to idealThreadCount threads
+
+TEMPLATE = app
+TARGET = rendercache
+
+include(../bench.pri)
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,5934 @@
+// Generated by tools/faindexgen from enum_name_index.cpp, do not edit
+
+#ifndef ENUM_NAME_HASH_H
+#define ENUM_NAME_HASH_H
+
+#include "enum_name_index.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fa {
+namespace detail {
+
+/// The number of icon names (including aliases)
+constexpr int nameCount = 4571;
+
+/// The hash used by the perfect hash. A seed of 0 selects the bucket, the other seeds select the slot
+template <typename Char>
+constexpr uint32_t nameHash( uint32_t seed, const Char* name, int length )
+{
+    uint32_t h = seed ? seed : 0x01000193u;
+    for( int i = 0; i < length; ++i ) {
+        h = (h * 0x01000193u) ^ uint32_t(name[i]);
+    }
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    return h;
+}
+
+/// The bucket displacements: a seed for the slot hash, or -(slot + 1) for a bucket with a single name
+inline constexpr int32_t nameDisplacements[nameCount] = {
+    -3, 0, 1, 3, -5, -8, 0, 1, 0, 1, 0, -9, 1, 0, 0, 1,
+    -10, 0, 0, 1, 1, 0, -14, 0, -15, 0, -16, 0, 0, -20, 3, -22,
+    0, 0, 0, 0, 1, 0, -23, 0, -25, 0, -26, 1, 4, -28, -29, 0,
+    -30, 2, -31, 0, 1, 5, -34, 0, 0, -38, -43, -48, -51, -57, -58, 1,
+    0, 0, 0, 0, -62, -63, -68, 3, 2, 0, 3, 1, 2, -74, -75, 2,
+    0, 0, 0, 0, -76, -77, -78, 1, -80, -84, -86, -87, -90, 0, 0, -91,
+    0, 0, 0, -94, 1, 0, 1, 0, 0, 0, -96, 1, 0, -99, -104, -106,
+    1, -109, 2, -110, 0, 2, -112, 0, -115, 0, 0, 2, 2, -118, -120, 0,
+    0, 1, -123, 1, -128, 1, -129, 1, 1, -132, -137, -138, 0, 1, -139, 0,
+    -140, -141, 0, 1, 0, -142, 0, 0, 0, -147, -148, 1, -151, 0, 0, -155,
+    0, -156, -160, 2, 0, 1, 0, -162, 0, 0, 0, -163, 0, 0, -165, -171,
+    1, 0, 0, 0, -174, -175, 0, 0, 0, 0, 0, -176, -177, -178, 2, 0,
+    1, -180, -183, -186, 1, 1, 2, 0, -188, 0, 1, -189, -190, 2, 0, 1,
+    0, 1, -193, -201, 0, 4, -206, 0, -207, -212, 0, 0, -216, 0, 0, 0,
+    -217, 0, -218, 0, 1, -219, 0, -221, 1, -223, -224, -225, 0, 0, 0, 4,
+    0, 0, -226, 0, 0, -236, -237, 3, 0, 4, 0, -239, -240, 0, -241, -242,
+    0, -247, 0, 0, 0, -249, 0, -251, -253, -257, 0, 1, -263, 1, 0, 0,
+    1, -265, -268, 0, -271, 1, -278, -279, 0, -280, 0, 1, 0, 0, -283, -284,
+    -286, -287, 0, -288, 0, 0, 1, 0, -291, 0, 0, -292, -300, 1, 0, 0,
+    0, -301, -302, -303, 0, -304, 0, 0, -307, -309, 1, -311, 0, 2, -312, 0,
+    -313, 2, -314, 0, 0, 0, 1, -317, 0, 1, -321, 0, 1, 2, 0, 1,
+    -327, -330, -335, 0, 0, 1, 1, 0, -339, 0, 0, 0, -342, -344, -347, -351,
+    0, -352, 2, 0, 0, -354, 1, 0, 0, 0, 0, -360, 0, -362, -363, -368,
+    1, 0, -370, 2, -373, -379, 1, 0, 0, 0, -380, -381, 3, 0, 0, -384,
+    0, 0, 0, 0, -385, -390, -393, 2, -399, -403, -416, -420, -422, 1, -426, 0,
+    1, -429, 1, 1, 0, -430, -432, -438, 0, 4, -439, -448, 0, 2, 0, -449,
+    2, 3, -452, -453, 0, 0, 0, -455, -458, 1, 2, -460, 0, 2, 0, -461,
+    -462, 0, -467, 0, 2, 2, -470, -471, -479, -481, 1, -482, 0, 0, 1, -487,
+    -499, -505, -506, -510, 0, 0, -514, 1, -516, -518, -521, 0, -523, -524, -528, 0,
+    0, 3, 1, 1, 4, -529, 0, 1, -531, 0, -532, 2, 0, -534, 0, 4,
+    -535, 1, -536, -544, -545, 4, 0, 0, -553, 0, 0, 0, 0, 0, -557, 0,
+    0, 0, -558, 1, 1, -561, 0, 0, 0, 4, 0, 1, 1, -564, 0, -568,
+    -569, -570, -573, -574, -576, 0, -582, 0, -588, 0, 0, 2, 0, -590, -591, -592,
+    2, -595, 0, -600, 1, 0, 1, -601, -602, 0, 1, -609, 0, 1, 1, -610,
+    -615, -616, 1, -620, 0, -621, -623, 3, 1, 0, 1, -627, -631, 1, 0, 1,
+    -634, 0, 2, 0, -637, 0, 4, -651, -652, -654, 1, -656, 0, 0, 1, 1,
+    0, -657, -662, -663, -668, 0, -669, 0, 0, -670, 0, -675, 0, 0, 0, -678,
+    0, 1, 0, -679, -681, 0, 0, -683, -684, 1, 0, -690, -691, 0, -693, -699,
+    0, 2, -700, 0, 3, -702, 0, 1, 0, -706, -707, 2, 0, 0, -714, -717,
+    0, -719, 0, 2, 1, -720, 0, -724, 0, 3, -728, 0, 3, 5, 1, 0,
+    4, 1, 0, -731, 0, -732, -733, 0, 2, 1, -735, 3, 0, 0, 2, 0,
+    0, -736, 0, -745, 1, 0, -749, 0, 0, 2, 0, -750, -752, -756, -761, -763,
+    0, 0, 0, 3, 1, -764, -767, -774, 2, 1, 0, 0, 0, 0, 0, 0,
+    -776, 0, 0, 1, 2, -777, 0, 1, -782, -784, -788, 0, -790, -796, -797, -799,
+    0, 2, -801, 1, 1, 0, 0, -803, -813, -814, 2, 1, -820, -823, -825, 0,
+    3, 1, -826, 4, 0, -827, -829, 1, 2, -834, -836, -837, -845, -847, 2, -848,
+    0, 1, -851, 6, 2, 0, -854, -858, -861, -867, 1, -869, 0, -872, -873, 0,
+    1, 1, 0, 1, 0, -882, 0, 1, 0, -885, 0, 1, -890, -891, 0, -896,
+    0, -897, 0, -899, 3, 0, 0, 1, -908, -909, 0, 0, 1, 1, -912, -914,
+    -925, 0, 1, 0, 0, 0, -928, 0, -933, -934, 0, 6, 0, -936, -938, -941,
+    0, 1, -943, 0, -945, -952, -954, -960, 0, 0, 4, 0, 8, -961, 1, 0,
+    3, -963, 3, 0, 0, -966, 0, 1, -967, -968, -969, -975, -978, -979, -985, -990,
+    0, 7, 0, 1, 0, 0, 3, 0, 0, -991, 0, 0, 0, 2, -994, 1,
+    -1000, 1, 1, -1001, 5, -1003, -1005, 0, -1009, 0, -1010, 1, -1012, -1016, -1018, 0,
+    1, -1020, 0, 0, -1024, 8, 1, 0, -1027, 2, 1, -1028, 0, 6, 2, -1029,
+    0, 2, -1031, 0, -1034, -1036, 2, 0, -1038, 0, -1040, 1, -1041, 0, 2, -1042,
+    -1046, -1047, 1, 3, 1, -1049, 0, -1050, 0, 0, 0, 0, 0, -1053, 0, 1,
+    -1057, 2, 1, -1061, -1062, -1068, 0, -1070, 3, 2, 0, 1, -1071, 0, -1075, 3,
+    0, 1, -1082, -1083, 0, 1, 1, 0, 3, 4, 2, 0, 0, 0, -1085, 4,
+    1, 1, -1086, 0, -1098, 0, -1101, -1103, -1113, 0, 0, -1117, -1118, 4, 0, 1,
+    0, -1127, 0, 0, 5, -1132, -1134, -1138, 2, -1141, 0, -1142, 0, 2, 2, -1143,
+    0, -1146, 2, 2, 3, 0, 1, -1147, -1149, -1152, 0, 1, 3, 0, 0, 0,
+    -1153, -1154, -1155, 1, 0, 2, 0, -1158, 1, 0, -1160, -1161, 5, -1165, 0, 0,
+    0, -1166, 0, 1, 0, 1, 0, 1, 2, 0, -1167, 0, 0, 0, 0, 0,
+    -1168, 0, 0, 1, 2, -1169, 0, -1172, 0, 0, 0, 1, 0, -1173, 1, -1174,
+    -1176, 0, 0, -1180, 6, -1181, 1, -1183, -1184, 0, 2, 7, -1186, -1189, 0, 0,
+    -1195, 0, 0, 3, 1, 0, 2, 1, 0, -1196, -1197, -1200, -1203, 0, 0, 8,
+    1, 0, 0, 0, 0, -1205, -1206, 1, -1208, -1210, -1211, 0, -1213, -1214, -1215, 0,
+    0, 2, 0, -1218, 0, 0, 5, 0, 6, -1221, 1, 0, 1, 3, -1222, -1224,
+    0, -1233, 3, 0, 0, 0, 0, 0, 0, -1234, -1241, -1244, 2, -1246, -1247, 3,
+    0, -1248, 3, 1, -1249, 0, 0, -1257, -1261, -1271, -1275, 0, -1276, 0, 0, -1280,
+    -1282, -1284, 2, -1296, 0, 6, 1, 0, -1297, 0, -1298, 0, -1304, 1, 0, 3,
+    -1308, 0, 1, -1314, -1320, -1321, 1, 0, 0, -1322, 1, 1, 0, 0, 0, 0,
+    0, -1325, 0, 0, 0, -1328, 0, 1, -1330, 0, 1, 1, 2, 0, 1, 4,
+    0, 0, -1333, 1, 0, -1336, 0, -1338, 2, 0, 1, 0, -1340, -1346, -1348, 0,
+    0, 0, -1356, 0, 2, 0, 1, -1359, 0, 0, 1, 0, 1, 3, 2, 0,
+    2, 0, -1365, -1366, -1367, 0, 0, 0, 4, -1369, 1, 1, -1371, 0, 1, -1372,
+    0, 1, 2, -1378, -1382, 4, -1386, -1387, 0, -1390, 0, -1392, -1393, -1398, 0, -1399,
+    -1400, 2, 0, 0, 1, -1404, -1405, -1416, 1, 2, 0, 2, 1, 1, 0, -1425,
+    8, 0, 0, 0, 0, 1, -1427, -1428, 0, 0, 0, 0, 1, -1430, 0, 0,
+    0, -1433, 0, -1434, 0, -1435, 0, 0, -1436, -1439, 0, 4, 0, 4, 1, 0,
+    0, 0, 3, 1, 0, 0, 3, 2, 0, 0, 0, 1, -1442, 1, 0, 0,
+    -1444, 1, 0, 0, 1, 4, 0, -1446, -1455, 0, 0, 1, 0, -1457, 0, 1,
+    -1459, -1463, -1468, 1, 0, 1, 5, 2, 0, -1469, -1474, 2, 0, -1475, 0, 3,
+    -1479, 1, 1, -1480, 2, 8, 1, 2, 0, 0, -1484, -1489, 0, -1490, -1491, 0,
+    0, 0, -1499, 0, -1500, -1502, 0, 1, 0, 1, 6, -1509, 0, -1511, -1512, 0,
+    -1513, 0, 0, -1514, -1517, 0, 2, -1518, 4, -1519, -1520, -1524, 0, -1525, -1530, 0,
+    -1532, 0, 0, 0, 2, 0, 2, 0, -1536, -1537, 1, 0, 0, 0, 0, 1,
+    -1538, 0, 0, 1, 0, 0, -1540, 5, 0, -1541, 0, 1, 0, 0, -1543, -1544,
+    0, 1, 0, -1547, 1, 0, 0, 0, 0, 1, -1557, 0, -1558, -1559, -1560, -1563,
+    0, -1564, 2, 4, 1, 0, -1565, -1566, -1567, 0, 0, 1, -1576, -1577, -1580, -1581,
+    0, 0, 0, 1, 0, -1584, 0, -1585, -1587, 2, 1, 2, -1593, 0, -1594, 0,
+    1, -1598, -1599, 2, 0, -1601, 0, -1603, 0, 2, 0, 0, 1, -1605, 0, 1,
+    -1606, 3, 1, 1, 1, 1, 0, -1607, 0, -1609, -1610, 0, 7, 1, 1, -1612,
+    0, 1, -1617, 1, 0, 7, -1621, 3, 1, 4, -1623, 10, 2, -1627, -1628, 0,
+    -1630, 0, 0, -1638, 0, 0, -1639, 1, -1640, 4, 0, -1643, 1, 0, 0, 0,
+    -1645, 4, 0, 0, -1646, -1647, 0, 2, 1, -1652, -1657, -1658, 0, -1659, 0, 0,
+    5, -1661, 0, -1667, -1668, -1672, 0, -1674, -1677, 0, 2, 1, 1, -1680, -1682, 0,
+    1, -1683, 1, -1684, -1690, 0, 0, 0, -1691, -1694, -1695, 0, 0, 0, 0, 0,
+    -1697, 0, -1699, 0, -1707, 1, -1710, 0, 0, 3, -1711, -1714, 1, 3, 2, -1717,
+    0, 0, -1718, -1728, 1, -1730, -1732, 0, 1, -1735, -1738, -1743, -1745, -1747, 5, -1748,
+    0, -1749, 0, 1, 10, 0, -1750, -1752, 0, -1754, -1755, 2, 0, 0, 0, 0,
+    0, 2, 0, -1760, 1, -1765, 0, 0, -1766, 3, -1768, 0, 2, -1778, 0, 2,
+    -1779, 0, 0, -1781, 3, 0, -1783, 1, -1784, 0, -1785, -1786, 0, 0, -1788, 0,
+    -1790, 0, 0, 0, -1791, 1, -1796, 1, 2, -1801, -1803, 0, -1807, -1808, 0, 1,
+    2, -1810, -1812, 0, 0, 2, 4, -1815, -1816, 0, 1, 1, 4, 2, 0, 0,
+    -1818, -1820, -1821, -1823, 2, 1, 0, -1829, 1, 1, 0, 0, -1833, 0, 0, 3,
+    -1837, 1, 0, -1838, 0, -1839, 0, 0, -1840, 0, -1844, 2, -1846, 1, -1847, 0,
+    0, -1849, -1850, -1852, 4, 0, 0, 0, 0, 0, 0, -1853, 1, 1, -1854, -1858,
+    0, -1859, 1, 0, 0, 4, -1868, 0, -1869, 0, 4, -1874, 2, -1875, 0, 1,
+    -1876, 5, -1878, 2, 0, 1, 0, 0, -1879, -1881, -1884, 1, 0, 0, -1885, -1887,
+    -1890, -1898, 0, 0, -1899, 1, 0, 2, 0, -1901, 1, -1910, -1913, -1914, 0, -1916,
+    -1917, -1919, 15, 1, 0, -1922, -1925, 4, -1930, 0, -1932, 0, 4, 1, 7, -1933,
+    0, 2, -1934, 0, 0, -1937, 5, 0, 0, 0, 2, 0, -1938, 0, 2, -1940,
+    -1941, -1943, 1, 0, 0, 2, -1946, 0, 0, 1, 0, 0, 5, -1948, 0, 2,
+    -1953, 1, -1954, 0, 7, -1964, 1, 0, -1966, 0, 3, 1, 0, -1968, -1969, 1,
+    0, 1, -1971, -1974, 1, 1, -1975, 0, 0, -1980, -1983, -1985, 4, -1986, 0, -1987,
+    0, 0, 0, -1989, 0, 2, 0, 6, -1990, 0, 0, -1993, 2, 0, -1997, 0,
+    -2002, -2003, 0, 4, 0, 0, 0, 7, 1, 2, 2, 3, 0, 0, -2004, 0,
+    -2006, 0, 1, 0, 0, -2007, 0, 0, 0, 1, 0, 0, 0, 0, 2, -2011,
+    0, 0, 2, 7, -2014, -2015, -2018, 0, 2, -2021, 2, 0, 0, 0, 1, 0,
+    2, 2, 0, 0, 1, 0, 0, 1, -2023, 3, 9, 0, 2, 0, -2024, -2027,
+    0, -2028, -2035, 8, -2036, -2037, 0, 0, 0, 0, 1, -2038, -2045, 0, 0, 0,
+    2, -2046, 0, -2056, -2057, 3, 0, 3, 0, 0, 1, -2059, 0, -2062, -2063, -2066,
+    -2068, 2, 3, 0, 1, 0, -2072, 1, 1, -2073, -2074, -2076, -2077, 0, 0, 0,
+    1, -2081, -2085, 0, -2088, 1, 1, -2089, 0, 2, 4, 0, 1, 1, -2099, 0,
+    0, 0, 0, -2103, -2109, -2110, -2113, 3, 3, -2115, 2, -2118, 0, 0, 0, 0,
+    0, -2120, 0, 0, -2121, 0, 4, 6, -2127, 2, 0, -2129, 0, 2, 0, -2135,
+    0, 4, 0, -2138, 4, 3, 2, -2139, 4, 0, 0, 0, 0, 0, 0, 0,
+    -2143, 0, -2145, 1, 2, 4, 0, 0, 0, -2148, 0, 0, 0, 7, 0, 1,
+    0, -2149, 0, -2154, 0, 1, -2156, -2158, 0, 0, -2160, -2161, -2164, -2166, 3, -2169,
+    0, 1, 3, -2170, -2174, -2176, 0, 0, -2180, 0, -2182, -2187, -2188, 0, -2190, 1,
+    3, -2191, 0, 4, 7, 0, 3, 0, -2192, 0, -2197, -2199, 2, -2200, 0, -2203,
+    2, 0, 10, 0, -2205, -2206, -2208, 0, 0, -2209, 0, 3, 0, 0, 0, 2,
+    0, -2215, -2221, -2223, 0, -2227, 0, -2229, 0, 0, 1, -2230, -2231, 3, -2232, 0,
+    3, -2236, 0, 0, 1, 3, -2238, -2241, 0, 4, 1, -2243, -2248, -2251, -2253, 1,
+    4, -2254, 0, -2256, -2257, -2259, -2263, 0, 0, -2264, -2271, -2274, 5, 1, 1, 0,
+    0, 0, 2, -2278, -2280, 0, 7, 0, -2283, -2285, -2286, -2289, -2292, 2, 1, -2293,
+    1, 0, 2, 1, -2298, -2299, 1, -2301, 0, 0, 8, 0, 1, -2302, 0, -2306,
+    -2308, 0, -2309, 0, -2310, 0, -2314, 1, 2, 4, 0, 7, -2315, 0, -2317, 7,
+    -2321, -2323, 0, 0, 1, 4, 2, 0, 3, -2325, -2326, 0, 0, -2331, 1, -2332,
+    0, 1, -2334, -2336, 3, 0, -2340, -2341, 0, 0, 0, 1, 1, 0, -2342, -2349,
+    3, 0, -2354, -2356, 1, -2357, -2364, 0, 1, -2365, -2367, -2369, -2370, 0, 1, 0,
+    0, 0, 1, 2, 0, 0, -2375, 4, 1, 0, 1, 0, 3, 0, 0, 0,
+    8, -2378, 0, -2381, 0, 0, 0, 3, -2391, 2, 0, 2, 2, -2394, -2397, 1,
+    0, 2, 0, -2401, 1, 0, -2403, -2404, 6, 1, 4, 0, 0, 0, 1, 1,
+    -2405, 3, 0, -2406, 0, 1, 0, 0, -2407, -2408, 1, 0, 7, -2411, 1, 0,
+    0, 0, 0, 3, 0, 0, -2414, 3, 0, 0, 1, 0, 3, -2415, 3, 0,
+    2, -2416, 1, 0, 0, -2417, 0, 2, 2, 1, -2422, -2427, -2430, 0, 0, -2438,
+    12, -2440, 0, 0, -2443, -2446, 0, 1, -2447, -2448, 2, -2449, -2452, 0, 0, -2453,
+    0, 2, -2454, -2455, 1, 2, -2457, 1, 1, 0, -2461, -2463, -2466, -2467, -2474, -2475,
+    4, 0, 5, 0, -2477, 0, -2483, 0, -2484, 0, -2485, 1, 0, 2, 0, -2487,
+    -2489, -2496, 0, -2499, 0, 0, -2500, 0, 0, 3, -2501, 8, -2504, 0, 1, -2506,
+    1, -2508, -2516, 1, 0, 0, 0, 0, -2518, 4, 1, 0, -2519, -2523, -2525, 2,
+    -2526, 0, -2527, 3, 6, -2531, 1, 0, 1, -2541, 0, 0, -2543, 3, -2546, 5,
+    6, 0, 1, 0, 5, -2547, -2553, 0, 4, 4, 0, 0, -2555, 0, 0, 0,
+    7, 1, -2562, -2566, 2, -2567, 1, 1, 0, 0, -2568, 0, -2571, 0, -2577, 0,
+    2, -2580, 0, 0, 0, 0, 0, 3, 1, 0, -2584, 0, -2585, -2589, 0, -2592,
+    -2599, 0, 4, -2601, 1, 0, 8, 0, -2602, 0, -2603, 0, -2608, -2610, -2613, 0,
+    2, 0, -2614, 7, -2615, 0, -2617, 14, 0, -2618, -2622, -2628, -2636, 0, 0, -2637,
+    -2638, -2640, -2642, 1, -2644, 4, -2646, -2649, 3, -2650, 0, -2652, 0, -2656, 1, 7,
+    -2659, -2663, 0, -2668, 0, 1, 0, -2671, -2673, 0, -2675, -2676, 0, -2677, 0, -2680,
+    0, -2681, 4, 3, -2684, 0, 0, 1, 0, 0, -2685, 0, 2, 4, -2686, -2692,
+    -2694, -2696, -2708, 0, 2, -2712, -2716, -2723, 0, 1, 0, -2725, -2727, 5, -2728, -2729,
+    0, -2732, 0, 0, -2734, -2735, 3, 2, 1, 0, -2736, 0, -2738, 1, -2739, -2742,
+    0, 0, 0, 3, 0, 0, 2, 1, -2744, 1, 0, 1, 2, 0, 11, -2745,
+    -2749, -2752, 2, -2756, -2760, 2, -2766, -2773, 0, -2776, 0, -2781, 0, -2783, 5, 1,
+    -2784, 2, -2786, 0, -2790, 2, -2792, -2793, 0, 3, -2797, 2, 1, 3, 4, -2799,
+    0, 0, 0, -2803, -2805, 0, 1, 0, 0, -2810, 0, -2811, -2812, -2815, -2817, 3,
+    0, 0, -2818, -2819, 0, 2, 4, 2, -2825, 0, 0, 0, -2827, 3, 4, 0,
+    -2829, -2831, 1, -2833, 0, 0, -2835, -2837, -2840, -2842, -2844, 2, 0, 1, 1, 0,
+    -2845, 0, 2, 0, -2847, -2848, -2849, -2851, 0, 1, 0, 0, 1, 1, -2852, 0,
+    1, 0, 0, -2857, 2, 1, 3, -2858, -2862, 1, -2864, 0, 0, 2, -2865, -2866,
+    1, -2869, -2872, 0, 3, 0, 2, 0, -2880, -2881, 2, 1, -2884, -2885, 0, 1,
+    0, 2, -2886, 1, 7, 0, 0, 0, -2889, 0, 0, -2890, -2893, -2895, 3, 0,
+    -2896, -2900, -2904, 3, -2907, -2909, -2914, -2916, 2, 2, 0, -2917, 0, -2919, 0, -2921,
+    -2923, 0, 0, -2926, 5, -2930, -2934, 0, 0, 0, 1, -2938, 0, 0, -2939, 0,
+    -2941, 0, -2942, 2, 7, 1, 7, 4, -2943, 3, 0, -2947, -2948, -2949, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2950, 0, 5, 0, 0, 8, -2953, -2955,
+    0, -2956, 3, -2958, -2960, 4, 1, 0, 2, 3, -2962, 2, 17, 0, 2, 0,
+    8, -2964, 3, 0, 2, 5, 1, -2966, 0, -2967, 0, 3, 0, -2973, -2982, -2983,
+    3, -2984, 0, -2996, 6, -2997, -2998, 0, 2, 0, 1, -2999, -3001, -3002, 0, 2,
+    -3003, 0, 2, -3005, 0, 1, 0, 0, 0, 0, 1, 0, 0, -3007, -3009, 0,
+    -3014, 0, -3018, 0, 0, 0, -3019, 0, 5, 0, -3022, 1, 2, 1, 0, 0,
+    2, 2, 0, -3025, 3, -3026, -3031, 0, 0, -3035, -3036, -3038, -3040, -3042, -3043, 0,
+    0, 1, -3046, -3048, 0, 0, 0, 9, -3049, -3055, -3058, 0, 0, 0, -3059, 3,
+    10, -3060, 0, 10, 0, 4, -3064, -3067, -3068, 0, 0, 0, 0, -3069, 1, 1,
+    0, -3070, 5, 0, 1, -3073, 5, 2, -3075, 4, 0, 0, -3076, 0, 0, 0,
+    -3077, -3080, 1, -3087, 0, 2, -3096, 0, 0, 4, -3097, -3098, 0, 3, 0, -3106,
+    0, 0, -3109, 0, 1, 6, 2, 0, -3110, -3120, 1, 0, 0, 0, -3121, 1,
+    2, -3131, 0, 0, 6, -3132, -3144, 0, -3145, -3149, 0, 0, 0, 1, 0, 2,
+    0, -3152, 6, -3153, 1, -3158, 2, -3164, 1, 3, 0, 0, -3171, 4, 3, -3174,
+    0, 0, -3177, -3180, -3181, -3186, 10, 0, 7, 0, 0, 2, -3187, -3190, 0, 0,
+    0, 0, -3193, 0, 0, 5, 0, -3194, 0, -3198, 0, 2, 1, 0, 0, -3202,
+    0, -3204, 0, 0, -3210, 5, 3, 2, 9, -3212, 0, 1, 0, 1, 1, 3,
+    0, -3214, -3216, 0, 3, 0, 4, 0, 0, -3217, 1, 0, 0, 0, -3218, 5,
+    0, 0, -3223, 4, 0, -3225, 0, 1, 2, 1, -3226, 3, 1, -3233, -3234, 0,
+    -3237, -3245, 0, 0, 1, 2, -3246, -3247, 0, 0, 0, 2, -3248, -3252, -3253, -3255,
+    1, 0, -3256, 10, 10, 2, 5, -3257, -3260, -3261, -3263, 0, 0, 0, 0, -3265,
+    1, 0, -3266, -3268, 1, 1, 0, 2, 0, 0, 0, -3269, 0, -3271, -3275, 8,
+    0, -3279, -3281, 2, 6, -3282, 1, -3284, 2, -3286, 0, 0, -3287, 0, -3288, 6,
+    -3292, 0, 0, 0, 0, 0, 1, 0, -3300, 0, -3303, 0, 0, 0, -3304, 1,
+    -3307, 0, -3312, 0, -3319, 4, 11, 1, 0, 1, -3324, -3326, 1, 0, 11, 0,
+    0, 2, 0, 0, 0, -3332, -3334, 1, -3335, 0, 1, 1, -3336, -3343, -3346, 5,
+    -3347, 5, 0, 6, 0, 1, 0, -3349, -3350, 4, 0, -3352, 0, -3353, 0, 0,
+    1, 9, -3355, 0, 17, 0, -3356, 3, -3357, 0, 0, 0, 0, -3360, 0, -3361,
+    0, -3362, 6, 3, 1, -3366, 1, 0, 0, -3369, 2, -3372, 0, 2, 0, -3374,
+    0, 6, -3377, 0, -3378, 0, 5, 0, -3380, -3381, -3382, -3383, -3385, 0, 0, -3387,
+    -3390, -3393, 0, 0, 0, -3396, 1, -3398, -3406, -3413, -3415, 4, 6, -3416, 0, 2,
+    0, 10, 0, 0, 0, -3417, 8, -3419, -3422, 0, -3428, -3430, -3431, -3433, 6, -3436,
+    0, 9, -3438, 1, 5, 2, 0, -3439, 9, 4, -3440, 4, -3444, -3445, 0, -3447,
+    -3448, 0, 1, 2, 2, -3451, 0, 0, 2, 0, 3, -3455, 2, -3457, -3460, 0,
+    2, 0, -3463, 0, 0, -3467, 4, 1, -3468, -3471, -3472, 0, -3474, -3475, -3476, 0,
+    3, 1, -3477, 0, 0, -3478, 0, 0, -3479, 0, 1, 0, 0, 8, -3484, 0,
+    -3486, -3488, 0, -3489, 0, 1, -3490, 0, 0, 2, 0, 0, 3, -3494, 0, -3496,
+    -3498, -3502, -3504, 4, 4, 3, 0, -3505, 0, 3, -3507, 0, -3511, 1, -3516, 0,
+    -3517, 0, -3519, 0, 0, 1, -3521, 0, 0, 2, -3522, -3523, 0, 0, -3526, -3528,
+    -3529, -3532, -3534, 0, -3535, 13, 0, 0, 1, 2, 0, 0, 1, 1, 8, 0,
+    -3540, 0, 0, 0, -3541, 5, 0, 0, 0, -3544, -3545, -3546, 0, 0, 0, 0,
+    0, -3547, 0, 1, -3548, 0, 0, 0, 0, 0, 1, 1, 2, 0, 0, 1,
+    1, 1, -3549, 1, 0, 2, 0, 0, 2, 4, -3551, 0, -3552, -3557, 7, 0,
+    -3558, 2, 2, 0, -3562, -3563, 3, 0, -3566, 0, -3568, -3570, -3573, -3574, 15, 9,
+    0, 0, -3575, 3, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    2, -3576, 0, 2, 0, 0, 4, -3581, 0, 1, 1, 6, 0, 0, 7, 0,
+    -3584, 3, 0, 0, 1, 2, 2, 4, 2, -3587, -3592, -3596, 0, 0, 2, -3597,
+    -3604, -3606, 10, -3607, -3609, 2, -3610, -3611, -3612, 0, 7, -3616, 0, 0, 7, 3,
+    -3617, 0, 1, -3618, -3620, -3621, 16, 0, -3622, 4, -3623, 0, 0, 0, 2, 0,
+    0, 0, 0, -3625, 1, 0, 2, 0, 0, 0, -3629, 0, -3630, -3634, 2, 1,
+    0, 0, -3635, -3636, -3648, 0, -3649, 0, -3650, 1, 10, -3654, 1, 0, 1, -3659,
+    3, -3660, 0, 0, -3661, -3663, -3669, 0, 1, 0, 0, -3670, 0, 0, 0, -3671,
+    0, 2, -3673, 3, 6, 0, 0, 0, -3674, 0, 4, -3679, 1, -3680, -3681, 0,
+    7, 9, -3683, 0, 0, 1, 0, 6, -3684, 0, -3687, 0, -3692, -3696, 1, 0,
+    -3698, -3699, 1, 0, 0, 0, -3702, -3706, 6, -3709, -3712, 0, 0, -3714, 1, 11,
+    1, 0, 5, 0, -3715, 3, 2, 2, 3, -3717, 0, 0, 0, -3721, -3723, 5,
+    -3725, 0, -3726, -3727, -3731, -3736, -3737, 0, 5, 7, 0, 2, 3, -3738, -3739, -3741,
+    0, 3, 0, -3742, 0, 0, -3743, 0, 1, 0, 0, 13, -3746, -3748, 2, 0,
+    -3753, -3760, -3761, -3763, 0, -3767, -3771, 4, 0, 2, -3775, -3776, 4, 12, 0, 0,
+    -3781, -3785, 0, -3786, 1, 5, -3787, -3796, 0, 0, 0, 0, 0, -3800, 3, -3802,
+    11, -3803, 22, -3804, 0, 0, -3805, -3807, 3, 2, 3, 1, 0, -3815, 1, 1,
+    0, 0, 0, 0, 0, -3819, 0, 0, -3820, 0, 0, 4, 0, 1, 0, 0,
+    -3824, -3830, -3833, -3836, 0, -3837, 0, 1, 1, 0, 0, -3838, 7, 1, -3839, 3,
+    0, -3840, 0, 3, 0, 0, 0, 0, -3841, -3843, -3848, 0, 2, -3850, -3851, -3854,
+    3, -3856, 1, -3857, 1, 0, -3858, 1, -3859, 4, 0, -3866, -3869, 0, -3877, 1,
+    0, 0, 3, 0, 4, 0, 8, 5, 0, -3885, 4, -3889, -3891, -3892, 1, 0,
+    0, -3893, -3901, 0, 0, 2, 5, 0, -3906, 0, 0, -3909, 0, 8, 0, 0,
+    -3911, 18, 1, -3915, 1, 2, -3916, -3918, -3919, 0, -3920, 0, -3922, 0, 0, 3,
+    0, 2, -3926, 1, 0, -3927, 0, -3934, -3936, 11, 0, 0, 0, 0, 0, 1,
+    0, 0, -3941, -3947, -3951, 3, 3, -3954, 0, 0, 0, 12, -3955, -3956, 0, -3957,
+    7, 2, 16, 0, 10, 0, -3960, -3961, -3966, -3968, 6, 0, -3971, 0, 0, -3974,
+    -3980, -3982, -3988, 0, -3991, -3992, 8, 4, 0, 0, 0, 0, 3, -3993, -3994, 0,
+    0, 12, -3996, 0, -3997, 5, 0, -4002, 0, 0, 1, 0, 4, 0, 0, 0,
+    -4003, 0, -4004, 0, 0, -4010, -4015, 0, -4017, -4018, -4020, 2, 3, -4023, 0, -4024,
+    0, 0, 0, 0, 2, 14, -4026, 0, -4027, 4, -4032, -4033, 0, 0, 0, -4036,
+    1, -4038, 2, 5, 2, -4042, 14, -4044, 3, 0, -4047, -4049, -4050, -4051, 1, -4056,
+    -4057, -4059, -4060, 2, 0, 3, -4063, 2, 6, 0, 7, 0, 0, 0, -4064, -4066,
+    1, -4071, -4073, -4078, 0, -4080, -4088, 4, 2, 1, 5, 0, 0, -4089, -4093, -4095,
+    6, 0, -4097, -4098, 0, -4099, -4103, 7, -4105, 0, 2, 1, -4108, 1, 7, 0,
+    0, 8, -4109, 0, -4110, -4111, 0, -4116, 0, -4125, 3, 0, -4133, 3, 0, 17,
+    0, 1, 2, -4134, 5, 0, -4135, 0, -4137, 0, -4140, 0, -4145, 1, -4147, -4148,
+    -4150, 0, -4151, 0, 0, -4153, -4155, -4159, 0, -4160, 0, -4170, 0, 11, -4172, -4176,
+    0, -4177, 0, 0, -4180, 4, 5, 0, 0, 3, -4188, -4189, 2, 0, 0, -4194,
+    0, 0, 2, -4196, 0, -4197, -4198, -4200, -4202, -4203, 0, -4206, 12, -4207, -4209, 0,
+    0, 0, 0, 2, 0, 8, -4210, 0, 0, 5, 0, 1, 0, 0, 9, 0,
+    13, 1, 3, -4212, -4215, 0, -4216, -4219, -4221, 0, -4224, 1, -4225, -4226, -4232, -4233,
+    -4235, 0, -4237, 11, -4238, 0, -4243, 0, -4244, -4253, 0, 0, 0, 0, -4254, -4257,
+    -4260, 0, -4261, -4263, 0, -4264, -4268, -4270, 0, -4271, -4272, 0, 0, 0, 3, -4276,
+    0, -4280, -4285, 16, 3, 0, 0, 3, -4287, 2, 0, 3, -4288, -4291, 5, 0,
+    2, 2, -4292, 0, 2, 1, -4294, 1, 2, 0, -4295, 0, 0, 2, -4299, -4302,
+    6, 0, 0, 0, 0, -4304, -4307, -4309, 1, 1, 1, 0, -4311, 0, 6, 1,
+    -4313, 1, 0, 0, -4320, 0, -4328, -4330, -4331, -4334, -4338, -4339, 4, -4341, 0, 2,
+    -4347, 1, 0, 7, 1, 0, 0, 0, -4350, 1, 8, 0, 8, -4355, 0, 5,
+    -4360, 0, -4363, 0, 0, -4364, -4365, -4367, 1, 0, 0, -4369, -4371, 1, -4372, 4,
+    -4374, 48, 0, 0, -4376, 0, -4378, -4383, 0, -4386, 1, 0, 2, 0, 10, 1,
+    -4388, 14, 0, -4390, 4, -4391, 6, -4394, 1, 1, 1, 2, 9, -4398, -4399, 16,
+    1, -4400, 0, 0, -4401, 2, 2, -4402, 4, 0, 0, -4403, -4413, -4414, 0, 0,
+    -4421, -4424, 0, 0, 0, -4426, -4429, 0, -4430, -4431, 0, -4436, -4437, 10, 0, 0,
+    0, 4, -4440, -4442, 0, -4443, 0, -4448, 0, 0, -4450, 9, 0, -4454, -4456, 0,
+    -4458, 0, -4459, -4461, 0, -4462, -4464, 0, 1, 2, 0, -4467, 0, -4468, 0, 0,
+    -4469, -4471, -4475, 0, -4477, 0, -4478, 5, 0, 0, -4482, -4486, -4491, -4492, 3, 2,
+    0, 0, -4493, 0, -4500, 4, 0, 0, 1, -4501, -4502, 0, -4503, 0, -4504, 1,
+    0, 0, 19, -4505, -4507, -4509, -4510, 0, -4511, -4512, 4, 1, 0, 1, 1, 9,
+    0, -4517, -4521, 0, -4522, 0, 0, 0, 5, 0, -4524, 0, -4525, 0, 0, -4531,
+    0, -4534, -4537, -4539, 1, 8, -4540, -4541, 5, 0, 1, 0, 0, 6, 0, -4543,
+    -4544, -4549, -4552, -4557, 4, 0, 6, -4559, 0, 0, 0, 1, -4562, 4, 1, 0,
+    0, 0, 0, 0, -4564, 0, 0, 0, 0, 13, 3, 0, 0, 0, -4567, -4570,
+    12, 0, 0, 0, 0, 2, -4571, 0, 0, 3, 0,
+};
+
+/// The names of all slots, separated by a 0
+inline constexpr char namePool[] =
+    "shirt\0building_shield\0star\0rectangle_portrait\0person_hiking\0pinball\0chopsticks\0cubes_stacked\0"
+    "clipboard_medical\0staff_snake\0kidneys\0jira\0signal_3\0vector_square\0monitor_heart_rate\0square_r\0"
+    "yammer\0arrow_up_from_line\0waveform_lines\0level_down\0arrow_alt_from_right\0circle_question\0mix\0grin_alt\0"
+    "arrow_down_arrow_up\0square_down_right\0camcorder\0envelope_circle_check\0atlas\0font_case\0circle_arrow_down_left\0"
+    "arrows_to_circle\0transporter_7\0desktop_slash\0lobster\0blackboard\0tenge\0cross\0boxes_packing\0dropbox\0"
+    "house_leave\0mug\0restroom_simple\0wrench\0swimming_pool\0mailbox\0simplybuilt\0arrow_rotate_forward\0"
+    "anchor_circle_check\0globe_americas\0dice_four\0objects_align_top\0angry\0cc_stripe\0socks\0house_window\0"
+    "hand_point_up\0money_check_dollar\0calendar_circle_minus\0person_arrow_down_to_line\0dreidel\0pause\0"
+    "truck_tow\0rug\0umbrella_beach\0alarm_exclamation\0hourglass_clock\0user_shakespeare\0xmark_octagon\0"
+    "user_alien\0link_horizontal_slash\0honey_pot\0clock_seven_thirty\0glass_champagne\0message_edit\0toilet_paper_under\0"
+    "quinscape\0badge_percent\0resolving\0custard\0carriage_baby\0face_grin_squint_tears\0gas_pump_slash\0"
+    "plug_circle_plus\0j\0cheese\0pause_circle\0battery_full\0cowbell\0exploding_head\0up_down\0hamburger\0"
+    "rectangle_history_circle_plus\0ban\0repeat_1_alt\0chair\0table_cells_large\0party_horn\0futbol_ball\0"
+    "sledding\0square_caret_right\0comment_dollar\0kitchen_set\0person_dress_burst\0arrow_square_up\0store_slash\0"
+    "undo\0hand_peace\0remove_format\0page_caret_down\0claw_marks\0face_lying\0nimblr\0first_aid\0bangladeshi_taka_sign\0"
+    "usb_drive\0hand_back_point_left\0computer\0shield_times\0arrow_square_right\0car_side_bolt\0unlock_alt\0"
+    "tablet_screen\0goal_net\0window_frame_open\0arrow_circle_up\0comment_arrow_up\0puzzle_piece_simple\0candle_holder\0"
+    "space_shuttle\0puzzle_piece_alt\0tablet\0car_wrench\0mars_stroke_up\0font_awesome_flag\0user_robot\0dice_d6\0"
+    "wheelchair\0paper_plane\0message_quote\0house_lock\0face_laugh_beam\0desktop\0gavel\0arrow_up_wide_short\0"
+    "circle_pause\0phone_square_alt\0toilet_paper_reverse_alt\0italic\0head_side_cough\0creative_commons_sa\0"
+    "dragon\0sun_alt\0file_upload\0comment_medical\0shield_cat\0panel_ews\0sword\0rectangle_history_circle_user\0"
+    "message_code\0bong\0duck\0watch_smart\0hashtag\0brain\0rotate_back\0bell_slash\0rockrms\0creative_commons_pd_alt\0"
+    "arrow_down_up_across_line\0smoke\0splotch\0virus_covid_slash\0globe_stand\0square_quote\0stumbleupon\0"
+    "pro\0circle_microphone\0earth_americas\0file_slash\0signal_slash\0user_cog\0person_walking\0arrow_alt_left\0"
+    "wreath\0wpressr\0arrow_up_small_big\0chart_simple\0_8\0light_emergency_on\0bots\0face_grin_wink\0handshake_simple_slash\0"
+    "less_than_equal\0infinity\0frown\0bullhorn\0cup_straw_swoosh\0h_square\0book\0up_right\0spray_can\0github_square\0"
+    "shopware\0futbol\0square_x\0car_burst\0hockey_puck\0rectangle_sd\0sliders_h_square\0tablet_android\0snake\0"
+    "island_tropical\0trailer\0biohazard\0island_tree_palm\0dizzy\0flask_round_poison\0wine_glass_alt\0virus_slash\0"
+    "transporter_2\0male\0scalpel_path\0automobile\0eye_slash\0mask_face\0hockey_stick_puck\0vest\0themeisle\0"
+    "kaggle\0trash_alt\0conveyor_belt\0user_xmark\0feather\0glass_martini_alt\0location_slash\0car_bus\0angel\0"
+    "truck_clock\0camera_circle\0stomach\0play\0circle_arrow_left\0album_circle_plus\0ban_smoking\0warehouse\0"
+    "rupee_sign\0refrigerator\0flux_capacitor\0caret_circle_down\0game_console_handheld\0construction\0syringe\0"
+    "hospital_symbol\0flask_poison\0chess_king\0pipe_section\0arrows_retweet\0user_unlock\0vaadin\0holly_berry\0"
+    "hammer_war\0ampersand\0mushroom\0sportsball\0phone_flip\0star_half_alt\0piano\0arrow_down_1_9\0trowel_bricks\0"
+    "cup_togo\0square_3\0oil_well\0pen_alt_slash\0medium_m\0rouble\0plug_circle_bolt\0arrow_left_from_line\0"
+    "lari_sign\0comment_plus\0bell_exclamation\0wand_magic\0grid_5\0monero\0gauge_min\0apartment\0hands_holding_child\0"
+    "octagon\0list_1_2\0arrow_alt_down\0angle_down\0meter_fire\0shower\0hand_holding_droplet\0icons_alt\0user_minus\0"
+    "ember\0square_full\0usd_circle\0message_dollar\0phone_missed\0objects_align_center_vertical\0creative_commons_share\0"
+    "gulp\0level_up\0bread_slice\0pied_piper_hat\0birthday_cake\0link_simple\0hexagon_exclamation\0seal_exclamation\0"
+    "accusoft\0message_xmark\0keycdn\0space_station_moon\0book_journal_whills\0square_right\0walker\0bells\0"
+    "cassette_tape\0pied_piper_square\0google_play\0circle_trash\0paragraph_left\0minimize\0water_arrow_down\0"
+    "map_marker_alt_slash\0pencil_paintbrush\0box_fragile\0question_circle\0house_tree\0bicycle\0baseball_ball\0"
+    "signal\0square_xmark\0boxes_stacked\0whiskey_glass_ice\0hockey_mask\0grate_droplet\0planet_moon\0turtle\0"
+    "comment_alt_dollar\0bitcoin_sign\0folder_upload\0light_emergency\0arrow_alt_from_left\0circle_d\0circle_book_open\0"
+    "face_raised_eyebrow\0edit\0sitrox\0address_book\0heart\0arrow_alt_square_down\0pinata\0cancel\0hubspot\0"
+    "kiwi_fruit\0shop\0bowl_spoon\0laugh\0heart_half\0folder_image\0pen_square\0trophy\0arrow_down_to_arc\0"
+    "vault\0oil_temp\0border_style_alt\0face_awesome\0guitar_electric\0table_list\0square_a_lock\0merge\0grip\0"
+    "stripe_s\0shuffle\0plane_departure\0video\0medal\0hive\0blogger\0gamepad_alt\0people_robbery\0square_f\0"
+    "octagon_xmark\0angles_up\0square_t\0magnifying_glass_chart\0heart_circle_minus\0drafting_compass\0circle_0\0"
+    "mail_bulk\0shopping_basket_alt\0clover\0comments_question_check\0arrow_left_long\0dryer\0toilet_paper_reverse_slash\0"
+    "floppy_disk_times\0earth_europe\0chart_line_up\0project_diagram\0battle_net\0file_archive\0user_circle\0"
+    "ban_bug\0glasses\0soap\0face_exhaling\0chevron_double_up\0flag_pennant\0angle_double_up\0person_sledding\0"
+    "person_cane\0file_check\0gun\0exclamation\0franc_sign\0house_day\0tire_rugged\0otter\0pipe_circle_check\0"
+    "wheelchair_move\0tennis_ball\0book_atlas\0lock_hashtag\0dollar_circle\0arrow_down_square_triangle\0square_rootiable\0"
+    "circle_q\0untappd\0cricket_bat_ball\0bed_front\0xmark_large\0ticket_alt\0cloud\0square_pen\0chevron_right\0"
+    "diploma\0registered\0clothes_hanger\0square_question\0arrow_right_arrow_left\0dice_d20\0up_right_from_square\0"
+    "blanket\0comment_arrow_down\0minus\0user_bounty_hunter\0modx\0procedures\0blanket_fire\0r\0tablet_button\0"
+    "reply_all\0hexagon\0folder_xmark\0fire_smoke\0cart_circle_arrow_up\0balloon\0print_slash\0tint_slash\0"
+    "flickr\0page_break\0square_7\0wpforms\0wine_glass\0chess_clock_flip\0sort_desc\0pallet\0square_dashed\0"
+    "lock_keyhole_open\0arrow_left_long_to_line\0square_l\0pedestal\0chess_rook\0sword_laser\0book_circle_arrow_up\0"
+    "wizards_of_the_coast\0box\0stop_circle\0calendar_pen\0table\0hexagon_check\0house_medical_flag\0arrow_rotate_back\0"
+    "table_tree\0bagel\0bolt\0dochub\0wand_magic_sparkles\0shekel_sign\0arrow_rotate_right\0house_fire\0truck_moving\0"
+    "money_bills_alt\0brackets_square\0hourglass_start\0product_hunt\0shirt_tank_top\0left\0angle_left\0hourglass_end\0"
+    "image_polaroid\0thunderstorm_moon\0n\0chevron_double_down\0dial_off\0helicopter\0redo_alt\0axe_battle\0"
+    "dedent\0square_arrow_left\0handshake\0bed_alt\0chain_horizontal\0comment_alt_quote\0text_size\0dial_med\0"
+    "leaf_heart\0wodu\0researchgate\0square_font_awesome_stroke\0car_battery\0heart_music_camera_bolt\0microblog\0"
+    "abacus\0filter_circle_xmark\0falafel\0gripfire\0file_import\0bench_tree\0passport\0file_excel\0chevron_square_down\0"
+    "house_circle_xmark\0crop_alt\0amazon\0bluetooth_b\0watermelon_slice\0building_circle_arrow_right\0circle_4\0"
+    "clock_eight\0arrow_up_z_a\0republican\0cake_candles\0sign\0b\0circle_l\0paw\0balance_scale_right\0arrow_up_from_ground_water\0"
+    "arrow_down_left\0dribbble_square\0drone_front\0arrow_rotate_left\0calendar_circle_exclamation\0pen_ruler\0"
+    "arrow_right\0ferris_wheel\0alt\0poo_bolt\0frown_open\0lungs\0bolt_lightning\0chess_clock_alt\0fantasy_flight_games\0"
+    "comment_alt_arrow_down\0cowbell_circle_plus\0dryer_heat\0mobile_signal_out\0sort_amount_desc\0dharmachakra\0"
+    "adjust\0signs_post\0bus_alt\0circle_sort_down\0sort_shapes_up\0humidity\0ice_cream\0money_bill_1_wave\0"
+    "face_grin_tongue_wink\0cloud_word\0hand_holding_magic\0face_glasses\0wheat_awn\0search_plus\0pied_piper\0"
+    "ski_lift\0charging_station\0galactic_senate\0face_smiling_hands\0angellist\0cloud_upload\0folder_gear\0"
+    "message_smile\0person_pinball\0sort_amount_asc\0baht_sign\0layer_plus\0chess_king_piece\0sword_laser_alt\0"
+    "message_image\0jsfiddle\0folder_search\0github_alt\0cart_circle_plus\0phone_arrow_up_right\0circle_exclamation_check\0"
+    "fist_raised\0skull_cow\0tombstone\0tire_pressure_warning\0hexagon_minus\0people_pants\0square_up_left\0"
+    "laptop_code\0sign_hanging\0trello\0square_root\0table_tennis_paddle_ball\0tachograph_digital\0creative_commons_nc_eu\0"
+    "gitter\0wix\0_5\0volume_down\0youtube\0head_vr\0square_q\0file_caret_down\0temperature_3\0clouds\0industry_alt\0"
+    "sterling_sign\0life_ring\0onion\0minus_hexagon\0flower_tulip\0file_shield\0ski_boot\0kite\0dial_med_low\0"
+    "house_person_return\0message_bot\0file_chart_pie\0exchange\0squid\0brain_arrow_curved_right\0wave_pulse\0"
+    "dice_three\0cloud_hail\0line_columns\0exclamation_square\0film_canister\0shop_lock\0diagram_predecessor\0"
+    "circle_j\0octagon_plus\0sith\0object_exclude\0circle_arrow_down_right\0comment_alt_text\0user_friends\0"
+    "y\0calendar_time\0tachometer_alt_average\0tent\0comment_image\0camera\0down_from_line\0house_chimney_crack\0"
+    "save_circle_arrow_right\0battery_5\0minus_octagon\0leanpub\0comment_music\0broadcast_tower\0shovel_snow\0"
+    "binoculars\0bity\0square_arrow_right\0landmark\0eye\0face_smile\0landmark_flag\0location_pin_slash\0bowl_hot\0"
+    "table_layout\0comment_alt_edit\0user_helmet_safety\0ornament\0soundcloud\0arrow_left_to_line\0building_ngo\0"
+    "circle_dollar_to_slot\0square_down\0grate\0firewall\0face_grin_wide\0battery_0\0couch_small\0ethernet\0"
+    "border_bottom\0phone_volume\0cloud_bolt_moon\0face_woozy\0magnifying_glass_arrow_right\0objects_align_bottom\0"
+    "dong_sign\0deploydog\0reply_time\0colon\0chart_scatter_bubble\0barcode_read\0bell_plus\0down_left\0gun_slash\0"
+    "chess\0alarm_snooze\0shield_quartered\0bars_staggered\0bee\0cent_sign\0long_arrow_down\0sign_out_alt\0"
+    "trian_balbot\0cars\0theta\0axe\0drum\0museum\0file_download\0evernote\0utility_pole_double\0cart_arrow_up\0"
+    "mandalorian\0house_person_arrive\0user\0creative_commons_nc_jp\0cards\0person_to_portal\0keyboard_brightness\0"
+    "flag_alt\0creemee\0compass\0cart_flatbed_suitcase\0flask_potion\0jpy\0cloud_upload_alt\0alien\0user_chef\0"
+    "drum_steelpan\0times_hexagon\0creative_commons_nd\0diagram_project\0light_ceiling\0user_group_crown\0"
+    "keynote\0objects_align_right\0anchor\0long_arrow_right\0hat_witch\0naira_sign\0arrow_down\0long_arrow_alt_up\0"
+    "worm\0head_side_virus\0cloud_arrow_down\0zzz\0object_group\0funnel_dollar\0grid_2\0wallet\0app_store\0"
+    "distribute_spacing_vertical\0hand_scissors\0plane_up_slash\0book_open\0chart_bullet\0sign_language\0pushed\0"
+    "reply\0temperature_quarter\0sliders_v_square\0tree_decorated\0person_booth\0voicemail\0waveform\0window_frame\0"
+    "circle_m\0circle_ellipsis\0searchengin\0mobile_retro\0arrow_up_left\0text\0message_text\0circle_radiation\0"
+    "gingerbread_man\0up_long\0calendar_clock\0input_pipe\0bilibili\0calendar_circle_plus\0message_arrow_down\0"
+    "envelope_badge\0toothbrush\0memo_circle_check\0toilet_paper_blank_under\0person_seat\0pencil_alt\0journal_whills\0"
+    "envelope_open_text\0file_exclamation\0citrus\0garlic\0earth\0xmark_square\0book_open_alt\0masks_theater\0"
+    "tv_music\0th\0gear\0ear\0pencil_ruler\0volume\0family_dress\0pencil_square\0school\0youtube_square\0twitter\0"
+    "plane_prop\0poll_h\0l\0step_forward\0church\0land_mine_on\0folder_closed\0book_circle\0star_shooting\0"
+    "fly\0dollar_square\0wirsindhandwerk\0skeleton\0burn\0gitkraken\0arrow_turn_down\0plus_hexagon\0arrow_alt_from_top\0"
+    "screenpal\0angle_double_right\0fire\0arrows_repeat_1\0linkedin\0shipping_fast\0pompebled\0transporter_1\0"
+    "peapod\0camera_viewfinder\0pennant\0circle_9\0rectangle_vertical_history\0weight_scale\0mobile_android\0"
+    "virus\0telegram_plane\0globe_asia\0users_cog\0exclamation_triangle\0circle_caret_down\0person_from_portal\0"
+    "brazilian_real_sign\0battery_bolt\0strava\0quote_left_alt\0lungs_virus\0xmark_hexagon\0file_code\0boot_heeled\0"
+    "folders\0creative_commons_by\0cc_discover\0delete_left\0square_z\0spider_web\0rv\0scroll_old\0layer_group_minus\0"
+    "kiss\0tanakh\0pipe\0hands_praying\0user_chart\0phone_xmark\0eye_low_vision\0square_arrow_down\0ufo\0scrubber\0"
+    "speaker\0fedora\0microphone_lines_slash\0basketball\0binary_lock\0left_right\0cloud_moon\0truck_loading\0"
+    "shuttle_van\0user_hard_hat\0lamp_street\0group_arrows_rotate\0wave_square\0earth_america\0shirtsinbulk\0"
+    "glasses_round\0search\0behance_square\0circle_calendar\0windsock\0family\0starship\0home\0skype\0anchor_lock\0"
+    "gg\0gauge_high\0ufo_beam\0circle_star\0square_5\0arrow_right_to_line\0fish_bones\0toilet_paper_alt\0home_lg\0"
+    "circle_arrow_right\0barcode_alt\0lasso\0sistrix\0face_nauseated\0z\0paint_brush\0square_up\0erlang\0mug_marshmallows\0"
+    "circle_info\0heart_circle_plus\0sack_xmark\0circle_bookmark\0tower_broadcast\0industry\0tree\0square_phone\0"
+    "sliders\0atom\0paintbrush_alt\0arrow_to_left\0violin\0face_astonished\0won_sign\0hat_cowboy_side\0magnifying_glass_location\0"
+    "ruble\0films\0austral_sign\0knife_kitchen\0radar\0box_heart\0digital_ocean\0jedi\0rss\0airplay\0image_portrait\0"
+    "square_e\0mobile_signal\0user_edit\0rugby_ball\0house_signal\0money_check_pen\0w\0bolt_slash\0square_poll_vertical\0"
+    "search_location\0network_wired\0comment_lines\0chess_queen_piece\0hand_back_point_up\0weight_hanging\0"
+    "coffin_cross\0heart_square\0hexagon_vertical_nft_slanted\0person_military_to_person\0block\0face_meh\0"
+    "bracket_left\0user_times\0signal_bars_strong\0memory\0left_from_line\0vr_cardboard\0turntable\0bracket_curly\0"
+    "starfighter_twin_ion_engine_advanced\0sort_up\0flatbread_stuffed\0cactus\0snow_blowing\0person_military_pointing\0"
+    "file_image\0mountain\0tv_retro\0prescription\0slideshare\0sax_hot\0_union\0bathtub\0house_chimney_heart\0"
+    "grunt\0user_vneck\0shield_keyhole\0gif\0euro\0asterisk\0audible\0lastfm_square\0books_medical\0hryvnia_sign\0"
+    "comment_middle_top_alt\0circle_v\0luggage_cart\0kiwi_bird\0laugh_beam\0save_circle_xmark\0truck_container\0"
+    "melon_slice\0school_circle_exclamation\0arrows_up_down_left_right\0face_sad_cry\0drone\0coins\0vk\0notes\0"
+    "firstdraft\0memo_pad\0link_slash\0headphones_simple\0face_unamused\0basket_shopping\0badge_dollar\0arrow_alt_circle_down\0"
+    "crosshairs\0business_front\0vector_circle\0briefcase_medical\0watch_fitness\0hard_of_hearing\0sushi_roll\0"
+    "road_circle_xmark\0square_ellipsis\0thermometer_quarter\0edge\0square_down_left\0plane_slash\0person_skating\0"
+    "backspace\0signal_bars_good\0file_circle_info\0dashcube\0marker\0monument\0transporter_5\0thermometer_empty\0"
+    "glass_cheers\0fence\0shield_check\0location_plus\0objects_column\0sim_cards\0money_bills\0ruler\0arrows_up_down\0"
+    "leaf_oak\0arrow_turn_right\0users_rays\0user_hair\0water_ladder\0heart_circle_xmark\0solar_panel\0cart_xmark\0"
+    "file_dashed_line\0person_walking_dashed_line_arrow_right\0file_circle_minus\0hanukiah\0sort_shapes_up_alt\0"
+    "paw_claws\0fire_extinguisher\0face_kiss_wink_heart\0clock_one\0face_smile_tear\0octopus_deploy\0lightbulb_on\0"
+    "hands_wash\0comment_quote\0quora\0sun_cloud\0filter_slash\0filter_list\0python\0table_cells\0chevrons_right\0"
+    "apper\0clipboard_prescription\0circle_phone_hangup\0scalpel\0handshake_alt_slash\0trash_check\0person_ski_lift\0"
+    "remove\0square_n\0crutch\0file_spreadsheet\0arrow_circle_down\0square_code\0wheat_alt\0circle_y\0gauge_circle_bolt\0"
+    "shipping_timed\0border_inner\0rotate_right\0fire_flame\0backward_fast\0xmark\0car_tilt\0face_hushed\0"
+    "flying_disc\0car_crash\0router\0ello\0sensor\0face_kiss_beam\0unlock\0trash_alt_slash\0grip_dots\0tv_alt\0"
+    "file_arrow_down\0wifi_strong\0dhl\0bible\0ear_muffs\0google_plus_g\0arrows_alt_h\0innosoft\0bowl_chopsticks\0"
+    "right\0helmet_battle\0glass_half_empty\0cart_shopping\0bridge\0window_alt\0file_chart_column\0window_flip\0"
+    "gallery_thumbnails\0omega\0comment_captions\0truck_pickup\0typewriter\0theater_masks\0usb\0phone_hangup\0"
+    "less\0mixcloud\0circle_half_stroke\0chart_scatter\0nfc_trash\0markdown\0mouse_alt\0lacrosse_stick_ball\0"
+    "caravan_alt\0circle_1\0highlighter_line\0dungeon\0candy\0arrows_spin\0burger\0sd_cards\0face_anguished\0"
+    "frame\0comment_alt_captions\0react\0send_backward\0think_peaks\0desktop_arrow_down\0person_dots_from_line\0"
+    "hands_holding_heart\0camera_cctv\0moon_cloud\0planet_ringed\0triangle_circle_square\0outdent\0pinterest\0"
+    "barcode_scan\0indent\0square_small\0university\0envelope\0soup\0buy_n_large\0face_grin_tongue\0hands\0"
+    "poop\0tamale\0calendar_note\0biking\0face_party\0pan_food\0mars_stroke_right\0mdb\0semicolon\0hexagon_divide\0"
+    "microphone_slash\0person_walking_arrow_right\0solar_system\0dolly_flatbed_alt\0external_link_alt\0icons\0"
+    "phone_circle\0p\0lamp_floor\0arrow_down_z_a\0frosty_head\0crop_simple\0olive\0ruler_vertical\0tally\0"
+    "ghost\0eclipse_alt\0leafy_green\0loveseat\0arrow_down_to_bracket\0border_outer\0film\0square_ellipsis_vertical\0"
+    "underline\0signal_1\0guitars\0phone_square_down\0f\0tachometer_slow\0square_2\0cloud_showers\0fire_burner\0"
+    "object_ungroup\0bomb\0left_long_to_line\0rotate_exclamation\0chevron_left\0candy_corn\0truck_flatbed\0"
+    "yandex_international\0gauge_max\0indian_rupee_sign\0euro_sign\0whmcs\0circle_up_right\0layer_group_plus\0"
+    "blender_phone\0user_slash\0bookmark_circle\0rectangle\0football\0square_s\0dial\0caret_right\0tree_large\0"
+    "seal_question\0arrow_down_to_line\0square_envelope\0tally_2\0apple_whole\0binary\0trash_clock\0box_tissue\0"
+    "long_arrow_left\0earth_africa\0toggle_off\0readme\0home_heart\0apple_alt\0faucet\0dial_min\0draw_circle\0"
+    "inbox_arrow_up\0square_dollar\0sensor_smoke\0transporter_3\0circle_up\0history\0temperature_full\0o\0"
+    "plate_wheat\0chart_pie_simple\0computer_mouse_scrollwheel\0pray\0mobile_button\0js_square\0octagon_minus\0"
+    "book_alt\0u\0head_side_goggles\0folder_times\0arrow_turn_down_left\0greater_than_equal\0arrow_up\0shield\0"
+    "truck_plane\0arrows_to_eye\0laugh_wink\0clock_five_thirty\0flame\0folder_grid\0camera_security\0floppy_disk_pen\0"
+    "house_damage\0mug_saucer\0sketch\0viadeo_square\0trash_restore_alt\0location_minus\0person_drowning\0"
+    "cloud_showers_water\0hryvnia\0replyd\0map_location_dot\0bug\0user_alt_slash\0handshake_simple\0rev\0code_fork\0"
+    "bags_shopping\0sun_dust\0rectangle_xmark\0calendar_circle\0neuter\0phone_laptop\0bridge_circle_exclamation\0"
+    "notebook\0circle_3\0sort_down\0up_to_line\0openid\0waveform_circle\0braille\0layer_minus\0tally_3\0stream\0"
+    "traffic_light\0book_section\0users_viewfinder\0heading\0stethoscope\0user_ninja\0file_circle_question\0"
+    "g\0face_frown_open\0box_usd\0street_view\0money_check\0file_audio\0arrow_alt_up\0chess_pawn_piece\0git_square\0"
+    "apple_core\0gift\0gift_card\0roller_coaster\0quote_right_alt\0football_helmet\0delicious\0compress_wide\0"
+    "magnifying_glass_dollar\0rupiah_sign\0hose_reel\0exchange_alt\0signal_alt\0child_dress\0fireplace\0circle_quarters\0"
+    "handshake_slash\0person_ski_jumping\0dice_d12\0arrows_h\0arrow_alt_from_bottom\0sort_amount_up\0laravel\0"
+    "phone\0person_dress_simple\0clipboard_check\0baguette\0alipay\0washing_machine\0lira_sign\0hands_holding_circle\0"
+    "minus_square\0unsorted\0hyphen\0user_injured\0columns\0rub\0comet\0arrow_square_left\0ideal\0coffee_togo\0"
+    "hand_paper\0clapperboard_play\0arrow_up_1_9\0sort_size_down\0memo_circle_info\0shopify\0snowflake\0a\0"
+    "calendar_range\0dot_circle\0weebly\0closed_captioning_slash\0basketball_ball\0face_melting\0ice_skate\0"
+    "gauge_simple_high\0tank_water\0briefcase_clock\0user_shield\0spoon\0cards_blank\0video_plus\0step_backward\0"
+    "table_pivot\0camera_polaroid\0users_gear\0shirt_long_sleeve\0fast_backward\0golf_ball_tee\0people_group\0"
+    "microphone_alt_slash\0book_arrow_up\0border_left\0shower_alt\0starfighter_alt_advanced\0nfc_pen\0cuttlefish\0"
+    "heart_circle\0pinterest_square\0right_left\0fan_table\0inbox_out\0leaf_maple\0floppy_disk\0truck_fast\0"
+    "flag_usa\0dolphin\0file_zipper\0hand_receiving\0ping_pong_paddle_ball\0american_sign_language_interpreting\0"
+    "banana\0up_from_dotted_line\0lock_open\0list\0pen_clip\0thermometer_half\0circle_parking\0music\0user_hair_buns\0"
+    "umbraco\0arrow_pointer\0bus\0table_picnic\0garage_car\0scarecrow\0vnv\0face_kiss_closed_eyes\0floppy_disk_circle_arrow_right\0"
+    "shish_kebab\0dyalog\0dagger\0bootstrap\0burger_lettuce\0diagnoses\0vimeo_square\0atlassian\0sellsy\0folder_blank\0"
+    "rmb\0memo\0waveform_path\0file\0grin_beam_sweat\0store_lock\0face_laugh_wink\0toilet_portable\0ditto\0"
+    "people_carry\0briefcase_arrow_right\0wand_sparkles\0mango\0map_marker_edit\0square\0smile\0up_right_and_down_left_from_center\0"
+    "play_pause\0font_awesome_alt\0car_building\0anchor_circle_exclamation\0ad\0broom\0citrus_slice\0ussunnah\0"
+    "down_left_and_up_right_to_center\0circle_chevron_right\0gg_circle\0stack_exchange\0page\0face_grin_tongue_squint\0"
+    "arrow_alt_to_right\0i\0guarani_sign\0sort_alpha_asc\0message_question\0store_alt_slash\0transporter_empty\0"
+    "viadeo\0french_fries\0hand_holding_heart\0heart_half_alt\0wheat_awn_circle_exclamation\0virus_covid\0"
+    "filters\0sms\0glass_whiskey\0square_bolt\0rectangle_times\0shrimp\0highlighter\0bone_break\0book_tanakh\0"
+    "neos\0right_from_bracket\0card_spade\0superscript\0temperature_empty\0circle_small\0wordpress_simple\0"
+    "grip_lines\0mail_reply\0facebook_f\0umbrella\0circle_envelope\0egg_fried\0signature_slash\0rectangles_mixed\0"
+    "hand_holding_water\0democrat\0diamond\0arrow_up_from_water_pump\0monitor_waveform\0podium_star\0temperature_sun\0"
+    "trowel\0bullseye_arrow\0user_plus\0peanut\0rectangle_barcode\0filter\0comment_alt_exclamation\0rocket_launch\0"
+    "down_to_bracket\0clinic_medical\0qrcode\0thunderstorm_sun\0folder_bookmark\0user_vneck_hair\0chevron_square_right\0"
+    "hand_holding_seedling\0person_sign\0leaf\0steam_symbol\0d\0circle_caret_left\0house_night\0scale_unbalanced\0"
+    "gauge_simple_low\0shield_virus\0water\0arrow_up_a_z\0capsules\0globe_africa\0block_quote\0burst\0martini_glass_citrus\0"
+    "affiliatetheme\0person_pregnant\0tent_arrow_turn_left\0subscript\0person_circle_plus\0car_tunnel\0sensor_alert\0"
+    "greater_than\0cheese_swiss\0square_fragile\0google_pay\0print\0code_pull_request\0clock_five\0shield_slash\0"
+    "scribble\0face_dizzy\0rectangle_code\0dev\0snapchat_ghost\0golf_flag_hole\0_42_group\0glass_water_droplet\0"
+    "hands_clapping\0person_walking_luggage\0droplet_percent\0elevator\0toilets_portable\0chess_clock\0circle_n\0"
+    "pencil\0toilet_paper_slash\0dice_d8\0arrow_from_right\0chess_bishop\0broom_ball\0link_simple_slash\0hacker_news\0"
+    "chart_scatter_3d\0cloudsmith\0hard_drive\0person_swimming\0circle_sort\0circle_phone_flip\0intercom\0"
+    "meh\0shekel\0face_grin_beam\0arrow_up_right_dots\0cloud_download_alt\0user_cowboy\0user_pilot_tie\0calendar_times\0"
+    "search_minus\0meh_blank\0check\0lambda\0trash_list\0grin_squint\0pied_piper_alt\0square_v\0cc_amex\0clock\0"
+    "table_rows\0tv\0share_alt\0bowl_soft_serve\0arrow_alt_to_left\0tint\0trademark\0volume_times\0left_to_line\0"
+    "creative_commons_nc\0cart_minus\0nigiri\0optin_monster\0book_sparkles\0book_medical\0turn_up\0home_blank\0"
+    "face_frown_slight\0etsy\0servicestack\0baseball\0arrow_alt_circle_up\0eye_dropper_empty\0period\0sign_in\0"
+    "empire\0kazoo\0inbox_in\0h5\0ski_jump\0taxi\0horse\0signature\0moped\0file_lines\0face_disguise\0brackets_round\0"
+    "arrow_right_from_line\0hand_lizard\0list_radio\0ellipsis\0pot_food\0video_slash\0cloud_arrow_up\0album_circle_user\0"
+    "diagram_successor\0mug_tea_saucer\0book_font\0firefox_browser\0calculator\0menorah\0truck_droplet\0colon_sign\0"
+    "comment_alt_times\0guitar\0paypal\0light_switch_off\0face_head_bandage\0shopping_cart\0square_j\0wsh\0"
+    "codiepie\0box_open_full\0tower_observation\0school_circle_xmark\0cloud_moon_rain\0circle_g\0martini_glass\0"
+    "igloo\0cloud_sun_rain\0user_gear\0microscope\0podium\0file_plus_minus\0location_exclamation\0rectangle_landscape\0"
+    "creative_commons_pd\0high_definition\0phone_arrow_down_left\0truck\0info_circle\0hand_holding\0critical_role\0"
+    "shuttle_space\0laptop_slash\0umbrella_simple\0trade_federation\0exclamation_circle\0starfighter\0calendar_plus\0"
+    "chain_slash\0tree_city\0tools\0face_nose_steam\0dice_five\0tags\0hexagon_vertical_nft\0viber\0barcode\0"
+    "reorder\0info\0itch_io\0mail_reply_all\0slash_back\0hips\0car_bolt\0thermometer_full\0spotify\0invision\0"
+    "zap\0film_slash\0band_aid\0ravelry\0watch_calculator\0angrycreative\0ticket\0file_times\0border_top_left\0"
+    "file_certificate\0circle_arrow_down\0quran\0rod_asclepius\0font_awesome_logo_full\0share_alt_square\0"
+    "joint\0puzzle\0user_police\0angle_90\0sliders_h\0arrows_rotate\0truck_ramp_couch\0battery\0wpexplorer\0"
+    "circle_chevron_down\0perbyte\0redo\0face_grin_stars\0file_chart_line\0battery_empty\0building\0tshirt\0"
+    "envelope_dot\0person_rays\0person_digging\0comment_xmark\0nesting_dolls\0gauge_low\0ball_pile\0window_restore\0"
+    "swatchbook\0tomato\0accessible_icon\0brake_warning\0laptop_mobile\0user_astronaut\0sausage\0sort_shapes_down_alt\0"
+    "pen_paintbrush\0circle_7\0game_board\0house_heart\0shield_blank\0popcorn\0hexagon_plus\0compass_slash\0"
+    "hand_back_point_right\0egg\0plane_circle_xmark\0cable_car\0faucet_drip\0arrow_right_from_file\0undo_alt\0"
+    "volcano\0stocking\0phone_circle_alt\0atom_alt\0keyboard_down\0up\0calendar_upload\0computer_mouse\0seal\0"
+    "fan\0expand_wide\0user_graduate\0square_heart\0paint_brush_fine\0peace\0expand_arrows\0truck_arrow_right\0"
+    "align_center\0pied_piper_pp\0magnifying_glass_plus\0air_freshener\0browser\0head_side_medical\0file_xmark\0"
+    "calculator_simple\0ear_listen\0message_music\0trash_circle\0mobile_android_alt\0face_shush\0note_sticky\0"
+    "light_switch\0file_prescription\0square_b\0hat_chef\0hot_tub_person\0sliders_simple\0caret_square_left\0"
+    "square_kanban\0toilet_paper_blank\0cruzeiro_sign\0temperature_list\0home_alt\0bowl_chopsticks_noodles\0"
+    "rotate_left\0fork_knife\0rectangle_wide\0pepper\0sort_numeric_down_alt\0nfc\0microphone_stand\0wolf_pack_battalion\0"
+    "conveyor_belt_alt\0croissant\0bowl_rice\0phone_circle_down\0facebook\0pen_slash\0arrow_down_wide_short\0"
+    "yahoo\0circle_stop\0people_arrows\0volume_high\0person_seat_reclined\0hill_rockslide\0poo\0trash_undo\0"
+    "traffic_light_go\0earth_asia\0calendar_star\0wall_brick\0money_bill\0bank\0starfighter_twin_ion_engine\0"
+    "diagram_nested\0video_circle\0box_ballot\0unlock_keyhole\0phone_incoming\0file_word\0microwave\0burger_cheese\0"
+    "objects_align_left\0rectangle_list\0legal\0list_check\0paper_plane_top\0puzzle_piece\0volume_low\0rectangle_terminal\0"
+    "joystick\0nfc_lock\0connectdevelop\0square_m\0creative_commons\0navicon\0tally_4\0swimmer\0comments_question\0"
+    "box_open\0arrows_maximize\0square_caret_down\0glass_half_full\0clock_twelve\0bring_forward\0arrow_up_arrow_down\0"
+    "school_flag\0message_lines\0h3\0times_rectangle\0xmark_to_slot\0down_from_dotted_line\0circle_sort_up\0"
+    "circle_divide\0plate_utensils\0book_skull\0chevron_square_left\0mercury\0page_caret_up\0square_person_confined\0"
+    "user_nurse_hair\0timer\0eggplant\0sim_card\0box_up\0line\0star_sharp\0plus_circle\0wave_sine\0praying_hands\0"
+    "goodreads\0mobile_iphone\0person_shelter\0right_long_to_line\0fill\0up_left\0garage_open\0cup_straw\0"
+    "inhaler\0star_christmas\0cart_circle_arrow_down\0warehouse_full\0dash\0bolt_auto\0code_pull_request_closed\0"
+    "tachometer_fast\0diamond_exclamation\0handcuffs\0person_to_door\0usd\0hands_american_sign_language_interpreting\0"
+    "sheep\0whale\0dryer_alt\0usd_square\0truck_field_un\0tablet_rugged\0tablet_android_alt\0chart_mixed\0"
+    "fax\0bat\0circle_t\0drupal\0external_link_square\0landscape\0trash_can_xmark\0ambulance\0messaging\0bridge_water\0"
+    "face_eyes_xmarks\0square_caret_left\0battery_3\0list_dots\0hand_back_fist\0pipe_valve\0temperature_down\0"
+    "kickstarter\0peach\0cloud_question\0backward\0cc_apple_pay\0h1\0temperature_half\0graduation_cap\0film_alt\0"
+    "peseta_sign\0flute\0square_list\0arrow_right_to_file\0quote_right\0rss_square\0money_from_bracket\0list_tree\0"
+    "dumpster_fire\0hands_usd\0wifi_weak\0gauge_circle_plus\0calendar\0badge_sheriff\0person_circle_check\0"
+    "battery_2\0arrows_left_right\0list_timeline\0shopping_bag\0hand_point_left\0m\0rhombus\0pen_fancy_slash\0"
+    "file_search\0plug_circle_xmark\0calendar_check\0loader\0grid_3\0clipboard_question\0tick\0moon_over_sun\0"
+    "dolly_flatbed_empty\0carrot\0cookie_bite\0symfony\0ups\0angle_double_left\0location_smile\0rabbit\0box_circle_check\0"
+    "location_pin\0face_vomit\0temperature_low\0diagram_cells\0clouds_moon\0layer_group\0shelves\0warning\0"
+    "face_disappointed\0shield_minus\0thermometer\0scarf\0pickleball\0sitemap\0cloud_xmark\0c\0analytics\0"
+    "transporter\0zhihu\0magento\0digital_tachograph\0car_wash\0angle_up\0bowl_salad\0id_badge\0comment_slash\0"
+    "person_circle_minus\0facebook_square\0bars\0bitcoin\0face_laugh\0person_dolly\0location_check\0train\0"
+    "video_arrow_down_left\0key_skeleton_left_right\0pencil_slash\0temperature_1\0caret_left\0messages\0copyright\0"
+    "square_a\0certificate\0coin_blank\0sort_numeric_asc\0backward_step\0money_bill_wave\0long_arrow_alt_down\0"
+    "accent_grave\0blog\0person_through_window\0bracket_square_right\0mug_hot\0location_dot_slash\0stackpath\0"
+    "share_nodes\0signal_perfect\0battery_three_quarters\0music_alt_slash\0odnoklassniki\0slider\0clock_six\0"
+    "border_none\0square_4\0arrow_up_big_small\0suitcase_rolling\0compress_arrows\0battery_half\0map_marker_question\0"
+    "person_walking_with_cane\0file_music\0eyes\0water_arrow_up\0id_card_clip\0hand_rock\0spa\0_0\0grin_beam\0"
+    "rectangle_hd\0smile_wink\0folder_tree\0gramophone\0circle_half\0crate_apple\0pagelines\0freebsd\0long_arrow_alt_right\0"
+    "square_w\0cube\0steak\0cny\0t_shirt\0biking_mountain\0mountains\0file_pen\0snowplow\0cloud_sleet\0mail_forward\0"
+    "truck_couch\0square_i\0star_sharp_half\0knife\0video_camera\0hdd\0commenting\0v\0comment_code\0chess_rook_alt\0"
+    "ribbon\0walkie_talkie\0heart_rate\0hammer_crash\0power_off\0chevron_square_up\0sort_amount_up_alt\0arrow_up_left_from_circle\0"
+    "_7\0clipboard_list\0eye_dropper_full\0arrow_right_from_arc\0crown\0transgender_alt\0phone_plus\0tombstone_alt\0"
+    "arrow_down_left_and_arrow_up_right_to_center\0calculator_alt\0mobile_phone\0dolly_empty\0text_height\0"
+    "alien_monster\0bottle_droplet\0link\0camera_retro\0campground\0triangle_instrument\0circle_ellipsis_vertical\0"
+    "jet_fighter_up\0money_bill_1\0list_numeric\0arrow_right_long\0joget\0pipe_smoking\0quidditch_broom_ball\0"
+    "door_closed\0turn_down_left\0business_time\0lyft\0briefcase\0user_tie\0camera_web\0square_user\0typo3\0"
+    "s\0landmark_dome\0building_columns\0rod_snake\0alarm_clock\0shuttlecock\0keyboard_brightness_low\0person_carry\0"
+    "expand\0face_holding_back_tears\0folder_cog\0water_rise\0flask\0snowman_head\0fish_cooked\0star_exclamation\0"
+    "arrows_alt\0arrow_down_long\0box_archive\0clock_three_thirty\0hands_holding_diamond\0grip_horizontal\0"
+    "tumblr_square\0language\0trash_arrow_up\0face_monocle\0circle_nodes\0turn_down\0sort_shapes_down\0mp3_player\0"
+    "grin_tongue\0alarm_plus\0chalkboard\0face_hand_yawn\0bus_simple\0snowboarding\0map_marker_minus\0tired\0"
+    "pump_medical\0hockey_sticks\0user_police_tie\0border_top\0car_rear\0meta\0tower_control\0narwhal\0arrow_down_up_lock\0"
+    "paperclip\0value_absolute\0text_slash\0mortar_pestle\0credit_card_front\0siren_on\0traffic_light_slow\0"
+    "mound\0ellipsis_h\0school_circle_check\0vacuum_robot\0transporter_6\0turn_down_right\0arrow_alt_circle_right\0"
+    "anchor_circle_xmark\0chevron_circle_down\0right_to_bracket\0message_arrow_up\0balance_scale_left\0candy_cane\0"
+    "face_laugh_squint\0skating\0mosque\0house\0aviato\0dollar_sign\0house_circle_exclamation\0wifi_1\0poll_people\0"
+    "delete_right\0flag_checkered\0phone_alt\0align_left\0grin_stars\0diagram_subtask\0vial_virus\0triangle_exclamation\0"
+    "mixer\0hand_holding_hand\0mattress_pillow\0face_flushed\0money_simple_from_bracket\0person\0circle_down_left\0"
+    "coffee\0message_sms\0reacteurope\0gas_pump\0satellite_dish\0hooli\0people_simple\0arrows_turn_to_dots\0"
+    "house_water\0hands_bubbles\0face_clouds\0music_note_slash\0signal_stream\0face_dotted\0tire\0tree_palm\0"
+    "rupee\0car_side\0mars_and_venus_burst\0book_open_cover\0dial_med_high\0sack\0block_brick\0file_text\0"
+    "tent_arrow_left_right\0ruler_triangle\0arrow_to_right\0caret_down\0sort_alt\0forumbee\0circle_ampersand\0"
+    "oil_temperature\0deer\0image_landscape\0digging\0download\0disc_drive\0square_0\0lacrosse_stick\0swords_laser\0"
+    "palfed\0boxes_alt\0dailymotion\0html5\0face_frown\0figma\0confluence\0uikit\0sort_amount_down\0square_8\0"
+    "glide\0keybase\0face_smile_hearts\0clock_three\0comment_alt_image\0eye_dropper_half\0makizushi\0hiking\0"
+    "camera_rotate\0close\0buromobelexperte\0caret_square_down\0steering_wheel\0korvue\0folder_open\0transgender\0"
+    "fog\0game_board_alt\0keyboard\0arrows_to_dot\0square_virus\0wifi_exclamation\0xing_square\0weixin\0head_side_heart\0"
+    "forward\0pi\0calendar_image\0hourglass_half\0cogs\0grid\0database\0circle_z\0mendeley\0spell_check\0thermometer_4\0"
+    "arrow_up_short_wide\0tachometer_fastest\0ram\0sort_alpha_up_alt\0square_chevron_right\0signal_bars_fair\0"
+    "times_circle\0mastodon\0wheat\0scribd\0line_chart\0bow_arrow\0magnifying_glass\0smile_beam\0face_fearful\0"
+    "comment_alt_medical\0stripe\0aperture\0face_confused\0city\0subway_tunnel\0arrows_from_line\0spinner\0"
+    "hundred_points\0pegasus\0mars_stroke\0hands_holding\0washer\0users\0clock_two\0bars_progress\0pretzel\0"
+    "cpanel\0phone_rotary\0diagram_venn\0helmet_un\0apple_pay\0gauge_simple_min\0plug_circle_check\0clock_rotate_left\0"
+    "server\0gamepad_modern\0shredder\0sort_numeric_down\0hands_helping\0code_merge\0calendar_week\0brackets_curly\0"
+    "users_class\0gauge_simple_max\0playstation\0plug_circle_exclamation\0hand_point_right\0grin_hearts\0store\0"
+    "starship_freighter\0place_of_worship\0circle_play\0tumblr\0hand_wave\0bacteria\0plane\0envelopes\0cloud_music\0"
+    "clock_six_thirty\0jack_o_lantern\0cctv\0mask_snorkel\0star_half\0sort_circle\0plane_arrival\0hackerrank\0"
+    "spider_black_widow\0briefcase_blank\0flag\0book_open_reader\0hamsa\0forward_step\0sort_circle_up\0person_circle_xmark\0"
+    "slot_machine\0terminal\0arrows_turn_right\0split\0spaghetti_monster_flying\0mask\0scanner_touchscreen\0"
+    "creative_commons_remix\0distribute_spacing_horizontal\0plug_circle_minus\0clock_twelve_thirty\0face_smirking\0"
+    "sort_circle_down\0grapes\0tachometer_alt\0florin_sign\0map_marked\0thumbs_up\0heart_half_stroke\0grid_horizontal\0"
+    "jug_detergent\0bus_school\0chevron_circle_right\0presentation_screen\0lock_a\0signal_2\0flower_daffodil\0"
+    "teamspeak\0buysellads\0long_arrow_up\0vote_yea\0ban_parking\0steam\0arrow_up_to_line\0square_caret_up\0"
+    "circle\0comment_text\0face_smile_relaxed\0mailchimp\0thermometer_2\0clock_four_thirty\0outlet\0golang\0"
+    "industry_windows\0dribbble\0weight\0book_circle_arrow_right\0external_link_square_alt\0temperature_arrow_down\0"
+    "align_justify\0caret_circle_right\0paw_alt\0fragile\0broccoli\0plug\0prescription_bottle_alt\0turkish_lira\0"
+    "cassette_betamax\0snooze\0file_edit\0handshake_angle\0trash\0person_walking_arrow_loop_left\0vial\0feather_alt\0"
+    "house_tsunami\0vial_circle_check\0dice_two\0signal_bars_weak\0mars_stroke_v\0engine_exclamation\0prescription_bottle\0"
+    "train_subway\0retweet\0css3\0themeco\0list_ul\0yandex\0do_not_enter\0helmet_safety\0star_sharp_half_alt\0"
+    "map_marker_alt\0plane_circle_check\0wine_glass_crack\0galactic_republic\0sort_alpha_desc\0circle_check\0"
+    "wind_warning\0scale_unbalanced_flip\0jedi_order\0person_falling\0nfc_slash\0slack\0paintbrush_pencil\0"
+    "bookmark\0wind_circle_exclamation\0signal_alt_2\0crate_empty\0fishing_rod\0crop\0siren\0user_hair_long\0"
+    "hands_asl_interpreting\0tarp_droplet\0_3\0feather_pointed\0building_lock\0get_pocket\0question_square\0"
+    "hourglass_empty\0pen_to_square\0circle_phone\0comment_middle_alt\0ruble_sign\0d_and_d_beyond\0user_pilot\0"
+    "car_bump\0cloud_bolt\0glass\0wave_triangle\0house_chimney_medical\0globe_oceania\0person_praying\0fish\0"
+    "gitlab\0file_circle_exclamation\0betamax\0cab\0artstation\0raygun\0message_arrow_up_right\0eraser\0random\0"
+    "cloud_drizzle\0grimace\0book_heart\0facebook_messenger\0yelp\0strawberry\0trash_undo_alt\0assistive_listening_systems\0"
+    "block_question\0comments_dollar\0om\0chevron_double_right\0coconut\0spinner_third\0circle_w\0unicorn\0"
+    "road_barrier\0gbp\0archway\0hospital_user\0slash\0vhs\0user_check\0fonticons\0map_location\0wifi_slash\0"
+    "arrow_up_triangle_square\0square_c\0arrow_right_rotate\0algolia\0film_simple\0volume_xmark\0compass_drafting\0"
+    "field_hockey_stick_ball\0square_ring\0globe\0dial_low\0backpack\0comment_alt_smile\0buffer\0chain\0calendar_circle_user\0"
+    "boxing_glove\0person_falling_burst\0y_combinator\0java\0messages_dollar\0contao\0face_drooling\0road_bridge\0"
+    "table_tennis\0hand_point_ribbon\0git\0cloud_fog\0pen_line\0farm\0brackets\0arrow_from_bottom\0instalod\0"
+    "chevrons_down\0circle_microphone_lines\0node\0chart_column\0cloud_exclamation\0wagon_covered\0wrench_simple\0"
+    "cash_register\0cog\0train_tunnel\0firefox\0person_biking_mountain\0border_style\0cannabis\0paintbrush\0"
+    "money_bill_wheat\0browsers\0arrow_trend_up\0bottle_water\0wikipedia_w\0school_lock\0chart_network\0hand_back_point_ribbon\0"
+    "radiation_alt\0tablet_screen_button\0chart_pie_alt\0rainbow\0jar_wheat\0atom_simple\0user_crown\0heart_circle_exclamation\0"
+    "escalator\0line_height\0file_circle_check\0down_to_line\0face_thermometer\0clock_nine_thirty\0face_grin_beam_sweat\0"
+    "balance_scale\0window_close\0kiss_beam\0cheeseburger\0circle_k\0krw\0code_pull_request_draft\0bezier_curve\0"
+    "truck_front\0medrt\0building_un\0phone_arrow_down\0hands_holding_dollar\0file_invoice\0sensor_fire\0amilia\0"
+    "paint_roller\0calendar_arrow_up\0mosquito\0tree_christmas\0shirt_running\0camera_slash\0scythe\0pepper_hot\0"
+    "minus_large\0house_medical_circle_exclamation\0face_grimace\0elementor\0people_arrows_left_right\0ticket_airline\0"
+    "box_alt\0stamp\0clock_four\0signal_bars\0h2\0scroll_torah\0arrow_up_right_and_arrow_down_left_from_center\0"
+    "house_turret\0comment_check\0timeline\0comment_middle\0cloud_sun\0olive_branch\0user_doctor_message\0"
+    "skull\0js\0route_highway\0tty\0temperature_up\0lines_leaning\0mountain_city\0people_dress_simple\0less_than\0"
+    "head_side_cough_slash\0face_sad_sweat\0inboxes\0comment_alt_arrow_up\0signal_weak\0chess_knight\0sushi\0"
+    "horse_head\0square_1\0reddit_alien\0caret_circle_left\0folder_magnifying_glass\0person_dolly_empty\0music_note\0"
+    "house_medical_circle_xmark\0id_card_alt\0percent\0xbox\0monkey\0eye_dropper\0house_crack\0eye_evil\0nfc_symbol\0"
+    "box_dollar\0arrow_left\0bring_front\0angles_right\0grid_4\0asymmetrik\0bracket_curly_right\0ankh\0behance\0"
+    "book_law\0arrow_up_to_dotted_line\0restroom\0phone_arrow_up\0pastafarianism\0badger_honey\0php\0cow\0"
+    "square_h\0crab\0empty_set\0sprinkler\0hacker_news_square\0sidebar_flip\0car_alt\0tents\0message_times\0"
+    "flask_vial\0webcam\0phabricator\0salesforce\0vials\0ballot\0computer_speaker\0house_flag\0code_compare\0"
+    "trash_can_list\0uber\0card_heart\0shovel\0jar\0tent_arrows_down\0hand_holding_dollar\0map_marker_plus\0"
+    "shield_exclamation\0robot\0box_check\0fedex\0shortcake\0lightbulb_exclamation\0cart_circle_xmark\0saxophone\0"
+    "arrow_up_right\0arrows_repeat\0chain_horizontal_slash\0litecoin_sign\0face_smile_horns\0suitcase\0calendar_minus\0"
+    "globe_snow\0comment_dots\0music_slash\0input_text\0plus_square\0horse_saddle\0chess_pawn\0uncharted\0"
+    "user_tie_hair\0dollar\0temperature_4\0couch\0folder_arrow_up\0grav\0house_blank\0blender\0btc\0overline\0"
+    "crow\0list_music\0megaphone\0person_military_rifle\0bone\0trash_can_arrow_up\0cubes\0vine\0butter\0chart_pie\0"
+    "bed_empty\0clock_nine\0message_minus\0reddit_square\0rows\0hashtag_lock\0people\0fort_awesome\0reply_clock\0"
+    "r_project\0display_code\0tachometer_alt_slowest\0comment_times\0hand_back_point_down\0comment_minus\0"
+    "plane_alt\0header\0down_long\0raspberry_pi\0waffle\0align_right\0portrait\0flask_round_potion\0comment_smile\0"
+    "google\0window_minimize\0keyboard_left\0parking_circle_slash\0medkit\0map_signs\0dumpster\0cloud_check\0"
+    "champagne_glass\0road_lock\0paw_simple\0locust\0face_sleepy\0window\0ellipsis_v_alt\0angle_double_down\0"
+    "house_laptop\0money_bill_wave_alt\0plane_circle_exclamation\0baby\0periscope\0dashboard\0hippo\0wheelchair_alt\0"
+    "circle_b\0circle_x\0scanner_image\0cake\0avocado\0low_vision\0shield_heart\0ethereum\0tent_arrow_down_to_line\0"
+    "headphones\0arrow_down_to_square\0bore_hole\0deaf\0table_columns\0scroll\0user_md_chat\0unity\0people_pulling\0"
+    "gamepad\0whatsapp_square\0teeth_open\0blogger_b\0grin_tears\0mind_share\0hand_holding_medical\0contact_book\0"
+    "donut\0print_search\0lemon\0bread_slice_butter\0baby_carriage\0rocketchat\0renren\0align_slash\0objects_align_center_horizontal\0"
+    "face_smile_tongue\0pallet_boxes\0sad_cry\0signal_alt_1\0signal_alt_4\0plus\0photo_video\0wind\0address_card\0"
+    "sun_haze\0lollypop\0arrows_split_up_and_left\0chevron_double_left\0watch\0car_mechanic\0circle_user\0"
+    "arrow_turn_down_right\0truck_container_empty\0symbols\0level_up_alt\0calendar_heart\0skull_crossbones\0"
+    "notdef\0nfc_signal\0sliders_up\0trash_slash\0note_medical\0dog\0person_carry_box\0child_rifle\0icicles\0"
+    "phone_slash\0face_rolling_eyes\0list_squares\0inbox_arrow_down\0chess_board\0mars\0lamp\0heart_circle_check\0"
+    "bold\0face_explode\0aws\0lightbulb_exclamation_on\0brain_circuit\0racquet\0q\0person_running\0tornado\0"
+    "golf_ball\0option\0hands_heart\0arrow_down_9_1\0hands_bound\0user_doctor_hair_long\0shop_slash\0bed_pulse\0"
+    "radio_tuner\0bridge_lock\0pen_clip_slash\0mountain_sun\0square_arrow_up\0utility_pole\0caravan\0album_collection_circle_user\0"
+    "smog\0calendar_alt\0signal_good\0wordpress\0party_bell\0book_spells\0arrow_right_to_arc\0bath\0fulcrum\0"
+    "arrows_to_dotted_line\0bars_filter\0comment_middle_top\0ns8\0laugh_squint\0times\0arrow_down_to_dotted_line\0"
+    "gofore\0synagogue\0location_arrow\0debug\0amazon_pay\0wheat_awn_slash\0microphone_circle_alt\0cherries\0"
+    "location_circle\0snowman\0pen\0circle_waveform_lines\0chrome\0at\0sandwich\0user_clock\0square_star\0"
+    "magnet\0file_csv\0turkish_lira_sign\0bowling_ball_pin\0tachometer\0canadian_maple_leaf\0pump_soap\0webcam_slash\0"
+    "tachometer_alt_fast\0circle_chevron_up\0receipt\0shapes\0window_maximize\0audio_description_slash\0album_collection_circle_plus\0"
+    "jug\0bell_school\0transporter_4\0kickstarter_k\0barn_silo\0shield_alt\0cat_space\0map_marker\0face_mask\0"
+    "chart_candlestick\0cloud_rainbow\0tablets\0sad_tear\0files_medical\0surprise\0circle_s\0tachometer_alt_fastest\0"
+    "location_pen\0face_smile_upside_down\0thought_bubble\0linkedin_in\0square_root_alt\0hospital_wide\0input_numeric\0"
+    "truck_ramp_box\0image\0house_person_leave\0photo_film_music\0asl_interpreting\0bridge_circle_xmark\0stop\0"
+    "square_6\0arrow_from_top\0truck_field\0arrows_down_to_people\0ellipsis_stroke\0square_phone_flip\0sickle\0"
+    "concierge_bell\0gauge_simple\0comment_alt_music\0calendars\0list_ol\0arrows_left_right_to_line\0cart_shopping_fast\0"
+    "face_expressionless\0chocolate_bar\0tram\0dove\0pen_circle\0beer_mug_empty\0scalpel_line_dashed\0coffee_beans\0"
+    "chart_waterfall\0cc_amazon_pay\0headphones_alt\0lock\0i_cursor\0envelope_square\0money_bill_transfer\0"
+    "creative_commons_zero\0sack_dollar\0arrow_alt_square_up\0comment_alt_slash\0volume_slash\0square_wine_glass_crack\0"
+    "ticket_simple\0square_parking_slash\0corn\0dolly_flatbed\0smoking\0brightness_low\0cart_flatbed_empty\0"
+    "arrows_up_to_line\0code\0_1\0comment_alt_plus\0battery_quarter\0tickets_airline\0screwdriver\0cc_jcb\0"
+    "brush\0rectangle_history\0frog\0cart_circle_exclamation\0stars\0brightness\0curling\0hand_dots\0radio\0"
+    "signing\0google_wallet\0border_center_v\0envelope_circle\0inbox_full\0face_angry\0coin_front\0face_thinking\0"
+    "message_middle\0chalkboard_user\0xing\0ruler_horizontal\0hand_love\0parachute_box\0spray_can_sparkles\0"
+    "phone_outgoing\0area_chart\0train_track\0face_hand_over_mouth\0_500px\0money_check_edit\0comment\0face_zany\0"
+    "pipe_collar\0circle_o\0scanner\0deezer\0cart_arrow_down\0trash_xmark\0book_quran\0sensor_on\0comment_pen\0"
+    "house_chimney_user\0reddit\0tree_alt\0instagram_square\0stopwatch\0sync_alt\0left_long\0slash_forward\0"
+    "boot\0caret_up\0sort\0piano_keyboard\0pager\0yen\0arrow_turn_up\0compress_alt\0suitcase_medical\0font_awesome\0"
+    "sun\0centercode\0eject\0tachometer_alt_slow\0phone_intercom\0id_card\0wind_turbine\0creative_commons_sampling\0"
+    "balloons\0arrow_left_rotate\0person_dress\0swords\0heart_pulse\0_6\0person_simple\0grip_dots_vertical\0"
+    "user_alt\0viacoin\0house_chimney_blank\0parking\0telescope\0house_medical_circle_check\0expand_arrows_alt\0"
+    "venus_double\0clone\0face_surprise\0search_dollar\0pound_sign\0comment_sms\0glass_empty\0audio_description\0"
+    "arrow_down_triangle_square\0hand_fist\0chart_pyramid\0rabbit_fast\0deskpro\0arrow_square_down\0maximize\0"
+    "field_hockey\0circle_p\0bracket_square\0burger_fries\0sellcast\0explosion\0shower_down\0house_medical\0"
+    "map_marker_xmark\0itunes_note\0blinds_raised\0patreon\0face_weary\0user_doctor\0section\0badge_check\0"
+    "building_circle_xmark\0dna\0arrow_down_big_small\0bracket\0volleyball_ball\0print_magnifying_glass\0usps\0"
+    "dolly\0vent_damper\0chess_knight_alt\0sort_numeric_up\0clapperboard\0tugrik_sign\0odnoklassniki_square\0"
+    "female\0droplet_degree\0square_phone_hangup\0repeat\0tractor\0cloud_bolt_sun\0circle_f\0drivers_license\0"
+    "face_grin_squint\0image_slash\0house_chimney_window\0user_large_slash\0sign_in_alt\0file_pdf\0heart_circle_bolt\0"
+    "compress\0book_user\0screencast\0location\0signal_4\0road_spikes\0portal_exit\0portal_enter\0skiing\0"
+    "doughnut\0volume_mute\0hand_middle_finger\0image_polaroid_user\0heart_crack\0fingerprint\0message_exclamation\0"
+    "cmplid\0laptop_house\0binary_slash\0_2\0bacterium\0panorama\0hornbill\0clock_ten\0books\0rotate\0traffic_light_stop\0"
+    "command\0vihara\0blueberries\0person_rifle\0sunrise\0right_long\0unsplash\0arrows_to_line\0box_full\0"
+    "face_grin_hearts\0file_signature\0car_mirrors\0camera_alt\0building_wheat\0stack_overflow\0octagon_check\0"
+    "sort_alpha_down_alt\0circle_arrow_up_right\0floppy_disk_circle_xmark\0album_collection\0node_js\0chair_office\0"
+    "flashlight\0trash_can_check\0cc_mastercard\0car_garage\0tower_cell\0hat_cowboy\0plane_tail\0folder_user\0"
+    "money_bill_simple_wave\0acorn\0pen_field\0expeditedssl\0money_check_dollar_pen\0person_snowmobiling\0"
+    "squirrel\0rotate_backward\0schlix\0door_open\0venus\0plus_minus\0heart_broken\0plant_wilt\0police_box\0"
+    "comment_alt_lines\0ear_deaf\0poo_storm\0face_tongue_money\0message\0pen_nib\0mask_luchador\0circle_quarter\0"
+    "diagram_next\0circle_down_right\0diamond_turn_right\0osi\0map_marker_exclamation\0jet_fighter\0bitbucket\0"
+    "autoprefixer\0face_tired\0circle_chevron_left\0watchman_monitoring\0peso_sign\0fire_hydrant\0bird\0sleigh\0"
+    "motorcycle\0folder\0gauge\0saxophone_fire\0volume_off\0comments\0font\0tablet_alt\0circle_left\0taco\0"
+    "space_station_moon_construction\0messages_question\0car\0arrow_circle_left\0users_rectangle\0fa_try\0"
+    "arrow_right_to_city\0directions\0face_pensive\0diagram_sankey\0file_award\0star_sharp_half_stroke\0megaport\0"
+    "child_reaching\0right_to_line\0head_side_brain\0steam_square\0shield_halved\0arrow_down_from_line\0dice_one\0"
+    "gears\0map_marker_smile\0sliders_v\0glass_whiskey_rocks\0car_circle_bolt\0money_check_edit_alt\0disease\0"
+    "chevrons_left\0signal_strong\0adversal\0face_sleeping\0_00\0studiovinari\0castle\0person_skiing_nordic\0"
+    "calendar_day\0engine\0panel_fire\0images_user\0sprout\0arrow_alt_circle_left\0arrow_up_from_square\0plane_lock\0"
+    "tag\0toilet_paper\0image_user\0hand_point_down\0bridge_circle_check\0compact_disc\0integral\0free_code_camp\0"
+    "copy\0shield_xmark\0pallet_box\0photo_film\0bacon\0badge\0desktop_alt\0timeline_arrow\0_100\0circle_location_arrow\0"
+    "smoking_ban\0cart_flatbed\0cut\0file_waveform\0ruler_combined\0caret_square_right\0border_bottom_right\0"
+    "floppy_disks\0square_ampersand\0tasks\0square_u\0clock_two_thirty\0trillium\0hose\0twitch\0trash_can_clock\0"
+    "ellipsis_h_alt\0crystal_ball\0air_conditioner\0trash_plus\0droplet\0garage\0square_sliders_vertical\0"
+    "newspaper\0book_dead\0arrow_right_from_bracket\0square_info\0person_burst\0th_large\0sticker_mule\0clipboard_list_check\0"
+    "hospital\0circle_u\0heartbeat\0maxcdn\0square_chevron_left\0moon_stars\0tooth\0stroopwafel\0mug_tea\0"
+    "thermometer_1\0lock_alt\0arrow_trend_down\0heat\0wpbeginner\0files\0people_roof\0face_zipper\0trash_can_arrow_turn_left\0"
+    "message_pen\0bugs\0pear\0hourglass_2\0uniform_martial_arts\0credit_card_blank\0face_grin_tears\0meh_rolling_eyes\0"
+    "guilded\0paperclip_vertical\0octagon_exclamation\0grid_dividers\0edge_legacy\0black_tie\0lightbulb\0laptop_medical\0"
+    "circle_heart\0square_o\0eclipse\0instagram\0stairs\0sprinkler_ceiling\0redhat\0cloud_snow\0house_flood_water\0"
+    "tenge_sign\0light_switch_on\0shopping_basket\0cloud_slash\0file_plus\0fill_drip\0notes_medical\0wifi_fair\0"
+    "soccer_ball\0lock_keyhole\0container_storage\0grin_wink\0person_breastfeeding\0eur\0fighter_jet\0hot_tub\0"
+    "pump\0arrow_down_from_dotted_line\0diagram_lean_canvas\0donate\0not_equal\0route\0whistle\0elephant\0"
+    "clock_eleven_thirty\0fondue_pot\0message_plus\0file_circle_xmark\0fast_forward\0mask_ventilator\0sort_size_up\0"
+    "arrow_from_left\0circle_6\0flushed\0projector\0arrow_up_square_triangle\0the_red_yeti\0lightbulb_slash\0"
+    "football_ball\0mouse_pointer\0coffee_bean\0beer\0blinds\0palette_boxes\0display\0phoenix_squadron\0cocktail\0"
+    "temperature_snow\0object_union\0chart_tree_map\0file_user\0chevron_circle_left\0face_worried\0cloud_meatball\0"
+    "road_circle_check\0message_check\0arrow_up_9_1\0trumpet\0first_order\0watch_apple\0oil_can_drip\0comments_alt_dollar\0"
+    "circle_notch\0star_and_crescent\0baseball_bat_ball\0face_smile_wink\0hourglass_1\0location_xmark\0book_bookmark\0"
+    "card_diamond\0gun_squirt\0raindrops\0trophy_star\0toilet_paper_reverse\0arrow_alt_to_bottom\0bowl_scoops\0"
+    "chalkboard_teacher\0bimobject\0apostrophe\0head_side_mask\0arrow_right_long_to_line\0discord\0circle_r\0"
+    "dewpoint\0tally_5\0thermometer_three_quarters\0circle_a\0chart_area\0sparkles\0comment_alt_check\0sunset\0"
+    "file_medical\0star_circle\0bowling_ball\0file_powerpoint\0vacuum\0book_bible\0umbrella_alt\0manhole\0"
+    "badminton\0avianex\0tally_1\0circle_right\0_360_degrees\0person_skiing\0screwdriver_wrench\0wine_bottle\0"
+    "thumbtack\0rocket\0thermometer_3\0angle_right\0location_dot\0water_lower\0chart_line\0pizza_slice\0user_music\0"
+    "thermometer_0\0house_person_depart\0calendar_download\0cucumber\0user_headset\0stopwatch_20\0k\0square_g\0"
+    "pool_8_ball\0phone_office\0chevron_circle_up\0pinterest_p\0h4\0salt_shaker\0hexagon_xmark\0squarespace\0"
+    "pumpkin\0comment_alt_minus\0slack_hash\0shield_plus\0money_bill_alt\0map_pin\0chart_radar\0screen_users\0"
+    "angles_down\0blind\0camera_movie\0clipboard_user\0teddy_bear\0jenkins\0card_club\0bug_slash\0chromecast\0"
+    "bridge_suspension\0cassette_vhs\0trees\0fort_awesome_alt\0yarn\0map_marked_alt\0arrow_up_from_dotted_line\0"
+    "times_to_slot\0hat_santa\0turkey\0dice_six\0book_arrow_right\0sunglasses\0file_contract\0upload\0kiss_wink_heart\0"
+    "chevron_up\0tiktok\0album\0comment_alt\0comment_question\0staff_aesculapius\0hand_horns\0cabin\0arrow_alt_to_top\0"
+    "glass_half\0suse\0grip_lines_vertical\0train_tram\0cupcake\0trophy_alt\0microphone_alt\0down_to_dotted_line\0"
+    "discourse\0meteor\0t\0question\0treasure_chest\0teletype\0info_square\0drumstick\0arrow_right_to_bracket\0"
+    "octagon_divide\0users_line\0user_tie_hair_long\0glass_citrus\0torah\0square_minus\0manat_sign\0chestnut\0"
+    "save_times\0calendar_lines_pen\0medapps\0wifi_2\0level_down_alt\0staff\0mars_stroke_h\0old_republic\0"
+    "share_all\0columns_3\0x\0gauge_med\0pen_nib_slash\0hurricane\0pen_swirl\0circle_2\0cloudflare\0trash_restore\0"
+    "ranking_star\0arrow_to_top\0mobile\0object_subtract\0road_circle_exclamation\0face_icicles\0pie_chart\0"
+    "folder_arrow_down\0save\0hashnode\0temperature_three_quarters\0sensor_triangle_exclamation\0multiply\0"
+    "display_arrow_down\0fire_alt\0horizontal_rule\0microsoft\0vest_patches\0ferry\0user_secret\0circle_minus\0"
+    "mizuni\0smile_plus\0gifts\0arrow_up_from_arc\0user_doctor_hair\0map_marker_slash\0pallet_alt\0rectangle_ad\0"
+    "circle_dollar\0person_arrow_up_from_line\0vote_nay\0note\0triangle_music\0comment_arrow_up_right\0user_nurse_hair_long\0"
+    "repeat_1\0fire_flame_curved\0mosquito_net\0cloud_plus\0book_blank\0square_k\0gopuram\0snowflakes\0file_clipboard\0"
+    "cat\0arrows_down_to_line\0club\0taxi_bus\0sigma\0play_circle\0user_robot_xmarks\0dog_leashed\0adn\0user_md\0"
+    "hand_spock\0nutritionix\0tombstone_blank\0tarp\0recycle\0bucket\0file_binary\0cc_visa\0meat\0sheqel\0"
+    "arrow_alt_right\0file_medical_alt\0ils\0magic\0conveyor_belt_empty\0earlybirds\0won\0helicopter_symbol\0"
+    "popsicle\0pig\0temperature_arrow_up\0quotes\0circle_i\0grip_vertical\0down\0bandage\0toilet_paper_under_slash\0"
+    "face_viewfinder\0flag_swallowtail\0paragraph\0banjo\0users_crown\0temperature_high\0mobile_notch\0head_side_headphones\0"
+    "amp_guitar\0circle_exclamation\0kip_sign\0internet_explorer\0sort_amount_down_alt\0spider\0down_right\0"
+    "x_ray\0closed_captioning\0file_arrow_up\0face_persevering\0mobile_alt\0money_bill_simple\0ellipsis_v\0"
+    "truck_plow\0plus_octagon\0e\0people_line\0location_crosshairs\0pills\0inr\0chess_king_alt\0volleyball\0"
+    "campfire\0arrow_down_a_z\0bed\0draft2digital\0codepen\0clock_eleven\0sort_asc\0dice_d10\0transformer_bolt\0"
+    "circle_arrow_up_left\0microphone_circle\0comments_alt\0circle_video\0scanner_gun\0user_tag\0h\0bluetooth\0"
+    "user_vneck_hair_long\0pan_frying\0circle_h\0_9\0circle_caret_right\0drone_alt\0mars_double\0lasso_sparkles\0"
+    "square_parking\0arrows_v\0code_branch\0circle_bolt\0stumbleupon_circle\0caret_circle_up\0external_link\0"
+    "sun_plant_wilt\0angular\0signal_fair\0users_slash\0venus_mars\0code_commit\0sign_out\0square_d\0arrows_cross\0"
+    "ioxhost\0fire_flame_simple\0circle_plus\0goodreads_g\0glass_water\0circle_camera\0arrows_alt_v\0mobile_screen\0"
+    "shutters\0booth_curtain\0hotdog\0dumbbell\0mobile_screen_button\0circle_three_quarters\0flipboard\0file_lock\0"
+    "medium\0car_on\0circle_5\0percentage\0allergies\0calendar_xmark\0people_carry_box\0arrows\0mortar_board\0"
+    "glass_martini\0vuejs\0boombox\0napster\0truck_medical\0viruses\0diaspora\0square_sliders\0battery_low\0"
+    "grin\0alien_8bit\0yin_yang\0desktop_medical\0red_river\0glove_boxing\0face_sunglasses\0tape\0triangle_person_digging\0"
+    "bar_chart\0quidditch\0torii_gate\0cauldron\0sheqel_sign\0minus_circle\0deafness\0genderless\0lollipop\0"
+    "hire_a_helper\0dice_d4\0map\0folder_heart\0tachometer_average\0square_share_nodes\0file_minus\0circle_xmark\0"
+    "sass\0linux\0qq\0speaker_deck\0computer_classic\0hand_sparkles\0gratipay\0temperature_frigid\0shield_cross\0"
+    "ebay\0microchip_ai\0hand_holding_usd\0game_board_simple\0beer_foam\0location_question\0landmark_alt\0"
+    "plane_up\0cart_flatbed_boxes\0people_dress\0twitter_square\0person_harassing\0house_user\0check_square\0"
+    "times_octagon\0message_medical\0utensils_alt\0train_subway_tunnel\0bracket_curly_left\0chess_queen_alt\0"
+    "bookmark_slash\0comment_edit\0kaaba\0hospital_alt\0desktop_code\0hourglass\0key\0face_grin\0trash_arrow_turn_left\0"
+    "cc_diners_club\0skyatlas\0hat_wizard\0joomla\0apple_crate\0square_left\0feed\0quote_left\0meetup\0screenshot\0"
+    "hand_pointer\0volume_up\0sidebar\0cloud_download\0inventory\0cabinet_filing\0engine_warning\0bed_bunk\0"
+    "burger_glass\0rectangle_vertical\0right_from_line\0building_circle_check\0lamp_desk\0ladder_water\0robot_astromech\0"
+    "seedling\0palette\0camera_web_slash\0galaxy\0folder_minus\0plane_engines\0map_marker_times\0message_captions\0"
+    "space_station_moon_alt\0circle_down\0oven\0maki_roll\0swift\0compress_arrows_alt\0cloud_showers_heavy\0"
+    "file_invoice_dollar\0wheat_slash\0utensil_fork\0scale_balanced\0tire_flat\0curling_stone\0circle_dot\0"
+    "square_font_awesome\0whatsapp\0folder_music\0opera\0camera_home\0paragraph_rtl\0lightbulb_dollar\0route_interstate\0"
+    "arrow_down_small_big\0oil_can\0android\0grid_2_plus\0up_from_bracket\0circle_up_left\0moon\0thumb_tack\0"
+    "handshake_alt\0digg\0rectangle_pro\0thumbs_down\0user_nurse\0long_arrow_alt_left\0vcard\0magic_wand_sparkles\0"
+    "face_spiral_eyes\0cake_slice\0golf_club\0speakers\0truck_ramp\0laptop_file\0teeth\0foursquare\0divide\0"
+    "angles_left\0trash_can_plus\0dial_high\0square_quarters\0pix\0bell_on\0circle_arrow_up\0sort_alpha_up\0"
+    "list_dropdown\0cloud_hail_mixed\0square_arrow_up_right\0share_from_square\0comment_alt_dots\0square_chevron_up\0"
+    "toilet\0sort_numeric_up_alt\0face_diagonal_mouth\0user_group\0glasses_alt\0border_center_h\0centos\0teletype_answer\0"
+    "sun_bright\0google_drive\0champagne_glasses\0gave_dandy\0temperature_hot\0archive\0orcid\0star_of_david\0"
+    "folder_download\0battery_slash\0google_plus_square\0cloudscale\0luchador_mask\0toolbox\0fort\0bowl_food\0"
+    "telegram\0hand_holding_box\0grin_squint_tears\0bullseye\0cedi_sign\0thunderstorm\0forklift\0speakap\0"
+    "user_pen\0bullseye_pointer\0stretcher\0money_bills_simple\0cloud_rain\0check_to_slot\0creative_commons_sampling_plus\0"
+    "tree_deciduous\0warehouse_alt\0hotjar\0user_large\0battery_4\0user_visor\0chart_simple_horizontal\0cricket\0"
+    "check_circle\0square_chevron_down\0cloudversify\0flatbread\0chess_rook_piece\0headset\0gem\0blackberry\0"
+    "docker\0repeat_alt\0face_relieved\0padlet\0supple\0arrows_minimize\0face_angry_horns\0building_user\0"
+    "starfighter_alt\0eyedropper\0arrow_circle_right\0earth_oceania\0utensils_slash\0home_lg_alt\0alicorn\0"
+    "users_between_lines\0scroll_ribbon\0paste\0video_handheld\0lock_open_alt\0envelopes_bulk\0meter\0coin\0"
+    "comment_exclamation\0file_video\0skiing_nordic\0mandolin\0file_heart\0first_order_alt\0safari\0van_shuttle\0"
+    "linode\0coffin\0check_double\0road\0conveyor_belt_boxes\0soft_serve\0tasks_alt\0rotate_forward\0file_export\0"
+    "hand_holding_skull\0dial_max\0diagram_previous\0square_y\0battery_exclamation\0bowling_pins\0walking\0"
+    "tilde\0cart_circle_check\0beer_mug\0book_copy\0sheet_plastic\0envelope_open\0money_check_alt\0kit_medical\0"
+    "hotel\0contact_card\0up_from_line\0sync\0houzz\0poll\0house_circle_check\0caret_square_up\0superpowers\0"
+    "th_list\0wand\0person_circle_exclamation\0toggle_on\0house_building\0clock_ten_thirty\0face_swear\0subtract\0"
+    "money_bill_trend_up\0child\0ramp_loading\0rebel\0institution\0piggy_bank\0map_marker_check\0trash_can_slash\0"
+    "face_smile_halo\0bars_sort\0hand\0draw_square\0temperature_2\0book_reader\0nfc_directional\0microphone_lines\0"
+    "box_taped\0vimeo\0glide_g\0face_beam_hand_over_mouth\0home_user\0gauge_circle_minus\0arrow_alt_square_left\0"
+    "signal_bars_slash\0battery_1\0itunes\0up_down_left_right\0weibo\0ubuntu\0hourglass_3\0plus_large\0chess_pawn_alt\0"
+    "message_middle_top\0face_pleading\0sensor_cloud\0lips\0person_half_dress\0fonticons_fi\0hat_winter\0deer_rudolph\0"
+    "clock_one_thirty\0face_sad_tear\0function\0truck_monster\0face_anxious_sweat\0house_flood\0circle_c\0"
+    "chevrons_up\0laptop\0person_biking\0head_side\0pineapple\0shoe_prints\0cowbell_more\0video_arrow_up_right\0"
+    "sourcetree\0link_horizontal\0cloud_minus\0windows\0basket_shopping_simple\0meter_bolt\0sink\0indian_rupee\0"
+    "face_hand_peeking\0star_half_stroke\0clock_eight_thirty\0calendar_arrow_down\0running\0share\0bandcamp\0"
+    "bag_shopping\0vector_polygon\0sort_size_up_alt\0_4\0prescription_bottle_medical\0person_snowboarding\0"
+    "shelves_empty\0grin_tongue_squint\0burrito\0arrows_from_dotted_line\0vimeo_v\0cookie\0droplet_slash\0"
+    "comma\0arrow_up_long\0square_exclamation\0rabbit_running\0square_plus\0store_alt\0laptop_arrow_down\0"
+    "music_alt\0mars_and_venus\0calendar_days\0square_rss\0volume_medium\0apple\0caravan_simple\0display_slash\0"
+    "award\0utensil_spoon\0unlink\0expand_alt\0app_store_ios\0truck_bolt\0circle_caret_up\0arrow_up_right_from_square\0"
+    "parenthesis\0bahai\0square_p\0user_hair_mullet\0house_flood_water_circle_arrow_right\0location_pin_lock\0"
+    "envelope_open_dollar\0grin_tongue_wink\0corner\0square_divide\0microchip\0message_dots\0kerning\0khanda\0"
+    "folder_medical\0pie\0share_square\0filter_circle_dollar\0person_circle_question\0clarinet\0code_simple\0"
+    "paper_plane_alt\0users_medical\0arrow_alt_square_right\0phone_square\0square_arrow_up_left\0cotton_bureau\0"
+    "trash_can_undo\0fish_fins\0house_return\0scissors\0yen_sign\0mace\0cart_plus\0fork\0cc_paypal\0record_vinyl\0"
+    "ski_boot_ski\0peanuts\0radio_alt\0face_saluting\0file_circle_plus\0ellipsis_stroke_vertical\0boxes\0buildings\0"
+    "people_pants_simple\0circle_8\0clock_desk\0xmarks_lines\0staylinked\0hand_fingers_crossed\0message_slash\0"
+    "signal_alt_3\0face_confounded\0chart_line_down\0face_pouting\0cutlery\0file_magnifying_glass\0pizza\0"
+    "utensils\0square_nfi\0display_medical\0bell_school_slash\0square_terminal\0mouse\0face_cowboy_hat\0party_back\0"
+    "xmark_circle\0martini_glass_empty\0wifi_3\0waze\0hood_cloak\0square_poll_horizontal\0equals\0chess_queen\0"
+    "square_arrow_down_right\0ellipsis_vertical\0meter_droplet\0imdb\0battery_car\0candy_bar\0chevron_down\0"
+    "text_width\0microphone\0calendar_exclamation\0chain_broken\0dice\0ring\0can_food\0hand_heart\0list_alt\0"
+    "nfc_magnifying_glass\0bracket_round\0hammer\0lights_holiday\0tty_answer\0face_kiss\0intersection\0hill_avalanche\0"
+    "potato\0drumstick_bite\0add\0sort_alpha_down\0parking_circle\0hospitals\0retweet_alt\0bread_loaf\0forward_fast\0"
+    "bracket_round_right\0yoast\0wifi\0face_tissue\0square_up_right\0chart_bar\0magnifying_glass_minus\0credit_card\0"
+    "opencart\0page4\0rust\0globe_europe\0border_right\0presentation\0temperature_0\0folder_plus\0blinds_open\0"
+    "crutches\0salad\0bell\0airbnb\0snapchat\0traffic_cone\0phoenix_framework\0melon\0wine_glass_empty\0satellite\0"
+    "hard_hat\0chart_gantt\0arrow_down_short_wide\0children\0standard_definition\0arrow_to_bottom\0ballot_check\0"
+    "mill_sign\0deviantart\0draw_polygon\0tachometer_slowest\0house_chimney\0face_tongue_sweat\0file_alt\0"
+    "clipboard\0rings_wedding\0border_all\0hexagon_image\0subway\0tencent_weibo\0circle_e\0calendar_lines\0"
+    "podcast\0times_square\0triangle\0file_caret_up\0burger_soda\0shield_dog\0paintbrush_fine\0calendar_edit\0"
+    "scanner_keyboard\0credit_card_alt\0css3_alt\0chess_bishop_alt\0refresh\0google_plus\0pen_fancy\0binary_circle_check\0"
+    "gauge_simple_med\0bell_concierge\0bowl_scoop\0clock_seven\0sticky_note\0user_lock\0person_chalkboard\0"
+    "github\0building_flag\0snapchat_square\0chess_knight_piece\0uniregistry\0coin_vertical\0ship\0h6\0up_to_dotted_line\0"
+    "utensil_knife\0arrow_rotate_backward\0square_check\0reel\0parentheses\0square_9\0envira\0lastfm\0sort_size_down_alt\0"
+    "square_this_way_up\0block_brick_fire\0strikethrough\0coffee_pot\0circle_dashed\0sailboat\0images\0universal_access\0"
+    "trash_can\0inbox\0signal_alt_slash\0paint_brush_alt\0family_pants\0face_smile_beam\0snowmobile\0mistletoe\0"
+    "building_circle_exclamation\0chimney\0signal_stream_slash\0square_arrow_down_left\0pen_alt\0npm\0whiskey_glass\0"
+    "git_alt\0user_construction\0key_skeleton\0television\0angle\0signature_lock\0clouds_sun\0luchador\0seat_airline\0"
+    "sd_card\0d_and_d\0sort_numeric_desc\0award_simple\0chart_user\0pancakes\0spade\0face_downcast_sweat\0"
+    "flower\0face_smile_plus\0sort_up_down\0send_back\0signal_5\0arrow_down_right\0bowl_shaved_ice\0object_intersect\0"
+    "face_meh_blank\0chess_bishop_piece\0radiation\0face_scream\0basketball_hoop\0mitten\0send\0parking_slash\0"
+    "star_of_life\0arrow_up_from_bracket\0location_crosshairs_slash\0hat_hard\0dolly_box\0volume_control_phone\0";
+
+/// The offset of the name of every slot in the name pool
+inline constexpr uint32_t nameOffsets[nameCount] = {
+    0, 6, 22, 27, 46, 60, 68, 79, 93, 111, 123, 131,
+    136, 145, 159, 178, 187, 194, 213, 228, 239, 260, 276, 280,
+    289, 309, 327, 337, 359, 365, 375, 398, 415, 429, 443, 451,
+    462, 468, 474, 488, 496, 508, 512, 528, 535, 549, 557, 569,
+    590, 610, 625, 635, 653, 659, 669, 675, 688, 702, 721, 743,
+    769, 777, 783, 793, 797, 812, 830, 846, 863, 877, 888, 910,
+    920, 939, 955, 968, 987, 997, 1011, 1021, 1029, 1043, 1066, 1081,
+    1098, 1100, 1107, 1120, 1133, 1141, 1156, 1164, 1174, 1204, 1208, 1221,
+    1227, 1245, 1256, 1268, 1277, 1296, 1311, 1323, 1342, 1358, 1370, 1375,
+    1386, 1400, 1416, 1427, 1438, 1445, 1455, 1477, 1487, 1508, 1517, 1530,
+    1549, 1563, 1574, 1588, 1597, 1615, 1631, 1648, 1668, 1682, 1696, 1713,
+    1720, 1731, 1746, 1764, 1775, 1783, 1794, 1806, 1820, 1831, 1847, 1855,
+    1861, 1881, 1894, 1911, 1936, 1943, 1959, 1979, 1986, 1994, 2006, 2022,
+    2033, 2043, 2049, 2079, 2092, 2097, 2102, 2114, 2122, 2128, 2140, 2151,
+    2159, 2183, 2209, 2215, 2223, 2241, 2253, 2266, 2278, 2282, 2300, 2315,
+    2326, 2339, 2348, 2363, 2378, 2385, 2393, 2412, 2425, 2428, 2447, 2452,
+    2467, 2490, 2506, 2515, 2521, 2530, 2547, 2556, 2561, 2570, 2580, 2594,
+    2603, 2610, 2619, 2629, 2641, 2654, 2671, 2686, 2692, 2708, 2716, 2726,
+    2743, 2749, 2768, 2783, 2795, 2809, 2814, 2827, 2838, 2848, 2858, 2876,
+    2881, 2891, 2898, 2908, 2922, 2933, 2941, 2959, 2974, 2982, 2988, 3000,
+    3014, 3022, 3027, 3045, 3063, 3075, 3085, 3096, 3109, 3124, 3142, 3164,
+    3177, 3185, 3201, 3214, 3225, 3238, 3253, 3265, 3272, 3284, 3295, 3305,
+    3314, 3325, 3336, 3350, 3356, 3371, 3385, 3394, 3403, 3412, 3426, 3435,
+    3442, 3459, 3480, 3490, 3503, 3520, 3531, 3538, 3545, 3555, 3565, 3585,
+    3593, 3602, 3617, 3628, 3639, 3646, 3667, 3677, 3688, 3694, 3706, 3717,
+    3732, 3745, 3775, 3798, 3803, 3812, 3824, 3839, 3853, 3865, 3885, 3902,
+    3911, 3925, 3932, 3951, 3971, 3984, 3991, 3997, 4011, 4029, 4041, 4054,
+    4069, 4078, 4095, 4116, 4134, 4146, 4162, 4173, 4181, 4195, 4202, 4215,
+    4229, 4247, 4259, 4273, 4285, 4292, 4311, 4324, 4338, 4354, 4374, 4383,
+    4400, 4420, 4425, 4432, 4445, 4451, 4473, 4480, 4487, 4495, 4506, 4511,
+    4522, 4528, 4539, 4552, 4563, 4570, 4588, 4594, 4603, 4620, 4633, 4649,
+    4660, 4674, 4680, 4685, 4694, 4702, 4718, 4724, 4730, 4735, 4743, 4755,
+    4770, 4779, 4793, 4803, 4812, 4835, 4854, 4871, 4880, 4890, 4910, 4917,
+    4941, 4957, 4963, 4990, 5008, 5021, 5035, 5051, 5062, 5075, 5087, 5095,
+    5103, 5108, 5122, 5140, 5153, 5169, 5185, 5197, 5208, 5212, 5224, 5235,
+    5245, 5257, 5263, 5281, 5297, 5309, 5320, 5333, 5347, 5374, 5391, 5400,
+    5408, 5425, 5435, 5447, 5458, 5464, 5475, 5489, 5497, 5508, 5523, 5539,
+    5562, 5571, 5592, 5600, 5619, 5625, 5644, 5649, 5660, 5673, 5675, 5689,
+    5699, 5707, 5720, 5731, 5752, 5760, 5772, 5783, 5790, 5801, 5810, 5818,
+    5829, 5846, 5856, 5863, 5877, 5895, 5919, 5928, 5937, 5948, 5960, 5981,
+    6002, 6006, 6018, 6031, 6037, 6051, 6070, 6088, 6099, 6105, 6110, 6117,
+    6137, 6149, 6168, 6179, 6192, 6208, 6224, 6240, 6253, 6268, 6273, 6284,
+    6298, 6313, 6331, 6333, 6353, 6362, 6373, 6382, 6393, 6400, 6418, 6428,
+    6436, 6453, 6471, 6481, 6490, 6501, 6506, 6519, 6546, 6558, 6582, 6592,
+    6599, 6619, 6627, 6636, 6648, 6659, 6668, 6679, 6699, 6718, 6727, 6734,
+    6746, 6763, 6791, 6800, 6812, 6825, 6836, 6849, 6854, 6856, 6865, 6869,
+    6889, 6916, 6932, 6948, 6960, 6978, 7006, 7016, 7028, 7041, 7045, 7054,
+    7065, 7071, 7086, 7102, 7123, 7146, 7166, 7177, 7195, 7212, 7225, 7232,
+    7243, 7251, 7268, 7283, 7292, 7302, 7320, 7342, 7353, 7372, 7385, 7395,
+    7407, 7418, 7427, 7444, 7460, 7479, 7489, 7502, 7514, 7528, 7543, 7559,
+    7569, 7580, 7597, 7613, 7627, 7636, 7650, 7661, 7678, 7699, 7724, 7736,
+    7746, 7756, 7778, 7792, 7805, 7820, 7832, 7845, 7852, 7864, 7889, 7908,
+    7931, 7938, 7942, 7945, 7957, 7965, 7973, 7982, 7998, 8012, 8019, 8032,
+    8046, 8056, 8062, 8076, 8089, 8101, 8110, 8115, 8128, 8148, 8160, 8175,
+    8184, 8190, 8215, 8226, 8237, 8248, 8261, 8280, 8294, 8304, 8324, 8333,
+    8346, 8351, 8366, 8390, 8407, 8420, 8422, 8436, 8459, 8464, 8478, 8485,
+    8500, 8520, 8544, 8554, 8568, 8576, 8590, 8606, 8618, 8629, 8634, 8653,
+    8662, 8666, 8677, 8691, 8710, 8719, 8732, 8749, 8768, 8777, 8788, 8807,
+    8820, 8842, 8854, 8860, 8869, 8884, 8894, 8906, 8915, 8929, 8942, 8958,
+    8969, 8998, 9019, 9029, 9039, 9050, 9056, 9077, 9090, 9100, 9110, 9120,
+    9126, 9139, 9156, 9171, 9175, 9185, 9201, 9214, 9227, 9232, 9238, 9242,
+    9247, 9254, 9268, 9277, 9297, 9311, 9323, 9343, 9348, 9371, 9377, 9394,
+    9414, 9423, 9431, 9439, 9461, 9474, 9478, 9495, 9501, 9511, 9525, 9539,
+    9559, 9575, 9589, 9606, 9614, 9634, 9641, 9658, 9668, 9679, 9690, 9708,
+    9713, 9729, 9746, 9750, 9763, 9777, 9784, 9791, 9801, 9829, 9843, 9858,
+    9868, 9881, 9895, 9902, 9908, 9928, 9945, 9960, 9973, 9983, 9992, 10005,
+    10014, 10030, 10042, 10055, 10069, 10074, 10087, 10104, 10120, 10128, 10143, 10154,
+    10163, 10184, 10203, 10218, 10229, 10247, 10272, 10284, 10295, 10310, 10329, 10346,
+    10353, 10360, 10366, 10379, 10393, 10407, 10416, 10419, 10424, 10428, 10441, 10448,
+    10461, 10475, 10482, 10497, 10505, 10516, 10523, 10525, 10538, 10545, 10558, 10572,
+    10584, 10598, 10602, 10616, 10632, 10641, 10646, 10656, 10672, 10685, 10704, 10714,
+    10733, 10738, 10754, 10763, 10777, 10787, 10801, 10808, 10826, 10834, 10843, 10870,
+    10883, 10898, 10904, 10919, 10930, 10940, 10961, 10979, 10998, 11018, 11031, 11038,
+    11053, 11065, 11079, 11089, 11101, 11109, 11129, 11141, 11153, 11162, 11173, 11176,
+    11187, 11205, 11210, 11217, 11222, 11236, 11247, 11259, 11274, 11292, 11296, 11305,
+    11313, 11320, 11343, 11354, 11366, 11377, 11388, 11402, 11414, 11428, 11440, 11460,
+    11472, 11486, 11499, 11513, 11520, 11535, 11551, 11560, 11567, 11576, 11581, 11587,
+    11599, 11602, 11613, 11622, 11634, 11643, 11663, 11674, 11691, 11699, 11718, 11730,
+    11736, 11744, 11759, 11761, 11773, 11783, 11790, 11807, 11819, 11837, 11848, 11864,
+    11880, 11889, 11894, 11907, 11915, 11920, 11935, 11949, 11956, 11972, 11981, 11997,
+    12023, 12029, 12035, 12048, 12062, 12068, 12078, 12092, 12097, 12101, 12109, 12124,
+    12133, 12147, 12157, 12168, 12181, 12197, 12199, 12210, 12231, 12247, 12261, 12275,
+    12293, 12312, 12327, 12340, 12353, 12382, 12408, 12414, 12423, 12436, 12447, 12466,
+    12473, 12488, 12501, 12511, 12525, 12562, 12570, 12588, 12595, 12608, 12633, 12644,
+    12653, 12662, 12675, 12686, 12694, 12701, 12709, 12729, 12735, 12746, 12761, 12765,
+    12770, 12779, 12787, 12801, 12815, 12828, 12851, 12860, 12873, 12883, 12894, 12912,
+    12928, 12940, 12966, 12992, 13005, 13011, 13017, 13020, 13026, 13037, 13046, 13057,
+    13075, 13089, 13105, 13118, 13140, 13151, 13166, 13180, 13198, 13212, 13228, 13239,
+    13257, 13273, 13293, 13298, 13315, 13327, 13342, 13352, 13369, 13386, 13395, 13402,
+    13411, 13425, 13443, 13456, 13462, 13475, 13489, 13504, 13514, 13526, 13532, 13547,
+    13556, 13573, 13584, 13594, 13607, 13626, 13638, 13649, 13666, 13705, 13723, 13732,
+    13751, 13761, 13779, 13800, 13810, 13826, 13841, 13854, 13865, 13879, 13885, 13895,
+    13908, 13920, 13927, 13939, 13954, 13960, 13983, 14003, 14011, 14031, 14043, 14059,
+    14066, 14075, 14082, 14099, 14117, 14129, 14139, 14148, 14166, 14181, 14194, 14207,
+    14218, 14232, 14238, 14247, 14259, 14271, 14281, 14288, 14293, 14300, 14315, 14322,
+    14338, 14348, 14355, 14371, 14383, 14387, 14393, 14403, 14417, 14430, 14439, 14455,
+    14461, 14475, 14492, 14506, 14513, 14524, 14542, 14554, 14573, 14579, 14596, 14609,
+    14620, 14634, 14638, 14651, 14656, 14665, 14684, 14698, 14708, 14717, 14727, 14747,
+    14759, 14768, 14785, 14793, 14799, 14811, 14818, 14827, 14842, 14848, 14869, 14875,
+    14889, 14901, 14920, 14942, 14962, 14974, 14985, 14999, 15022, 15030, 15040, 15053,
+    15060, 15073, 15084, 15093, 15098, 15110, 15127, 15133, 15138, 15145, 15159, 15166,
+    15177, 15186, 15204, 15208, 15218, 15233, 15250, 15277, 15290, 15308, 15326, 15332,
+    15345, 15347, 15358, 15373, 15385, 15397, 15403, 15418, 15424, 15430, 15442, 15454,
+    15463, 15485, 15498, 15503, 15528, 15538, 15547, 15555, 15573, 15575, 15591, 15600,
+    15614, 15626, 15641, 15646, 15664, 15683, 15696, 15707, 15721, 15742, 15752, 15770,
+    15780, 15786, 15802, 15819, 15833, 15844, 15860, 15870, 15879, 15888, 15893, 15905,
+    15916, 15930, 15949, 15965, 15973, 15985, 15992, 16004, 16015, 16031, 16044, 16055,
+    16062, 16073, 16083, 16090, 16099, 16111, 16126, 16140, 16153, 16167, 16177, 16185,
+    16202, 16204, 16216, 16233, 16260, 16265, 16279, 16289, 16303, 16312, 16314, 16332,
+    16345, 16366, 16385, 16394, 16401, 16413, 16427, 16438, 16456, 16462, 16474, 16490,
+    16506, 16519, 16530, 16537, 16551, 16569, 16584, 16600, 16620, 16628, 16635, 16652,
+    16656, 16671, 16688, 16692, 16702, 16716, 16725, 16741, 16757, 16764, 16777, 16803,
+    16812, 16821, 16831, 16842, 16849, 16865, 16873, 16885, 16893, 16900, 16914, 16927,
+    16944, 16952, 16964, 16975, 16996, 16998, 17014, 17022, 17034, 17046, 17057, 17070,
+    17087, 17098, 17109, 17114, 17124, 17139, 17155, 17171, 17181, 17195, 17219, 17231,
+    17241, 17254, 17265, 17277, 17287, 17303, 17319, 17338, 17347, 17356, 17378, 17393,
+    17401, 17407, 17427, 17443, 17452, 17459, 17475, 17485, 17506, 17519, 17528, 17535,
+    17548, 17556, 17560, 17566, 17584, 17590, 17602, 17613, 17631, 17644, 17659, 17676,
+    17684, 17694, 17696, 17711, 17722, 17729, 17753, 17769, 17782, 17792, 17810, 17821,
+    17837, 17849, 17855, 17867, 17878, 17892, 17904, 17920, 17931, 17949, 17963, 17977,
+    17990, 18011, 18025, 18037, 18048, 18073, 18081, 18092, 18105, 18122, 18133, 18143,
+    18153, 18164, 18176, 18187, 18196, 18204, 18216, 18231, 18253, 18289, 18296, 18316,
+    18326, 18331, 18340, 18357, 18372, 18378, 18393, 18401, 18415, 18419, 18432, 18443,
+    18453, 18457, 18479, 18510, 18522, 18529, 18536, 18546, 18561, 18571, 18584, 18594,
+    18601, 18614, 18618, 18623, 18637, 18642, 18658, 18669, 18685, 18701, 18707, 18720,
+    18742, 18756, 18762, 18778, 18785, 18791, 18826, 18837, 18854, 18867, 18893, 18896,
+    18902, 18915, 18924, 18957, 18978, 18988, 19003, 19008, 19032, 19051, 19053, 19066,
+    19081, 19098, 19114, 19132, 19139, 19152, 19171, 19186, 19215, 19227, 19235, 19239,
+    19253, 19265, 19281, 19288, 19300, 19311, 19323, 19328, 19347, 19358, 19370, 19388,
+    19401, 19418, 19429, 19440, 19451, 19460, 19476, 19486, 19502, 19519, 19538, 19547,
+    19555, 19580, 19597, 19609, 19625, 19632, 19647, 19657, 19664, 19682, 19689, 19713,
+    19727, 19743, 19758, 19765, 19782, 19798, 19814, 19835, 19857, 19869, 19874, 19887,
+    19889, 19907, 19919, 19936, 19953, 19966, 19972, 19985, 19994, 20007, 20019, 20025,
+    20046, 20061, 20077, 20098, 20108, 20127, 20138, 20151, 20164, 20177, 20192, 20203,
+    20209, 20227, 20238, 20251, 20260, 20271, 20286, 20290, 20305, 20320, 20330, 20350,
+    20365, 20388, 20404, 20413, 20430, 20442, 20451, 20458, 20477, 20485, 20502, 20515,
+    20526, 20544, 20556, 20573, 20584, 20595, 20611, 20623, 20641, 20650, 20654, 20661,
+    20676, 20696, 20715, 20727, 20742, 20757, 20770, 20780, 20786, 20793, 20804, 20816,
+    20831, 20840, 20848, 20854, 20865, 20868, 20878, 20894, 20912, 20917, 20927, 20940,
+    20953, 20973, 20984, 20991, 21005, 21019, 21032, 21040, 21051, 21069, 21074, 21087,
+    21096, 21116, 21134, 21141, 21149, 21156, 21162, 21171, 21174, 21183, 21188, 21194,
+    21204, 21210, 21221, 21235, 21250, 21272, 21284, 21295, 21304, 21313, 21325, 21340,
+    21358, 21376, 21391, 21401, 21417, 21428, 21436, 21450, 21461, 21479, 21486, 21493,
+    21510, 21528, 21542, 21551, 21555, 21564, 21578, 21596, 21616, 21632, 21641, 21655,
+    21661, 21676, 21686, 21697, 21704, 21720, 21741, 21761, 21781, 21797, 21819, 21825,
+    21837, 21850, 21864, 21878, 21891, 21907, 21924, 21943, 21955, 21969, 21981, 21991,
+    21997, 22013, 22023, 22028, 22049, 22055, 22063, 22071, 22076, 22084, 22099, 22110,
+    22115, 22124, 22141, 22149, 22158, 22162, 22173, 22182, 22190, 22207, 22221, 22228,
+    22239, 22255, 22272, 22290, 22296, 22310, 22333, 22350, 22356, 22363, 22375, 22384,
+    22394, 22408, 22425, 22433, 22444, 22464, 22472, 22477, 22493, 22509, 22523, 22532,
+    22539, 22552, 22564, 22579, 22593, 22607, 22617, 22627, 22642, 22653, 22660, 22676,
+    22690, 22704, 22719, 22727, 22748, 22763, 22772, 22783, 22795, 22808, 22816, 22829,
+    22843, 22865, 22869, 22888, 22898, 22910, 22932, 22941, 22949, 22958, 22975, 22984,
+    22998, 23001, 23017, 23032, 23037, 23041, 23053, 23067, 23080, 23097, 23103, 23117,
+    23135, 23148, 23162, 23184, 23198, 23206, 23224, 23235, 23253, 23264, 23278, 23291,
+    23310, 23321, 23333, 23346, 23364, 23373, 23382, 23397, 23412, 23430, 23444, 23463,
+    23477, 23494, 23503, 23527, 23539, 23550, 23565, 23572, 23594, 23598, 23615, 23635,
+    23653, 23663, 23673, 23691, 23700, 23710, 23732, 23738, 23750, 23764, 23776, 23797,
+    23812, 23816, 23827, 23844, 23855, 23869, 23880, 23891, 23896, 23924, 23939, 23952,
+    23963, 23978, 23993, 24003, 24013, 24027, 24046, 24061, 24067, 24078, 24094, 24107,
+    24118, 24137, 24146, 24155, 24170, 24179, 24196, 24204, 24212, 24220, 24238, 24247,
+    24263, 24281, 24297, 24310, 24324, 24344, 24356, 24370, 24373, 24389, 24403, 24425,
+    24440, 24454, 24469, 24480, 24500, 24508, 24522, 24545, 24561, 24567, 24576, 24585,
+    24592, 24597, 24608, 24620, 24630, 24644, 24654, 24668, 24683, 24702, 24707, 24715,
+    24727, 24737, 24745, 24760, 24783, 24798, 24803, 24813, 24838, 24854, 24874, 24884,
+    24899, 24903, 24945, 24951, 24957, 24967, 24978, 24993, 25007, 25026, 25038, 25042,
+    25046, 25055, 25062, 25083, 25093, 25109, 25119, 25129, 25142, 25159, 25177, 25187,
+    25197, 25212, 25223, 25240, 25252, 25258, 25273, 25282, 25295, 25298, 25315, 25330,
+    25339, 25351, 25357, 25369, 25389, 25401, 25412, 25431, 25441, 25455, 25465, 25475,
+    25493, 25502, 25516, 25536, 25546, 25564, 25578, 25591, 25607, 25609, 25617, 25633,
+    25645, 25663, 25678, 25685, 25692, 25711, 25716, 25730, 25750, 25757, 25769, 25777,
+    25781, 25799, 25814, 25821, 25838, 25851, 25862, 25878, 25892, 25904, 25916, 25924,
+    25932, 25950, 25963, 25975, 25981, 25992, 26000, 26012, 26014, 26024, 26036, 26042,
+    26050, 26069, 26078, 26087, 26098, 26107, 26121, 26141, 26157, 26162, 26170, 26181,
+    26194, 26209, 26215, 26237, 26261, 26274, 26288, 26299, 26308, 26318, 26327, 26339,
+    26350, 26367, 26381, 26397, 26417, 26430, 26435, 26457, 26478, 26486, 26505, 26515,
+    26527, 26542, 26565, 26581, 26595, 26602, 26612, 26624, 26633, 26652, 26669, 26685,
+    26698, 26718, 26743, 26754, 26759, 26774, 26787, 26797, 26801, 26804, 26814, 26827,
+    26838, 26850, 26861, 26873, 26885, 26895, 26903, 26924, 26933, 26938, 26944, 26948,
+    26956, 26972, 26982, 26991, 27000, 27012, 27025, 27037, 27046, 27062, 27068, 27081,
+    27085, 27096, 27098, 27111, 27126, 27133, 27147, 27158, 27171, 27181, 27199, 27218,
+    27244, 27247, 27262, 27279, 27300, 27306, 27322, 27333, 27347, 27392, 27407, 27420,
+    27432, 27444, 27458, 27473, 27478, 27491, 27502, 27522, 27547, 27562, 27575, 27588,
+    27605, 27611, 27624, 27645, 27657, 27672, 27686, 27691, 27701, 27710, 27721, 27733,
+    27739, 27741, 27755, 27772, 27782, 27794, 27806, 27830, 27843, 27850, 27874, 27885,
+    27896, 27902, 27915, 27927, 27944, 27955, 27971, 27983, 28002, 28024, 28040, 28054,
+    28063, 28078, 28091, 28104, 28114, 28131, 28142, 28154, 28165, 28176, 28191, 28202,
+    28215, 28232, 28238, 28251, 28265, 28281, 28292, 28301, 28306, 28320, 28328, 28347,
+    28357, 28372, 28383, 28397, 28415, 28424, 28443, 28449, 28460, 28480, 28493, 28507,
+    28523, 28546, 28566, 28586, 28603, 28620, 28639, 28650, 28668, 28676, 28683, 28689,
+    28696, 28708, 28733, 28740, 28752, 28765, 28780, 28790, 28801, 28812, 28828, 28839,
+    28860, 28866, 28884, 28900, 28913, 28939, 28946, 28963, 28970, 28982, 28994, 29003,
+    29018, 29024, 29038, 29058, 29070, 29084, 29096, 29113, 29127, 29139, 29144, 29154,
+    29160, 29169, 29190, 29206, 29220, 29225, 29237, 29247, 29269, 29284, 29299, 29310,
+    29319, 29328, 29345, 29361, 29366, 29382, 29390, 29399, 29410, 29419, 29434, 29447,
+    29454, 29464, 29476, 29482, 29493, 29499, 29510, 29516, 29533, 29542, 29548, 29556,
+    29574, 29586, 29604, 29621, 29631, 29638, 29652, 29658, 29675, 29693, 29708, 29715,
+    29727, 29739, 29743, 29758, 29767, 29781, 29794, 29811, 29823, 29830, 29846, 29854,
+    29857, 29872, 29887, 29892, 29897, 29906, 29915, 29924, 29936, 29950, 29970, 29989,
+    29993, 30011, 30032, 30049, 30062, 30071, 30077, 30084, 30095, 30105, 30122, 30133,
+    30146, 30166, 30173, 30182, 30196, 30201, 30215, 30232, 30240, 30255, 30263, 30275,
+    30289, 30296, 30302, 30312, 30326, 30334, 30341, 30354, 30367, 30377, 30387, 30404,
+    30422, 30440, 30447, 30462, 30471, 30489, 30503, 30514, 30528, 30543, 30555, 30572,
+    30584, 30608, 30625, 30637, 30643, 30662, 30679, 30691, 30698, 30708, 30717, 30723,
+    30733, 30745, 30762, 30777, 30782, 30795, 30805, 30817, 30831, 30842, 30861, 30877,
+    30882, 30899, 30905, 30918, 30933, 30953, 30966, 30975, 30993, 30999, 31024, 31029,
+    31049, 31072, 31102, 31120, 31140, 31154, 31171, 31178, 31193, 31205, 31216, 31226,
+    31244, 31260, 31274, 31285, 31306, 31326, 31333, 31342, 31358, 31368, 31379, 31393,
+    31402, 31414, 31420, 31437, 31453, 31460, 31473, 31492, 31502, 31516, 31534, 31541,
+    31548, 31565, 31574, 31581, 31605, 31630, 31653, 31667, 31686, 31694, 31702, 31711,
+    31716, 31740, 31753, 31770, 31777, 31787, 31803, 31809, 31840, 31845, 31857, 31871,
+    31889, 31898, 31915, 31929, 31948, 31968, 31981, 31989, 31994, 32002, 32010, 32017,
+    32030, 32044, 32064, 32079, 32098, 32115, 32133, 32149, 32162, 32175, 32197, 32208,
+    32223, 32233, 32239, 32257, 32266, 32290, 32303, 32315, 32327, 32332, 32338, 32353,
+    32376, 32389, 32392, 32408, 32422, 32433, 32449, 32465, 32479, 32492, 32511, 32522,
+    32537, 32548, 32557, 32568, 32574, 32588, 32610, 32624, 32639, 32644, 32651, 32675,
+    32683, 32687, 32698, 32705, 32728, 32735, 32742, 32756, 32764, 32775, 32794, 32799,
+    32810, 32825, 32853, 32868, 32884, 32887, 32908, 32916, 32930, 32939, 32947, 32960,
+    32964, 32972, 32986, 32992, 32996, 33007, 33017, 33030, 33041, 33066, 33075, 33094,
+    33102, 33114, 33127, 33144, 33168, 33180, 33186, 33195, 33204, 33222, 33229, 33235,
+    33256, 33269, 33290, 33303, 33308, 33324, 33331, 33345, 33357, 33370, 33388, 33392,
+    33402, 33411, 33416, 33425, 33443, 33452, 33466, 33490, 33495, 33508, 33526, 33540,
+    33554, 33568, 33572, 33585, 33593, 33616, 33629, 33638, 33649, 33666, 33675, 33690,
+    33703, 33715, 33727, 33741, 33764, 33778, 33799, 33813, 33821, 33831, 33843, 33854,
+    33879, 33889, 33901, 33919, 33932, 33949, 33967, 33988, 34002, 34015, 34025, 34038,
+    34047, 34051, 34075, 34088, 34100, 34106, 34118, 34135, 34156, 34169, 34181, 34188,
+    34201, 34219, 34228, 34243, 34257, 34270, 34277, 34288, 34300, 34333, 34346, 34356,
+    34381, 34396, 34404, 34410, 34421, 34433, 34436, 34449, 34496, 34509, 34523, 34532,
+    34547, 34557, 34570, 34590, 34596, 34599, 34613, 34617, 34632, 34646, 34660, 34680,
+    34690, 34712, 34727, 34735, 34756, 34768, 34781, 34787, 34798, 34807, 34820, 34838,
+    34862, 34881, 34892, 34919, 34931, 34939, 34944, 34951, 34963, 34975, 34984, 34995,
+    35006, 35017, 35029, 35042, 35049, 35060, 35080, 35085, 35093, 35102, 35126, 35135,
+    35150, 35165, 35178, 35182, 35186, 35195, 35200, 35210, 35220, 35239, 35252, 35260,
+    35266, 35280, 35291, 35298, 35310, 35321, 35327, 35334, 35351, 35362, 35375, 35390,
+    35395, 35406, 35413, 35417, 35434, 35454, 35470, 35489, 35495, 35505, 35511, 35521,
+    35543, 35561, 35571, 35586, 35600, 35623, 35637, 35654, 35663, 35678, 35689, 35702,
+    35714, 35725, 35737, 35750, 35761, 35771, 35785, 35792, 35806, 35812, 35828, 35833,
+    35845, 35853, 35857, 35866, 35871, 35882, 35892, 35914, 35919, 35938, 35944, 35949,
+    35956, 35966, 35976, 35987, 36001, 36015, 36020, 36033, 36040, 36053, 36065, 36075,
+    36088, 36111, 36125, 36146, 36160, 36170, 36177, 36187, 36200, 36207, 36219, 36228,
+    36247, 36261, 36268, 36284, 36298, 36319, 36326, 36336, 36345, 36357, 36373, 36383,
+    36394, 36401, 36413, 36420, 36435, 36453, 36466, 36486, 36511, 36516, 36526, 36536,
+    36542, 36557, 36566, 36575, 36589, 36594, 36602, 36613, 36626, 36635, 36659, 36670,
+    36691, 36701, 36706, 36720, 36727, 36740, 36746, 36761, 36769, 36785, 36796, 36806,
+    36817, 36828, 36849, 36862, 36868, 36881, 36887, 36906, 36920, 36931, 36938, 36950,
+    36982, 37000, 37013, 37021, 37034, 37047, 37052, 37064, 37069, 37082, 37091, 37100,
+    37125, 37145, 37151, 37164, 37176, 37198, 37220, 37228, 37241, 37256, 37273, 37280,
+    37291, 37302, 37314, 37327, 37331, 37348, 37360, 37368, 37380, 37398, 37411, 37428,
+    37440, 37445, 37450, 37469, 37474, 37487, 37491, 37516, 37530, 37538, 37540, 37555,
+    37563, 37573, 37580, 37592, 37607, 37619, 37641, 37652, 37662, 37674, 37686, 37701,
+    37714, 37730, 37743, 37751, 37780, 37785, 37798, 37810, 37820, 37831, 37843, 37862,
+    37867, 37875, 37897, 37909, 37928, 37932, 37945, 37951, 37977, 37984, 37994, 38009,
+    38015, 38026, 38042, 38064, 38073, 38089, 38097, 38101, 38123, 38130, 38133, 38142,
+    38153, 38165, 38172, 38181, 38199, 38216, 38227, 38247, 38257, 38270, 38290, 38308,
+    38316, 38323, 38339, 38363, 38392, 38396, 38408, 38422, 38436, 38446, 38457, 38467,
+    38478, 38488, 38506, 38520, 38528, 38537, 38551, 38560, 38569, 38592, 38605, 38628,
+    38643, 38655, 38671, 38685, 38699, 38714, 38720, 38739, 38756, 38773, 38793, 38798,
+    38807, 38822, 38834, 38856, 38872, 38890, 38897, 38912, 38925, 38943, 38953, 38961,
+    38987, 39006, 39026, 39040, 39045, 39050, 39061, 39076, 39096, 39109, 39125, 39139,
+    39154, 39159, 39168, 39184, 39204, 39226, 39238, 39258, 39276, 39289, 39313, 39327,
+    39348, 39353, 39367, 39375, 39390, 39409, 39427, 39432, 39435, 39452, 39468, 39484,
+    39496, 39503, 39509, 39527, 39532, 39556, 39562, 39573, 39581, 39591, 39597, 39605,
+    39619, 39635, 39651, 39662, 39673, 39684, 39698, 39713, 39729, 39734, 39751, 39761,
+    39775, 39794, 39809, 39820, 39832, 39853, 39860, 39877, 39885, 39895, 39907, 39916,
+    39924, 39931, 39947, 39959, 39970, 39980, 39992, 40011, 40018, 40027, 40044, 40054,
+    40063, 40073, 40087, 40092, 40101, 40106, 40121, 40127, 40131, 40145, 40158, 40175,
+    40188, 40192, 40203, 40209, 40229, 40244, 40252, 40265, 40291, 40300, 40318, 40331,
+    40338, 40350, 40353, 40367, 40386, 40395, 40403, 40423, 40431, 40441, 40468, 40486,
+    40499, 40505, 40519, 40533, 40544, 40556, 40568, 40586, 40613, 40623, 40637, 40649,
+    40657, 40675, 40684, 40697, 40706, 40721, 40734, 40743, 40753, 40765, 40779, 40796,
+    40808, 40822, 40830, 40841, 40853, 40861, 40873, 40895, 40899, 40920, 40928, 40944,
+    40967, 40972, 40978, 40990, 41007, 41023, 41036, 41048, 41069, 41076, 41091, 41111,
+    41118, 41126, 41141, 41150, 41166, 41183, 41195, 41216, 41233, 41245, 41254, 41272,
+    41281, 41291, 41302, 41311, 41320, 41332, 41344, 41357, 41364, 41373, 41385, 41404,
+    41424, 41436, 41448, 41468, 41475, 41488, 41501, 41504, 41514, 41523, 41532, 41542,
+    41548, 41555, 41574, 41582, 41589, 41601, 41614, 41622, 41633, 41642, 41657, 41666,
+    41683, 41698, 41710, 41721, 41736, 41751, 41765, 41785, 41807, 41832, 41849, 41857,
+    41870, 41881, 41897, 41911, 41922, 41933, 41944, 41955, 41967, 41990, 41996, 42006,
+    42019, 42042, 42062, 42071, 42087, 42094, 42104, 42110, 42121, 42134, 42145, 42156,
+    42174, 42183, 42193, 42211, 42219, 42227, 42241, 42256, 42269, 42287, 42306, 42310,
+    42333, 42345, 42355, 42368, 42379, 42399, 42419, 42429, 42442, 42447, 42454, 42465,
+    42472, 42478, 42493, 42504, 42513, 42518, 42529, 42541, 42546, 42578, 42596, 42600,
+    42618, 42634, 42641, 42661, 42672, 42685, 42700, 42711, 42734, 42743, 42758, 42772,
+    42788, 42801, 42815, 42836, 42845, 42851, 42868, 42878, 42898, 42914, 42935, 42943,
+    42957, 42971, 42980, 42994, 42998, 43011, 43018, 43039, 43052, 43059, 43070, 43082,
+    43089, 43111, 43132, 43143, 43147, 43160, 43171, 43187, 43207, 43220, 43229, 43244,
+    43249, 43262, 43273, 43284, 43290, 43296, 43308, 43323, 43328, 43350, 43362, 43375,
+    43379, 43393, 43408, 43427, 43447, 43460, 43477, 43483, 43492, 43509, 43518, 43523,
+    43530, 43546, 43561, 43574, 43590, 43601, 43609, 43616, 43640, 43650, 43660, 43685,
+    43697, 43710, 43719, 43732, 43753, 43762, 43771, 43781, 43788, 43808, 43819, 43825,
+    43837, 43845, 43859, 43868, 43885, 43890, 43901, 43907, 43919, 43931, 43957, 43969,
+    43974, 43979, 43991, 44012, 44030, 44046, 44063, 44071, 44090, 44110, 44124, 44136,
+    44146, 44156, 44171, 44184, 44193, 44201, 44211, 44218, 44236, 44243, 44254, 44272,
+    44283, 44299, 44315, 44327, 44337, 44347, 44361, 44371, 44383, 44396, 44414, 44424,
+    44445, 44449, 44461, 44469, 44474, 44502, 44522, 44529, 44539, 44545, 44553, 44562,
+    44582, 44593, 44606, 44624, 44637, 44653, 44666, 44682, 44691, 44699, 44709, 44734,
+    44747, 44763, 44777, 44791, 44803, 44808, 44815, 44829, 44837, 44854, 44863, 44880,
+    44893, 44908, 44918, 44938, 44951, 44966, 44984, 44998, 45011, 45019, 45031, 45043,
+    45056, 45076, 45089, 45107, 45125, 45141, 45153, 45168, 45182, 45195, 45206, 45216,
+    45228, 45249, 45269, 45281, 45300, 45310, 45321, 45336, 45361, 45369, 45378, 45387,
+    45395, 45422, 45431, 45442, 45451, 45469, 45476, 45489, 45501, 45514, 45530, 45537,
+    45548, 45561, 45569, 45579, 45587, 45595, 45608, 45621, 45635, 45654, 45666, 45676,
+    45683, 45697, 45709, 45722, 45734, 45745, 45757, 45768, 45782, 45802, 45820, 45829,
+    45842, 45855, 45857, 45866, 45878, 45891, 45909, 45921, 45924, 45936, 45950, 45962,
+    45970, 45988, 45999, 46011, 46026, 46034, 46046, 46059, 46071, 46077, 46090, 46105,
+    46116, 46124, 46134, 46144, 46155, 46173, 46186, 46192, 46209, 46214, 46229, 46255,
+    46269, 46279, 46286, 46295, 46312, 46323, 46337, 46344, 46360, 46371, 46378, 46384,
+    46396, 46413, 46431, 46442, 46448, 46465, 46476, 46481, 46501, 46512, 46520, 46531,
+    46546, 46566, 46576, 46583, 46585, 46594, 46609, 46618, 46630, 46640, 46663, 46678,
+    46689, 46708, 46721, 46727, 46740, 46751, 46760, 46771, 46790, 46798, 46805, 46820,
+    46826, 46840, 46853, 46863, 46873, 46875, 46885, 46899, 46909, 46919, 46928, 46939,
+    46953, 46966, 46979, 46986, 47002, 47026, 47039, 47049, 47067, 47072, 47081, 47108,
+    47136, 47145, 47164, 47173, 47189, 47199, 47212, 47218, 47230, 47243, 47250, 47261,
+    47267, 47285, 47302, 47319, 47330, 47343, 47357, 47383, 47392, 47397, 47412, 47435,
+    47456, 47465, 47483, 47496, 47507, 47518, 47527, 47535, 47546, 47561, 47565, 47585,
+    47590, 47599, 47605, 47617, 47635, 47647, 47651, 47659, 47670, 47682, 47698, 47703,
+    47711, 47718, 47730, 47738, 47743, 47750, 47766, 47783, 47787, 47793, 47813, 47824,
+    47828, 47846, 47855, 47859, 47880, 47887, 47896, 47910, 47915, 47923, 47948, 47964,
+    47981, 47991, 47997, 48009, 48026, 48039, 48060, 48071, 48090, 48099, 48117, 48138,
+    48145, 48156, 48162, 48180, 48194, 48211, 48222, 48240, 48251, 48262, 48275, 48277,
+    48289, 48309, 48315, 48319, 48334, 48345, 48354, 48369, 48373, 48387, 48395, 48408,
+    48417, 48426, 48443, 48464, 48482, 48495, 48508, 48520, 48529, 48531, 48541, 48562,
+    48573, 48582, 48585, 48604, 48614, 48626, 48641, 48656, 48665, 48677, 48689, 48708,
+    48724, 48738, 48753, 48761, 48773, 48785, 48796, 48808, 48817, 48826, 48839, 48847,
+    48865, 48877, 48889, 48901, 48915, 48928, 48942, 48951, 48965, 48972, 48981, 49002,
+    49024, 49034, 49044, 49051, 49058, 49067, 49078, 49088, 49103, 49120, 49127, 49140,
+    49154, 49160, 49168, 49176, 49190, 49198, 49207, 49222, 49234, 49239, 49250, 49259,
+    49275, 49285, 49298, 49314, 49319, 49343, 49353, 49363, 49374, 49383, 49395, 49408,
+    49417, 49428, 49437, 49451, 49459, 49463, 49476, 49495, 49514, 49525, 49538, 49543,
+    49549, 49552, 49565, 49582, 49596, 49605, 49624, 49637, 49642, 49655, 49672, 49690,
+    49700, 49718, 49731, 49740, 49759, 49772, 49787, 49804, 49815, 49828, 49842, 49858,
+    49871, 49891, 49910, 49926, 49941, 49954, 49960, 49973, 49986, 49996, 50000, 50010,
+    50032, 50047, 50056, 50067, 50074, 50086, 50098, 50103, 50114, 50121, 50132, 50145,
+    50155, 50163, 50178, 50188, 50203, 50218, 50227, 50240, 50259, 50275, 50297, 50307,
+    50320, 50336, 50345, 50353, 50370, 50377, 50390, 50404, 50421, 50438, 50461, 50473,
+    50478, 50488, 50494, 50514, 50534, 50554, 50566, 50579, 50594, 50604, 50618, 50629,
+    50649, 50658, 50671, 50677, 50689, 50703, 50720, 50737, 50758, 50766, 50774, 50786,
+    50802, 50817, 50822, 50833, 50847, 50852, 50866, 50878, 50889, 50909, 50915, 50935,
+    50952, 50963, 50973, 50982, 50993, 51005, 51011, 51022, 51029, 51041, 51056, 51066,
+    51082, 51086, 51094, 51110, 51124, 51138, 51155, 51177, 51195, 51212, 51230, 51237,
+    51257, 51277, 51288, 51300, 51316, 51323, 51339, 51350, 51363, 51381, 51392, 51408,
+    51416, 51422, 51436, 51452, 51466, 51485, 51496, 51510, 51518, 51523, 51533, 51542,
+    51559, 51577, 51586, 51596, 51609, 51618, 51626, 51635, 51652, 51662, 51681, 51692,
+    51706, 51737, 51752, 51766, 51773, 51784, 51794, 51805, 51829, 51837, 51850, 51870,
+    51883, 51893, 51910, 51918, 51922, 51933, 51940, 51951, 51965, 51972, 51979, 51995,
+    52012, 52026, 52042, 52053, 52072, 52086, 52101, 52113, 52121, 52141, 52155, 52161,
+    52176, 52190, 52205, 52211, 52216, 52236, 52247, 52261, 52270, 52281, 52297, 52304,
+    52316, 52323, 52330, 52343, 52348, 52368, 52379, 52389, 52404, 52416, 52435, 52444,
+    52461, 52470, 52490, 52503, 52511, 52517, 52535, 52544, 52554, 52568, 52582, 52598,
+    52610, 52616, 52629, 52642, 52647, 52653, 52658, 52677, 52693, 52705, 52713, 52718,
+    52744, 52754, 52769, 52786, 52797, 52806, 52826, 52832, 52845, 52851, 52863, 52874,
+    52891, 52907, 52923, 52933, 52938, 52950, 52964, 52976, 52992, 53009, 53019, 53025,
+    53033, 53059, 53069, 53088, 53110, 53128, 53138, 53145, 53164, 53170, 53177, 53189,
+    53200, 53215, 53234, 53248, 53261, 53266, 53284, 53297, 53308, 53321, 53338, 53352,
+    53361, 53375, 53394, 53406, 53415, 53427, 53434, 53448, 53458, 53468, 53480, 53493,
+    53514, 53525, 53541, 53553, 53561, 53584, 53595, 53600, 53613, 53631, 53648, 53667,
+    53687, 53695, 53701, 53710, 53723, 53738, 53755, 53758, 53786, 53806, 53820, 53839,
+    53847, 53871, 53879, 53886, 53900, 53906, 53920, 53939, 53954, 53966, 53976, 53994,
+    54004, 54019, 54033, 54044, 54058, 54064, 54079, 54093, 54099, 54113, 54120, 54131,
+    54145, 54156, 54172, 54199, 54211, 54217, 54226, 54243, 54280, 54298, 54319, 54336,
+    54343, 54357, 54367, 54380, 54388, 54395, 54410, 54414, 54427, 54448, 54471, 54480,
+    54492, 54508, 54522, 54545, 54558, 54579, 54593, 54608, 54618, 54631, 54640, 54649,
+    54654, 54664, 54669, 54679, 54692, 54705, 54713, 54723, 54737, 54754, 54779, 54785,
+    54795, 54815, 54824, 54835, 54848, 54859, 54880, 54894, 54907, 54923, 54939, 54952,
+    54960, 54982, 54988, 54997, 55008, 55024, 55042, 55058, 55064, 55080, 55091, 55104,
+    55124, 55131, 55136, 55147, 55170, 55177, 55189, 55213, 55231, 55245, 55250, 55262,
+    55272, 55285, 55296, 55307, 55328, 55341, 55346, 55351, 55360, 55371, 55380, 55401,
+    55415, 55422, 55437, 55448, 55458, 55471, 55486, 55493, 55508, 55512, 55528, 55543,
+    55553, 55565, 55576, 55589, 55609, 55615, 55620, 55632, 55648, 55658, 55681, 55693,
+    55702, 55708, 55713, 55726, 55739, 55752, 55766, 55778, 55790, 55799, 55805, 55810,
+    55817, 55826, 55839, 55857, 55863, 55880, 55890, 55899, 55911, 55933, 55942, 55962,
+    55978, 55991, 56001, 56012, 56025, 56044, 56058, 56076, 56085, 56095, 56109, 56120,
+    56134, 56141, 56155, 56164, 56179, 56187, 56200, 56209, 56223, 56235, 56246, 56262,
+    56276, 56293, 56309, 56318, 56335, 56343, 56355, 56365, 56385, 56402, 56417, 56428,
+    56440, 56452, 56462, 56480, 56487, 56501, 56517, 56536, 56548, 56562, 56567, 56570,
+    56588, 56602, 56624, 56637, 56642, 56654, 56663, 56670, 56677, 56696, 56715, 56732,
+    56746, 56757, 56771, 56780, 56787, 56804, 56814, 56820, 56837, 56853, 56866, 56882,
+    56893, 56903, 56931, 56939, 56959, 56982, 56990, 56994, 57008, 57016, 57034, 57047,
+    57058, 57064, 57079, 57090, 57099, 57112, 57120, 57128, 57146, 57159, 57170, 57179,
+    57185, 57205, 57212, 57228, 57241, 57251, 57260, 57277, 57293, 57310, 57325, 57344,
+    57354, 57366, 57382, 57389, 57394, 57408, 57421, 57443, 57469, 57478, 57488,
+};
+
+/// The icon of every slot
+inline constexpr int nameIcons[nameCount] = {
+    fa::shirt,
+    fa::building_shield,
+    fa::star,
+    fa::rectangle_vertical,
+    fa::person_hiking,
+    fa::pinball,
+    fa::chopsticks,
+    fa::cubes_stacked,
+    fa::clipboard_medical,
+    fa::staff_aesculapius,
+    fa::kidneys,
+    fa::jira,
+    fa::signal_good,
+    fa::vector_square,
+    fa::monitor_waveform,
+    fa::square_r,
+    fa::yammer,
+    fa::arrow_up_from_line,
+    fa::waveform_lines,
+    fa::arrow_turn_down,
+    fa::left_from_line,
+    fa::circle_question,
+    fa::mix,
+    fa::face_grin_wide,
+    fa::arrow_down_arrow_up,
+    fa::square_down_right,
+    fa::camcorder,
+    fa::envelope_circle_check,
+    fa::book_atlas,
+    fa::font_case,
+    fa::circle_arrow_down_left,
+    fa::arrows_to_circle,
+    fa::transporter_7,
+    fa::display_slash,
+    fa::lobster,
+    fa::chalkboard,
+    fa::tenge_sign,
+    fa::cross,
+    fa::boxes_packing,
+    fa::dropbox,
+    fa::house_person_leave,
+    fa::mug,
+    fa::restroom_simple,
+    fa::wrench,
+    fa::water_ladder,
+    fa::mailbox,
+    fa::simplybuilt,
+    fa::arrow_rotate_right,
+    fa::anchor_circle_check,
+    fa::earth_americas,
+    fa::dice_four,
+    fa::objects_align_top,
+    fa::face_angry,
+    fa::cc_stripe,
+    fa::socks,
+    fa::house_window,
+    fa::hand_point_up,
+    fa::money_check_dollar,
+    fa::calendar_circle_minus,
+    fa::person_arrow_down_to_line,
+    fa::dreidel,
+    fa::pause,
+    fa::truck_tow,
+    fa::rug,
+    fa::umbrella_beach,
+    fa::alarm_exclamation,
+    fa::hourglass_clock,
+    fa::user_shakespeare,
+    fa::octagon_xmark,
+    fa::user_alien,
+    fa::link_horizontal_slash,
+    fa::honey_pot,
+    fa::clock_seven_thirty,
+    fa::champagne_glass,
+    fa::message_pen,
+    fa::toilet_paper_under,
+    fa::quinscape,
+    fa::badge_percent,
+    fa::resolving,
+    fa::custard,
+    fa::baby_carriage,
+    fa::face_grin_squint_tears,
+    fa::gas_pump_slash,
+    fa::plug_circle_plus,
+    fa::j,
+    fa::cheese,
+    fa::circle_pause,
+    fa::battery_full,
+    fa::cowbell,
+    fa::face_explode,
+    fa::up_down,
+    fa::burger,
+    fa::rectangle_history_circle_plus,
+    fa::ban,
+    fa::arrows_repeat_1,
+    fa::chair,
+    fa::table_cells_large,
+    fa::party_horn,
+    fa::futbol,
+    fa::person_sledding,
+    fa::square_caret_right,
+    fa::comment_dollar,
+    fa::kitchen_set,
+    fa::person_dress_burst,
+    fa::square_arrow_up,
+    fa::store_slash,
+    fa::arrow_rotate_left,
+    fa::hand_peace,
+    fa::text_slash,
+    fa::page_caret_down,
+    fa::claw_marks,
+    fa::face_lying,
+    fa::nimblr,
+    fa::kit_medical,
+    fa::bangladeshi_taka_sign,
+    fa::usb_drive,
+    fa::hand_back_point_left,
+    fa::computer,
+    fa::shield_xmark,
+    fa::square_arrow_right,
+    fa::car_side_bolt,
+    fa::unlock_keyhole,
+    fa::tablet_screen,
+    fa::goal_net,
+    fa::window_frame_open,
+    fa::circle_arrow_up,
+    fa::comment_arrow_up,
+    fa::puzzle_piece_simple,
+    fa::candle_holder,
+    fa::shuttle_space,
+    fa::puzzle_piece_simple,
+    fa::tablet,
+    fa::car_wrench,
+    fa::mars_stroke_up,
+    fa::font_awesome,
+    fa::user_robot,
+    fa::dice_d6,
+    fa::wheelchair,
+    fa::paper_plane,
+    fa::message_quote,
+    fa::house_lock,
+    fa::face_laugh_beam,
+    fa::desktop,
+    fa::gavel,
+    fa::arrow_up_wide_short,
+    fa::circle_pause,
+    fa::square_phone_flip,
+    fa::toilet_paper_blank_under,
+    fa::italic,
+    fa::head_side_cough,
+    fa::creative_commons_sa,
+    fa::dragon,
+    fa::sun_bright,
+    fa::file_arrow_up,
+    fa::comment_medical,
+    fa::shield_cat,
+    fa::panel_ews,
+    fa::sword,
+    fa::rectangle_history_circle_user,
+    fa::message_code,
+    fa::bong,
+    fa::duck,
+    fa::watch_smart,
+    fa::hashtag,
+    fa::brain,
+    fa::rotate_left,
+    fa::bell_slash,
+    fa::rockrms,
+    fa::creative_commons_pd_alt,
+    fa::arrow_down_up_across_line,
+    fa::smoke,
+    fa::splotch,
+    fa::virus_covid_slash,
+    fa::globe_stand,
+    fa::square_quote,
+    fa::stumbleupon,
+    fa::rectangle_pro,
+    fa::circle_microphone,
+    fa::earth_americas,
+    fa::file_slash,
+    fa::signal_slash,
+    fa::user_gear,
+    fa::person_walking,
+    fa::left,
+    fa::wreath,
+    fa::wpressr,
+    fa::arrow_up_small_big,
+    fa::chart_simple,
+    fa::_8,
+    fa::light_emergency_on,
+    fa::bots,
+    fa::face_grin_wink,
+    fa::handshake_simple_slash,
+    fa::less_than_equal,
+    fa::infinity,
+    fa::face_frown,
+    fa::bullhorn,
+    fa::cup_straw_swoosh,
+    fa::square_h,
+    fa::book,
+    fa::up_right,
+    fa::spray_can,
+    fa::github_square,
+    fa::shopware,
+    fa::futbol,
+    fa::square_x,
+    fa::car_burst,
+    fa::hockey_puck,
+    fa::standard_definition,
+    fa::square_sliders,
+    fa::tablet,
+    fa::snake,
+    fa::island_tropical,
+    fa::trailer,
+    fa::biohazard,
+    fa::island_tropical,
+    fa::face_dizzy,
+    fa::flask_round_poison,
+    fa::wine_glass_empty,
+    fa::virus_slash,
+    fa::transporter_2,
+    fa::person,
+    fa::scalpel_line_dashed,
+    fa::car,
+    fa::eye_slash,
+    fa::mask_face,
+    fa::hockey_stick_puck,
+    fa::vest,
+    fa::themeisle,
+    fa::kaggle,
+    fa::trash_can,
+    fa::conveyor_belt,
+    fa::user_xmark,
+    fa::feather,
+    fa::martini_glass,
+    fa::location_crosshairs_slash,
+    fa::car_bus,
+    fa::angel,
+    fa::truck_clock,
+    fa::circle_camera,
+    fa::stomach,
+    fa::play,
+    fa::circle_arrow_left,
+    fa::album_circle_plus,
+    fa::ban_smoking,
+    fa::warehouse,
+    fa::rupee_sign,
+    fa::refrigerator,
+    fa::flux_capacitor,
+    fa::circle_caret_down,
+    fa::game_console_handheld,
+    fa::triangle_person_digging,
+    fa::syringe,
+    fa::circle_h,
+    fa::flask_round_poison,
+    fa::chess_king,
+    fa::pipe_section,
+    fa::arrows_retweet,
+    fa::user_unlock,
+    fa::vaadin,
+    fa::holly_berry,
+    fa::hammer_war,
+    fa::ampersand,
+    fa::mushroom,
+    fa::sportsball,
+    fa::phone_flip,
+    fa::star_half_stroke,
+    fa::piano,
+    fa::arrow_down_1_9,
+    fa::trowel_bricks,
+    fa::cup_togo,
+    fa::square_3,
+    fa::oil_well,
+    fa::pen_clip_slash,
+    fa::medium,
+    fa::ruble_sign,
+    fa::plug_circle_bolt,
+    fa::arrow_left_from_line,
+    fa::lari_sign,
+    fa::comment_plus,
+    fa::bell_exclamation,
+    fa::wand_magic,
+    fa::grid_5,
+    fa::monero,
+    fa::gauge_min,
+    fa::apartment,
+    fa::hands_holding_child,
+    fa::octagon,
+    fa::list_ol,
+    fa::down,
+    fa::angle_down,
+    fa::meter_fire,
+    fa::shower,
+    fa::hand_holding_droplet,
+    fa::symbols,
+    fa::user_minus,
+    fa::ember,
+    fa::square_full,
+    fa::circle_dollar,
+    fa::message_dollar,
+    fa::phone_missed,
+    fa::objects_align_center_vertical,
+    fa::creative_commons_share,
+    fa::gulp,
+    fa::arrow_turn_up,
+    fa::bread_slice,
+    fa::pied_piper_hat,
+    fa::cake_candles,
+    fa::link_simple,
+    fa::hexagon_exclamation,
+    fa::seal_exclamation,
+    fa::accusoft,
+    fa::message_xmark,
+    fa::keycdn,
+    fa::space_station_moon,
+    fa::book_journal_whills,
+    fa::square_right,
+    fa::walker,
+    fa::bells,
+    fa::cassette_tape,
+    fa::pied_piper_square,
+    fa::google_play,
+    fa::circle_trash,
+    fa::paragraph_left,
+    fa::minimize,
+    fa::water_arrow_down,
+    fa::location_dot_slash,
+    fa::pen_paintbrush,
+    fa::square_fragile,
+    fa::circle_question,
+    fa::house_tree,
+    fa::bicycle,
+    fa::baseball,
+    fa::signal,
+    fa::square_xmark,
+    fa::boxes_stacked,
+    fa::whiskey_glass_ice,
+    fa::hockey_mask,
+    fa::grate_droplet,
+    fa::planet_moon,
+    fa::turtle,
+    fa::message_dollar,
+    fa::bitcoin_sign,
+    fa::folder_arrow_up,
+    fa::light_emergency,
+    fa::right_from_line,
+    fa::circle_d,
+    fa::circle_book_open,
+    fa::face_raised_eyebrow,
+    fa::pen_to_square,
+    fa::sitrox,
+    fa::address_book,
+    fa::heart,
+    fa::square_down,
+    fa::pinata,
+    fa::ban,
+    fa::hubspot,
+    fa::kiwi_fruit,
+    fa::shop,
+    fa::bowl_spoon,
+    fa::face_laugh,
+    fa::heart_half,
+    fa::folder_image,
+    fa::square_pen,
+    fa::trophy,
+    fa::arrow_down_to_arc,
+    fa::vault,
+    fa::oil_temperature,
+    fa::border_bottom_right,
+    fa::face_awesome,
+    fa::guitar_electric,
+    fa::table_list,
+    fa::square_a_lock,
+    fa::merge,
+    fa::grip,
+    fa::stripe_s,
+    fa::shuffle,
+    fa::plane_departure,
+    fa::video,
+    fa::medal,
+    fa::hive,
+    fa::blogger,
+    fa::gamepad_modern,
+    fa::people_robbery,
+    fa::square_f,
+    fa::octagon_xmark,
+    fa::angles_up,
+    fa::square_t,
+    fa::magnifying_glass_chart,
+    fa::heart_circle_minus,
+    fa::compass_drafting,
+    fa::circle_0,
+    fa::envelopes_bulk,
+    fa::basket_shopping_simple,
+    fa::clover,
+    fa::comments_question_check,
+    fa::arrow_left_long,
+    fa::dryer,
+    fa::toilet_paper_under_slash,
+    fa::floppy_disk_circle_xmark,
+    fa::earth_europe,
+    fa::chart_line_up,
+    fa::diagram_project,
+    fa::battle_net,
+    fa::file_zipper,
+    fa::circle_user,
+    fa::ban_bug,
+    fa::glasses,
+    fa::soap,
+    fa::face_exhaling,
+    fa::chevrons_up,
+    fa::flag_pennant,
+    fa::angles_up,
+    fa::person_sledding,
+    fa::person_cane,
+    fa::file_check,
+    fa::gun,
+    fa::exclamation,
+    fa::franc_sign,
+    fa::house_day,
+    fa::tire_rugged,
+    fa::otter,
+    fa::pipe_circle_check,
+    fa::wheelchair_move,
+    fa::tennis_ball,
+    fa::book_atlas,
+    fa::lock_hashtag,
+    fa::circle_dollar,
+    fa::arrow_down_square_triangle,
+    fa::square_rootiable,
+    fa::circle_q,
+    fa::untappd,
+    fa::cricket_bat_ball,
+    fa::bed_front,
+    fa::xmark_large,
+    fa::ticket_simple,
+    fa::cloud,
+    fa::square_pen,
+    fa::chevron_right,
+    fa::diploma,
+    fa::registered,
+    fa::clothes_hanger,
+    fa::square_question,
+    fa::arrow_right_arrow_left,
+    fa::dice_d20,
+    fa::up_right_from_square,
+    fa::blanket,
+    fa::comment_arrow_down,
+    fa::minus,
+    fa::user_bounty_hunter,
+    fa::modx,
+    fa::bed_pulse,
+    fa::blanket_fire,
+    fa::r,
+    fa::tablet_button,
+    fa::reply_all,
+    fa::hexagon,
+    fa::folder_xmark,
+    fa::fire_smoke,
+    fa::cart_circle_arrow_up,
+    fa::balloon,
+    fa::print_slash,
+    fa::droplet_slash,
+    fa::flickr,
+    fa::file_dashed_line,
+    fa::square_7,
+    fa::wpforms,
+    fa::wine_glass,
+    fa::chess_clock_flip,
+    fa::sort_down,
+    fa::pallet,
+    fa::square_dashed,
+    fa::lock_keyhole_open,
+    fa::arrow_left_long_to_line,
+    fa::square_l,
+    fa::pedestal,
+    fa::chess_rook,
+    fa::sword_laser,
+    fa::book_circle_arrow_up,
+    fa::wizards_of_the_coast,
+    fa::box,
+    fa::circle_stop,
+    fa::calendar_pen,
+    fa::table,
+    fa::hexagon_check,
+    fa::house_medical_flag,
+    fa::arrow_rotate_left,
+    fa::table_tree,
+    fa::bagel,
+    fa::bolt,
+    fa::dochub,
+    fa::wand_magic_sparkles,
+    fa::shekel_sign,
+    fa::arrow_rotate_right,
+    fa::house_fire,
+    fa::truck_moving,
+    fa::money_bills_simple,
+    fa::brackets_square,
+    fa::hourglass_start,
+    fa::product_hunt,
+    fa::shirt_tank_top,
+    fa::left,
+    fa::angle_left,
+    fa::hourglass_end,
+    fa::image_polaroid,
+    fa::cloud_bolt_moon,
+    fa::n,
+    fa::chevrons_down,
+    fa::dial_off,
+    fa::helicopter,
+    fa::rotate_right,
+    fa::axe_battle,
+    fa::outdent,
+    fa::square_arrow_left,
+    fa::handshake,
+    fa::bed_front,
+    fa::link_horizontal,
+    fa::message_quote,
+    fa::text_size,
+    fa::dial_med,
+    fa::leaf_heart,
+    fa::wodu,
+    fa::researchgate,
+    fa::square_font_awesome_stroke,
+    fa::car_battery,
+    fa::icons,
+    fa::microblog,
+    fa::abacus,
+    fa::filter_circle_xmark,
+    fa::falafel,
+    fa::gripfire,
+    fa::file_import,
+    fa::bench_tree,
+    fa::passport,
+    fa::file_excel,
+    fa::square_chevron_down,
+    fa::house_circle_xmark,
+    fa::crop_simple,
+    fa::amazon,
+    fa::bluetooth_b,
+    fa::watermelon_slice,
+    fa::building_circle_arrow_right,
+    fa::circle_4,
+    fa::clock_eight,
+    fa::arrow_up_z_a,
+    fa::republican,
+    fa::cake_candles,
+    fa::sign_hanging,
+    fa::b,
+    fa::circle_l,
+    fa::paw,
+    fa::scale_unbalanced_flip,
+    fa::arrow_up_from_ground_water,
+    fa::arrow_down_left,
+    fa::dribbble_square,
+    fa::drone_front,
+    fa::arrow_rotate_left,
+    fa::calendar_circle_exclamation,
+    fa::pen_ruler,
+    fa::arrow_right,
+    fa::ferris_wheel,
+    fa::alt,
+    fa::poo_storm,
+    fa::face_frown_open,
+    fa::lungs,
+    fa::bolt_lightning,
+    fa::chess_clock_flip,
+    fa::fantasy_flight_games,
+    fa::message_arrow_down,
+    fa::cowbell_circle_plus,
+    fa::dryer_heat,
+    fa::mobile_signal_out,
+    fa::arrow_down_short_wide,
+    fa::dharmachakra,
+    fa::circle_half_stroke,
+    fa::signs_post,
+    fa::bus_simple,
+    fa::circle_sort_down,
+    fa::arrow_up_triangle_square,
+    fa::droplet_percent,
+    fa::ice_cream,
+    fa::money_bill_1_wave,
+    fa::face_grin_tongue_wink,
+    fa::cloud_word,
+    fa::hand_holding_magic,
+    fa::face_glasses,
+    fa::wheat_awn,
+    fa::magnifying_glass_plus,
+    fa::pied_piper,
+    fa::person_ski_lift,
+    fa::charging_station,
+    fa::galactic_senate,
+    fa::face_smiling_hands,
+    fa::angellist,
+    fa::cloud_arrow_up,
+    fa::folder_gear,
+    fa::message_smile,
+    fa::person_pinball,
+    fa::arrow_down_wide_short,
+    fa::baht_sign,
+    fa::layer_plus,
+    fa::chess_king_piece,
+    fa::sword_laser_alt,
+    fa::message_image,
+    fa::jsfiddle,
+    fa::folder_magnifying_glass,
+    fa::github_alt,
+    fa::cart_circle_plus,
+    fa::phone_arrow_up_right,
+    fa::circle_exclamation_check,
+    fa::hand_fist,
+    fa::skull_cow,
+    fa::tombstone,
+    fa::tire_pressure_warning,
+    fa::hexagon_minus,
+    fa::people_pants,
+    fa::square_up_left,
+    fa::laptop_code,
+    fa::sign_hanging,
+    fa::trello,
+    fa::square_root,
+    fa::table_tennis_paddle_ball,
+    fa::tachograph_digital,
+    fa::creative_commons_nc_eu,
+    fa::gitter,
+    fa::wix,
+    fa::_5,
+    fa::volume_low,
+    fa::youtube,
+    fa::head_side_goggles,
+    fa::square_q,
+    fa::page_caret_down,
+    fa::temperature_three_quarters,
+    fa::clouds,
+    fa::industry_windows,
+    fa::sterling_sign,
+    fa::life_ring,
+    fa::onion,
+    fa::hexagon_minus,
+    fa::flower_tulip,
+    fa::file_shield,
+    fa::ski_boot,
+    fa::kite,
+    fa::dial_med_low,
+    fa::house_person_return,
+    fa::message_bot,
+    fa::file_chart_pie,
+    fa::arrow_right_arrow_left,
+    fa::squid,
+    fa::brain_arrow_curved_right,
+    fa::wave_pulse,
+    fa::dice_three,
+    fa::cloud_hail,
+    fa::line_columns,
+    fa::square_exclamation,
+    fa::film_canister,
+    fa::shop_lock,
+    fa::diagram_predecessor,
+    fa::circle_j,
+    fa::octagon_plus,
+    fa::sith,
+    fa::object_exclude,
+    fa::circle_arrow_down_right,
+    fa::message_text,
+    fa::user_group,
+    fa::y,
+    fa::calendar_clock,
+    fa::gauge,
+    fa::tent,
+    fa::comment_image,
+    fa::camera,
+    fa::down_from_line,
+    fa::house_chimney_crack,
+    fa::floppy_disk_circle_arrow_right,
+    fa::battery_full,
+    fa::octagon_minus,
+    fa::leanpub,
+    fa::comment_music,
+    fa::tower_broadcast,
+    fa::shovel_snow,
+    fa::binoculars,
+    fa::bity,
+    fa::square_arrow_right,
+    fa::landmark,
+    fa::eye,
+    fa::face_smile,
+    fa::landmark_flag,
+    fa::location_pin_slash,
+    fa::bowl_hot,
+    fa::table_layout,
+    fa::message_pen,
+    fa::user_helmet_safety,
+    fa::ornament,
+    fa::soundcloud,
+    fa::arrow_left_to_line,
+    fa::building_ngo,
+    fa::circle_dollar_to_slot,
+    fa::square_down,
+    fa::grate,
+    fa::block_brick_fire,
+    fa::face_grin_wide,
+    fa::battery_empty,
+    fa::loveseat,
+    fa::ethernet,
+    fa::border_bottom,
+    fa::phone_volume,
+    fa::cloud_bolt_moon,
+    fa::face_woozy,
+    fa::magnifying_glass_arrow_right,
+    fa::objects_align_bottom,
+    fa::dong_sign,
+    fa::deploydog,
+    fa::reply_clock,
+    fa::colon,
+    fa::chart_scatter_bubble,
+    fa::barcode_read,
+    fa::bell_plus,
+    fa::down_left,
+    fa::gun_slash,
+    fa::chess,
+    fa::alarm_snooze,
+    fa::shield_quartered,
+    fa::bars_staggered,
+    fa::bee,
+    fa::cent_sign,
+    fa::arrow_down_long,
+    fa::right_from_bracket,
+    fa::user_hair_mullet,
+    fa::cars,
+    fa::theta,
+    fa::axe,
+    fa::drum,
+    fa::building_columns,
+    fa::file_arrow_down,
+    fa::evernote,
+    fa::utility_pole_double,
+    fa::cart_arrow_up,
+    fa::mandalorian,
+    fa::house_person_return,
+    fa::user,
+    fa::creative_commons_nc_jp,
+    fa::cards,
+    fa::person_to_portal,
+    fa::keyboard_brightness,
+    fa::flag_swallowtail,
+    fa::soft_serve,
+    fa::compass,
+    fa::cart_flatbed_suitcase,
+    fa::flask_round_potion,
+    fa::yen_sign,
+    fa::cloud_arrow_up,
+    fa::alien,
+    fa::user_chef,
+    fa::drum_steelpan,
+    fa::hexagon_xmark,
+    fa::creative_commons_nd,
+    fa::diagram_project,
+    fa::light_ceiling,
+    fa::user_group_crown,
+    fa::keynote,
+    fa::objects_align_right,
+    fa::anchor,
+    fa::arrow_right_long,
+    fa::hat_witch,
+    fa::naira_sign,
+    fa::arrow_down,
+    fa::up_long,
+    fa::worm,
+    fa::head_side_virus,
+    fa::cloud_arrow_down,
+    fa::snooze,
+    fa::object_group,
+    fa::filter_circle_dollar,
+    fa::grid_2,
+    fa::wallet,
+    fa::app_store,
+    fa::distribute_spacing_vertical,
+    fa::hand_scissors,
+    fa::plane_up_slash,
+    fa::book_open,
+    fa::chart_bullet,
+    fa::hands,
+    fa::pushed,
+    fa::reply,
+    fa::temperature_quarter,
+    fa::square_sliders_vertical,
+    fa::tree_decorated,
+    fa::person_booth,
+    fa::voicemail,
+    fa::waveform,
+    fa::window_frame,
+    fa::circle_m,
+    fa::circle_ellipsis,
+    fa::searchengin,
+    fa::mobile_retro,
+    fa::arrow_up_left,
+    fa::text,
+    fa::message_text,
+    fa::circle_radiation,
+    fa::gingerbread_man,
+    fa::up_long,
+    fa::calendar_clock,
+    fa::input_pipe,
+    fa::bilibili,
+    fa::calendar_circle_plus,
+    fa::message_arrow_down,
+    fa::envelope_dot,
+    fa::toothbrush,
+    fa::memo_circle_check,
+    fa::toilet_paper_blank_under,
+    fa::person_seat,
+    fa::pencil,
+    fa::book_journal_whills,
+    fa::envelope_open_text,
+    fa::file_exclamation,
+    fa::citrus,
+    fa::garlic,
+    fa::earth_americas,
+    fa::square_xmark,
+    fa::book_open_cover,
+    fa::masks_theater,
+    fa::tv_music,
+    fa::table_cells,
+    fa::gear,
+    fa::ear,
+    fa::pen_ruler,
+    fa::volume,
+    fa::family_dress,
+    fa::square_pen,
+    fa::school,
+    fa::youtube_square,
+    fa::twitter,
+    fa::plane_prop,
+    fa::square_poll_horizontal,
+    fa::l,
+    fa::forward_step,
+    fa::church,
+    fa::land_mine_on,
+    fa::folder_closed,
+    fa::circle_book_open,
+    fa::star_shooting,
+    fa::fly,
+    fa::square_dollar,
+    fa::wirsindhandwerk,
+    fa::skeleton,
+    fa::fire_flame_simple,
+    fa::gitkraken,
+    fa::arrow_turn_down,
+    fa::hexagon_plus,
+    fa::down_from_line,
+    fa::screenpal,
+    fa::angles_right,
+    fa::fire,
+    fa::arrows_repeat_1,
+    fa::linkedin,
+    fa::truck_fast,
+    fa::pompebled,
+    fa::transporter_1,
+    fa::peapod,
+    fa::camera_viewfinder,
+    fa::flag_pennant,
+    fa::circle_9,
+    fa::rectangle_vertical_history,
+    fa::weight_scale,
+    fa::mobile,
+    fa::virus,
+    fa::telegram,
+    fa::earth_asia,
+    fa::users_gear,
+    fa::triangle_exclamation,
+    fa::circle_caret_down,
+    fa::person_from_portal,
+    fa::brazilian_real_sign,
+    fa::battery_bolt,
+    fa::strava,
+    fa::quote_left,
+    fa::lungs_virus,
+    fa::hexagon_xmark,
+    fa::file_code,
+    fa::boot_heeled,
+    fa::folders,
+    fa::creative_commons_by,
+    fa::cc_discover,
+    fa::delete_left,
+    fa::square_z,
+    fa::spider_web,
+    fa::rv,
+    fa::scroll_old,
+    fa::layer_minus,
+    fa::face_kiss,
+    fa::book_tanakh,
+    fa::pipe,
+    fa::hands_praying,
+    fa::chart_user,
+    fa::phone_xmark,
+    fa::eye_low_vision,
+    fa::square_arrow_down,
+    fa::ufo,
+    fa::scrubber,
+    fa::speaker,
+    fa::fedora,
+    fa::microphone_lines_slash,
+    fa::basketball,
+    fa::binary_lock,
+    fa::left_right,
+    fa::cloud_moon,
+    fa::truck_ramp_box,
+    fa::van_shuttle,
+    fa::user_helmet_safety,
+    fa::lamp_street,
+    fa::group_arrows_rotate,
+    fa::wave_square,
+    fa::earth_americas,
+    fa::shirtsinbulk,
+    fa::glasses_round,
+    fa::magnifying_glass,
+    fa::behance_square,
+    fa::circle_calendar,
+    fa::windsock,
+    fa::family,
+    fa::starship,
+    fa::house,
+    fa::skype,
+    fa::anchor_lock,
+    fa::gg,
+    fa::gauge_high,
+    fa::ufo_beam,
+    fa::circle_star,
+    fa::square_5,
+    fa::arrow_right_to_line,
+    fa::fish_bones,
+    fa::toilet_paper_blank,
+    fa::house_chimney,
+    fa::circle_arrow_right,
+    fa::rectangle_barcode,
+    fa::lasso,
+    fa::sistrix,
+    fa::face_nauseated,
+    fa::z,
+    fa::paintbrush,
+    fa::square_up,
+    fa::erlang,
+    fa::mug_marshmallows,
+    fa::circle_info,
+    fa::heart_circle_plus,
+    fa::sack_xmark,
+    fa::circle_bookmark,
+    fa::tower_broadcast,
+    fa::industry,
+    fa::tree,
+    fa::square_phone,
+    fa::sliders,
+    fa::atom,
+    fa::paintbrush_fine,
+    fa::arrow_left_to_line,
+    fa::violin,
+    fa::face_astonished,
+    fa::won_sign,
+    fa::hat_cowboy_side,
+    fa::magnifying_glass_location,
+    fa::ruble_sign,
+    fa::films,
+    fa::austral_sign,
+    fa::knife_kitchen,
+    fa::radar,
+    fa::box_heart,
+    fa::digital_ocean,
+    fa::jedi,
+    fa::rss,
+    fa::airplay,
+    fa::image_portrait,
+    fa::square_e,
+    fa::mobile_signal,
+    fa::user_pen,
+    fa::rugby_ball,
+    fa::house_signal,
+    fa::money_check_pen,
+    fa::w,
+    fa::bolt_slash,
+    fa::square_poll_vertical,
+    fa::magnifying_glass_location,
+    fa::network_wired,
+    fa::comment_lines,
+    fa::chess_queen_piece,
+    fa::hand_back_point_up,
+    fa::weight_hanging,
+    fa::coffin_cross,
+    fa::square_heart,
+    fa::hexagon_vertical_nft_slanted,
+    fa::person_military_to_person,
+    fa::block,
+    fa::face_meh,
+    fa::bracket_square,
+    fa::user_xmark,
+    fa::signal_bars,
+    fa::memory,
+    fa::left_from_line,
+    fa::vr_cardboard,
+    fa::turntable,
+    fa::bracket_curly,
+    fa::starfighter_twin_ion_engine_advanced,
+    fa::sort_up,
+    fa::flatbread_stuffed,
+    fa::cactus,
+    fa::snow_blowing,
+    fa::person_military_pointing,
+    fa::file_image,
+    fa::mountain,
+    fa::tv_retro,
+    fa::prescription,
+    fa::slideshare,
+    fa::saxophone_fire,
+    fa::_union,
+    fa::bath,
+    fa::house_chimney_heart,
+    fa::grunt,
+    fa::user_vneck,
+    fa::shield_keyhole,
+    fa::gif,
+    fa::euro_sign,
+    fa::asterisk,
+    fa::audible,
+    fa::lastfm_square,
+    fa::books_medical,
+    fa::hryvnia_sign,
+    fa::message_middle_top,
+    fa::circle_v,
+    fa::cart_flatbed_suitcase,
+    fa::kiwi_bird,
+    fa::face_laugh_beam,
+    fa::floppy_disk_circle_xmark,
+    fa::truck_container,
+    fa::melon_slice,
+    fa::school_circle_exclamation,
+    fa::arrows_up_down_left_right,
+    fa::face_sad_cry,
+    fa::drone,
+    fa::coins,
+    fa::vk,
+    fa::notes,
+    fa::firstdraft,
+    fa::memo_pad,
+    fa::link_slash,
+    fa::headphones_simple,
+    fa::face_unamused,
+    fa::basket_shopping,
+    fa::badge_dollar,
+    fa::circle_down,
+    fa::crosshairs,
+    fa::user_hair_mullet,
+    fa::vector_circle,
+    fa::briefcase_medical,
+    fa::watch_fitness,
+    fa::ear_deaf,
+    fa::sushi_roll,
+    fa::road_circle_xmark,
+    fa::square_ellipsis,
+    fa::temperature_quarter,
+    fa::edge,
+    fa::square_down_left,
+    fa::plane_slash,
+    fa::person_skating,
+    fa::delete_left,
+    fa::signal_bars_good,
+    fa::file_circle_info,
+    fa::dashcube,
+    fa::marker,
+    fa::monument,
+    fa::transporter_5,
+    fa::temperature_empty,
+    fa::champagne_glasses,
+    fa::fence,
+    fa::shield_check,
+    fa::location_plus,
+    fa::objects_column,
+    fa::sim_cards,
+    fa::money_bills,
+    fa::ruler,
+    fa::arrows_up_down,
+    fa::leaf_oak,
+    fa::share,
+    fa::users_rays,
+    fa::user_hair,
+    fa::water_ladder,
+    fa::heart_circle_xmark,
+    fa::solar_panel,
+    fa::cart_xmark,
+    fa::file_dashed_line,
+    fa::person_walking_dashed_line_arrow_right,
+    fa::file_circle_minus,
+    fa::hanukiah,
+    fa::arrow_up_square_triangle,
+    fa::paw_claws,
+    fa::fire_extinguisher,
+    fa::face_kiss_wink_heart,
+    fa::clock_one,
+    fa::face_smile_tear,
+    fa::octopus_deploy,
+    fa::lightbulb_on,
+    fa::hands_bubbles,
+    fa::comment_quote,
+    fa::quora,
+    fa::sun_cloud,
+    fa::filter_slash,
+    fa::filter_list,
+    fa::python,
+    fa::table_cells,
+    fa::chevrons_right,
+    fa::apper,
+    fa::clipboard_prescription,
+    fa::circle_phone_hangup,
+    fa::scalpel,
+    fa::handshake_simple_slash,
+    fa::trash_check,
+    fa::person_ski_lift,
+    fa::xmark,
+    fa::square_n,
+    fa::crutch,
+    fa::file_spreadsheet,
+    fa::circle_arrow_down,
+    fa::square_code,
+    fa::wheat_awn,
+    fa::circle_y,
+    fa::gauge_circle_bolt,
+    fa::truck_clock,
+    fa::border_inner,
+    fa::rotate_right,
+    fa::fire_flame,
+    fa::backward_fast,
+    fa::xmark,
+    fa::car_tilt,
+    fa::face_hushed,
+    fa::flying_disc,
+    fa::car_burst,
+    fa::router,
+    fa::ello,
+    fa::sensor,
+    fa::face_kiss_beam,
+    fa::unlock,
+    fa::trash_can_slash,
+    fa::grip_dots,
+    fa::tv,
+    fa::file_arrow_down,
+    fa::wifi,
+    fa::dhl,
+    fa::book_bible,
+    fa::ear_muffs,
+    fa::google_plus_g,
+    fa::left_right,
+    fa::_42_group,
+    fa::bowl_chopsticks,
+    fa::right,
+    fa::helmet_battle,
+    fa::glass_half,
+    fa::cart_shopping,
+    fa::bridge,
+    fa::window_flip,
+    fa::file_chart_column,
+    fa::window_flip,
+    fa::gallery_thumbnails,
+    fa::omega,
+    fa::comment_captions,
+    fa::truck_pickup,
+    fa::typewriter,
+    fa::masks_theater,
+    fa::usb,
+    fa::phone_hangup,
+    fa::less,
+    fa::mixcloud,
+    fa::circle_half_stroke,
+    fa::chart_scatter,
+    fa::nfc_trash,
+    fa::markdown,
+    fa::computer_mouse_scrollwheel,
+    fa::lacrosse_stick_ball,
+    fa::caravan_simple,
+    fa::circle_1,
+    fa::highlighter_line,
+    fa::dungeon,
+    fa::candy,
+    fa::arrows_spin,
+    fa::burger,
+    fa::sd_cards,
+    fa::face_anguished,
+    fa::frame,
+    fa::message_captions,
+    fa::react,
+    fa::send_backward,
+    fa::think_peaks,
+    fa::desktop_arrow_down,
+    fa::person_dots_from_line,
+    fa::hands_holding_heart,
+    fa::camera_cctv,
+    fa::moon_cloud,
+    fa::planet_ringed,
+    fa::shapes,
+    fa::outdent,
+    fa::pinterest,
+    fa::barcode_scan,
+    fa::indent,
+    fa::square_small,
+    fa::building_columns,
+    fa::envelope,
+    fa::bowl_hot,
+    fa::buy_n_large,
+    fa::face_grin_tongue,
+    fa::hands,
+    fa::poop,
+    fa::tamale,
+    fa::calendar_lines,
+    fa::person_biking,
+    fa::face_party,
+    fa::pan_food,
+    fa::mars_stroke_right,
+    fa::mdb,
+    fa::semicolon,
+    fa::hexagon_divide,
+    fa::microphone_slash,
+    fa::person_walking_arrow_right,
+    fa::solar_system,
+    fa::cart_flatbed_boxes,
+    fa::up_right_from_square,
+    fa::icons,
+    fa::circle_phone,
+    fa::p,
+    fa::lamp_floor,
+    fa::arrow_down_z_a,
+    fa::snowman_head,
+    fa::crop_simple,
+    fa::olive,
+    fa::ruler_vertical,
+    fa::tally,
+    fa::ghost,
+    fa::moon_over_sun,
+    fa::leafy_green,
+    fa::loveseat,
+    fa::arrow_down_to_bracket,
+    fa::border_outer,
+    fa::film,
+    fa::square_ellipsis_vertical,
+    fa::underline,
+    fa::signal_weak,
+    fa::guitars,
+    fa::square_phone_hangup,
+    fa::f,
+    fa::gauge_simple_low,
+    fa::square_2,
+    fa::cloud_showers,
+    fa::fire_burner,
+    fa::object_ungroup,
+    fa::bomb,
+    fa::left_long_to_line,
+    fa::rotate_exclamation,
+    fa::chevron_left,
+    fa::candy_corn,
+    fa::truck_flatbed,
+    fa::yandex_international,
+    fa::gauge_max,
+    fa::indian_rupee_sign,
+    fa::euro_sign,
+    fa::whmcs,
+    fa::circle_up_right,
+    fa::layer_plus,
+    fa::blender_phone,
+    fa::user_slash,
+    fa::circle_bookmark,
+    fa::rectangle,
+    fa::football,
+    fa::square_s,
+    fa::dial,
+    fa::caret_right,
+    fa::tree_large,
+    fa::seal_question,
+    fa::arrow_down_to_line,
+    fa::square_envelope,
+    fa::tally_2,
+    fa::apple_whole,
+    fa::binary,
+    fa::trash_clock,
+    fa::box_tissue,
+    fa::arrow_left_long,
+    fa::earth_africa,
+    fa::toggle_off,
+    fa::readme,
+    fa::house_heart,
+    fa::apple_whole,
+    fa::faucet,
+    fa::dial_min,
+    fa::draw_circle,
+    fa::inbox_out,
+    fa::square_dollar,
+    fa::sensor_cloud,
+    fa::transporter_3,
+    fa::circle_up,
+    fa::clock_rotate_left,
+    fa::temperature_full,
+    fa::o,
+    fa::plate_wheat,
+    fa::chart_pie_simple,
+    fa::computer_mouse_scrollwheel,
+    fa::person_praying,
+    fa::mobile_button,
+    fa::js_square,
+    fa::octagon_minus,
+    fa::book_blank,
+    fa::u,
+    fa::head_side_goggles,
+    fa::folder_xmark,
+    fa::arrow_turn_down_left,
+    fa::greater_than_equal,
+    fa::arrow_up,
+    fa::shield,
+    fa::truck_plane,
+    fa::arrows_to_eye,
+    fa::face_laugh_wink,
+    fa::clock_five_thirty,
+    fa::fire_flame,
+    fa::folder_grid,
+    fa::camera_security,
+    fa::floppy_disk_pen,
+    fa::house_chimney_crack,
+    fa::mug_saucer,
+    fa::sketch,
+    fa::viadeo_square,
+    fa::trash_can_arrow_up,
+    fa::location_minus,
+    fa::person_drowning,
+    fa::cloud_showers_water,
+    fa::hryvnia_sign,
+    fa::replyd,
+    fa::map_location_dot,
+    fa::bug,
+    fa::user_large_slash,
+    fa::handshake_simple,
+    fa::rev,
+    fa::code_fork,
+    fa::bags_shopping,
+    fa::sun_dust,
+    fa::rectangle_xmark,
+    fa::circle_calendar,
+    fa::neuter,
+    fa::laptop_mobile,
+    fa::bridge_circle_exclamation,
+    fa::notebook,
+    fa::circle_3,
+    fa::sort_down,
+    fa::up_to_line,
+    fa::openid,
+    fa::circle_waveform_lines,
+    fa::braille,
+    fa::layer_minus,
+    fa::tally_3,
+    fa::bars_staggered,
+    fa::traffic_light,
+    fa::book_section,
+    fa::users_viewfinder,
+    fa::heading,
+    fa::stethoscope,
+    fa::user_ninja,
+    fa::file_circle_question,
+    fa::g,
+    fa::face_frown_open,
+    fa::box_dollar,
+    fa::street_view,
+    fa::money_check,
+    fa::file_audio,
+    fa::up,
+    fa::chess_pawn_piece,
+    fa::git_square,
+    fa::apple_core,
+    fa::gift,
+    fa::gift_card,
+    fa::roller_coaster,
+    fa::quote_right,
+    fa::football_helmet,
+    fa::delicious,
+    fa::compress_wide,
+    fa::magnifying_glass_dollar,
+    fa::rupiah_sign,
+    fa::hose_reel,
+    fa::right_left,
+    fa::signal_bars,
+    fa::child_dress,
+    fa::fireplace,
+    fa::circle_quarters,
+    fa::handshake_slash,
+    fa::person_ski_jumping,
+    fa::dice_d12,
+    fa::arrows_left_right,
+    fa::up_from_line,
+    fa::arrow_up_wide_short,
+    fa::laravel,
+    fa::phone,
+    fa::person_dress_simple,
+    fa::clipboard_check,
+    fa::baguette,
+    fa::alipay,
+    fa::washing_machine,
+    fa::lira_sign,
+    fa::hands_holding_circle,
+    fa::square_minus,
+    fa::sort,
+    fa::hyphen,
+    fa::user_injured,
+    fa::table_columns,
+    fa::ruble_sign,
+    fa::comet,
+    fa::square_arrow_left,
+    fa::ideal,
+    fa::cup_togo,
+    fa::hand,
+    fa::clapperboard_play,
+    fa::arrow_up_1_9,
+    fa::arrow_down_big_small,
+    fa::memo_circle_info,
+    fa::shopify,
+    fa::snowflake,
+    fa::a,
+    fa::calendar_range,
+    fa::circle_dot,
+    fa::weebly,
+    fa::closed_captioning_slash,
+    fa::basketball,
+    fa::face_melting,
+    fa::ice_skate,
+    fa::gauge_simple_high,
+    fa::tank_water,
+    fa::business_time,
+    fa::user_shield,
+    fa::spoon,
+    fa::cards_blank,
+    fa::video_plus,
+    fa::backward_step,
+    fa::table_pivot,
+    fa::camera_polaroid,
+    fa::users_gear,
+    fa::shirt_long_sleeve,
+    fa::backward_fast,
+    fa::golf_ball_tee,
+    fa::people_group,
+    fa::microphone_lines_slash,
+    fa::book_arrow_up,
+    fa::border_left,
+    fa::shower_down,
+    fa::starfighter_twin_ion_engine_advanced,
+    fa::nfc_pen,
+    fa::cuttlefish,
+    fa::circle_heart,
+    fa::pinterest_square,
+    fa::right_left,
+    fa::fan_table,
+    fa::inbox_out,
+    fa::leaf_maple,
+    fa::floppy_disk,
+    fa::truck_fast,
+    fa::flag_usa,
+    fa::dolphin,
+    fa::file_zipper,
+    fa::hands_holding_diamond,
+    fa::table_tennis_paddle_ball,
+    fa::hands_asl_interpreting,
+    fa::banana,
+    fa::up_from_dotted_line,
+    fa::lock_open,
+    fa::list,
+    fa::pen_clip,
+    fa::temperature_half,
+    fa::circle_parking,
+    fa::music,
+    fa::user_hair_buns,
+    fa::umbraco,
+    fa::arrow_pointer,
+    fa::bus,
+    fa::table_picnic,
+    fa::garage_car,
+    fa::scarecrow,
+    fa::vnv,
+    fa::face_kiss_closed_eyes,
+    fa::floppy_disk_circle_arrow_right,
+    fa::shish_kebab,
+    fa::dyalog,
+    fa::dagger,
+    fa::bootstrap,
+    fa::burger_lettuce,
+    fa::person_dots_from_line,
+    fa::vimeo_square,
+    fa::atlassian,
+    fa::sellsy,
+    fa::folder,
+    fa::yen_sign,
+    fa::memo,
+    fa::waveform_lines,
+    fa::file,
+    fa::face_grin_beam_sweat,
+    fa::store_lock,
+    fa::face_laugh_wink,
+    fa::toilet_portable,
+    fa::ditto,
+    fa::people_carry_box,
+    fa::briefcase_arrow_right,
+    fa::wand_sparkles,
+    fa::mango,
+    fa::location_pen,
+    fa::square,
+    fa::face_smile,
+    fa::up_right_and_down_left_from_center,
+    fa::play_pause,
+    fa::square_font_awesome_stroke,
+    fa::car_building,
+    fa::anchor_circle_exclamation,
+    fa::rectangle_ad,
+    fa::broom,
+    fa::citrus_slice,
+    fa::ussunnah,
+    fa::down_left_and_up_right_to_center,
+    fa::circle_chevron_right,
+    fa::gg_circle,
+    fa::stack_exchange,
+    fa::page,
+    fa::face_grin_tongue_squint,
+    fa::right_to_line,
+    fa::i,
+    fa::guarani_sign,
+    fa::arrow_down_a_z,
+    fa::message_question,
+    fa::shop_slash,
+    fa::transporter_empty,
+    fa::viadeo,
+    fa::french_fries,
+    fa::hand_holding_heart,
+    fa::heart_half_stroke,
+    fa::wheat_awn_circle_exclamation,
+    fa::virus_covid,
+    fa::filters,
+    fa::comment_sms,
+    fa::whiskey_glass,
+    fa::square_bolt,
+    fa::rectangle_xmark,
+    fa::shrimp,
+    fa::highlighter,
+    fa::bone_break,
+    fa::book_tanakh,
+    fa::neos,
+    fa::right_from_bracket,
+    fa::card_spade,
+    fa::superscript,
+    fa::temperature_empty,
+    fa::circle_small,
+    fa::wordpress_simple,
+    fa::grip_lines,
+    fa::reply,
+    fa::facebook_f,
+    fa::umbrella,
+    fa::circle_envelope,
+    fa::egg_fried,
+    fa::signature_slash,
+    fa::rectangles_mixed,
+    fa::hand_holding_droplet,
+    fa::democrat,
+    fa::diamond,
+    fa::arrow_up_from_water_pump,
+    fa::monitor_waveform,
+    fa::podium_star,
+    fa::temperature_sun,
+    fa::trowel,
+    fa::bullseye_arrow,
+    fa::user_plus,
+    fa::peanut,
+    fa::rectangle_barcode,
+    fa::filter,
+    fa::message_exclamation,
+    fa::rocket_launch,
+    fa::down_to_bracket,
+    fa::house_chimney_medical,
+    fa::qrcode,
+    fa::cloud_bolt_sun,
+    fa::folder_bookmark,
+    fa::user_vneck_hair,
+    fa::square_chevron_right,
+    fa::hand_holding_seedling,
+    fa::person_sign,
+    fa::leaf,
+    fa::steam_symbol,
+    fa::d,
+    fa::circle_caret_left,
+    fa::house_night,
+    fa::scale_unbalanced,
+    fa::gauge_simple_low,
+    fa::shield_virus,
+    fa::water,
+    fa::arrow_up_a_z,
+    fa::capsules,
+    fa::earth_africa,
+    fa::block_quote,
+    fa::burst,
+    fa::martini_glass_citrus,
+    fa::affiliatetheme,
+    fa::person_pregnant,
+    fa::tent_arrow_turn_left,
+    fa::subscript,
+    fa::person_circle_plus,
+    fa::car_tunnel,
+    fa::sensor_triangle_exclamation,
+    fa::greater_than,
+    fa::cheese_swiss,
+    fa::square_fragile,
+    fa::google_pay,
+    fa::print,
+    fa::code_pull_request,
+    fa::clock_five,
+    fa::shield_slash,
+    fa::scribble,
+    fa::face_dizzy,
+    fa::rectangle_code,
+    fa::dev,
+    fa::snapchat,
+    fa::golf_flag_hole,
+    fa::_42_group,
+    fa::glass_water_droplet,
+    fa::hands_clapping,
+    fa::person_walking_luggage,
+    fa::droplet_percent,
+    fa::elevator,
+    fa::toilets_portable,
+    fa::chess_clock,
+    fa::circle_n,
+    fa::pencil,
+    fa::toilet_paper_slash,
+    fa::dice_d8,
+    fa::arrow_left_from_line,
+    fa::chess_bishop,
+    fa::broom_ball,
+    fa::link_simple_slash,
+    fa::hacker_news,
+    fa::chart_scatter_3d,
+    fa::cloudsmith,
+    fa::hard_drive,
+    fa::person_swimming,
+    fa::circle_sort,
+    fa::circle_phone_flip,
+    fa::intercom,
+    fa::face_meh,
+    fa::shekel_sign,
+    fa::face_grin_beam,
+    fa::arrow_up_right_dots,
+    fa::cloud_arrow_down,
+    fa::user_cowboy,
+    fa::user_pilot_tie,
+    fa::calendar_xmark,
+    fa::magnifying_glass_minus,
+    fa::face_meh_blank,
+    fa::check,
+    fa::lambda,
+    fa::trash_list,
+    fa::face_grin_squint,
+    fa::pied_piper_alt,
+    fa::square_v,
+    fa::cc_amex,
+    fa::clock,
+    fa::table_rows,
+    fa::tv,
+    fa::share_nodes,
+    fa::bowl_soft_serve,
+    fa::left_to_line,
+    fa::droplet,
+    fa::trademark,
+    fa::volume_xmark,
+    fa::left_to_line,
+    fa::creative_commons_nc,
+    fa::cart_minus,
+    fa::sushi,
+    fa::optin_monster,
+    fa::book_sparkles,
+    fa::book_medical,
+    fa::turn_up,
+    fa::house_blank,
+    fa::face_frown_slight,
+    fa::etsy,
+    fa::servicestack,
+    fa::baseball,
+    fa::circle_up,
+    fa::eye_dropper,
+    fa::period,
+    fa::arrow_right_to_bracket,
+    fa::empire,
+    fa::kazoo,
+    fa::inbox_in,
+    fa::h5,
+    fa::person_ski_jumping,
+    fa::taxi,
+    fa::horse,
+    fa::signature,
+    fa::moped,
+    fa::file_lines,
+    fa::face_disguise,
+    fa::brackets_round,
+    fa::arrow_right_from_line,
+    fa::hand_lizard,
+    fa::list_radio,
+    fa::ellipsis,
+    fa::pot_food,
+    fa::video_slash,
+    fa::cloud_arrow_up,
+    fa::album_circle_user,
+    fa::diagram_successor,
+    fa::mug_tea_saucer,
+    fa::book_font,
+    fa::firefox_browser,
+    fa::calculator,
+    fa::menorah,
+    fa::truck_droplet,
+    fa::colon_sign,
+    fa::message_xmark,
+    fa::guitar,
+    fa::paypal,
+    fa::light_switch_off,
+    fa::face_head_bandage,
+    fa::cart_shopping,
+    fa::square_j,
+    fa::wirsindhandwerk,
+    fa::codiepie,
+    fa::box_open_full,
+    fa::tower_observation,
+    fa::school_circle_xmark,
+    fa::cloud_moon_rain,
+    fa::circle_g,
+    fa::martini_glass,
+    fa::igloo,
+    fa::cloud_sun_rain,
+    fa::user_gear,
+    fa::microscope,
+    fa::podium,
+    fa::file_plus_minus,
+    fa::location_exclamation,
+    fa::rectangle,
+    fa::creative_commons_pd,
+    fa::high_definition,
+    fa::phone_arrow_down_left,
+    fa::truck,
+    fa::circle_info,
+    fa::hand_holding,
+    fa::critical_role,
+    fa::shuttle_space,
+    fa::laptop_slash,
+    fa::umbrella_simple,
+    fa::trade_federation,
+    fa::circle_exclamation,
+    fa::starfighter,
+    fa::calendar_plus,
+    fa::link_slash,
+    fa::tree_city,
+    fa::screwdriver_wrench,
+    fa::face_nose_steam,
+    fa::dice_five,
+    fa::tags,
+    fa::hexagon_vertical_nft,
+    fa::viber,
+    fa::barcode,
+    fa::bars_staggered,
+    fa::info,
+    fa::itch_io,
+    fa::reply_all,
+    fa::slash_back,
+    fa::hips,
+    fa::car_bolt,
+    fa::temperature_full,
+    fa::spotify,
+    fa::invision,
+    fa::bolt,
+    fa::film_slash,
+    fa::bandage,
+    fa::ravelry,
+    fa::watch_calculator,
+    fa::angrycreative,
+    fa::ticket,
+    fa::file_xmark,
+    fa::border_top_left,
+    fa::file_certificate,
+    fa::circle_arrow_down,
+    fa::book_quran,
+    fa::staff_aesculapius,
+    fa::font_awesome,
+    fa::square_share_nodes,
+    fa::joint,
+    fa::puzzle,
+    fa::user_police,
+    fa::angle_90,
+    fa::sliders,
+    fa::arrows_rotate,
+    fa::truck_ramp_couch,
+    fa::battery_full,
+    fa::wpexplorer,
+    fa::circle_chevron_down,
+    fa::perbyte,
+    fa::arrow_rotate_right,
+    fa::face_grin_stars,
+    fa::file_chart_column,
+    fa::battery_empty,
+    fa::building,
+    fa::shirt,
+    fa::envelope_dot,
+    fa::person_rays,
+    fa::person_digging,
+    fa::comment_xmark,
+    fa::nesting_dolls,
+    fa::gauge_low,
+    fa::ball_pile,
+    fa::window_restore,
+    fa::swatchbook,
+    fa::tomato,
+    fa::accessible_icon,
+    fa::brake_warning,
+    fa::laptop_mobile,
+    fa::user_astronaut,
+    fa::sausage,
+    fa::arrow_down_square_triangle,
+    fa::pen_paintbrush,
+    fa::circle_7,
+    fa::game_board,
+    fa::house_heart,
+    fa::shield,
+    fa::popcorn,
+    fa::hexagon_plus,
+    fa::compass_slash,
+    fa::hand_back_point_right,
+    fa::egg,
+    fa::plane_circle_xmark,
+    fa::cable_car,
+    fa::faucet_drip,
+    fa::file_export,
+    fa::rotate_left,
+    fa::volcano,
+    fa::stocking,
+    fa::circle_phone_flip,
+    fa::atom_simple,
+    fa::keyboard_down,
+    fa::up,
+    fa::calendar_arrow_up,
+    fa::computer_mouse,
+    fa::seal,
+    fa::fan,
+    fa::expand_wide,
+    fa::user_graduate,
+    fa::square_heart,
+    fa::paintbrush_fine,
+    fa::peace,
+    fa::arrows_maximize,
+    fa::truck_arrow_right,
+    fa::align_center,
+    fa::pied_piper_pp,
+    fa::magnifying_glass_plus,
+    fa::spray_can_sparkles,
+    fa::browser,
+    fa::head_side_medical,
+    fa::file_xmark,
+    fa::calculator_simple,
+    fa::ear_listen,
+    fa::message_music,
+    fa::circle_trash,
+    fa::mobile_screen,
+    fa::face_shush,
+    fa::note_sticky,
+    fa::light_switch,
+    fa::file_prescription,
+    fa::square_b,
+    fa::hat_chef,
+    fa::hot_tub_person,
+    fa::sliders_simple,
+    fa::square_caret_left,
+    fa::square_kanban,
+    fa::toilet_paper_blank,
+    fa::cruzeiro_sign,
+    fa::temperature_list,
+    fa::house,
+    fa::bowl_chopsticks_noodles,
+    fa::rotate_left,
+    fa::fork_knife,
+    fa::rectangle_wide,
+    fa::pepper,
+    fa::arrow_down_9_1,
+    fa::nfc,
+    fa::microphone_stand,
+    fa::wolf_pack_battalion,
+    fa::conveyor_belt_boxes,
+    fa::croissant,
+    fa::bowl_rice,
+    fa::circle_phone_hangup,
+    fa::facebook,
+    fa::pen_slash,
+    fa::arrow_down_wide_short,
+    fa::yahoo,
+    fa::circle_stop,
+    fa::people_arrows_left_right,
+    fa::volume_high,
+    fa::person_seat_reclined,
+    fa::hill_rockslide,
+    fa::poo,
+    fa::trash_undo,
+    fa::traffic_light_go,
+    fa::earth_asia,
+    fa::calendar_star,
+    fa::block_brick,
+    fa::money_bill,
+    fa::building_columns,
+    fa::starfighter_twin_ion_engine,
+    fa::diagram_nested,
+    fa::circle_video,
+    fa::box_ballot,
+    fa::unlock_keyhole,
+    fa::phone_arrow_down_left,
+    fa::file_word,
+    fa::microwave,
+    fa::burger_cheese,
+    fa::objects_align_left,
+    fa::rectangle_list,
+    fa::gavel,
+    fa::list_check,
+    fa::paper_plane_top,
+    fa::puzzle_piece,
+    fa::volume_low,
+    fa::rectangle_terminal,
+    fa::joystick,
+    fa::nfc_lock,
+    fa::connectdevelop,
+    fa::square_m,
+    fa::creative_commons,
+    fa::bars,
+    fa::tally_4,
+    fa::person_swimming,
+    fa::comments_question,
+    fa::box_open,
+    fa::arrows_maximize,
+    fa::square_caret_down,
+    fa::glass_half,
+    fa::clock_twelve,
+    fa::bring_forward,
+    fa::arrow_up_arrow_down,
+    fa::school_flag,
+    fa::message_lines,
+    fa::h3,
+    fa::rectangle_xmark,
+    fa::xmark_to_slot,
+    fa::down_from_dotted_line,
+    fa::circle_sort_up,
+    fa::circle_divide,
+    fa::plate_utensils,
+    fa::book_skull,
+    fa::square_chevron_left,
+    fa::mercury,
+    fa::page_caret_up,
+    fa::square_person_confined,
+    fa::user_nurse_hair,
+    fa::timer,
+    fa::eggplant,
+    fa::sim_card,
+    fa::square_this_way_up,
+    fa::line,
+    fa::star_sharp,
+    fa::circle_plus,
+    fa::wave_sine,
+    fa::hands_praying,
+    fa::goodreads,
+    fa::mobile_notch,
+    fa::person_shelter,
+    fa::right_long_to_line,
+    fa::fill,
+    fa::up_left,
+    fa::garage_open,
+    fa::cup_straw,
+    fa::inhaler,
+    fa::star_christmas,
+    fa::cart_circle_arrow_down,
+    fa::warehouse_full,
+    fa::dash,
+    fa::bolt_auto,
+    fa::code_pull_request_closed,
+    fa::gauge_simple_high,
+    fa::diamond_exclamation,
+    fa::handcuffs,
+    fa::person_to_door,
+    fa::dollar_sign,
+    fa::hands_asl_interpreting,
+    fa::sheep,
+    fa::whale,
+    fa::dryer_heat,
+    fa::square_dollar,
+    fa::truck_field_un,
+    fa::tablet_rugged,
+    fa::tablet_screen,
+    fa::chart_mixed,
+    fa::fax,
+    fa::bat,
+    fa::circle_t,
+    fa::drupal,
+    fa::square_arrow_up_right,
+    fa::image_landscape,
+    fa::trash_can_xmark,
+    fa::truck_medical,
+    fa::message_dots,
+    fa::bridge_water,
+    fa::face_eyes_xmarks,
+    fa::square_caret_left,
+    fa::battery_half,
+    fa::list_ul,
+    fa::hand_back_fist,
+    fa::pipe_valve,
+    fa::temperature_arrow_down,
+    fa::kickstarter,
+    fa::peach,
+    fa::cloud_question,
+    fa::backward,
+    fa::cc_apple_pay,
+    fa::h1,
+    fa::temperature_half,
+    fa::graduation_cap,
+    fa::film_simple,
+    fa::peseta_sign,
+    fa::flute,
+    fa::square_list,
+    fa::file_import,
+    fa::quote_right,
+    fa::square_rss,
+    fa::money_from_bracket,
+    fa::list_tree,
+    fa::dumpster_fire,
+    fa::hands_holding_dollar,
+    fa::wifi_weak,
+    fa::gauge_circle_plus,
+    fa::calendar,
+    fa::badge_sheriff,
+    fa::person_circle_check,
+    fa::battery_quarter,
+    fa::arrows_left_right,
+    fa::list_timeline,
+    fa::bag_shopping,
+    fa::hand_point_left,
+    fa::m,
+    fa::rhombus,
+    fa::pen_fancy_slash,
+    fa::file_magnifying_glass,
+    fa::plug_circle_xmark,
+    fa::calendar_check,
+    fa::loader,
+    fa::grid,
+    fa::clipboard_question,
+    fa::tick,
+    fa::moon_over_sun,
+    fa::cart_flatbed_empty,
+    fa::carrot,
+    fa::cookie_bite,
+    fa::symfony,
+    fa::ups,
+    fa::angles_left,
+    fa::location_smile,
+    fa::rabbit,
+    fa::box_circle_check,
+    fa::location_pin,
+    fa::face_vomit,
+    fa::temperature_low,
+    fa::diagram_cells,
+    fa::clouds_moon,
+    fa::layer_group,
+    fa::shelves,
+    fa::triangle_exclamation,
+    fa::face_disappointed,
+    fa::shield_minus,
+    fa::thermometer,
+    fa::scarf,
+    fa::pickleball,
+    fa::sitemap,
+    fa::cloud_xmark,
+    fa::c,
+    fa::chart_mixed,
+    fa::transporter,
+    fa::zhihu,
+    fa::magento,
+    fa::tachograph_digital,
+    fa::car_wash,
+    fa::angle_up,
+    fa::salad,
+    fa::id_badge,
+    fa::comment_slash,
+    fa::person_circle_minus,
+    fa::facebook_square,
+    fa::bars,
+    fa::bitcoin,
+    fa::face_laugh,
+    fa::person_dolly,
+    fa::location_check,
+    fa::train,
+    fa::video_arrow_down_left,
+    fa::key_skeleton_left_right,
+    fa::pencil_slash,
+    fa::temperature_quarter,
+    fa::caret_left,
+    fa::messages,
+    fa::copyright,
+    fa::square_a,
+    fa::certificate,
+    fa::coin_blank,
+    fa::arrow_down_1_9,
+    fa::backward_step,
+    fa::money_bill_wave,
+    fa::down_long,
+    fa::accent_grave,
+    fa::blog,
+    fa::person_through_window,
+    fa::bracket_square_right,
+    fa::mug_hot,
+    fa::location_dot_slash,
+    fa::stackpath,
+    fa::share_nodes,
+    fa::signal,
+    fa::battery_three_quarters,
+    fa::music_note_slash,
+    fa::odnoklassniki,
+    fa::slider,
+    fa::clock_six,
+    fa::border_none,
+    fa::square_4,
+    fa::arrow_up_big_small,
+    fa::suitcase_rolling,
+    fa::arrows_minimize,
+    fa::battery_half,
+    fa::location_question,
+    fa::person_walking_with_cane,
+    fa::file_music,
+    fa::eyes,
+    fa::water_arrow_up,
+    fa::id_card_clip,
+    fa::hand_back_fist,
+    fa::spa,
+    fa::_0,
+    fa::face_grin_beam,
+    fa::high_definition,
+    fa::face_smile_wink,
+    fa::folder_tree,
+    fa::gramophone,
+    fa::circle_half,
+    fa::crate_apple,
+    fa::pagelines,
+    fa::freebsd,
+    fa::right_long,
+    fa::square_w,
+    fa::cube,
+    fa::steak,
+    fa::yen_sign,
+    fa::shirt,
+    fa::person_biking_mountain,
+    fa::mountains,
+    fa::file_pen,
+    fa::snowplow,
+    fa::cloud_sleet,
+    fa::share,
+    fa::truck_ramp_couch,
+    fa::square_i,
+    fa::star_sharp_half,
+    fa::knife,
+    fa::video,
+    fa::hard_drive,
+    fa::comment_dots,
+    fa::v,
+    fa::comment_code,
+    fa::chess_rook_piece,
+    fa::ribbon,
+    fa::walkie_talkie,
+    fa::wave_pulse,
+    fa::hammer_crash,
+    fa::power_off,
+    fa::square_chevron_up,
+    fa::arrow_up_short_wide,
+    fa::arrow_up_left_from_circle,
+    fa::_7,
+    fa::clipboard_list,
+    fa::eye_dropper_full,
+    fa::arrow_right_from_arc,
+    fa::crown,
+    fa::transgender,
+    fa::phone_plus,
+    fa::tombstone_blank,
+    fa::arrow_down_left_and_arrow_up_right_to_center,
+    fa::calculator_simple,
+    fa::mobile,
+    fa::dolly_empty,
+    fa::text_height,
+    fa::alien_8bit,
+    fa::bottle_droplet,
+    fa::link,
+    fa::camera_retro,
+    fa::campground,
+    fa::triangle_instrument,
+    fa::circle_ellipsis_vertical,
+    fa::jet_fighter_up,
+    fa::money_bill_1,
+    fa::list_ol,
+    fa::arrow_right_long,
+    fa::joget,
+    fa::pipe_smoking,
+    fa::broom_ball,
+    fa::door_closed,
+    fa::turn_down_left,
+    fa::business_time,
+    fa::lyft,
+    fa::briefcase,
+    fa::user_tie,
+    fa::camera_web,
+    fa::square_user,
+    fa::typo3,
+    fa::s,
+    fa::landmark_dome,
+    fa::building_columns,
+    fa::staff_aesculapius,
+    fa::alarm_clock,
+    fa::shuttlecock,
+    fa::keyboard_brightness_low,
+    fa::person_carry_box,
+    fa::expand,
+    fa::face_holding_back_tears,
+    fa::folder_gear,
+    fa::water_arrow_up,
+    fa::flask,
+    fa::snowman_head,
+    fa::fish_cooked,
+    fa::star_exclamation,
+    fa::up_down_left_right,
+    fa::arrow_down_long,
+    fa::box_archive,
+    fa::clock_three_thirty,
+    fa::hands_holding_diamond,
+    fa::grip,
+    fa::tumblr_square,
+    fa::language,
+    fa::trash_arrow_up,
+    fa::face_monocle,
+    fa::circle_nodes,
+    fa::turn_down,
+    fa::arrow_down_triangle_square,
+    fa::mp3_player,
+    fa::face_grin_tongue,
+    fa::alarm_plus,
+    fa::chalkboard,
+    fa::face_hand_yawn,
+    fa::bus_simple,
+    fa::person_snowboarding,
+    fa::location_minus,
+    fa::face_tired,
+    fa::pump_medical,
+    fa::hockey_sticks,
+    fa::user_police_tie,
+    fa::border_top,
+    fa::car_rear,
+    fa::meta,
+    fa::tower_control,
+    fa::narwhal,
+    fa::arrow_down_up_lock,
+    fa::paperclip,
+    fa::value_absolute,
+    fa::text_slash,
+    fa::mortar_pestle,
+    fa::credit_card_front,
+    fa::siren_on,
+    fa::traffic_light_slow,
+    fa::mound,
+    fa::ellipsis,
+    fa::school_circle_check,
+    fa::vacuum_robot,
+    fa::transporter_6,
+    fa::turn_down_right,
+    fa::circle_right,
+    fa::anchor_circle_xmark,
+    fa::circle_chevron_down,
+    fa::right_to_bracket,
+    fa::message_arrow_up,
+    fa::scale_unbalanced,
+    fa::candy_cane,
+    fa::face_laugh_squint,
+    fa::person_skating,
+    fa::mosque,
+    fa::house,
+    fa::aviato,
+    fa::dollar_sign,
+    fa::house_circle_exclamation,
+    fa::wifi_weak,
+    fa::poll_people,
+    fa::delete_right,
+    fa::flag_checkered,
+    fa::phone_flip,
+    fa::align_left,
+    fa::face_grin_stars,
+    fa::diagram_subtask,
+    fa::vial_virus,
+    fa::triangle_exclamation,
+    fa::mixer,
+    fa::hand_holding_hand,
+    fa::mattress_pillow,
+    fa::face_flushed,
+    fa::money_simple_from_bracket,
+    fa::person,
+    fa::circle_down_left,
+    fa::mug_saucer,
+    fa::message_sms,
+    fa::reacteurope,
+    fa::gas_pump,
+    fa::satellite_dish,
+    fa::hooli,
+    fa::people_simple,
+    fa::arrows_turn_to_dots,
+    fa::house_water,
+    fa::hands_bubbles,
+    fa::face_clouds,
+    fa::music_note_slash,
+    fa::signal_stream,
+    fa::face_dotted,
+    fa::tire,
+    fa::tree_palm,
+    fa::rupee_sign,
+    fa::car_side,
+    fa::mars_and_venus_burst,
+    fa::book_open_cover,
+    fa::dial,
+    fa::sack,
+    fa::block_brick,
+    fa::file_lines,
+    fa::tent_arrow_left_right,
+    fa::ruler_triangle,
+    fa::arrow_right_to_line,
+    fa::caret_down,
+    fa::arrow_down_arrow_up,
+    fa::forumbee,
+    fa::circle_ampersand,
+    fa::oil_temperature,
+    fa::deer,
+    fa::image_landscape,
+    fa::person_digging,
+    fa::download,
+    fa::disc_drive,
+    fa::square_0,
+    fa::lacrosse_stick,
+    fa::swords_laser,
+    fa::palfed,
+    fa::boxes_stacked,
+    fa::dailymotion,
+    fa::html5,
+    fa::face_frown,
+    fa::figma,
+    fa::confluence,
+    fa::uikit,
+    fa::arrow_down_wide_short,
+    fa::square_8,
+    fa::glide,
+    fa::keybase,
+    fa::face_smile_hearts,
+    fa::clock_three,
+    fa::message_image,
+    fa::eye_dropper_half,
+    fa::sushi_roll,
+    fa::person_hiking,
+    fa::camera_rotate,
+    fa::xmark,
+    fa::buromobelexperte,
+    fa::square_caret_down,
+    fa::steering_wheel,
+    fa::korvue,
+    fa::folder_open,
+    fa::transgender,
+    fa::cloud_fog,
+    fa::game_board_simple,
+    fa::keyboard,
+    fa::arrows_to_dot,
+    fa::square_virus,
+    fa::wifi_exclamation,
+    fa::xing_square,
+    fa::weixin,
+    fa::head_side_heart,
+    fa::forward,
+    fa::pi,
+    fa::calendar_image,
+    fa::hourglass,
+    fa::gears,
+    fa::grid,
+    fa::database,
+    fa::circle_z,
+    fa::mendeley,
+    fa::spell_check,
+    fa::temperature_full,
+    fa::arrow_up_short_wide,
+    fa::gauge_simple_max,
+    fa::ram,
+    fa::arrow_up_z_a,
+    fa::square_chevron_right,
+    fa::signal_bars_fair,
+    fa::circle_xmark,
+    fa::mastodon,
+    fa::wheat,
+    fa::scribd,
+    fa::chart_line,
+    fa::bow_arrow,
+    fa::magnifying_glass,
+    fa::face_smile_beam,
+    fa::face_fearful,
+    fa::message_medical,
+    fa::stripe,
+    fa::aperture,
+    fa::face_confused,
+    fa::city,
+    fa::train_subway_tunnel,
+    fa::arrows_from_line,
+    fa::spinner,
+    fa::hundred_points,
+    fa::pegasus,
+    fa::mars_stroke,
+    fa::hands_holding,
+    fa::washing_machine,
+    fa::users,
+    fa::clock_two,
+    fa::bars_progress,
+    fa::pretzel,
+    fa::cpanel,
+    fa::phone_rotary,
+    fa::diagram_venn,
+    fa::helmet_un,
+    fa::apple_pay,
+    fa::gauge_simple_min,
+    fa::plug_circle_check,
+    fa::clock_rotate_left,
+    fa::server,
+    fa::gamepad_modern,
+    fa::shredder,
+    fa::arrow_down_1_9,
+    fa::handshake_angle,
+    fa::code_merge,
+    fa::calendar_week,
+    fa::brackets_curly,
+    fa::screen_users,
+    fa::gauge_simple_max,
+    fa::playstation,
+    fa::plug_circle_exclamation,
+    fa::hand_point_right,
+    fa::face_grin_hearts,
+    fa::store,
+    fa::starship_freighter,
+    fa::place_of_worship,
+    fa::circle_play,
+    fa::tumblr,
+    fa::hand_wave,
+    fa::bacteria,
+    fa::plane,
+    fa::envelopes,
+    fa::cloud_music,
+    fa::clock_six_thirty,
+    fa::jack_o_lantern,
+    fa::camera_cctv,
+    fa::mask_snorkel,
+    fa::star_half,
+    fa::circle_sort,
+    fa::plane_arrival,
+    fa::hackerrank,
+    fa::spider_black_widow,
+    fa::briefcase_blank,
+    fa::flag,
+    fa::book_open_reader,
+    fa::hamsa,
+    fa::forward_step,
+    fa::circle_sort_up,
+    fa::person_circle_xmark,
+    fa::slot_machine,
+    fa::terminal,
+    fa::arrows_turn_right,
+    fa::split,
+    fa::spaghetti_monster_flying,
+    fa::mask,
+    fa::scanner_touchscreen,
+    fa::creative_commons_remix,
+    fa::distribute_spacing_horizontal,
+    fa::plug_circle_minus,
+    fa::clock_twelve_thirty,
+    fa::face_smirking,
+    fa::circle_sort_down,
+    fa::grapes,
+    fa::gauge_high,
+    fa::florin_sign,
+    fa::map_location,
+    fa::thumbs_up,
+    fa::heart_half_stroke,
+    fa::grid_horizontal,
+    fa::jug_detergent,
+    fa::bus_school,
+    fa::circle_chevron_right,
+    fa::presentation_screen,
+    fa::lock_a,
+    fa::signal_fair,
+    fa::flower_daffodil,
+    fa::teamspeak,
+    fa::buysellads,
+    fa::arrow_up_long,
+    fa::check_to_slot,
+    fa::ban_parking,
+    fa::steam,
+    fa::arrow_up_to_line,
+    fa::square_caret_up,
+    fa::circle,
+    fa::comment_text,
+    fa::face_smile_relaxed,
+    fa::mailchimp,
+    fa::temperature_half,
+    fa::clock_four_thirty,
+    fa::outlet,
+    fa::golang,
+    fa::industry_windows,
+    fa::dribbble,
+    fa::weight_scale,
+    fa::book_circle_arrow_right,
+    fa::square_up_right,
+    fa::temperature_arrow_down,
+    fa::align_justify,
+    fa::circle_caret_right,
+    fa::paw_simple,
+    fa::wine_glass_crack,
+    fa::broccoli,
+    fa::plug,
+    fa::prescription_bottle_medical,
+    fa::turkish_lira_sign,
+    fa::cassette_betamax,
+    fa::snooze,
+    fa::file_pen,
+    fa::handshake_angle,
+    fa::trash,
+    fa::person_walking_arrow_loop_left,
+    fa::vial,
+    fa::feather_pointed,
+    fa::house_tsunami,
+    fa::vial_circle_check,
+    fa::dice_two,
+    fa::signal_bars_weak,
+    fa::mars_stroke_up,
+    fa::engine_warning,
+    fa::prescription_bottle,
+    fa::train_subway,
+    fa::retweet,
+    fa::css3,
+    fa::themeco,
+    fa::list_ul,
+    fa::yandex,
+    fa::do_not_enter,
+    fa::helmet_safety,
+    fa::star_sharp_half_stroke,
+    fa::location_dot,
+    fa::plane_circle_check,
+    fa::wine_glass_crack,
+    fa::galactic_republic,
+    fa::arrow_down_z_a,
+    fa::circle_check,
+    fa::wind_warning,
+    fa::scale_unbalanced_flip,
+    fa::jedi_order,
+    fa::person_falling,
+    fa::nfc_slash,
+    fa::slack,
+    fa::paintbrush_pencil,
+    fa::bookmark,
+    fa::wind_warning,
+    fa::signal_bars_fair,
+    fa::crate_empty,
+    fa::fishing_rod,
+    fa::crop,
+    fa::siren,
+    fa::user_hair_long,
+    fa::hands_asl_interpreting,
+    fa::tarp_droplet,
+    fa::_3,
+    fa::feather_pointed,
+    fa::building_lock,
+    fa::get_pocket,
+    fa::square_question,
+    fa::hourglass_empty,
+    fa::pen_to_square,
+    fa::circle_phone,
+    fa::message_middle,
+    fa::ruble_sign,
+    fa::d_and_d_beyond,
+    fa::user_pilot,
+    fa::car_bump,
+    fa::cloud_bolt,
+    fa::glass,
+    fa::wave_triangle,
+    fa::house_chimney_medical,
+    fa::earth_oceania,
+    fa::person_praying,
+    fa::fish,
+    fa::gitlab,
+    fa::file_circle_exclamation,
+    fa::cassette_betamax,
+    fa::taxi,
+    fa::artstation,
+    fa::raygun,
+    fa::message_arrow_up_right,
+    fa::eraser,
+    fa::shuffle,
+    fa::cloud_drizzle,
+    fa::face_grimace,
+    fa::book_heart,
+    fa::facebook_messenger,
+    fa::yelp,
+    fa::strawberry,
+    fa::trash_can_undo,
+    fa::ear_listen,
+    fa::block_question,
+    fa::comments_dollar,
+    fa::om,
+    fa::chevrons_right,
+    fa::coconut,
+    fa::spinner_third,
+    fa::circle_w,
+    fa::unicorn,
+    fa::road_barrier,
+    fa::sterling_sign,
+    fa::archway,
+    fa::hospital_user,
+    fa::slash,
+    fa::cassette_vhs,
+    fa::user_check,
+    fa::fonticons,
+    fa::map_location,
+    fa::wifi_slash,
+    fa::arrow_up_triangle_square,
+    fa::square_c,
+    fa::arrow_rotate_right,
+    fa::algolia,
+    fa::film_simple,
+    fa::volume_xmark,
+    fa::compass_drafting,
+    fa::field_hockey_stick_ball,
+    fa::square_ring,
+    fa::globe,
+    fa::dial_low,
+    fa::backpack,
+    fa::message_smile,
+    fa::buffer,
+    fa::link,
+    fa::calendar_circle_user,
+    fa::boxing_glove,
+    fa::person_falling_burst,
+    fa::y_combinator,
+    fa::java,
+    fa::messages_dollar,
+    fa::contao,
+    fa::face_drooling,
+    fa::road_bridge,
+    fa::table_tennis_paddle_ball,
+    fa::hand_point_ribbon,
+    fa::git,
+    fa::cloud_fog,
+    fa::pen_line,
+    fa::farm,
+    fa::brackets_square,
+    fa::arrow_up_from_line,
+    fa::instalod,
+    fa::chevrons_down,
+    fa::circle_microphone_lines,
+    fa::node,
+    fa::chart_column,
+    fa::cloud_exclamation,
+    fa::wagon_covered,
+    fa::wrench_simple,
+    fa::cash_register,
+    fa::gear,
+    fa::train_tunnel,
+    fa::firefox,
+    fa::person_biking_mountain,
+    fa::border_top_left,
+    fa::cannabis,
+    fa::paintbrush,
+    fa::money_bill_wheat,
+    fa::browsers,
+    fa::arrow_trend_up,
+    fa::bottle_water,
+    fa::wikipedia_w,
+    fa::school_lock,
+    fa::chart_network,
+    fa::hand_back_point_ribbon,
+    fa::circle_radiation,
+    fa::tablet_screen_button,
+    fa::chart_pie_simple,
+    fa::rainbow,
+    fa::jar_wheat,
+    fa::atom_simple,
+    fa::user_crown,
+    fa::heart_circle_exclamation,
+    fa::escalator,
+    fa::line_height,
+    fa::file_circle_check,
+    fa::down_to_line,
+    fa::face_thermometer,
+    fa::clock_nine_thirty,
+    fa::face_grin_beam_sweat,
+    fa::scale_balanced,
+    fa::rectangle_xmark,
+    fa::face_kiss_beam,
+    fa::burger_cheese,
+    fa::circle_k,
+    fa::won_sign,
+    fa::code_pull_request_draft,
+    fa::bezier_curve,
+    fa::truck_front,
+    fa::medrt,
+    fa::building_un,
+    fa::phone_arrow_down_left,
+    fa::hands_holding_dollar,
+    fa::file_invoice,
+    fa::sensor_fire,
+    fa::amilia,
+    fa::paint_roller,
+    fa::calendar_arrow_up,
+    fa::mosquito,
+    fa::tree_christmas,
+    fa::shirt_running,
+    fa::camera_slash,
+    fa::scythe,
+    fa::pepper_hot,
+    fa::dash,
+    fa::house_medical_circle_exclamation,
+    fa::face_grimace,
+    fa::elementor,
+    fa::people_arrows_left_right,
+    fa::ticket_airline,
+    fa::box_taped,
+    fa::stamp,
+    fa::clock,
+    fa::signal_bars,
+    fa::h2,
+    fa::scroll_torah,
+    fa::arrow_up_right_and_arrow_down_left_from_center,
+    fa::house_turret,
+    fa::comment_check,
+    fa::timeline,
+    fa::comment_middle,
+    fa::cloud_sun,
+    fa::olive_branch,
+    fa::user_doctor_message,
+    fa::skull,
+    fa::js,
+    fa::route_highway,
+    fa::tty,
+    fa::temperature_arrow_up,
+    fa::lines_leaning,
+    fa::mountain_city,
+    fa::people_dress_simple,
+    fa::less_than,
+    fa::head_side_cough_slash,
+    fa::face_sad_sweat,
+    fa::inboxes,
+    fa::message_arrow_up,
+    fa::signal_weak,
+    fa::chess_knight,
+    fa::sushi,
+    fa::horse_head,
+    fa::square_1,
+    fa::reddit_alien,
+    fa::circle_caret_left,
+    fa::folder_magnifying_glass,
+    fa::person_dolly_empty,
+    fa::music_note,
+    fa::house_medical_circle_xmark,
+    fa::id_card_clip,
+    fa::percent,
+    fa::xbox,
+    fa::monkey,
+    fa::eye_dropper,
+    fa::house_crack,
+    fa::eye_evil,
+    fa::nfc_symbol,
+    fa::box_dollar,
+    fa::arrow_left,
+    fa::bring_front,
+    fa::angles_right,
+    fa::grid_4,
+    fa::asymmetrik,
+    fa::bracket_curly_right,
+    fa::ankh,
+    fa::behance,
+    fa::book_section,
+    fa::arrow_up_to_dotted_line,
+    fa::restroom,
+    fa::phone_arrow_up_right,
+    fa::spaghetti_monster_flying,
+    fa::badger_honey,
+    fa::php,
+    fa::cow,
+    fa::square_h,
+    fa::crab,
+    fa::empty_set,
+    fa::sprinkler,
+    fa::hacker_news_square,
+    fa::sidebar_flip,
+    fa::car_rear,
+    fa::tents,
+    fa::message_xmark,
+    fa::flask_vial,
+    fa::camera_web,
+    fa::phabricator,
+    fa::salesforce,
+    fa::vials,
+    fa::ballot,
+    fa::computer_speaker,
+    fa::house_flag,
+    fa::code_compare,
+    fa::trash_can_list,
+    fa::uber,
+    fa::card_heart,
+    fa::shovel,
+    fa::jar,
+    fa::tent_arrows_down,
+    fa::hand_holding_dollar,
+    fa::location_plus,
+    fa::shield_exclamation,
+    fa::robot,
+    fa::box_check,
+    fa::fedex,
+    fa::cake_slice,
+    fa::lightbulb_exclamation,
+    fa::cart_circle_xmark,
+    fa::saxophone,
+    fa::arrow_up_right,
+    fa::arrows_repeat,
+    fa::link_horizontal_slash,
+    fa::litecoin_sign,
+    fa::face_smile_horns,
+    fa::suitcase,
+    fa::calendar_minus,
+    fa::globe_snow,
+    fa::comment_dots,
+    fa::music_slash,
+    fa::input_text,
+    fa::square_plus,
+    fa::horse_saddle,
+    fa::chess_pawn,
+    fa::uncharted,
+    fa::user_tie_hair,
+    fa::dollar_sign,
+    fa::temperature_full,
+    fa::couch,
+    fa::folder_arrow_up,
+    fa::grav,
+    fa::house_blank,
+    fa::blender,
+    fa::btc,
+    fa::overline,
+    fa::crow,
+    fa::list_music,
+    fa::megaphone,
+    fa::person_military_rifle,
+    fa::bone,
+    fa::trash_can_arrow_up,
+    fa::cubes,
+    fa::vine,
+    fa::butter,
+    fa::chart_pie,
+    fa::bed_empty,
+    fa::clock_nine,
+    fa::message_minus,
+    fa::reddit_square,
+    fa::table_rows,
+    fa::hashtag_lock,
+    fa::people,
+    fa::fort_awesome,
+    fa::reply_clock,
+    fa::r_project,
+    fa::display_code,
+    fa::gauge_min,
+    fa::comment_xmark,
+    fa::hand_back_point_down,
+    fa::comment_minus,
+    fa::plane_engines,
+    fa::heading,
+    fa::down_long,
+    fa::raspberry_pi,
+    fa::waffle,
+    fa::align_right,
+    fa::image_portrait,
+    fa::flask_round_potion,
+    fa::comment_smile,
+    fa::google,
+    fa::window_minimize,
+    fa::keyboard_left,
+    fa::ban_parking,
+    fa::suitcase_medical,
+    fa::signs_post,
+    fa::dumpster,
+    fa::cloud_check,
+    fa::champagne_glass,
+    fa::road_lock,
+    fa::paw_simple,
+    fa::locust,
+    fa::face_sleepy,
+    fa::window,
+    fa::ellipsis_stroke_vertical,
+    fa::angles_down,
+    fa::house_laptop,
+    fa::money_bill_1_wave,
+    fa::plane_circle_exclamation,
+    fa::baby,
+    fa::periscope,
+    fa::gauge,
+    fa::hippo,
+    fa::wheelchair_move,
+    fa::circle_b,
+    fa::circle_x,
+    fa::scanner,
+    fa::cake_candles,
+    fa::avocado,
+    fa::eye_low_vision,
+    fa::shield_heart,
+    fa::ethereum,
+    fa::tent_arrow_down_to_line,
+    fa::headphones,
+    fa::arrow_down_to_square,
+    fa::bore_hole,
+    fa::ear_deaf,
+    fa::table_columns,
+    fa::scroll,
+    fa::user_doctor_message,
+    fa::unity,
+    fa::people_pulling,
+    fa::gamepad,
+    fa::whatsapp_square,
+    fa::teeth_open,
+    fa::blogger_b,
+    fa::face_grin_tears,
+    fa::brain_arrow_curved_right,
+    fa::hand_holding_medical,
+    fa::address_book,
+    fa::donut,
+    fa::print_magnifying_glass,
+    fa::lemon,
+    fa::bread_slice_butter,
+    fa::baby_carriage,
+    fa::rocketchat,
+    fa::renren,
+    fa::align_slash,
+    fa::objects_align_center_horizontal,
+    fa::face_smile_tongue,
+    fa::pallet_boxes,
+    fa::face_sad_cry,
+    fa::signal_bars_weak,
+    fa::signal_bars,
+    fa::plus,
+    fa::photo_film,
+    fa::wind,
+    fa::address_card,
+    fa::sun_haze,
+    fa::lollipop,
+    fa::arrows_split_up_and_left,
+    fa::chevrons_left,
+    fa::watch,
+    fa::car_wrench,
+    fa::circle_user,
+    fa::arrow_turn_down_right,
+    fa::truck_container_empty,
+    fa::symbols,
+    fa::turn_up,
+    fa::calendar_heart,
+    fa::skull_crossbones,
+    fa::notdef,
+    fa::nfc_signal,
+    fa::sliders_up,
+    fa::trash_slash,
+    fa::note_medical,
+    fa::dog,
+    fa::person_carry_box,
+    fa::child_rifle,
+    fa::icicles,
+    fa::phone_slash,
+    fa::face_rolling_eyes,
+    fa::list,
+    fa::inbox_in,
+    fa::chess_board,
+    fa::mars,
+    fa::lamp,
+    fa::heart_circle_check,
+    fa::bold,
+    fa::face_explode,
+    fa::aws,
+    fa::lightbulb_exclamation_on,
+    fa::brain_circuit,
+    fa::racquet,
+    fa::q,
+    fa::person_running,
+    fa::tornado,
+    fa::golf_ball_tee,
+    fa::option,
+    fa::hands_holding_heart,
+    fa::arrow_down_9_1,
+    fa::hands_bound,
+    fa::user_doctor_hair_long,
+    fa::shop_slash,
+    fa::bed_pulse,
+    fa::radio_tuner,
+    fa::bridge_lock,
+    fa::pen_clip_slash,
+    fa::mountain_sun,
+    fa::square_arrow_up,
+    fa::utility_pole,
+    fa::caravan,
+    fa::album_collection_circle_user,
+    fa::smog,
+    fa::calendar_days,
+    fa::signal_good,
+    fa::wordpress,
+    fa::party_bell,
+    fa::book_sparkles,
+    fa::arrow_right_to_arc,
+    fa::bath,
+    fa::fulcrum,
+    fa::arrows_to_dotted_line,
+    fa::bars_filter,
+    fa::comment_middle_top,
+    fa::ns8,
+    fa::face_laugh_squint,
+    fa::xmark,
+    fa::arrow_down_to_dotted_line,
+    fa::gofore,
+    fa::synagogue,
+    fa::location_arrow,
+    fa::ban_bug,
+    fa::amazon_pay,
+    fa::wheat_awn_slash,
+    fa::circle_microphone_lines,
+    fa::cherries,
+    fa::circle_location_arrow,
+    fa::snowman,
+    fa::pen,
+    fa::circle_waveform_lines,
+    fa::chrome,
+    fa::at,
+    fa::sandwich,
+    fa::user_clock,
+    fa::square_star,
+    fa::magnet,
+    fa::file_csv,
+    fa::turkish_lira_sign,
+    fa::bowling_ball_pin,
+    fa::gauge_simple_high,
+    fa::canadian_maple_leaf,
+    fa::pump_soap,
+    fa::camera_web_slash,
+    fa::gauge_high,
+    fa::circle_chevron_up,
+    fa::receipt,
+    fa::shapes,
+    fa::window_maximize,
+    fa::audio_description_slash,
+    fa::album_collection_circle_plus,
+    fa::jug,
+    fa::bell_school,
+    fa::transporter_4,
+    fa::kickstarter_k,
+    fa::farm,
+    fa::shield_halved,
+    fa::cat_space,
+    fa::location_pin,
+    fa::face_mask,
+    fa::chart_candlestick,
+    fa::cloud_rainbow,
+    fa::tablets,
+    fa::face_sad_tear,
+    fa::files_medical,
+    fa::face_surprise,
+    fa::circle_s,
+    fa::gauge_max,
+    fa::location_pen,
+    fa::face_smile_upside_down,
+    fa::thought_bubble,
+    fa::linkedin_in,
+    fa::square_rootiable,
+    fa::hospital,
+    fa::input_numeric,
+    fa::truck_ramp_box,
+    fa::image,
+    fa::house_person_leave,
+    fa::photo_film_music,
+    fa::hands_asl_interpreting,
+    fa::bridge_circle_xmark,
+    fa::stop,
+    fa::square_6,
+    fa::arrow_down_from_line,
+    fa::truck_field,
+    fa::arrows_down_to_people,
+    fa::ellipsis_stroke,
+    fa::square_phone_flip,
+    fa::sickle,
+    fa::bell_concierge,
+    fa::gauge_simple,
+    fa::message_music,
+    fa::calendars,
+    fa::list_ol,
+    fa::arrows_left_right_to_line,
+    fa::cart_shopping_fast,
+    fa::face_expressionless,
+    fa::candy_bar,
+    fa::train_tram,
+    fa::dove,
+    fa::pen_circle,
+    fa::beer_mug_empty,
+    fa::scalpel_line_dashed,
+    fa::coffee_beans,
+    fa::chart_waterfall,
+    fa::cc_amazon_pay,
+    fa::headphones_simple,
+    fa::lock,
+    fa::i_cursor,
+    fa::square_envelope,
+    fa::money_bill_transfer,
+    fa::creative_commons_zero,
+    fa::sack_dollar,
+    fa::square_up,
+    fa::message_slash,
+    fa::volume_slash,
+    fa::square_fragile,
+    fa::ticket_simple,
+    fa::square_parking_slash,
+    fa::corn,
+    fa::cart_flatbed,
+    fa::smoking,
+    fa::brightness_low,
+    fa::cart_flatbed_empty,
+    fa::arrows_up_to_line,
+    fa::code,
+    fa::_1,
+    fa::message_plus,
+    fa::battery_quarter,
+    fa::tickets_airline,
+    fa::screwdriver,
+    fa::cc_jcb,
+    fa::brush,
+    fa::rectangle_history,
+    fa::frog,
+    fa::cart_circle_exclamation,
+    fa::stars,
+    fa::brightness,
+    fa::curling_stone,
+    fa::hand_dots,
+    fa::radio,
+    fa::hands,
+    fa::google_wallet,
+    fa::border_center_v,
+    fa::circle_envelope,
+    fa::inbox_full,
+    fa::face_angry,
+    fa::coin_front,
+    fa::face_thinking,
+    fa::message_middle,
+    fa::chalkboard_user,
+    fa::xing,
+    fa::ruler_horizontal,
+    fa::hand_love,
+    fa::parachute_box,
+    fa::spray_can_sparkles,
+    fa::phone_arrow_up_right,
+    fa::chart_area,
+    fa::train_track,
+    fa::face_hand_over_mouth,
+    fa::_500px,
+    fa::money_check_pen,
+    fa::comment,
+    fa::face_zany,
+    fa::pipe_collar,
+    fa::circle_o,
+    fa::scanner,
+    fa::deezer,
+    fa::cart_arrow_down,
+    fa::trash_xmark,
+    fa::book_quran,
+    fa::sensor_on,
+    fa::comment_pen,
+    fa::house_chimney_user,
+    fa::reddit,
+    fa::tree_deciduous,
+    fa::instagram_square,
+    fa::stopwatch,
+    fa::rotate,
+    fa::left_long,
+    fa::slash_forward,
+    fa::boot,
+    fa::caret_up,
+    fa::sort,
+    fa::piano_keyboard,
+    fa::pager,
+    fa::yen_sign,
+    fa::arrow_turn_up,
+    fa::down_left_and_up_right_to_center,
+    fa::suitcase_medical,
+    fa::font_awesome,
+    fa::sun,
+    fa::centercode,
+    fa::eject,
+    fa::gauge_low,
+    fa::phone_intercom,
+    fa::id_card,
+    fa::wind_turbine,
+    fa::creative_commons_sampling,
+    fa::balloons,
+    fa::arrow_rotate_left,
+    fa::person_dress,
+    fa::swords,
+    fa::heart_pulse,
+    fa::_6,
+    fa::person_simple,
+    fa::grip_dots_vertical,
+    fa::user_large,
+    fa::viacoin,
+    fa::house_chimney_blank,
+    fa::square_parking,
+    fa::telescope,
+    fa::house_medical_circle_check,
+    fa::maximize,
+    fa::venus_double,
+    fa::clone,
+    fa::face_surprise,
+    fa::magnifying_glass_dollar,
+    fa::sterling_sign,
+    fa::comment_sms,
+    fa::glass_empty,
+    fa::audio_description,
+    fa::arrow_down_triangle_square,
+    fa::hand_fist,
+    fa::chart_pyramid,
+    fa::rabbit_running,
+    fa::deskpro,
+    fa::square_arrow_down,
+    fa::maximize,
+    fa::field_hockey_stick_ball,
+    fa::circle_p,
+    fa::bracket_square,
+    fa::burger_fries,
+    fa::sellcast,
+    fa::explosion,
+    fa::shower_down,
+    fa::house_medical,
+    fa::location_xmark,
+    fa::itunes_note,
+    fa::blinds_raised,
+    fa::patreon,
+    fa::face_weary,
+    fa::user_doctor,
+    fa::section,
+    fa::badge_check,
+    fa::building_circle_xmark,
+    fa::dna,
+    fa::arrow_down_big_small,
+    fa::bracket_square,
+    fa::volleyball,
+    fa::print_magnifying_glass,
+    fa::usps,
+    fa::dolly,
+    fa::vent_damper,
+    fa::chess_knight_piece,
+    fa::arrow_up_1_9,
+    fa::clapperboard,
+    fa::tugrik_sign,
+    fa::odnoklassniki_square,
+    fa::person_dress,
+    fa::droplet_degree,
+    fa::square_phone_hangup,
+    fa::repeat,
+    fa::tractor,
+    fa::cloud_bolt_sun,
+    fa::circle_f,
+    fa::id_card,
+    fa::face_grin_squint,
+    fa::image_slash,
+    fa::house_chimney_window,
+    fa::user_large_slash,
+    fa::right_to_bracket,
+    fa::file_pdf,
+    fa::heart_circle_bolt,
+    fa::compress,
+    fa::book_user,
+    fa::screencast,
+    fa::location_crosshairs,
+    fa::signal_strong,
+    fa::road_spikes,
+    fa::person_from_portal,
+    fa::person_to_portal,
+    fa::person_skiing,
+    fa::donut,
+    fa::volume_xmark,
+    fa::hand_middle_finger,
+    fa::image_polaroid_user,
+    fa::heart_crack,
+    fa::fingerprint,
+    fa::message_exclamation,
+    fa::cmplid,
+    fa::house_laptop,
+    fa::binary_slash,
+    fa::_2,
+    fa::bacterium,
+    fa::panorama,
+    fa::hornbill,
+    fa::clock_ten,
+    fa::books,
+    fa::rotate,
+    fa::traffic_light_stop,
+    fa::command,
+    fa::vihara,
+    fa::blueberries,
+    fa::person_rifle,
+    fa::sunrise,
+    fa::right_long,
+    fa::unsplash,
+    fa::arrows_to_line,
+    fa::box_open_full,
+    fa::face_grin_hearts,
+    fa::file_signature,
+    fa::car_mirrors,
+    fa::camera,
+    fa::building_wheat,
+    fa::stack_overflow,
+    fa::octagon_check,
+    fa::arrow_down_z_a,
+    fa::circle_arrow_up_right,
+    fa::floppy_disk_circle_xmark,
+    fa::album_collection,
+    fa::node_js,
+    fa::chair_office,
+    fa::flashlight,
+    fa::trash_can_check,
+    fa::cc_mastercard,
+    fa::car_garage,
+    fa::tower_cell,
+    fa::hat_cowboy,
+    fa::plane_tail,
+    fa::folder_user,
+    fa::money_bill_simple_wave,
+    fa::acorn,
+    fa::pen_field,
+    fa::expeditedssl,
+    fa::money_check_dollar_pen,
+    fa::person_snowmobiling,
+    fa::squirrel,
+    fa::rotate_left,
+    fa::schlix,
+    fa::door_open,
+    fa::venus,
+    fa::plus_minus,
+    fa::heart_crack,
+    fa::plant_wilt,
+    fa::police_box,
+    fa::message_lines,
+    fa::ear_deaf,
+    fa::poo_storm,
+    fa::face_tongue_money,
+    fa::message,
+    fa::pen_nib,
+    fa::luchador_mask,
+    fa::circle_quarter,
+    fa::diagram_next,
+    fa::circle_down_right,
+    fa::diamond_turn_right,
+    fa::osi,
+    fa::location_exclamation,
+    fa::jet_fighter,
+    fa::bitbucket,
+    fa::autoprefixer,
+    fa::face_tired,
+    fa::circle_chevron_left,
+    fa::watchman_monitoring,
+    fa::peso_sign,
+    fa::fire_hydrant,
+    fa::bird,
+    fa::sleigh,
+    fa::motorcycle,
+    fa::folder,
+    fa::gauge,
+    fa::saxophone_fire,
+    fa::volume_off,
+    fa::comments,
+    fa::font,
+    fa::tablet_screen_button,
+    fa::circle_left,
+    fa::taco,
+    fa::space_station_moon_construction,
+    fa::messages_question,
+    fa::car,
+    fa::circle_arrow_left,
+    fa::users_rectangle,
+    fa::turkish_lira_sign,
+    fa::arrow_right_to_city,
+    fa::diamond_turn_right,
+    fa::face_pensive,
+    fa::diagram_sankey,
+    fa::file_certificate,
+    fa::star_sharp_half_stroke,
+    fa::megaport,
+    fa::child_reaching,
+    fa::right_to_line,
+    fa::head_side_brain,
+    fa::steam_square,
+    fa::shield_halved,
+    fa::arrow_down_from_line,
+    fa::dice_one,
+    fa::gears,
+    fa::location_smile,
+    fa::sliders_up,
+    fa::whiskey_glass_ice,
+    fa::car_circle_bolt,
+    fa::money_check_dollar_pen,
+    fa::disease,
+    fa::chevrons_left,
+    fa::signal_strong,
+    fa::adversal,
+    fa::face_sleeping,
+    fa::_00,
+    fa::studiovinari,
+    fa::castle,
+    fa::person_skiing_nordic,
+    fa::calendar_day,
+    fa::engine,
+    fa::panel_fire,
+    fa::images_user,
+    fa::seedling,
+    fa::circle_left,
+    fa::arrow_up_from_square,
+    fa::plane_lock,
+    fa::tag,
+    fa::toilet_paper,
+    fa::image_user,
+    fa::hand_point_down,
+    fa::bridge_circle_check,
+    fa::compact_disc,
+    fa::integral,
+    fa::free_code_camp,
+    fa::copy,
+    fa::shield_xmark,
+    fa::pallet_box,
+    fa::photo_film,
+    fa::bacon,
+    fa::badge,
+    fa::desktop,
+    fa::timeline_arrow,
+    fa::hundred_points,
+    fa::circle_location_arrow,
+    fa::ban_smoking,
+    fa::cart_flatbed,
+    fa::scissors,
+    fa::file_waveform,
+    fa::ruler_combined,
+    fa::square_caret_right,
+    fa::border_bottom_right,
+    fa::floppy_disks,
+    fa::square_ampersand,
+    fa::list_check,
+    fa::square_u,
+    fa::clock_two_thirty,
+    fa::trillium,
+    fa::hose,
+    fa::twitch,
+    fa::trash_can_clock,
+    fa::ellipsis_stroke,
+    fa::crystal_ball,
+    fa::air_conditioner,
+    fa::trash_plus,
+    fa::droplet,
+    fa::garage,
+    fa::square_sliders_vertical,
+    fa::newspaper,
+    fa::book_skull,
+    fa::arrow_right_from_bracket,
+    fa::square_info,
+    fa::person_burst,
+    fa::table_cells_large,
+    fa::sticker_mule,
+    fa::clipboard_list_check,
+    fa::hospital,
+    fa::circle_u,
+    fa::heart_pulse,
+    fa::maxcdn,
+    fa::square_chevron_left,
+    fa::moon_stars,
+    fa::tooth,
+    fa::stroopwafel,
+    fa::mug_tea,
+    fa::temperature_quarter,
+    fa::lock_keyhole,
+    fa::arrow_trend_down,
+    fa::heat,
+    fa::wpbeginner,
+    fa::files,
+    fa::people_roof,
+    fa::face_zipper,
+    fa::trash_can_undo,
+    fa::message_pen,
+    fa::bugs,
+    fa::pear,
+    fa::hourglass,
+    fa::uniform_martial_arts,
+    fa::credit_card_blank,
+    fa::face_grin_tears,
+    fa::face_rolling_eyes,
+    fa::guilded,
+    fa::paperclip_vertical,
+    fa::octagon_exclamation,
+    fa::grid_dividers,
+    fa::edge_legacy,
+    fa::black_tie,
+    fa::lightbulb,
+    fa::laptop_medical,
+    fa::circle_heart,
+    fa::square_o,
+    fa::eclipse,
+    fa::instagram,
+    fa::stairs,
+    fa::sprinkler_ceiling,
+    fa::redhat,
+    fa::cloud_snow,
+    fa::house_flood_water,
+    fa::tenge_sign,
+    fa::light_switch_on,
+    fa::basket_shopping,
+    fa::cloud_slash,
+    fa::file_plus,
+    fa::fill_drip,
+    fa::notes_medical,
+    fa::wifi_fair,
+    fa::futbol,
+    fa::lock_keyhole,
+    fa::container_storage,
+    fa::face_grin_wink,
+    fa::person_breastfeeding,
+    fa::euro_sign,
+    fa::jet_fighter,
+    fa::hot_tub_person,
+    fa::pump,
+    fa::arrow_down_from_dotted_line,
+    fa::diagram_lean_canvas,
+    fa::circle_dollar_to_slot,
+    fa::not_equal,
+    fa::route,
+    fa::whistle,
+    fa::elephant,
+    fa::clock_eleven_thirty,
+    fa::fondue_pot,
+    fa::message_plus,
+    fa::file_circle_xmark,
+    fa::forward_fast,
+    fa::mask_ventilator,
+    fa::arrow_up_big_small,
+    fa::arrow_right_from_line,
+    fa::circle_6,
+    fa::face_flushed,
+    fa::projector,
+    fa::arrow_up_square_triangle,
+    fa::the_red_yeti,
+    fa::lightbulb_slash,
+    fa::football,
+    fa::arrow_pointer,
+    fa::coffee_bean,
+    fa::beer_mug_empty,
+    fa::blinds,
+    fa::pallet_boxes,
+    fa::display,
+    fa::phoenix_squadron,
+    fa::martini_glass_citrus,
+    fa::temperature_snow,
+    fa::object_union,
+    fa::chart_tree_map,
+    fa::file_user,
+    fa::circle_chevron_left,
+    fa::face_worried,
+    fa::cloud_meatball,
+    fa::road_circle_check,
+    fa::message_check,
+    fa::arrow_up_9_1,
+    fa::trumpet,
+    fa::first_order,
+    fa::watch_apple,
+    fa::oil_can_drip,
+    fa::messages_dollar,
+    fa::circle_notch,
+    fa::star_and_crescent,
+    fa::baseball_bat_ball,
+    fa::face_smile_wink,
+    fa::hourglass_start,
+    fa::location_xmark,
+    fa::book_bookmark,
+    fa::card_diamond,
+    fa::gun_squirt,
+    fa::raindrops,
+    fa::trophy_star,
+    fa::toilet_paper_under,
+    fa::down_to_line,
+    fa::bowl_scoops,
+    fa::chalkboard_user,
+    fa::bimobject,
+    fa::apostrophe,
+    fa::head_side_mask,
+    fa::arrow_right_long_to_line,
+    fa::discord,
+    fa::circle_r,
+    fa::droplet_degree,
+    fa::tally,
+    fa::temperature_three_quarters,
+    fa::circle_a,
+    fa::chart_area,
+    fa::sparkles,
+    fa::message_check,
+    fa::sunset,
+    fa::file_medical,
+    fa::circle_star,
+    fa::bowling_ball,
+    fa::file_powerpoint,
+    fa::vacuum,
+    fa::book_bible,
+    fa::umbrella_simple,
+    fa::manhole,
+    fa::badminton,
+    fa::avianex,
+    fa::tally_1,
+    fa::circle_right,
+    fa::_360_degrees,
+    fa::person_skiing,
+    fa::screwdriver_wrench,
+    fa::wine_bottle,
+    fa::thumbtack,
+    fa::rocket,
+    fa::temperature_three_quarters,
+    fa::angle_right,
+    fa::location_dot,
+    fa::water_arrow_down,
+    fa::chart_line,
+    fa::pizza_slice,
+    fa::user_music,
+    fa::temperature_empty,
+    fa::house_person_leave,
+    fa::calendar_arrow_down,
+    fa::cucumber,
+    fa::user_headset,
+    fa::stopwatch_20,
+    fa::k,
+    fa::square_g,
+    fa::pool_8_ball,
+    fa::phone_office,
+    fa::circle_chevron_up,
+    fa::pinterest_p,
+    fa::h4,
+    fa::salt_shaker,
+    fa::hexagon_xmark,
+    fa::squarespace,
+    fa::pumpkin,
+    fa::message_minus,
+    fa::slack,
+    fa::shield_plus,
+    fa::money_bill_1,
+    fa::map_pin,
+    fa::chart_radar,
+    fa::screen_users,
+    fa::angles_down,
+    fa::person_walking_with_cane,
+    fa::camera_movie,
+    fa::clipboard_user,
+    fa::teddy_bear,
+    fa::jenkins,
+    fa::card_club,
+    fa::bug_slash,
+    fa::chromecast,
+    fa::bridge_suspension,
+    fa::cassette_vhs,
+    fa::trees,
+    fa::fort_awesome_alt,
+    fa::yarn,
+    fa::map_location_dot,
+    fa::arrow_up_from_dotted_line,
+    fa::xmark_to_slot,
+    fa::hat_santa,
+    fa::turkey,
+    fa::dice_six,
+    fa::book_arrow_right,
+    fa::sunglasses,
+    fa::file_contract,
+    fa::upload,
+    fa::face_kiss_wink_heart,
+    fa::chevron_up,
+    fa::tiktok,
+    fa::album,
+    fa::message,
+    fa::comment_question,
+    fa::staff_aesculapius,
+    fa::hand_horns,
+    fa::cabin,
+    fa::up_to_line,
+    fa::glass_half,
+    fa::suse,
+    fa::grip_lines_vertical,
+    fa::train_tram,
+    fa::cupcake,
+    fa::trophy_star,
+    fa::microphone_lines,
+    fa::down_to_dotted_line,
+    fa::discourse,
+    fa::meteor,
+    fa::t,
+    fa::question,
+    fa::treasure_chest,
+    fa::tty,
+    fa::square_info,
+    fa::drumstick,
+    fa::arrow_right_to_bracket,
+    fa::octagon_divide,
+    fa::users_line,
+    fa::user_tie_hair_long,
+    fa::glass_citrus,
+    fa::scroll_torah,
+    fa::square_minus,
+    fa::manat_sign,
+    fa::chestnut,
+    fa::floppy_disk_circle_xmark,
+    fa::calendar_lines_pen,
+    fa::medapps,
+    fa::wifi_fair,
+    fa::turn_down,
+    fa::staff,
+    fa::mars_stroke_right,
+    fa::old_republic,
+    fa::share_all,
+    fa::columns_3,
+    fa::x,
+    fa::gauge,
+    fa::pen_nib_slash,
+    fa::hurricane,
+    fa::pen_swirl,
+    fa::circle_2,
+    fa::cloudflare,
+    fa::trash_arrow_up,
+    fa::ranking_star,
+    fa::arrow_up_to_line,
+    fa::mobile,
+    fa::object_subtract,
+    fa::road_circle_exclamation,
+    fa::face_icicles,
+    fa::chart_pie,
+    fa::folder_arrow_down,
+    fa::floppy_disk,
+    fa::hashnode,
+    fa::temperature_three_quarters,
+    fa::sensor_triangle_exclamation,
+    fa::xmark,
+    fa::display_arrow_down,
+    fa::fire_flame_curved,
+    fa::horizontal_rule,
+    fa::microsoft,
+    fa::vest_patches,
+    fa::ferry,
+    fa::user_secret,
+    fa::circle_minus,
+    fa::mizuni,
+    fa::face_smile_plus,
+    fa::gifts,
+    fa::arrow_up_from_arc,
+    fa::user_doctor_hair,
+    fa::location_pin_slash,
+    fa::pallet_boxes,
+    fa::rectangle_ad,
+    fa::circle_dollar,
+    fa::person_arrow_up_from_line,
+    fa::xmark_to_slot,
+    fa::note,
+    fa::triangle_instrument,
+    fa::comment_arrow_up_right,
+    fa::user_nurse_hair_long,
+    fa::repeat_1,
+    fa::fire_flame_curved,
+    fa::mosquito_net,
+    fa::cloud_plus,
+    fa::book_blank,
+    fa::square_k,
+    fa::gopuram,
+    fa::snowflakes,
+    fa::paste,
+    fa::cat,
+    fa::arrows_down_to_line,
+    fa::club,
+    fa::taxi_bus,
+    fa::sigma,
+    fa::circle_play,
+    fa::user_robot_xmarks,
+    fa::dog_leashed,
+    fa::adn,
+    fa::user_doctor,
+    fa::hand_spock,
+    fa::nutritionix,
+    fa::tombstone_blank,
+    fa::tarp,
+    fa::recycle,
+    fa::bucket,
+    fa::file_binary,
+    fa::cc_visa,
+    fa::meat,
+    fa::shekel_sign,
+    fa::right,
+    fa::file_waveform,
+    fa::shekel_sign,
+    fa::wand_magic,
+    fa::conveyor_belt_empty,
+    fa::earlybirds,
+    fa::won_sign,
+    fa::helicopter_symbol,
+    fa::popsicle,
+    fa::pig,
+    fa::temperature_arrow_up,
+    fa::quotes,
+    fa::circle_i,
+    fa::grip_vertical,
+    fa::down,
+    fa::bandage,
+    fa::toilet_paper_under_slash,
+    fa::face_viewfinder,
+    fa::flag_swallowtail,
+    fa::paragraph,
+    fa::banjo,
+    fa::user_group_crown,
+    fa::temperature_high,
+    fa::mobile_notch,
+    fa::head_side_headphones,
+    fa::amp_guitar,
+    fa::circle_exclamation,
+    fa::kip_sign,
+    fa::internet_explorer,
+    fa::arrow_down_short_wide,
+    fa::spider,
+    fa::down_right,
+    fa::x_ray,
+    fa::closed_captioning,
+    fa::file_arrow_up,
+    fa::face_persevering,
+    fa::mobile_screen_button,
+    fa::money_bill_simple,
+    fa::ellipsis_vertical,
+    fa::truck_plow,
+    fa::octagon_plus,
+    fa::e,
+    fa::people_line,
+    fa::location_crosshairs,
+    fa::pills,
+    fa::indian_rupee_sign,
+    fa::chess_king_piece,
+    fa::volleyball,
+    fa::campfire,
+    fa::arrow_down_a_z,
+    fa::bed,
+    fa::draft2digital,
+    fa::codepen,
+    fa::clock_eleven,
+    fa::sort_up,
+    fa::dice_d10,
+    fa::transformer_bolt,
+    fa::circle_arrow_up_left,
+    fa::circle_microphone,
+    fa::messages,
+    fa::circle_video,
+    fa::scanner_gun,
+    fa::user_tag,
+    fa::h,
+    fa::bluetooth,
+    fa::user_vneck_hair_long,
+    fa::pan_frying,
+    fa::circle_h,
+    fa::_9,
+    fa::circle_caret_right,
+    fa::drone_front,
+    fa::mars_double,
+    fa::lasso_sparkles,
+    fa::square_parking,
+    fa::arrows_up_down,
+    fa::code_branch,
+    fa::circle_bolt,
+    fa::stumbleupon_circle,
+    fa::circle_caret_up,
+    fa::arrow_up_right_from_square,
+    fa::sun_plant_wilt,
+    fa::angular,
+    fa::signal_fair,
+    fa::users_slash,
+    fa::venus_mars,
+    fa::code_commit,
+    fa::arrow_right_from_bracket,
+    fa::square_d,
+    fa::arrows_cross,
+    fa::ioxhost,
+    fa::fire_flame_simple,
+    fa::circle_plus,
+    fa::goodreads_g,
+    fa::glass_water,
+    fa::circle_camera,
+    fa::up_down,
+    fa::mobile_screen,
+    fa::shutters,
+    fa::booth_curtain,
+    fa::hotdog,
+    fa::dumbbell,
+    fa::mobile_screen_button,
+    fa::circle_three_quarters,
+    fa::flipboard,
+    fa::file_lock,
+    fa::medium,
+    fa::car_on,
+    fa::circle_5,
+    fa::percent,
+    fa::hand_dots,
+    fa::calendar_xmark,
+    fa::people_carry_box,
+    fa::arrows_up_down_left_right,
+    fa::graduation_cap,
+    fa::martini_glass_empty,
+    fa::vuejs,
+    fa::boombox,
+    fa::napster,
+    fa::truck_medical,
+    fa::viruses,
+    fa::diaspora,
+    fa::square_sliders,
+    fa::battery_low,
+    fa::face_grin,
+    fa::alien_8bit,
+    fa::yin_yang,
+    fa::display_medical,
+    fa::red_river,
+    fa::boxing_glove,
+    fa::face_sunglasses,
+    fa::tape,
+    fa::triangle_person_digging,
+    fa::chart_bar,
+    fa::broom_ball,
+    fa::torii_gate,
+    fa::cauldron,
+    fa::shekel_sign,
+    fa::circle_minus,
+    fa::ear_deaf,
+    fa::genderless,
+    fa::lollipop,
+    fa::hire_a_helper,
+    fa::dice_d4,
+    fa::map,
+    fa::folder_heart,
+    fa::gauge_simple,
+    fa::square_share_nodes,
+    fa::file_minus,
+    fa::circle_xmark,
+    fa::sass,
+    fa::linux,
+    fa::qq,
+    fa::speaker_deck,
+    fa::computer_classic,
+    fa::hand_sparkles,
+    fa::gratipay,
+    fa::temperature_snow,
+    fa::shield_cross,
+    fa::ebay,
+    fa::microchip_ai,
+    fa::hand_holding_dollar,
+    fa::game_board_simple,
+    fa::beer_mug,
+    fa::location_question,
+    fa::landmark_dome,
+    fa::plane_up,
+    fa::cart_flatbed_boxes,
+    fa::people_dress,
+    fa::twitter_square,
+    fa::person_harassing,
+    fa::house_user,
+    fa::square_check,
+    fa::octagon_xmark,
+    fa::message_medical,
+    fa::fork_knife,
+    fa::train_subway_tunnel,
+    fa::bracket_curly,
+    fa::chess_queen_piece,
+    fa::bookmark_slash,
+    fa::comment_pen,
+    fa::kaaba,
+    fa::hospital,
+    fa::display_code,
+    fa::hourglass,
+    fa::key,
+    fa::face_grin,
+    fa::trash_undo,
+    fa::cc_diners_club,
+    fa::skyatlas,
+    fa::hat_wizard,
+    fa::joomla,
+    fa::crate_apple,
+    fa::square_left,
+    fa::rss,
+    fa::quote_left,
+    fa::meetup,
+    fa::camera_viewfinder,
+    fa::hand_pointer,
+    fa::volume_high,
+    fa::sidebar,
+    fa::cloud_arrow_down,
+    fa::shelves,
+    fa::cabinet_filing,
+    fa::engine_warning,
+    fa::bed_bunk,
+    fa::burger_glass,
+    fa::rectangle_vertical,
+    fa::right_from_line,
+    fa::building_circle_check,
+    fa::lamp_desk,
+    fa::water_ladder,
+    fa::robot_astromech,
+    fa::seedling,
+    fa::palette,
+    fa::camera_web_slash,
+    fa::galaxy,
+    fa::folder_minus,
+    fa::plane_engines,
+    fa::location_xmark,
+    fa::message_captions,
+    fa::space_station_moon_construction,
+    fa::circle_down,
+    fa::oven,
+    fa::sushi_roll,
+    fa::swift,
+    fa::minimize,
+    fa::cloud_showers_heavy,
+    fa::file_invoice_dollar,
+    fa::wheat_slash,
+    fa::fork,
+    fa::scale_balanced,
+    fa::tire_flat,
+    fa::curling_stone,
+    fa::circle_dot,
+    fa::square_font_awesome,
+    fa::whatsapp,
+    fa::folder_music,
+    fa::opera,
+    fa::camera_security,
+    fa::paragraph_left,
+    fa::lightbulb_dollar,
+    fa::route_interstate,
+    fa::arrow_down_small_big,
+    fa::oil_can,
+    fa::android,
+    fa::grid_2_plus,
+    fa::up_from_bracket,
+    fa::circle_up_left,
+    fa::moon,
+    fa::thumbtack,
+    fa::handshake_simple,
+    fa::digg,
+    fa::rectangle_pro,
+    fa::thumbs_down,
+    fa::user_nurse,
+    fa::left_long,
+    fa::address_card,
+    fa::wand_magic_sparkles,
+    fa::face_spiral_eyes,
+    fa::cake_slice,
+    fa::golf_club,
+    fa::speakers,
+    fa::truck_ramp,
+    fa::laptop_file,
+    fa::teeth,
+    fa::foursquare,
+    fa::divide,
+    fa::angles_left,
+    fa::trash_can_plus,
+    fa::dial_high,
+    fa::square_quarters,
+    fa::pix,
+    fa::bell_on,
+    fa::circle_arrow_up,
+    fa::arrow_up_a_z,
+    fa::list_dropdown,
+    fa::cloud_hail_mixed,
+    fa::square_arrow_up_right,
+    fa::share_from_square,
+    fa::message_dots,
+    fa::square_chevron_up,
+    fa::toilet,
+    fa::arrow_up_9_1,
+    fa::face_diagonal_mouth,
+    fa::user_group,
+    fa::glasses_round,
+    fa::border_center_h,
+    fa::centos,
+    fa::tty_answer,
+    fa::sun_bright,
+    fa::google_drive,
+    fa::champagne_glasses,
+    fa::face_awesome,
+    fa::temperature_sun,
+    fa::box_archive,
+    fa::orcid,
+    fa::star_of_david,
+    fa::folder_arrow_down,
+    fa::battery_slash,
+    fa::google_plus_square,
+    fa::cloudscale,
+    fa::luchador_mask,
+    fa::toolbox,
+    fa::fort,
+    fa::bowl_food,
+    fa::telegram,
+    fa::hand_holding_box,
+    fa::face_grin_squint_tears,
+    fa::bullseye,
+    fa::cedi_sign,
+    fa::cloud_bolt,
+    fa::forklift,
+    fa::speakap,
+    fa::user_pen,
+    fa::bullseye_pointer,
+    fa::stretcher,
+    fa::money_bills_simple,
+    fa::cloud_rain,
+    fa::check_to_slot,
+    fa::creative_commons_sampling_plus,
+    fa::tree_deciduous,
+    fa::warehouse_full,
+    fa::hotjar,
+    fa::user_large,
+    fa::battery_three_quarters,
+    fa::user_visor,
+    fa::chart_simple_horizontal,
+    fa::cricket_bat_ball,
+    fa::circle_check,
+    fa::square_chevron_down,
+    fa::cloudversify,
+    fa::flatbread,
+    fa::chess_rook_piece,
+    fa::headset,
+    fa::gem,
+    fa::blackberry,
+    fa::docker,
+    fa::arrows_repeat,
+    fa::face_relieved,
+    fa::padlet,
+    fa::supple,
+    fa::arrows_minimize,
+    fa::face_angry_horns,
+    fa::building_user,
+    fa::starfighter_twin_ion_engine,
+    fa::eye_dropper,
+    fa::circle_arrow_right,
+    fa::earth_oceania,
+    fa::utensils_slash,
+    fa::house,
+    fa::alicorn,
+    fa::users_between_lines,
+    fa::diploma,
+    fa::paste,
+    fa::camcorder,
+    fa::lock_keyhole_open,
+    fa::envelopes_bulk,
+    fa::meter,
+    fa::coin,
+    fa::comment_exclamation,
+    fa::file_video,
+    fa::person_skiing_nordic,
+    fa::mandolin,
+    fa::file_heart,
+    fa::first_order_alt,
+    fa::safari,
+    fa::van_shuttle,
+    fa::linode,
+    fa::coffin,
+    fa::check_double,
+    fa::road,
+    fa::conveyor_belt_boxes,
+    fa::soft_serve,
+    fa::bars_progress,
+    fa::rotate_right,
+    fa::file_export,
+    fa::hand_holding_skull,
+    fa::dial_max,
+    fa::diagram_previous,
+    fa::square_y,
+    fa::battery_exclamation,
+    fa::bowling_pins,
+    fa::person_walking,
+    fa::tilde,
+    fa::cart_circle_check,
+    fa::beer_mug,
+    fa::book_copy,
+    fa::sheet_plastic,
+    fa::envelope_open,
+    fa::money_check_dollar,
+    fa::kit_medical,
+    fa::hotel,
+    fa::address_card,
+    fa::up_from_line,
+    fa::arrows_rotate,
+    fa::houzz,
+    fa::square_poll_vertical,
+    fa::house_circle_check,
+    fa::square_caret_up,
+    fa::superpowers,
+    fa::table_list,
+    fa::wand,
+    fa::person_circle_exclamation,
+    fa::toggle_on,
+    fa::house_building,
+    fa::clock_ten_thirty,
+    fa::face_swear,
+    fa::minus,
+    fa::money_bill_trend_up,
+    fa::child,
+    fa::ramp_loading,
+    fa::rebel,
+    fa::building_columns,
+    fa::piggy_bank,
+    fa::location_check,
+    fa::trash_can_slash,
+    fa::face_smile_halo,
+    fa::bars_sort,
+    fa::hand,
+    fa::draw_square,
+    fa::temperature_half,
+    fa::book_open_reader,
+    fa::nfc_directional,
+    fa::microphone_lines,
+    fa::box_taped,
+    fa::vimeo,
+    fa::glide_g,
+    fa::face_beam_hand_over_mouth,
+    fa::house_user,
+    fa::gauge_circle_minus,
+    fa::square_left,
+    fa::signal_bars_slash,
+    fa::battery_low,
+    fa::itunes,
+    fa::up_down_left_right,
+    fa::weibo,
+    fa::ubuntu,
+    fa::hourglass_end,
+    fa::plus_large,
+    fa::chess_pawn_piece,
+    fa::message_middle_top,
+    fa::face_pleading,
+    fa::sensor_cloud,
+    fa::lips,
+    fa::person_half_dress,
+    fa::fonticons_fi,
+    fa::hat_winter,
+    fa::deer_rudolph,
+    fa::clock_one_thirty,
+    fa::face_sad_tear,
+    fa::function,
+    fa::truck_monster,
+    fa::face_anxious_sweat,
+    fa::house_water,
+    fa::circle_c,
+    fa::chevrons_up,
+    fa::laptop,
+    fa::person_biking,
+    fa::head_side,
+    fa::pineapple,
+    fa::shoe_prints,
+    fa::cowbell_circle_plus,
+    fa::video_arrow_up_right,
+    fa::sourcetree,
+    fa::link_horizontal,
+    fa::cloud_minus,
+    fa::windows,
+    fa::basket_shopping_simple,
+    fa::meter_bolt,
+    fa::sink,
+    fa::indian_rupee_sign,
+    fa::face_hand_peeking,
+    fa::star_half_stroke,
+    fa::clock_eight_thirty,
+    fa::calendar_arrow_down,
+    fa::person_running,
+    fa::share,
+    fa::bandcamp,
+    fa::bag_shopping,
+    fa::vector_polygon,
+    fa::arrow_up_small_big,
+    fa::_4,
+    fa::prescription_bottle_medical,
+    fa::person_snowboarding,
+    fa::shelves_empty,
+    fa::face_grin_tongue_squint,
+    fa::burrito,
+    fa::arrows_from_dotted_line,
+    fa::vimeo_v,
+    fa::cookie,
+    fa::droplet_slash,
+    fa::comma,
+    fa::arrow_up_long,
+    fa::square_exclamation,
+    fa::rabbit_running,
+    fa::square_plus,
+    fa::shop,
+    fa::laptop_arrow_down,
+    fa::music_note,
+    fa::mars_and_venus,
+    fa::calendar_days,
+    fa::square_rss,
+    fa::volume,
+    fa::apple,
+    fa::caravan_simple,
+    fa::display_slash,
+    fa::award,
+    fa::spoon,
+    fa::link_slash,
+    fa::up_right_and_down_left_from_center,
+    fa::app_store_ios,
+    fa::truck_bolt,
+    fa::circle_caret_up,
+    fa::arrow_up_right_from_square,
+    fa::bracket_round,
+    fa::bahai,
+    fa::square_p,
+    fa::user_hair_mullet,
+    fa::house_flood_water_circle_arrow_right,
+    fa::location_pin_lock,
+    fa::envelope_open_dollar,
+    fa::face_grin_tongue_wink,
+    fa::corner,
+    fa::square_divide,
+    fa::microchip,
+    fa::message_dots,
+    fa::kerning,
+    fa::khanda,
+    fa::folder_medical,
+    fa::pie,
+    fa::share_from_square,
+    fa::filter_circle_dollar,
+    fa::person_circle_question,
+    fa::clarinet,
+    fa::code_simple,
+    fa::paper_plane_top,
+    fa::users_medical,
+    fa::square_right,
+    fa::square_phone,
+    fa::square_arrow_up_left,
+    fa::cotton_bureau,
+    fa::trash_can_undo,
+    fa::fish_fins,
+    fa::house_person_return,
+    fa::scissors,
+    fa::yen_sign,
+    fa::mace,
+    fa::cart_plus,
+    fa::fork,
+    fa::cc_paypal,
+    fa::record_vinyl,
+    fa::ski_boot_ski,
+    fa::peanuts,
+    fa::radio_tuner,
+    fa::face_saluting,
+    fa::file_circle_plus,
+    fa::ellipsis_stroke_vertical,
+    fa::boxes_stacked,
+    fa::buildings,
+    fa::people_pants_simple,
+    fa::circle_8,
+    fa::clock_desk,
+    fa::xmarks_lines,
+    fa::staylinked,
+    fa::hand_fingers_crossed,
+    fa::message_slash,
+    fa::signal_bars_good,
+    fa::face_confounded,
+    fa::chart_line_down,
+    fa::face_pouting,
+    fa::utensils,
+    fa::file_magnifying_glass,
+    fa::pizza,
+    fa::utensils,
+    fa::square_nfi,
+    fa::display_medical,
+    fa::bell_school_slash,
+    fa::square_terminal,
+    fa::computer_mouse,
+    fa::face_cowboy_hat,
+    fa::user_hair_mullet,
+    fa::circle_xmark,
+    fa::martini_glass_empty,
+    fa::wifi,
+    fa::waze,
+    fa::hood_cloak,
+    fa::square_poll_horizontal,
+    fa::equals,
+    fa::chess_queen,
+    fa::square_arrow_down_right,
+    fa::ellipsis_vertical,
+    fa::meter_droplet,
+    fa::imdb,
+    fa::car_battery,
+    fa::candy_bar,
+    fa::chevron_down,
+    fa::text_width,
+    fa::microphone,
+    fa::calendar_exclamation,
+    fa::link_slash,
+    fa::dice,
+    fa::ring,
+    fa::can_food,
+    fa::hand_heart,
+    fa::rectangle_list,
+    fa::nfc_magnifying_glass,
+    fa::bracket_round,
+    fa::hammer,
+    fa::lights_holiday,
+    fa::tty_answer,
+    fa::face_kiss,
+    fa::intersection,
+    fa::hill_avalanche,
+    fa::potato,
+    fa::drumstick_bite,
+    fa::plus,
+    fa::arrow_down_a_z,
+    fa::circle_parking,
+    fa::hospitals,
+    fa::arrows_retweet,
+    fa::bread_loaf,
+    fa::forward_fast,
+    fa::bracket_round_right,
+    fa::yoast,
+    fa::wifi,
+    fa::face_tissue,
+    fa::square_up_right,
+    fa::chart_bar,
+    fa::magnifying_glass_minus,
+    fa::credit_card,
+    fa::opencart,
+    fa::page4,
+    fa::rust,
+    fa::earth_europe,
+    fa::border_right,
+    fa::presentation_screen,
+    fa::temperature_empty,
+    fa::folder_plus,
+    fa::blinds_open,
+    fa::crutches,
+    fa::salad,
+    fa::bell,
+    fa::airbnb,
+    fa::snapchat,
+    fa::traffic_cone,
+    fa::phoenix_framework,
+    fa::melon,
+    fa::wine_glass_empty,
+    fa::satellite,
+    fa::helmet_safety,
+    fa::chart_gantt,
+    fa::arrow_down_short_wide,
+    fa::children,
+    fa::standard_definition,
+    fa::arrow_down_to_line,
+    fa::ballot_check,
+    fa::mill_sign,
+    fa::deviantart,
+    fa::draw_polygon,
+    fa::gauge_simple_min,
+    fa::house_chimney,
+    fa::face_tongue_sweat,
+    fa::file_lines,
+    fa::clipboard,
+    fa::rings_wedding,
+    fa::border_all,
+    fa::hexagon_image,
+    fa::train_subway,
+    fa::tencent_weibo,
+    fa::circle_e,
+    fa::calendar_lines,
+    fa::podcast,
+    fa::square_xmark,
+    fa::triangle,
+    fa::page_caret_up,
+    fa::burger_soda,
+    fa::shield_dog,
+    fa::paintbrush_fine,
+    fa::calendar_pen,
+    fa::scanner_keyboard,
+    fa::credit_card,
+    fa::css3_alt,
+    fa::chess_bishop_piece,
+    fa::arrows_rotate,
+    fa::google_plus,
+    fa::pen_fancy,
+    fa::binary_circle_check,
+    fa::gauge_simple,
+    fa::bell_concierge,
+    fa::bowl_scoop,
+    fa::clock_seven,
+    fa::note_sticky,
+    fa::user_lock,
+    fa::person_chalkboard,
+    fa::github,
+    fa::building_flag,
+    fa::snapchat_square,
+    fa::chess_knight_piece,
+    fa::uniregistry,
+    fa::coin_vertical,
+    fa::ship,
+    fa::h6,
+    fa::up_to_dotted_line,
+    fa::knife,
+    fa::arrow_rotate_left,
+    fa::square_check,
+    fa::reel,
+    fa::brackets_round,
+    fa::square_9,
+    fa::envira,
+    fa::lastfm,
+    fa::arrow_down_small_big,
+    fa::square_this_way_up,
+    fa::block_brick_fire,
+    fa::strikethrough,
+    fa::coffee_pot,
+    fa::circle_dashed,
+    fa::sailboat,
+    fa::images,
+    fa::universal_access,
+    fa::trash_can,
+    fa::inbox,
+    fa::signal_bars_slash,
+    fa::paintbrush_fine,
+    fa::family_pants,
+    fa::face_smile_beam,
+    fa::person_snowmobiling,
+    fa::mistletoe,
+    fa::building_circle_exclamation,
+    fa::chimney,
+    fa::signal_stream_slash,
+    fa::square_arrow_down_left,
+    fa::pen_clip,
+    fa::npm,
+    fa::whiskey_glass,
+    fa::git_alt,
+    fa::user_helmet_safety,
+    fa::key_skeleton,
+    fa::tv,
+    fa::angle,
+    fa::signature_lock,
+    fa::clouds_sun,
+    fa::luchador_mask,
+    fa::seat_airline,
+    fa::sd_card,
+    fa::d_and_d,
+    fa::arrow_down_9_1,
+    fa::award_simple,
+    fa::chart_user,
+    fa::pancakes,
+    fa::spade,
+    fa::face_downcast_sweat,
+    fa::flower,
+    fa::face_smile_plus,
+    fa::arrow_up_arrow_down,
+    fa::send_back,
+    fa::signal,
+    fa::arrow_down_right,
+    fa::bowl_scoop,
+    fa::object_intersect,
+    fa::face_meh_blank,
+    fa::chess_bishop_piece,
+    fa::radiation,
+    fa::face_scream,
+    fa::basketball_hoop,
+    fa::mitten,
+    fa::paper_plane_top,
+    fa::square_parking_slash,
+    fa::star_of_life,
+    fa::arrow_up_from_bracket,
+    fa::location_crosshairs_slash,
+    fa::helmet_safety,
+    fa::dolly,
+    fa::phone_volume,
+};
+
+/// Returns the slot of the given name, or -1 if the name is unknown
+template <typename Char>
+constexpr int nameSlot( const Char* name, int length )
+{
+    int32_t displacement = nameDisplacements[nameHash(0, name, length) % nameCount];
+    int slot = displacement < 0 ? -displacement - 1 : int(nameHash(uint32_t(displacement), name, length) % nameCount);
+    const char* candidate = namePool + nameOffsets[slot];
+    for( int i = 0; i < length; ++i ) {
+        if( candidate[i] == 0 || uint32_t(candidate[i]) != uint32_t(name[i]) ) {
+            return -1;
+        }
+    }
+    return candidate[length] == 0 ? slot : -1;
+}
+
+/// Not constexpr on purpose: an unknown name in a compile-time lookup ends up here and fails to compile
+inline int unknownIconName()
+{
+    return -1;
+}
+
+} // namespace detail
+
+/// Returns the style-qualified icon with the given name, or -1 if the name is unknown
+template <typename Char>
+constexpr int iconByName( const Char* name, int length )
+{
+    int slot = detail::nameSlot( name, length );
+    return slot < 0 ? -1 : detail::nameIcons[slot];
+}
+
+namespace detail {
+
+/// Returns the style-qualified icon with the given name. An unknown name isn't a constant expression
+template <int N>
+constexpr int checkedIconByName( const char (&name)[N] )
+{
+    return iconByName( name, N - 1 ) >= 0 ? iconByName( name, N - 1 ) : unknownIconName();
+}
+
+} // namespace detail
+
+#if defined(__cpp_consteval)
+/// Returns the style-qualified icon with the given name, resolved at compile time (C++20):
+///   int music = fa::byName("music");
+/// An unknown name doesn't compile. Use QTAWESOME_ICON() before C++20
+template <int N>
+consteval int byName( const char (&name)[N] )
+{
+    return detail::checkedIconByName( name );
+}
+#endif
+
+inline namespace literals {
+
+#if defined(__cpp_consteval)
+/// The icon literal, resolved at compile time like fa::byName() (C++20):
+///   using namespace fa::literals;
+///   QIcon icon = awesome->icon( "music"_fa );
+consteval int operator""_fa( const char* name, std::size_t length )
+{
+    return iconByName( name, int(length) ) >= 0 ? iconByName( name, int(length) ) : detail::unknownIconName();
+}
+#endif
+
+} // namespace literals
+
+} // namespace fa
+
+/// The style-qualified icon with the given name, resolved at compile time with every C++ standard:
+///   QIcon icon = awesome->icon( QTAWESOME_ICON("music") );
+/// An unknown name doesn't compile: the template argument must be a constant expression
+#define QTAWESOME_ICON(name) (std::integral_constant<int, fa::detail::checkedIconByName( name )>::value)
+
+#endif // ENUM_NAME_HASH_H
@@ -0,0 +1,6877 @@
+// Generated by tools/faenumgen from icons.txt, do not edit
+
+#include "enum_name_index.h"
+
+const FANameIcon faNameIconArray[] = {
+    { "_0", fa::_0 },
+    { "_1", fa::_1 },
+    { "_2", fa::_2 },
+    { "_3", fa::_3 },
+    { "_4", fa::_4 },
+    { "_5", fa::_5 },
+    { "_6", fa::_6 },
+    { "_7", fa::_7 },
+    { "_8", fa::_8 },
+    { "_9", fa::_9 },
+    { "_00", fa::_00 },
+    { "_360_degrees", fa::_360_degrees },
+    { "a", fa::a },
+    { "abacus", fa::abacus },
+    { "accent_grave", fa::accent_grave },
+    { "acorn", fa::acorn },
+    { "address_book", fa::address_book },
+    { "contact_book", fa::address_book },
+    { "address_card", fa::address_card },
+    { "contact_card", fa::address_card },
+    { "vcard", fa::address_card },
+    { "air_conditioner", fa::air_conditioner },
+    { "airplay", fa::airplay },
+    { "alarm_clock", fa::alarm_clock },
+    { "alarm_exclamation", fa::alarm_exclamation },
+    { "alarm_plus", fa::alarm_plus },
+    { "alarm_snooze", fa::alarm_snooze },
+    { "album", fa::album },
+    { "album_circle_plus", fa::album_circle_plus },
+    { "album_circle_user", fa::album_circle_user },
+    { "album_collection", fa::album_collection },
+    { "album_collection_circle_plus", fa::album_collection_circle_plus },
+    { "album_collection_circle_user", fa::album_collection_circle_user },
+    { "alicorn", fa::alicorn },
+    { "alien", fa::alien },
+    { "alien_8bit", fa::alien_8bit },
+    { "alien_monster", fa::alien_8bit },
+    { "align_center", fa::align_center },
+    { "align_justify", fa::align_justify },
+    { "align_left", fa::align_left },
+    { "align_right", fa::align_right },
+    { "align_slash", fa::align_slash },
+    { "alt", fa::alt },
+    { "amp_guitar", fa::amp_guitar },
+    { "ampersand", fa::ampersand },
+    { "anchor", fa::anchor },
+    { "anchor_circle_check", fa::anchor_circle_check },
+    { "anchor_circle_exclamation", fa::anchor_circle_exclamation },
+    { "anchor_circle_xmark", fa::anchor_circle_xmark },
+    { "anchor_lock", fa::anchor_lock },
+    { "angel", fa::angel },
+    { "angle", fa::angle },
+    { "angle_90", fa::angle_90 },
+    { "angle_down", fa::angle_down },
+    { "angle_left", fa::angle_left },
+    { "angle_right", fa::angle_right },
+    { "angle_up", fa::angle_up },
+    { "angles_down", fa::angles_down },
+    { "angle_double_down", fa::angles_down },
+    { "angles_left", fa::angles_left },
+    { "angle_double_left", fa::angles_left },
+    { "angles_right", fa::angles_right },
+    { "angle_double_right", fa::angles_right },
+    { "angles_up", fa::angles_up },
+    { "angle_double_up", fa::angles_up },
+    { "ankh", fa::ankh },
+    { "apartment", fa::apartment },
+    { "aperture", fa::aperture },
+    { "apostrophe", fa::apostrophe },
+    { "apple_core", fa::apple_core },
+    { "apple_whole", fa::apple_whole },
+    { "apple_alt", fa::apple_whole },
+    { "archway", fa::archway },
+    { "arrow_down", fa::arrow_down },
+    { "arrow_down_1_9", fa::arrow_down_1_9 },
+    { "sort_numeric_asc", fa::arrow_down_1_9 },
+    { "sort_numeric_down", fa::arrow_down_1_9 },
+    { "arrow_down_9_1", fa::arrow_down_9_1 },
+    { "sort_numeric_desc", fa::arrow_down_9_1 },
+    { "sort_numeric_down_alt", fa::arrow_down_9_1 },
+    { "arrow_down_a_z", fa::arrow_down_a_z },
+    { "sort_alpha_asc", fa::arrow_down_a_z },
+    { "sort_alpha_down", fa::arrow_down_a_z },
+    { "arrow_down_arrow_up", fa::arrow_down_arrow_up },
+    { "sort_alt", fa::arrow_down_arrow_up },
+    { "arrow_down_big_small", fa::arrow_down_big_small },
+    { "sort_size_down", fa::arrow_down_big_small },
+    { "arrow_down_from_dotted_line", fa::arrow_down_from_dotted_line },
+    { "arrow_down_from_line", fa::arrow_down_from_line },
+    { "arrow_from_top", fa::arrow_down_from_line },
+    { "arrow_down_left", fa::arrow_down_left },
+    { "arrow_down_left_and_arrow_up_right_to_center", fa::arrow_down_left_and_arrow_up_right_to_center },
+    { "arrow_down_long", fa::arrow_down_long },
+    { "long_arrow_down", fa::arrow_down_long },
+    { "arrow_down_right", fa::arrow_down_right },
+    { "arrow_down_short_wide", fa::arrow_down_short_wide },
+    { "sort_amount_desc", fa::arrow_down_short_wide },
+    { "sort_amount_down_alt", fa::arrow_down_short_wide },
+    { "arrow_down_small_big", fa::arrow_down_small_big },
+    { "sort_size_down_alt", fa::arrow_down_small_big },
+    { "arrow_down_square_triangle", fa::arrow_down_square_triangle },
+    { "sort_shapes_down_alt", fa::arrow_down_square_triangle },
+    { "arrow_down_to_arc", fa::arrow_down_to_arc },
+    { "arrow_down_to_bracket", fa::arrow_down_to_bracket },
+    { "arrow_down_to_dotted_line", fa::arrow_down_to_dotted_line },
+    { "arrow_down_to_line", fa::arrow_down_to_line },
+    { "arrow_to_bottom", fa::arrow_down_to_line },
+    { "arrow_down_to_square", fa::arrow_down_to_square },
+    { "arrow_down_triangle_square", fa::arrow_down_triangle_square },
+    { "sort_shapes_down", fa::arrow_down_triangle_square },
+    { "arrow_down_up_across_line", fa::arrow_down_up_across_line },
+    { "arrow_down_up_lock", fa::arrow_down_up_lock },
+    { "arrow_down_wide_short", fa::arrow_down_wide_short },
+    { "sort_amount_asc", fa::arrow_down_wide_short },
+    { "sort_amount_down", fa::arrow_down_wide_short },
+    { "arrow_down_z_a", fa::arrow_down_z_a },
+    { "sort_alpha_desc", fa::arrow_down_z_a },
+    { "sort_alpha_down_alt", fa::arrow_down_z_a },
+    { "arrow_left", fa::arrow_left },
+    { "arrow_left_from_line", fa::arrow_left_from_line },
+    { "arrow_from_right", fa::arrow_left_from_line },
+    { "arrow_left_long", fa::arrow_left_long },
+    { "long_arrow_left", fa::arrow_left_long },
+    { "arrow_left_long_to_line", fa::arrow_left_long_to_line },
+    { "arrow_left_to_line", fa::arrow_left_to_line },
+    { "arrow_to_left", fa::arrow_left_to_line },
+    { "arrow_pointer", fa::arrow_pointer },
+    { "mouse_pointer", fa::arrow_pointer },
+    { "arrow_right", fa::arrow_right },
+    { "arrow_right_arrow_left", fa::arrow_right_arrow_left },
+    { "exchange", fa::arrow_right_arrow_left },
+    { "arrow_right_from_arc", fa::arrow_right_from_arc },
+    { "arrow_right_from_bracket", fa::arrow_right_from_bracket },
+    { "sign_out", fa::arrow_right_from_bracket },
+    { "arrow_right_from_line", fa::arrow_right_from_line },
+    { "arrow_from_left", fa::arrow_right_from_line },
+    { "arrow_right_long", fa::arrow_right_long },
+    { "long_arrow_right", fa::arrow_right_long },
+    { "arrow_right_long_to_line", fa::arrow_right_long_to_line },
+    { "arrow_right_to_arc", fa::arrow_right_to_arc },
+    { "arrow_right_to_bracket", fa::arrow_right_to_bracket },
+    { "sign_in", fa::arrow_right_to_bracket },
+    { "arrow_right_to_city", fa::arrow_right_to_city },
+    { "arrow_right_to_line", fa::arrow_right_to_line },
+    { "arrow_to_right", fa::arrow_right_to_line },
+    { "arrow_rotate_left", fa::arrow_rotate_left },
+    { "arrow_left_rotate", fa::arrow_rotate_left },
+    { "arrow_rotate_back", fa::arrow_rotate_left },
+    { "arrow_rotate_backward", fa::arrow_rotate_left },
+    { "undo", fa::arrow_rotate_left },
+    { "arrow_rotate_right", fa::arrow_rotate_right },
+    { "arrow_right_rotate", fa::arrow_rotate_right },
+    { "arrow_rotate_forward", fa::arrow_rotate_right },
+    { "redo", fa::arrow_rotate_right },
+    { "arrow_trend_down", fa::arrow_trend_down },
+    { "arrow_trend_up", fa::arrow_trend_up },
+    { "arrow_turn_down", fa::arrow_turn_down },
+    { "level_down", fa::arrow_turn_down },
+    { "arrow_turn_down_left", fa::arrow_turn_down_left },
+    { "arrow_turn_down_right", fa::arrow_turn_down_right },
+    { "arrow_turn_up", fa::arrow_turn_up },
+    { "level_up", fa::arrow_turn_up },
+    { "arrow_up", fa::arrow_up },
+    { "arrow_up_1_9", fa::arrow_up_1_9 },
+    { "sort_numeric_up", fa::arrow_up_1_9 },
+    { "arrow_up_9_1", fa::arrow_up_9_1 },
+    { "sort_numeric_up_alt", fa::arrow_up_9_1 },
+    { "arrow_up_a_z", fa::arrow_up_a_z },
+    { "sort_alpha_up", fa::arrow_up_a_z },
+    { "arrow_up_arrow_down", fa::arrow_up_arrow_down },
+    { "sort_up_down", fa::arrow_up_arrow_down },
+    { "arrow_up_big_small", fa::arrow_up_big_small },
+    { "sort_size_up", fa::arrow_up_big_small },
+    { "arrow_up_from_arc", fa::arrow_up_from_arc },
+    { "arrow_up_from_bracket", fa::arrow_up_from_bracket },
+    { "arrow_up_from_dotted_line", fa::arrow_up_from_dotted_line },
+    { "arrow_up_from_ground_water", fa::arrow_up_from_ground_water },
+    { "arrow_up_from_line", fa::arrow_up_from_line },
+    { "arrow_from_bottom", fa::arrow_up_from_line },
+    { "arrow_up_from_square", fa::arrow_up_from_square },
+    { "arrow_up_from_water_pump", fa::arrow_up_from_water_pump },
+    { "arrow_up_left", fa::arrow_up_left },
+    { "arrow_up_left_from_circle", fa::arrow_up_left_from_circle },
+    { "arrow_up_long", fa::arrow_up_long },
+    { "long_arrow_up", fa::arrow_up_long },
+    { "arrow_up_right", fa::arrow_up_right },
+    { "arrow_up_right_and_arrow_down_left_from_center", fa::arrow_up_right_and_arrow_down_left_from_center },
+    { "arrow_up_right_dots", fa::arrow_up_right_dots },
+    { "arrow_up_right_from_square", fa::arrow_up_right_from_square },
+    { "external_link", fa::arrow_up_right_from_square },
+    { "arrow_up_short_wide", fa::arrow_up_short_wide },
+    { "sort_amount_up_alt", fa::arrow_up_short_wide },
+    { "arrow_up_small_big", fa::arrow_up_small_big },
+    { "sort_size_up_alt", fa::arrow_up_small_big },
+    { "arrow_up_square_triangle", fa::arrow_up_square_triangle },
+    { "sort_shapes_up_alt", fa::arrow_up_square_triangle },
+    { "arrow_up_to_dotted_line", fa::arrow_up_to_dotted_line },
+    { "arrow_up_to_line", fa::arrow_up_to_line },
+    { "arrow_to_top", fa::arrow_up_to_line },
+    { "arrow_up_triangle_square", fa::arrow_up_triangle_square },
+    { "sort_shapes_up", fa::arrow_up_triangle_square },
+    { "arrow_up_wide_short", fa::arrow_up_wide_short },
+    { "sort_amount_up", fa::arrow_up_wide_short },
+    { "arrow_up_z_a", fa::arrow_up_z_a },
+    { "sort_alpha_up_alt", fa::arrow_up_z_a },
+    { "arrows_cross", fa::arrows_cross },
+    { "arrows_down_to_line", fa::arrows_down_to_line },
+    { "arrows_down_to_people", fa::arrows_down_to_people },
+    { "arrows_from_dotted_line", fa::arrows_from_dotted_line },
+    { "arrows_from_line", fa::arrows_from_line },
+    { "arrows_left_right", fa::arrows_left_right },
+    { "arrows_h", fa::arrows_left_right },
+    { "arrows_left_right_to_line", fa::arrows_left_right_to_line },
+    { "arrows_maximize", fa::arrows_maximize },
+    { "expand_arrows", fa::arrows_maximize },
+    { "arrows_minimize", fa::arrows_minimize },
+    { "compress_arrows", fa::arrows_minimize },
+    { "arrows_repeat", fa::arrows_repeat },
+    { "repeat_alt", fa::arrows_repeat },
+    { "arrows_repeat_1", fa::arrows_repeat_1 },
+    { "repeat_1_alt", fa::arrows_repeat_1 },
+    { "arrows_retweet", fa::arrows_retweet },
+    { "retweet_alt", fa::arrows_retweet },
+    { "arrows_rotate", fa::arrows_rotate },
+    { "refresh", fa::arrows_rotate },
+    { "sync", fa::arrows_rotate },
+    { "arrows_spin", fa::arrows_spin },
+    { "arrows_split_up_and_left", fa::arrows_split_up_and_left },
+    { "arrows_to_circle", fa::arrows_to_circle },
+    { "arrows_to_dot", fa::arrows_to_dot },
+    { "arrows_to_dotted_line", fa::arrows_to_dotted_line },
+    { "arrows_to_eye", fa::arrows_to_eye },
+    { "arrows_to_line", fa::arrows_to_line },
+    { "arrows_turn_right", fa::arrows_turn_right },
+    { "arrows_turn_to_dots", fa::arrows_turn_to_dots },
+    { "arrows_up_down", fa::arrows_up_down },
+    { "arrows_v", fa::arrows_up_down },
+    { "arrows_up_down_left_right", fa::arrows_up_down_left_right },
+    { "arrows", fa::arrows_up_down_left_right },
+    { "arrows_up_to_line", fa::arrows_up_to_line },
+    { "asterisk", fa::asterisk },
+    { "at", fa::at },
+    { "atom", fa::atom },
+    { "atom_simple", fa::atom_simple },
+    { "atom_alt", fa::atom_simple },
+    { "audio_description", fa::audio_description },
+    { "audio_description_slash", fa::audio_description_slash },
+    { "austral_sign", fa::austral_sign },
+    { "avocado", fa::avocado },
+    { "award", fa::award },
+    { "award_simple", fa::award_simple },
+    { "axe", fa::axe },
+    { "axe_battle", fa::axe_battle },
+    { "b", fa::b },
+    { "baby", fa::baby },
+    { "baby_carriage", fa::baby_carriage },
+    { "carriage_baby", fa::baby_carriage },
+    { "backpack", fa::backpack },
+    { "backward", fa::backward },
+    { "backward_fast", fa::backward_fast },
+    { "fast_backward", fa::backward_fast },
+    { "backward_step", fa::backward_step },
+    { "step_backward", fa::backward_step },
+    { "bacon", fa::bacon },
+    { "bacteria", fa::bacteria },
+    { "bacterium", fa::bacterium },
+    { "badge", fa::badge },
+    { "badge_check", fa::badge_check },
+    { "badge_dollar", fa::badge_dollar },
+    { "badge_percent", fa::badge_percent },
+    { "badge_sheriff", fa::badge_sheriff },
+    { "badger_honey", fa::badger_honey },
+    { "badminton", fa::badminton },
+    { "bag_shopping", fa::bag_shopping },
+    { "shopping_bag", fa::bag_shopping },
+    { "bagel", fa::bagel },
+    { "bags_shopping", fa::bags_shopping },
+    { "baguette", fa::baguette },
+    { "bahai", fa::bahai },
+    { "baht_sign", fa::baht_sign },
+    { "ball_pile", fa::ball_pile },
+    { "balloon", fa::balloon },
+    { "balloons", fa::balloons },
+    { "ballot", fa::ballot },
+    { "ballot_check", fa::ballot_check },
+    { "ban", fa::ban },
+    { "cancel", fa::ban },
+    { "ban_bug", fa::ban_bug },
+    { "debug", fa::ban_bug },
+    { "ban_parking", fa::ban_parking },
+    { "parking_circle_slash", fa::ban_parking },
+    { "ban_smoking", fa::ban_smoking },
+    { "smoking_ban", fa::ban_smoking },
+    { "banana", fa::banana },
+    { "bandage", fa::bandage },
+    { "band_aid", fa::bandage },
+    { "bangladeshi_taka_sign", fa::bangladeshi_taka_sign },
+    { "banjo", fa::banjo },
+    { "barcode", fa::barcode },
+    { "barcode_read", fa::barcode_read },
+    { "barcode_scan", fa::barcode_scan },
+    { "bars", fa::bars },
+    { "navicon", fa::bars },
+    { "bars_filter", fa::bars_filter },
+    { "bars_progress", fa::bars_progress },
+    { "tasks_alt", fa::bars_progress },
+    { "bars_sort", fa::bars_sort },
+    { "bars_staggered", fa::bars_staggered },
+    { "reorder", fa::bars_staggered },
+    { "stream", fa::bars_staggered },
+    { "baseball", fa::baseball },
+    { "baseball_ball", fa::baseball },
+    { "baseball_bat_ball", fa::baseball_bat_ball },
+    { "basket_shopping", fa::basket_shopping },
+    { "shopping_basket", fa::basket_shopping },
+    { "basket_shopping_simple", fa::basket_shopping_simple },
+    { "shopping_basket_alt", fa::basket_shopping_simple },
+    { "basketball", fa::basketball },
+    { "basketball_ball", fa::basketball },
+    { "basketball_hoop", fa::basketball_hoop },
+    { "bat", fa::bat },
+    { "bath", fa::bath },
+    { "bathtub", fa::bath },
+    { "battery_bolt", fa::battery_bolt },
+    { "battery_empty", fa::battery_empty },
+    { "battery_0", fa::battery_empty },
+    { "battery_exclamation", fa::battery_exclamation },
+    { "battery_full", fa::battery_full },
+    { "battery", fa::battery_full },
+    { "battery_5", fa::battery_full },
+    { "battery_half", fa::battery_half },
+    { "battery_3", fa::battery_half },
+    { "battery_low", fa::battery_low },
+    { "battery_1", fa::battery_low },
+    { "battery_quarter", fa::battery_quarter },
+    { "battery_2", fa::battery_quarter },
+    { "battery_slash", fa::battery_slash },
+    { "battery_three_quarters", fa::battery_three_quarters },
+    { "battery_4", fa::battery_three_quarters },
+    { "bed", fa::bed },
+    { "bed_bunk", fa::bed_bunk },
+    { "bed_empty", fa::bed_empty },
+    { "bed_front", fa::bed_front },
+    { "bed_alt", fa::bed_front },
+    { "bed_pulse", fa::bed_pulse },
+    { "procedures", fa::bed_pulse },
+    { "bee", fa::bee },
+    { "beer_mug", fa::beer_mug },
+    { "beer_foam", fa::beer_mug },
+    { "beer_mug_empty", fa::beer_mug_empty },
+    { "beer", fa::beer_mug_empty },
+    { "bell", fa::bell },
+    { "bell_concierge", fa::bell_concierge },
+    { "concierge_bell", fa::bell_concierge },
+    { "bell_exclamation", fa::bell_exclamation },
+    { "bell_on", fa::bell_on },
+    { "bell_plus", fa::bell_plus },
+    { "bell_school", fa::bell_school },
+    { "bell_school_slash", fa::bell_school_slash },
+    { "bell_slash", fa::bell_slash },
+    { "bells", fa::bells },
+    { "bench_tree", fa::bench_tree },
+    { "bezier_curve", fa::bezier_curve },
+    { "bicycle", fa::bicycle },
+    { "binary", fa::binary },
+    { "binary_circle_check", fa::binary_circle_check },
+    { "binary_lock", fa::binary_lock },
+    { "binary_slash", fa::binary_slash },
+    { "binoculars", fa::binoculars },
+    { "biohazard", fa::biohazard },
+    { "bird", fa::bird },
+    { "bitcoin_sign", fa::bitcoin_sign },
+    { "blanket", fa::blanket },
+    { "blanket_fire", fa::blanket_fire },
+    { "blender", fa::blender },
+    { "blender_phone", fa::blender_phone },
+    { "blinds", fa::blinds },
+    { "blinds_open", fa::blinds_open },
+    { "blinds_raised", fa::blinds_raised },
+    { "block", fa::block },
+    { "block_brick", fa::block_brick },
+    { "wall_brick", fa::block_brick },
+    { "block_brick_fire", fa::block_brick_fire },
+    { "firewall", fa::block_brick_fire },
+    { "block_question", fa::block_question },
+    { "block_quote", fa::block_quote },
+    { "blog", fa::blog },
+    { "blueberries", fa::blueberries },
+    { "bold", fa::bold },
+    { "bolt", fa::bolt },
+    { "zap", fa::bolt },
+    { "bolt_auto", fa::bolt_auto },
+    { "bolt_lightning", fa::bolt_lightning },
+    { "bolt_slash", fa::bolt_slash },
+    { "bomb", fa::bomb },
+    { "bone", fa::bone },
+    { "bone_break", fa::bone_break },
+    { "bong", fa::bong },
+    { "book", fa::book },
+    { "book_arrow_right", fa::book_arrow_right },
+    { "book_arrow_up", fa::book_arrow_up },
+    { "book_atlas", fa::book_atlas },
+    { "atlas", fa::book_atlas },
+    { "book_bible", fa::book_bible },
+    { "bible", fa::book_bible },
+    { "book_blank", fa::book_blank },
+    { "book_alt", fa::book_blank },
+    { "book_bookmark", fa::book_bookmark },
+    { "book_circle_arrow_right", fa::book_circle_arrow_right },
+    { "book_circle_arrow_up", fa::book_circle_arrow_up },
+    { "book_copy", fa::book_copy },
+    { "book_font", fa::book_font },
+    { "book_heart", fa::book_heart },
+    { "book_journal_whills", fa::book_journal_whills },
+    { "journal_whills", fa::book_journal_whills },
+    { "book_medical", fa::book_medical },
+    { "book_open", fa::book_open },
+    { "book_open_cover", fa::book_open_cover },
+    { "book_open_alt", fa::book_open_cover },
+    { "book_open_reader", fa::book_open_reader },
+    { "book_reader", fa::book_open_reader },
+    { "book_quran", fa::book_quran },
+    { "quran", fa::book_quran },
+    { "book_section", fa::book_section },
+    { "book_law", fa::book_section },
+    { "book_skull", fa::book_skull },
+    { "book_dead", fa::book_skull },
+    { "book_sparkles", fa::book_sparkles },
+    { "book_spells", fa::book_sparkles },
+    { "book_tanakh", fa::book_tanakh },
+    { "tanakh", fa::book_tanakh },
+    { "book_user", fa::book_user },
+    { "bookmark", fa::bookmark },
+    { "bookmark_slash", fa::bookmark_slash },
+    { "books", fa::books },
+    { "books_medical", fa::books_medical },
+    { "boombox", fa::boombox },
+    { "boot", fa::boot },
+    { "boot_heeled", fa::boot_heeled },
+    { "booth_curtain", fa::booth_curtain },
+    { "border_all", fa::border_all },
+    { "border_bottom", fa::border_bottom },
+    { "border_bottom_right", fa::border_bottom_right },
+    { "border_style_alt", fa::border_bottom_right },
+    { "border_center_h", fa::border_center_h },
+    { "border_center_v", fa::border_center_v },
+    { "border_inner", fa::border_inner },
+    { "border_left", fa::border_left },
+    { "border_none", fa::border_none },
+    { "border_outer", fa::border_outer },
+    { "border_right", fa::border_right },
+    { "border_top", fa::border_top },
+    { "border_top_left", fa::border_top_left },
+    { "border_style", fa::border_top_left },
+    { "bore_hole", fa::bore_hole },
+    { "bottle_droplet", fa::bottle_droplet },
+    { "bottle_water", fa::bottle_water },
+    { "bow_arrow", fa::bow_arrow },
+    { "bowl_chopsticks", fa::bowl_chopsticks },
+    { "bowl_chopsticks_noodles", fa::bowl_chopsticks_noodles },
+    { "bowl_food", fa::bowl_food },
+    { "bowl_hot", fa::bowl_hot },
+    { "soup", fa::bowl_hot },
+    { "bowl_rice", fa::bowl_rice },
+    { "bowl_scoop", fa::bowl_scoop },
+    { "bowl_shaved_ice", fa::bowl_scoop },
+    { "bowl_scoops", fa::bowl_scoops },
+    { "bowl_soft_serve", fa::bowl_soft_serve },
+    { "bowl_spoon", fa::bowl_spoon },
+    { "bowling_ball", fa::bowling_ball },
+    { "bowling_ball_pin", fa::bowling_ball_pin },
+    { "bowling_pins", fa::bowling_pins },
+    { "box", fa::box },
+    { "box_archive", fa::box_archive },
+    { "archive", fa::box_archive },
+    { "box_ballot", fa::box_ballot },
+    { "box_check", fa::box_check },
+    { "box_circle_check", fa::box_circle_check },
+    { "box_dollar", fa::box_dollar },
+    { "box_usd", fa::box_dollar },
+    { "box_heart", fa::box_heart },
+    { "box_open", fa::box_open },
+    { "box_open_full", fa::box_open_full },
+    { "box_full", fa::box_open_full },
+    { "box_taped", fa::box_taped },
+    { "box_alt", fa::box_taped },
+    { "box_tissue", fa::box_tissue },
+    { "boxes_packing", fa::boxes_packing },
+    { "boxes_stacked", fa::boxes_stacked },
+    { "boxes", fa::boxes_stacked },
+    { "boxes_alt", fa::boxes_stacked },
+    { "boxing_glove", fa::boxing_glove },
+    { "glove_boxing", fa::boxing_glove },
+    { "bracket_curly", fa::bracket_curly },
+    { "bracket_curly_left", fa::bracket_curly },
+    { "bracket_curly_right", fa::bracket_curly_right },
+    { "bracket_round", fa::bracket_round },
+    { "parenthesis", fa::bracket_round },
+    { "bracket_round_right", fa::bracket_round_right },
+    { "bracket_square", fa::bracket_square },
+    { "bracket", fa::bracket_square },
+    { "bracket_left", fa::bracket_square },
+    { "bracket_square_right", fa::bracket_square_right },
+    { "brackets_curly", fa::brackets_curly },
+    { "brackets_round", fa::brackets_round },
+    { "parentheses", fa::brackets_round },
+    { "brackets_square", fa::brackets_square },
+    { "brackets", fa::brackets_square },
+    { "braille", fa::braille },
+    { "brain", fa::brain },
+    { "brain_arrow_curved_right", fa::brain_arrow_curved_right },
+    { "mind_share", fa::brain_arrow_curved_right },
+    { "brain_circuit", fa::brain_circuit },
+    { "brake_warning", fa::brake_warning },
+    { "brazilian_real_sign", fa::brazilian_real_sign },
+    { "bread_loaf", fa::bread_loaf },
+    { "bread_slice", fa::bread_slice },
+    { "bread_slice_butter", fa::bread_slice_butter },
+    { "bridge", fa::bridge },
+    { "bridge_circle_check", fa::bridge_circle_check },
+    { "bridge_circle_exclamation", fa::bridge_circle_exclamation },
+    { "bridge_circle_xmark", fa::bridge_circle_xmark },
+    { "bridge_lock", fa::bridge_lock },
+    { "bridge_suspension", fa::bridge_suspension },
+    { "bridge_water", fa::bridge_water },
+    { "briefcase", fa::briefcase },
+    { "briefcase_arrow_right", fa::briefcase_arrow_right },
+    { "briefcase_blank", fa::briefcase_blank },
+    { "briefcase_medical", fa::briefcase_medical },
+    { "brightness", fa::brightness },
+    { "brightness_low", fa::brightness_low },
+    { "bring_forward", fa::bring_forward },
+    { "bring_front", fa::bring_front },
+    { "broccoli", fa::broccoli },
+    { "broom", fa::broom },
+    { "broom_ball", fa::broom_ball },
+    { "quidditch", fa::broom_ball },
+    { "quidditch_broom_ball", fa::broom_ball },
+    { "browser", fa::browser },
+    { "browsers", fa::browsers },
+    { "brush", fa::brush },
+    { "bucket", fa::bucket },
+    { "bug", fa::bug },
+    { "bug_slash", fa::bug_slash },
+    { "bugs", fa::bugs },
+    { "building", fa::building },
+    { "building_circle_arrow_right", fa::building_circle_arrow_right },
+    { "building_circle_check", fa::building_circle_check },
+    { "building_circle_exclamation", fa::building_circle_exclamation },
+    { "building_circle_xmark", fa::building_circle_xmark },
+    { "building_columns", fa::building_columns },
+    { "bank", fa::building_columns },
+    { "institution", fa::building_columns },
+    { "museum", fa::building_columns },
+    { "university", fa::building_columns },
+    { "building_flag", fa::building_flag },
+    { "building_lock", fa::building_lock },
+    { "building_ngo", fa::building_ngo },
+    { "building_shield", fa::building_shield },
+    { "building_un", fa::building_un },
+    { "building_user", fa::building_user },
+    { "building_wheat", fa::building_wheat },
+    { "buildings", fa::buildings },
+    { "bullhorn", fa::bullhorn },
+    { "bullseye", fa::bullseye },
+    { "bullseye_arrow", fa::bullseye_arrow },
+    { "bullseye_pointer", fa::bullseye_pointer },
+    { "burger", fa::burger },
+    { "hamburger", fa::burger },
+    { "burger_cheese", fa::burger_cheese },
+    { "cheeseburger", fa::burger_cheese },
+    { "burger_fries", fa::burger_fries },
+    { "burger_glass", fa::burger_glass },
+    { "burger_lettuce", fa::burger_lettuce },
+    { "burger_soda", fa::burger_soda },
+    { "burrito", fa::burrito },
+    { "burst", fa::burst },
+    { "bus", fa::bus },
+    { "bus_school", fa::bus_school },
+    { "bus_simple", fa::bus_simple },
+    { "bus_alt", fa::bus_simple },
+    { "business_time", fa::business_time },
+    { "briefcase_clock", fa::business_time },
+    { "butter", fa::butter },
+    { "c", fa::c },
+    { "cabin", fa::cabin },
+    { "cabinet_filing", fa::cabinet_filing },
+    { "cable_car", fa::cable_car },
+    { "cactus", fa::cactus },
+    { "cake_candles", fa::cake_candles },
+    { "birthday_cake", fa::cake_candles },
+    { "cake", fa::cake_candles },
+    { "cake_slice", fa::cake_slice },
+    { "shortcake", fa::cake_slice },
+    { "calculator", fa::calculator },
+    { "calculator_simple", fa::calculator_simple },
+    { "calculator_alt", fa::calculator_simple },
+    { "calendar", fa::calendar },
+    { "calendar_arrow_down", fa::calendar_arrow_down },
+    { "calendar_download", fa::calendar_arrow_down },
+    { "calendar_arrow_up", fa::calendar_arrow_up },
+    { "calendar_upload", fa::calendar_arrow_up },
+    { "calendar_check", fa::calendar_check },
+    { "calendar_circle_exclamation", fa::calendar_circle_exclamation },
+    { "calendar_circle_minus", fa::calendar_circle_minus },
+    { "calendar_circle_plus", fa::calendar_circle_plus },
+    { "calendar_circle_user", fa::calendar_circle_user },
+    { "calendar_clock", fa::calendar_clock },
+    { "calendar_time", fa::calendar_clock },
+    { "calendar_day", fa::calendar_day },
+    { "calendar_days", fa::calendar_days },
+    { "calendar_alt", fa::calendar_days },
+    { "calendar_exclamation", fa::calendar_exclamation },
+    { "calendar_heart", fa::calendar_heart },
+    { "calendar_image", fa::calendar_image },
+    { "calendar_lines", fa::calendar_lines },
+    { "calendar_note", fa::calendar_lines },
+    { "calendar_lines_pen", fa::calendar_lines_pen },
+    { "calendar_minus", fa::calendar_minus },
+    { "calendar_pen", fa::calendar_pen },
+    { "calendar_edit", fa::calendar_pen },
+    { "calendar_plus", fa::calendar_plus },
+    { "calendar_range", fa::calendar_range },
+    { "calendar_star", fa::calendar_star },
+    { "calendar_week", fa::calendar_week },
+    { "calendar_xmark", fa::calendar_xmark },
+    { "calendar_times", fa::calendar_xmark },
+    { "calendars", fa::calendars },
+    { "camcorder", fa::camcorder },
+    { "video_handheld", fa::camcorder },
+    { "camera", fa::camera },
+    { "camera_alt", fa::camera },
+    { "camera_cctv", fa::camera_cctv },
+    { "cctv", fa::camera_cctv },
+    { "camera_movie", fa::camera_movie },
+    { "camera_polaroid", fa::camera_polaroid },
+    { "camera_retro", fa::camera_retro },
+    { "camera_rotate", fa::camera_rotate },
+    { "camera_security", fa::camera_security },
+    { "camera_home", fa::camera_security },
+    { "camera_slash", fa::camera_slash },
+    { "camera_viewfinder", fa::camera_viewfinder },
+    { "screenshot", fa::camera_viewfinder },
+    { "camera_web", fa::camera_web },
+    { "webcam", fa::camera_web },
+    { "camera_web_slash", fa::camera_web_slash },
+    { "webcam_slash", fa::camera_web_slash },
+    { "campfire", fa::campfire },
+    { "campground", fa::campground },
+    { "can_food", fa::can_food },
+    { "candle_holder", fa::candle_holder },
+    { "candy", fa::candy },
+    { "candy_bar", fa::candy_bar },
+    { "chocolate_bar", fa::candy_bar },
+    { "candy_cane", fa::candy_cane },
+    { "candy_corn", fa::candy_corn },
+    { "cannabis", fa::cannabis },
+    { "capsules", fa::capsules },
+    { "car", fa::car },
+    { "automobile", fa::car },
+    { "car_battery", fa::car_battery },
+    { "battery_car", fa::car_battery },
+    { "car_bolt", fa::car_bolt },
+    { "car_building", fa::car_building },
+    { "car_bump", fa::car_bump },
+    { "car_burst", fa::car_burst },
+    { "car_crash", fa::car_burst },
+    { "car_bus", fa::car_bus },
+    { "car_circle_bolt", fa::car_circle_bolt },
+    { "car_garage", fa::car_garage },
+    { "car_mirrors", fa::car_mirrors },
+    { "car_on", fa::car_on },
+    { "car_rear", fa::car_rear },
+    { "car_alt", fa::car_rear },
+    { "car_side", fa::car_side },
+    { "car_side_bolt", fa::car_side_bolt },
+    { "car_tilt", fa::car_tilt },
+    { "car_tunnel", fa::car_tunnel },
+    { "car_wash", fa::car_wash },
+    { "car_wrench", fa::car_wrench },
+    { "car_mechanic", fa::car_wrench },
+    { "caravan", fa::caravan },
+    { "caravan_simple", fa::caravan_simple },
+    { "caravan_alt", fa::caravan_simple },
+    { "card_club", fa::card_club },
+    { "card_diamond", fa::card_diamond },
+    { "card_heart", fa::card_heart },
+    { "card_spade", fa::card_spade },
+    { "cards", fa::cards },
+    { "cards_blank", fa::cards_blank },
+    { "caret_down", fa::caret_down },
+    { "caret_left", fa::caret_left },
+    { "caret_right", fa::caret_right },
+    { "caret_up", fa::caret_up },
+    { "carrot", fa::carrot },
+    { "cars", fa::cars },
+    { "cart_arrow_down", fa::cart_arrow_down },
+    { "cart_arrow_up", fa::cart_arrow_up },
+    { "cart_circle_arrow_down", fa::cart_circle_arrow_down },
+    { "cart_circle_arrow_up", fa::cart_circle_arrow_up },
+    { "cart_circle_check", fa::cart_circle_check },
+    { "cart_circle_exclamation", fa::cart_circle_exclamation },
+    { "cart_circle_plus", fa::cart_circle_plus },
+    { "cart_circle_xmark", fa::cart_circle_xmark },
+    { "cart_flatbed", fa::cart_flatbed },
+    { "dolly_flatbed", fa::cart_flatbed },
+    { "cart_flatbed_boxes", fa::cart_flatbed_boxes },
+    { "dolly_flatbed_alt", fa::cart_flatbed_boxes },
+    { "cart_flatbed_empty", fa::cart_flatbed_empty },
+    { "dolly_flatbed_empty", fa::cart_flatbed_empty },
+    { "cart_flatbed_suitcase", fa::cart_flatbed_suitcase },
+    { "luggage_cart", fa::cart_flatbed_suitcase },
+    { "cart_minus", fa::cart_minus },
+    { "cart_plus", fa::cart_plus },
+    { "cart_shopping", fa::cart_shopping },
+    { "shopping_cart", fa::cart_shopping },
+    { "cart_shopping_fast", fa::cart_shopping_fast },
+    { "cart_xmark", fa::cart_xmark },
+    { "cash_register", fa::cash_register },
+    { "cassette_betamax", fa::cassette_betamax },
+    { "betamax", fa::cassette_betamax },
+    { "cassette_tape", fa::cassette_tape },
+    { "cassette_vhs", fa::cassette_vhs },
+    { "vhs", fa::cassette_vhs },
+    { "castle", fa::castle },
+    { "cat", fa::cat },
+    { "cat_space", fa::cat_space },
+    { "cauldron", fa::cauldron },
+    { "cedi_sign", fa::cedi_sign },
+    { "cent_sign", fa::cent_sign },
+    { "certificate", fa::certificate },
+    { "chair", fa::chair },
+    { "chair_office", fa::chair_office },
+    { "chalkboard", fa::chalkboard },
+    { "blackboard", fa::chalkboard },
+    { "chalkboard_user", fa::chalkboard_user },
+    { "chalkboard_teacher", fa::chalkboard_user },
+    { "champagne_glass", fa::champagne_glass },
+    { "glass_champagne", fa::champagne_glass },
+    { "champagne_glasses", fa::champagne_glasses },
+    { "glass_cheers", fa::champagne_glasses },
+    { "charging_station", fa::charging_station },
+    { "chart_area", fa::chart_area },
+    { "area_chart", fa::chart_area },
+    { "chart_bar", fa::chart_bar },
+    { "bar_chart", fa::chart_bar },
+    { "chart_bullet", fa::chart_bullet },
+    { "chart_candlestick", fa::chart_candlestick },
+    { "chart_column", fa::chart_column },
+    { "chart_gantt", fa::chart_gantt },
+    { "chart_line", fa::chart_line },
+    { "line_chart", fa::chart_line },
+    { "chart_line_down", fa::chart_line_down },
+    { "chart_line_up", fa::chart_line_up },
+    { "chart_mixed", fa::chart_mixed },
+    { "analytics", fa::chart_mixed },
+    { "chart_network", fa::chart_network },
+    { "chart_pie", fa::chart_pie },
+    { "pie_chart", fa::chart_pie },
+    { "chart_pie_simple", fa::chart_pie_simple },
+    { "chart_pie_alt", fa::chart_pie_simple },
+    { "chart_pyramid", fa::chart_pyramid },
+    { "chart_radar", fa::chart_radar },
+    { "chart_scatter", fa::chart_scatter },
+    { "chart_scatter_3d", fa::chart_scatter_3d },
+    { "chart_scatter_bubble", fa::chart_scatter_bubble },
+    { "chart_simple", fa::chart_simple },
+    { "chart_simple_horizontal", fa::chart_simple_horizontal },
+    { "chart_tree_map", fa::chart_tree_map },
+    { "chart_user", fa::chart_user },
+    { "user_chart", fa::chart_user },
+    { "chart_waterfall", fa::chart_waterfall },
+    { "check", fa::check },
+    { "check_double", fa::check_double },
+    { "check_to_slot", fa::check_to_slot },
+    { "vote_yea", fa::check_to_slot },
+    { "cheese", fa::cheese },
+    { "cheese_swiss", fa::cheese_swiss },
+    { "cherries", fa::cherries },
+    { "chess", fa::chess },
+    { "chess_bishop", fa::chess_bishop },
+    { "chess_bishop_piece", fa::chess_bishop_piece },
+    { "chess_bishop_alt", fa::chess_bishop_piece },
+    { "chess_board", fa::chess_board },
+    { "chess_clock", fa::chess_clock },
+    { "chess_clock_flip", fa::chess_clock_flip },
+    { "chess_clock_alt", fa::chess_clock_flip },
+    { "chess_king", fa::chess_king },
+    { "chess_king_piece", fa::chess_king_piece },
+    { "chess_king_alt", fa::chess_king_piece },
+    { "chess_knight", fa::chess_knight },
+    { "chess_knight_piece", fa::chess_knight_piece },
+    { "chess_knight_alt", fa::chess_knight_piece },
+    { "chess_pawn", fa::chess_pawn },
+    { "chess_pawn_piece", fa::chess_pawn_piece },
+    { "chess_pawn_alt", fa::chess_pawn_piece },
+    { "chess_queen", fa::chess_queen },
+    { "chess_queen_piece", fa::chess_queen_piece },
+    { "chess_queen_alt", fa::chess_queen_piece },
+    { "chess_rook", fa::chess_rook },
+    { "chess_rook_piece", fa::chess_rook_piece },
+    { "chess_rook_alt", fa::chess_rook_piece },
+    { "chestnut", fa::chestnut },
+    { "chevron_down", fa::chevron_down },
+    { "chevron_left", fa::chevron_left },
+    { "chevron_right", fa::chevron_right },
+    { "chevron_up", fa::chevron_up },
+    { "chevrons_down", fa::chevrons_down },
+    { "chevron_double_down", fa::chevrons_down },
+    { "chevrons_left", fa::chevrons_left },
+    { "chevron_double_left", fa::chevrons_left },
+    { "chevrons_right", fa::chevrons_right },
+    { "chevron_double_right", fa::chevrons_right },
+    { "chevrons_up", fa::chevrons_up },
+    { "chevron_double_up", fa::chevrons_up },
+    { "child", fa::child },
+    { "child_dress", fa::child_dress },
+    { "child_reaching", fa::child_reaching },
+    { "child_rifle", fa::child_rifle },
+    { "children", fa::children },
+    { "chimney", fa::chimney },
+    { "chopsticks", fa::chopsticks },
+    { "church", fa::church },
+    { "circle", fa::circle },
+    { "circle_0", fa::circle_0 },
+    { "circle_1", fa::circle_1 },
+    { "circle_2", fa::circle_2 },
+    { "circle_3", fa::circle_3 },
+    { "circle_4", fa::circle_4 },
+    { "circle_5", fa::circle_5 },
+    { "circle_6", fa::circle_6 },
+    { "circle_7", fa::circle_7 },
+    { "circle_8", fa::circle_8 },
+    { "circle_9", fa::circle_9 },
+    { "circle_a", fa::circle_a },
+    { "circle_ampersand", fa::circle_ampersand },
+    { "circle_arrow_down", fa::circle_arrow_down },
+    { "arrow_circle_down", fa::circle_arrow_down },
+    { "circle_arrow_down_left", fa::circle_arrow_down_left },
+    { "circle_arrow_down_right", fa::circle_arrow_down_right },
+    { "circle_arrow_left", fa::circle_arrow_left },
+    { "arrow_circle_left", fa::circle_arrow_left },
+    { "circle_arrow_right", fa::circle_arrow_right },
+    { "arrow_circle_right", fa::circle_arrow_right },
+    { "circle_arrow_up", fa::circle_arrow_up },
+    { "arrow_circle_up", fa::circle_arrow_up },
+    { "circle_arrow_up_left", fa::circle_arrow_up_left },
+    { "circle_arrow_up_right", fa::circle_arrow_up_right },
+    { "circle_b", fa::circle_b },
+    { "circle_bolt", fa::circle_bolt },
+    { "circle_book_open", fa::circle_book_open },
+    { "book_circle", fa::circle_book_open },
+    { "circle_bookmark", fa::circle_bookmark },
+    { "bookmark_circle", fa::circle_bookmark },
+    { "circle_c", fa::circle_c },
+    { "circle_calendar", fa::circle_calendar },
+    { "calendar_circle", fa::circle_calendar },
+    { "circle_camera", fa::circle_camera },
+    { "camera_circle", fa::circle_camera },
+    { "circle_caret_down", fa::circle_caret_down },
+    { "caret_circle_down", fa::circle_caret_down },
+    { "circle_caret_left", fa::circle_caret_left },
+    { "caret_circle_left", fa::circle_caret_left },
+    { "circle_caret_right", fa::circle_caret_right },
+    { "caret_circle_right", fa::circle_caret_right },
+    { "circle_caret_up", fa::circle_caret_up },
+    { "caret_circle_up", fa::circle_caret_up },
+    { "circle_check", fa::circle_check },
+    { "check_circle", fa::circle_check },
+    { "circle_chevron_down", fa::circle_chevron_down },
+    { "chevron_circle_down", fa::circle_chevron_down },
+    { "circle_chevron_left", fa::circle_chevron_left },
+    { "chevron_circle_left", fa::circle_chevron_left },
+    { "circle_chevron_right", fa::circle_chevron_right },
+    { "chevron_circle_right", fa::circle_chevron_right },
+    { "circle_chevron_up", fa::circle_chevron_up },
+    { "chevron_circle_up", fa::circle_chevron_up },
+    { "circle_d", fa::circle_d },
+    { "circle_dashed", fa::circle_dashed },
+    { "circle_divide", fa::circle_divide },
+    { "circle_dollar", fa::circle_dollar },
+    { "dollar_circle", fa::circle_dollar },
+    { "usd_circle", fa::circle_dollar },
+    { "circle_dollar_to_slot", fa::circle_dollar_to_slot },
+    { "donate", fa::circle_dollar_to_slot },
+    { "circle_dot", fa::circle_dot },
+    { "dot_circle", fa::circle_dot },
+    { "circle_down", fa::circle_down },
+    { "arrow_alt_circle_down", fa::circle_down },
+    { "circle_down_left", fa::circle_down_left },
+    { "circle_down_right", fa::circle_down_right },
+    { "circle_e", fa::circle_e },
+    { "circle_ellipsis", fa::circle_ellipsis },
+    { "circle_ellipsis_vertical", fa::circle_ellipsis_vertical },
+    { "circle_envelope", fa::circle_envelope },
+    { "envelope_circle", fa::circle_envelope },
+    { "circle_exclamation", fa::circle_exclamation },
+    { "exclamation_circle", fa::circle_exclamation },
+    { "circle_exclamation_check", fa::circle_exclamation_check },
+    { "circle_f", fa::circle_f },
+    { "circle_g", fa::circle_g },
+    { "circle_h", fa::circle_h },
+    { "hospital_symbol", fa::circle_h },
+    { "circle_half", fa::circle_half },
+    { "circle_half_stroke", fa::circle_half_stroke },
+    { "adjust", fa::circle_half_stroke },
+    { "circle_heart", fa::circle_heart },
+    { "heart_circle", fa::circle_heart },
+    { "circle_i", fa::circle_i },
+    { "circle_info", fa::circle_info },
+    { "info_circle", fa::circle_info },
+    { "circle_j", fa::circle_j },
+    { "circle_k", fa::circle_k },
+    { "circle_l", fa::circle_l },
+    { "circle_left", fa::circle_left },
+    { "arrow_alt_circle_left", fa::circle_left },
+    { "circle_location_arrow", fa::circle_location_arrow },
+    { "location_circle", fa::circle_location_arrow },
+    { "circle_m", fa::circle_m },
+    { "circle_microphone", fa::circle_microphone },
+    { "microphone_circle", fa::circle_microphone },
+    { "circle_microphone_lines", fa::circle_microphone_lines },
+    { "microphone_circle_alt", fa::circle_microphone_lines },
+    { "circle_minus", fa::circle_minus },
+    { "minus_circle", fa::circle_minus },
+    { "circle_n", fa::circle_n },
+    { "circle_nodes", fa::circle_nodes },
+    { "circle_notch", fa::circle_notch },
+    { "circle_o", fa::circle_o },
+    { "circle_p", fa::circle_p },
+    { "circle_parking", fa::circle_parking },
+    { "parking_circle", fa::circle_parking },
+    { "circle_pause", fa::circle_pause },
+    { "pause_circle", fa::circle_pause },
+    { "circle_phone", fa::circle_phone },
+    { "phone_circle", fa::circle_phone },
+    { "circle_phone_flip", fa::circle_phone_flip },
+    { "phone_circle_alt", fa::circle_phone_flip },
+    { "circle_phone_hangup", fa::circle_phone_hangup },
+    { "phone_circle_down", fa::circle_phone_hangup },
+    { "circle_play", fa::circle_play },
+    { "play_circle", fa::circle_play },
+    { "circle_plus", fa::circle_plus },
+    { "plus_circle", fa::circle_plus },
+    { "circle_q", fa::circle_q },
+    { "circle_quarter", fa::circle_quarter },
+    { "circle_quarters", fa::circle_quarters },
+    { "circle_question", fa::circle_question },
+    { "question_circle", fa::circle_question },
+    { "circle_r", fa::circle_r },
+    { "circle_radiation", fa::circle_radiation },
+    { "radiation_alt", fa::circle_radiation },
+    { "circle_right", fa::circle_right },
+    { "arrow_alt_circle_right", fa::circle_right },
+    { "circle_s", fa::circle_s },
+    { "circle_small", fa::circle_small },
+    { "circle_sort", fa::circle_sort },
+    { "sort_circle", fa::circle_sort },
+    { "circle_sort_down", fa::circle_sort_down },
+    { "sort_circle_down", fa::circle_sort_down },
+    { "circle_sort_up", fa::circle_sort_up },
+    { "sort_circle_up", fa::circle_sort_up },
+    { "circle_star", fa::circle_star },
+    { "star_circle", fa::circle_star },
+    { "circle_stop", fa::circle_stop },
+    { "stop_circle", fa::circle_stop },
+    { "circle_t", fa::circle_t },
+    { "circle_three_quarters", fa::circle_three_quarters },
+    { "circle_trash", fa::circle_trash },
+    { "trash_circle", fa::circle_trash },
+    { "circle_u", fa::circle_u },
+    { "circle_up", fa::circle_up },
+    { "arrow_alt_circle_up", fa::circle_up },
+    { "circle_up_left", fa::circle_up_left },
+    { "circle_up_right", fa::circle_up_right },
+    { "circle_user", fa::circle_user },
+    { "user_circle", fa::circle_user },
+    { "circle_v", fa::circle_v },
+    { "circle_video", fa::circle_video },
+    { "video_circle", fa::circle_video },
+    { "circle_w", fa::circle_w },
+    { "circle_waveform_lines", fa::circle_waveform_lines },
+    { "waveform_circle", fa::circle_waveform_lines },
+    { "circle_x", fa::circle_x },
+    { "circle_xmark", fa::circle_xmark },
+    { "times_circle", fa::circle_xmark },
+    { "xmark_circle", fa::circle_xmark },
+    { "circle_y", fa::circle_y },
+    { "circle_z", fa::circle_z },
+    { "citrus", fa::citrus },
+    { "citrus_slice", fa::citrus_slice },
+    { "city", fa::city },
+    { "clapperboard", fa::clapperboard },
+    { "clapperboard_play", fa::clapperboard_play },
+    { "clarinet", fa::clarinet },
+    { "claw_marks", fa::claw_marks },
+    { "clipboard", fa::clipboard },
+    { "clipboard_check", fa::clipboard_check },
+    { "clipboard_list", fa::clipboard_list },
+    { "clipboard_list_check", fa::clipboard_list_check },
+    { "clipboard_medical", fa::clipboard_medical },
+    { "clipboard_prescription", fa::clipboard_prescription },
+    { "clipboard_question", fa::clipboard_question },
+    { "clipboard_user", fa::clipboard_user },
+    { "clock", fa::clock },
+    { "clock_four", fa::clock },
+    { "clock_desk", fa::clock_desk },
+    { "clock_eight", fa::clock_eight },
+    { "clock_eight_thirty", fa::clock_eight_thirty },
+    { "clock_eleven", fa::clock_eleven },
+    { "clock_eleven_thirty", fa::clock_eleven_thirty },
+    { "clock_five", fa::clock_five },
+    { "clock_five_thirty", fa::clock_five_thirty },
+    { "clock_four_thirty", fa::clock_four_thirty },
+    { "clock_nine", fa::clock_nine },
+    { "clock_nine_thirty", fa::clock_nine_thirty },
+    { "clock_one", fa::clock_one },
+    { "clock_one_thirty", fa::clock_one_thirty },
+    { "clock_rotate_left", fa::clock_rotate_left },
+    { "history", fa::clock_rotate_left },
+    { "clock_seven", fa::clock_seven },
+    { "clock_seven_thirty", fa::clock_seven_thirty },
+    { "clock_six", fa::clock_six },
+    { "clock_six_thirty", fa::clock_six_thirty },
+    { "clock_ten", fa::clock_ten },
+    { "clock_ten_thirty", fa::clock_ten_thirty },
+    { "clock_three", fa::clock_three },
+    { "clock_three_thirty", fa::clock_three_thirty },
+    { "clock_twelve", fa::clock_twelve },
+    { "clock_twelve_thirty", fa::clock_twelve_thirty },
+    { "clock_two", fa::clock_two },
+    { "clock_two_thirty", fa::clock_two_thirty },
+    { "clone", fa::clone },
+    { "closed_captioning", fa::closed_captioning },
+    { "closed_captioning_slash", fa::closed_captioning_slash },
+    { "clothes_hanger", fa::clothes_hanger },
+    { "cloud", fa::cloud },
+    { "cloud_arrow_down", fa::cloud_arrow_down },
+    { "cloud_download", fa::cloud_arrow_down },
+    { "cloud_download_alt", fa::cloud_arrow_down },
+    { "cloud_arrow_up", fa::cloud_arrow_up },
+    { "cloud_upload", fa::cloud_arrow_up },
+    { "cloud_upload_alt", fa::cloud_arrow_up },
+    { "cloud_bolt", fa::cloud_bolt },
+    { "thunderstorm", fa::cloud_bolt },
+    { "cloud_bolt_moon", fa::cloud_bolt_moon },
+    { "thunderstorm_moon", fa::cloud_bolt_moon },
+    { "cloud_bolt_sun", fa::cloud_bolt_sun },
+    { "thunderstorm_sun", fa::cloud_bolt_sun },
+    { "cloud_check", fa::cloud_check },
+    { "cloud_drizzle", fa::cloud_drizzle },
+    { "cloud_exclamation", fa::cloud_exclamation },
+    { "cloud_fog", fa::cloud_fog },
+    { "fog", fa::cloud_fog },
+    { "cloud_hail", fa::cloud_hail },
+    { "cloud_hail_mixed", fa::cloud_hail_mixed },
+    { "cloud_meatball", fa::cloud_meatball },
+    { "cloud_minus", fa::cloud_minus },
+    { "cloud_moon", fa::cloud_moon },
+    { "cloud_moon_rain", fa::cloud_moon_rain },
+    { "cloud_music", fa::cloud_music },
+    { "cloud_plus", fa::cloud_plus },
+    { "cloud_question", fa::cloud_question },
+    { "cloud_rain", fa::cloud_rain },
+    { "cloud_rainbow", fa::cloud_rainbow },
+    { "cloud_showers", fa::cloud_showers },
+    { "cloud_showers_heavy", fa::cloud_showers_heavy },
+    { "cloud_showers_water", fa::cloud_showers_water },
+    { "cloud_slash", fa::cloud_slash },
+    { "cloud_sleet", fa::cloud_sleet },
+    { "cloud_snow", fa::cloud_snow },
+    { "cloud_sun", fa::cloud_sun },
+    { "cloud_sun_rain", fa::cloud_sun_rain },
+    { "cloud_word", fa::cloud_word },
+    { "cloud_xmark", fa::cloud_xmark },
+    { "clouds", fa::clouds },
+    { "clouds_moon", fa::clouds_moon },
+    { "clouds_sun", fa::clouds_sun },
+    { "clover", fa::clover },
+    { "club", fa::club },
+    { "coconut", fa::coconut },
+    { "code", fa::code },
+    { "code_branch", fa::code_branch },
+    { "code_commit", fa::code_commit },
+    { "code_compare", fa::code_compare },
+    { "code_fork", fa::code_fork },
+    { "code_merge", fa::code_merge },
+    { "code_pull_request", fa::code_pull_request },
+    { "code_pull_request_closed", fa::code_pull_request_closed },
+    { "code_pull_request_draft", fa::code_pull_request_draft },
+    { "code_simple", fa::code_simple },
+    { "coffee_bean", fa::coffee_bean },
+    { "coffee_beans", fa::coffee_beans },
+    { "coffee_pot", fa::coffee_pot },
+    { "coffin", fa::coffin },
+    { "coffin_cross", fa::coffin_cross },
+    { "coin", fa::coin },
+    { "coin_blank", fa::coin_blank },
+    { "coin_front", fa::coin_front },
+    { "coin_vertical", fa::coin_vertical },
+    { "coins", fa::coins },
+    { "colon", fa::colon },
+    { "colon_sign", fa::colon_sign },
+    { "columns_3", fa::columns_3 },
+    { "comet", fa::comet },
+    { "comma", fa::comma },
+    { "command", fa::command },
+    { "comment", fa::comment },
+    { "comment_arrow_down", fa::comment_arrow_down },
+    { "comment_arrow_up", fa::comment_arrow_up },
+    { "comment_arrow_up_right", fa::comment_arrow_up_right },
+    { "comment_captions", fa::comment_captions },
+    { "comment_check", fa::comment_check },
+    { "comment_code", fa::comment_code },
+    { "comment_dollar", fa::comment_dollar },
+    { "comment_dots", fa::comment_dots },
+    { "commenting", fa::comment_dots },
+    { "comment_exclamation", fa::comment_exclamation },
+    { "comment_image", fa::comment_image },
+    { "comment_lines", fa::comment_lines },
+    { "comment_medical", fa::comment_medical },
+    { "comment_middle", fa::comment_middle },
+    { "comment_middle_top", fa::comment_middle_top },
+    { "comment_minus", fa::comment_minus },
+    { "comment_music", fa::comment_music },
+    { "comment_pen", fa::comment_pen },
+    { "comment_edit", fa::comment_pen },
+    { "comment_plus", fa::comment_plus },
+    { "comment_question", fa::comment_question },
+    { "comment_quote", fa::comment_quote },
+    { "comment_slash", fa::comment_slash },
+    { "comment_smile", fa::comment_smile },
+    { "comment_sms", fa::comment_sms },
+    { "sms", fa::comment_sms },
+    { "comment_text", fa::comment_text },
+    { "comment_xmark", fa::comment_xmark },
+    { "comment_times", fa::comment_xmark },
+    { "comments", fa::comments },
+    { "comments_dollar", fa::comments_dollar },
+    { "comments_question", fa::comments_question },
+    { "comments_question_check", fa::comments_question_check },
+    { "compact_disc", fa::compact_disc },
+    { "compass", fa::compass },
+    { "compass_drafting", fa::compass_drafting },
+    { "drafting_compass", fa::compass_drafting },
+    { "compass_slash", fa::compass_slash },
+    { "compress", fa::compress },
+    { "compress_wide", fa::compress_wide },
+    { "computer", fa::computer },
+    { "computer_classic", fa::computer_classic },
+    { "computer_mouse", fa::computer_mouse },
+    { "mouse", fa::computer_mouse },
+    { "computer_mouse_scrollwheel", fa::computer_mouse_scrollwheel },
+    { "mouse_alt", fa::computer_mouse_scrollwheel },
+    { "computer_speaker", fa::computer_speaker },
+    { "container_storage", fa::container_storage },
+    { "conveyor_belt", fa::conveyor_belt },
+    { "conveyor_belt_boxes", fa::conveyor_belt_boxes },
+    { "conveyor_belt_alt", fa::conveyor_belt_boxes },
+    { "conveyor_belt_empty", fa::conveyor_belt_empty },
+    { "cookie", fa::cookie },
+    { "cookie_bite", fa::cookie_bite },
+    { "copy", fa::copy },
+    { "copyright", fa::copyright },
+    { "corn", fa::corn },
+    { "corner", fa::corner },
+    { "couch", fa::couch },
+    { "cow", fa::cow },
+    { "cowbell", fa::cowbell },
+    { "cowbell_circle_plus", fa::cowbell_circle_plus },
+    { "cowbell_more", fa::cowbell_circle_plus },
+    { "crab", fa::crab },
+    { "crate_apple", fa::crate_apple },
+    { "apple_crate", fa::crate_apple },
+    { "crate_empty", fa::crate_empty },
+    { "credit_card", fa::credit_card },
+    { "credit_card_alt", fa::credit_card },
+    { "credit_card_blank", fa::credit_card_blank },
+    { "credit_card_front", fa::credit_card_front },
+    { "cricket_bat_ball", fa::cricket_bat_ball },
+    { "cricket", fa::cricket_bat_ball },
+    { "croissant", fa::croissant },
+    { "crop", fa::crop },
+    { "crop_simple", fa::crop_simple },
+    { "crop_alt", fa::crop_simple },
+    { "cross", fa::cross },
+    { "crosshairs", fa::crosshairs },
+    { "crow", fa::crow },
+    { "crown", fa::crown },
+    { "crutch", fa::crutch },
+    { "crutches", fa::crutches },
+    { "cruzeiro_sign", fa::cruzeiro_sign },
+    { "crystal_ball", fa::crystal_ball },
+    { "cube", fa::cube },
+    { "cubes", fa::cubes },
+    { "cubes_stacked", fa::cubes_stacked },
+    { "cucumber", fa::cucumber },
+    { "cup_straw", fa::cup_straw },
+    { "cup_straw_swoosh", fa::cup_straw_swoosh },
+    { "cup_togo", fa::cup_togo },
+    { "coffee_togo", fa::cup_togo },
+    { "cupcake", fa::cupcake },
+    { "curling_stone", fa::curling_stone },
+    { "curling", fa::curling_stone },
+    { "custard", fa::custard },
+    { "d", fa::d },
+    { "dagger", fa::dagger },
+    { "dash", fa::dash },
+    { "minus_large", fa::dash },
+    { "database", fa::database },
+    { "deer", fa::deer },
+    { "deer_rudolph", fa::deer_rudolph },
+    { "delete_left", fa::delete_left },
+    { "backspace", fa::delete_left },
+    { "delete_right", fa::delete_right },
+    { "democrat", fa::democrat },
+    { "desktop", fa::desktop },
+    { "desktop_alt", fa::desktop },
+    { "desktop_arrow_down", fa::desktop_arrow_down },
+    { "dharmachakra", fa::dharmachakra },
+    { "diagram_cells", fa::diagram_cells },
+    { "diagram_lean_canvas", fa::diagram_lean_canvas },
+    { "diagram_nested", fa::diagram_nested },
+    { "diagram_next", fa::diagram_next },
+    { "diagram_predecessor", fa::diagram_predecessor },
+    { "diagram_previous", fa::diagram_previous },
+    { "diagram_project", fa::diagram_project },
+    { "project_diagram", fa::diagram_project },
+    { "diagram_sankey", fa::diagram_sankey },
+    { "diagram_subtask", fa::diagram_subtask },
+    { "diagram_successor", fa::diagram_successor },
+    { "diagram_venn", fa::diagram_venn },
+    { "dial", fa::dial },
+    { "dial_med_high", fa::dial },
+    { "dial_high", fa::dial_high },
+    { "dial_low", fa::dial_low },
+    { "dial_max", fa::dial_max },
+    { "dial_med", fa::dial_med },
+    { "dial_med_low", fa::dial_med_low },
+    { "dial_min", fa::dial_min },
+    { "dial_off", fa::dial_off },
+    { "diamond", fa::diamond },
+    { "diamond_exclamation", fa::diamond_exclamation },
+    { "diamond_turn_right", fa::diamond_turn_right },
+    { "directions", fa::diamond_turn_right },
+    { "dice", fa::dice },
+    { "dice_d10", fa::dice_d10 },
+    { "dice_d12", fa::dice_d12 },
+    { "dice_d20", fa::dice_d20 },
+    { "dice_d4", fa::dice_d4 },
+    { "dice_d6", fa::dice_d6 },
+    { "dice_d8", fa::dice_d8 },
+    { "dice_five", fa::dice_five },
+    { "dice_four", fa::dice_four },
+    { "dice_one", fa::dice_one },
+    { "dice_six", fa::dice_six },
+    { "dice_three", fa::dice_three },
+    { "dice_two", fa::dice_two },
+    { "diploma", fa::diploma },
+    { "scroll_ribbon", fa::diploma },
+    { "disc_drive", fa::disc_drive },
+    { "disease", fa::disease },
+    { "display", fa::display },
+    { "display_arrow_down", fa::display_arrow_down },
+    { "display_code", fa::display_code },
+    { "desktop_code", fa::display_code },
+    { "display_medical", fa::display_medical },
+    { "desktop_medical", fa::display_medical },
+    { "display_slash", fa::display_slash },
+    { "desktop_slash", fa::display_slash },
+    { "distribute_spacing_horizontal", fa::distribute_spacing_horizontal },
+    { "distribute_spacing_vertical", fa::distribute_spacing_vertical },
+    { "ditto", fa::ditto },
+    { "divide", fa::divide },
+    { "dna", fa::dna },
+    { "do_not_enter", fa::do_not_enter },
+    { "dog", fa::dog },
+    { "dog_leashed", fa::dog_leashed },
+    { "dollar_sign", fa::dollar_sign },
+    { "dollar", fa::dollar_sign },
+    { "usd", fa::dollar_sign },
+    { "dolly", fa::dolly },
+    { "dolly_box", fa::dolly },
+    { "dolly_empty", fa::dolly_empty },
+    { "dolphin", fa::dolphin },
+    { "dong_sign", fa::dong_sign },
+    { "donut", fa::donut },
+    { "doughnut", fa::donut },
+    { "door_closed", fa::door_closed },
+    { "door_open", fa::door_open },
+    { "dove", fa::dove },
+    { "down", fa::down },
+    { "arrow_alt_down", fa::down },
+    { "down_from_dotted_line", fa::down_from_dotted_line },
+    { "down_from_line", fa::down_from_line },
+    { "arrow_alt_from_top", fa::down_from_line },
+    { "down_left", fa::down_left },
+    { "down_left_and_up_right_to_center", fa::down_left_and_up_right_to_center },
+    { "compress_alt", fa::down_left_and_up_right_to_center },
+    { "down_long", fa::down_long },
+    { "long_arrow_alt_down", fa::down_long },
+    { "down_right", fa::down_right },
+    { "down_to_bracket", fa::down_to_bracket },
+    { "down_to_dotted_line", fa::down_to_dotted_line },
+    { "down_to_line", fa::down_to_line },
+    { "arrow_alt_to_bottom", fa::down_to_line },
+    { "download", fa::download },
+    { "dragon", fa::dragon },
+    { "draw_circle", fa::draw_circle },
+    { "draw_polygon", fa::draw_polygon },
+    { "draw_square", fa::draw_square },
+    { "dreidel", fa::dreidel },
+    { "drone", fa::drone },
+    { "drone_front", fa::drone_front },
+    { "drone_alt", fa::drone_front },
+    { "droplet", fa::droplet },
+    { "tint", fa::droplet },
+    { "droplet_degree", fa::droplet_degree },
+    { "dewpoint", fa::droplet_degree },
+    { "droplet_percent", fa::droplet_percent },
+    { "humidity", fa::droplet_percent },
+    { "droplet_slash", fa::droplet_slash },
+    { "tint_slash", fa::droplet_slash },
+    { "drum", fa::drum },
+    { "drum_steelpan", fa::drum_steelpan },
+    { "drumstick", fa::drumstick },
+    { "drumstick_bite", fa::drumstick_bite },
+    { "dryer", fa::dryer },
+    { "dryer_heat", fa::dryer_heat },
+    { "dryer_alt", fa::dryer_heat },
+    { "duck", fa::duck },
+    { "dumbbell", fa::dumbbell },
+    { "dumpster", fa::dumpster },
+    { "dumpster_fire", fa::dumpster_fire },
+    { "dungeon", fa::dungeon },
+    { "e", fa::e },
+    { "ear", fa::ear },
+    { "ear_deaf", fa::ear_deaf },
+    { "deaf", fa::ear_deaf },
+    { "deafness", fa::ear_deaf },
+    { "hard_of_hearing", fa::ear_deaf },
+    { "ear_listen", fa::ear_listen },
+    { "assistive_listening_systems", fa::ear_listen },
+    { "ear_muffs", fa::ear_muffs },
+    { "earth_africa", fa::earth_africa },
+    { "globe_africa", fa::earth_africa },
+    { "earth_americas", fa::earth_americas },
+    { "earth", fa::earth_americas },
+    { "earth_america", fa::earth_americas },
+    { "globe_americas", fa::earth_americas },
+    { "earth_asia", fa::earth_asia },
+    { "globe_asia", fa::earth_asia },
+    { "earth_europe", fa::earth_europe },
+    { "globe_europe", fa::earth_europe },
+    { "earth_oceania", fa::earth_oceania },
+    { "globe_oceania", fa::earth_oceania },
+    { "eclipse", fa::eclipse },
+    { "egg", fa::egg },
+    { "egg_fried", fa::egg_fried },
+    { "eggplant", fa::eggplant },
+    { "eject", fa::eject },
+    { "elephant", fa::elephant },
+    { "elevator", fa::elevator },
+    { "ellipsis", fa::ellipsis },
+    { "ellipsis_h", fa::ellipsis },
+    { "ellipsis_stroke", fa::ellipsis_stroke },
+    { "ellipsis_h_alt", fa::ellipsis_stroke },
+    { "ellipsis_stroke_vertical", fa::ellipsis_stroke_vertical },
+    { "ellipsis_v_alt", fa::ellipsis_stroke_vertical },
+    { "ellipsis_vertical", fa::ellipsis_vertical },
+    { "ellipsis_v", fa::ellipsis_vertical },
+    { "empty_set", fa::empty_set },
+    { "engine", fa::engine },
+    { "engine_warning", fa::engine_warning },
+    { "engine_exclamation", fa::engine_warning },
+    { "envelope", fa::envelope },
+    { "envelope_circle_check", fa::envelope_circle_check },
+    { "envelope_dot", fa::envelope_dot },
+    { "envelope_badge", fa::envelope_dot },
+    { "envelope_open", fa::envelope_open },
+    { "envelope_open_dollar", fa::envelope_open_dollar },
+    { "envelope_open_text", fa::envelope_open_text },
+    { "envelopes", fa::envelopes },
+    { "envelopes_bulk", fa::envelopes_bulk },
+    { "mail_bulk", fa::envelopes_bulk },
+    { "equals", fa::equals },
+    { "eraser", fa::eraser },
+    { "escalator", fa::escalator },
+    { "ethernet", fa::ethernet },
+    { "euro_sign", fa::euro_sign },
+    { "eur", fa::euro_sign },
+    { "euro", fa::euro_sign },
+    { "exclamation", fa::exclamation },
+    { "expand", fa::expand },
+    { "expand_wide", fa::expand_wide },
+    { "explosion", fa::explosion },
+    { "eye", fa::eye },
+    { "eye_dropper", fa::eye_dropper },
+    { "eye_dropper_empty", fa::eye_dropper },
+    { "eyedropper", fa::eye_dropper },
+    { "eye_dropper_full", fa::eye_dropper_full },
+    { "eye_dropper_half", fa::eye_dropper_half },
+    { "eye_evil", fa::eye_evil },
+    { "eye_low_vision", fa::eye_low_vision },
+    { "low_vision", fa::eye_low_vision },
+    { "eye_slash", fa::eye_slash },
+    { "eyes", fa::eyes },
+    { "f", fa::f },
+    { "face_angry", fa::face_angry },
+    { "angry", fa::face_angry },
+    { "face_angry_horns", fa::face_angry_horns },
+    { "face_anguished", fa::face_anguished },
+    { "face_anxious_sweat", fa::face_anxious_sweat },
+    { "face_astonished", fa::face_astonished },
+    { "face_awesome", fa::face_awesome },
+    { "gave_dandy", fa::face_awesome },
+    { "face_beam_hand_over_mouth", fa::face_beam_hand_over_mouth },
+    { "face_clouds", fa::face_clouds },
+    { "face_confounded", fa::face_confounded },
+    { "face_confused", fa::face_confused },
+    { "face_cowboy_hat", fa::face_cowboy_hat },
+    { "face_diagonal_mouth", fa::face_diagonal_mouth },
+    { "face_disappointed", fa::face_disappointed },
+    { "face_disguise", fa::face_disguise },
+    { "face_dizzy", fa::face_dizzy },
+    { "dizzy", fa::face_dizzy },
+    { "face_dotted", fa::face_dotted },
+    { "face_downcast_sweat", fa::face_downcast_sweat },
+    { "face_drooling", fa::face_drooling },
+    { "face_exhaling", fa::face_exhaling },
+    { "face_explode", fa::face_explode },
+    { "exploding_head", fa::face_explode },
+    { "face_expressionless", fa::face_expressionless },
+    { "face_eyes_xmarks", fa::face_eyes_xmarks },
+    { "face_fearful", fa::face_fearful },
+    { "face_flushed", fa::face_flushed },
+    { "flushed", fa::face_flushed },
+    { "face_frown", fa::face_frown },
+    { "frown", fa::face_frown },
+    { "face_frown_open", fa::face_frown_open },
+    { "frown_open", fa::face_frown_open },
+    { "face_frown_slight", fa::face_frown_slight },
+    { "face_glasses", fa::face_glasses },
+    { "face_grimace", fa::face_grimace },
+    { "grimace", fa::face_grimace },
+    { "face_grin", fa::face_grin },
+    { "grin", fa::face_grin },
+    { "face_grin_beam", fa::face_grin_beam },
+    { "grin_beam", fa::face_grin_beam },
+    { "face_grin_beam_sweat", fa::face_grin_beam_sweat },
+    { "grin_beam_sweat", fa::face_grin_beam_sweat },
+    { "face_grin_hearts", fa::face_grin_hearts },
+    { "grin_hearts", fa::face_grin_hearts },
+    { "face_grin_squint", fa::face_grin_squint },
+    { "grin_squint", fa::face_grin_squint },
+    { "face_grin_squint_tears", fa::face_grin_squint_tears },
+    { "grin_squint_tears", fa::face_grin_squint_tears },
+    { "face_grin_stars", fa::face_grin_stars },
+    { "grin_stars", fa::face_grin_stars },
+    { "face_grin_tears", fa::face_grin_tears },
+    { "grin_tears", fa::face_grin_tears },
+    { "face_grin_tongue", fa::face_grin_tongue },
+    { "grin_tongue", fa::face_grin_tongue },
+    { "face_grin_tongue_squint", fa::face_grin_tongue_squint },
+    { "grin_tongue_squint", fa::face_grin_tongue_squint },
+    { "face_grin_tongue_wink", fa::face_grin_tongue_wink },
+    { "grin_tongue_wink", fa::face_grin_tongue_wink },
+    { "face_grin_wide", fa::face_grin_wide },
+    { "grin_alt", fa::face_grin_wide },
+    { "face_grin_wink", fa::face_grin_wink },
+    { "grin_wink", fa::face_grin_wink },
+    { "face_hand_over_mouth", fa::face_hand_over_mouth },
+    { "face_hand_peeking", fa::face_hand_peeking },
+    { "face_hand_yawn", fa::face_hand_yawn },
+    { "face_head_bandage", fa::face_head_bandage },
+    { "face_holding_back_tears", fa::face_holding_back_tears },
+    { "face_hushed", fa::face_hushed },
+    { "face_icicles", fa::face_icicles },
+    { "face_kiss", fa::face_kiss },
+    { "kiss", fa::face_kiss },
+    { "face_kiss_beam", fa::face_kiss_beam },
+    { "kiss_beam", fa::face_kiss_beam },
+    { "face_kiss_closed_eyes", fa::face_kiss_closed_eyes },
+    { "face_kiss_wink_heart", fa::face_kiss_wink_heart },
+    { "kiss_wink_heart", fa::face_kiss_wink_heart },
+    { "face_laugh", fa::face_laugh },
+    { "laugh", fa::face_laugh },
+    { "face_laugh_beam", fa::face_laugh_beam },
+    { "laugh_beam", fa::face_laugh_beam },
+    { "face_laugh_squint", fa::face_laugh_squint },
+    { "laugh_squint", fa::face_laugh_squint },
+    { "face_laugh_wink", fa::face_laugh_wink },
+    { "laugh_wink", fa::face_laugh_wink },
+    { "face_lying", fa::face_lying },
+    { "face_mask", fa::face_mask },
+    { "face_meh", fa::face_meh },
+    { "meh", fa::face_meh },
+    { "face_meh_blank", fa::face_meh_blank },
+    { "meh_blank", fa::face_meh_blank },
+    { "face_melting", fa::face_melting },
+    { "face_monocle", fa::face_monocle },
+    { "face_nauseated", fa::face_nauseated },
+    { "face_nose_steam", fa::face_nose_steam },
+    { "face_party", fa::face_party },
+    { "face_pensive", fa::face_pensive },
+    { "face_persevering", fa::face_persevering },
+    { "face_pleading", fa::face_pleading },
+    { "face_pouting", fa::face_pouting },
+    { "face_raised_eyebrow", fa::face_raised_eyebrow },
+    { "face_relieved", fa::face_relieved },
+    { "face_rolling_eyes", fa::face_rolling_eyes },
+    { "meh_rolling_eyes", fa::face_rolling_eyes },
+    { "face_sad_cry", fa::face_sad_cry },
+    { "sad_cry", fa::face_sad_cry },
+    { "face_sad_sweat", fa::face_sad_sweat },
+    { "face_sad_tear", fa::face_sad_tear },
+    { "sad_tear", fa::face_sad_tear },
+    { "face_saluting", fa::face_saluting },
+    { "face_scream", fa::face_scream },
+    { "face_shush", fa::face_shush },
+    { "face_sleeping", fa::face_sleeping },
+    { "face_sleepy", fa::face_sleepy },
+    { "face_smile", fa::face_smile },
+    { "smile", fa::face_smile },
+    { "face_smile_beam", fa::face_smile_beam },
+    { "smile_beam", fa::face_smile_beam },
+    { "face_smile_halo", fa::face_smile_halo },
+    { "face_smile_hearts", fa::face_smile_hearts },
+    { "face_smile_horns", fa::face_smile_horns },
+    { "face_smile_plus", fa::face_smile_plus },
+    { "smile_plus", fa::face_smile_plus },
+    { "face_smile_relaxed", fa::face_smile_relaxed },
+    { "face_smile_tear", fa::face_smile_tear },
+    { "face_smile_tongue", fa::face_smile_tongue },
+    { "face_smile_upside_down", fa::face_smile_upside_down },
+    { "face_smile_wink", fa::face_smile_wink },
+    { "smile_wink", fa::face_smile_wink },
+    { "face_smiling_hands", fa::face_smiling_hands },
+    { "face_smirking", fa::face_smirking },
+    { "face_spiral_eyes", fa::face_spiral_eyes },
+    { "face_sunglasses", fa::face_sunglasses },
+    { "face_surprise", fa::face_surprise },
+    { "surprise", fa::face_surprise },
+    { "face_swear", fa::face_swear },
+    { "face_thermometer", fa::face_thermometer },
+    { "face_thinking", fa::face_thinking },
+    { "face_tired", fa::face_tired },
+    { "tired", fa::face_tired },
+    { "face_tissue", fa::face_tissue },
+    { "face_tongue_money", fa::face_tongue_money },
+    { "face_tongue_sweat", fa::face_tongue_sweat },
+    { "face_unamused", fa::face_unamused },
+    { "face_viewfinder", fa::face_viewfinder },
+    { "face_vomit", fa::face_vomit },
+    { "face_weary", fa::face_weary },
+    { "face_woozy", fa::face_woozy },
+    { "face_worried", fa::face_worried },
+    { "face_zany", fa::face_zany },
+    { "face_zipper", fa::face_zipper },
+    { "falafel", fa::falafel },
+    { "family", fa::family },
+    { "family_dress", fa::family_dress },
+    { "family_pants", fa::family_pants },
+    { "fan", fa::fan },
+    { "fan_table", fa::fan_table },
+    { "farm", fa::farm },
+    { "barn_silo", fa::farm },
+    { "faucet", fa::faucet },
+    { "faucet_drip", fa::faucet_drip },
+    { "fax", fa::fax },
+    { "feather", fa::feather },
+    { "feather_pointed", fa::feather_pointed },
+    { "feather_alt", fa::feather_pointed },
+    { "fence", fa::fence },
+    { "ferris_wheel", fa::ferris_wheel },
+    { "ferry", fa::ferry },
+    { "field_hockey_stick_ball", fa::field_hockey_stick_ball },
+    { "field_hockey", fa::field_hockey_stick_ball },
+    { "file", fa::file },
+    { "file_arrow_down", fa::file_arrow_down },
+    { "file_download", fa::file_arrow_down },
+    { "file_arrow_up", fa::file_arrow_up },
+    { "file_upload", fa::file_arrow_up },
+    { "file_audio", fa::file_audio },
+    { "file_binary", fa::file_binary },
+    { "file_certificate", fa::file_certificate },
+    { "file_award", fa::file_certificate },
+    { "file_chart_column", fa::file_chart_column },
+    { "file_chart_line", fa::file_chart_column },
+    { "file_chart_pie", fa::file_chart_pie },
+    { "file_check", fa::file_check },
+    { "file_circle_check", fa::file_circle_check },
+    { "file_circle_exclamation", fa::file_circle_exclamation },
+    { "file_circle_info", fa::file_circle_info },
+    { "file_circle_minus", fa::file_circle_minus },
+    { "file_circle_plus", fa::file_circle_plus },
+    { "file_circle_question", fa::file_circle_question },
+    { "file_circle_xmark", fa::file_circle_xmark },
+    { "file_code", fa::file_code },
+    { "file_contract", fa::file_contract },
+    { "file_csv", fa::file_csv },
+    { "file_dashed_line", fa::file_dashed_line },
+    { "page_break", fa::file_dashed_line },
+    { "file_excel", fa::file_excel },
+    { "file_exclamation", fa::file_exclamation },
+    { "file_export", fa::file_export },
+    { "arrow_right_from_file", fa::file_export },
+    { "file_heart", fa::file_heart },
+    { "file_image", fa::file_image },
+    { "file_import", fa::file_import },
+    { "arrow_right_to_file", fa::file_import },
+    { "file_invoice", fa::file_invoice },
+    { "file_invoice_dollar", fa::file_invoice_dollar },
+    { "file_lines", fa::file_lines },
+    { "file_alt", fa::file_lines },
+    { "file_text", fa::file_lines },
+    { "file_lock", fa::file_lock },
+    { "file_magnifying_glass", fa::file_magnifying_glass },
+    { "file_search", fa::file_magnifying_glass },
+    { "file_medical", fa::file_medical },
+    { "file_minus", fa::file_minus },
+    { "file_music", fa::file_music },
+    { "file_pdf", fa::file_pdf },
+    { "file_pen", fa::file_pen },
+    { "file_edit", fa::file_pen },
+    { "file_plus", fa::file_plus },
+    { "file_plus_minus", fa::file_plus_minus },
+    { "file_powerpoint", fa::file_powerpoint },
+    { "file_prescription", fa::file_prescription },
+    { "file_shield", fa::file_shield },
+    { "file_signature", fa::file_signature },
+    { "file_slash", fa::file_slash },
+    { "file_spreadsheet", fa::file_spreadsheet },
+    { "file_user", fa::file_user },
+    { "file_video", fa::file_video },
+    { "file_waveform", fa::file_waveform },
+    { "file_medical_alt", fa::file_waveform },
+    { "file_word", fa::file_word },
+    { "file_xmark", fa::file_xmark },
+    { "file_times", fa::file_xmark },
+    { "file_zipper", fa::file_zipper },
+    { "file_archive", fa::file_zipper },
+    { "files", fa::files },
+    { "files_medical", fa::files_medical },
+    { "fill", fa::fill },
+    { "fill_drip", fa::fill_drip },
+    { "film", fa::film },
+    { "film_canister", fa::film_canister },
+    { "film_simple", fa::film_simple },
+    { "film_alt", fa::film_simple },
+    { "film_slash", fa::film_slash },
+    { "films", fa::films },
+    { "filter", fa::filter },
+    { "filter_circle_dollar", fa::filter_circle_dollar },
+    { "funnel_dollar", fa::filter_circle_dollar },
+    { "filter_circle_xmark", fa::filter_circle_xmark },
+    { "filter_list", fa::filter_list },
+    { "filter_slash", fa::filter_slash },
+    { "filters", fa::filters },
+    { "fingerprint", fa::fingerprint },
+    { "fire", fa::fire },
+    { "fire_burner", fa::fire_burner },
+    { "fire_extinguisher", fa::fire_extinguisher },
+    { "fire_flame", fa::fire_flame },
+    { "flame", fa::fire_flame },
+    { "fire_flame_curved", fa::fire_flame_curved },
+    { "fire_alt", fa::fire_flame_curved },
+    { "fire_flame_simple", fa::fire_flame_simple },
+    { "burn", fa::fire_flame_simple },
+    { "fire_hydrant", fa::fire_hydrant },
+    { "fire_smoke", fa::fire_smoke },
+    { "fireplace", fa::fireplace },
+    { "fish", fa::fish },
+    { "fish_bones", fa::fish_bones },
+    { "fish_cooked", fa::fish_cooked },
+    { "fish_fins", fa::fish_fins },
+    { "fishing_rod", fa::fishing_rod },
+    { "flag", fa::flag },
+    { "flag_checkered", fa::flag_checkered },
+    { "flag_pennant", fa::flag_pennant },
+    { "pennant", fa::flag_pennant },
+    { "flag_swallowtail", fa::flag_swallowtail },
+    { "flag_alt", fa::flag_swallowtail },
+    { "flag_usa", fa::flag_usa },
+    { "flashlight", fa::flashlight },
+    { "flask", fa::flask },
+    { "flask_round_poison", fa::flask_round_poison },
+    { "flask_poison", fa::flask_round_poison },
+    { "flask_round_potion", fa::flask_round_potion },
+    { "flask_potion", fa::flask_round_potion },
+    { "flask_vial", fa::flask_vial },
+    { "flatbread", fa::flatbread },
+    { "flatbread_stuffed", fa::flatbread_stuffed },
+    { "floppy_disk", fa::floppy_disk },
+    { "save", fa::floppy_disk },
+    { "floppy_disk_circle_arrow_right", fa::floppy_disk_circle_arrow_right },
+    { "save_circle_arrow_right", fa::floppy_disk_circle_arrow_right },
+    { "floppy_disk_circle_xmark", fa::floppy_disk_circle_xmark },
+    { "floppy_disk_times", fa::floppy_disk_circle_xmark },
+    { "save_circle_xmark", fa::floppy_disk_circle_xmark },
+    { "save_times", fa::floppy_disk_circle_xmark },
+    { "floppy_disk_pen", fa::floppy_disk_pen },
+    { "floppy_disks", fa::floppy_disks },
+    { "florin_sign", fa::florin_sign },
+    { "flower", fa::flower },
+    { "flower_daffodil", fa::flower_daffodil },
+    { "flower_tulip", fa::flower_tulip },
+    { "flute", fa::flute },
+    { "flux_capacitor", fa::flux_capacitor },
+    { "flying_disc", fa::flying_disc },
+    { "folder", fa::folder },
+    { "folder_blank", fa::folder },
+    { "folder_arrow_down", fa::folder_arrow_down },
+    { "folder_download", fa::folder_arrow_down },
+    { "folder_arrow_up", fa::folder_arrow_up },
+    { "folder_upload", fa::folder_arrow_up },
+    { "folder_bookmark", fa::folder_bookmark },
+    { "folder_closed", fa::folder_closed },
+    { "folder_gear", fa::folder_gear },
+    { "folder_cog", fa::folder_gear },
+    { "folder_grid", fa::folder_grid },
+    { "folder_heart", fa::folder_heart },
+    { "folder_image", fa::folder_image },
+    { "folder_magnifying_glass", fa::folder_magnifying_glass },
+    { "folder_search", fa::folder_magnifying_glass },
+    { "folder_medical", fa::folder_medical },
+    { "folder_minus", fa::folder_minus },
+    { "folder_music", fa::folder_music },
+    { "folder_open", fa::folder_open },
+    { "folder_plus", fa::folder_plus },
+    { "folder_tree", fa::folder_tree },
+    { "folder_user", fa::folder_user },
+    { "folder_xmark", fa::folder_xmark },
+    { "folder_times", fa::folder_xmark },
+    { "folders", fa::folders },
+    { "fondue_pot", fa::fondue_pot },
+    { "font", fa::font },
+    { "font_case", fa::font_case },
+    { "football", fa::football },
+    { "football_ball", fa::football },
+    { "football_helmet", fa::football_helmet },
+    { "fork", fa::fork },
+    { "utensil_fork", fa::fork },
+    { "fork_knife", fa::fork_knife },
+    { "utensils_alt", fa::fork_knife },
+    { "forklift", fa::forklift },
+    { "fort", fa::fort },
+    { "forward", fa::forward },
+    { "forward_fast", fa::forward_fast },
+    { "fast_forward", fa::forward_fast },
+    { "forward_step", fa::forward_step },
+    { "step_forward", fa::forward_step },
+    { "frame", fa::frame },
+    { "franc_sign", fa::franc_sign },
+    { "french_fries", fa::french_fries },
+    { "frog", fa::frog },
+    { "function", fa::function },
+    { "futbol", fa::futbol },
+    { "futbol_ball", fa::futbol },
+    { "soccer_ball", fa::futbol },
+    { "g", fa::g },
+    { "galaxy", fa::galaxy },
+    { "gallery_thumbnails", fa::gallery_thumbnails },
+    { "game_board", fa::game_board },
+    { "game_board_simple", fa::game_board_simple },
+    { "game_board_alt", fa::game_board_simple },
+    { "game_console_handheld", fa::game_console_handheld },
+    { "gamepad", fa::gamepad },
+    { "gamepad_modern", fa::gamepad_modern },
+    { "gamepad_alt", fa::gamepad_modern },
+    { "garage", fa::garage },
+    { "garage_car", fa::garage_car },
+    { "garage_open", fa::garage_open },
+    { "garlic", fa::garlic },
+    { "gas_pump", fa::gas_pump },
+    { "gas_pump_slash", fa::gas_pump_slash },
+    { "gauge", fa::gauge },
+    { "dashboard", fa::gauge },
+    { "gauge_med", fa::gauge },
+    { "tachometer_alt_average", fa::gauge },
+    { "gauge_circle_bolt", fa::gauge_circle_bolt },
+    { "gauge_circle_minus", fa::gauge_circle_minus },
+    { "gauge_circle_plus", fa::gauge_circle_plus },
+    { "gauge_high", fa::gauge_high },
+    { "tachometer_alt", fa::gauge_high },
+    { "tachometer_alt_fast", fa::gauge_high },
+    { "gauge_low", fa::gauge_low },
+    { "tachometer_alt_slow", fa::gauge_low },
+    { "gauge_max", fa::gauge_max },
+    { "tachometer_alt_fastest", fa::gauge_max },
+    { "gauge_min", fa::gauge_min },
+    { "tachometer_alt_slowest", fa::gauge_min },
+    { "gauge_simple", fa::gauge_simple },
+    { "gauge_simple_med", fa::gauge_simple },
+    { "tachometer_average", fa::gauge_simple },
+    { "gauge_simple_high", fa::gauge_simple_high },
+    { "tachometer", fa::gauge_simple_high },
+    { "tachometer_fast", fa::gauge_simple_high },
+    { "gauge_simple_low", fa::gauge_simple_low },
+    { "tachometer_slow", fa::gauge_simple_low },
+    { "gauge_simple_max", fa::gauge_simple_max },
+    { "tachometer_fastest", fa::gauge_simple_max },
+    { "gauge_simple_min", fa::gauge_simple_min },
+    { "tachometer_slowest", fa::gauge_simple_min },
+    { "gavel", fa::gavel },
+    { "legal", fa::gavel },
+    { "gear", fa::gear },
+    { "cog", fa::gear },
+    { "gears", fa::gears },
+    { "cogs", fa::gears },
+    { "gem", fa::gem },
+    { "genderless", fa::genderless },
+    { "ghost", fa::ghost },
+    { "gif", fa::gif },
+    { "gift", fa::gift },
+    { "gift_card", fa::gift_card },
+    { "gifts", fa::gifts },
+    { "gingerbread_man", fa::gingerbread_man },
+    { "glass", fa::glass },
+    { "glass_citrus", fa::glass_citrus },
+    { "glass_empty", fa::glass_empty },
+    { "glass_half", fa::glass_half },
+    { "glass_half_empty", fa::glass_half },
+    { "glass_half_full", fa::glass_half },
+    { "glass_water", fa::glass_water },
+    { "glass_water_droplet", fa::glass_water_droplet },
+    { "glasses", fa::glasses },
+    { "glasses_round", fa::glasses_round },
+    { "glasses_alt", fa::glasses_round },
+    { "globe", fa::globe },
+    { "globe_snow", fa::globe_snow },
+    { "globe_stand", fa::globe_stand },
+    { "goal_net", fa::goal_net },
+    { "golf_ball_tee", fa::golf_ball_tee },
+    { "golf_ball", fa::golf_ball_tee },
+    { "golf_club", fa::golf_club },
+    { "golf_flag_hole", fa::golf_flag_hole },
+    { "gopuram", fa::gopuram },
+    { "graduation_cap", fa::graduation_cap },
+    { "mortar_board", fa::graduation_cap },
+    { "gramophone", fa::gramophone },
+    { "grapes", fa::grapes },
+    { "grate", fa::grate },
+    { "grate_droplet", fa::grate_droplet },
+    { "greater_than", fa::greater_than },
+    { "greater_than_equal", fa::greater_than_equal },
+    { "grid", fa::grid },
+    { "grid_3", fa::grid },
+    { "grid_2", fa::grid_2 },
+    { "grid_2_plus", fa::grid_2_plus },
+    { "grid_4", fa::grid_4 },
+    { "grid_5", fa::grid_5 },
+    { "grid_dividers", fa::grid_dividers },
+    { "grid_horizontal", fa::grid_horizontal },
+    { "grip", fa::grip },
+    { "grip_horizontal", fa::grip },
+    { "grip_dots", fa::grip_dots },
+    { "grip_dots_vertical", fa::grip_dots_vertical },
+    { "grip_lines", fa::grip_lines },
+    { "grip_lines_vertical", fa::grip_lines_vertical },
+    { "grip_vertical", fa::grip_vertical },
+    { "group_arrows_rotate", fa::group_arrows_rotate },
+    { "guarani_sign", fa::guarani_sign },
+    { "guitar", fa::guitar },
+    { "guitar_electric", fa::guitar_electric },
+    { "guitars", fa::guitars },
+    { "gun", fa::gun },
+    { "gun_slash", fa::gun_slash },
+    { "gun_squirt", fa::gun_squirt },
+    { "h", fa::h },
+    { "h1", fa::h1 },
+    { "h2", fa::h2 },
+    { "h3", fa::h3 },
+    { "h4", fa::h4 },
+    { "h5", fa::h5 },
+    { "h6", fa::h6 },
+    { "hammer", fa::hammer },
+    { "hammer_crash", fa::hammer_crash },
+    { "hammer_war", fa::hammer_war },
+    { "hamsa", fa::hamsa },
+    { "hand", fa::hand },
+    { "hand_paper", fa::hand },
+    { "hand_back_fist", fa::hand_back_fist },
+    { "hand_rock", fa::hand_back_fist },
+    { "hand_back_point_down", fa::hand_back_point_down },
+    { "hand_back_point_left", fa::hand_back_point_left },
+    { "hand_back_point_ribbon", fa::hand_back_point_ribbon },
+    { "hand_back_point_right", fa::hand_back_point_right },
+    { "hand_back_point_up", fa::hand_back_point_up },
+    { "hand_dots", fa::hand_dots },
+    { "allergies", fa::hand_dots },
+    { "hand_fingers_crossed", fa::hand_fingers_crossed },
+    { "hand_fist", fa::hand_fist },
+    { "fist_raised", fa::hand_fist },
+    { "hand_heart", fa::hand_heart },
+    { "hand_holding", fa::hand_holding },
+    { "hand_holding_box", fa::hand_holding_box },
+    { "hand_holding_dollar", fa::hand_holding_dollar },
+    { "hand_holding_usd", fa::hand_holding_dollar },
+    { "hand_holding_droplet", fa::hand_holding_droplet },
+    { "hand_holding_water", fa::hand_holding_droplet },
+    { "hand_holding_hand", fa::hand_holding_hand },
+    { "hand_holding_heart", fa::hand_holding_heart },
+    { "hand_holding_magic", fa::hand_holding_magic },
+    { "hand_holding_medical", fa::hand_holding_medical },
+    { "hand_holding_seedling", fa::hand_holding_seedling },
+    { "hand_holding_skull", fa::hand_holding_skull },
+    { "hand_horns", fa::hand_horns },
+    { "hand_lizard", fa::hand_lizard },
+    { "hand_love", fa::hand_love },
+    { "hand_middle_finger", fa::hand_middle_finger },
+    { "hand_peace", fa::hand_peace },
+    { "hand_point_down", fa::hand_point_down },
+    { "hand_point_left", fa::hand_point_left },
+    { "hand_point_ribbon", fa::hand_point_ribbon },
+    { "hand_point_right", fa::hand_point_right },
+    { "hand_point_up", fa::hand_point_up },
+    { "hand_pointer", fa::hand_pointer },
+    { "hand_scissors", fa::hand_scissors },
+    { "hand_sparkles", fa::hand_sparkles },
+    { "hand_spock", fa::hand_spock },
+    { "hand_wave", fa::hand_wave },
+    { "handcuffs", fa::handcuffs },
+    { "hands", fa::hands },
+    { "sign_language", fa::hands },
+    { "signing", fa::hands },
+    { "hands_asl_interpreting", fa::hands_asl_interpreting },
+    { "american_sign_language_interpreting", fa::hands_asl_interpreting },
+    { "asl_interpreting", fa::hands_asl_interpreting },
+    { "hands_american_sign_language_interpreting", fa::hands_asl_interpreting },
+    { "hands_bound", fa::hands_bound },
+    { "hands_bubbles", fa::hands_bubbles },
+    { "hands_wash", fa::hands_bubbles },
+    { "hands_clapping", fa::hands_clapping },
+    { "hands_holding", fa::hands_holding },
+    { "hands_holding_child", fa::hands_holding_child },
+    { "hands_holding_circle", fa::hands_holding_circle },
+    { "hands_holding_diamond", fa::hands_holding_diamond },
+    { "hand_receiving", fa::hands_holding_diamond },
+    { "hands_holding_dollar", fa::hands_holding_dollar },
+    { "hands_usd", fa::hands_holding_dollar },
+    { "hands_holding_heart", fa::hands_holding_heart },
+    { "hands_heart", fa::hands_holding_heart },
+    { "hands_praying", fa::hands_praying },
+    { "praying_hands", fa::hands_praying },
+    { "handshake", fa::handshake },
+    { "handshake_angle", fa::handshake_angle },
+    { "hands_helping", fa::handshake_angle },
+    { "handshake_simple", fa::handshake_simple },
+    { "handshake_alt", fa::handshake_simple },
+    { "handshake_simple_slash", fa::handshake_simple_slash },
+    { "handshake_alt_slash", fa::handshake_simple_slash },
+    { "handshake_slash", fa::handshake_slash },
+    { "hanukiah", fa::hanukiah },
+    { "hard_drive", fa::hard_drive },
+    { "hdd", fa::hard_drive },
+    { "hashtag", fa::hashtag },
+    { "hashtag_lock", fa::hashtag_lock },
+    { "hat_chef", fa::hat_chef },
+    { "hat_cowboy", fa::hat_cowboy },
+    { "hat_cowboy_side", fa::hat_cowboy_side },
+    { "hat_santa", fa::hat_santa },
+    { "hat_winter", fa::hat_winter },
+    { "hat_witch", fa::hat_witch },
+    { "hat_wizard", fa::hat_wizard },
+    { "head_side", fa::head_side },
+    { "head_side_brain", fa::head_side_brain },
+    { "head_side_cough", fa::head_side_cough },
+    { "head_side_cough_slash", fa::head_side_cough_slash },
+    { "head_side_goggles", fa::head_side_goggles },
+    { "head_vr", fa::head_side_goggles },
+    { "head_side_headphones", fa::head_side_headphones },
+    { "head_side_heart", fa::head_side_heart },
+    { "head_side_mask", fa::head_side_mask },
+    { "head_side_medical", fa::head_side_medical },
+    { "head_side_virus", fa::head_side_virus },
+    { "heading", fa::heading },
+    { "header", fa::heading },
+    { "headphones", fa::headphones },
+    { "headphones_simple", fa::headphones_simple },
+    { "headphones_alt", fa::headphones_simple },
+    { "headset", fa::headset },
+    { "heart", fa::heart },
+    { "heart_circle_bolt", fa::heart_circle_bolt },
+    { "heart_circle_check", fa::heart_circle_check },
+    { "heart_circle_exclamation", fa::heart_circle_exclamation },
+    { "heart_circle_minus", fa::heart_circle_minus },
+    { "heart_circle_plus", fa::heart_circle_plus },
+    { "heart_circle_xmark", fa::heart_circle_xmark },
+    { "heart_crack", fa::heart_crack },
+    { "heart_broken", fa::heart_crack },
+    { "heart_half", fa::heart_half },
+    { "heart_half_stroke", fa::heart_half_stroke },
+    { "heart_half_alt", fa::heart_half_stroke },
+    { "heart_pulse", fa::heart_pulse },
+    { "heartbeat", fa::heart_pulse },
+    { "heat", fa::heat },
+    { "helicopter", fa::helicopter },
+    { "helicopter_symbol", fa::helicopter_symbol },
+    { "helmet_battle", fa::helmet_battle },
+    { "helmet_safety", fa::helmet_safety },
+    { "hard_hat", fa::helmet_safety },
+    { "hat_hard", fa::helmet_safety },
+    { "helmet_un", fa::helmet_un },
+    { "hexagon", fa::hexagon },
+    { "hexagon_check", fa::hexagon_check },
+    { "hexagon_divide", fa::hexagon_divide },
+    { "hexagon_exclamation", fa::hexagon_exclamation },
+    { "hexagon_image", fa::hexagon_image },
+    { "hexagon_minus", fa::hexagon_minus },
+    { "minus_hexagon", fa::hexagon_minus },
+    { "hexagon_plus", fa::hexagon_plus },
+    { "plus_hexagon", fa::hexagon_plus },
+    { "hexagon_vertical_nft", fa::hexagon_vertical_nft },
+    { "hexagon_vertical_nft_slanted", fa::hexagon_vertical_nft_slanted },
+    { "hexagon_xmark", fa::hexagon_xmark },
+    { "times_hexagon", fa::hexagon_xmark },
+    { "xmark_hexagon", fa::hexagon_xmark },
+    { "high_definition", fa::high_definition },
+    { "rectangle_hd", fa::high_definition },
+    { "highlighter", fa::highlighter },
+    { "highlighter_line", fa::highlighter_line },
+    { "hill_avalanche", fa::hill_avalanche },
+    { "hill_rockslide", fa::hill_rockslide },
+    { "hippo", fa::hippo },
+    { "hockey_mask", fa::hockey_mask },
+    { "hockey_puck", fa::hockey_puck },
+    { "hockey_stick_puck", fa::hockey_stick_puck },
+    { "hockey_sticks", fa::hockey_sticks },
+    { "holly_berry", fa::holly_berry },
+    { "honey_pot", fa::honey_pot },
+    { "hood_cloak", fa::hood_cloak },
+    { "horizontal_rule", fa::horizontal_rule },
+    { "horse", fa::horse },
+    { "horse_head", fa::horse_head },
+    { "horse_saddle", fa::horse_saddle },
+    { "hose", fa::hose },
+    { "hose_reel", fa::hose_reel },
+    { "hospital", fa::hospital },
+    { "hospital_alt", fa::hospital },
+    { "hospital_wide", fa::hospital },
+    { "hospital_user", fa::hospital_user },
+    { "hospitals", fa::hospitals },
+    { "hot_tub_person", fa::hot_tub_person },
+    { "hot_tub", fa::hot_tub_person },
+    { "hotdog", fa::hotdog },
+    { "hotel", fa::hotel },
+    { "hourglass", fa::hourglass },
+    { "hourglass_2", fa::hourglass },
+    { "hourglass_half", fa::hourglass },
+    { "hourglass_clock", fa::hourglass_clock },
+    { "hourglass_empty", fa::hourglass_empty },
+    { "hourglass_end", fa::hourglass_end },
+    { "hourglass_3", fa::hourglass_end },
+    { "hourglass_start", fa::hourglass_start },
+    { "hourglass_1", fa::hourglass_start },
+    { "house", fa::house },
+    { "home", fa::house },
+    { "home_alt", fa::house },
+    { "home_lg_alt", fa::house },
+    { "house_blank", fa::house_blank },
+    { "home_blank", fa::house_blank },
+    { "house_building", fa::house_building },
+    { "house_chimney", fa::house_chimney },
+    { "home_lg", fa::house_chimney },
+    { "house_chimney_blank", fa::house_chimney_blank },
+    { "house_chimney_crack", fa::house_chimney_crack },
+    { "house_damage", fa::house_chimney_crack },
+    { "house_chimney_heart", fa::house_chimney_heart },
+    { "house_chimney_medical", fa::house_chimney_medical },
+    { "clinic_medical", fa::house_chimney_medical },
+    { "house_chimney_user", fa::house_chimney_user },
+    { "house_chimney_window", fa::house_chimney_window },
+    { "house_circle_check", fa::house_circle_check },
+    { "house_circle_exclamation", fa::house_circle_exclamation },
+    { "house_circle_xmark", fa::house_circle_xmark },
+    { "house_crack", fa::house_crack },
+    { "house_day", fa::house_day },
+    { "house_fire", fa::house_fire },
+    { "house_flag", fa::house_flag },
+    { "house_flood_water", fa::house_flood_water },
+    { "house_flood_water_circle_arrow_right", fa::house_flood_water_circle_arrow_right },
+    { "house_heart", fa::house_heart },
+    { "home_heart", fa::house_heart },
+    { "house_laptop", fa::house_laptop },
+    { "laptop_house", fa::house_laptop },
+    { "house_lock", fa::house_lock },
+    { "house_medical", fa::house_medical },
+    { "house_medical_circle_check", fa::house_medical_circle_check },
+    { "house_medical_circle_exclamation", fa::house_medical_circle_exclamation },
+    { "house_medical_circle_xmark", fa::house_medical_circle_xmark },
+    { "house_medical_flag", fa::house_medical_flag },
+    { "house_night", fa::house_night },
+    { "house_person_leave", fa::house_person_leave },
+    { "house_leave", fa::house_person_leave },
+    { "house_person_depart", fa::house_person_leave },
+    { "house_person_return", fa::house_person_return },
+    { "house_person_arrive", fa::house_person_return },
+    { "house_return", fa::house_person_return },
+    { "house_signal", fa::house_signal },
+    { "house_tree", fa::house_tree },
+    { "house_tsunami", fa::house_tsunami },
+    { "house_turret", fa::house_turret },
+    { "house_user", fa::house_user },
+    { "home_user", fa::house_user },
+    { "house_water", fa::house_water },
+    { "house_flood", fa::house_water },
+    { "house_window", fa::house_window },
+    { "hryvnia_sign", fa::hryvnia_sign },
+    { "hryvnia", fa::hryvnia_sign },
+    { "hundred_points", fa::hundred_points },
+    { "_100", fa::hundred_points },
+    { "hurricane", fa::hurricane },
+    { "hyphen", fa::hyphen },
+    { "i", fa::i },
+    { "i_cursor", fa::i_cursor },
+    { "ice_cream", fa::ice_cream },
+    { "ice_skate", fa::ice_skate },
+    { "icicles", fa::icicles },
+    { "icons", fa::icons },
+    { "heart_music_camera_bolt", fa::icons },
+    { "id_badge", fa::id_badge },
+    { "id_card", fa::id_card },
+    { "drivers_license", fa::id_card },
+    { "id_card_clip", fa::id_card_clip },
+    { "id_card_alt", fa::id_card_clip },
+    { "igloo", fa::igloo },
+    { "image", fa::image },
+    { "image_landscape", fa::image_landscape },
+    { "landscape", fa::image_landscape },
+    { "image_polaroid", fa::image_polaroid },
+    { "image_polaroid_user", fa::image_polaroid_user },
+    { "image_portrait", fa::image_portrait },
+    { "portrait", fa::image_portrait },
+    { "image_slash", fa::image_slash },
+    { "image_user", fa::image_user },
+    { "images", fa::images },
+    { "images_user", fa::images_user },
+    { "inbox", fa::inbox },
+    { "inbox_full", fa::inbox_full },
+    { "inbox_in", fa::inbox_in },
+    { "inbox_arrow_down", fa::inbox_in },
+    { "inbox_out", fa::inbox_out },
+    { "inbox_arrow_up", fa::inbox_out },
+    { "inboxes", fa::inboxes },
+    { "indent", fa::indent },
+    { "indian_rupee_sign", fa::indian_rupee_sign },
+    { "indian_rupee", fa::indian_rupee_sign },
+    { "inr", fa::indian_rupee_sign },
+    { "industry", fa::industry },
+    { "industry_windows", fa::industry_windows },
+    { "industry_alt", fa::industry_windows },
+    { "infinity", fa::infinity },
+    { "info", fa::info },
+    { "inhaler", fa::inhaler },
+    { "input_numeric", fa::input_numeric },
+    { "input_pipe", fa::input_pipe },
+    { "input_text", fa::input_text },
+    { "integral", fa::integral },
+    { "intersection", fa::intersection },
+    { "island_tropical", fa::island_tropical },
+    { "island_tree_palm", fa::island_tropical },
+    { "italic", fa::italic },
+    { "j", fa::j },
+    { "jack_o_lantern", fa::jack_o_lantern },
+    { "jar", fa::jar },
+    { "jar_wheat", fa::jar_wheat },
+    { "jedi", fa::jedi },
+    { "jet_fighter", fa::jet_fighter },
+    { "fighter_jet", fa::jet_fighter },
+    { "jet_fighter_up", fa::jet_fighter_up },
+    { "joint", fa::joint },
+    { "joystick", fa::joystick },
+    { "jug", fa::jug },
+    { "jug_detergent", fa::jug_detergent },
+    { "k", fa::k },
+    { "kaaba", fa::kaaba },
+    { "kazoo", fa::kazoo },
+    { "kerning", fa::kerning },
+    { "key", fa::key },
+    { "key_skeleton", fa::key_skeleton },
+    { "key_skeleton_left_right", fa::key_skeleton_left_right },
+    { "keyboard", fa::keyboard },
+    { "keyboard_brightness", fa::keyboard_brightness },
+    { "keyboard_brightness_low", fa::keyboard_brightness_low },
+    { "keyboard_down", fa::keyboard_down },
+    { "keyboard_left", fa::keyboard_left },
+    { "keynote", fa::keynote },
+    { "khanda", fa::khanda },
+    { "kidneys", fa::kidneys },
+    { "kip_sign", fa::kip_sign },
+    { "kit_medical", fa::kit_medical },
+    { "first_aid", fa::kit_medical },
+    { "kitchen_set", fa::kitchen_set },
+    { "kite", fa::kite },
+    { "kiwi_bird", fa::kiwi_bird },
+    { "kiwi_fruit", fa::kiwi_fruit },
+    { "knife", fa::knife },
+    { "utensil_knife", fa::knife },
+    { "knife_kitchen", fa::knife_kitchen },
+    { "l", fa::l },
+    { "lacrosse_stick", fa::lacrosse_stick },
+    { "lacrosse_stick_ball", fa::lacrosse_stick_ball },
+    { "lambda", fa::lambda },
+    { "lamp", fa::lamp },
+    { "lamp_desk", fa::lamp_desk },
+    { "lamp_floor", fa::lamp_floor },
+    { "lamp_street", fa::lamp_street },
+    { "land_mine_on", fa::land_mine_on },
+    { "landmark", fa::landmark },
+    { "landmark_dome", fa::landmark_dome },
+    { "landmark_alt", fa::landmark_dome },
+    { "landmark_flag", fa::landmark_flag },
+    { "language", fa::language },
+    { "laptop", fa::laptop },
+    { "laptop_arrow_down", fa::laptop_arrow_down },
+    { "laptop_code", fa::laptop_code },
+    { "laptop_file", fa::laptop_file },
+    { "laptop_medical", fa::laptop_medical },
+    { "laptop_mobile", fa::laptop_mobile },
+    { "phone_laptop", fa::laptop_mobile },
+    { "laptop_slash", fa::laptop_slash },
+    { "lari_sign", fa::lari_sign },
+    { "lasso", fa::lasso },
+    { "lasso_sparkles", fa::lasso_sparkles },
+    { "layer_group", fa::layer_group },
+    { "layer_minus", fa::layer_minus },
+    { "layer_group_minus", fa::layer_minus },
+    { "layer_plus", fa::layer_plus },
+    { "layer_group_plus", fa::layer_plus },
+    { "leaf", fa::leaf },
+    { "leaf_heart", fa::leaf_heart },
+    { "leaf_maple", fa::leaf_maple },
+    { "leaf_oak", fa::leaf_oak },
+    { "leafy_green", fa::leafy_green },
+    { "left", fa::left },
+    { "arrow_alt_left", fa::left },
+    { "left_from_line", fa::left_from_line },
+    { "arrow_alt_from_right", fa::left_from_line },
+    { "left_long", fa::left_long },
+    { "long_arrow_alt_left", fa::left_long },
+    { "left_long_to_line", fa::left_long_to_line },
+    { "left_right", fa::left_right },
+    { "arrows_alt_h", fa::left_right },
+    { "left_to_line", fa::left_to_line },
+    { "arrow_alt_to_left", fa::left_to_line },
+    { "lemon", fa::lemon },
+    { "less_than", fa::less_than },
+    { "less_than_equal", fa::less_than_equal },
+    { "life_ring", fa::life_ring },
+    { "light_ceiling", fa::light_ceiling },
+    { "light_emergency", fa::light_emergency },
+    { "light_emergency_on", fa::light_emergency_on },
+    { "light_switch", fa::light_switch },
+    { "light_switch_off", fa::light_switch_off },
+    { "light_switch_on", fa::light_switch_on },
+    { "lightbulb", fa::lightbulb },
+    { "lightbulb_dollar", fa::lightbulb_dollar },
+    { "lightbulb_exclamation", fa::lightbulb_exclamation },
+    { "lightbulb_exclamation_on", fa::lightbulb_exclamation_on },
+    { "lightbulb_on", fa::lightbulb_on },
+    { "lightbulb_slash", fa::lightbulb_slash },
+    { "lights_holiday", fa::lights_holiday },
+    { "line_columns", fa::line_columns },
+    { "line_height", fa::line_height },
+    { "lines_leaning", fa::lines_leaning },
+    { "link", fa::link },
+    { "chain", fa::link },
+    { "link_horizontal", fa::link_horizontal },
+    { "chain_horizontal", fa::link_horizontal },
+    { "link_horizontal_slash", fa::link_horizontal_slash },
+    { "chain_horizontal_slash", fa::link_horizontal_slash },
+    { "link_simple", fa::link_simple },
+    { "link_simple_slash", fa::link_simple_slash },
+    { "link_slash", fa::link_slash },
+    { "chain_broken", fa::link_slash },
+    { "chain_slash", fa::link_slash },
+    { "unlink", fa::link_slash },
+    { "lips", fa::lips },
+    { "lira_sign", fa::lira_sign },
+    { "list", fa::list },
+    { "list_squares", fa::list },
+    { "list_check", fa::list_check },
+    { "tasks", fa::list_check },
+    { "list_dropdown", fa::list_dropdown },
+    { "list_music", fa::list_music },
+    { "list_ol", fa::list_ol },
+    { "list_1_2", fa::list_ol },
+    { "list_numeric", fa::list_ol },
+    { "list_radio", fa::list_radio },
+    { "list_timeline", fa::list_timeline },
+    { "list_tree", fa::list_tree },
+    { "list_ul", fa::list_ul },
+    { "list_dots", fa::list_ul },
+    { "litecoin_sign", fa::litecoin_sign },
+    { "loader", fa::loader },
+    { "lobster", fa::lobster },
+    { "location_arrow", fa::location_arrow },
+    { "location_check", fa::location_check },
+    { "map_marker_check", fa::location_check },
+    { "location_crosshairs", fa::location_crosshairs },
+    { "location", fa::location_crosshairs },
+    { "location_crosshairs_slash", fa::location_crosshairs_slash },
+    { "location_slash", fa::location_crosshairs_slash },
+    { "location_dot", fa::location_dot },
+    { "map_marker_alt", fa::location_dot },
+    { "location_dot_slash", fa::location_dot_slash },
+    { "map_marker_alt_slash", fa::location_dot_slash },
+    { "location_exclamation", fa::location_exclamation },
+    { "map_marker_exclamation", fa::location_exclamation },
+    { "location_minus", fa::location_minus },
+    { "map_marker_minus", fa::location_minus },
+    { "location_pen", fa::location_pen },
+    { "map_marker_edit", fa::location_pen },
+    { "location_pin", fa::location_pin },
+    { "map_marker", fa::location_pin },
+    { "location_pin_lock", fa::location_pin_lock },
+    { "location_pin_slash", fa::location_pin_slash },
+    { "map_marker_slash", fa::location_pin_slash },
+    { "location_plus", fa::location_plus },
+    { "map_marker_plus", fa::location_plus },
+    { "location_question", fa::location_question },
+    { "map_marker_question", fa::location_question },
+    { "location_smile", fa::location_smile },
+    { "map_marker_smile", fa::location_smile },
+    { "location_xmark", fa::location_xmark },
+    { "map_marker_times", fa::location_xmark },
+    { "map_marker_xmark", fa::location_xmark },
+    { "lock", fa::lock },
+    { "lock_a", fa::lock_a },
+    { "lock_hashtag", fa::lock_hashtag },
+    { "lock_keyhole", fa::lock_keyhole },
+    { "lock_alt", fa::lock_keyhole },
+    { "lock_keyhole_open", fa::lock_keyhole_open },
+    { "lock_open_alt", fa::lock_keyhole_open },
+    { "lock_open", fa::lock_open },
+    { "locust", fa::locust },
+    { "lollipop", fa::lollipop },
+    { "lollypop", fa::lollipop },
+    { "loveseat", fa::loveseat },
+    { "couch_small", fa::loveseat },
+    { "luchador_mask", fa::luchador_mask },
+    { "luchador", fa::luchador_mask },
+    { "mask_luchador", fa::luchador_mask },
+    { "lungs", fa::lungs },
+    { "lungs_virus", fa::lungs_virus },
+    { "m", fa::m },
+    { "mace", fa::mace },
+    { "magnet", fa::magnet },
+    { "magnifying_glass", fa::magnifying_glass },
+    { "search", fa::magnifying_glass },
+    { "magnifying_glass_arrow_right", fa::magnifying_glass_arrow_right },
+    { "magnifying_glass_chart", fa::magnifying_glass_chart },
+    { "magnifying_glass_dollar", fa::magnifying_glass_dollar },
+    { "search_dollar", fa::magnifying_glass_dollar },
+    { "magnifying_glass_location", fa::magnifying_glass_location },
+    { "search_location", fa::magnifying_glass_location },
+    { "magnifying_glass_minus", fa::magnifying_glass_minus },
+    { "search_minus", fa::magnifying_glass_minus },
+    { "magnifying_glass_plus", fa::magnifying_glass_plus },
+    { "search_plus", fa::magnifying_glass_plus },
+    { "mailbox", fa::mailbox },
+    { "manat_sign", fa::manat_sign },
+    { "mandolin", fa::mandolin },
+    { "mango", fa::mango },
+    { "manhole", fa::manhole },
+    { "map", fa::map },
+    { "map_location", fa::map_location },
+    { "map_marked", fa::map_location },
+    { "map_location_dot", fa::map_location_dot },
+    { "map_marked_alt", fa::map_location_dot },
+    { "map_pin", fa::map_pin },
+    { "marker", fa::marker },
+    { "mars", fa::mars },
+    { "mars_and_venus", fa::mars_and_venus },
+    { "mars_and_venus_burst", fa::mars_and_venus_burst },
+    { "mars_double", fa::mars_double },
+    { "mars_stroke", fa::mars_stroke },
+    { "mars_stroke_right", fa::mars_stroke_right },
+    { "mars_stroke_h", fa::mars_stroke_right },
+    { "mars_stroke_up", fa::mars_stroke_up },
+    { "mars_stroke_v", fa::mars_stroke_up },
+    { "martini_glass", fa::martini_glass },
+    { "glass_martini_alt", fa::martini_glass },
+    { "martini_glass_citrus", fa::martini_glass_citrus },
+    { "cocktail", fa::martini_glass_citrus },
+    { "martini_glass_empty", fa::martini_glass_empty },
+    { "glass_martini", fa::martini_glass_empty },
+    { "mask", fa::mask },
+    { "mask_face", fa::mask_face },
+    { "mask_snorkel", fa::mask_snorkel },
+    { "mask_ventilator", fa::mask_ventilator },
+    { "masks_theater", fa::masks_theater },
+    { "theater_masks", fa::masks_theater },
+    { "mattress_pillow", fa::mattress_pillow },
+    { "maximize", fa::maximize },
+    { "expand_arrows_alt", fa::maximize },
+    { "meat", fa::meat },
+    { "medal", fa::medal },
+    { "megaphone", fa::megaphone },
+    { "melon", fa::melon },
+    { "melon_slice", fa::melon_slice },
+    { "memo", fa::memo },
+    { "memo_circle_check", fa::memo_circle_check },
+    { "memo_circle_info", fa::memo_circle_info },
+    { "memo_pad", fa::memo_pad },
+    { "memory", fa::memory },
+    { "menorah", fa::menorah },
+    { "mercury", fa::mercury },
+    { "merge", fa::merge },
+    { "message", fa::message },
+    { "comment_alt", fa::message },
+    { "message_arrow_down", fa::message_arrow_down },
+    { "comment_alt_arrow_down", fa::message_arrow_down },
+    { "message_arrow_up", fa::message_arrow_up },
+    { "comment_alt_arrow_up", fa::message_arrow_up },
+    { "message_arrow_up_right", fa::message_arrow_up_right },
+    { "message_bot", fa::message_bot },
+    { "message_captions", fa::message_captions },
+    { "comment_alt_captions", fa::message_captions },
+    { "message_check", fa::message_check },
+    { "comment_alt_check", fa::message_check },
+    { "message_code", fa::message_code },
+    { "message_dollar", fa::message_dollar },
+    { "comment_alt_dollar", fa::message_dollar },
+    { "message_dots", fa::message_dots },
+    { "comment_alt_dots", fa::message_dots },
+    { "messaging", fa::message_dots },
+    { "message_exclamation", fa::message_exclamation },
+    { "comment_alt_exclamation", fa::message_exclamation },
+    { "message_image", fa::message_image },
+    { "comment_alt_image", fa::message_image },
+    { "message_lines", fa::message_lines },
+    { "comment_alt_lines", fa::message_lines },
+    { "message_medical", fa::message_medical },
+    { "comment_alt_medical", fa::message_medical },
+    { "message_middle", fa::message_middle },
+    { "comment_middle_alt", fa::message_middle },
+    { "message_middle_top", fa::message_middle_top },
+    { "comment_middle_top_alt", fa::message_middle_top },
+    { "message_minus", fa::message_minus },
+    { "comment_alt_minus", fa::message_minus },
+    { "message_music", fa::message_music },
+    { "comment_alt_music", fa::message_music },
+    { "message_pen", fa::message_pen },
+    { "comment_alt_edit", fa::message_pen },
+    { "message_edit", fa::message_pen },
+    { "message_plus", fa::message_plus },
+    { "comment_alt_plus", fa::message_plus },
+    { "message_question", fa::message_question },
+    { "message_quote", fa::message_quote },
+    { "comment_alt_quote", fa::message_quote },
+    { "message_slash", fa::message_slash },
+    { "comment_alt_slash", fa::message_slash },
+    { "message_smile", fa::message_smile },
+    { "comment_alt_smile", fa::message_smile },
+    { "message_sms", fa::message_sms },
+    { "message_text", fa::message_text },
+    { "comment_alt_text", fa::message_text },
+    { "message_xmark", fa::message_xmark },
+    { "comment_alt_times", fa::message_xmark },
+    { "message_times", fa::message_xmark },
+    { "messages", fa::messages },
+    { "comments_alt", fa::messages },
+    { "messages_dollar", fa::messages_dollar },
+    { "comments_alt_dollar", fa::messages_dollar },
+    { "messages_question", fa::messages_question },
+    { "meteor", fa::meteor },
+    { "meter", fa::meter },
+    { "meter_bolt", fa::meter_bolt },
+    { "meter_droplet", fa::meter_droplet },
+    { "meter_fire", fa::meter_fire },
+    { "microchip", fa::microchip },
+    { "microchip_ai", fa::microchip_ai },
+    { "microphone", fa::microphone },
+    { "microphone_lines", fa::microphone_lines },
+    { "microphone_alt", fa::microphone_lines },
+    { "microphone_lines_slash", fa::microphone_lines_slash },
+    { "microphone_alt_slash", fa::microphone_lines_slash },
+    { "microphone_slash", fa::microphone_slash },
+    { "microphone_stand", fa::microphone_stand },
+    { "microscope", fa::microscope },
+    { "microwave", fa::microwave },
+    { "mill_sign", fa::mill_sign },
+    { "minimize", fa::minimize },
+    { "compress_arrows_alt", fa::minimize },
+    { "minus", fa::minus },
+    { "subtract", fa::minus },
+    { "mistletoe", fa::mistletoe },
+    { "mitten", fa::mitten },
+    { "mobile", fa::mobile },
+    { "mobile_android", fa::mobile },
+    { "mobile_phone", fa::mobile },
+    { "mobile_button", fa::mobile_button },
+    { "mobile_notch", fa::mobile_notch },
+    { "mobile_iphone", fa::mobile_notch },
+    { "mobile_retro", fa::mobile_retro },
+    { "mobile_screen", fa::mobile_screen },
+    { "mobile_android_alt", fa::mobile_screen },
+    { "mobile_screen_button", fa::mobile_screen_button },
+    { "mobile_alt", fa::mobile_screen_button },
+    { "mobile_signal", fa::mobile_signal },
+    { "mobile_signal_out", fa::mobile_signal_out },
+    { "money_bill", fa::money_bill },
+    { "money_bill_1", fa::money_bill_1 },
+    { "money_bill_alt", fa::money_bill_1 },
+    { "money_bill_1_wave", fa::money_bill_1_wave },
+    { "money_bill_wave_alt", fa::money_bill_1_wave },
+    { "money_bill_simple", fa::money_bill_simple },
+    { "money_bill_simple_wave", fa::money_bill_simple_wave },
+    { "money_bill_transfer", fa::money_bill_transfer },
+    { "money_bill_trend_up", fa::money_bill_trend_up },
+    { "money_bill_wave", fa::money_bill_wave },
+    { "money_bill_wheat", fa::money_bill_wheat },
+    { "money_bills", fa::money_bills },
+    { "money_bills_simple", fa::money_bills_simple },
+    { "money_bills_alt", fa::money_bills_simple },
+    { "money_check", fa::money_check },
+    { "money_check_dollar", fa::money_check_dollar },
+    { "money_check_alt", fa::money_check_dollar },
+    { "money_check_dollar_pen", fa::money_check_dollar_pen },
+    { "money_check_edit_alt", fa::money_check_dollar_pen },
+    { "money_check_pen", fa::money_check_pen },
+    { "money_check_edit", fa::money_check_pen },
+    { "money_from_bracket", fa::money_from_bracket },
+    { "money_simple_from_bracket", fa::money_simple_from_bracket },
+    { "monitor_waveform", fa::monitor_waveform },
+    { "monitor_heart_rate", fa::monitor_waveform },
+    { "monkey", fa::monkey },
+    { "monument", fa::monument },
+    { "moon", fa::moon },
+    { "moon_cloud", fa::moon_cloud },
+    { "moon_over_sun", fa::moon_over_sun },
+    { "eclipse_alt", fa::moon_over_sun },
+    { "moon_stars", fa::moon_stars },
+    { "moped", fa::moped },
+    { "mortar_pestle", fa::mortar_pestle },
+    { "mosque", fa::mosque },
+    { "mosquito", fa::mosquito },
+    { "mosquito_net", fa::mosquito_net },
+    { "motorcycle", fa::motorcycle },
+    { "mound", fa::mound },
+    { "mountain", fa::mountain },
+    { "mountain_city", fa::mountain_city },
+    { "mountain_sun", fa::mountain_sun },
+    { "mountains", fa::mountains },
+    { "mp3_player", fa::mp3_player },
+    { "mug", fa::mug },
+    { "mug_hot", fa::mug_hot },
+    { "mug_marshmallows", fa::mug_marshmallows },
+    { "mug_saucer", fa::mug_saucer },
+    { "coffee", fa::mug_saucer },
+    { "mug_tea", fa::mug_tea },
+    { "mug_tea_saucer", fa::mug_tea_saucer },
+    { "mushroom", fa::mushroom },
+    { "music", fa::music },
+    { "music_note", fa::music_note },
+    { "music_alt", fa::music_note },
+    { "music_note_slash", fa::music_note_slash },
+    { "music_alt_slash", fa::music_note_slash },
+    { "music_slash", fa::music_slash },
+    { "n", fa::n },
+    { "naira_sign", fa::naira_sign },
+    { "narwhal", fa::narwhal },
+    { "nesting_dolls", fa::nesting_dolls },
+    { "network_wired", fa::network_wired },
+    { "neuter", fa::neuter },
+    { "newspaper", fa::newspaper },
+    { "nfc", fa::nfc },
+    { "nfc_lock", fa::nfc_lock },
+    { "nfc_magnifying_glass", fa::nfc_magnifying_glass },
+    { "nfc_pen", fa::nfc_pen },
+    { "nfc_signal", fa::nfc_signal },
+    { "nfc_slash", fa::nfc_slash },
+    { "nfc_trash", fa::nfc_trash },
+    { "not_equal", fa::not_equal },
+    { "notdef", fa::notdef },
+    { "note", fa::note },
+    { "note_medical", fa::note_medical },
+    { "note_sticky", fa::note_sticky },
+    { "sticky_note", fa::note_sticky },
+    { "notebook", fa::notebook },
+    { "notes", fa::notes },
+    { "notes_medical", fa::notes_medical },
+    { "o", fa::o },
+    { "object_exclude", fa::object_exclude },
+    { "object_group", fa::object_group },
+    { "object_intersect", fa::object_intersect },
+    { "object_subtract", fa::object_subtract },
+    { "object_ungroup", fa::object_ungroup },
+    { "object_union", fa::object_union },
+    { "objects_align_bottom", fa::objects_align_bottom },
+    { "objects_align_center_horizontal", fa::objects_align_center_horizontal },
+    { "objects_align_center_vertical", fa::objects_align_center_vertical },
+    { "objects_align_left", fa::objects_align_left },
+    { "objects_align_right", fa::objects_align_right },
+    { "objects_align_top", fa::objects_align_top },
+    { "objects_column", fa::objects_column },
+    { "octagon", fa::octagon },
+    { "octagon_check", fa::octagon_check },
+    { "octagon_divide", fa::octagon_divide },
+    { "octagon_exclamation", fa::octagon_exclamation },
+    { "octagon_minus", fa::octagon_minus },
+    { "minus_octagon", fa::octagon_minus },
+    { "octagon_plus", fa::octagon_plus },
+    { "plus_octagon", fa::octagon_plus },
+    { "octagon_xmark", fa::octagon_xmark },
+    { "times_octagon", fa::octagon_xmark },
+    { "xmark_octagon", fa::octagon_xmark },
+    { "oil_can", fa::oil_can },
+    { "oil_can_drip", fa::oil_can_drip },
+    { "oil_temperature", fa::oil_temperature },
+    { "oil_temp", fa::oil_temperature },
+    { "oil_well", fa::oil_well },
+    { "olive", fa::olive },
+    { "olive_branch", fa::olive_branch },
+    { "om", fa::om },
+    { "omega", fa::omega },
+    { "onion", fa::onion },
+    { "option", fa::option },
+    { "ornament", fa::ornament },
+    { "otter", fa::otter },
+    { "outdent", fa::outdent },
+    { "dedent", fa::outdent },
+    { "outlet", fa::outlet },
+    { "oven", fa::oven },
+    { "overline", fa::overline },
+    { "p", fa::p },
+    { "page", fa::page },
+    { "page_caret_down", fa::page_caret_down },
+    { "file_caret_down", fa::page_caret_down },
+    { "page_caret_up", fa::page_caret_up },
+    { "file_caret_up", fa::page_caret_up },
+    { "pager", fa::pager },
+    { "paint_roller", fa::paint_roller },
+    { "paintbrush", fa::paintbrush },
+    { "paint_brush", fa::paintbrush },
+    { "paintbrush_fine", fa::paintbrush_fine },
+    { "paint_brush_alt", fa::paintbrush_fine },
+    { "paint_brush_fine", fa::paintbrush_fine },
+    { "paintbrush_alt", fa::paintbrush_fine },
+    { "paintbrush_pencil", fa::paintbrush_pencil },
+    { "palette", fa::palette },
+    { "pallet", fa::pallet },
+    { "pallet_box", fa::pallet_box },
+    { "pallet_boxes", fa::pallet_boxes },
+    { "palette_boxes", fa::pallet_boxes },
+    { "pallet_alt", fa::pallet_boxes },
+    { "pan_food", fa::pan_food },
+    { "pan_frying", fa::pan_frying },
+    { "pancakes", fa::pancakes },
+    { "panel_ews", fa::panel_ews },
+    { "panel_fire", fa::panel_fire },
+    { "panorama", fa::panorama },
+    { "paper_plane", fa::paper_plane },
+    { "paper_plane_top", fa::paper_plane_top },
+    { "paper_plane_alt", fa::paper_plane_top },
+    { "send", fa::paper_plane_top },
+    { "paperclip", fa::paperclip },
+    { "paperclip_vertical", fa::paperclip_vertical },
+    { "parachute_box", fa::parachute_box },
+    { "paragraph", fa::paragraph },
+    { "paragraph_left", fa::paragraph_left },
+    { "paragraph_rtl", fa::paragraph_left },
+    { "party_bell", fa::party_bell },
+    { "party_horn", fa::party_horn },
+    { "passport", fa::passport },
+    { "paste", fa::paste },
+    { "file_clipboard", fa::paste },
+    { "pause", fa::pause },
+    { "paw", fa::paw },
+    { "paw_claws", fa::paw_claws },
+    { "paw_simple", fa::paw_simple },
+    { "paw_alt", fa::paw_simple },
+    { "peace", fa::peace },
+    { "peach", fa::peach },
+    { "peanut", fa::peanut },
+    { "peanuts", fa::peanuts },
+    { "peapod", fa::peapod },
+    { "pear", fa::pear },
+    { "pedestal", fa::pedestal },
+    { "pegasus", fa::pegasus },
+    { "pen", fa::pen },
+    { "pen_circle", fa::pen_circle },
+    { "pen_clip", fa::pen_clip },
+    { "pen_alt", fa::pen_clip },
+    { "pen_clip_slash", fa::pen_clip_slash },
+    { "pen_alt_slash", fa::pen_clip_slash },
+    { "pen_fancy", fa::pen_fancy },
+    { "pen_fancy_slash", fa::pen_fancy_slash },
+    { "pen_field", fa::pen_field },
+    { "pen_line", fa::pen_line },
+    { "pen_nib", fa::pen_nib },
+    { "pen_nib_slash", fa::pen_nib_slash },
+    { "pen_paintbrush", fa::pen_paintbrush },
+    { "pencil_paintbrush", fa::pen_paintbrush },
+    { "pen_ruler", fa::pen_ruler },
+    { "pencil_ruler", fa::pen_ruler },
+    { "pen_slash", fa::pen_slash },
+    { "pen_swirl", fa::pen_swirl },
+    { "pen_to_square", fa::pen_to_square },
+    { "edit", fa::pen_to_square },
+    { "pencil", fa::pencil },
+    { "pencil_alt", fa::pencil },
+    { "pencil_slash", fa::pencil_slash },
+    { "people", fa::people },
+    { "people_arrows_left_right", fa::people_arrows_left_right },
+    { "people_arrows", fa::people_arrows_left_right },
+    { "people_carry_box", fa::people_carry_box },
+    { "people_carry", fa::people_carry_box },
+    { "people_dress", fa::people_dress },
+    { "people_dress_simple", fa::people_dress_simple },
+    { "people_group", fa::people_group },
+    { "people_line", fa::people_line },
+    { "people_pants", fa::people_pants },
+    { "people_pants_simple", fa::people_pants_simple },
+    { "people_pulling", fa::people_pulling },
+    { "people_robbery", fa::people_robbery },
+    { "people_roof", fa::people_roof },
+    { "people_simple", fa::people_simple },
+    { "pepper", fa::pepper },
+    { "pepper_hot", fa::pepper_hot },
+    { "percent", fa::percent },
+    { "percentage", fa::percent },
+    { "period", fa::period },
+    { "person", fa::person },
+    { "male", fa::person },
+    { "person_arrow_down_to_line", fa::person_arrow_down_to_line },
+    { "person_arrow_up_from_line", fa::person_arrow_up_from_line },
+    { "person_biking", fa::person_biking },
+    { "biking", fa::person_biking },
+    { "person_biking_mountain", fa::person_biking_mountain },
+    { "biking_mountain", fa::person_biking_mountain },
+    { "person_booth", fa::person_booth },
+    { "person_breastfeeding", fa::person_breastfeeding },
+    { "person_burst", fa::person_burst },
+    { "person_cane", fa::person_cane },
+    { "person_carry_box", fa::person_carry_box },
+    { "person_carry", fa::person_carry_box },
+    { "person_chalkboard", fa::person_chalkboard },
+    { "person_circle_check", fa::person_circle_check },
+    { "person_circle_exclamation", fa::person_circle_exclamation },
+    { "person_circle_minus", fa::person_circle_minus },
+    { "person_circle_plus", fa::person_circle_plus },
+    { "person_circle_question", fa::person_circle_question },
+    { "person_circle_xmark", fa::person_circle_xmark },
+    { "person_digging", fa::person_digging },
+    { "digging", fa::person_digging },
+    { "person_dolly", fa::person_dolly },
+    { "person_dolly_empty", fa::person_dolly_empty },
+    { "person_dots_from_line", fa::person_dots_from_line },
+    { "diagnoses", fa::person_dots_from_line },
+    { "person_dress", fa::person_dress },
+    { "female", fa::person_dress },
+    { "person_dress_burst", fa::person_dress_burst },
+    { "person_dress_simple", fa::person_dress_simple },
+    { "person_drowning", fa::person_drowning },
+    { "person_falling", fa::person_falling },
+    { "person_falling_burst", fa::person_falling_burst },
+    { "person_from_portal", fa::person_from_portal },
+    { "portal_exit", fa::person_from_portal },
+    { "person_half_dress", fa::person_half_dress },
+    { "person_harassing", fa::person_harassing },
+    { "person_hiking", fa::person_hiking },
+    { "hiking", fa::person_hiking },
+    { "person_military_pointing", fa::person_military_pointing },
+    { "person_military_rifle", fa::person_military_rifle },
+    { "person_military_to_person", fa::person_military_to_person },
+    { "person_pinball", fa::person_pinball },
+    { "person_praying", fa::person_praying },
+    { "pray", fa::person_praying },
+    { "person_pregnant", fa::person_pregnant },
+    { "person_rays", fa::person_rays },
+    { "person_rifle", fa::person_rifle },
+    { "person_running", fa::person_running },
+    { "running", fa::person_running },
+    { "person_seat", fa::person_seat },
+    { "person_seat_reclined", fa::person_seat_reclined },
+    { "person_shelter", fa::person_shelter },
+    { "person_sign", fa::person_sign },
+    { "person_simple", fa::person_simple },
+    { "person_skating", fa::person_skating },
+    { "skating", fa::person_skating },
+    { "person_ski_jumping", fa::person_ski_jumping },
+    { "ski_jump", fa::person_ski_jumping },
+    { "person_ski_lift", fa::person_ski_lift },
+    { "ski_lift", fa::person_ski_lift },
+    { "person_skiing", fa::person_skiing },
+    { "skiing", fa::person_skiing },
+    { "person_skiing_nordic", fa::person_skiing_nordic },
+    { "skiing_nordic", fa::person_skiing_nordic },
+    { "person_sledding", fa::person_sledding },
+    { "sledding", fa::person_sledding },
+    { "person_snowboarding", fa::person_snowboarding },
+    { "snowboarding", fa::person_snowboarding },
+    { "person_snowmobiling", fa::person_snowmobiling },
+    { "snowmobile", fa::person_snowmobiling },
+    { "person_swimming", fa::person_swimming },
+    { "swimmer", fa::person_swimming },
+    { "person_through_window", fa::person_through_window },
+    { "person_to_door", fa::person_to_door },
+    { "person_to_portal", fa::person_to_portal },
+    { "portal_enter", fa::person_to_portal },
+    { "person_walking", fa::person_walking },
+    { "walking", fa::person_walking },
+    { "person_walking_arrow_loop_left", fa::person_walking_arrow_loop_left },
+    { "person_walking_arrow_right", fa::person_walking_arrow_right },
+    { "person_walking_dashed_line_arrow_right", fa::person_walking_dashed_line_arrow_right },
+    { "person_walking_luggage", fa::person_walking_luggage },
+    { "person_walking_with_cane", fa::person_walking_with_cane },
+    { "blind", fa::person_walking_with_cane },
+    { "peseta_sign", fa::peseta_sign },
+    { "peso_sign", fa::peso_sign },
+    { "phone", fa::phone },
+    { "phone_arrow_down_left", fa::phone_arrow_down_left },
+    { "phone_arrow_down", fa::phone_arrow_down_left },
+    { "phone_incoming", fa::phone_arrow_down_left },
+    { "phone_arrow_up_right", fa::phone_arrow_up_right },
+    { "phone_arrow_up", fa::phone_arrow_up_right },
+    { "phone_outgoing", fa::phone_arrow_up_right },
+    { "phone_flip", fa::phone_flip },
+    { "phone_alt", fa::phone_flip },
+    { "phone_hangup", fa::phone_hangup },
+    { "phone_intercom", fa::phone_intercom },
+    { "phone_missed", fa::phone_missed },
+    { "phone_office", fa::phone_office },
+    { "phone_plus", fa::phone_plus },
+    { "phone_rotary", fa::phone_rotary },
+    { "phone_slash", fa::phone_slash },
+    { "phone_volume", fa::phone_volume },
+    { "volume_control_phone", fa::phone_volume },
+    { "phone_xmark", fa::phone_xmark },
+    { "photo_film", fa::photo_film },
+    { "photo_video", fa::photo_film },
+    { "photo_film_music", fa::photo_film_music },
+    { "pi", fa::pi },
+    { "piano", fa::piano },
+    { "piano_keyboard", fa::piano_keyboard },
+    { "pickleball", fa::pickleball },
+    { "pie", fa::pie },
+    { "pig", fa::pig },
+    { "piggy_bank", fa::piggy_bank },
+    { "pills", fa::pills },
+    { "pinata", fa::pinata },
+    { "pinball", fa::pinball },
+    { "pineapple", fa::pineapple },
+    { "pipe", fa::pipe },
+    { "pipe_circle_check", fa::pipe_circle_check },
+    { "pipe_collar", fa::pipe_collar },
+    { "pipe_section", fa::pipe_section },
+    { "pipe_smoking", fa::pipe_smoking },
+    { "pipe_valve", fa::pipe_valve },
+    { "pizza", fa::pizza },
+    { "pizza_slice", fa::pizza_slice },
+    { "place_of_worship", fa::place_of_worship },
+    { "plane", fa::plane },
+    { "plane_arrival", fa::plane_arrival },
+    { "plane_circle_check", fa::plane_circle_check },
+    { "plane_circle_exclamation", fa::plane_circle_exclamation },
+    { "plane_circle_xmark", fa::plane_circle_xmark },
+    { "plane_departure", fa::plane_departure },
+    { "plane_engines", fa::plane_engines },
+    { "plane_alt", fa::plane_engines },
+    { "plane_lock", fa::plane_lock },
+    { "plane_prop", fa::plane_prop },
+    { "plane_slash", fa::plane_slash },
+    { "plane_tail", fa::plane_tail },
+    { "plane_up", fa::plane_up },
+    { "plane_up_slash", fa::plane_up_slash },
+    { "planet_moon", fa::planet_moon },
+    { "planet_ringed", fa::planet_ringed },
+    { "plant_wilt", fa::plant_wilt },
+    { "plate_utensils", fa::plate_utensils },
+    { "plate_wheat", fa::plate_wheat },
+    { "play", fa::play },
+    { "play_pause", fa::play_pause },
+    { "plug", fa::plug },
+    { "plug_circle_bolt", fa::plug_circle_bolt },
+    { "plug_circle_check", fa::plug_circle_check },
+    { "plug_circle_exclamation", fa::plug_circle_exclamation },
+    { "plug_circle_minus", fa::plug_circle_minus },
+    { "plug_circle_plus", fa::plug_circle_plus },
+    { "plug_circle_xmark", fa::plug_circle_xmark },
+    { "plus", fa::plus },
+    { "add", fa::plus },
+    { "plus_large", fa::plus_large },
+    { "plus_minus", fa::plus_minus },
+    { "podcast", fa::podcast },
+    { "podium", fa::podium },
+    { "podium_star", fa::podium_star },
+    { "police_box", fa::police_box },
+    { "poll_people", fa::poll_people },
+    { "pompebled", fa::pompebled },
+    { "poo", fa::poo },
+    { "poo_storm", fa::poo_storm },
+    { "poo_bolt", fa::poo_storm },
+    { "pool_8_ball", fa::pool_8_ball },
+    { "poop", fa::poop },
+    { "popcorn", fa::popcorn },
+    { "popsicle", fa::popsicle },
+    { "pot_food", fa::pot_food },
+    { "potato", fa::potato },
+    { "power_off", fa::power_off },
+    { "prescription", fa::prescription },
+    { "prescription_bottle", fa::prescription_bottle },
+    { "prescription_bottle_medical", fa::prescription_bottle_medical },
+    { "prescription_bottle_alt", fa::prescription_bottle_medical },
+    { "presentation_screen", fa::presentation_screen },
+    { "presentation", fa::presentation_screen },
+    { "pretzel", fa::pretzel },
+    { "print", fa::print },
+    { "print_magnifying_glass", fa::print_magnifying_glass },
+    { "print_search", fa::print_magnifying_glass },
+    { "print_slash", fa::print_slash },
+    { "projector", fa::projector },
+    { "pump", fa::pump },
+    { "pump_medical", fa::pump_medical },
+    { "pump_soap", fa::pump_soap },
+    { "pumpkin", fa::pumpkin },
+    { "puzzle", fa::puzzle },
+    { "puzzle_piece", fa::puzzle_piece },
+    { "puzzle_piece_simple", fa::puzzle_piece_simple },
+    { "puzzle_piece_alt", fa::puzzle_piece_simple },
+    { "q", fa::q },
+    { "qrcode", fa::qrcode },
+    { "question", fa::question },
+    { "quote_left", fa::quote_left },
+    { "quote_left_alt", fa::quote_left },
+    { "quote_right", fa::quote_right },
+    { "quote_right_alt", fa::quote_right },
+    { "quotes", fa::quotes },
+    { "r", fa::r },
+    { "rabbit", fa::rabbit },
+    { "rabbit_running", fa::rabbit_running },
+    { "rabbit_fast", fa::rabbit_running },
+    { "racquet", fa::racquet },
+    { "radar", fa::radar },
+    { "radiation", fa::radiation },
+    { "radio", fa::radio },
+    { "radio_tuner", fa::radio_tuner },
+    { "radio_alt", fa::radio_tuner },
+    { "rainbow", fa::rainbow },
+    { "raindrops", fa::raindrops },
+    { "ram", fa::ram },
+    { "ramp_loading", fa::ramp_loading },
+    { "ranking_star", fa::ranking_star },
+    { "raygun", fa::raygun },
+    { "receipt", fa::receipt },
+    { "record_vinyl", fa::record_vinyl },
+    { "rectangle", fa::rectangle },
+    { "rectangle_landscape", fa::rectangle },
+    { "rectangle_ad", fa::rectangle_ad },
+    { "ad", fa::rectangle_ad },
+    { "rectangle_barcode", fa::rectangle_barcode },
+    { "barcode_alt", fa::rectangle_barcode },
+    { "rectangle_code", fa::rectangle_code },
+    { "rectangle_history", fa::rectangle_history },
+    { "rectangle_history_circle_plus", fa::rectangle_history_circle_plus },
+    { "rectangle_history_circle_user", fa::rectangle_history_circle_user },
+    { "rectangle_list", fa::rectangle_list },
+    { "list_alt", fa::rectangle_list },
+    { "rectangle_pro", fa::rectangle_pro },
+    { "pro", fa::rectangle_pro },
+    { "rectangle_terminal", fa::rectangle_terminal },
+    { "rectangle_vertical", fa::rectangle_vertical },
+    { "rectangle_portrait", fa::rectangle_vertical },
+    { "rectangle_vertical_history", fa::rectangle_vertical_history },
+    { "rectangle_wide", fa::rectangle_wide },
+    { "rectangle_xmark", fa::rectangle_xmark },
+    { "rectangle_times", fa::rectangle_xmark },
+    { "times_rectangle", fa::rectangle_xmark },
+    { "window_close", fa::rectangle_xmark },
+    { "rectangles_mixed", fa::rectangles_mixed },
+    { "recycle", fa::recycle },
+    { "reel", fa::reel },
+    { "refrigerator", fa::refrigerator },
+    { "registered", fa::registered },
+    { "repeat", fa::repeat },
+    { "repeat_1", fa::repeat_1 },
+    { "reply", fa::reply },
+    { "mail_reply", fa::reply },
+    { "reply_all", fa::reply_all },
+    { "mail_reply_all", fa::reply_all },
+    { "reply_clock", fa::reply_clock },
+    { "reply_time", fa::reply_clock },
+    { "republican", fa::republican },
+    { "restroom", fa::restroom },
+    { "restroom_simple", fa::restroom_simple },
+    { "retweet", fa::retweet },
+    { "rhombus", fa::rhombus },
+    { "ribbon", fa::ribbon },
+    { "right", fa::right },
+    { "arrow_alt_right", fa::right },
+    { "right_from_bracket", fa::right_from_bracket },
+    { "sign_out_alt", fa::right_from_bracket },
+    { "right_from_line", fa::right_from_line },
+    { "arrow_alt_from_left", fa::right_from_line },
+    { "right_left", fa::right_left },
+    { "exchange_alt", fa::right_left },
+    { "right_long", fa::right_long },
+    { "long_arrow_alt_right", fa::right_long },
+    { "right_long_to_line", fa::right_long_to_line },
+    { "right_to_bracket", fa::right_to_bracket },
+    { "sign_in_alt", fa::right_to_bracket },
+    { "right_to_line", fa::right_to_line },
+    { "arrow_alt_to_right", fa::right_to_line },
+    { "ring", fa::ring },
+    { "rings_wedding", fa::rings_wedding },
+    { "road", fa::road },
+    { "road_barrier", fa::road_barrier },
+    { "road_bridge", fa::road_bridge },
+    { "road_circle_check", fa::road_circle_check },
+    { "road_circle_exclamation", fa::road_circle_exclamation },
+    { "road_circle_xmark", fa::road_circle_xmark },
+    { "road_lock", fa::road_lock },
+    { "road_spikes", fa::road_spikes },
+    { "robot", fa::robot },
+    { "robot_astromech", fa::robot_astromech },
+    { "rocket", fa::rocket },
+    { "rocket_launch", fa::rocket_launch },
+    { "roller_coaster", fa::roller_coaster },
+    { "rotate", fa::rotate },
+    { "sync_alt", fa::rotate },
+    { "rotate_exclamation", fa::rotate_exclamation },
+    { "rotate_left", fa::rotate_left },
+    { "rotate_back", fa::rotate_left },
+    { "rotate_backward", fa::rotate_left },
+    { "undo_alt", fa::rotate_left },
+    { "rotate_right", fa::rotate_right },
+    { "redo_alt", fa::rotate_right },
+    { "rotate_forward", fa::rotate_right },
+    { "route", fa::route },
+    { "route_highway", fa::route_highway },
+    { "route_interstate", fa::route_interstate },
+    { "router", fa::router },
+    { "rss", fa::rss },
+    { "feed", fa::rss },
+    { "ruble_sign", fa::ruble_sign },
+    { "rouble", fa::ruble_sign },
+    { "rub", fa::ruble_sign },
+    { "ruble", fa::ruble_sign },
+    { "rug", fa::rug },
+    { "rugby_ball", fa::rugby_ball },
+    { "ruler", fa::ruler },
+    { "ruler_combined", fa::ruler_combined },
+    { "ruler_horizontal", fa::ruler_horizontal },
+    { "ruler_triangle", fa::ruler_triangle },
+    { "ruler_vertical", fa::ruler_vertical },
+    { "rupee_sign", fa::rupee_sign },
+    { "rupee", fa::rupee_sign },
+    { "rupiah_sign", fa::rupiah_sign },
+    { "rv", fa::rv },
+    { "s", fa::s },
+    { "sack", fa::sack },
+    { "sack_dollar", fa::sack_dollar },
+    { "sack_xmark", fa::sack_xmark },
+    { "sailboat", fa::sailboat },
+    { "salad", fa::salad },
+    { "bowl_salad", fa::salad },
+    { "salt_shaker", fa::salt_shaker },
+    { "sandwich", fa::sandwich },
+    { "satellite", fa::satellite },
+    { "satellite_dish", fa::satellite_dish },
+    { "sausage", fa::sausage },
+    { "saxophone", fa::saxophone },
+    { "saxophone_fire", fa::saxophone_fire },
+    { "sax_hot", fa::saxophone_fire },
+    { "scale_balanced", fa::scale_balanced },
+    { "balance_scale", fa::scale_balanced },
+    { "scale_unbalanced", fa::scale_unbalanced },
+    { "balance_scale_left", fa::scale_unbalanced },
+    { "scale_unbalanced_flip", fa::scale_unbalanced_flip },
+    { "balance_scale_right", fa::scale_unbalanced_flip },
+    { "scalpel", fa::scalpel },
+    { "scalpel_line_dashed", fa::scalpel_line_dashed },
+    { "scalpel_path", fa::scalpel_line_dashed },
+    { "scanner", fa::scanner },
+    { "scanner_image", fa::scanner },
+    { "scanner_gun", fa::scanner_gun },
+    { "scanner_keyboard", fa::scanner_keyboard },
+    { "scanner_touchscreen", fa::scanner_touchscreen },
+    { "scarecrow", fa::scarecrow },
+    { "scarf", fa::scarf },
+    { "school", fa::school },
+    { "school_circle_check", fa::school_circle_check },
+    { "school_circle_exclamation", fa::school_circle_exclamation },
+    { "school_circle_xmark", fa::school_circle_xmark },
+    { "school_flag", fa::school_flag },
+    { "school_lock", fa::school_lock },
+    { "scissors", fa::scissors },
+    { "cut", fa::scissors },
+    { "screen_users", fa::screen_users },
+    { "users_class", fa::screen_users },
+    { "screencast", fa::screencast },
+    { "screwdriver", fa::screwdriver },
+    { "screwdriver_wrench", fa::screwdriver_wrench },
+    { "tools", fa::screwdriver_wrench },
+    { "scribble", fa::scribble },
+    { "scroll", fa::scroll },
+    { "scroll_old", fa::scroll_old },
+    { "scroll_torah", fa::scroll_torah },
+    { "torah", fa::scroll_torah },
+    { "scrubber", fa::scrubber },
+    { "scythe", fa::scythe },
+    { "sd_card", fa::sd_card },
+    { "sd_cards", fa::sd_cards },
+    { "seal", fa::seal },
+    { "seal_exclamation", fa::seal_exclamation },
+    { "seal_question", fa::seal_question },
+    { "seat_airline", fa::seat_airline },
+    { "section", fa::section },
+    { "seedling", fa::seedling },
+    { "sprout", fa::seedling },
+    { "semicolon", fa::semicolon },
+    { "send_back", fa::send_back },
+    { "send_backward", fa::send_backward },
+    { "sensor", fa::sensor },
+    { "sensor_cloud", fa::sensor_cloud },
+    { "sensor_smoke", fa::sensor_cloud },
+    { "sensor_fire", fa::sensor_fire },
+    { "sensor_on", fa::sensor_on },
+    { "sensor_triangle_exclamation", fa::sensor_triangle_exclamation },
+    { "sensor_alert", fa::sensor_triangle_exclamation },
+    { "server", fa::server },
+    { "shapes", fa::shapes },
+    { "triangle_circle_square", fa::shapes },
+    { "share", fa::share },
+    { "arrow_turn_right", fa::share },
+    { "mail_forward", fa::share },
+    { "share_all", fa::share_all },
+    { "share_from_square", fa::share_from_square },
+    { "share_square", fa::share_from_square },
+    { "share_nodes", fa::share_nodes },
+    { "share_alt", fa::share_nodes },
+    { "sheep", fa::sheep },
+    { "sheet_plastic", fa::sheet_plastic },
+    { "shekel_sign", fa::shekel_sign },
+    { "ils", fa::shekel_sign },
+    { "shekel", fa::shekel_sign },
+    { "sheqel", fa::shekel_sign },
+    { "sheqel_sign", fa::shekel_sign },
+    { "shelves", fa::shelves },
+    { "inventory", fa::shelves },
+    { "shelves_empty", fa::shelves_empty },
+    { "shield", fa::shield },
+    { "shield_blank", fa::shield },
+    { "shield_cat", fa::shield_cat },
+    { "shield_check", fa::shield_check },
+    { "shield_cross", fa::shield_cross },
+    { "shield_dog", fa::shield_dog },
+    { "shield_exclamation", fa::shield_exclamation },
+    { "shield_halved", fa::shield_halved },
+    { "shield_alt", fa::shield_halved },
+    { "shield_heart", fa::shield_heart },
+    { "shield_keyhole", fa::shield_keyhole },
+    { "shield_minus", fa::shield_minus },
+    { "shield_plus", fa::shield_plus },
+    { "shield_quartered", fa::shield_quartered },
+    { "shield_slash", fa::shield_slash },
+    { "shield_virus", fa::shield_virus },
+    { "shield_xmark", fa::shield_xmark },
+    { "shield_times", fa::shield_xmark },
+    { "ship", fa::ship },
+    { "shirt", fa::shirt },
+    { "t_shirt", fa::shirt },
+    { "tshirt", fa::shirt },
+    { "shirt_long_sleeve", fa::shirt_long_sleeve },
+    { "shirt_running", fa::shirt_running },
+    { "shirt_tank_top", fa::shirt_tank_top },
+    { "shish_kebab", fa::shish_kebab },
+    { "shoe_prints", fa::shoe_prints },
+    { "shop", fa::shop },
+    { "store_alt", fa::shop },
+    { "shop_lock", fa::shop_lock },
+    { "shop_slash", fa::shop_slash },
+    { "store_alt_slash", fa::shop_slash },
+    { "shovel", fa::shovel },
+    { "shovel_snow", fa::shovel_snow },
+    { "shower", fa::shower },
+    { "shower_down", fa::shower_down },
+    { "shower_alt", fa::shower_down },
+    { "shredder", fa::shredder },
+    { "shrimp", fa::shrimp },
+    { "shuffle", fa::shuffle },
+    { "random", fa::shuffle },
+    { "shutters", fa::shutters },
+    { "shuttle_space", fa::shuttle_space },
+    { "space_shuttle", fa::shuttle_space },
+    { "shuttlecock", fa::shuttlecock },
+    { "sickle", fa::sickle },
+    { "sidebar", fa::sidebar },
+    { "sidebar_flip", fa::sidebar_flip },
+    { "sigma", fa::sigma },
+    { "sign_hanging", fa::sign_hanging },
+    { "sign", fa::sign_hanging },
+    { "signal", fa::signal },
+    { "signal_5", fa::signal },
+    { "signal_perfect", fa::signal },
+    { "signal_bars", fa::signal_bars },
+    { "signal_alt", fa::signal_bars },
+    { "signal_alt_4", fa::signal_bars },
+    { "signal_bars_strong", fa::signal_bars },
+    { "signal_bars_fair", fa::signal_bars_fair },
+    { "signal_alt_2", fa::signal_bars_fair },
+    { "signal_bars_good", fa::signal_bars_good },
+    { "signal_alt_3", fa::signal_bars_good },
+    { "signal_bars_slash", fa::signal_bars_slash },
+    { "signal_alt_slash", fa::signal_bars_slash },
+    { "signal_bars_weak", fa::signal_bars_weak },
+    { "signal_alt_1", fa::signal_bars_weak },
+    { "signal_fair", fa::signal_fair },
+    { "signal_2", fa::signal_fair },
+    { "signal_good", fa::signal_good },
+    { "signal_3", fa::signal_good },
+    { "signal_slash", fa::signal_slash },
+    { "signal_stream", fa::signal_stream },
+    { "signal_stream_slash", fa::signal_stream_slash },
+    { "signal_strong", fa::signal_strong },
+    { "signal_4", fa::signal_strong },
+    { "signal_weak", fa::signal_weak },
+    { "signal_1", fa::signal_weak },
+    { "signature", fa::signature },
+    { "signature_lock", fa::signature_lock },
+    { "signature_slash", fa::signature_slash },
+    { "signs_post", fa::signs_post },
+    { "map_signs", fa::signs_post },
+    { "sim_card", fa::sim_card },
+    { "sim_cards", fa::sim_cards },
+    { "sink", fa::sink },
+    { "siren", fa::siren },
+    { "siren_on", fa::siren_on },
+    { "sitemap", fa::sitemap },
+    { "skeleton", fa::skeleton },
+    { "ski_boot", fa::ski_boot },
+    { "ski_boot_ski", fa::ski_boot_ski },
+    { "skull", fa::skull },
+    { "skull_cow", fa::skull_cow },
+    { "skull_crossbones", fa::skull_crossbones },
+    { "slash", fa::slash },
+    { "slash_back", fa::slash_back },
+    { "slash_forward", fa::slash_forward },
+    { "sleigh", fa::sleigh },
+    { "slider", fa::slider },
+    { "sliders", fa::sliders },
+    { "sliders_h", fa::sliders },
+    { "sliders_simple", fa::sliders_simple },
+    { "sliders_up", fa::sliders_up },
+    { "sliders_v", fa::sliders_up },
+    { "slot_machine", fa::slot_machine },
+    { "smog", fa::smog },
+    { "smoke", fa::smoke },
+    { "smoking", fa::smoking },
+    { "snake", fa::snake },
+    { "snooze", fa::snooze },
+    { "zzz", fa::snooze },
+    { "snow_blowing", fa::snow_blowing },
+    { "snowflake", fa::snowflake },
+    { "snowflakes", fa::snowflakes },
+    { "snowman", fa::snowman },
+    { "snowman_head", fa::snowman_head },
+    { "frosty_head", fa::snowman_head },
+    { "snowplow", fa::snowplow },
+    { "soap", fa::soap },
+    { "socks", fa::socks },
+    { "soft_serve", fa::soft_serve },
+    { "creemee", fa::soft_serve },
+    { "solar_panel", fa::solar_panel },
+    { "solar_system", fa::solar_system },
+    { "sort", fa::sort },
+    { "unsorted", fa::sort },
+    { "sort_down", fa::sort_down },
+    { "sort_desc", fa::sort_down },
+    { "sort_up", fa::sort_up },
+    { "sort_asc", fa::sort_up },
+    { "spa", fa::spa },
+    { "space_station_moon", fa::space_station_moon },
+    { "space_station_moon_construction", fa::space_station_moon_construction },
+    { "space_station_moon_alt", fa::space_station_moon_construction },
+    { "spade", fa::spade },
+    { "spaghetti_monster_flying", fa::spaghetti_monster_flying },
+    { "pastafarianism", fa::spaghetti_monster_flying },
+    { "sparkles", fa::sparkles },
+    { "speaker", fa::speaker },
+    { "speakers", fa::speakers },
+    { "spell_check", fa::spell_check },
+    { "spider", fa::spider },
+    { "spider_black_widow", fa::spider_black_widow },
+    { "spider_web", fa::spider_web },
+    { "spinner", fa::spinner },
+    { "spinner_third", fa::spinner_third },
+    { "split", fa::split },
+    { "splotch", fa::splotch },
+    { "spoon", fa::spoon },
+    { "utensil_spoon", fa::spoon },
+    { "sportsball", fa::sportsball },
+    { "spray_can", fa::spray_can },
+    { "spray_can_sparkles", fa::spray_can_sparkles },
+    { "air_freshener", fa::spray_can_sparkles },
+    { "sprinkler", fa::sprinkler },
+    { "sprinkler_ceiling", fa::sprinkler_ceiling },
+    { "square", fa::square },
+    { "square_0", fa::square_0 },
+    { "square_1", fa::square_1 },
+    { "square_2", fa::square_2 },
+    { "square_3", fa::square_3 },
+    { "square_4", fa::square_4 },
+    { "square_5", fa::square_5 },
+    { "square_6", fa::square_6 },
+    { "square_7", fa::square_7 },
+    { "square_8", fa::square_8 },
+    { "square_9", fa::square_9 },
+    { "square_a", fa::square_a },
+    { "square_a_lock", fa::square_a_lock },
+    { "square_ampersand", fa::square_ampersand },
+    { "square_arrow_down", fa::square_arrow_down },
+    { "arrow_square_down", fa::square_arrow_down },
+    { "square_arrow_down_left", fa::square_arrow_down_left },
+    { "square_arrow_down_right", fa::square_arrow_down_right },
+    { "square_arrow_left", fa::square_arrow_left },
+    { "arrow_square_left", fa::square_arrow_left },
+    { "square_arrow_right", fa::square_arrow_right },
+    { "arrow_square_right", fa::square_arrow_right },
+    { "square_arrow_up", fa::square_arrow_up },
+    { "arrow_square_up", fa::square_arrow_up },
+    { "square_arrow_up_left", fa::square_arrow_up_left },
+    { "square_arrow_up_right", fa::square_arrow_up_right },
+    { "external_link_square", fa::square_arrow_up_right },
+    { "square_b", fa::square_b },
+    { "square_bolt", fa::square_bolt },
+    { "square_c", fa::square_c },
+    { "square_caret_down", fa::square_caret_down },
+    { "caret_square_down", fa::square_caret_down },
+    { "square_caret_left", fa::square_caret_left },
+    { "caret_square_left", fa::square_caret_left },
+    { "square_caret_right", fa::square_caret_right },
+    { "caret_square_right", fa::square_caret_right },
+    { "square_caret_up", fa::square_caret_up },
+    { "caret_square_up", fa::square_caret_up },
+    { "square_check", fa::square_check },
+    { "check_square", fa::square_check },
+    { "square_chevron_down", fa::square_chevron_down },
+    { "chevron_square_down", fa::square_chevron_down },
+    { "square_chevron_left", fa::square_chevron_left },
+    { "chevron_square_left", fa::square_chevron_left },
+    { "square_chevron_right", fa::square_chevron_right },
+    { "chevron_square_right", fa::square_chevron_right },
+    { "square_chevron_up", fa::square_chevron_up },
+    { "chevron_square_up", fa::square_chevron_up },
+    { "square_code", fa::square_code },
+    { "square_d", fa::square_d },
+    { "square_dashed", fa::square_dashed },
+    { "square_divide", fa::square_divide },
+    { "square_dollar", fa::square_dollar },
+    { "dollar_square", fa::square_dollar },
+    { "usd_square", fa::square_dollar },
+    { "square_down", fa::square_down },
+    { "arrow_alt_square_down", fa::square_down },
+    { "square_down_left", fa::square_down_left },
+    { "square_down_right", fa::square_down_right },
+    { "square_e", fa::square_e },
+    { "square_ellipsis", fa::square_ellipsis },
+    { "square_ellipsis_vertical", fa::square_ellipsis_vertical },
+    { "square_envelope", fa::square_envelope },
+    { "envelope_square", fa::square_envelope },
+    { "square_exclamation", fa::square_exclamation },
+    { "exclamation_square", fa::square_exclamation },
+    { "square_f", fa::square_f },
+    { "square_fragile", fa::square_fragile },
+    { "box_fragile", fa::square_fragile },
+    { "square_wine_glass_crack", fa::square_fragile },
+    { "square_full", fa::square_full },
+    { "square_g", fa::square_g },
+    { "square_h", fa::square_h },
+    { "h_square", fa::square_h },
+    { "square_heart", fa::square_heart },
+    { "heart_square", fa::square_heart },
+    { "square_i", fa::square_i },
+    { "square_info", fa::square_info },
+    { "info_square", fa::square_info },
+    { "square_j", fa::square_j },
+    { "square_k", fa::square_k },
+    { "square_kanban", fa::square_kanban },
+    { "square_l", fa::square_l },
+    { "square_left", fa::square_left },
+    { "arrow_alt_square_left", fa::square_left },
+    { "square_list", fa::square_list },
+    { "square_m", fa::square_m },
+    { "square_minus", fa::square_minus },
+    { "minus_square", fa::square_minus },
+    { "square_n", fa::square_n },
+    { "square_nfi", fa::square_nfi },
+    { "square_o", fa::square_o },
+    { "square_p", fa::square_p },
+    { "square_parking", fa::square_parking },
+    { "parking", fa::square_parking },
+    { "square_parking_slash", fa::square_parking_slash },
+    { "parking_slash", fa::square_parking_slash },
+    { "square_pen", fa::square_pen },
+    { "pen_square", fa::square_pen },
+    { "pencil_square", fa::square_pen },
+    { "square_person_confined", fa::square_person_confined },
+    { "square_phone", fa::square_phone },
+    { "phone_square", fa::square_phone },
+    { "square_phone_flip", fa::square_phone_flip },
+    { "phone_square_alt", fa::square_phone_flip },
+    { "square_phone_hangup", fa::square_phone_hangup },
+    { "phone_square_down", fa::square_phone_hangup },
+    { "square_plus", fa::square_plus },
+    { "plus_square", fa::square_plus },
+    { "square_poll_horizontal", fa::square_poll_horizontal },
+    { "poll_h", fa::square_poll_horizontal },
+    { "square_poll_vertical", fa::square_poll_vertical },
+    { "poll", fa::square_poll_vertical },
+    { "square_q", fa::square_q },
+    { "square_quarters", fa::square_quarters },
+    { "square_question", fa::square_question },
+    { "question_square", fa::square_question },
+    { "square_quote", fa::square_quote },
+    { "square_r", fa::square_r },
+    { "square_right", fa::square_right },
+    { "arrow_alt_square_right", fa::square_right },
+    { "square_ring", fa::square_ring },
+    { "square_root", fa::square_root },
+    { "square_rootiable", fa::square_rootiable },
+    { "square_root_alt", fa::square_rootiable },
+    { "square_rss", fa::square_rss },
+    { "rss_square", fa::square_rss },
+    { "square_s", fa::square_s },
+    { "square_share_nodes", fa::square_share_nodes },
+    { "share_alt_square", fa::square_share_nodes },
+    { "square_sliders", fa::square_sliders },
+    { "sliders_h_square", fa::square_sliders },
+    { "square_sliders_vertical", fa::square_sliders_vertical },
+    { "sliders_v_square", fa::square_sliders_vertical },
+    { "square_small", fa::square_small },
+    { "square_star", fa::square_star },
+    { "square_t", fa::square_t },
+    { "square_terminal", fa::square_terminal },
+    { "square_this_way_up", fa::square_this_way_up },
+    { "box_up", fa::square_this_way_up },
+    { "square_u", fa::square_u },
+    { "square_up", fa::square_up },
+    { "arrow_alt_square_up", fa::square_up },
+    { "square_up_left", fa::square_up_left },
+    { "square_up_right", fa::square_up_right },
+    { "external_link_square_alt", fa::square_up_right },
+    { "square_user", fa::square_user },
+    { "square_v", fa::square_v },
+    { "square_virus", fa::square_virus },
+    { "square_w", fa::square_w },
+    { "square_x", fa::square_x },
+    { "square_xmark", fa::square_xmark },
+    { "times_square", fa::square_xmark },
+    { "xmark_square", fa::square_xmark },
+    { "square_y", fa::square_y },
+    { "square_z", fa::square_z },
+    { "squid", fa::squid },
+    { "squirrel", fa::squirrel },
+    { "staff", fa::staff },
+    { "staff_aesculapius", fa::staff_aesculapius },
+    { "rod_asclepius", fa::staff_aesculapius },
+    { "rod_snake", fa::staff_aesculapius },
+    { "staff_snake", fa::staff_aesculapius },
+    { "stairs", fa::stairs },
+    { "stamp", fa::stamp },
+    { "standard_definition", fa::standard_definition },
+    { "rectangle_sd", fa::standard_definition },
+    { "star", fa::star },
+    { "star_and_crescent", fa::star_and_crescent },
+    { "star_christmas", fa::star_christmas },
+    { "star_exclamation", fa::star_exclamation },
+    { "star_half", fa::star_half },
+    { "star_half_stroke", fa::star_half_stroke },
+    { "star_half_alt", fa::star_half_stroke },
+    { "star_of_david", fa::star_of_david },
+    { "star_of_life", fa::star_of_life },
+    { "star_sharp", fa::star_sharp },
+    { "star_sharp_half", fa::star_sharp_half },
+    { "star_sharp_half_stroke", fa::star_sharp_half_stroke },
+    { "star_sharp_half_alt", fa::star_sharp_half_stroke },
+    { "star_shooting", fa::star_shooting },
+    { "starfighter", fa::starfighter },
+    { "starfighter_twin_ion_engine", fa::starfighter_twin_ion_engine },
+    { "starfighter_alt", fa::starfighter_twin_ion_engine },
+    { "starfighter_twin_ion_engine_advanced", fa::starfighter_twin_ion_engine_advanced },
+    { "starfighter_alt_advanced", fa::starfighter_twin_ion_engine_advanced },
+    { "stars", fa::stars },
+    { "starship", fa::starship },
+    { "starship_freighter", fa::starship_freighter },
+    { "steak", fa::steak },
+    { "steering_wheel", fa::steering_wheel },
+    { "sterling_sign", fa::sterling_sign },
+    { "gbp", fa::sterling_sign },
+    { "pound_sign", fa::sterling_sign },
+    { "stethoscope", fa::stethoscope },
+    { "stocking", fa::stocking },
+    { "stomach", fa::stomach },
+    { "stop", fa::stop },
+    { "stopwatch", fa::stopwatch },
+    { "stopwatch_20", fa::stopwatch_20 },
+    { "store", fa::store },
+    { "store_lock", fa::store_lock },
+    { "store_slash", fa::store_slash },
+    { "strawberry", fa::strawberry },
+    { "street_view", fa::street_view },
+    { "stretcher", fa::stretcher },
+    { "strikethrough", fa::strikethrough },
+    { "stroopwafel", fa::stroopwafel },
+    { "subscript", fa::subscript },
+    { "suitcase", fa::suitcase },
+    { "suitcase_medical", fa::suitcase_medical },
+    { "medkit", fa::suitcase_medical },
+    { "suitcase_rolling", fa::suitcase_rolling },
+    { "sun", fa::sun },
+    { "sun_bright", fa::sun_bright },
+    { "sun_alt", fa::sun_bright },
+    { "sun_cloud", fa::sun_cloud },
+    { "sun_dust", fa::sun_dust },
+    { "sun_haze", fa::sun_haze },
+    { "sun_plant_wilt", fa::sun_plant_wilt },
+    { "sunglasses", fa::sunglasses },
+    { "sunrise", fa::sunrise },
+    { "sunset", fa::sunset },
+    { "superscript", fa::superscript },
+    { "sushi", fa::sushi },
+    { "nigiri", fa::sushi },
+    { "sushi_roll", fa::sushi_roll },
+    { "maki_roll", fa::sushi_roll },
+    { "makizushi", fa::sushi_roll },
+    { "swatchbook", fa::swatchbook },
+    { "sword", fa::sword },
+    { "sword_laser", fa::sword_laser },
+    { "sword_laser_alt", fa::sword_laser_alt },
+    { "swords", fa::swords },
+    { "swords_laser", fa::swords_laser },
+    { "symbols", fa::symbols },
+    { "icons_alt", fa::symbols },
+    { "synagogue", fa::synagogue },
+    { "syringe", fa::syringe },
+    { "t", fa::t },
+    { "table", fa::table },
+    { "table_cells", fa::table_cells },
+    { "th", fa::table_cells },
+    { "table_cells_large", fa::table_cells_large },
+    { "th_large", fa::table_cells_large },
+    { "table_columns", fa::table_columns },
+    { "columns", fa::table_columns },
+    { "table_layout", fa::table_layout },
+    { "table_list", fa::table_list },
+    { "th_list", fa::table_list },
+    { "table_picnic", fa::table_picnic },
+    { "table_pivot", fa::table_pivot },
+    { "table_rows", fa::table_rows },
+    { "rows", fa::table_rows },
+    { "table_tennis_paddle_ball", fa::table_tennis_paddle_ball },
+    { "ping_pong_paddle_ball", fa::table_tennis_paddle_ball },
+    { "table_tennis", fa::table_tennis_paddle_ball },
+    { "table_tree", fa::table_tree },
+    { "tablet", fa::tablet },
+    { "tablet_android", fa::tablet },
+    { "tablet_button", fa::tablet_button },
+    { "tablet_rugged", fa::tablet_rugged },
+    { "tablet_screen", fa::tablet_screen },
+    { "tablet_android_alt", fa::tablet_screen },
+    { "tablet_screen_button", fa::tablet_screen_button },
+    { "tablet_alt", fa::tablet_screen_button },
+    { "tablets", fa::tablets },
+    { "tachograph_digital", fa::tachograph_digital },
+    { "digital_tachograph", fa::tachograph_digital },
+    { "taco", fa::taco },
+    { "tag", fa::tag },
+    { "tags", fa::tags },
+    { "tally", fa::tally },
+    { "tally_5", fa::tally },
+    { "tally_1", fa::tally_1 },
+    { "tally_2", fa::tally_2 },
+    { "tally_3", fa::tally_3 },
+    { "tally_4", fa::tally_4 },
+    { "tamale", fa::tamale },
+    { "tank_water", fa::tank_water },
+    { "tape", fa::tape },
+    { "tarp", fa::tarp },
+    { "tarp_droplet", fa::tarp_droplet },
+    { "taxi", fa::taxi },
+    { "cab", fa::taxi },
+    { "taxi_bus", fa::taxi_bus },
+    { "teddy_bear", fa::teddy_bear },
+    { "teeth", fa::teeth },
+    { "teeth_open", fa::teeth_open },
+    { "telescope", fa::telescope },
+    { "temperature_arrow_down", fa::temperature_arrow_down },
+    { "temperature_down", fa::temperature_arrow_down },
+    { "temperature_arrow_up", fa::temperature_arrow_up },
+    { "temperature_up", fa::temperature_arrow_up },
+    { "temperature_empty", fa::temperature_empty },
+    { "temperature_0", fa::temperature_empty },
+    { "thermometer_0", fa::temperature_empty },
+    { "thermometer_empty", fa::temperature_empty },
+    { "temperature_full", fa::temperature_full },
+    { "temperature_4", fa::temperature_full },
+    { "thermometer_4", fa::temperature_full },
+    { "thermometer_full", fa::temperature_full },
+    { "temperature_half", fa::temperature_half },
+    { "temperature_2", fa::temperature_half },
+    { "thermometer_2", fa::temperature_half },
+    { "thermometer_half", fa::temperature_half },
+    { "temperature_high", fa::temperature_high },
+    { "temperature_list", fa::temperature_list },
+    { "temperature_low", fa::temperature_low },
+    { "temperature_quarter", fa::temperature_quarter },
+    { "temperature_1", fa::temperature_quarter },
+    { "thermometer_1", fa::temperature_quarter },
+    { "thermometer_quarter", fa::temperature_quarter },
+    { "temperature_snow", fa::temperature_snow },
+    { "temperature_frigid", fa::temperature_snow },
+    { "temperature_sun", fa::temperature_sun },
+    { "temperature_hot", fa::temperature_sun },
+    { "temperature_three_quarters", fa::temperature_three_quarters },
+    { "temperature_3", fa::temperature_three_quarters },
+    { "thermometer_3", fa::temperature_three_quarters },
+    { "thermometer_three_quarters", fa::temperature_three_quarters },
+    { "tenge_sign", fa::tenge_sign },
+    { "tenge", fa::tenge_sign },
+    { "tennis_ball", fa::tennis_ball },
+    { "tent", fa::tent },
+    { "tent_arrow_down_to_line", fa::tent_arrow_down_to_line },
+    { "tent_arrow_left_right", fa::tent_arrow_left_right },
+    { "tent_arrow_turn_left", fa::tent_arrow_turn_left },
+    { "tent_arrows_down", fa::tent_arrows_down },
+    { "tents", fa::tents },
+    { "terminal", fa::terminal },
+    { "text", fa::text },
+    { "text_height", fa::text_height },
+    { "text_size", fa::text_size },
+    { "text_slash", fa::text_slash },
+    { "remove_format", fa::text_slash },
+    { "text_width", fa::text_width },
+    { "thermometer", fa::thermometer },
+    { "theta", fa::theta },
+    { "thought_bubble", fa::thought_bubble },
+    { "thumbs_down", fa::thumbs_down },
+    { "thumbs_up", fa::thumbs_up },
+    { "thumbtack", fa::thumbtack },
+    { "thumb_tack", fa::thumbtack },
+    { "tick", fa::tick },
+    { "ticket", fa::ticket },
+    { "ticket_airline", fa::ticket_airline },
+    { "ticket_simple", fa::ticket_simple },
+    { "ticket_alt", fa::ticket_simple },
+    { "tickets_airline", fa::tickets_airline },
+    { "tilde", fa::tilde },
+    { "timeline", fa::timeline },
+    { "timeline_arrow", fa::timeline_arrow },
+    { "timer", fa::timer },
+    { "tire", fa::tire },
+    { "tire_flat", fa::tire_flat },
+    { "tire_pressure_warning", fa::tire_pressure_warning },
+    { "tire_rugged", fa::tire_rugged },
+    { "toggle_off", fa::toggle_off },
+    { "toggle_on", fa::toggle_on },
+    { "toilet", fa::toilet },
+    { "toilet_paper", fa::toilet_paper },
+    { "toilet_paper_blank", fa::toilet_paper_blank },
+    { "toilet_paper_alt", fa::toilet_paper_blank },
+    { "toilet_paper_blank_under", fa::toilet_paper_blank_under },
+    { "toilet_paper_reverse_alt", fa::toilet_paper_blank_under },
+    { "toilet_paper_slash", fa::toilet_paper_slash },
+    { "toilet_paper_under", fa::toilet_paper_under },
+    { "toilet_paper_reverse", fa::toilet_paper_under },
+    { "toilet_paper_under_slash", fa::toilet_paper_under_slash },
+    { "toilet_paper_reverse_slash", fa::toilet_paper_under_slash },
+    { "toilet_portable", fa::toilet_portable },
+    { "toilets_portable", fa::toilets_portable },
+    { "tomato", fa::tomato },
+    { "tombstone", fa::tombstone },
+    { "tombstone_blank", fa::tombstone_blank },
+    { "tombstone_alt", fa::tombstone_blank },
+    { "toolbox", fa::toolbox },
+    { "tooth", fa::tooth },
+    { "toothbrush", fa::toothbrush },
+    { "torii_gate", fa::torii_gate },
+    { "tornado", fa::tornado },
+    { "tower_broadcast", fa::tower_broadcast },
+    { "broadcast_tower", fa::tower_broadcast },
+    { "tower_cell", fa::tower_cell },
+    { "tower_control", fa::tower_control },
+    { "tower_observation", fa::tower_observation },
+    { "tractor", fa::tractor },
+    { "trademark", fa::trademark },
+    { "traffic_cone", fa::traffic_cone },
+    { "traffic_light", fa::traffic_light },
+    { "traffic_light_go", fa::traffic_light_go },
+    { "traffic_light_slow", fa::traffic_light_slow },
+    { "traffic_light_stop", fa::traffic_light_stop },
+    { "trailer", fa::trailer },
+    { "train", fa::train },
+    { "train_subway", fa::train_subway },
+    { "subway", fa::train_subway },
+    { "train_subway_tunnel", fa::train_subway_tunnel },
+    { "subway_tunnel", fa::train_subway_tunnel },
+    { "train_track", fa::train_track },
+    { "train_tram", fa::train_tram },
+    { "tram", fa::train_tram },
+    { "train_tunnel", fa::train_tunnel },
+    { "transformer_bolt", fa::transformer_bolt },
+    { "transgender", fa::transgender },
+    { "transgender_alt", fa::transgender },
+    { "transporter", fa::transporter },
+    { "transporter_1", fa::transporter_1 },
+    { "transporter_2", fa::transporter_2 },
+    { "transporter_3", fa::transporter_3 },
+    { "transporter_4", fa::transporter_4 },
+    { "transporter_5", fa::transporter_5 },
+    { "transporter_6", fa::transporter_6 },
+    { "transporter_7", fa::transporter_7 },
+    { "transporter_empty", fa::transporter_empty },
+    { "trash", fa::trash },
+    { "trash_arrow_up", fa::trash_arrow_up },
+    { "trash_restore", fa::trash_arrow_up },
+    { "trash_can", fa::trash_can },
+    { "trash_alt", fa::trash_can },
+    { "trash_can_arrow_up", fa::trash_can_arrow_up },
+    { "trash_restore_alt", fa::trash_can_arrow_up },
+    { "trash_can_check", fa::trash_can_check },
+    { "trash_can_clock", fa::trash_can_clock },
+    { "trash_can_list", fa::trash_can_list },
+    { "trash_can_plus", fa::trash_can_plus },
+    { "trash_can_slash", fa::trash_can_slash },
+    { "trash_alt_slash", fa::trash_can_slash },
+    { "trash_can_undo", fa::trash_can_undo },
+    { "trash_can_arrow_turn_left", fa::trash_can_undo },
+    { "trash_undo_alt", fa::trash_can_undo },
+    { "trash_can_xmark", fa::trash_can_xmark },
+    { "trash_check", fa::trash_check },
+    { "trash_clock", fa::trash_clock },
+    { "trash_list", fa::trash_list },
+    { "trash_plus", fa::trash_plus },
+    { "trash_slash", fa::trash_slash },
+    { "trash_undo", fa::trash_undo },
+    { "trash_arrow_turn_left", fa::trash_undo },
+    { "trash_xmark", fa::trash_xmark },
+    { "treasure_chest", fa::treasure_chest },
+    { "tree", fa::tree },
+    { "tree_christmas", fa::tree_christmas },
+    { "tree_city", fa::tree_city },
+    { "tree_deciduous", fa::tree_deciduous },
+    { "tree_alt", fa::tree_deciduous },
+    { "tree_decorated", fa::tree_decorated },
+    { "tree_large", fa::tree_large },
+    { "tree_palm", fa::tree_palm },
+    { "trees", fa::trees },
+    { "triangle", fa::triangle },
+    { "triangle_exclamation", fa::triangle_exclamation },
+    { "exclamation_triangle", fa::triangle_exclamation },
+    { "warning", fa::triangle_exclamation },
+    { "triangle_instrument", fa::triangle_instrument },
+    { "triangle_music", fa::triangle_instrument },
+    { "triangle_person_digging", fa::triangle_person_digging },
+    { "construction", fa::triangle_person_digging },
+    { "trillium", fa::trillium },
+    { "trophy", fa::trophy },
+    { "trophy_star", fa::trophy_star },
+    { "trophy_alt", fa::trophy_star },
+    { "trowel", fa::trowel },
+    { "trowel_bricks", fa::trowel_bricks },
+    { "truck", fa::truck },
+    { "truck_arrow_right", fa::truck_arrow_right },
+    { "truck_bolt", fa::truck_bolt },
+    { "truck_clock", fa::truck_clock },
+    { "shipping_timed", fa::truck_clock },
+    { "truck_container", fa::truck_container },
+    { "truck_container_empty", fa::truck_container_empty },
+    { "truck_droplet", fa::truck_droplet },
+    { "truck_fast", fa::truck_fast },
+    { "shipping_fast", fa::truck_fast },
+    { "truck_field", fa::truck_field },
+    { "truck_field_un", fa::truck_field_un },
+    { "truck_flatbed", fa::truck_flatbed },
+    { "truck_front", fa::truck_front },
+    { "truck_medical", fa::truck_medical },
+    { "ambulance", fa::truck_medical },
+    { "truck_monster", fa::truck_monster },
+    { "truck_moving", fa::truck_moving },
+    { "truck_pickup", fa::truck_pickup },
+    { "truck_plane", fa::truck_plane },
+    { "truck_plow", fa::truck_plow },
+    { "truck_ramp", fa::truck_ramp },
+    { "truck_ramp_box", fa::truck_ramp_box },
+    { "truck_loading", fa::truck_ramp_box },
+    { "truck_ramp_couch", fa::truck_ramp_couch },
+    { "truck_couch", fa::truck_ramp_couch },
+    { "truck_tow", fa::truck_tow },
+    { "trumpet", fa::trumpet },
+    { "tty", fa::tty },
+    { "teletype", fa::tty },
+    { "tty_answer", fa::tty_answer },
+    { "teletype_answer", fa::tty_answer },
+    { "tugrik_sign", fa::tugrik_sign },
+    { "turkey", fa::turkey },
+    { "turkish_lira_sign", fa::turkish_lira_sign },
+    { "fa_try", fa::turkish_lira_sign },
+    { "turkish_lira", fa::turkish_lira_sign },
+    { "turn_down", fa::turn_down },
+    { "level_down_alt", fa::turn_down },
+    { "turn_down_left", fa::turn_down_left },
+    { "turn_down_right", fa::turn_down_right },
+    { "turn_up", fa::turn_up },
+    { "level_up_alt", fa::turn_up },
+    { "turntable", fa::turntable },
+    { "turtle", fa::turtle },
+    { "tv", fa::tv },
+    { "television", fa::tv },
+    { "tv_alt", fa::tv },
+    { "tv_music", fa::tv_music },
+    { "tv_retro", fa::tv_retro },
+    { "typewriter", fa::typewriter },
+    { "u", fa::u },
+    { "ufo", fa::ufo },
+    { "ufo_beam", fa::ufo_beam },
+    { "umbrella", fa::umbrella },
+    { "umbrella_beach", fa::umbrella_beach },
+    { "umbrella_simple", fa::umbrella_simple },
+    { "umbrella_alt", fa::umbrella_simple },
+    { "underline", fa::underline },
+    { "unicorn", fa::unicorn },
+    { "uniform_martial_arts", fa::uniform_martial_arts },
+    { "_union", fa::_union },
+    { "universal_access", fa::universal_access },
+    { "unlock", fa::unlock },
+    { "unlock_keyhole", fa::unlock_keyhole },
+    { "unlock_alt", fa::unlock_keyhole },
+    { "up", fa::up },
+    { "arrow_alt_up", fa::up },
+    { "up_down", fa::up_down },
+    { "arrows_alt_v", fa::up_down },
+    { "up_down_left_right", fa::up_down_left_right },
+    { "arrows_alt", fa::up_down_left_right },
+    { "up_from_bracket", fa::up_from_bracket },
+    { "up_from_dotted_line", fa::up_from_dotted_line },
+    { "up_from_line", fa::up_from_line },
+    { "arrow_alt_from_bottom", fa::up_from_line },
+    { "up_left", fa::up_left },
+    { "up_long", fa::up_long },
+    { "long_arrow_alt_up", fa::up_long },
+    { "up_right", fa::up_right },
+    { "up_right_and_down_left_from_center", fa::up_right_and_down_left_from_center },
+    { "expand_alt", fa::up_right_and_down_left_from_center },
+    { "up_right_from_square", fa::up_right_from_square },
+    { "external_link_alt", fa::up_right_from_square },
+    { "up_to_dotted_line", fa::up_to_dotted_line },
+    { "up_to_line", fa::up_to_line },
+    { "arrow_alt_to_top", fa::up_to_line },
+    { "upload", fa::upload },
+    { "usb_drive", fa::usb_drive },
+    { "user", fa::user },
+    { "user_alien", fa::user_alien },
+    { "user_astronaut", fa::user_astronaut },
+    { "user_bounty_hunter", fa::user_bounty_hunter },
+    { "user_check", fa::user_check },
+    { "user_chef", fa::user_chef },
+    { "user_clock", fa::user_clock },
+    { "user_cowboy", fa::user_cowboy },
+    { "user_crown", fa::user_crown },
+    { "user_doctor", fa::user_doctor },
+    { "user_md", fa::user_doctor },
+    { "user_doctor_hair", fa::user_doctor_hair },
+    { "user_doctor_hair_long", fa::user_doctor_hair_long },
+    { "user_doctor_message", fa::user_doctor_message },
+    { "user_md_chat", fa::user_doctor_message },
+    { "user_gear", fa::user_gear },
+    { "user_cog", fa::user_gear },
+    { "user_graduate", fa::user_graduate },
+    { "user_group", fa::user_group },
+    { "user_friends", fa::user_group },
+    { "user_group_crown", fa::user_group_crown },
+    { "users_crown", fa::user_group_crown },
+    { "user_hair", fa::user_hair },
+    { "user_hair_buns", fa::user_hair_buns },
+    { "user_hair_long", fa::user_hair_long },
+    { "user_hair_mullet", fa::user_hair_mullet },
+    { "business_front", fa::user_hair_mullet },
+    { "party_back", fa::user_hair_mullet },
+    { "trian_balbot", fa::user_hair_mullet },
+    { "user_headset", fa::user_headset },
+    { "user_helmet_safety", fa::user_helmet_safety },
+    { "user_construction", fa::user_helmet_safety },
+    { "user_hard_hat", fa::user_helmet_safety },
+    { "user_injured", fa::user_injured },
+    { "user_large", fa::user_large },
+    { "user_alt", fa::user_large },
+    { "user_large_slash", fa::user_large_slash },
+    { "user_alt_slash", fa::user_large_slash },
+    { "user_lock", fa::user_lock },
+    { "user_minus", fa::user_minus },
+    { "user_music", fa::user_music },
+    { "user_ninja", fa::user_ninja },
+    { "user_nurse", fa::user_nurse },
+    { "user_nurse_hair", fa::user_nurse_hair },
+    { "user_nurse_hair_long", fa::user_nurse_hair_long },
+    { "user_pen", fa::user_pen },
+    { "user_edit", fa::user_pen },
+    { "user_pilot", fa::user_pilot },
+    { "user_pilot_tie", fa::user_pilot_tie },
+    { "user_plus", fa::user_plus },
+    { "user_police", fa::user_police },
+    { "user_police_tie", fa::user_police_tie },
+    { "user_robot", fa::user_robot },
+    { "user_robot_xmarks", fa::user_robot_xmarks },
+    { "user_secret", fa::user_secret },
+    { "user_shakespeare", fa::user_shakespeare },
+    { "user_shield", fa::user_shield },
+    { "user_slash", fa::user_slash },
+    { "user_tag", fa::user_tag },
+    { "user_tie", fa::user_tie },
+    { "user_tie_hair", fa::user_tie_hair },
+    { "user_tie_hair_long", fa::user_tie_hair_long },
+    { "user_unlock", fa::user_unlock },
+    { "user_visor", fa::user_visor },
+    { "user_vneck", fa::user_vneck },
+    { "user_vneck_hair", fa::user_vneck_hair },
+    { "user_vneck_hair_long", fa::user_vneck_hair_long },
+    { "user_xmark", fa::user_xmark },
+    { "user_times", fa::user_xmark },
+    { "users", fa::users },
+    { "users_between_lines", fa::users_between_lines },
+    { "users_gear", fa::users_gear },
+    { "users_cog", fa::users_gear },
+    { "users_line", fa::users_line },
+    { "users_medical", fa::users_medical },
+    { "users_rays", fa::users_rays },
+    { "users_rectangle", fa::users_rectangle },
+    { "users_slash", fa::users_slash },
+    { "users_viewfinder", fa::users_viewfinder },
+    { "utensils", fa::utensils },
+    { "cutlery", fa::utensils },
+    { "utensils_slash", fa::utensils_slash },
+    { "utility_pole", fa::utility_pole },
+    { "utility_pole_double", fa::utility_pole_double },
+    { "v", fa::v },
+    { "vacuum", fa::vacuum },
+    { "vacuum_robot", fa::vacuum_robot },
+    { "value_absolute", fa::value_absolute },
+    { "van_shuttle", fa::van_shuttle },
+    { "shuttle_van", fa::van_shuttle },
+    { "vault", fa::vault },
+    { "vector_circle", fa::vector_circle },
+    { "vector_polygon", fa::vector_polygon },
+    { "vector_square", fa::vector_square },
+    { "vent_damper", fa::vent_damper },
+    { "venus", fa::venus },
+    { "venus_double", fa::venus_double },
+    { "venus_mars", fa::venus_mars },
+    { "vest", fa::vest },
+    { "vest_patches", fa::vest_patches },
+    { "vial", fa::vial },
+    { "vial_circle_check", fa::vial_circle_check },
+    { "vial_virus", fa::vial_virus },
+    { "vials", fa::vials },
+    { "video", fa::video },
+    { "video_camera", fa::video },
+    { "video_arrow_down_left", fa::video_arrow_down_left },
+    { "video_arrow_up_right", fa::video_arrow_up_right },
+    { "video_plus", fa::video_plus },
+    { "video_slash", fa::video_slash },
+    { "vihara", fa::vihara },
+    { "violin", fa::violin },
+    { "virus", fa::virus },
+    { "virus_covid", fa::virus_covid },
+    { "virus_covid_slash", fa::virus_covid_slash },
+    { "virus_slash", fa::virus_slash },
+    { "viruses", fa::viruses },
+    { "voicemail", fa::voicemail },
+    { "volcano", fa::volcano },
+    { "volleyball", fa::volleyball },
+    { "volleyball_ball", fa::volleyball },
+    { "volume", fa::volume },
+    { "volume_medium", fa::volume },
+    { "volume_high", fa::volume_high },
+    { "volume_up", fa::volume_high },
+    { "volume_low", fa::volume_low },
+    { "volume_down", fa::volume_low },
+    { "volume_off", fa::volume_off },
+    { "volume_slash", fa::volume_slash },
+    { "volume_xmark", fa::volume_xmark },
+    { "volume_mute", fa::volume_xmark },
+    { "volume_times", fa::volume_xmark },
+    { "vr_cardboard", fa::vr_cardboard },
+    { "w", fa::w },
+    { "waffle", fa::waffle },
+    { "wagon_covered", fa::wagon_covered },
+    { "walker", fa::walker },
+    { "walkie_talkie", fa::walkie_talkie },
+    { "wallet", fa::wallet },
+    { "wand", fa::wand },
+    { "wand_magic", fa::wand_magic },
+    { "magic", fa::wand_magic },
+    { "wand_magic_sparkles", fa::wand_magic_sparkles },
+    { "magic_wand_sparkles", fa::wand_magic_sparkles },
+    { "wand_sparkles", fa::wand_sparkles },
+    { "warehouse", fa::warehouse },
+    { "warehouse_full", fa::warehouse_full },
+    { "warehouse_alt", fa::warehouse_full },
+    { "washing_machine", fa::washing_machine },
+    { "washer", fa::washing_machine },
+    { "watch", fa::watch },
+    { "watch_apple", fa::watch_apple },
+    { "watch_calculator", fa::watch_calculator },
+    { "watch_fitness", fa::watch_fitness },
+    { "watch_smart", fa::watch_smart },
+    { "water", fa::water },
+    { "water_arrow_down", fa::water_arrow_down },
+    { "water_lower", fa::water_arrow_down },
+    { "water_arrow_up", fa::water_arrow_up },
+    { "water_rise", fa::water_arrow_up },
+    { "water_ladder", fa::water_ladder },
+    { "ladder_water", fa::water_ladder },
+    { "swimming_pool", fa::water_ladder },
+    { "watermelon_slice", fa::watermelon_slice },
+    { "wave_pulse", fa::wave_pulse },
+    { "heart_rate", fa::wave_pulse },
+    { "wave_sine", fa::wave_sine },
+    { "wave_square", fa::wave_square },
+    { "wave_triangle", fa::wave_triangle },
+    { "waveform", fa::waveform },
+    { "waveform_lines", fa::waveform_lines },
+    { "waveform_path", fa::waveform_lines },
+    { "weight_hanging", fa::weight_hanging },
+    { "weight_scale", fa::weight_scale },
+    { "weight", fa::weight_scale },
+    { "whale", fa::whale },
+    { "wheat", fa::wheat },
+    { "wheat_awn", fa::wheat_awn },
+    { "wheat_alt", fa::wheat_awn },
+    { "wheat_awn_circle_exclamation", fa::wheat_awn_circle_exclamation },
+    { "wheat_awn_slash", fa::wheat_awn_slash },
+    { "wheat_slash", fa::wheat_slash },
+    { "wheelchair", fa::wheelchair },
+    { "wheelchair_move", fa::wheelchair_move },
+    { "wheelchair_alt", fa::wheelchair_move },
+    { "whiskey_glass", fa::whiskey_glass },
+    { "glass_whiskey", fa::whiskey_glass },
+    { "whiskey_glass_ice", fa::whiskey_glass_ice },
+    { "glass_whiskey_rocks", fa::whiskey_glass_ice },
+    { "whistle", fa::whistle },
+    { "wifi", fa::wifi },
+    { "wifi_3", fa::wifi },
+    { "wifi_strong", fa::wifi },
+    { "wifi_exclamation", fa::wifi_exclamation },
+    { "wifi_fair", fa::wifi_fair },
+    { "wifi_2", fa::wifi_fair },
+    { "wifi_slash", fa::wifi_slash },
+    { "wifi_weak", fa::wifi_weak },
+    { "wifi_1", fa::wifi_weak },
+    { "wind", fa::wind },
+    { "wind_turbine", fa::wind_turbine },
+    { "wind_warning", fa::wind_warning },
+    { "wind_circle_exclamation", fa::wind_warning },
+    { "window", fa::window },
+    { "window_flip", fa::window_flip },
+    { "window_alt", fa::window_flip },
+    { "window_frame", fa::window_frame },
+    { "window_frame_open", fa::window_frame_open },
+    { "window_maximize", fa::window_maximize },
+    { "window_minimize", fa::window_minimize },
+    { "window_restore", fa::window_restore },
+    { "windsock", fa::windsock },
+    { "wine_bottle", fa::wine_bottle },
+    { "wine_glass", fa::wine_glass },
+    { "wine_glass_crack", fa::wine_glass_crack },
+    { "fragile", fa::wine_glass_crack },
+    { "wine_glass_empty", fa::wine_glass_empty },
+    { "wine_glass_alt", fa::wine_glass_empty },
+    { "won_sign", fa::won_sign },
+    { "krw", fa::won_sign },
+    { "won", fa::won_sign },
+    { "worm", fa::worm },
+    { "wreath", fa::wreath },
+    { "wrench", fa::wrench },
+    { "wrench_simple", fa::wrench_simple },
+    { "x", fa::x },
+    { "x_ray", fa::x_ray },
+    { "xmark", fa::xmark },
+    { "close", fa::xmark },
+    { "multiply", fa::xmark },
+    { "remove", fa::xmark },
+    { "times", fa::xmark },
+    { "xmark_large", fa::xmark_large },
+    { "xmark_to_slot", fa::xmark_to_slot },
+    { "times_to_slot", fa::xmark_to_slot },
+    { "vote_nay", fa::xmark_to_slot },
+    { "xmarks_lines", fa::xmarks_lines },
+    { "y", fa::y },
+    { "yen_sign", fa::yen_sign },
+    { "cny", fa::yen_sign },
+    { "jpy", fa::yen_sign },
+    { "rmb", fa::yen_sign },
+    { "yen", fa::yen_sign },
+    { "yin_yang", fa::yin_yang },
+    { "z", fa::z },
+    { "_42_group", fa::_42_group },
+    { "innosoft", fa::_42_group },
+    { "_500px", fa::_500px },
+    { "accessible_icon", fa::accessible_icon },
+    { "accusoft", fa::accusoft },
+    { "adn", fa::adn },
+    { "adversal", fa::adversal },
+    { "affiliatetheme", fa::affiliatetheme },
+    { "airbnb", fa::airbnb },
+    { "algolia", fa::algolia },
+    { "alipay", fa::alipay },
+    { "amazon", fa::amazon },
+    { "amazon_pay", fa::amazon_pay },
+    { "amilia", fa::amilia },
+    { "android", fa::android },
+    { "angellist", fa::angellist },
+    { "angrycreative", fa::angrycreative },
+    { "angular", fa::angular },
+    { "app_store", fa::app_store },
+    { "app_store_ios", fa::app_store_ios },
+    { "apper", fa::apper },
+    { "apple", fa::apple },
+    { "apple_pay", fa::apple_pay },
+    { "artstation", fa::artstation },
+    { "asymmetrik", fa::asymmetrik },
+    { "atlassian", fa::atlassian },
+    { "audible", fa::audible },
+    { "autoprefixer", fa::autoprefixer },
+    { "avianex", fa::avianex },
+    { "aviato", fa::aviato },
+    { "aws", fa::aws },
+    { "bandcamp", fa::bandcamp },
+    { "battle_net", fa::battle_net },
+    { "behance", fa::behance },
+    { "behance_square", fa::behance_square },
+    { "bilibili", fa::bilibili },
+    { "bimobject", fa::bimobject },
+    { "bitbucket", fa::bitbucket },
+    { "bitcoin", fa::bitcoin },
+    { "bity", fa::bity },
+    { "black_tie", fa::black_tie },
+    { "blackberry", fa::blackberry },
+    { "blogger", fa::blogger },
+    { "blogger_b", fa::blogger_b },
+    { "bluetooth", fa::bluetooth },
+    { "bluetooth_b", fa::bluetooth_b },
+    { "bootstrap", fa::bootstrap },
+    { "bots", fa::bots },
+    { "btc", fa::btc },
+    { "buffer", fa::buffer },
+    { "buromobelexperte", fa::buromobelexperte },
+    { "buy_n_large", fa::buy_n_large },
+    { "buysellads", fa::buysellads },
+    { "canadian_maple_leaf", fa::canadian_maple_leaf },
+    { "cc_amazon_pay", fa::cc_amazon_pay },
+    { "cc_amex", fa::cc_amex },
+    { "cc_apple_pay", fa::cc_apple_pay },
+    { "cc_diners_club", fa::cc_diners_club },
+    { "cc_discover", fa::cc_discover },
+    { "cc_jcb", fa::cc_jcb },
+    { "cc_mastercard", fa::cc_mastercard },
+    { "cc_paypal", fa::cc_paypal },
+    { "cc_stripe", fa::cc_stripe },
+    { "cc_visa", fa::cc_visa },
+    { "centercode", fa::centercode },
+    { "centos", fa::centos },
+    { "chrome", fa::chrome },
+    { "chromecast", fa::chromecast },
+    { "cloudflare", fa::cloudflare },
+    { "cloudscale", fa::cloudscale },
+    { "cloudsmith", fa::cloudsmith },
+    { "cloudversify", fa::cloudversify },
+    { "cmplid", fa::cmplid },
+    { "codepen", fa::codepen },
+    { "codiepie", fa::codiepie },
+    { "confluence", fa::confluence },
+    { "connectdevelop", fa::connectdevelop },
+    { "contao", fa::contao },
+    { "cotton_bureau", fa::cotton_bureau },
+    { "cpanel", fa::cpanel },
+    { "creative_commons", fa::creative_commons },
+    { "creative_commons_by", fa::creative_commons_by },
+    { "creative_commons_nc", fa::creative_commons_nc },
+    { "creative_commons_nc_eu", fa::creative_commons_nc_eu },
+    { "creative_commons_nc_jp", fa::creative_commons_nc_jp },
+    { "creative_commons_nd", fa::creative_commons_nd },
+    { "creative_commons_pd", fa::creative_commons_pd },
+    { "creative_commons_pd_alt", fa::creative_commons_pd_alt },
+    { "creative_commons_remix", fa::creative_commons_remix },
+    { "creative_commons_sa", fa::creative_commons_sa },
+    { "creative_commons_sampling", fa::creative_commons_sampling },
+    { "creative_commons_sampling_plus", fa::creative_commons_sampling_plus },
+    { "creative_commons_share", fa::creative_commons_share },
+    { "creative_commons_zero", fa::creative_commons_zero },
+    { "critical_role", fa::critical_role },
+    { "css3", fa::css3 },
+    { "css3_alt", fa::css3_alt },
+    { "cuttlefish", fa::cuttlefish },
+    { "d_and_d", fa::d_and_d },
+    { "d_and_d_beyond", fa::d_and_d_beyond },
+    { "dailymotion", fa::dailymotion },
+    { "dashcube", fa::dashcube },
+    { "deezer", fa::deezer },
+    { "delicious", fa::delicious },
+    { "deploydog", fa::deploydog },
+    { "deskpro", fa::deskpro },
+    { "dev", fa::dev },
+    { "deviantart", fa::deviantart },
+    { "dhl", fa::dhl },
+    { "diaspora", fa::diaspora },
+    { "digg", fa::digg },
+    { "digital_ocean", fa::digital_ocean },
+    { "discord", fa::discord },
+    { "discourse", fa::discourse },
+    { "dochub", fa::dochub },
+    { "docker", fa::docker },
+    { "draft2digital", fa::draft2digital },
+    { "dribbble", fa::dribbble },
+    { "dribbble_square", fa::dribbble_square },
+    { "dropbox", fa::dropbox },
+    { "drupal", fa::drupal },
+    { "dyalog", fa::dyalog },
+    { "earlybirds", fa::earlybirds },
+    { "ebay", fa::ebay },
+    { "edge", fa::edge },
+    { "edge_legacy", fa::edge_legacy },
+    { "elementor", fa::elementor },
+    { "ello", fa::ello },
+    { "ember", fa::ember },
+    { "empire", fa::empire },
+    { "envira", fa::envira },
+    { "erlang", fa::erlang },
+    { "ethereum", fa::ethereum },
+    { "etsy", fa::etsy },
+    { "evernote", fa::evernote },
+    { "expeditedssl", fa::expeditedssl },
+    { "facebook", fa::facebook },
+    { "facebook_f", fa::facebook_f },
+    { "facebook_messenger", fa::facebook_messenger },
+    { "facebook_square", fa::facebook_square },
+    { "fantasy_flight_games", fa::fantasy_flight_games },
+    { "fedex", fa::fedex },
+    { "fedora", fa::fedora },
+    { "figma", fa::figma },
+    { "firefox", fa::firefox },
+    { "firefox_browser", fa::firefox_browser },
+    { "first_order", fa::first_order },
+    { "first_order_alt", fa::first_order_alt },
+    { "firstdraft", fa::firstdraft },
+    { "flickr", fa::flickr },
+    { "flipboard", fa::flipboard },
+    { "fly", fa::fly },
+    { "font_awesome", fa::font_awesome },
+    { "font_awesome_flag", fa::font_awesome },
+    { "font_awesome_logo_full", fa::font_awesome },
+    { "fonticons", fa::fonticons },
+    { "fonticons_fi", fa::fonticons_fi },
+    { "fort_awesome", fa::fort_awesome },
+    { "fort_awesome_alt", fa::fort_awesome_alt },
+    { "forumbee", fa::forumbee },
+    { "foursquare", fa::foursquare },
+    { "free_code_camp", fa::free_code_camp },
+    { "freebsd", fa::freebsd },
+    { "fulcrum", fa::fulcrum },
+    { "galactic_republic", fa::galactic_republic },
+    { "galactic_senate", fa::galactic_senate },
+    { "get_pocket", fa::get_pocket },
+    { "gg", fa::gg },
+    { "gg_circle", fa::gg_circle },
+    { "git", fa::git },
+    { "git_alt", fa::git_alt },
+    { "git_square", fa::git_square },
+    { "github", fa::github },
+    { "github_alt", fa::github_alt },
+    { "github_square", fa::github_square },
+    { "gitkraken", fa::gitkraken },
+    { "gitlab", fa::gitlab },
+    { "gitter", fa::gitter },
+    { "glide", fa::glide },
+    { "glide_g", fa::glide_g },
+    { "gofore", fa::gofore },
+    { "golang", fa::golang },
+    { "goodreads", fa::goodreads },
+    { "goodreads_g", fa::goodreads_g },
+    { "google", fa::google },
+    { "google_drive", fa::google_drive },
+    { "google_pay", fa::google_pay },
+    { "google_play", fa::google_play },
+    { "google_plus", fa::google_plus },
+    { "google_plus_g", fa::google_plus_g },
+    { "google_plus_square", fa::google_plus_square },
+    { "google_wallet", fa::google_wallet },
+    { "gratipay", fa::gratipay },
+    { "grav", fa::grav },
+    { "gripfire", fa::gripfire },
+    { "grunt", fa::grunt },
+    { "guilded", fa::guilded },
+    { "gulp", fa::gulp },
+    { "hacker_news", fa::hacker_news },
+    { "hacker_news_square", fa::hacker_news_square },
+    { "hackerrank", fa::hackerrank },
+    { "hashnode", fa::hashnode },
+    { "hips", fa::hips },
+    { "hire_a_helper", fa::hire_a_helper },
+    { "hive", fa::hive },
+    { "hooli", fa::hooli },
+    { "hornbill", fa::hornbill },
+    { "hotjar", fa::hotjar },
+    { "houzz", fa::houzz },
+    { "html5", fa::html5 },
+    { "hubspot", fa::hubspot },
+    { "ideal", fa::ideal },
+    { "imdb", fa::imdb },
+    { "instagram", fa::instagram },
+    { "instagram_square", fa::instagram_square },
+    { "instalod", fa::instalod },
+    { "intercom", fa::intercom },
+    { "internet_explorer", fa::internet_explorer },
+    { "invision", fa::invision },
+    { "ioxhost", fa::ioxhost },
+    { "itch_io", fa::itch_io },
+    { "itunes", fa::itunes },
+    { "itunes_note", fa::itunes_note },
+    { "java", fa::java },
+    { "jedi_order", fa::jedi_order },
+    { "jenkins", fa::jenkins },
+    { "jira", fa::jira },
+    { "joget", fa::joget },
+    { "joomla", fa::joomla },
+    { "js", fa::js },
+    { "js_square", fa::js_square },
+    { "jsfiddle", fa::jsfiddle },
+    { "kaggle", fa::kaggle },
+    { "keybase", fa::keybase },
+    { "keycdn", fa::keycdn },
+    { "kickstarter", fa::kickstarter },
+    { "kickstarter_k", fa::kickstarter_k },
+    { "korvue", fa::korvue },
+    { "laravel", fa::laravel },
+    { "lastfm", fa::lastfm },
+    { "lastfm_square", fa::lastfm_square },
+    { "leanpub", fa::leanpub },
+    { "less", fa::less },
+    { "line", fa::line },
+    { "linkedin", fa::linkedin },
+    { "linkedin_in", fa::linkedin_in },
+    { "linode", fa::linode },
+    { "linux", fa::linux },
+    { "lyft", fa::lyft },
+    { "magento", fa::magento },
+    { "mailchimp", fa::mailchimp },
+    { "mandalorian", fa::mandalorian },
+    { "markdown", fa::markdown },
+    { "mastodon", fa::mastodon },
+    { "maxcdn", fa::maxcdn },
+    { "mdb", fa::mdb },
+    { "medapps", fa::medapps },
+    { "medium", fa::medium },
+    { "medium_m", fa::medium },
+    { "medrt", fa::medrt },
+    { "meetup", fa::meetup },
+    { "megaport", fa::megaport },
+    { "mendeley", fa::mendeley },
+    { "meta", fa::meta },
+    { "microblog", fa::microblog },
+    { "microsoft", fa::microsoft },
+    { "mix", fa::mix },
+    { "mixcloud", fa::mixcloud },
+    { "mixer", fa::mixer },
+    { "mizuni", fa::mizuni },
+    { "modx", fa::modx },
+    { "monero", fa::monero },
+    { "napster", fa::napster },
+    { "neos", fa::neos },
+    { "nfc_directional", fa::nfc_directional },
+    { "nfc_symbol", fa::nfc_symbol },
+    { "nimblr", fa::nimblr },
+    { "node", fa::node },
+    { "node_js", fa::node_js },
+    { "npm", fa::npm },
+    { "ns8", fa::ns8 },
+    { "nutritionix", fa::nutritionix },
+    { "octopus_deploy", fa::octopus_deploy },
+    { "odnoklassniki", fa::odnoklassniki },
+    { "odnoklassniki_square", fa::odnoklassniki_square },
+    { "old_republic", fa::old_republic },
+    { "opencart", fa::opencart },
+    { "openid", fa::openid },
+    { "opera", fa::opera },
+    { "optin_monster", fa::optin_monster },
+    { "orcid", fa::orcid },
+    { "osi", fa::osi },
+    { "padlet", fa::padlet },
+    { "page4", fa::page4 },
+    { "pagelines", fa::pagelines },
+    { "palfed", fa::palfed },
+    { "patreon", fa::patreon },
+    { "paypal", fa::paypal },
+    { "perbyte", fa::perbyte },
+    { "periscope", fa::periscope },
+    { "phabricator", fa::phabricator },
+    { "phoenix_framework", fa::phoenix_framework },
+    { "phoenix_squadron", fa::phoenix_squadron },
+    { "php", fa::php },
+    { "pied_piper", fa::pied_piper },
+    { "pied_piper_alt", fa::pied_piper_alt },
+    { "pied_piper_hat", fa::pied_piper_hat },
+    { "pied_piper_pp", fa::pied_piper_pp },
+    { "pied_piper_square", fa::pied_piper_square },
+    { "pinterest", fa::pinterest },
+    { "pinterest_p", fa::pinterest_p },
+    { "pinterest_square", fa::pinterest_square },
+    { "pix", fa::pix },
+    { "playstation", fa::playstation },
+    { "product_hunt", fa::product_hunt },
+    { "pushed", fa::pushed },
+    { "python", fa::python },
+    { "qq", fa::qq },
+    { "quinscape", fa::quinscape },
+    { "quora", fa::quora },
+    { "r_project", fa::r_project },
+    { "raspberry_pi", fa::raspberry_pi },
+    { "ravelry", fa::ravelry },
+    { "react", fa::react },
+    { "reacteurope", fa::reacteurope },
+    { "readme", fa::readme },
+    { "rebel", fa::rebel },
+    { "red_river", fa::red_river },
+    { "reddit", fa::reddit },
+    { "reddit_alien", fa::reddit_alien },
+    { "reddit_square", fa::reddit_square },
+    { "redhat", fa::redhat },
+    { "renren", fa::renren },
+    { "replyd", fa::replyd },
+    { "researchgate", fa::researchgate },
+    { "resolving", fa::resolving },
+    { "rev", fa::rev },
+    { "rocketchat", fa::rocketchat },
+    { "rockrms", fa::rockrms },
+    { "rust", fa::rust },
+    { "safari", fa::safari },
+    { "salesforce", fa::salesforce },
+    { "sass", fa::sass },
+    { "schlix", fa::schlix },
+    { "screenpal", fa::screenpal },
+    { "scribd", fa::scribd },
+    { "searchengin", fa::searchengin },
+    { "sellcast", fa::sellcast },
+    { "sellsy", fa::sellsy },
+    { "servicestack", fa::servicestack },
+    { "shirtsinbulk", fa::shirtsinbulk },
+    { "shopify", fa::shopify },
+    { "shopware", fa::shopware },
+    { "simplybuilt", fa::simplybuilt },
+    { "sistrix", fa::sistrix },
+    { "sith", fa::sith },
+    { "sitrox", fa::sitrox },
+    { "sketch", fa::sketch },
+    { "skyatlas", fa::skyatlas },
+    { "skype", fa::skype },
+    { "slack", fa::slack },
+    { "slack_hash", fa::slack },
+    { "slideshare", fa::slideshare },
+    { "snapchat", fa::snapchat },
+    { "snapchat_ghost", fa::snapchat },
+    { "snapchat_square", fa::snapchat_square },
+    { "soundcloud", fa::soundcloud },
+    { "sourcetree", fa::sourcetree },
+    { "speakap", fa::speakap },
+    { "speaker_deck", fa::speaker_deck },
+    { "spotify", fa::spotify },
+    { "square_font_awesome", fa::square_font_awesome },
+    { "square_font_awesome_stroke", fa::square_font_awesome_stroke },
+    { "font_awesome_alt", fa::square_font_awesome_stroke },
+    { "squarespace", fa::squarespace },
+    { "stack_exchange", fa::stack_exchange },
+    { "stack_overflow", fa::stack_overflow },
+    { "stackpath", fa::stackpath },
+    { "staylinked", fa::staylinked },
+    { "steam", fa::steam },
+    { "steam_square", fa::steam_square },
+    { "steam_symbol", fa::steam_symbol },
+    { "sticker_mule", fa::sticker_mule },
+    { "strava", fa::strava },
+    { "stripe", fa::stripe },
+    { "stripe_s", fa::stripe_s },
+    { "studiovinari", fa::studiovinari },
+    { "stumbleupon", fa::stumbleupon },
+    { "stumbleupon_circle", fa::stumbleupon_circle },
+    { "superpowers", fa::superpowers },
+    { "supple", fa::supple },
+    { "suse", fa::suse },
+    { "swift", fa::swift },
+    { "symfony", fa::symfony },
+    { "teamspeak", fa::teamspeak },
+    { "telegram", fa::telegram },
+    { "telegram_plane", fa::telegram },
+    { "tencent_weibo", fa::tencent_weibo },
+    { "the_red_yeti", fa::the_red_yeti },
+    { "themeco", fa::themeco },
+    { "themeisle", fa::themeisle },
+    { "think_peaks", fa::think_peaks },
+    { "tiktok", fa::tiktok },
+    { "trade_federation", fa::trade_federation },
+    { "trello", fa::trello },
+    { "tumblr", fa::tumblr },
+    { "tumblr_square", fa::tumblr_square },
+    { "twitch", fa::twitch },
+    { "twitter", fa::twitter },
+    { "twitter_square", fa::twitter_square },
+    { "typo3", fa::typo3 },
+    { "uber", fa::uber },
+    { "ubuntu", fa::ubuntu },
+    { "uikit", fa::uikit },
+    { "umbraco", fa::umbraco },
+    { "uncharted", fa::uncharted },
+    { "uniregistry", fa::uniregistry },
+    { "unity", fa::unity },
+    { "unsplash", fa::unsplash },
+    { "untappd", fa::untappd },
+    { "ups", fa::ups },
+    { "usb", fa::usb },
+    { "usps", fa::usps },
+    { "ussunnah", fa::ussunnah },
+    { "vaadin", fa::vaadin },
+    { "viacoin", fa::viacoin },
+    { "viadeo", fa::viadeo },
+    { "viadeo_square", fa::viadeo_square },
+    { "viber", fa::viber },
+    { "vimeo", fa::vimeo },
+    { "vimeo_square", fa::vimeo_square },
+    { "vimeo_v", fa::vimeo_v },
+    { "vine", fa::vine },
+    { "vk", fa::vk },
+    { "vnv", fa::vnv },
+    { "vuejs", fa::vuejs },
+    { "watchman_monitoring", fa::watchman_monitoring },
+    { "waze", fa::waze },
+    { "weebly", fa::weebly },
+    { "weibo", fa::weibo },
+    { "weixin", fa::weixin },
+    { "whatsapp", fa::whatsapp },
+    { "whatsapp_square", fa::whatsapp_square },
+    { "whmcs", fa::whmcs },
+    { "wikipedia_w", fa::wikipedia_w },
+    { "windows", fa::windows },
+    { "wirsindhandwerk", fa::wirsindhandwerk },
+    { "wsh", fa::wirsindhandwerk },
+    { "wix", fa::wix },
+    { "wizards_of_the_coast", fa::wizards_of_the_coast },
+    { "wodu", fa::wodu },
+    { "wolf_pack_battalion", fa::wolf_pack_battalion },
+    { "wordpress", fa::wordpress },
+    { "wordpress_simple", fa::wordpress_simple },
+    { "wpbeginner", fa::wpbeginner },
+    { "wpexplorer", fa::wpexplorer },
+    { "wpforms", fa::wpforms },
+    { "wpressr", fa::wpressr },
+    { "xbox", fa::xbox },
+    { "xing", fa::xing },
+    { "xing_square", fa::xing_square },
+    { "y_combinator", fa::y_combinator },
+    { "yahoo", fa::yahoo },
+    { "yammer", fa::yammer },
+    { "yandex", fa::yandex },
+    { "yandex_international", fa::yandex_international },
+    { "yarn", fa::yarn },
+    { "yelp", fa::yelp },
+    { "yoast", fa::yoast },
+    { "youtube", fa::youtube },
+    { "youtube_square", fa::youtube_square },
+    { "zhihu", fa::zhihu },
+};
+
+const int faNameIconCount = sizeof(faNameIconArray) / sizeof(FANameIcon);
+
+const int faIconCount = 3584;
+
+const int faIcons[] = {
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c,
+    0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44,
+    0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c,
+    0x5d, 0x60, 0x7b, 0x7c, 0x7d, 0x7e, 0xe000, 0xe001, 0xe002, 0xe003, 0xe004, 0xe005,
+    0xe006, 0xe008, 0xe009, 0xe00a, 0xe00b, 0xe00c, 0xe00d, 0xe00e, 0xe00f, 0xe010, 0xe011, 0xe012,
+    0xe014, 0xe015, 0xe016, 0xe017, 0xe018, 0xe019, 0xe01b, 0xe01c, 0xe01d, 0xe01f, 0xe020, 0xe021,
+    0xe022, 0xe023, 0xe024, 0xe025, 0xe026, 0xe027, 0xe028, 0xe029, 0xe02a, 0xe02b, 0xe02c, 0xe02d,
+    0xe02e, 0xe02f, 0xe030, 0xe031, 0xe032, 0xe033, 0xe034, 0xe035, 0xe036, 0xe037, 0xe038, 0xe039,
+    0xe03a, 0xe03b, 0xe03c, 0xe03d, 0xe03e, 0xe03f, 0xe040, 0xe041, 0xe042, 0xe043, 0xe044, 0xe045,
+    0xe046, 0xe047, 0xe048, 0xe04a, 0xe04b, 0xe04c, 0xe04d, 0xe04e, 0xe04f, 0xe050, 0xe051, 0xe053,
+    0xe054, 0xe058, 0xe059, 0xe05a, 0xe05b, 0xe05c, 0xe05d, 0xe05e, 0xe05f, 0xe060, 0xe061, 0xe062,
+    0xe063, 0xe064, 0xe065, 0xe066, 0xe067, 0xe068, 0xe069, 0xe06a, 0xe06b, 0xe06c, 0xe06d, 0xe06e,
+    0xe06f, 0xe070, 0xe071, 0xe072, 0xe073, 0xe074, 0xe075, 0xe076, 0xe085, 0xe086, 0xe089, 0xe08a,
+    0xe08c, 0xe08d, 0xe08f, 0xe090, 0xe091, 0xe092, 0xe093, 0xe094, 0xe095, 0xe096, 0xe097, 0xe098,
+    0xe099, 0xe09a, 0xe09b, 0xe09c, 0xe09d, 0xe09e, 0xe09f, 0xe0a0, 0xe0a1, 0xe0a2, 0xe0a3, 0xe0a4,
+    0xe0a5, 0xe0a6, 0xe0a7, 0xe0a8, 0xe0a9, 0xe0aa, 0xe0ab, 0xe0ac, 0xe0ad, 0xe0ae, 0xe0af, 0xe0b0,
+    0xe0b1, 0xe0b2, 0xe0b3, 0xe0b4, 0xe0b5, 0xe0b6, 0xe0b7, 0xe0b8, 0xe0b9, 0xe0ba, 0xe0bb, 0xe0bc,
+    0xe0bd, 0xe0be, 0xe0bf, 0xe0c0, 0xe0c1, 0xe0c2, 0xe0c3, 0xe0c4, 0xe0c5, 0xe0c6, 0xe0c7, 0xe0c8,
+    0xe0c9, 0xe0ca, 0xe0cb, 0xe0cc, 0xe0cd, 0xe0ce, 0xe0cf, 0xe0d0, 0xe0d1, 0xe0d2, 0xe0d3, 0xe0d4,
+    0xe0d5, 0xe0d6, 0xe0d7, 0xe0d8, 0xe0d9, 0xe0da, 0xe0db, 0xe0dc, 0xe0dd, 0xe0de, 0xe0df, 0xe0e1,
+    0xe0e2, 0xe0e3, 0xe0e4, 0xe0e5, 0xe0e6, 0xe0e7, 0xe0e8, 0xe0e9, 0xe0ea, 0xe0eb, 0xe0ec, 0xe0ed,
+    0xe0ee, 0xe0ef, 0xe0f0, 0xe0f1, 0xe0f2, 0xe0f3, 0xe0f4, 0xe0f5, 0xe0f6, 0xe0f7, 0xe0f8, 0xe0f9,
+    0xe0fa, 0xe0fb, 0xe0fc, 0xe0fd, 0xe0fe, 0xe0ff, 0xe100, 0xe101, 0xe102, 0xe103, 0xe104, 0xe105,
+    0xe106, 0xe107, 0xe108, 0xe109, 0xe10a, 0xe10b, 0xe10c, 0xe10d, 0xe10e, 0xe10f, 0xe110, 0xe111,
+    0xe112, 0xe113, 0xe114, 0xe115, 0xe116, 0xe117, 0xe118, 0xe119, 0xe11a, 0xe11b, 0xe11c, 0xe11d,
+    0xe11e, 0xe11f, 0xe120, 0xe121, 0xe122, 0xe123, 0xe124, 0xe125, 0xe126, 0xe127, 0xe128, 0xe129,
+    0xe12a, 0xe12b, 0xe12c, 0xe12d, 0xe12e, 0xe12f, 0xe130, 0xe131, 0xe132, 0xe133, 0xe134, 0xe135,
+    0xe136, 0xe137, 0xe138, 0xe139, 0xe13a, 0xe13b, 0xe13c, 0xe13d, 0xe13e, 0xe13f, 0xe140, 0xe142,
+    0xe143, 0xe144, 0xe145, 0xe146, 0xe147, 0xe148, 0xe149, 0xe14a, 0xe14b, 0xe14c, 0xe14d, 0xe14e,
+    0xe14f, 0xe150, 0xe151, 0xe152, 0xe154, 0xe155, 0xe156, 0xe157, 0xe158, 0xe15a, 0xe15b, 0xe15c,
+    0xe15d, 0xe15e, 0xe15f, 0xe160, 0xe161, 0xe162, 0xe163, 0xe164, 0xe165, 0xe166, 0xe168, 0xe169,
+    0xe16a, 0xe16b, 0xe16c, 0xe16d, 0xe16e, 0xe16f, 0xe170, 0xe171, 0xe172, 0xe173, 0xe174, 0xe175,
+    0xe176, 0xe177, 0xe178, 0xe179, 0xe17a, 0xe17b, 0xe17c, 0xe17d, 0xe17e, 0xe17f, 0xe180, 0xe181,
+    0xe182, 0xe183, 0xe184, 0xe185, 0xe186, 0xe187, 0xe188, 0xe189, 0xe18a, 0xe18b, 0xe18c, 0xe18d,
+    0xe18e, 0xe18f, 0xe190, 0xe191, 0xe192, 0xe193, 0xe194, 0xe195, 0xe196, 0xe197, 0xe198, 0xe199,
+    0xe19a, 0xe19b, 0xe19c, 0xe19d, 0xe19e, 0xe19f, 0xe1a0, 0xe1a1, 0xe1a2, 0xe1a3, 0xe1a4, 0xe1a5,
+    0xe1a6, 0xe1a7, 0xe1a8, 0xe1a9, 0xe1aa, 0xe1ab, 0xe1ac, 0xe1ad, 0xe1ae, 0xe1af, 0xe1b0, 0xe1b1,
+    0xe1b2, 0xe1b3, 0xe1b4, 0xe1b5, 0xe1b6, 0xe1b7, 0xe1b8, 0xe1b9, 0xe1ba, 0xe1bb, 0xe1bc, 0xe1bd,
+    0xe1be, 0xe1bf, 0xe1c0, 0xe1c1, 0xe1c2, 0xe1c3, 0xe1c4, 0xe1c5, 0xe1c6, 0xe1c7, 0xe1c8, 0xe1c9,
+    0xe1ca, 0xe1cb, 0xe1cc, 0xe1cd, 0xe1ce, 0xe1cf, 0xe1d0, 0xe1d1, 0xe1d2, 0xe1d3, 0xe1d4, 0xe1d5,
+    0xe1d6, 0xe1d7, 0xe1d8, 0xe1d9, 0xe1da, 0xe1db, 0xe1dc, 0xe1dd, 0xe1de, 0xe1df, 0xe1e0, 0xe1e1,
+    0xe1e2, 0xe1e3, 0xe1e4, 0xe1e5, 0xe1e6, 0xe1e7, 0xe1e8, 0xe1e9, 0xe1ea, 0xe1eb, 0xe1ec, 0xe1ed,
+    0xe1ee, 0xe1ef, 0xe1f0, 0xe1f1, 0xe1f2, 0xe1f3, 0xe1f4, 0xe1f5, 0xe1f6, 0xe1f7, 0xe1f8, 0xe1f9,
+    0xe1fa, 0xe1fb, 0xe1fc, 0xe1fd, 0xe1fe, 0xe1ff, 0xe200, 0xe201, 0xe202, 0xe203, 0xe204, 0xe205,
+    0xe206, 0xe208, 0xe209, 0xe20a, 0xe20b, 0xe20c, 0xe20d, 0xe20e, 0xe20f, 0xe210, 0xe211, 0xe212,
+    0xe213, 0xe214, 0xe215, 0xe216, 0xe217, 0xe218, 0xe219, 0xe21a, 0xe21b, 0xe21c, 0xe21d, 0xe21e,
+    0xe21f, 0xe220, 0xe221, 0xe222, 0xe223, 0xe224, 0xe225, 0xe226, 0xe227, 0xe228, 0xe229, 0xe22b,
+    0xe22c, 0xe22d, 0xe22e, 0xe22f, 0xe231, 0xe234, 0xe235, 0xe236, 0xe237, 0xe238, 0xe239, 0xe23a,
+    0xe23b, 0xe23c, 0xe23d, 0xe23e, 0xe23f, 0xe240, 0xe241, 0xe242, 0xe243, 0xe244, 0xe246, 0xe247,
+    0xe248, 0xe249, 0xe24a, 0xe24b, 0xe24c, 0xe24d, 0xe24e, 0xe24f, 0xe250, 0xe251, 0xe252, 0xe253,
+    0xe254, 0xe255, 0xe256, 0xe257, 0xe258, 0xe259, 0xe25a, 0xe25b, 0xe25c, 0xe25d, 0xe25e, 0xe25f,
+    0xe260, 0xe261, 0xe262, 0xe263, 0xe264, 0xe265, 0xe266, 0xe267, 0xe268, 0xe269, 0xe26a, 0xe26b,
+    0xe26c, 0xe26d, 0xe26e, 0xe26f, 0xe270, 0xe271, 0xe272, 0xe273, 0xe274, 0xe275, 0xe276, 0xe277,
+    0xe278, 0xe279, 0xe27a, 0xe27b, 0xe27c, 0xe27d, 0xe27e, 0xe27f, 0xe280, 0xe281, 0xe282, 0xe283,
+    0xe284, 0xe285, 0xe286, 0xe287, 0xe288, 0xe289, 0xe28a, 0xe28b, 0xe28c, 0xe28d, 0xe28e, 0xe28f,
+    0xe290, 0xe291, 0xe292, 0xe293, 0xe294, 0xe295, 0xe296, 0xe297, 0xe298, 0xe299, 0xe29a, 0xe29b,
+    0xe29c, 0xe29d, 0xe29e, 0xe29f, 0xe2a0, 0xe2a1, 0xe2a2, 0xe2a3, 0xe2a4, 0xe2a5, 0xe2a6, 0xe2a7,
+    0xe2a8, 0xe2a9, 0xe2aa, 0xe2ab, 0xe2ac, 0xe2ad, 0xe2ae, 0xe2af, 0xe2b0, 0xe2b1, 0xe2b2, 0xe2b3,
+    0xe2b4, 0xe2b5, 0xe2b6, 0xe2b7, 0xe2b8, 0xe2b9, 0xe2ba, 0xe2bb, 0xe2bc, 0xe2bd, 0xe2be, 0xe2bf,
+    0xe2c0, 0xe2c1, 0xe2c2, 0xe2c3, 0xe2c4, 0xe2c5, 0xe2c6, 0xe2c7, 0xe2c8, 0xe2c9, 0xe2ca, 0xe2cb,
+    0xe2cc, 0xe2cd, 0xe2ce, 0xe2cf, 0xe2d1, 0xe2d2, 0xe2dc, 0xe2df, 0xe2e1, 0xe2e3, 0xe2e4, 0xe2e5,
+    0xe2e6, 0xe2e7, 0xe2e8, 0xe2e9, 0xe2ea, 0xe2eb, 0xe2f2, 0xe2f4, 0xe2f5, 0xe2f6, 0xe2fa, 0xe2fe,
+    0xe2ff, 0xe300, 0xe301, 0xe302, 0xe303, 0xe304, 0xe306, 0xe307, 0xe30c, 0xe30f, 0xe310, 0xe311,
+    0xe312, 0xe313, 0xe316, 0xe317, 0xe318, 0xe31a, 0xe31b, 0xe31c, 0xe31e, 0xe31f, 0xe322, 0xe323,
+    0xe324, 0xe329, 0xe32a, 0xe32b, 0xe32d, 0xe32e, 0xe32f, 0xe330, 0xe331, 0xe333, 0xe334, 0xe337,
+    0xe338, 0xe339, 0xe33a, 0xe33b, 0xe33c, 0xe33d, 0xe33e, 0xe33f, 0xe341, 0xe342, 0xe343, 0xe344,
+    0xe345, 0xe346, 0xe347, 0xe348, 0xe349, 0xe34a, 0xe34b, 0xe34c, 0xe34d, 0xe34e, 0xe34f, 0xe350,
+    0xe351, 0xe352, 0xe353, 0xe354, 0xe355, 0xe356, 0xe357, 0xe358, 0xe359, 0xe35a, 0xe35b, 0xe35c,
+    0xe35d, 0xe35e, 0xe35f, 0xe361, 0xe362, 0xe363, 0xe364, 0xe365, 0xe366, 0xe367, 0xe368, 0xe369,
+    0xe36a, 0xe36b, 0xe36c, 0xe36d, 0xe36e, 0xe36f, 0xe370, 0xe371, 0xe372, 0xe373, 0xe374, 0xe375,
+    0xe376, 0xe377, 0xe378, 0xe379, 0xe37a, 0xe37b, 0xe37c, 0xe37d, 0xe37e, 0xe37f, 0xe380, 0xe381,
+    0xe382, 0xe383, 0xe384, 0xe385, 0xe386, 0xe387, 0xe388, 0xe389, 0xe38a, 0xe38b, 0xe38c, 0xe38d,
+    0xe38e, 0xe38f, 0xe390, 0xe391, 0xe392, 0xe393, 0xe394, 0xe395, 0xe396, 0xe397, 0xe398, 0xe399,
+    0xe39a, 0xe39b, 0xe39c, 0xe39d, 0xe39e, 0xe39f, 0xe3a0, 0xe3a1, 0xe3a2, 0xe3a3, 0xe3a4, 0xe3a5,
+    0xe3a6, 0xe3a7, 0xe3a8, 0xe3a9, 0xe3aa, 0xe3ab, 0xe3ac, 0xe3ad, 0xe3ae, 0xe3af, 0xe3b0, 0xe3b1,
+    0xe3b2, 0xe3b3, 0xe3b4, 0xe3b5, 0xe3b6, 0xe3b7, 0xe3b8, 0xe3b9, 0xe3ba, 0xe3bb, 0xe3bc, 0xe3bd,
+    0xe3be, 0xe3bf, 0xe3c0, 0xe3c1, 0xe3c2, 0xe3c3, 0xe3c4, 0xe3c5, 0xe3c6, 0xe3c7, 0xe3c8, 0xe3c9,
+    0xe3ca, 0xe3cb, 0xe3cc, 0xe3cd, 0xe3ce, 0xe3cf, 0xe3d0, 0xe3d1, 0xe3d2, 0xe3d3, 0xe3d4, 0xe3d5,
+    0xe3d6, 0xe3d7, 0xe3d8, 0xe3da, 0xe3db, 0xe3dc, 0xe3dd, 0xe3de, 0xe3df, 0xe3e0, 0xe3e1, 0xe3e2,
+    0xe3e3, 0xe3e4, 0xe3e5, 0xe3e6, 0xe3e7, 0xe3e8, 0xe3e9, 0xe3ea, 0xe3eb, 0xe3ec, 0xe3ed, 0xe3ee,
+    0xe3ef, 0xe3f0, 0xe3f1, 0xe3f2, 0xe3f3, 0xe3f4, 0xe3f5, 0xe3f6, 0xe3f7, 0xe3f8, 0xe3f9, 0xe3fa,
+    0xe3fb, 0xe3fc, 0xe3fd, 0xe3fe, 0xe3ff, 0xe400, 0xe401, 0xe402, 0xe403, 0xe404, 0xe405, 0xe406,
+    0xe407, 0xe408, 0xe409, 0xe40a, 0xe40b, 0xe40c, 0xe40d, 0xe40e, 0xe410, 0xe411, 0xe412, 0xe413,
+    0xe414, 0xe415, 0xe416, 0xe417, 0xe418, 0xe419, 0xe41a, 0xe41b, 0xe41c, 0xe41d, 0xe41e, 0xe41f,
+    0xe420, 0xe421, 0xe422, 0xe423, 0xe424, 0xe425, 0xe426, 0xe427, 0xe428, 0xe429, 0xe42a, 0xe42b,
+    0xe42c, 0xe42d, 0xe42e, 0xe42f, 0xe430, 0xe431, 0xe432, 0xe433, 0xe434, 0xe435, 0xe436, 0xe437,
+    0xe438, 0xe439, 0xe43b, 0xe43c, 0xe43d, 0xe43e, 0xe43f, 0xe440, 0xe441, 0xe442, 0xe443, 0xe444,
+    0xe445, 0xe446, 0xe447, 0xe448, 0xe449, 0xe44b, 0xe44c, 0xe44d, 0xe44e, 0xe44f, 0xe450, 0xe451,
+    0xe452, 0xe453, 0xe454, 0xe455, 0xe456, 0xe457, 0xe458, 0xe459, 0xe45a, 0xe45b, 0xe45c, 0xe45d,
+    0xe45e, 0xe45f, 0xe460, 0xe461, 0xe462, 0xe463, 0xe464, 0xe465, 0xe466, 0xe467, 0xe468, 0xe469,
+    0xe46a, 0xe46b, 0xe46c, 0xe46d, 0xe46e, 0xe46f, 0xe470, 0xe471, 0xe472, 0xe473, 0xe474, 0xe475,
+    0xe476, 0xe477, 0xe478, 0xe479, 0xe47a, 0xe47b, 0xe47c, 0xe47d, 0xe47e, 0xe47f, 0xe480, 0xe481,
+    0xe482, 0xe483, 0xe484, 0xe485, 0xe486, 0xe487, 0xe488, 0xe489, 0xe48a, 0xe48b, 0xe48c, 0xe48d,
+    0xe48e, 0xe48f, 0xe490, 0xe491, 0xe492, 0xe493, 0xe494, 0xe495, 0xe496, 0xe497, 0xe498, 0xe49a,
+    0xe49c, 0xe49d, 0xe49e, 0xe49f, 0xe4a1, 0xe4a2, 0xe4a3, 0xe4a4, 0xe4a5, 0xe4a6, 0xe4a7, 0xe4a8,
+    0xe4a9, 0xe4aa, 0xe4ab, 0xe4ac, 0xe4ad, 0xe4ae, 0xe4af, 0xe4b0, 0xe4b1, 0xe4b2, 0xe4b3, 0xe4b4,
+    0xe4b5, 0xe4b6, 0xe4b7, 0xe4b8, 0xe4b9, 0xe4ba, 0xe4bb, 0xe4bc, 0xe4bd, 0xe4be, 0xe4bf, 0xe4c0,
+    0xe4c1, 0xe4c2, 0xe4c3, 0xe4c4, 0xe4c5, 0xe4c6, 0xe4c7, 0xe4c8, 0xe4c9, 0xe4ca, 0xe4cb, 0xe4cc,
+    0xe4cd, 0xe4ce, 0xe4cf, 0xe4d0, 0xe4d1, 0xe4d2, 0xe4d3, 0xe4d4, 0xe4d5, 0xe4d6, 0xe4d7, 0xe4d8,
+    0xe4d9, 0xe4da, 0xe4db, 0xe4dc, 0xe4dd, 0xe4de, 0xe4df, 0xe4e0, 0xe4e1, 0xe4e2, 0xe4e3, 0xe4e4,
+    0xe4e5, 0xe4e6, 0xe4e7, 0xe4e8, 0xe4e9, 0xe4ea, 0xe4eb, 0xe4ec, 0xe4ed, 0xe4ee, 0xe4ef, 0xe4f0,
+    0xe4f1, 0xe4f2, 0xe4f3, 0xe4f4, 0xe4f5, 0xe4f6, 0xe4f7, 0xe4f8, 0xe4f9, 0xe4fa, 0xe4fb, 0xe4fc,
+    0xe4fd, 0xe4fe, 0xe4ff, 0xe500, 0xe501, 0xe502, 0xe503, 0xe504, 0xe505, 0xe506, 0xe507, 0xe508,
+    0xe509, 0xe50a, 0xe50b, 0xe50c, 0xe50d, 0xe50e, 0xe50f, 0xe510, 0xe511, 0xe512, 0xe513, 0xe514,
+    0xe515, 0xe516, 0xe517, 0xe518, 0xe519, 0xe51a, 0xe51b, 0xe51c, 0xe51d, 0xe51e, 0xe51f, 0xe520,
+    0xe521, 0xe522, 0xe523, 0xe524, 0xe525, 0xe526, 0xe527, 0xe528, 0xe529, 0xe52a, 0xe52b, 0xe52c,
+    0xe52d, 0xe52e, 0xe52f, 0xe532, 0xe533, 0xe534, 0xe535, 0xe536, 0xe537, 0xe538, 0xe539, 0xe53a,
+    0xe53b, 0xe53c, 0xe53d, 0xe53e, 0xe53f, 0xe540, 0xe541, 0xe542, 0xe543, 0xe544, 0xe545, 0xe546,
+    0xe547, 0xe548, 0xe549, 0xe54a, 0xe54b, 0xe54c, 0xe54d, 0xe54e, 0xe54f, 0xe550, 0xe551, 0xe552,
+    0xe553, 0xe554, 0xe555, 0xe556, 0xe557, 0xe558, 0xe559, 0xe55a, 0xe55b, 0xe55c, 0xe55d, 0xe55e,
+    0xe55f, 0xe560, 0xe561, 0xe562, 0xe563, 0xe564, 0xe565, 0xe566, 0xe567, 0xe568, 0xe569, 0xe56a,
+    0xe56b, 0xe56c, 0xe56d, 0xe56e, 0xe56f, 0xe571, 0xe572, 0xe573, 0xe574, 0xe575, 0xe576, 0xe577,
+    0xe578, 0xe579, 0xe57a, 0xe57b, 0xe57c, 0xe57d, 0xe57e, 0xe57f, 0xe580, 0xe581, 0xe582, 0xe583,
+    0xe584, 0xe585, 0xe586, 0xe587, 0xe588, 0xe589, 0xe58a, 0xe58b, 0xe58c, 0xe58d, 0xe58e, 0xe58f,
+    0xe590, 0xe591, 0xe592, 0xe593, 0xe594, 0xe595, 0xe596, 0xe597, 0xe598, 0xe599, 0xe59a, 0xe59b,
+    0xe59c, 0xe59d, 0xe59e, 0xf000, 0xf001, 0xf002, 0xf004, 0xf005, 0xf007, 0xf008, 0xf009, 0xf00a,
+    0xf00b, 0xf00c, 0xf00d, 0xf00e, 0xf010, 0xf011, 0xf012, 0xf013, 0xf015, 0xf017, 0xf018, 0xf019,
+    0xf01c, 0xf01e, 0xf021, 0xf022, 0xf023, 0xf024, 0xf025, 0xf026, 0xf027, 0xf028, 0xf029, 0xf02a,
+    0xf02b, 0xf02c, 0xf02d, 0xf02e, 0xf02f, 0xf030, 0xf031, 0xf032, 0xf033, 0xf034, 0xf035, 0xf036,
+    0xf037, 0xf038, 0xf039, 0xf03a, 0xf03b, 0xf03c, 0xf03d, 0xf03e, 0xf041, 0xf042, 0xf043, 0xf044,
+    0xf047, 0xf048, 0xf049, 0xf04a, 0xf04b, 0xf04c, 0xf04d, 0xf04e, 0xf050, 0xf051, 0xf052, 0xf053,
+    0xf054, 0xf055, 0xf056, 0xf057, 0xf058, 0xf059, 0xf05a, 0xf05b, 0xf05e, 0xf060, 0xf061, 0xf062,
+    0xf063, 0xf064, 0xf065, 0xf066, 0xf068, 0xf06a, 0xf06b, 0xf06c, 0xf06d, 0xf06e, 0xf070, 0xf071,
+    0xf072, 0xf073, 0xf074, 0xf075, 0xf076, 0xf077, 0xf078, 0xf079, 0xf07a, 0xf07b, 0xf07c, 0xf07d,
+    0xf07e, 0xf080, 0xf083, 0xf084, 0xf085, 0xf086, 0xf089, 0xf08b, 0xf08d, 0xf08e, 0xf090, 0xf091,
+    0xf093, 0xf094, 0xf095, 0xf098, 0xf09c, 0xf09d, 0xf09e, 0xf0a0, 0xf0a1, 0xf0a3, 0xf0a4, 0xf0a5,
+    0xf0a6, 0xf0a7, 0xf0a8, 0xf0a9, 0xf0aa, 0xf0ab, 0xf0ac, 0xf0ad, 0xf0ae, 0xf0b0, 0xf0b1, 0xf0b2,
+    0xf0c0, 0xf0c1, 0xf0c2, 0xf0c3, 0xf0c4, 0xf0c5, 0xf0c6, 0xf0c7, 0xf0c8, 0xf0c9, 0xf0ca, 0xf0cb,
+    0xf0cc, 0xf0cd, 0xf0ce, 0xf0d0, 0xf0d1, 0xf0d6, 0xf0d7, 0xf0d8, 0xf0d9, 0xf0da, 0xf0db, 0xf0dc,
+    0xf0dd, 0xf0de, 0xf0e0, 0xf0e2, 0xf0e3, 0xf0e7, 0xf0e8, 0xf0e9, 0xf0ea, 0xf0eb, 0xf0ec, 0xf0ed,
+    0xf0ee, 0xf0f0, 0xf0f1, 0xf0f2, 0xf0f3, 0xf0f4, 0xf0f8, 0xf0f9, 0xf0fa, 0xf0fb, 0xf0fc, 0xf0fd,
+    0xf0fe, 0xf100, 0xf101, 0xf102, 0xf103, 0xf104, 0xf105, 0xf106, 0xf107, 0xf109, 0xf10a, 0xf10b,
+    0xf10d, 0xf10e, 0xf110, 0xf111, 0xf118, 0xf119, 0xf11a, 0xf11b, 0xf11c, 0xf11e, 0xf120, 0xf121,
+    0xf122, 0xf124, 0xf125, 0xf126, 0xf127, 0xf129, 0xf12b, 0xf12c, 0xf12d, 0xf12e, 0xf130, 0xf131,
+    0xf132, 0xf133, 0xf134, 0xf135, 0xf137, 0xf138, 0xf139, 0xf13a, 0xf13d, 0xf13e, 0xf140, 0xf141,
+    0xf142, 0xf143, 0xf144, 0xf145, 0xf146, 0xf148, 0xf149, 0xf14a, 0xf14b, 0xf14c, 0xf14d, 0xf14e,
+    0xf150, 0xf151, 0xf152, 0xf153, 0xf154, 0xf156, 0xf157, 0xf158, 0xf159, 0xf15b, 0xf15c, 0xf15d,
+    0xf15e, 0xf160, 0xf161, 0xf162, 0xf163, 0xf164, 0xf165, 0xf175, 0xf176, 0xf177, 0xf178, 0xf182,
+    0xf183, 0xf185, 0xf186, 0xf187, 0xf188, 0xf191, 0xf192, 0xf193, 0xf195, 0xf197, 0xf199, 0xf19c,
+    0xf19d, 0xf1ab, 0xf1ac, 0xf1ad, 0xf1ae, 0xf1b0, 0xf1b2, 0xf1b3, 0xf1b8, 0xf1b9, 0xf1ba, 0xf1bb,
+    0xf1c0, 0xf1c1, 0xf1c2, 0xf1c3, 0xf1c4, 0xf1c5, 0xf1c6, 0xf1c7, 0xf1c8, 0xf1c9, 0xf1cd, 0xf1ce,
+    0xf1d8, 0xf1da, 0xf1dc, 0xf1dd, 0xf1de, 0xf1e0, 0xf1e1, 0xf1e2, 0xf1e3, 0xf1e4, 0xf1e5, 0xf1e6,
+    0xf1ea, 0xf1eb, 0xf1ec, 0xf1f6, 0xf1f8, 0xf1f9, 0xf1fb, 0xf1fc, 0xf1fd, 0xf1fe, 0xf200, 0xf201,
+    0xf204, 0xf205, 0xf206, 0xf207, 0xf20a, 0xf20b, 0xf217, 0xf218, 0xf219, 0xf21a, 0xf21b, 0xf21c,
+    0xf21d, 0xf21e, 0xf221, 0xf222, 0xf223, 0xf224, 0xf225, 0xf226, 0xf227, 0xf228, 0xf229, 0xf22a,
+    0xf22b, 0xf22c, 0xf22d, 0xf233, 0xf234, 0xf235, 0xf236, 0xf238, 0xf239, 0xf240, 0xf241, 0xf242,
+    0xf243, 0xf244, 0xf245, 0xf246, 0xf247, 0xf248, 0xf249, 0xf24d, 0xf24e, 0xf251, 0xf252, 0xf253,
+    0xf254, 0xf255, 0xf256, 0xf257, 0xf258, 0xf259, 0xf25a, 0xf25b, 0xf25c, 0xf25d, 0xf26c, 0xf271,
+    0xf272, 0xf273, 0xf274, 0xf275, 0xf276, 0xf277, 0xf279, 0xf27a, 0xf28b, 0xf28d, 0xf290, 0xf291,
+    0xf29a, 0xf29d, 0xf29e, 0xf2a0, 0xf2a1, 0xf2a2, 0xf2a3, 0xf2a4, 0xf2a7, 0xf2a8, 0xf2b5, 0xf2b6,
+    0xf2b9, 0xf2bb, 0xf2bd, 0xf2c1, 0xf2c2, 0xf2c7, 0xf2c8, 0xf2c9, 0xf2ca, 0xf2cb, 0xf2cc, 0xf2cd,
+    0xf2ce, 0xf2d0, 0xf2d1, 0xf2d2, 0xf2d3, 0xf2db, 0xf2dc, 0xf2e1, 0xf2e2, 0xf2e3, 0xf2e4, 0xf2e5,
+    0xf2e6, 0xf2e7, 0xf2e8, 0xf2e9, 0xf2ea, 0xf2eb, 0xf2ec, 0xf2ed, 0xf2ee, 0xf2f0, 0xf2f1, 0xf2f2,
+    0xf2f3, 0xf2f4, 0xf2f5, 0xf2f6, 0xf2f7, 0xf2f8, 0xf2f9, 0xf2fa, 0xf2fb, 0xf2fc, 0xf2fd, 0xf2fe,
+    0xf300, 0xf301, 0xf302, 0xf303, 0xf304, 0xf305, 0xf306, 0xf307, 0xf308, 0xf309, 0xf30a, 0xf30b,
+    0xf30c, 0xf30d, 0xf30e, 0xf30f, 0xf310, 0xf311, 0xf312, 0xf313, 0xf314, 0xf315, 0xf316, 0xf317,
+    0xf318, 0xf319, 0xf31a, 0xf31c, 0xf31d, 0xf31e, 0xf320, 0xf321, 0xf322, 0xf323, 0xf324, 0xf325,
+    0xf326, 0xf327, 0xf328, 0xf329, 0xf32a, 0xf32b, 0xf32c, 0xf32d, 0xf32e, 0xf330, 0xf331, 0xf333,
+    0xf334, 0xf335, 0xf336, 0xf337, 0xf338, 0xf339, 0xf33a, 0xf33b, 0xf33c, 0xf33d, 0xf33e, 0xf340,
+    0xf341, 0xf342, 0xf343, 0xf344, 0xf345, 0xf346, 0xf347, 0xf348, 0xf349, 0xf34a, 0xf34b, 0xf34c,
+    0xf34d, 0xf34e, 0xf350, 0xf351, 0xf352, 0xf353, 0xf354, 0xf355, 0xf356, 0xf357, 0xf358, 0xf359,
+    0xf35a, 0xf35b, 0xf35d, 0xf360, 0xf361, 0xf362, 0xf363, 0xf364, 0xf365, 0xf366, 0xf367, 0xf376,
+    0xf377, 0xf37e, 0xf386, 0xf387, 0xf389, 0xf38a, 0xf390, 0xf39b, 0xf39c, 0xf3a0, 0xf3a5, 0xf3b3,
+    0xf3be, 0xf3bf, 0xf3c1, 0xf3c2, 0xf3c5, 0xf3c9, 0xf3cd, 0xf3ce, 0xf3cf, 0xf3d1, 0xf3dd, 0xf3de,
+    0xf3e0, 0xf3e5, 0xf3ed, 0xf3f0, 0xf3f1, 0xf3f2, 0xf3f4, 0xf3fa, 0xf3fb, 0xf3fc, 0xf3ff, 0xf400,
+    0xf401, 0xf406, 0xf40e, 0xf40f, 0xf410, 0xf422, 0xf424, 0xf432, 0xf433, 0xf434, 0xf435, 0xf436,
+    0xf437, 0xf438, 0xf439, 0xf43a, 0xf43b, 0xf43c, 0xf43d, 0xf43e, 0xf43f, 0xf440, 0xf441, 0xf442,
+    0xf443, 0xf444, 0xf445, 0xf446, 0xf447, 0xf448, 0xf449, 0xf44a, 0xf44b, 0xf44c, 0xf44e, 0xf44f,
+    0xf450, 0xf451, 0xf453, 0xf454, 0xf455, 0xf456, 0xf458, 0xf45a, 0xf45b, 0xf45c, 0xf45d, 0xf45e,
+    0xf45f, 0xf460, 0xf461, 0xf462, 0xf463, 0xf464, 0xf465, 0xf466, 0xf467, 0xf468, 0xf469, 0xf46a,
+    0xf46b, 0xf46c, 0xf46d, 0xf46e, 0xf46f, 0xf470, 0xf471, 0xf472, 0xf473, 0xf474, 0xf475, 0xf476,
+    0xf477, 0xf478, 0xf479, 0xf47a, 0xf47b, 0xf47c, 0xf47e, 0xf47f, 0xf480, 0xf481, 0xf482, 0xf483,
+    0xf484, 0xf485, 0xf486, 0xf487, 0xf488, 0xf489, 0xf48a, 0xf48b, 0xf48c, 0xf48d, 0xf48e, 0xf48f,
+    0xf490, 0xf491, 0xf492, 0xf493, 0xf494, 0xf495, 0xf496, 0xf497, 0xf498, 0xf499, 0xf49a, 0xf49b,
+    0xf49c, 0xf49d, 0xf49e, 0xf49f, 0xf4a0, 0xf4a2, 0xf4a3, 0xf4a4, 0xf4a5, 0xf4a6, 0xf4a7, 0xf4a8,
+    0xf4a9, 0xf4aa, 0xf4ab, 0xf4ac, 0xf4ad, 0xf4ae, 0xf4af, 0xf4b0, 0xf4b1, 0xf4b2, 0xf4b3, 0xf4b4,
+    0xf4b5, 0xf4b6, 0xf4b7, 0xf4b8, 0xf4b9, 0xf4ba, 0xf4bb, 0xf4bc, 0xf4bd, 0xf4be, 0xf4bf, 0xf4c0,
+    0xf4c1, 0xf4c2, 0xf4c3, 0xf4c4, 0xf4c5, 0xf4c6, 0xf4c7, 0xf4c8, 0xf4c9, 0xf4ca, 0xf4cb, 0xf4cc,
+    0xf4cd, 0xf4ce, 0xf4cf, 0xf4d0, 0xf4d1, 0xf4d2, 0xf4d3, 0xf4d4, 0xf4d6, 0xf4d7, 0xf4d8, 0xf4d9,
+    0xf4da, 0xf4db, 0xf4dc, 0xf4dd, 0xf4de, 0xf4df, 0xf4e0, 0xf4e1, 0xf4e2, 0xf4e3, 0xf4fa, 0xf4fb,
+    0xf4fc, 0xf4fd, 0xf4fe, 0xf4ff, 0xf500, 0xf501, 0xf502, 0xf503, 0xf504, 0xf505, 0xf506, 0xf507,
+    0xf508, 0xf509, 0xf515, 0xf516, 0xf517, 0xf518, 0xf519, 0xf51a, 0xf51b, 0xf51c, 0xf51d, 0xf51e,
+    0xf51f, 0xf520, 0xf521, 0xf522, 0xf523, 0xf524, 0xf525, 0xf526, 0xf527, 0xf528, 0xf529, 0xf52a,
+    0xf52b, 0xf52d, 0xf52e, 0xf52f, 0xf530, 0xf532, 0xf533, 0xf534, 0xf535, 0xf537, 0xf538, 0xf539,
+    0xf53a, 0xf53b, 0xf53c, 0xf53d, 0xf53e, 0xf53f, 0xf540, 0xf542, 0xf543, 0xf544, 0xf545, 0xf546,
+    0xf547, 0xf548, 0xf549, 0xf54a, 0xf54b, 0xf54c, 0xf54d, 0xf54e, 0xf54f, 0xf550, 0xf551, 0xf552,
+    0xf553, 0xf554, 0xf555, 0xf556, 0xf557, 0xf558, 0xf559, 0xf55a, 0xf55b, 0xf55c, 0xf55d, 0xf55e,
+    0xf55f, 0xf560, 0xf561, 0xf562, 0xf563, 0xf564, 0xf565, 0xf566, 0xf567, 0xf568, 0xf569, 0xf56a,
+    0xf56b, 0xf56c, 0xf56d, 0xf56e, 0xf56f, 0xf570, 0xf571, 0xf572, 0xf573, 0xf574, 0xf575, 0xf576,
+    0xf577, 0xf578, 0xf579, 0xf57a, 0xf57b, 0xf57c, 0xf57d, 0xf57e, 0xf57f, 0xf580, 0xf581, 0xf582,
+    0xf583, 0xf584, 0xf585, 0xf586, 0xf587, 0xf588, 0xf589, 0xf58a, 0xf58b, 0xf58c, 0xf58d, 0xf58e,
+    0xf58f, 0xf590, 0xf591, 0xf593, 0xf594, 0xf595, 0xf596, 0xf597, 0xf598, 0xf599, 0xf59a, 0xf59b,
+    0xf59c, 0xf59d, 0xf59f, 0xf5a0, 0xf5a1, 0xf5a2, 0xf5a4, 0xf5a5, 0xf5a6, 0xf5a7, 0xf5a9, 0xf5aa,
+    0xf5ab, 0xf5ac, 0xf5ad, 0xf5ae, 0xf5af, 0xf5b0, 0xf5b1, 0xf5b3, 0xf5b4, 0xf5b6, 0xf5b7, 0xf5b8,
+    0xf5b9, 0xf5ba, 0xf5bb, 0xf5bc, 0xf5bd, 0xf5bf, 0xf5c0, 0xf5c1, 0xf5c2, 0xf5c3, 0xf5c4, 0xf5c5,
+    0xf5c7, 0xf5c8, 0xf5c9, 0xf5ca, 0xf5cb, 0xf5cd, 0xf5ce, 0xf5d0, 0xf5d1, 0xf5d2, 0xf5d3, 0xf5d4,
+    0xf5d5, 0xf5d6, 0xf5d7, 0xf5d8, 0xf5d9, 0xf5da, 0xf5db, 0xf5dc, 0xf5dd, 0xf5de, 0xf5df, 0xf5e0,
+    0xf5e1, 0xf5e2, 0xf5e3, 0xf5e4, 0xf5e5, 0xf5e6, 0xf5e7, 0xf5e8, 0xf5e9, 0xf5ea, 0xf5eb, 0xf5ec,
+    0xf5ed, 0xf5ee, 0xf5ef, 0xf5f0, 0xf5f2, 0xf5f3, 0xf5f4, 0xf5f5, 0xf5f6, 0xf5f8, 0xf5f9, 0xf5fb,
+    0xf5fc, 0xf5fd, 0xf5fe, 0xf5ff, 0xf600, 0xf601, 0xf602, 0xf603, 0xf604, 0xf605, 0xf606, 0xf607,
+    0xf608, 0xf609, 0xf60a, 0xf60b, 0xf60c, 0xf60d, 0xf60e, 0xf610, 0xf611, 0xf613, 0xf614, 0xf615,
+    0xf616, 0xf617, 0xf618, 0xf619, 0xf61a, 0xf61b, 0xf61c, 0xf61d, 0xf61e, 0xf61f, 0xf620, 0xf621,
+    0xf622, 0xf623, 0xf624, 0xf625, 0xf626, 0xf627, 0xf628, 0xf629, 0xf62a, 0xf62b, 0xf62c, 0xf62d,
+    0xf62e, 0xf62f, 0xf630, 0xf631, 0xf632, 0xf633, 0xf634, 0xf635, 0xf636, 0xf637, 0xf638, 0xf639,
+    0xf63a, 0xf63b, 0xf63c, 0xf63d, 0xf63e, 0xf640, 0xf641, 0xf643, 0xf644, 0xf645, 0xf646, 0xf647,
+    0xf648, 0xf649, 0xf64a, 0xf64b, 0xf64c, 0xf64d, 0xf64e, 0xf64f, 0xf650, 0xf651, 0xf652, 0xf653,
+    0xf654, 0xf655, 0xf656, 0xf657, 0xf658, 0xf659, 0xf65a, 0xf65b, 0xf65c, 0xf65d, 0xf65e, 0xf65f,
+    0xf660, 0xf661, 0xf662, 0xf663, 0xf664, 0xf665, 0xf666, 0xf667, 0xf668, 0xf669, 0xf66a, 0xf66b,
+    0xf66c, 0xf66d, 0xf66e, 0xf66f, 0xf670, 0xf671, 0xf672, 0xf673, 0xf674, 0xf675, 0xf676, 0xf677,
+    0xf678, 0xf679, 0xf67a, 0xf67b, 0xf67c, 0xf67d, 0xf67e, 0xf67f, 0xf680, 0xf681, 0xf682, 0xf683,
+    0xf684, 0xf685, 0xf686, 0xf687, 0xf688, 0xf689, 0xf68a, 0xf68b, 0xf68c, 0xf68d, 0xf68e, 0xf68f,
+    0xf690, 0xf691, 0xf692, 0xf693, 0xf694, 0xf695, 0xf696, 0xf697, 0xf698, 0xf699, 0xf69a, 0xf69b,
+    0xf69c, 0xf69e, 0xf6a0, 0xf6a1, 0xf6a2, 0xf6a3, 0xf6a4, 0xf6a5, 0xf6a6, 0xf6a7, 0xf6a8, 0xf6a9,
+    0xf6aa, 0xf6ab, 0xf6ac, 0xf6ad, 0xf6ae, 0xf6b0, 0xf6b1, 0xf6b2, 0xf6b3, 0xf6b4, 0xf6b5, 0xf6b6,
+    0xf6b7, 0xf6b8, 0xf6b9, 0xf6ba, 0xf6bb, 0xf6bc, 0xf6bd, 0xf6be, 0xf6bf, 0xf6c0, 0xf6c1, 0xf6c2,
+    0xf6c3, 0xf6c4, 0xf6c5, 0xf6c6, 0xf6c7, 0xf6c8, 0xf6cb, 0xf6cd, 0xf6ce, 0xf6cf, 0xf6d0, 0xf6d1,
+    0xf6d2, 0xf6d3, 0xf6d4, 0xf6d5, 0xf6d6, 0xf6d7, 0xf6d8, 0xf6d9, 0xf6da, 0xf6db, 0xf6dd, 0xf6de,
+    0xf6df, 0xf6e0, 0xf6e1, 0xf6e2, 0xf6e3, 0xf6e4, 0xf6e5, 0xf6e6, 0xf6e7, 0xf6e8, 0xf6e9, 0xf6ea,
+    0xf6eb, 0xf6ec, 0xf6ed, 0xf6ee, 0xf6ef, 0xf6f0, 0xf6f1, 0xf6f2, 0xf6f3, 0xf6f4, 0xf6f5, 0xf6f6,
+    0xf6f7, 0xf6f8, 0xf6f9, 0xf6fa, 0xf6fb, 0xf6fc, 0xf6fd, 0xf6fe, 0xf6ff, 0xf700, 0xf701, 0xf702,
+    0xf703, 0xf705, 0xf706, 0xf707, 0xf708, 0xf709, 0xf70a, 0xf70b, 0xf70c, 0xf70d, 0xf70e, 0xf70f,
+    0xf710, 0xf711, 0xf712, 0xf713, 0xf714, 0xf715, 0xf716, 0xf717, 0xf718, 0xf719, 0xf71a, 0xf71b,
+    0xf71c, 0xf71d, 0xf71e, 0xf71f, 0xf720, 0xf721, 0xf722, 0xf723, 0xf724, 0xf725, 0xf726, 0xf727,
+    0xf728, 0xf729, 0xf72a, 0xf72b, 0xf72c, 0xf72d, 0xf72e, 0xf72f, 0xf732, 0xf733, 0xf734, 0xf735,
+    0xf736, 0xf737, 0xf738, 0xf739, 0xf73a, 0xf73b, 0xf73c, 0xf73d, 0xf73e, 0xf73f, 0xf740, 0xf741,
+    0xf742, 0xf743, 0xf744, 0xf745, 0xf746, 0xf747, 0xf748, 0xf749, 0xf74a, 0xf74b, 0xf74c, 0xf74d,
+    0xf74e, 0xf74f, 0xf750, 0xf751, 0xf752, 0xf753, 0xf754, 0xf755, 0xf756, 0xf757, 0xf758, 0xf759,
+    0xf75a, 0xf75b, 0xf75c, 0xf75e, 0xf75f, 0xf760, 0xf761, 0xf762, 0xf763, 0xf764, 0xf765, 0xf766,
+    0xf767, 0xf768, 0xf769, 0xf76a, 0xf76b, 0xf76c, 0xf76d, 0xf76e, 0xf76f, 0xf770, 0xf771, 0xf772,
+    0xf773, 0xf774, 0xf775, 0xf776, 0xf777, 0xf779, 0xf77c, 0xf77d, 0xf77e, 0xf77f, 0xf780, 0xf781,
+    0xf782, 0xf783, 0xf784, 0xf786, 0xf787, 0xf788, 0xf78a, 0xf78b, 0xf78c, 0xf78e, 0xf78f, 0xf792,
+    0xf793, 0xf794, 0xf795, 0xf796, 0xf79a, 0xf79b, 0xf79c, 0xf79d, 0xf79e, 0xf79f, 0xf7a0, 0xf7a1,
+    0xf7a2, 0xf7a3, 0xf7a4, 0xf7a5, 0xf7a6, 0xf7a7, 0xf7a8, 0xf7a9, 0xf7aa, 0xf7ab, 0xf7ac, 0xf7ad,
+    0xf7ae, 0xf7b2, 0xf7b4, 0xf7b5, 0xf7b6, 0xf7b7, 0xf7b8, 0xf7b9, 0xf7ba, 0xf7bd, 0xf7be, 0xf7bf,
+    0xf7c0, 0xf7c1, 0xf7c2, 0xf7c3, 0xf7c4, 0xf7c5, 0xf7c7, 0xf7c8, 0xf7c9, 0xf7ca, 0xf7cb, 0xf7cc,
+    0xf7cd, 0xf7ce, 0xf7cf, 0xf7d0, 0xf7d1, 0xf7d2, 0xf7d4, 0xf7d5, 0xf7d7, 0xf7d8, 0xf7d9, 0xf7da,
+    0xf7db, 0xf7dc, 0xf7dd, 0xf7de, 0xf7e2, 0xf7e4, 0xf7e5, 0xf7e6, 0xf7e7, 0xf7e8, 0xf7e9, 0xf7ea,
+    0xf7eb, 0xf7ec, 0xf7ed, 0xf7ee, 0xf7ef, 0xf7f0, 0xf7f1, 0xf7f2, 0xf7f3, 0xf7f4, 0xf7f5, 0xf7f6,
+    0xf7f7, 0xf7f8, 0xf7f9, 0xf7fa, 0xf7fb, 0xf7fc, 0xf7fd, 0xf7fe, 0xf7ff, 0xf800, 0xf801, 0xf802,
+    0xf803, 0xf804, 0xf805, 0xf806, 0xf807, 0xf808, 0xf809, 0xf80d, 0xf80e, 0xf80f, 0xf810, 0xf811,
+    0xf812, 0xf813, 0xf814, 0xf815, 0xf816, 0xf817, 0xf818, 0xf819, 0xf81a, 0xf81b, 0xf81c, 0xf81d,
+    0xf81e, 0xf81f, 0xf820, 0xf821, 0xf822, 0xf823, 0xf824, 0xf825, 0xf826, 0xf827, 0xf828, 0xf829,
+    0xf82a, 0xf82b, 0xf82c, 0xf82d, 0xf82e, 0xf82f, 0xf830, 0xf831, 0xf832, 0xf833, 0xf83e, 0xf843,
+    0xf844, 0xf845, 0xf846, 0xf847, 0xf848, 0xf849, 0xf84a, 0xf84b, 0xf84c, 0xf84d, 0xf84e, 0xf84f,
+    0xf850, 0xf851, 0xf852, 0xf853, 0xf854, 0xf855, 0xf856, 0xf857, 0xf858, 0xf859, 0xf85a, 0xf85b,
+    0xf85c, 0xf85d, 0xf85e, 0xf85f, 0xf860, 0xf861, 0xf862, 0xf863, 0xf864, 0xf865, 0xf866, 0xf867,
+    0xf868, 0xf869, 0xf86a, 0xf86b, 0xf86c, 0xf86d, 0xf86e, 0xf86f, 0xf870, 0xf871, 0xf872, 0xf873,
+    0xf874, 0xf875, 0xf876, 0xf877, 0xf878, 0xf879, 0xf87a, 0xf87b, 0xf87c, 0xf87d, 0xf87e, 0xf87f,
+    0xf880, 0xf881, 0xf882, 0xf883, 0xf884, 0xf885, 0xf886, 0xf887, 0xf888, 0xf889, 0xf88a, 0xf88b,
+    0xf88c, 0xf88d, 0xf88e, 0xf88f, 0xf890, 0xf891, 0xf892, 0xf893, 0xf894, 0xf895, 0xf896, 0xf897,
+    0xf898, 0xf899, 0xf89a, 0xf89b, 0xf89c, 0xf89d, 0xf89f, 0xf8a0, 0xf8a1, 0xf8a2, 0xf8a3, 0xf8a4,
+    0xf8a5, 0xf8a7, 0xf8a8, 0xf8a9, 0xf8aa, 0xf8ab, 0xf8ac, 0xf8ad, 0xf8ae, 0xf8af, 0xf8b0, 0xf8b1,
+    0xf8b2, 0xf8b3, 0xf8b4, 0xf8b5, 0xf8b6, 0xf8b7, 0xf8b8, 0xf8b9, 0xf8ba, 0xf8bb, 0xf8bc, 0xf8bd,
+    0xf8be, 0xf8bf, 0xf8c0, 0xf8c1, 0xf8c2, 0xf8c3, 0xf8c4, 0xf8c5, 0xf8c6, 0xf8c7, 0xf8c8, 0xf8c9,
+    0xf8cb, 0xf8cc, 0xf8cd, 0xf8ce, 0xf8cf, 0xf8d0, 0xf8d1, 0xf8d3, 0xf8d4, 0xf8d5, 0xf8d6, 0xf8d7,
+    0xf8d8, 0xf8d9, 0xf8da, 0xf8db, 0xf8dc, 0xf8dd, 0xf8de, 0xf8df, 0xf8e0, 0xf8e2, 0xf8e3, 0xf8e4,
+    0xf8e6, 0xf8e7, 0xf8e9, 0xf8ea, 0xf8eb, 0xf8ec, 0xf8ed, 0xf8ee, 0xf8ef, 0xf8f0, 0xf8f1, 0xf8f2,
+    0xf8f3, 0xf8f4, 0xf8f5, 0xf8f6, 0xf8f7, 0xf8f8, 0xf8f9, 0xf8fa, 0xf8fb, 0xf8fc, 0xf8fd, 0xf8fe,
+    0xf8ff, 0x100e007, 0x100e013, 0x100e01a, 0x100e01e, 0x100e049, 0x100e052, 0x100e055, 0x100e056, 0x100e057, 0x100e077, 0x100e078,
+    0x100e079, 0x100e07a, 0x100e07b, 0x100e07c, 0x100e07d, 0x100e07e, 0x100e07f, 0x100e080, 0x100e081, 0x100e082, 0x100e083, 0x100e084,
+    0x100e087, 0x100e088, 0x100e2d0, 0x100e340, 0x100e360, 0x100e3d9, 0x100e40f, 0x100e43a, 0x100e44a, 0x100e499, 0x100e49b, 0x100e4a0,
+    0x100e530, 0x100e531, 0x100e570, 0x100f081, 0x100f082, 0x100f08c, 0x100f092, 0x100f099, 0x100f09a, 0x100f09b, 0x100f0d2, 0x100f0d3,
+    0x100f0d4, 0x100f0d5, 0x100f0e1, 0x100f113, 0x100f136, 0x100f13b, 0x100f13c, 0x100f15a, 0x100f167, 0x100f168, 0x100f169, 0x100f16b,
+    0x100f16c, 0x100f16d, 0x100f16e, 0x100f170, 0x100f171, 0x100f173, 0x100f174, 0x100f179, 0x100f17a, 0x100f17b, 0x100f17c, 0x100f17d,
+    0x100f17e, 0x100f180, 0x100f181, 0x100f184, 0x100f189, 0x100f18a, 0x100f18b, 0x100f18c, 0x100f18d, 0x100f194, 0x100f198, 0x100f19a,
+    0x100f19b, 0x100f19e, 0x100f1a0, 0x100f1a1, 0x100f1a2, 0x100f1a3, 0x100f1a4, 0x100f1a5, 0x100f1a6, 0x100f1a7, 0x100f1a8, 0x100f1a9,
+    0x100f1aa, 0x100f1b4, 0x100f1b5, 0x100f1b6, 0x100f1b7, 0x100f1bc, 0x100f1bd, 0x100f1be, 0x100f1ca, 0x100f1cb, 0x100f1cc, 0x100f1d0,
+    0x100f1d1, 0x100f1d2, 0x100f1d3, 0x100f1d4, 0x100f1d5, 0x100f1d6, 0x100f1d7, 0x100f1e7, 0x100f1e8, 0x100f1e9, 0x100f1ed, 0x100f1ee,
+    0x100f1f0, 0x100f1f1, 0x100f1f2, 0x100f1f3, 0x100f1f4, 0x100f1f5, 0x100f202, 0x100f203, 0x100f208, 0x100f209, 0x100f20d, 0x100f20e,
+    0x100f210, 0x100f211, 0x100f212, 0x100f213, 0x100f214, 0x100f215, 0x100f216, 0x100f231, 0x100f232, 0x100f237, 0x100f23a, 0x100f23b,
+    0x100f23c, 0x100f23d, 0x100f23e, 0x100f24b, 0x100f24c, 0x100f25e, 0x100f260, 0x100f261, 0x100f263, 0x100f264, 0x100f265, 0x100f266,
+    0x100f267, 0x100f268, 0x100f269, 0x100f26a, 0x100f26b, 0x100f26d, 0x100f26e, 0x100f270, 0x100f27c, 0x100f27d, 0x100f27e, 0x100f280,
+    0x100f281, 0x100f282, 0x100f284, 0x100f285, 0x100f286, 0x100f287, 0x100f288, 0x100f289, 0x100f28a, 0x100f293, 0x100f294, 0x100f296,
+    0x100f297, 0x100f298, 0x100f299, 0x100f2a5, 0x100f2a6, 0x100f2a9, 0x100f2aa, 0x100f2ab, 0x100f2ad, 0x100f2ae, 0x100f2b0, 0x100f2b1,
+    0x100f2b2, 0x100f2b3, 0x100f2b4, 0x100f2b8, 0x100f2c4, 0x100f2c5, 0x100f2c6, 0x100f2d5, 0x100f2d6, 0x100f2d7, 0x100f2d8, 0x100f2d9,
+    0x100f2da, 0x100f2dd, 0x100f2de, 0x100f2e0, 0x100f35c, 0x100f368, 0x100f369, 0x100f36a, 0x100f36b, 0x100f36c, 0x100f36d, 0x100f36e,
+    0x100f36f, 0x100f370, 0x100f371, 0x100f372, 0x100f373, 0x100f374, 0x100f375, 0x100f378, 0x100f379, 0x100f37a, 0x100f37b, 0x100f37c,
+    0x100f37d, 0x100f37f, 0x100f380, 0x100f383, 0x100f384, 0x100f385, 0x100f388, 0x100f38b, 0x100f38c, 0x100f38d, 0x100f38e, 0x100f38f,
+    0x100f391, 0x100f392, 0x100f393, 0x100f394, 0x100f395, 0x100f396, 0x100f397, 0x100f399, 0x100f39a, 0x100f39d, 0x100f39e, 0x100f39f,
+    0x100f3a1, 0x100f3a2, 0x100f3a3, 0x100f3a4, 0x100f3a6, 0x100f3a7, 0x100f3a8, 0x100f3a9, 0x100f3aa, 0x100f3ab, 0x100f3ac, 0x100f3ad,
+    0x100f3ae, 0x100f3af, 0x100f3b0, 0x100f3b1, 0x100f3b2, 0x100f3b4, 0x100f3b5, 0x100f3b6, 0x100f3b7, 0x100f3b8, 0x100f3b9, 0x100f3ba,
+    0x100f3bb, 0x100f3bc, 0x100f3bd, 0x100f3c0, 0x100f3c3, 0x100f3c4, 0x100f3c6, 0x100f3c8, 0x100f3ca, 0x100f3cb, 0x100f3cc, 0x100f3d0,
+    0x100f3d2, 0x100f3d3, 0x100f3d4, 0x100f3d5, 0x100f3d6, 0x100f3d7, 0x100f3d8, 0x100f3d9, 0x100f3da, 0x100f3db, 0x100f3dc, 0x100f3df,
+    0x100f3e1, 0x100f3e2, 0x100f3e3, 0x100f3e4, 0x100f3e6, 0x100f3e7, 0x100f3e8, 0x100f3e9, 0x100f3ea, 0x100f3eb, 0x100f3ec, 0x100f3ee,
+    0x100f3f3, 0x100f3f5, 0x100f3f6, 0x100f3f7, 0x100f3f8, 0x100f3f9, 0x100f402, 0x100f403, 0x100f404, 0x100f405, 0x100f407, 0x100f408,
+    0x100f409, 0x100f40a, 0x100f40b, 0x100f40c, 0x100f40d, 0x100f411, 0x100f412, 0x100f413, 0x100f414, 0x100f415, 0x100f416, 0x100f417,
+    0x100f419, 0x100f41a, 0x100f41b, 0x100f41c, 0x100f41d, 0x100f41e, 0x100f41f, 0x100f420, 0x100f421, 0x100f423, 0x100f425, 0x100f426,
+    0x100f427, 0x100f428, 0x100f429, 0x100f42a, 0x100f42b, 0x100f42c, 0x100f42d, 0x100f42e, 0x100f42f, 0x100f430, 0x100f431, 0x100f44d,
+    0x100f452, 0x100f457, 0x100f459, 0x100f4d5, 0x100f4e4, 0x100f4e5, 0x100f4e7, 0x100f4e8, 0x100f4e9, 0x100f4ea, 0x100f4eb, 0x100f4ec,
+    0x100f4ed, 0x100f4ee, 0x100f4ef, 0x100f4f0, 0x100f4f1, 0x100f4f2, 0x100f4f3, 0x100f4f4, 0x100f4f5, 0x100f4f6, 0x100f4f7, 0x100f4f8,
+    0x100f4f9, 0x100f50a, 0x100f50b, 0x100f50c, 0x100f50d, 0x100f50e, 0x100f50f, 0x100f510, 0x100f511, 0x100f512, 0x100f513, 0x100f514,
+    0x100f592, 0x100f59e, 0x100f5a3, 0x100f5a8, 0x100f5b2, 0x100f5b5, 0x100f5be, 0x100f5c6, 0x100f5cc, 0x100f5cf, 0x100f5f1, 0x100f5f7,
+    0x100f5fa, 0x100f60f, 0x100f612, 0x100f63f, 0x100f642, 0x100f69d, 0x100f6c9, 0x100f6ca, 0x100f6cc, 0x100f6dc, 0x100f730, 0x100f731,
+    0x100f75d, 0x100f77a, 0x100f77b, 0x100f785, 0x100f789, 0x100f78d, 0x100f790, 0x100f791, 0x100f797, 0x100f798, 0x100f799, 0x100f7af,
+    0x100f7b0, 0x100f7b1, 0x100f7b3, 0x100f7bb, 0x100f7bc, 0x100f7c6, 0x100f7d3, 0x100f7d6, 0x100f7df, 0x100f7e0, 0x100f7e1, 0x100f7e3,
+    0x100f834, 0x100f835, 0x100f836, 0x100f837, 0x100f838, 0x100f839, 0x100f83a, 0x100f83b, 0x100f83c, 0x100f83d, 0x100f83f, 0x100f840,
+    0x100f841, 0x100f842, 0x100f89e, 0x100f8a6, 0x100f8ca, 0x100f8d2, 0x100f8e1, 0x100f8e8,
+};
+
+const quint16 faIconNames[] = {
+    1392, 1272, 1956, 1278, 2722, 44, 68, 496, 498, 240, 2883, 1105, 2113, 2724, 3240, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 1101, 3113, 2247, 1385, 1844, 2925, 241,
+    12, 253, 584, 1205, 1335, 1407, 1760, 1869, 2114, 2163, 2175, 2200, 2346, 2561, 2584, 2627,
+    2923, 2931, 3052, 3539, 3816, 3938, 3987, 4079, 4091, 4098, 499, 3239, 502, 14, 493, 2846,
+    495, 3650, 682, 726, 1093, 1104, 1564, 1567, 1568, 1761, 1770, 1771, 1772, 1996, 2072, 2077,
+    2093, 2092, 2096, 2099, 2205, 2206, 2250, 2253, 2254, 2255, 2482, 2624, 2625, 2869, 2870, 2890,
+    2801, 2759, 2936, 2946, 2975, 3019, 3116, 3121, 3119, 3120, 3117, 3229, 3230, 3267, 956, 958,
+    960, 3275, 3276, 3298, 3480, 3481, 3482, 3487, 3488, 3531, 3532, 3534, 3589, 3590, 3592, 3694,
+    3707, 3708, 3709, 3710, 3715, 3817, 3818, 3855, 3906, 3917, 3939, 3940, 4060, 4061, 1095, 1712,
+    1714, 3916, 264, 265, 486, 1904, 1919, 1931, 1950, 1952, 1967, 1968, 1973, 1975, 2071, 2084,
+    2345, 2706, 2865, 2916, 2917, 3159, 3228, 3262, 3499, 3174, 3502, 3666, 3931, 3966, 3969, 3970,
+    3952, 3953, 22, 42, 51, 52, 69, 87, 90, 91, 94, 103, 104, 107, 154, 155,
+    169, 174, 175, 179, 181, 182, 185, 186, 196, 205, 208, 209, 215, 230, 232, 246,
+    247, 248, 250, 279, 303, 306, 315, 326, 332, 346, 347, 371, 385, 391, 392, 393,
+    399, 400, 407, 408, 409, 410, 411, 417, 423, 433, 470, 477, 504, 512, 513, 527,
+    529, 530, 539, 562, 571, 572, 587, 598, 600, 607, 613, 614, 615, 622, 627, 637,
+    640, 641, 712, 716, 717, 724, 728, 746, 747, 748, 749, 753, 761, 762, 764, 765,
+    768, 771, 778, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 838,
+    839, 846, 847, 848, 849, 850, 852, 854, 855, 857, 877, 878, 879, 889, 890, 891,
+    892, 893, 894, 898, 899, 900, 903, 908, 911, 912, 913, 918, 919, 921, 925, 928,
+    929, 934, 936, 938, 944, 945, 949, 954, 955, 962, 966, 967, 968, 970, 973, 974,
+    977, 978, 980, 981, 983, 987, 988, 992, 993, 1000, 1006, 1034, 1035, 1068, 1073, 1078,
+    1084, 1085, 1087, 1090, 1091, 1092, 1102, 1106, 1108, 1109, 1110, 1111, 1113, 1118, 1121, 1122,
+    1128, 1129, 1134, 1139, 1140, 1159, 1174, 1191, 1214, 1218, 1221, 1222, 1228, 1231, 1232, 1234,
+    1235, 1236, 1237, 1238, 1239, 1240, 1262, 1263, 1264, 1266, 1284, 1285, 1296, 1301, 1359, 1362,
+    1372, 1377, 1382, 1387, 1400, 1401, 1574, 1584, 1607, 1626, 1642, 1650, 1651, 1655, 1656, 1657,
+    1658, 1669, 1695, 1697, 1701, 1702, 1703, 1717, 1716, 1718, 1720, 1721, 1722, 1723, 1725, 1727,
+    1731, 1753, 1813, 1820, 1821, 1842, 1843, 1846, 1848, 1849, 1850, 1851, 1862, 1866, 1867, 1868,
+    1884, 1885, 1886, 1887, 1888, 1891, 1906, 1909, 1914, 1921, 1933, 1907, 1972, 1991, 1992, 2006,
+    2018, 2021, 2103, 2062, 2068, 2100, 2102, 2128, 2131, 2134, 2135, 2137, 2139, 2144, 2146, 2155,
+    2156, 2157, 2183, 2184, 2185, 2186, 2190, 2207, 2215, 2221, 2222, 2224, 2259, 2268, 2270, 2272,
+    2273, 2284, 2289, 2290, 2291, 2294, 2295, 2362, 2365, 2389, 2402, 2403, 2405, 2412, 2414, 2416,
+    2418, 2422, 2430, 2436, 2438, 2449, 2450, 2456, 2457, 2466, 2468, 2469, 2470, 2471, 2473, 2483,
+    2494, 2501, 2502, 2508, 2509, 2514, 2515, 2553, 2562, 2568, 2569, 2570, 2571, 2572, 2573, 2574,
+    2576, 2577, 2578, 2581, 2582, 2600, 2601, 2610, 2641, 2644, 2653, 2655, 2675, 2679, 2680, 2683,
+    2686, 2689, 2690, 2691, 2698, 2699, 2704, 2705, 2710, 2711, 2714, 2715, 2719, 2755, 2768, 2776,
+    2777, 2780, 2811, 2812, 2814, 2817, 2822, 2824, 2831, 2834, 2844, 2864, 2866, 2867, 2868, 2875,
+    2921, 2930, 2961, 2963, 2966, 2974, 2983, 2987, 2989, 3023, 3050, 3093, 3097, 3105, 3106, 3107,
+    3108, 3109, 3143, 3150, 3154, 3155, 3156, 3158, 3160, 3179, 3190, 3191, 3216, 3227, 3242, 3245,
+    3290, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3313, 3316, 3317, 3324,
+    3327, 3328, 3329, 3348, 3349, 3350, 3351, 3357, 3358, 3359, 3360, 3361, 3366, 3371, 3376, 3379,
+    3380, 3382, 3386, 3389, 3391, 3392, 3405, 3413, 3418, 3427, 3434, 3435, 3436, 3440, 3443, 3446,
+    3447, 3449, 3450, 3454, 3455, 3463, 3465, 3476, 3477, 3478, 3484, 3514, 3547, 3551, 3552, 3557,
+    3574, 3575, 3576, 3577, 3585, 3607, 3646, 3649, 3651, 3652, 3653, 3664, 3667, 3669, 3685, 3698,
+    3704, 3711, 3712, 3713, 3714, 3723, 3724, 3725, 3726, 3727, 3732, 3733, 3734, 3735, 3736, 3737,
+    3740, 3771, 3777, 3778, 3791, 3795, 3797, 3799, 3821, 3841, 3844, 3857, 3901, 3902, 3909, 3936,
+    3937, 3944, 3945, 3946, 3960, 3961, 3996, 4005, 4008, 4031, 4037, 4047, 4078, 3017, 11, 67,
+    158, 281, 282, 293, 296, 361, 387, 458, 459, 463, 526, 989, 990, 1080, 1268, 1430,
+    1552, 1560, 1561, 1562, 1573, 1673, 1841, 1853, 2196, 2364, 2400, 2401, 2524, 2525, 2614, 2615,
+    2619, 2664, 2665, 2678, 2771, 2845, 2955, 2972, 3020, 3417, 3437, 3503, 3550, 3639, 3644, 3673,
+    3804, 3904, 3905, 4017, 4034, 4035, 272, 364, 365, 366, 367, 438, 662, 668, 670, 675,
+    1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1020, 1021, 1022, 1023, 1024,
+    1025, 1026, 1027, 1028, 1029, 1030, 1031, 1049, 1057, 1061, 1074, 1103, 1192, 1197, 1198, 1270,
+    1271, 1406, 1410, 1411, 1412, 1413, 1418, 1419, 1420, 1422, 1423, 1427, 1428, 1432, 1433, 1434,
+    1441, 1442, 1471, 1473, 1474, 1476, 1477, 1482, 1493, 1494, 1500, 1501, 1502, 1503, 1504, 1505,
+    1506, 1507, 1508, 1509, 1514, 1518, 1519, 1520, 1521, 1526, 1527, 1528, 1531, 1532, 1533, 1534,
+    1537, 1538, 1540, 1543, 1544, 1545, 1548, 1549, 1550, 1551, 1553, 1554, 1555, 1556, 1557, 1558,
+    1616, 1631, 1676, 1709, 1762, 1832, 1836, 1852, 2027, 2063, 2065, 2076, 2087, 2107, 2181, 2201,
+    2202, 2390, 2417, 2535, 2564, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2659, 2843, 2850, 2896,
+    3042, 3166, 3167, 3168, 3222, 3223, 3233, 3234, 3248, 3586, 3767, 3825, 3859, 3877, 123, 138,
+    159, 275, 277, 373, 380, 382, 384, 464, 466, 468, 517, 533, 573, 583, 592, 649,
+    651, 652, 684, 685, 686, 687, 688, 697, 698, 699, 700, 701, 702, 703, 729, 802,
+    821, 946, 1088, 1089, 1097, 1098, 1099, 1165, 1171, 3264, 1196, 1201, 1204, 1207, 1242, 1286,
+    1293, 1303, 1414, 1559, 1691, 1692, 1735, 1773, 1856, 1857, 1874, 1875, 1877, 1957, 2005, 2007,
+    2030, 2036, 2037, 2050, 2110, 2234, 2241, 2251, 2252, 2296, 2329, 2330, 2337, 2554, 2599, 2618,
+    2628, 2629, 2631, 2648, 2649, 2650, 2651, 2652, 2676, 2677, 2720, 2799, 2823, 2838, 2847, 2848,
+    2849, 2851, 2871, 2886, 2892, 2899, 2900, 2901, 2909, 2915, 2919, 3001, 3056, 3059, 3110, 3182,
+    3185, 3294, 3299, 3312, 3414, 3421, 3456, 3578, 3579, 3700, 3703, 3805, 3838, 3849, 3865, 3866,
+    3876, 3878, 3879, 3897, 3898, 3914, 3915, 3918, 3919, 3920, 3935, 3948, 3988, 10, 66, 370,
+    379, 467, 514, 585, 603, 604, 605, 606, 617, 766, 767, 1220, 1223, 1224, 1225, 1229,
+    1230, 1354, 1416, 1417, 1421, 1426, 1429, 1472, 1475, 1499, 1517, 1539, 1746, 2060, 3381, 3385,
+    3524, 3526, 28, 29, 31, 32, 543, 1051, 1062, 1591, 1597, 1752, 1780, 1781, 1782, 2404,
+    2585, 2587, 2588, 2590, 2693, 2956, 2957, 2958, 3173, 3501, 3907, 3967, 3968, 46, 47, 48,
+    49, 102, 110, 111, 131, 139, 142, 173, 176, 180, 187, 206, 207, 212, 226, 227,
+    228, 229, 231, 233, 234, 239, 454, 455, 456, 460, 487, 518, 519, 520, 521, 522,
+    523, 524, 541, 544, 546, 547, 548, 549, 555, 556, 557, 558, 559, 560, 561, 576,
+    671, 677, 689, 818, 819, 926, 1002, 1067, 1148, 1195, 1302, 1376, 1395, 1575, 1592, 1593,
+    1594, 1595, 1596, 1629, 1661, 1675, 1690, 1824, 1825, 1861, 1901, 1922, 1930, 1935, 1936, 1983,
+    1984, 1985, 1986, 1987, 1988, 1998, 2003, 2008, 2013, 2014, 2022, 2023, 2073, 2074, 2075, 2078,
+    2079, 2080, 2081, 2086, 2088, 2089, 2090, 2091, 2101, 2165, 2166, 2170, 2174, 2193, 2208, 2212,
+    2217, 2265, 2316, 2336, 2351, 2352, 2375, 2391, 2394, 2409, 2496, 2510, 2511, 2513, 2538, 2539,
+    2541, 2543, 2544, 2613, 2712, 2713, 2716, 2717, 2718, 2727, 2728, 2734, 2735, 2736, 2739, 2740,
+    2741, 2742, 2743, 2744, 2745, 2754, 2756, 2757, 2758, 2761, 2762, 2765, 2766, 2767, 2772, 2773,
+    2778, 2800, 2805, 2806, 2807, 2808, 2857, 2858, 2859, 2863, 2872, 2873, 2877, 2878, 2879, 2880,
+    2881, 2882, 2945, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3041, 3055, 3084, 3085, 3086, 3087,
+    3088, 3135, 3146, 3149, 3153, 3157, 3390, 3400, 3448, 3459, 3519, 3581, 3582, 3624, 3625, 3626,
+    3627, 3628, 3629, 3671, 3672, 3684, 3686, 3744, 3759, 3763, 3764, 3766, 3772, 3775, 3776, 3784,
+    3837, 3924, 3927, 3929, 3930, 3932, 3955, 3956, 4033, 4075, 4090, 4086, 816, 817, 2885, 2386,
+    2555, 2349, 1982, 3467, 3854, 1646, 3543, 3541, 3548, 772, 4081, 2359, 2357, 2902, 3195, 1806,
+    2056, 1004, 3008, 1306, 2138, 150, 223, 2959, 2328, 1677, 1978, 3981, 3979, 3977, 2924, 298,
+    3570, 3571, 398, 432, 2910, 630, 1736, 388, 2162, 3632, 3636, 39, 37, 40, 38, 2280,
+    2622, 2145, 3958, 2127, 2314, 904, 1315, 2700, 237, 261, 259, 258, 2874, 2669, 3497, 1747,
+    1748, 1750, 1360, 804, 805, 942, 923, 984, 867, 947, 909, 1186, 285, 118, 128, 162,
+    73, 3126, 1393, 1146, 2486, 896, 1814, 2230, 1660, 1396, 1405, 3752, 2855, 610, 3183, 1107,
+    2348, 806, 803, 2988, 714, 1710, 1728, 235, 210, 744, 636, 2179, 1808, 1137, 3471, 132,
+    3642, 188, 140, 3760, 3852, 2246, 2813, 3401, 3828, 1175, 3035, 1954, 563, 730, 1915, 1913,
+    1916, 1912, 840, 842, 844, 836, 1829, 4077, 2282, 1652, 525, 3835, 3923, 2266, 1036, 1685,
+    3089, 1162, 2658, 1693, 3300, 301, 2292, 2286, 3506, 3823, 3540, 3994, 3765, 2503, 690, 693,
+    691, 692, 3545, 3268, 3270, 3272, 1375, 145, 1804, 389, 3231, 3819, 2667, 2256, 129, 1037,
+    1040, 3863, 3494, 3509, 351, 2550, 2038, 3779, 3510, 2168, 349, 3372, 3407, 59, 61, 63,
+    57, 54, 55, 56, 53, 2214, 3560, 2493, 2926, 2928, 3288, 823, 1522, 1437, 1495, 1767,
+    2182, 1678, 3630, 1081, 2981, 2297, 1182, 1082, 2274, 2153, 3523, 3508, 1386, 2920, 2474, 2479,
+    3144, 597, 1662, 3018, 871, 873, 875, 869, 45, 3829, 564, 1363, 1369, 3425, 940, 3645,
+    3387, 160, 156, 3338, 3397, 3325, 3130, 1142, 3330, 3336, 3334, 1389, 3491, 3048, 4092, 3037,
+    4072, 1578, 1613, 80, 167, 112, 201, 74, 163, 3641, 3640, 92, 183, 121, 136, 2752,
+    2725, 3513, 2530, 473, 542, 3332, 885, 4036, 2279, 3186, 3362, 550, 1838, 2213, 1569, 545,
+    815, 2670, 1193, 1194, 2973, 658, 3583, 3742, 1209, 1622, 1637, 1603, 1627, 1608, 1640, 1583,
+    1634, 1598, 2249, 927, 2654, 1018, 1976, 2661, 3243, 3132, 3428, 394, 1757, 3793, 368, 2876,
+    2567, 4044, 594, 359, 3716, 1163, 1397, 2635, 589, 742, 757, 750, 3658, 3659, 363, 577,
+    1033, 3136, 713, 696, 1241, 3162, 3908, 2540, 3504, 1994, 3949, 2373, 2408, 2374, 3705, 3950,
+    2376, 3951, 2377, 2380, 2378, 2566, 1811, 3123, 3903, 3921, 339, 3695, 3696, 327, 337, 330,
+    334, 324, 126, 2115, 2586, 2589, 2579, 1032, 3067, 2054, 2051, 2052, 2047, 1882, 1880, 1918,
+    1908, 1920, 1917, 1911, 3688, 2976, 3810, 621, 618, 625, 602, 2149, 2371, 3224, 2366, 2410,
+    932, 964, 273, 313, 3827, 2809, 245, 2829, 508, 1341, 1926, 1337, 1923, 1403, 1945, 1379,
+    16, 18, 975, 2121, 2122, 3598, 3617, 3602, 3609, 3594, 3178, 321, 2887, 4062, 4063, 4064,
+    3451, 2472, 3256, 4004, 3982, 1741, 2197, 3292, 1743, 3933, 880, 3352, 3024, 3761, 3751, 3719,
+    2015, 2606, 3021, 3498, 3470, 3278, 2993, 3002, 3147, 3102, 3028, 2949, 2964, 2967, 3415, 2893,
+    2011, 2604, 2136, 2702, 2682, 2684, 2598, 2009, 2602, 1299, 2239, 2999, 3842, 2331, 2164, 3377,
+    2140, 2142, 2004, 1870, 1871, 1872, 1590, 1638, 1620, 1625, 1604, 1623, 213, 2395, 1394, 3364,
+    807, 809, 811, 813, 1147, 1079, 996, 3340, 3342, 3344, 3346, 859, 861, 863, 865, 619,
+    612, 266, 267, 2242, 3833, 3314, 3318, 3320, 3322, 105, 124, 143, 197, 177, 134, 119,
+    88, 3839, 2995, 2237, 1294, 1304, 2244, 3004, 3850, 23, 3355, 3383, 3419, 3441, 1291, 2235,
+    2991, 3831, 887, 914, 952, 971, 3847, 3444, 221, 2997, 2977, 217, 2978, 219, 3129, 323,
+    336, 538, 1083, 1086, 1177, 1178, 1216, 1365, 1367, 1648, 1810, 2150, 3802, 3806, 2335, 2333,
+    2304, 2475, 2499, 2490, 2497, 2504, 2828, 2861, 2132, 2979, 3151, 3430, 3246, 3432, 3289, 3564,
+    3558, 3562, 3647, 3745, 3814, 3888, 4057, 4058, 2968, 1297, 3845, 312, 310, 317, 319, 469,
+    471, 491, 779, 780, 781, 783, 784, 785, 787, 788, 790, 791, 793, 794, 796, 797,
+    799, 800, 1179, 1202, 1331, 1576, 1738, 1740, 1833, 1835, 2026, 2028, 2341, 1679, 535, 2935,
+    3188, 3370, 3554, 3623, 3973, 4043, 1889, 294, 2953, 299, 300, 472, 476, 488, 528, 1667,
+    657, 997, 998, 1156, 1157, 2750, 1274, 1281, 1283, 704, 706, 708, 1619, 1635, 2191, 1745,
+    1896, 1937, 901, 2124, 3141, 2583, 2643, 2645, 2842, 2904, 2905, 344, 3078, 3079, 3080, 3773,
+    3768, 3251, 3538, 3561, 3566, 3637, 3954, 3957, 3999, 4000, 4027, 4080, 372, 412, 484, 3367,
+    482, 480, 481, 3438, 478, 2420, 2425, 2444, 2428, 2432, 2440, 2447, 2452, 2454, 2459, 1112,
+    1115, 1125, 1117, 1119, 1123, 1127, 1130, 1131, 1135, 2462, 1155, 1166, 883, 1290, 4068, 1894,
+    1895, 1902, 1905, 1897, 1899, 1934, 1941, 1946, 1939, 1948, 906, 3374, 2082, 2204, 2231, 2339,
+    2660, 2708, 2737, 2748, 2749, 2826, 2841, 2944, 2990, 3031, 3111, 3193, 1535, 3580, 3770, 3789,
+    3787, 3782, 3786, 3962, 3963, 4067, 3890, 3856, 3858, 3860, 3869, 3899, 3872, 3871, 3892, 3893,
+    3895, 3910, 3911, 3912, 3913, 3925, 3069, 3071, 374, 416, 3682, 534, 733, 735, 822, 1100,
+    1141, 1187, 1188, 1245, 1252, 1253, 1254, 1255, 1256, 1257, 1273, 1288, 1289, 1570, 1755, 1774,
+    1826, 1845, 1997, 2152, 2195, 2248, 2406, 2477, 2512, 2506, 2517, 2518, 2575, 2642, 3393, 1226,
+    2947, 3016, 3043, 3044, 3045, 3047, 3083, 3094, 3170, 3235, 291, 3500, 3171, 307, 3507, 3677,
+    3163, 2803, 3992, 1408, 72, 401, 249, 1212, 362, 397, 540, 579, 656, 773, 2384, 352,
+    1160, 1161, 1183, 3567, 1424, 1143, 1323, 1324, 1571, 1599, 1579, 1605, 1609, 1611, 1612, 1628,
+    1630, 1581, 1644, 1645, 1659, 1672, 1435, 1439, 2382, 1344, 1346, 1350, 1443, 1445, 1467, 1447,
+    1449, 1451, 1453, 1455, 1457, 1459, 1461, 1463, 1465, 1469, 1854, 1860, 1979, 1981, 2020, 2043,
+    2046, 2171, 1478, 1480, 1483, 1485, 1487, 1489, 1491, 710, 2367, 2369, 2372, 2398, 1497, 1510,
+    2529, 2536, 2637, 2634, 2666, 2688, 2692, 2696, 2856, 2860, 2903, 1512, 1515, 3942, 3221, 1524,
+    1529, 3266, 3274, 3291, 3295, 3464, 3472, 3512, 1541, 3529, 2797, 4014, 1321, 1546, 3678, 3820,
+    3947, 4026, 4070, 3296, 70, 242, 243, 257, 357, 358, 395, 396, 405, 419, 434, 509,
+    578, 672, 660, 664, 665, 669, 679, 674, 676, 678, 741, 1001, 1145, 1258, 1243, 1275,
+    1308, 1309, 1310, 1336, 1373, 1585, 1775, 1827, 1831, 4018, 2154, 2189, 2216, 2225, 2226, 2228,
+    2278, 2300, 916, 2302, 2344, 2306, 2298, 2312, 2308, 2310, 2319, 2321, 2317, 2323, 2325, 2481,
+    2526, 2609, 2611, 930, 289, 3395, 2694, 2897, 3032, 3033, 3046, 3073, 3074, 3124, 3232, 3475,
+    3490, 3496, 1776, 1783, 1788, 1786, 1790, 1792, 1795, 1800, 1798, 1802, 3587, 3588, 2392, 3654,
+    3655, 3656, 3657, 3679, 3689, 3690, 3691, 3692, 3693, 3781, 3783, 3091, 4007, 13, 2951, 754,
+    65, 268, 269, 403, 565, 566, 581, 586, 595, 752, 759, 991, 2423, 1114, 2464, 1138,
+    1185, 1219, 1371, 1380, 1381, 1587, 1589, 1632, 1633, 1726, 1729, 1732, 1734, 1756, 1653, 1815,
+    1837, 1879, 278, 2158, 2159, 2167, 413, 2176, 2187, 2188, 2203, 2209, 2257, 2258, 2260, 2261,
+    1383, 2399, 2407, 510, 2537, 2616, 2617, 3279, 2674, 2825, 2835, 2854, 2888, 3411, 3409, 2769,
+    1943, 2907, 2913, 421, 2353, 2355, 3181, 3192, 3219, 3210, 3212, 3217, 3198, 3208, 3202, 3204,
+    3206, 3214, 3263, 3422, 3423, 3468, 3474, 3537, 3572, 3638, 3100, 3680, 3826, 769, 3862, 3874,
+    3941, 3964, 3975, 3983, 4051, 4048, 4050, 4097, 15, 33, 1172, 251, 252, 271, 320, 375,
+    425, 427, 457, 647, 648, 650, 655, 725, 727, 731, 732, 995, 1058, 1071, 1199, 1094,
+    1164, 1167, 1206, 1246, 1247, 1248, 1249, 1250, 1251, 1276, 1277, 1307, 1325, 1326, 1330, 1334,
+    1361, 1402, 1600, 1892, 1663, 1686, 1688, 1812, 1876, 1878, 1903, 1953, 1963, 1964, 1965, 1969,
+    1999, 2763, 2024, 2025, 2031, 2033, 2066, 2108, 2180, 2194, 2199, 2232, 2233, 2347, 2363, 2388,
+    2528, 2542, 2545, 2563, 2565, 2621, 2672, 2671, 2681, 2839, 2840, 2918, 2932, 2933, 2943, 3006,
+    2774, 3081, 3098, 3099, 3103, 3134, 3148, 3176, 3237, 3238, 3252, 3285, 3286, 3287, 3457, 3458,
+    3530, 3533, 3661, 3662, 3674, 3675, 3687, 3741, 3750, 3798, 3809, 3824, 3887, 3986, 3993, 3998,
+    4029, 4030, 4053, 4066, 283, 284, 439, 475, 623, 999, 1050, 1054, 1055, 1056, 1059, 1063,
+    1064, 1065, 1066, 1069, 1070, 1072, 1075, 1076, 1077, 1215, 1317, 1356, 2532, 1670, 1681, 1683,
+    1052, 2105, 1319, 2112, 2210, 2467, 2531, 2534, 2733, 2779, 2889, 2891, 2894, 2941, 2942, 2985,
+    3249, 3250, 3255, 3486, 3516, 3517, 3518, 3521, 3522, 3613, 3606, 3615, 3608, 1043, 1045, 1047,
+    3681, 3972, 4087, 774, 4009, 4010, 4012, 4055, 4065, 50, 254, 255, 280, 360, 369, 386,
+    437, 609, 624, 654, 694, 718, 756, 820, 2484, 1210, 1211, 1311, 1332, 1333, 1343, 1388,
+    1671, 3259, 1816, 1817, 737, 739, 4039, 4041, 1352, 1830, 1858, 1859, 1863, 1961, 1962, 1989,
+    2029, 2034, 2117, 2118, 2126, 2262, 2488, 2489, 2548, 2549, 2620, 2937, 950, 2986, 3051, 3061,
+    3062, 3082, 3104, 3177, 3226, 2781, 2783, 2785, 2787, 2789, 2791, 3241, 1132, 2793, 3257, 3258,
+    2795, 3261, 3469, 3495, 3621, 3660, 3095, 3701, 3743, 3747, 3748, 3785, 4076, 1665, 263, 415,
+    431, 435, 506, 503, 515, 516, 575, 763, 776, 777, 569, 2069, 1003, 2434, 1120, 1181,
+    1189, 1190, 287, 1261, 1357, 1358, 1643, 1674, 1704, 1705, 1706, 1730, 1754, 1818, 567, 1910,
+    2000, 1966, 1974, 2041, 2042, 2045, 2116, 2160, 2218, 2361, 2397, 2633, 2721, 2852, 2853, 2898,
+    2911, 3007, 3053, 3054, 3057, 3060, 3063, 3169, 3189, 461, 3489, 3505, 3569, 429, 304, 3717,
+    3721, 3749, 3884, 3883, 3867, 3896, 3928, 3990, 643, 645, 4021, 24, 25, 26, 41, 276,
+    354, 356, 2729, 2731, 440, 441, 446, 447, 448, 449, 450, 452, 442, 451, 531, 532,
+    574, 663, 667, 695, 1096, 3757, 2746, 1312, 1313, 1327, 1328, 1563, 1565, 1617, 1737, 1763,
+    1764, 1819, 1873, 1958, 2032, 2119, 3535, 2178, 2263, 2264, 2522, 2520, 2547, 2552, 2626, 1601,
+    2662, 2820, 2219, 3403, 2832, 3634, 3114, 3115, 3253, 115, 203, 83, 95, 190, 77, 165,
+    108, 100, 199, 194, 85, 98, 171, 192, 3281, 3284, 3520, 3631, 3633, 3738, 3729, 3971,
+    4002, 4020, 4022, 4054, 444, 445, 27, 30, 43, 270, 297, 719, 436, 588, 628, 634,
+    635, 721, 632, 994, 1060, 2442, 1124, 1149, 1154, 1168, 1169, 1260, 1621, 1647, 1684, 1707,
+    1708, 1766, 1768, 1840, 1864, 1865, 1959, 1960, 1971, 2035, 2130, 2172, 2173, 2177, 2223, 2285,
+    2480, 1150, 1152, 2546, 2556, 2558, 2560, 2827, 2836, 2837, 2914, 2938, 2939, 2948, 3034, 3065,
+    3064, 3215, 3236, 3282, 3283, 3755, 3792, 3808, 3813, 3815, 3853, 3861, 3894, 722, 3965, 3989,
+    3991, 4006, 4023, 4024, 3076, 21, 34, 35, 342, 340, 341, 355, 376, 377, 378, 638,
+    681, 4244, 4310, 4363, 4407, 4516, 4199, 4313, 4367, 4450, 4201, 4224, 4285, 4438, 4501, 4517,
+    4167, 4295, 4303, 4099, 4314, 4381, 4397, 4514, 4535, 4549, 4545, 4146, 4171, 4134, 4280, 4411,
+    4455, 4300, 4362, 4391, 4373, 4374, 4443, 4508, 4238, 4343, 4273, 4507, 4235, 4271, 4408, 4410,
+    4289, 4288, 4344, 4272, 4353, 4308, 4194, 4147, 4568, 4558, 4559, 4218, 4475, 4312, 4248, 4104,
+    4136, 4504, 4505, 4120, 4544, 4113, 4346, 4216, 4458, 4259, 4503, 4291, 4532, 4538, 4431, 4393,
+    4474, 4529, 4459, 4551, 4386, 4561, 4283, 4427, 4429, 4487, 4486, 4202, 4209, 4406, 4404, 4219,
+    4327, 4132, 4133, 4478, 4479, 4469, 4206, 4465, 4531, 4172, 4330, 4425, 4228, 4270, 4268, 4297,
+    4496, 4416, 4539, 4461, 4506, 4566, 4396, 4290, 4162, 4159, 4157, 4154, 4160, 4161, 4338, 4339,
+    4318, 4114, 4151, 4175, 4200, 4258, 4340, 4447, 4449, 4452, 4457, 4409, 4540, 4524, 4356, 4560,
+    4388, 4385, 4234, 4158, 4156, 4179, 4266, 4267, 4382, 4383, 4265, 4543, 4439, 4165, 4243, 4387,
+    4316, 4176, 4101, 4110, 4307, 4530, 4139, 4254, 4428, 4223, 4173, 4369, 4256, 4520, 4413, 4366,
+    4444, 4143, 4144, 4275, 4553, 4555, 4229, 4277, 4278, 4525, 4526, 4462, 4464, 4403, 4245, 4567,
+    4499, 4287, 4251, 4345, 4418, 4260, 4494, 4130, 4292, 4232, 4311, 4421, 4446, 4488, 4554, 4359,
+    4471, 4102, 4103, 4105, 4106, 4108, 4112, 4115, 4117, 4118, 4119, 4123, 4125, 4127, 4129, 4135,
+    4137, 4138, 4140, 4141, 4142, 4149, 4163, 4168, 4169, 4170, 4178, 4195, 4196, 4197, 4203, 4204,
+    4210, 4211, 4212, 4213, 4214, 4215, 4217, 4220, 4221, 4230, 4236, 4237, 4247, 4255, 4257, 4261,
+    4274, 4279, 4281, 4282, 4284, 4286, 4293, 4294, 4296, 4298, 4302, 4306, 4309, 4320, 4321, 4324,
+    4326, 4328, 4329, 4333, 4334, 4335, 4337, 4342, 4347, 4348, 4355, 4358, 4364, 4365, 4368, 4370,
+    4371, 4377, 4378, 4379, 4380, 4392, 4394, 4395, 4398, 4399, 4400, 4412, 4414, 4415, 4426, 4556,
+    4432, 4434, 4436, 4437, 4442, 4445, 4448, 4453, 4467, 4477, 4480, 4481, 4485, 4489, 4510, 4512,
+    4515, 4518, 4522, 4523, 4527, 4528, 4533, 4541, 4542, 4552, 4557, 4563, 4564, 4121, 4155, 4250,
+    4376, 4390, 4422, 4126, 4341, 4441, 4534, 4116, 4128, 4227, 4470, 4276, 4304, 4482, 4483, 4484,
+    4509, 4111, 4153, 4231, 4336, 4225, 4569, 4249, 4301, 4402, 4417, 4424, 4322, 4405, 4180, 4181,
+    4182, 4183, 4184, 4185, 4186, 4187, 4188, 4189, 4190, 4191, 4192, 4222, 4332, 4352, 4419, 4433,
+    4493, 4246, 4262, 4263, 4264, 4323, 4350, 4384, 4401, 4454, 4502, 4550, 4305, 4349, 4360, 4375,
+    4435, 4451, 4473, 4498, 4537, 4547, 4226, 4299, 4331, 4351, 4372, 4570, 4109, 4497, 4193, 4198,
+    4205, 4239, 4548, 4500, 4423, 4122, 4124, 4152, 4164, 4174, 4207, 4208, 4240, 4241, 4242, 4315,
+    4317, 4325, 4361, 4420, 4430, 4456, 4466, 4490, 4511, 4519, 4521, 4565, 4107, 4131, 4145, 4148,
+    4166, 4233, 4319, 4440, 4468, 4492, 4536, 4562, 4269, 4476, 4177, 4150, 4354, 4389, 4491, 4513,
+};
+
+const quint8 faIconNameCounts[] = {
+    1, 1, 1, 3, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 2, 1,
+    1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2,
+    1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 1,
+    1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 2, 2, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1,
+    1, 2, 2, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 4, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 3, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 3, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1,
+    2, 1, 2, 2, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 2, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 3, 2, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+    1, 2, 1, 1, 1, 1, 2, 2, 2, 1, 5, 2, 2, 1, 3, 2, 4, 2, 1, 1, 1, 4, 3, 2, 1, 1, 1, 1, 2, 2, 1, 1,
+    1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1,
+    2, 2, 1, 1, 1, 2, 2, 3, 2, 2, 2, 1, 2, 1, 1, 1, 1, 3, 1, 1, 2, 2, 1, 1, 1, 1, 1, 3, 1, 2, 2, 1,
+    1, 1, 1, 1, 2, 2, 1, 2, 2, 2, 1, 1, 2, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 1, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 1, 1, 2, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 2, 1, 2, 2, 3, 1, 1, 1, 2, 1, 1, 1, 1,
+    1, 1, 2, 2, 2, 2, 1, 5, 2, 2, 1, 1, 2, 1, 2, 3, 3, 2, 1, 1, 1, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 1, 2, 2, 2, 2, 1, 2, 1, 2, 2, 2, 2, 1, 2, 2, 2, 2, 3, 2, 2, 1, 2, 2, 2, 3, 3, 2, 5, 4,
+    3, 1, 3, 3, 2, 3, 2, 3, 2, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 1, 2, 2, 1, 1, 2, 2, 5, 2, 1, 1, 1,
+    1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2, 2, 2, 1, 3, 2, 1, 1,
+    1, 3, 1, 1, 1, 1, 3, 2, 3, 2, 2, 2, 1, 1, 1, 1, 1, 5, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1,
+    1, 1, 1, 2, 2, 1, 1, 1, 1, 2, 1, 1, 2, 3, 2, 2, 2, 2, 2, 1, 1, 1, 2, 1, 2, 2, 1, 2, 3, 2, 2, 1,
+    1, 1, 1, 1, 1, 1, 3, 1, 1, 2, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 2, 4, 4, 3, 2, 1, 1,
+    2, 3, 2, 1, 2, 4, 4, 4, 4, 4, 1, 2, 1, 1, 1, 1, 3, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 4, 2, 1, 2,
+    3, 3, 2, 1, 1, 1, 2, 2, 1, 1, 3, 2, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+    2, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2,
+    2, 2, 2, 3, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 1, 2, 1, 2, 4, 2, 2, 1, 2, 2, 1, 1,
+    1, 2, 1, 1, 2, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 1, 2, 2, 1, 2, 1, 1, 1, 3, 2, 3, 1,
+    1, 1, 3, 1, 2, 1, 2, 2, 2, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1, 1, 2, 2, 1, 2, 1, 2, 2, 2, 1, 2, 2, 1,
+    1, 2, 2, 2, 2, 1, 1, 3, 1, 1, 2, 2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 2, 3,
+    2, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 3, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 2, 1, 2, 1,
+    1, 1, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 2,
+    2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1, 2, 2, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 1, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 3, 1, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 2, 2,
+    1, 1, 2, 2, 2, 2, 1, 1, 2, 1, 2, 2, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2,
+    1, 1, 4, 1, 1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 2, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 3, 2, 2, 1, 1,
+    1, 1, 2, 2, 2, 1, 2, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 2, 2, 1,
+    1, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 1, 1, 1, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 1,
+    2, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 4, 3, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 2, 1, 1, 1, 2, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 2, 2, 2, 1, 1, 2, 2, 2, 2, 4, 2, 2, 2,
+    2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 2, 1, 1, 2, 1, 2, 1, 1, 2, 3, 2, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+    2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 2, 2, 1, 1, 3, 2, 1, 2, 2, 2, 1, 1, 1, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 1, 1,
+    2, 1, 1, 1, 2, 1, 2, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2, 1, 1,
+    1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 2, 1, 3, 1, 2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 2, 2, 1, 1,
+    2, 1, 1, 1, 1, 2, 2, 1, 1, 1, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 3, 2, 2, 3, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 2, 3, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1,
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+    1, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+const quint16 faIconPages[512] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 18, 19, 20, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const quint16 faIconPageEntries[] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+    47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 65535, 65535,
+    61, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 62, 63, 64, 65, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    66, 67, 68, 69, 70, 71, 72, 65535, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 65535, 84, 85, 86, 87, 88, 89, 65535, 90, 91, 92, 65535, 93,
+    94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+    126, 127, 128, 129, 130, 131, 132, 133, 134, 65535, 135, 136, 137, 138, 139, 140,
+    141, 142, 65535, 143, 144, 65535, 65535, 65535, 145, 146, 147, 148, 149, 150, 151, 152,
+    153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+    169, 170, 171, 172, 173, 174, 175, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 176, 177, 65535, 65535, 178, 179, 65535, 180, 181, 65535, 182,
+    183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198,
+    199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+    215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+    231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246,
+    247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262,
+    65535, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+    278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293,
+    294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309,
+    310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325,
+    326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+    342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+    358, 65535, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+    373, 374, 375, 65535, 376, 377, 378, 379, 380, 65535, 381, 382, 383, 384, 385, 386,
+    387, 388, 389, 390, 391, 392, 393, 65535, 394, 395, 396, 397, 398, 399, 400, 401,
+    402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+    434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449,
+    450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+    514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+    530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+    546, 547, 548, 549, 550, 551, 552, 65535, 553, 554, 555, 556, 557, 558, 559, 560,
+    561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576,
+    577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 65535, 587, 588, 589, 590, 591,
+    65535, 592, 65535, 65535, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604,
+    605, 606, 607, 608, 609, 65535, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619,
+    620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635,
+    636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651,
+    652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667,
+    668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683,
+    684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699,
+    700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715,
+    716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731,
+    732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747,
+    65535, 748, 749, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 750, 65535, 65535, 751,
+    65535, 752, 65535, 753, 754, 755, 756, 757, 758, 759, 760, 761, 65535, 65535, 65535, 65535,
+    65535, 65535, 762, 65535, 763, 764, 765, 65535, 65535, 65535, 766, 65535, 65535, 65535, 767, 768,
+    769, 770, 771, 772, 773, 65535, 774, 775, 65535, 65535, 65535, 65535, 776, 65535, 65535, 777,
+    778, 779, 780, 781, 65535, 65535, 782, 783, 784, 65535, 785, 786, 787, 65535, 788, 789,
+    65535, 65535, 790, 791, 792, 65535, 65535, 65535, 65535, 793, 794, 795, 65535, 796, 797, 798,
+    799, 800, 65535, 801, 802, 65535, 65535, 803, 804, 805, 806, 807, 808, 809, 810, 811,
+    65535, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826,
+    827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842,
+    65535, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857,
+    858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873,
+    874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889,
+    890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905,
+    906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921,
+    922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937,
+    938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953,
+    954, 955, 956, 957, 958, 959, 960, 961, 962, 65535, 963, 964, 965, 966, 967, 968,
+    969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984,
+    985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000,
+    1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 65535,
+    1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031,
+    1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+    1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 65535, 1058, 1059, 1060, 1061, 1062,
+    1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 65535, 1073, 1074, 1075, 1076, 1077,
+    1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+    1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+    1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125,
+    1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
+    1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 65535, 1151, 65535, 1152, 1153, 1154, 1155,
+    65535, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+    1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
+    1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+    1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,
+    1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+    1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250,
+    1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266,
+    1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282,
+    1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298,
+    65535, 65535, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312,
+    1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+    1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344,
+    1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+    65535, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+    1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+    1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1407, 1408, 1409, 65535, 1410, 1411, 65535, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 65535,
+    1420, 1421, 1422, 1423, 65535, 1424, 65535, 1425, 1426, 1427, 65535, 65535, 1428, 65535, 1429, 65535,
+    65535, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+    1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 65535,
+    65535, 1460, 1461, 1462, 1463, 65535, 65535, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 65535,
+    1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 65535, 65535, 1484, 65535,
+    1485, 1486, 1487, 1488, 1489, 1490, 1491, 65535, 1492, 65535, 1493, 1494, 1495, 1496, 1497, 65535,
+    1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 65535,
+    1513, 65535, 65535, 1514, 1515, 1516, 1517, 65535, 65535, 1518, 65535, 1519, 65535, 1520, 1521, 65535,
+    1522, 1523, 65535, 1524, 1525, 1526, 65535, 65535, 1527, 65535, 65535, 65535, 1528, 1529, 1530, 65535,
+    1531, 1532, 65535, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 65535,
+    1545, 1546, 1547, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 65535,
+    1563, 1564, 65535, 65535, 65535, 65535, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 65535,
+    1574, 65535, 1575, 1576, 65535, 65535, 65535, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 65535,
+    1585, 1586, 1587, 1588, 1589, 65535, 65535, 65535, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 65535,
+    1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 65535, 1605, 1606, 1607, 65535, 1608, 1609, 65535,
+    1610, 1611, 65535, 65535, 65535, 65535, 65535, 65535, 1612, 1613, 1614, 1615, 1616, 65535, 1617, 65535,
+    1618, 1619, 1620, 65535, 1621, 1622, 1623, 1624, 65535, 1625, 65535, 1626, 1627, 1628, 1629, 65535,
+    1630, 1631, 1632, 1633, 1634, 1635, 65535, 1636, 1637, 1638, 1639, 65535, 65535, 1640, 1641, 65535,
+    1642, 1643, 1644, 1645, 1646, 1647, 1648, 65535, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 65535,
+    1656, 1657, 1658, 1659, 1660, 65535, 1661, 1662, 1663, 1664, 65535, 1665, 1666, 1667, 1668, 65535,
+    1669, 1670, 1671, 1672, 1673, 1674, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1675, 1676, 1677, 1678, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1679, 1680, 65535, 1681, 1682, 1683, 1684, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1685, 1686, 1687, 65535, 1688, 65535, 1689, 65535, 1690, 65535, 65535, 1691, 1692, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1693, 1694, 1695, 1696, 65535,
+    1697, 65535, 1698, 1699, 65535, 65535, 65535, 65535, 1700, 1701, 1702, 1703, 65535, 65535, 65535, 65535,
+    1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 65535, 65535, 65535, 1714, 1715, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1716, 65535, 1717, 65535, 1718, 1719, 1720, 65535,
+    1721, 1722, 1723, 1724, 1725, 1726, 1727, 65535, 65535, 65535, 1728, 1729, 1730, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1731, 65535, 1732, 1733, 65535, 1734, 1735, 1736, 1737, 65535,
+    1738, 1739, 65535, 65535, 1740, 1741, 1742, 1743, 65535, 65535, 1744, 1745, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 65535,
+    65535, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 65535, 65535,
+    65535, 65535, 65535, 1767, 1768, 1769, 1770, 65535, 1771, 1772, 65535, 65535, 65535, 65535, 65535, 65535,
+    1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 65535, 65535, 65535, 1783, 1784, 65535,
+    65535, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1798, 65535, 65535, 65535,
+    65535, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 65535, 1806, 1807, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1808, 65535, 1809, 65535, 65535,
+    1810, 1811, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1812, 65535, 65535, 1813, 1814, 65535,
+    1815, 1816, 1817, 1818, 1819, 65535, 65535, 1820, 1821, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1822, 1823, 65535, 65535, 1824, 65535, 1825, 65535, 1826, 65535, 65535,
+    65535, 1827, 1828, 65535, 65535, 65535, 65535, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 65535,
+    1837, 1838, 1839, 1840, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1841, 1842, 65535, 65535, 65535,
+    65535, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 65535,
+    1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 65535,
+    1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 65535, 1899, 1900, 1901, 65535,
+    1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 65535,
+    1917, 1918, 65535, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 65535,
+    1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 65535,
+    1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 65535, 1958, 65535, 65535,
+    1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1967, 1968, 65535, 65535, 65535, 65535, 65535, 65535, 1969, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1970, 1971, 65535, 1972, 1973, 65535, 65535, 65535, 65535, 65535,
+    1974, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1975, 1976, 65535, 65535, 65535,
+    1977, 65535, 65535, 65535, 65535, 1978, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 1979, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1980, 1981,
+    65535, 1982, 1983, 65535, 65535, 1984, 65535, 65535, 65535, 1985, 65535, 65535, 65535, 1986, 1987, 1988,
+    65535, 1989, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1990, 1991, 65535,
+    1992, 65535, 65535, 65535, 65535, 1993, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1994, 65535, 65535,
+    1995, 1996, 1997, 65535, 1998, 65535, 65535, 65535, 65535, 65535, 1999, 2000, 2001, 65535, 65535, 2002,
+    2003, 2004, 65535, 65535, 65535, 65535, 2005, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2006, 2007,
+    2008, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2009, 65535, 2010, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024,
+    2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 65535, 2038, 2039,
+    2040, 2041, 65535, 2042, 2043, 2044, 2045, 65535, 2046, 65535, 2047, 2048, 2049, 2050, 2051, 2052,
+    2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068,
+    2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 65535, 2082, 2083,
+    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099,
+    2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115,
+    2116, 65535, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130,
+    2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146,
+    2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162,
+    2163, 2164, 2165, 2166, 2167, 65535, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177,
+    2178, 2179, 2180, 2181, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2182, 2183, 2184, 2185, 2186, 2187,
+    2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208,
+    2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 65535, 2221, 2222, 2223,
+    2224, 65535, 2225, 2226, 2227, 2228, 65535, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237,
+    2238, 65535, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252,
+    2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268,
+    2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284,
+    2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300,
+    2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316,
+    2317, 2318, 65535, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 65535, 2330,
+    2331, 2332, 2333, 65535, 2334, 2335, 2336, 2337, 65535, 2338, 2339, 2340, 2341, 2342, 2343, 2344,
+    2345, 2346, 65535, 2347, 2348, 65535, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 65535, 2357,
+    2358, 2359, 2360, 2361, 2362, 2363, 65535, 2364, 2365, 2366, 2367, 2368, 65535, 2369, 2370, 65535,
+    2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386,
+    2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402,
+    2403, 65535, 2404, 2405, 2406, 2407, 2408, 65535, 2409, 2410, 65535, 2411, 2412, 2413, 2414, 2415,
+    2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 65535,
+    2431, 2432, 65535, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+    2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461,
+    2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 65535,
+    2477, 2478, 65535, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491,
+    2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507,
+    2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523,
+    2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539,
+    2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555,
+    2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 65535, 2569, 65535,
+    2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 65535,
+    2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600,
+    2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 65535, 65535, 2610, 65535, 2611, 2612, 2613,
+    2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 65535, 2626, 2627, 2628,
+    2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644,
+    2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660,
+    2661, 2662, 2663, 2664, 65535, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675,
+    2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691,
+    2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707,
+    65535, 65535, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+    2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737,
+    2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 65535, 2751, 2752,
+    2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768,
+    2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 65535, 2777, 65535, 65535, 2778, 2779, 2780, 2781,
+    2782, 2783, 2784, 2785, 2786, 65535, 2787, 2788, 2789, 65535, 2790, 2791, 2792, 65535, 2793, 2794,
+    65535, 65535, 2795, 2796, 2797, 2798, 2799, 65535, 65535, 65535, 2800, 2801, 2802, 2803, 2804, 2805,
+    2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 65535,
+    65535, 65535, 2821, 65535, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 65535, 65535, 2829, 2830, 2831,
+    2832, 2833, 2834, 2835, 2836, 2837, 65535, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846,
+    2847, 2848, 2849, 65535, 2850, 2851, 65535, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 65535,
+    65535, 65535, 2860, 65535, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872,
+    2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888,
+    2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 65535, 65535, 65535, 2899, 2900, 2901,
+    2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917,
+    2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933,
+    2934, 2935, 2936, 2937, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2938, 65535,
+    65535, 65535, 65535, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951,
+    2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967,
+    2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
+    2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999,
+    3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015,
+    3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 65535, 3030,
+    3031, 3032, 3033, 3034, 3035, 3036, 65535, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045,
+    3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061,
+    3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 65535, 3072, 3073, 3074, 3075, 3076,
+    3077, 3078, 65535, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091,
+    3092, 65535, 3093, 3094, 3095, 65535, 3096, 3097, 65535, 3098, 3099, 3100, 3101, 3102, 3103, 3104,
+    3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3121, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3122, 65535, 65535, 65535, 65535, 65535, 65535, 3123, 65535, 65535, 65535, 3124, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3125, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3126, 65535, 65535, 3127, 3128, 3129, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138,
+    3139, 3140, 3141, 3142, 3143, 65535, 65535, 3144, 3145, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3146, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3147, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3148, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3149, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3150,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3151, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3152, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3153, 65535, 3154, 65535, 65535, 65535, 65535,
+    3155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3156, 3157, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3158, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3159, 3160, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3161, 65535, 65535, 65535,
+    65535, 65535, 3162, 65535, 65535, 65535, 65535, 65535, 65535, 3163, 3164, 3165, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3166, 3167, 3168, 3169, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3170, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3171, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3172, 65535, 65535, 65535, 65535, 3173, 3174, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3175, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3176, 3177, 3178, 65535, 3179, 3180, 3181, 3182, 65535,
+    3183, 3184, 65535, 3185, 3186, 65535, 65535, 65535, 65535, 3187, 3188, 3189, 3190, 3191, 3192, 65535,
+    3193, 3194, 65535, 65535, 3195, 65535, 65535, 65535, 65535, 3196, 3197, 3198, 3199, 3200, 65535, 65535,
+    65535, 65535, 65535, 65535, 3201, 65535, 65535, 65535, 3202, 65535, 3203, 3204, 65535, 65535, 3205, 65535,
+    3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3217, 3218, 3219, 3220, 65535, 65535, 65535, 65535, 3221, 3222, 3223, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3224, 3225, 3226, 65535, 65535, 65535,
+    3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3235, 3236, 3237, 65535, 65535, 65535, 3238, 3239, 65535,
+    3240, 3241, 3242, 3243, 3244, 3245, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3246, 3247, 65535, 65535, 65535, 65535, 3248, 3249, 65535, 65535, 65535, 3250, 3251, 65535,
+    3252, 3253, 3254, 3255, 3256, 3257, 3258, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3259, 3260, 65535, 65535, 65535, 65535, 3261, 65535, 65535, 3262, 3263, 3264, 3265, 3266, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3267, 3268, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3269, 65535,
+    3270, 3271, 65535, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 65535, 3281, 3282, 65535,
+    3283, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3284, 3285, 3286, 65535,
+    3287, 3288, 3289, 65535, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3297, 3298, 65535, 3299, 3300, 3301, 3302, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 3303, 3304, 65535, 65535, 3305, 3306, 3307, 65535, 3308, 3309, 65535,
+    3310, 3311, 3312, 3313, 3314, 65535, 65535, 65535, 3315, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3316, 3317, 3318, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 3319, 3320, 3321, 3322, 3323, 3324, 65535, 65535, 3325, 3326, 65535,
+    3327, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3328, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336,
+    3337, 3338, 3339, 3340, 3341, 3342, 65535, 65535, 3343, 3344, 3345, 3346, 3347, 3348, 65535, 3349,
+    3350, 65535, 65535, 3351, 3352, 3353, 65535, 65535, 3354, 65535, 65535, 3355, 3356, 3357, 3358, 3359,
+    65535, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 65535, 3367, 3368, 65535, 65535, 3369, 3370, 3371,
+    65535, 3372, 3373, 3374, 3375, 65535, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385,
+    3386, 3387, 3388, 65535, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 65535, 65535,
+    3399, 65535, 65535, 3400, 3401, 65535, 3402, 65535, 3403, 65535, 3404, 3405, 3406, 65535, 65535, 65535,
+    3407, 65535, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 65535, 65535, 3419,
+    65535, 3420, 3421, 3422, 3423, 65535, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 65535, 3431, 65535,
+    65535, 65535, 65535, 3432, 65535, 3433, 3434, 3435, 3436, 3437, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3438, 3439, 3440, 3441, 65535, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 65535, 65535,
+    65535, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 65535, 3456, 3457, 3458, 3459, 3460, 3461, 3462,
+    3463, 3464, 65535, 3465, 65535, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476,
+    3477, 3478, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3479, 65535, 65535,
+    65535, 65535, 3480, 65535, 65535, 65535, 65535, 3481, 65535, 3482, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 3483, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3484, 3485, 65535, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494,
+    3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3505, 3506, 3507, 3508, 3509, 3510,
+    3511, 3512, 3513, 3514, 3515, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3516, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3517, 65535,
+    65535, 65535, 65535, 3518, 65535, 65535, 65535, 65535, 3519, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3520, 65535, 65535, 3521, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3522, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3523, 65535, 65535, 65535, 65535, 65535, 3524, 65535, 65535, 3525,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3526, 65535, 65535, 65535, 65535, 65535, 3527, 65535, 65535, 3528, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3529,
+    65535, 65535, 3530, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3531,
+    65535, 65535, 3532, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3533, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3534, 3535, 65535, 3536, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3537, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3538, 3539, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3540, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3541, 3542, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 3543, 65535, 65535, 65535, 3544, 65535, 65535, 65535, 3545, 65535, 65535,
+    3546, 3547, 65535, 65535, 65535, 65535, 65535, 3548, 3549, 3550, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3551,
+    3552, 3553, 65535, 3554, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3555, 3556, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3557, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3558, 65535, 65535, 3559, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3560,
+    3561, 3562, 65535, 3563, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 65535, 3574,
+    3575, 3576, 3577, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3578, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3579, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3580, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3581, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3582, 65535, 65535, 65535, 65535, 65535, 65535, 3583, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+
+const int faKeywordCount = 2366;
+
+const char faKeywordPool[] =
+    "0\00000\0001\000100\0002\00020\0003\000360\0003d\0004\00042\0005\000500px\0006\0007\0008\0008bit\0009\000"
+    "90\000a\000abacus\000absolute\000accent\000access\000accessible\000accusoft\000acorn\000across\000ad\000"
+    "add\000address\000adjust\000adn\000advanced\000adversal\000aesculapius\000affiliatetheme\000africa\000"
+    "ai\000aid\000air\000airbnb\000airline\000airplay\000alarm\000album\000alert\000algolia\000alicorn\000"
+    "alien\000align\000alipay\000all\000allergies\000alpha\000alt\000amazon\000ambulance\000america\000american\000"
+    "americas\000amex\000amilia\000amount\000amp\000ampersand\000analytics\000anchor\000and\000android\000"
+    "angel\000angellist\000angle\000angles\000angry\000angrycreative\000anguished\000angular\000ankh\000answer\000"
+    "anxious\000apartment\000aperture\000apostrophe\000app\000apper\000apple\000arc\000archive\000archway\000"
+    "area\000arrival\000arrive\000arrow\000arrows\000arts\000artstation\000asc\000asclepius\000asia\000asl\000"
+    "assistive\000asterisk\000astonished\000astromech\000astronaut\000asymmetrik\000at\000atlas\000atlassian\000"
+    "atom\000audible\000audio\000austral\000auto\000automobile\000autoprefixer\000avalanche\000average\000"
+    "avianex\000aviato\000avocado\000award\000awesome\000awn\000aws\000axe\000b\000baby\000back\000backpack\000"
+    "backspace\000backward\000bacon\000bacteria\000bacterium\000badge\000badger\000badminton\000bag\000bagel\000"
+    "bags\000baguette\000bahai\000baht\000balance\000balanced\000balbot\000ball\000balloon\000balloons\000"
+    "ballot\000ban\000banana\000band\000bandage\000bandcamp\000bangladeshi\000banjo\000bank\000bar\000barcode\000"
+    "barn\000barrier\000bars\000baseball\000basket\000basketball\000bat\000bath\000bathtub\000battalion\000"
+    "battery\000battle\000beach\000beam\000bean\000beans\000bear\000bed\000bee\000beer\000behance\000bell\000"
+    "bells\000belt\000bench\000berry\000betamax\000between\000beyond\000bezier\000bible\000bicycle\000big\000"
+    "biking\000bilibili\000bill\000bills\000bimobject\000binary\000binoculars\000biohazard\000bird\000birthday\000"
+    "bishop\000bitbucket\000bitcoin\000bite\000bity\000black\000blackberry\000blackboard\000blank\000blanket\000"
+    "blender\000blind\000blinds\000block\000blog\000blogger\000blowing\000blueberries\000bluetooth\000board\000"
+    "bold\000bolt\000bomb\000bone\000bones\000bong\000book\000bookmark\000books\000boombox\000boot\000booth\000"
+    "bootstrap\000border\000bore\000bot\000bots\000bottle\000bottom\000bound\000bounty\000bow\000bowl\000bowling\000"
+    "box\000boxes\000boxing\000bracket\000brackets\000braille\000brain\000brake\000branch\000brazilian\000"
+    "bread\000break\000breastfeeding\000brick\000bricks\000bridge\000briefcase\000bright\000brightness\000"
+    "bring\000broadcast\000broccoli\000broken\000broom\000browser\000browsers\000brush\000btc\000bubble\000"
+    "bubbles\000bucket\000buffer\000bug\000bugs\000building\000buildings\000bulk\000bullet\000bullhorn\000"
+    "bullseye\000bump\000bunk\000buns\000bureau\000burger\000burn\000burner\000buromobelexperte\000burrito\000"
+    "burst\000bus\000business\000butter\000button\000buy\000buysellads\000by\000c\000cab\000cabin\000cabinet\000"
+    "cable\000cactus\000cake\000calculator\000calendar\000calendars\000camcorder\000camera\000camp\000campfire\000"
+    "campground\000can\000canadian\000cancel\000candle\000candles\000candlestick\000candy\000cane\000canister\000"
+    "cannabis\000canvas\000cap\000capacitor\000capsules\000captioning\000captions\000car\000caravan\000card\000"
+    "cardboard\000cards\000caret\000carriage\000carrot\000carry\000cars\000cart\000case\000cash\000cassette\000"
+    "castle\000cat\000cauldron\000cc\000cctv\000cedi\000ceiling\000cell\000cells\000cent\000center\000centercode\000"
+    "centos\000certificate\000chain\000chair\000chalkboard\000champagne\000charging\000chart\000chat\000check\000"
+    "checkered\000cheers\000cheese\000cheeseburger\000chef\000cherries\000chess\000chest\000chestnut\000chevron\000"
+    "chevrons\000child\000children\000chimney\000chocolate\000chopsticks\000christmas\000chrome\000chromecast\000"
+    "church\000circle\000circuit\000citrus\000city\000clapperboard\000clapping\000clarinet\000class\000classic\000"
+    "claw\000claws\000clinic\000clip\000clipboard\000cloak\000clock\000clone\000close\000closed\000clothes\000"
+    "cloud\000cloudflare\000clouds\000cloudscale\000cloudsmith\000cloudversify\000clover\000club\000cmplid\000"
+    "cny\000coast\000coaster\000cocktail\000coconut\000code\000codepen\000codiepie\000coffee\000coffin\000"
+    "cog\000cogs\000coin\000coins\000collar\000collection\000colon\000column\000columns\000combinator\000combined\000"
+    "comet\000comma\000command\000comment\000commenting\000comments\000commit\000commons\000compact\000compare\000"
+    "compass\000compress\000computer\000concierge\000conditioner\000cone\000confined\000confluence\000confounded\000"
+    "confused\000connectdevelop\000console\000construction\000contact\000container\000contao\000contract\000"
+    "control\000conveyor\000cooked\000cookie\000copy\000copyright\000core\000corn\000corner\000cotton\000couch\000"
+    "cough\000cover\000covered\000covid\000cow\000cowbell\000cowboy\000cpanel\000crab\000crack\000crash\000"
+    "crate\000cream\000creative\000credit\000creemee\000crescent\000cricket\000critical\000croissant\000crop\000"
+    "cross\000crossbones\000crossed\000crosshairs\000crow\000crown\000crutch\000crutches\000cruzeiro\000cry\000"
+    "crystal\000css3\000csv\000cube\000cubes\000cucumber\000cup\000cupcake\000curling\000curly\000cursor\000"
+    "curtain\000curve\000curved\000custard\000cut\000cutlery\000cuttlefish\000d\000d10\000d12\000d20\000d4\000"
+    "d6\000d8\000daffodil\000dagger\000dailymotion\000damage\000damper\000dandy\000dash\000dashboard\000dashcube\000"
+    "dashed\000database\000david\000day\000days\000dead\000deaf\000deafness\000debug\000deciduous\000deck\000"
+    "decorated\000dedent\000deer\000deezer\000definition\000degree\000degrees\000delete\000delicious\000democrat\000"
+    "depart\000departure\000deploy\000deploydog\000desc\000description\000desk\000deskpro\000desktop\000detergent\000"
+    "dev\000deviantart\000dewpoint\000dharmachakra\000dhl\000diagnoses\000diagonal\000diagram\000dial\000diamond\000"
+    "diaspora\000dice\000digg\000digging\000digital\000diners\000diploma\000directional\000directions\000disappointed\000"
+    "disc\000discord\000discourse\000discover\000disease\000disguise\000dish\000disk\000disks\000display\000"
+    "distribute\000ditto\000divide\000dividers\000dizzy\000dna\000do\000dochub\000docker\000doctor\000dog\000"
+    "dollar\000dolls\000dolly\000dolphin\000dome\000donate\000dong\000donut\000door\000dot\000dots\000dotted\000"
+    "double\000doughnut\000dove\000down\000downcast\000download\000draft\000draft2digital\000drafting\000dragon\000"
+    "draw\000dreidel\000dress\000dribbble\000drip\000drive\000drivers\000drizzle\000drone\000drooling\000dropbox\000"
+    "dropdown\000droplet\000dropper\000drowning\000drum\000drumstick\000drupal\000dryer\000duck\000dumbbell\000"
+    "dumpster\000dungeon\000dust\000dyalog\000e\000ear\000earlybirds\000earth\000ebay\000eclipse\000edge\000"
+    "edit\000egg\000eggplant\000eight\000eject\000electric\000elementor\000elephant\000elevator\000eleven\000"
+    "ellipsis\000ello\000ember\000emergency\000empire\000empty\000end\000engine\000engines\000enter\000envelope\000"
+    "envelopes\000envira\000equal\000equals\000eraser\000erlang\000escalator\000ethereum\000ethernet\000etsy\000"
+    "eu\000eur\000euro\000europe\000evernote\000evil\000ews\000excel\000exchange\000exclamation\000exclude\000"
+    "exhaling\000exit\000expand\000expeditedssl\000explode\000exploding\000explorer\000explosion\000export\000"
+    "expressionless\000external\000extinguisher\000eye\000eyebrow\000eyedropper\000eyes\000f\000face\000facebook\000"
+    "fair\000falafel\000falling\000family\000fan\000fancy\000fantasy\000farm\000fast\000fastest\000faucet\000"
+    "fax\000fearful\000feather\000federation\000fedex\000fedora\000feed\000female\000fence\000ferris\000ferry\000"
+    "fi\000field\000fighter\000figma\000file\000files\000filing\000fill\000film\000films\000filter\000filters\000"
+    "fine\000finger\000fingerprint\000fingers\000fins\000fire\000firefox\000fireplace\000firewall\000first\000"
+    "firstdraft\000fish\000fishing\000fist\000fitness\000five\000flag\000flame\000flashlight\000flask\000flat\000"
+    "flatbed\000flatbread\000flickr\000flight\000flip\000flipboard\000flood\000floor\000floppy\000florin\000"
+    "flower\000flushed\000flute\000flux\000fly\000flying\000foam\000fog\000folder\000folders\000fondue\000"
+    "font\000fonticons\000food\000football\000fork\000forklift\000format\000fort\000forumbee\000forward\000"
+    "four\000foursquare\000fragile\000frame\000framework\000franc\000free\000freebsd\000freighter\000french\000"
+    "freshener\000fried\000friends\000fries\000frigid\000frog\000from\000front\000frosty\000frown\000fruit\000"
+    "frying\000fulcrum\000full\000function\000funnel\000futbol\000g\000galactic\000galaxy\000gallery\000game\000"
+    "gamepad\000games\000gantt\000garage\000garlic\000gas\000gate\000gauge\000gave\000gavel\000gbp\000gear\000"
+    "gears\000gem\000genderless\000get\000gg\000ghost\000gif\000gift\000gifts\000gingerbread\000git\000github\000"
+    "gitkraken\000gitlab\000gitter\000glass\000glasses\000glide\000globe\000glove\000go\000goal\000gofore\000"
+    "goggles\000golang\000golf\000good\000goodreads\000google\000gopuram\000graduate\000graduation\000gramophone\000"
+    "grapes\000grate\000gratipay\000grav\000grave\000greater\000green\000grid\000grimace\000grin\000grip\000"
+    "gripfire\000ground\000group\000grunt\000guarani\000guilded\000guitar\000guitars\000gulp\000gun\000h\000"
+    "h1\000h2\000h3\000h4\000h5\000h6\000hacker\000hackerrank\000hail\000hair\000half\000halo\000halved\000"
+    "hamburger\000hammer\000hamsa\000hand\000handcuffs\000handheld\000hands\000handshake\000hanger\000hanging\000"
+    "hangup\000hanukiah\000harassing\000hard\000hash\000hashnode\000hashtag\000hat\000haze\000hd\000hdd\000"
+    "head\000header\000heading\000headphones\000headset\000hearing\000heart\000heartbeat\000hearts\000heat\000"
+    "heavy\000heeled\000height\000helicopter\000helmet\000helper\000helping\000hexagon\000high\000highlighter\000"
+    "highway\000hiking\000hill\000hippo\000hips\000hire\000history\000hive\000hockey\000holder\000holding\000"
+    "hole\000holiday\000holly\000home\000honey\000hood\000hooli\000hoop\000horizontal\000horn\000hornbill\000"
+    "horns\000horse\000hose\000hospital\000hospitals\000hot\000hotdog\000hotel\000hotjar\000hourglass\000house\000"
+    "houzz\000hryvnia\000html5\000hubspot\000humidity\000hundred\000hunt\000hunter\000hurricane\000hushed\000"
+    "hydrant\000hyphen\000i\000ice\000icicles\000icon\000icons\000id\000ideal\000igloo\000ils\000image\000"
+    "images\000imdb\000import\000in\000inbox\000inboxes\000incoming\000indent\000indian\000industry\000infinity\000"
+    "info\000inhaler\000injured\000inner\000innosoft\000input\000inr\000instagram\000instalod\000institution\000"
+    "instrument\000integral\000intercom\000international\000internet\000interpreting\000intersect\000intersection\000"
+    "interstate\000inventory\000invision\000invoice\000io\000ion\000ios\000ioxhost\000iphone\000island\000"
+    "italic\000itch\000itunes\000j\000jack\000jar\000java\000jcb\000jedi\000jenkins\000jet\000jira\000joget\000"
+    "joint\000joomla\000journal\000joystick\000jp\000jpy\000js\000jsfiddle\000jug\000jump\000jumping\000justify\000"
+    "k\000kaaba\000kaggle\000kanban\000kazoo\000kebab\000kerning\000key\000keybase\000keyboard\000keycdn\000"
+    "keyhole\000keynote\000khanda\000kickstarter\000kidneys\000king\000kip\000kiss\000kit\000kitchen\000kite\000"
+    "kiwi\000knife\000knight\000korvue\000krw\000l\000lacrosse\000ladder\000lambda\000lamp\000land\000landmark\000"
+    "landscape\000language\000lantern\000laptop\000laravel\000large\000lari\000laser\000lasso\000lastfm\000"
+    "laugh\000launch\000law\000layer\000layout\000leaf\000leafy\000lean\000leaning\000leanpub\000leashed\000"
+    "leave\000left\000legacy\000legal\000lemon\000less\000lettuce\000level\000lg\000license\000life\000lift\000"
+    "light\000lightbulb\000lightning\000lights\000line\000lines\000link\000linkedin\000linode\000linux\000"
+    "lips\000lira\000list\000listen\000listening\000litecoin\000lizard\000loader\000loading\000loaf\000lobster\000"
+    "location\000lock\000locust\000logo\000lollipop\000lollypop\000long\000loop\000love\000loveseat\000low\000"
+    "lower\000luchador\000luggage\000lungs\000lyft\000lying\000m\000mace\000machine\000magento\000magic\000"
+    "magnet\000magnifying\000mail\000mailbox\000mailchimp\000maki\000makizushi\000male\000man\000manat\000"
+    "mandalorian\000mandolin\000mango\000manhole\000map\000maple\000markdown\000marked\000marker\000marks\000"
+    "mars\000marshmallows\000martial\000martini\000mask\000masks\000mastercard\000mastodon\000mattress\000"
+    "max\000maxcdn\000maximize\000md\000mdb\000meat\000meatball\000mechanic\000med\000medal\000medapps\000"
+    "medical\000medium\000medkit\000medrt\000meetup\000megaphone\000megaport\000meh\000melon\000melting\000"
+    "memo\000memory\000mendeley\000menorah\000mercury\000merge\000message\000messages\000messaging\000messenger\000"
+    "meta\000meteor\000meter\000microblog\000microchip\000microphone\000microscope\000microsoft\000microwave\000"
+    "middle\000military\000mill\000min\000mind\000mine\000minimize\000minus\000mirrors\000missed\000mistletoe\000"
+    "mitten\000mix\000mixcloud\000mixed\000mixer\000mizuni\000mobile\000modern\000modx\000monero\000money\000"
+    "monitor\000monitoring\000monkey\000monocle\000monster\000monument\000moon\000moped\000more\000mortar\000"
+    "mosque\000mosquito\000motorcycle\000mound\000mountain\000mountains\000mouse\000mouth\000move\000movie\000"
+    "moving\000mp3\000muffs\000mug\000mule\000mullet\000multiply\000museum\000mushroom\000music\000mute\000"
+    "n\000naira\000napster\000narwhal\000nauseated\000navicon\000nay\000nc\000nd\000neos\000nested\000nesting\000"
+    "net\000network\000neuter\000news\000newspaper\000next\000nfc\000nfi\000nft\000ngo\000nib\000night\000"
+    "nigiri\000nimblr\000nine\000ninja\000node\000nodes\000none\000noodles\000nordic\000nose\000not\000notch\000"
+    "notdef\000note\000notebook\000notes\000npm\000ns8\000numeric\000nurse\000nutritionix\000o\000oak\000object\000"
+    "objects\000observation\000ocean\000oceania\000octagon\000octopus\000odnoklassniki\000of\000off\000office\000"
+    "oil\000ol\000old\000olive\000om\000omega\000on\000one\000onion\000open\000opencart\000openid\000opera\000"
+    "optin\000option\000orcid\000order\000ornament\000osi\000otter\000out\000outdent\000outer\000outgoing\000"
+    "outlet\000oven\000over\000overflow\000overline\000p\000pack\000packing\000pad\000paddle\000padlet\000"
+    "page\000page4\000pagelines\000pager\000paint\000paintbrush\000palette\000palfed\000pallet\000palm\000"
+    "pan\000pancakes\000panel\000panorama\000pants\000paper\000paperclip\000parachute\000paragraph\000parentheses\000"
+    "parenthesis\000parking\000party\000passport\000pastafarianism\000paste\000patches\000path\000patreon\000"
+    "pause\000paw\000pawn\000pay\000paypal\000pd\000pdf\000peace\000peach\000peaks\000peanut\000peanuts\000"
+    "peapod\000pear\000pedestal\000peeking\000pegasus\000pen\000pencil\000pennant\000pensive\000people\000"
+    "pepper\000perbyte\000percent\000percentage\000perfect\000period\000periscope\000persevering\000person\000"
+    "peseta\000peso\000pestle\000phabricator\000phoenix\000phone\000photo\000php\000pi\000piano\000pickleball\000"
+    "pickup\000picnic\000pie\000piece\000pied\000pig\000piggy\000pile\000pillow\000pills\000pilot\000pin\000"
+    "pinata\000pinball\000pineapple\000ping\000pins\000pinterest\000pipe\000piper\000pivot\000pix\000pizza\000"
+    "place\000plane\000planet\000plant\000plastic\000plate\000play\000player\000playstation\000pleading\000"
+    "plow\000plug\000plus\000pocket\000podcast\000podium\000point\000pointed\000pointer\000pointing\000points\000"
+    "poison\000polaroid\000pole\000police\000poll\000polygon\000pompebled\000pong\000poo\000pool\000poop\000"
+    "popcorn\000popsicle\000portable\000portal\000portrait\000post\000pot\000potato\000potion\000pound\000"
+    "pouting\000power\000powerpoint\000pp\000pray\000praying\000predecessor\000pregnant\000prescription\000"
+    "presentation\000pressure\000pretzel\000previous\000print\000prints\000pro\000procedures\000product\000"
+    "progress\000project\000projector\000prop\000puck\000pull\000pulling\000pulse\000pump\000pumpkin\000pushed\000"
+    "puzzle\000pyramid\000python\000q\000qq\000qrcode\000quarter\000quartered\000quarters\000queen\000question\000"
+    "quidditch\000quinscape\000quora\000quote\000quotes\000quran\000r\000rabbit\000racquet\000radar\000radiation\000"
+    "radio\000rain\000rainbow\000raindrops\000raised\000ram\000ramp\000random\000range\000ranking\000raspberry\000"
+    "rate\000ravelry\000ray\000raygun\000rays\000reaching\000react\000reacteurope\000read\000reader\000readme\000"
+    "real\000rear\000rebel\000receipt\000receiving\000reclined\000record\000rectangle\000rectangles\000recycle\000"
+    "red\000reddit\000redhat\000redo\000reel\000refresh\000refrigerator\000register\000registered\000relaxed\000"
+    "relieved\000remix\000remove\000renren\000reorder\000repeat\000reply\000replyd\000republic\000republican\000"
+    "request\000researchgate\000resolving\000restore\000restroom\000retro\000return\000retweet\000rev\000reverse\000"
+    "rhombus\000ribbon\000rice\000rifle\000right\000ring\000ringed\000rings\000rise\000river\000rmb\000road\000"
+    "robbery\000robot\000rock\000rocket\000rocketchat\000rockrms\000rocks\000rockslide\000rod\000role\000roll\000"
+    "roller\000rolling\000roof\000rook\000root\000rootiable\000rotary\000rotate\000rouble\000round\000route\000"
+    "router\000rows\000rss\000rtl\000rub\000ruble\000rudolph\000rug\000rugby\000rugged\000rule\000ruler\000"
+    "running\000rupee\000rupiah\000rust\000rv\000s\000sa\000sack\000sad\000saddle\000safari\000safety\000sailboat\000"
+    "salad\000salesforce\000salt\000saluting\000sampling\000sandwich\000sankey\000santa\000sass\000satellite\000"
+    "saucer\000sausage\000save\000sax\000saxophone\000scale\000scalpel\000scan\000scanner\000scarecrow\000"
+    "scarf\000scatter\000schlix\000school\000scissors\000scoop\000scoops\000scream\000screen\000screencast\000"
+    "screenpal\000screenshot\000screwdriver\000scribble\000scribd\000scroll\000scrollwheel\000scrubber\000"
+    "scythe\000sd\000seal\000search\000searchengin\000seat\000secret\000section\000security\000seedling\000"
+    "sellcast\000sellsy\000semicolon\000senate\000send\000sensor\000serve\000server\000servicestack\000set\000"
+    "seven\000shaker\000shakespeare\000shapes\000share\000sharp\000shaved\000sheep\000sheet\000shekel\000shelter\000"
+    "shelves\000sheqel\000sheriff\000shield\000ship\000shipping\000shirt\000shirtsinbulk\000shish\000shoe\000"
+    "shooting\000shop\000shopify\000shopping\000shopware\000short\000shortcake\000shovel\000shower\000showers\000"
+    "shredder\000shrimp\000shuffle\000shush\000shutters\000shuttle\000shuttlecock\000sickle\000side\000sidebar\000"
+    "sigma\000sign\000signal\000signature\000signing\000signs\000silo\000sim\000simple\000simplybuilt\000sine\000"
+    "sink\000siren\000sistrix\000sitemap\000sith\000sitrox\000six\000size\000skate\000skating\000skeleton\000"
+    "sketch\000ski\000skiing\000skull\000skyatlas\000skype\000slack\000slanted\000slash\000sledding\000sleeping\000"
+    "sleepy\000sleet\000sleeve\000sleigh\000slice\000slider\000sliders\000slideshare\000slight\000slot\000"
+    "slow\000slowest\000small\000smart\000smile\000smiling\000smirking\000smog\000smoke\000smoking\000sms\000"
+    "snake\000snapchat\000snooze\000snorkel\000snow\000snowboarding\000snowflake\000snowflakes\000snowman\000"
+    "snowmobile\000snowmobiling\000snowplow\000soap\000soccer\000socks\000soda\000soft\000solar\000sort\000"
+    "soundcloud\000soup\000sourcetree\000spa\000space\000spacing\000spade\000spaghetti\000sparkles\000speakap\000"
+    "speaker\000speakers\000spell\000spells\000spider\000spikes\000spin\000spinner\000spiral\000split\000splotch\000"
+    "spock\000spoon\000sportsball\000spotify\000spray\000spreadsheet\000sprinkler\000sprout\000squadron\000"
+    "square\000squares\000squarespace\000squid\000squint\000squirrel\000squirt\000stack\000stacked\000stackpath\000"
+    "staff\000staggered\000stairs\000stamp\000stand\000standard\000star\000starfighter\000stars\000starship\000"
+    "start\000station\000staylinked\000steak\000steam\000steelpan\000steering\000step\000sterling\000stethoscope\000"
+    "stick\000sticker\000sticks\000sticky\000stocking\000stomach\000stone\000stop\000stopwatch\000storage\000"
+    "store\000storm\000strava\000straw\000strawberry\000stream\000street\000stretcher\000strikethrough\000"
+    "stripe\000stroke\000strong\000stroopwafel\000studiovinari\000stuffed\000stumbleupon\000style\000subscript\000"
+    "subtask\000subtract\000subway\000successor\000suitcase\000sun\000sunglasses\000sunrise\000sunset\000superpowers\000"
+    "superscript\000supple\000surprise\000suse\000sushi\000suspension\000swallowtail\000swatchbook\000swear\000"
+    "sweat\000swift\000swimmer\000swimming\000swirl\000swiss\000switch\000swoosh\000sword\000swords\000symbol\000"
+    "symbols\000symfony\000synagogue\000sync\000syringe\000system\000systems\000t\000table\000tablet\000tablets\000"
+    "tachograph\000tachometer\000tack\000taco\000tag\000tags\000tail\000taka\000talkie\000tally\000tamale\000"
+    "tanakh\000tank\000tape\000taped\000tarp\000tasks\000taxi\000tea\000teacher\000teamspeak\000tear\000tears\000"
+    "teddy\000tee\000teeth\000telegram\000telescope\000teletype\000television\000temp\000temperature\000ten\000"
+    "tencent\000tenge\000tennis\000tent\000tents\000terminal\000text\000th\000than\000the\000theater\000themeco\000"
+    "themeisle\000thermometer\000theta\000think\000thinking\000third\000thirty\000this\000thought\000three\000"
+    "through\000thumb\000thumbnails\000thumbs\000thumbtack\000thunderstorm\000tick\000ticket\000tickets\000"
+    "tie\000tiktok\000tilde\000tilt\000time\000timed\000timeline\000timer\000times\000tint\000tire\000tired\000"
+    "tissue\000to\000toggle\000togo\000toilet\000toilets\000tomato\000tombstone\000tongue\000toolbox\000tools\000"
+    "tooth\000toothbrush\000top\000torah\000torii\000tornado\000touchscreen\000tow\000tower\000track\000tractor\000"
+    "trade\000trademark\000traffic\000trailer\000train\000tram\000transfer\000transformer\000transgender\000"
+    "transporter\000trash\000treasure\000tree\000trees\000trello\000trend\000trian\000triangle\000trillium\000"
+    "trophy\000tropical\000trowel\000truck\000trumpet\000try\000tshirt\000tsunami\000tty\000tub\000tugrik\000"
+    "tulip\000tumblr\000tuner\000tunnel\000turbine\000turkey\000turkish\000turn\000turntable\000turret\000"
+    "turtle\000tv\000twelve\000twin\000twitch\000twitter\000two\000typewriter\000typo3\000u\000uber\000ubuntu\000"
+    "ufo\000uikit\000ul\000umbraco\000umbrella\000un\000unamused\000unbalanced\000uncharted\000under\000underline\000"
+    "undo\000ungroup\000unicorn\000uniform\000union\000uniregistry\000unity\000universal\000university\000"
+    "unlink\000unlock\000unsorted\000unsplash\000untappd\000up\000upload\000ups\000upside\000usa\000usb\000"
+    "usd\000user\000users\000usps\000ussunnah\000utensil\000utensils\000utility\000v\000vaadin\000vacuum\000"
+    "value\000valve\000van\000vault\000vcard\000vector\000venn\000vent\000ventilator\000venus\000vertical\000"
+    "vest\000vhs\000viacoin\000viadeo\000vial\000vials\000viber\000video\000view\000viewfinder\000vihara\000"
+    "vimeo\000vine\000vinyl\000violin\000virus\000viruses\000visa\000vision\000visor\000vk\000vneck\000vnv\000"
+    "voicemail\000volcano\000volleyball\000volume\000vomit\000vote\000vr\000vuejs\000w\000waffle\000wagon\000"
+    "walker\000walkie\000walking\000wall\000wallet\000wand\000war\000warehouse\000warning\000wash\000washer\000"
+    "washing\000watch\000watchman\000water\000waterfall\000watermelon\000wave\000waveform\000way\000waze\000"
+    "weak\000weary\000web\000webcam\000wedding\000weebly\000week\000weibo\000weight\000weixin\000well\000whale\000"
+    "whatsapp\000wheat\000wheel\000wheelchair\000whills\000whiskey\000whistle\000whmcs\000whole\000wide\000"
+    "widow\000width\000wifi\000wikipedia\000wilt\000wind\000window\000windows\000windsock\000wine\000wink\000"
+    "winter\000wired\000wirsindhandwerk\000witch\000with\000wix\000wizard\000wizards\000wodu\000wolf\000won\000"
+    "woozy\000word\000wordpress\000worm\000worried\000worship\000wpbeginner\000wpexplorer\000wpforms\000wpressr\000"
+    "wreath\000wrench\000wsh\000x\000xbox\000xing\000xmark\000xmarks\000y\000yahoo\000yammer\000yandex\000"
+    "yang\000yarn\000yawn\000yea\000yelp\000yen\000yeti\000yin\000yoast\000youtube\000z\000zany\000zap\000"
+    "zero\000zhihu\000zipper\000zzz\000";
+
+const quint32 faKeywordOffsets[] = {
+    0, 2, 5, 7, 11, 13, 16, 18, 22, 25, 27, 30,
+    32, 38, 40, 42, 44, 49, 51, 54, 56, 63, 72, 79,
+    86, 97, 106, 112, 119, 122, 126, 134, 141, 145, 154, 163,
+    175, 190, 197, 200, 204, 208, 215, 223, 231, 237, 243, 249,
+    257, 265, 271, 277, 284, 288, 298, 304, 308, 315, 325, 333,
+    342, 351, 356, 363, 370, 374, 384, 394, 401, 405, 413, 419,
+    429, 435, 442, 448, 462, 472, 480, 485, 492, 500, 510, 519,
+    530, 534, 540, 546, 550, 558, 566, 571, 579, 586, 592, 599,
+    604, 615, 619, 629, 634, 638, 648, 657, 668, 678, 688, 699,
+    702, 708, 718, 723, 731, 737, 745, 750, 761, 774, 784, 792,
+    800, 807, 815, 821, 829, 833, 837, 841, 843, 848, 853, 862,
+    872, 881, 887, 896, 906, 912, 919, 929, 933, 939, 944, 953,
+    959, 964, 972, 981, 988, 993, 1001, 1010, 1017, 1021, 1028, 1033,
+    1041, 1050, 1062, 1068, 1073, 1077, 1085, 1090, 1098, 1103, 1112, 1119,
+    1130, 1134, 1139, 1147, 1157, 1165, 1172, 1178, 1183, 1188, 1194, 1199,
+    1203, 1207, 1212, 1220, 1225, 1231, 1236, 1242, 1248, 1256, 1264, 1271,
+    1278, 1284, 1292, 1296, 1303, 1312, 1317, 1323, 1333, 1340, 1351, 1361,
+    1366, 1375, 1382, 1392, 1400, 1405, 1410, 1416, 1427, 1438, 1444, 1452,
+    1460, 1466, 1473, 1479, 1484, 1492, 1500, 1512, 1522, 1528, 1533, 1538,
+    1543, 1548, 1554, 1559, 1564, 1573, 1579, 1587, 1592, 1598, 1608, 1615,
+    1620, 1624, 1629, 1636, 1643, 1649, 1656, 1660, 1665, 1673, 1677, 1683,
+    1690, 1698, 1707, 1715, 1721, 1727, 1734, 1744, 1750, 1756, 1770, 1776,
+    1783, 1790, 1800, 1807, 1818, 1824, 1834, 1843, 1850, 1856, 1864, 1873,
+    1879, 1883, 1890, 1898, 1905, 1912, 1916, 1921, 1930, 1940, 1945, 1952,
+    1961, 1970, 1975, 1980, 1985, 1992, 1999, 2004, 2011, 2028, 2036, 2042,
+    2046, 2055, 2062, 2069, 2073, 2084, 2087, 2089, 2093, 2099, 2107, 2113,
+    2120, 2125, 2136, 2145, 2155, 2165, 2172, 2177, 2186, 2197, 2201, 2210,
+    2217, 2224, 2232, 2244, 2250, 2255, 2264, 2273, 2280, 2284, 2294, 2303,
+    2314, 2323, 2327, 2335, 2340, 2350, 2356, 2362, 2371, 2378, 2384, 2389,
+    2394, 2399, 2404, 2413, 2420, 2424, 2433, 2436, 2441, 2446, 2454, 2459,
+    2465, 2470, 2477, 2488, 2495, 2507, 2513, 2519, 2530, 2540, 2549, 2555,
+    2560, 2566, 2576, 2583, 2590, 2603, 2608, 2617, 2623, 2629, 2638, 2646,
+    2655, 2661, 2670, 2678, 2688, 2699, 2709, 2716, 2727, 2734, 2741, 2749,
+    2756, 2761, 2774, 2783, 2792, 2798, 2806, 2811, 2817, 2824, 2829, 2839,
+    2845, 2851, 2857, 2863, 2870, 2878, 2884, 2895, 2902, 2913, 2924, 2937,
+    2944, 2949, 2956, 2960, 2966, 2974, 2983, 2991, 2996, 3004, 3013, 3020,
+    3027, 3031, 3036, 3041, 3047, 3054, 3065, 3071, 3078, 3086, 3097, 3106,
+    3112, 3118, 3126, 3134, 3145, 3154, 3161, 3169, 3177, 3185, 3193, 3202,
+    3211, 3221, 3233, 3238, 3247, 3258, 3269, 3278, 3293, 3301, 3314, 3322,
+    3332, 3339, 3348, 3356, 3365, 3372, 3379, 3384, 3394, 3399, 3404, 3411,
+    3418, 3424, 3430, 3436, 3444, 3450, 3454, 3462, 3469, 3476, 3481, 3487,
+    3493, 3499, 3505, 3514, 3521, 3529, 3538, 3546, 3555, 3565, 3570, 3576,
+    3587, 3595, 3606, 3611, 3617, 3624, 3633, 3642, 3646, 3654, 3659, 3663,
+    3668, 3674, 3683, 3687, 3695, 3703, 3709, 3716, 3724, 3730, 3737, 3745,
+    3749, 3757, 3768, 3770, 3774, 3778, 3782, 3785, 3788, 3791, 3800, 3807,
+    3819, 3826, 3833, 3839, 3844, 3854, 3863, 3870, 3879, 3885, 3889, 3894,
+    3899, 3904, 3913, 3919, 3929, 3934, 3944, 3951, 3956, 3963, 3974, 3981,
+    3989, 3996, 4006, 4015, 4022, 4032, 4039, 4049, 4054, 4066, 4071, 4079,
+    4087, 4097, 4101, 4112, 4121, 4134, 4138, 4148, 4157, 4165, 4170, 4178,
+    4187, 4192, 4197, 4205, 4213, 4220, 4228, 4240, 4251, 4264, 4269, 4277,
+    4287, 4296, 4304, 4313, 4318, 4323, 4329, 4337, 4348, 4354, 4361, 4370,
+    4376, 4380, 4383, 4390, 4397, 4404, 4408, 4415, 4421, 4427, 4435, 4440,
+    4447, 4452, 4458, 4463, 4467, 4472, 4479, 4486, 4495, 4500, 4505, 4514,
+    4523, 4529, 4543, 4552, 4559, 4564, 4572, 4578, 4587, 4592, 4598, 4606,
+    4614, 4620, 4629, 4637, 4646, 4654, 4662, 4671, 4676, 4686, 4693, 4699,
+    4704, 4713, 4722, 4730, 4735, 4742, 4744, 4748, 4759, 4765, 4770, 4778,
+    4783, 4788, 4792, 4801, 4807, 4813, 4822, 4832, 4841, 4850, 4857, 4866,
+    4871, 4877, 4887, 4894, 4900, 4904, 4911, 4919, 4925, 4934, 4944, 4951,
+    4957, 4964, 4971, 4978, 4988, 4997, 5006, 5011, 5014, 5018, 5023, 5030,
+    5039, 5044, 5048, 5054, 5063, 5075, 5083, 5092, 5097, 5104, 5117, 5125,
+    5135, 5144, 5154, 5161, 5176, 5185, 5198, 5202, 5210, 5221, 5226, 5228,
+    5233, 5242, 5247, 5255, 5263, 5270, 5274, 5280, 5288, 5293, 5298, 5306,
+    5313, 5317, 5325, 5333, 5344, 5350, 5357, 5362, 5369, 5375, 5382, 5388,
+    5391, 5397, 5405, 5411, 5416, 5422, 5429, 5434, 5439, 5445, 5452, 5460,
+    5465, 5472, 5484, 5492, 5497, 5502, 5510, 5520, 5529, 5535, 5546, 5551,
+    5559, 5564, 5572, 5577, 5582, 5588, 5599, 5605, 5610, 5618, 5628, 5635,
+    5642, 5647, 5657, 5663, 5669, 5676, 5683, 5690, 5698, 5704, 5709, 5713,
+    5720, 5725, 5729, 5736, 5744, 5751, 5756, 5766, 5771, 5780, 5785, 5794,
+    5801, 5806, 5815, 5823, 5828, 5839, 5847, 5853, 5863, 5869, 5874, 5882,
+    5892, 5899, 5909, 5915, 5923, 5929, 5936, 5941, 5946, 5952, 5959, 5965,
+    5971, 5978, 5986, 5991, 6000, 6007, 6014, 6016, 6025, 6032, 6040, 6045,
+    6053, 6059, 6065, 6072, 6079, 6083, 6088, 6094, 6099, 6105, 6109, 6114,
+    6120, 6124, 6135, 6139, 6142, 6148, 6152, 6157, 6163, 6175, 6179, 6186,
+    6196, 6203, 6210, 6216, 6224, 6230, 6236, 6242, 6245, 6250, 6257, 6265,
+    6272, 6277, 6282, 6292, 6299, 6307, 6316, 6327, 6338, 6345, 6351, 6360,
+    6365, 6371, 6379, 6385, 6390, 6398, 6403, 6408, 6417, 6424, 6430, 6436,
+    6444, 6452, 6459, 6467, 6472, 6476, 6478, 6481, 6484, 6487, 6490, 6493,
+    6496, 6503, 6514, 6519, 6524, 6529, 6534, 6541, 6551, 6558, 6564, 6569,
+    6579, 6588, 6594, 6604, 6611, 6619, 6626, 6635, 6645, 6650, 6655, 6664,
+    6672, 6676, 6681, 6684, 6688, 6693, 6700, 6708, 6719, 6727, 6735, 6741,
+    6751, 6758, 6763, 6769, 6776, 6783, 6794, 6801, 6808, 6816, 6824, 6829,
+    6841, 6849, 6856, 6861, 6867, 6872, 6877, 6885, 6890, 6897, 6904, 6912,
+    6917, 6925, 6931, 6936, 6942, 6947, 6953, 6958, 6969, 6974, 6983, 6989,
+    6995, 7000, 7009, 7019, 7023, 7030, 7036, 7043, 7053, 7059, 7065, 7073,
+    7079, 7087, 7096, 7104, 7109, 7116, 7126, 7133, 7141, 7148, 7150, 7154,
+    7162, 7167, 7173, 7176, 7182, 7188, 7192, 7198, 7205, 7210, 7217, 7220,
+    7226, 7234, 7243, 7250, 7257, 7266, 7275, 7280, 7288, 7296, 7302, 7311,
+    7317, 7321, 7331, 7340, 7352, 7363, 7372, 7381, 7395, 7404, 7417, 7427,
+    7440, 7451, 7461, 7470, 7478, 7481, 7485, 7489, 7497, 7504, 7511, 7518,
+    7523, 7530, 7532, 7537, 7541, 7546, 7550, 7555, 7563, 7567, 7572, 7578,
+    7584, 7591, 7599, 7608, 7611, 7615, 7618, 7627, 7631, 7636, 7644, 7652,
+    7654, 7660, 7667, 7674, 7680, 7686, 7694, 7698, 7706, 7715, 7722, 7730,
+    7738, 7745, 7757, 7765, 7770, 7774, 7779, 7783, 7791, 7796, 7801, 7807,
+    7814, 7821, 7825, 7827, 7836, 7843, 7850, 7855, 7860, 7869, 7879, 7888,
+    7896, 7903, 7911, 7917, 7922, 7928, 7934, 7941, 7947, 7954, 7958, 7964,
+    7971, 7976, 7982, 7987, 7995, 8003, 8011, 8017, 8022, 8029, 8035, 8041,
+    8046, 8054, 8060, 8063, 8071, 8076, 8081, 8087, 8097, 8107, 8114, 8119,
+    8125, 8130, 8139, 8146, 8152, 8157, 8162, 8167, 8174, 8184, 8193, 8200,
+    8207, 8215, 8220, 8228, 8237, 8242, 8249, 8254, 8263, 8272, 8277, 8282,
+    8287, 8296, 8300, 8306, 8315, 8323, 8329, 8334, 8340, 8342, 8347, 8355,
+    8363, 8369, 8376, 8387, 8392, 8400, 8410, 8415, 8425, 8430, 8434, 8440,
+    8452, 8461, 8467, 8475, 8479, 8485, 8494, 8501, 8508, 8514, 8519, 8532,
+    8540, 8548, 8553, 8559, 8570, 8579, 8588, 8592, 8599, 8608, 8611, 8615,
+    8620, 8629, 8638, 8642, 8648, 8656, 8664, 8671, 8678, 8684, 8691, 8701,
+    8710, 8714, 8720, 8728, 8733, 8740, 8749, 8757, 8765, 8771, 8779, 8788,
+    8798, 8808, 8813, 8820, 8826, 8836, 8846, 8857, 8868, 8878, 8888, 8895,
+    8904, 8909, 8913, 8918, 8923, 8932, 8938, 8946, 8953, 8963, 8970, 8974,
+    8983, 8989, 8995, 9002, 9009, 9016, 9021, 9028, 9034, 9042, 9053, 9060,
+    9068, 9076, 9085, 9090, 9096, 9101, 9108, 9115, 9124, 9135, 9141, 9150,
+    9160, 9166, 9172, 9177, 9183, 9190, 9194, 9200, 9204, 9209, 9216, 9225,
+    9232, 9241, 9247, 9252, 9254, 9260, 9268, 9276, 9286, 9294, 9298, 9301,
+    9304, 9309, 9316, 9324, 9328, 9336, 9343, 9348, 9358, 9363, 9367, 9371,
+    9375, 9379, 9383, 9389, 9396, 9403, 9408, 9414, 9419, 9425, 9430, 9438,
+    9445, 9450, 9454, 9460, 9467, 9472, 9481, 9487, 9491, 9495, 9503, 9509,
+    9521, 9523, 9527, 9534, 9542, 9554, 9560, 9568, 9576, 9584, 9598, 9601,
+    9605, 9612, 9616, 9619, 9623, 9629, 9632, 9638, 9641, 9645, 9651, 9656,
+    9665, 9672, 9678, 9684, 9691, 9697, 9703, 9712, 9716, 9722, 9726, 9734,
+    9740, 9749, 9756, 9761, 9766, 9775, 9784, 9786, 9791, 9799, 9803, 9810,
+    9817, 9822, 9828, 9838, 9844, 9850, 9861, 9869, 9876, 9883, 9888, 9892,
+    9901, 9907, 9916, 9922, 9928, 9938, 9948, 9958, 9970, 9982, 9990, 9996,
+    10005, 10020, 10026, 10034, 10039, 10047, 10053, 10057, 10062, 10066, 10073, 10076,
+    10080, 10086, 10092, 10098, 10105, 10113, 10120, 10125, 10134, 10142, 10150, 10154,
+    10161, 10169, 10177, 10184, 10191, 10199, 10207, 10218, 10226, 10233, 10243, 10255,
+    10262, 10269, 10274, 10281, 10293, 10301, 10307, 10313, 10317, 10320, 10326, 10337,
+    10344, 10351, 10355, 10361, 10366, 10370, 10376, 10381, 10388, 10394, 10400, 10404,
+    10411, 10419, 10429, 10434, 10439, 10449, 10454, 10460, 10466, 10470, 10476, 10482,
+    10488, 10495, 10501, 10509, 10515, 10520, 10527, 10539, 10548, 10553, 10558, 10563,
+    10570, 10578, 10585, 10591, 10599, 10607, 10616, 10623, 10630, 10639, 10644, 10651,
+    10656, 10664, 10674, 10679, 10683, 10688, 10693, 10701, 10710, 10719, 10726, 10735,
+    10740, 10744, 10751, 10758, 10764, 10772, 10778, 10789, 10792, 10797, 10805, 10817,
+    10826, 10839, 10852, 10861, 10869, 10878, 10884, 10891, 10895, 10906, 10914, 10923,
+    10931, 10941, 10946, 10951, 10956, 10964, 10970, 10975, 10983, 10990, 10997, 11005,
+    11012, 11014, 11017, 11024, 11032, 11042, 11051, 11057, 11066, 11076, 11086, 11092,
+    11098, 11105, 11111, 11113, 11120, 11128, 11134, 11144, 11150, 11155, 11163, 11173,
+    11180, 11184, 11189, 11196, 11202, 11210, 11220, 11225, 11233, 11237, 11244, 11249,
+    11258, 11264, 11276, 11281, 11288, 11295, 11300, 11305, 11311, 11319, 11329, 11338,
+    11345, 11355, 11366, 11374, 11378, 11385, 11392, 11397, 11402, 11410, 11423, 11432,
+    11443, 11451, 11460, 11466, 11473, 11480, 11488, 11495, 11501, 11508, 11517, 11528,
+    11536, 11549, 11559, 11567, 11576, 11582, 11589, 11597, 11601, 11609, 11617, 11624,
+    11629, 11635, 11641, 11646, 11653, 11659, 11664, 11670, 11674, 11679, 11687, 11693,
+    11698, 11705, 11716, 11724, 11730, 11740, 11744, 11749, 11754, 11761, 11769, 11774,
+    11779, 11784, 11794, 11801, 11808, 11815, 11821, 11827, 11834, 11839, 11843, 11847,
+    11851, 11857, 11865, 11869, 11875, 11882, 11887, 11893, 11901, 11907, 11914, 11919,
+    11922, 11924, 11927, 11932, 11936, 11943, 11950, 11957, 11966, 11972, 11983, 11988,
+    11997, 12006, 12015, 12022, 12028, 12033, 12043, 12050, 12058, 12063, 12067, 12077,
+    12083, 12091, 12096, 12104, 12114, 12120, 12128, 12135, 12142, 12151, 12157, 12164,
+    12171, 12178, 12189, 12199, 12210, 12222, 12231, 12238, 12245, 12257, 12266, 12273,
+    12276, 12281, 12288, 12300, 12305, 12312, 12320, 12329, 12338, 12347, 12354, 12364,
+    12371, 12376, 12383, 12389, 12396, 12409, 12413, 12419, 12426, 12438, 12445, 12451,
+    12457, 12464, 12470, 12476, 12483, 12491, 12499, 12506, 12514, 12521, 12526, 12535,
+    12541, 12554, 12560, 12565, 12574, 12579, 12587, 12596, 12605, 12611, 12621, 12628,
+    12635, 12643, 12652, 12659, 12667, 12673, 12682, 12690, 12702, 12709, 12714, 12722,
+    12728, 12733, 12740, 12750, 12758, 12764, 12769, 12773, 12780, 12792, 12797, 12802,
+    12808, 12816, 12824, 12829, 12836, 12840, 12845, 12851, 12859, 12868, 12875, 12879,
+    12886, 12892, 12901, 12907, 12913, 12921, 12927, 12936, 12945, 12952, 12958, 12965,
+    12972, 12978, 12985, 12993, 13004, 13011, 13016, 13021, 13029, 13035, 13041, 13047,
+    13055, 13064, 13069, 13075, 13083, 13087, 13093, 13102, 13109, 13117, 13122, 13135,
+    13145, 13156, 13164, 13175, 13188, 13197, 13202, 13209, 13215, 13220, 13225, 13231,
+    13236, 13247, 13252, 13263, 13267, 13273, 13281, 13287, 13297, 13306, 13314, 13322,
+    13331, 13337, 13344, 13351, 13358, 13363, 13371, 13378, 13384, 13392, 13398, 13404,
+    13415, 13423, 13429, 13441, 13451, 13458, 13467, 13474, 13482, 13494, 13500, 13507,
+    13516, 13523, 13529, 13537, 13547, 13553, 13563, 13570, 13576, 13582, 13591, 13596,
+    13608, 13614, 13623, 13629, 13637, 13648, 13654, 13660, 13669, 13678, 13683, 13692,
+    13704, 13710, 13718, 13725, 13732, 13741, 13749, 13755, 13760, 13770, 13778, 13784,
+    13790, 13797, 13803, 13814, 13821, 13828, 13838, 13852, 13859, 13866, 13873, 13885,
+    13898, 13906, 13918, 13924, 13934, 13942, 13951, 13958, 13968, 13977, 13981, 13992,
+    14000, 14007, 14019, 14031, 14038, 14047, 14052, 14058, 14069, 14081, 14092, 14098,
+    14104, 14110, 14118, 14127, 14133, 14139, 14146, 14153, 14159, 14166, 14173, 14181,
+    14189, 14199, 14204, 14212, 14219, 14227, 14229, 14235, 14242, 14250, 14261, 14272,
+    14277, 14282, 14286, 14291, 14296, 14301, 14308, 14314, 14321, 14328, 14333, 14338,
+    14344, 14349, 14355, 14360, 14364, 14372, 14382, 14387, 14393, 14399, 14403, 14409,
+    14418, 14428, 14437, 14448, 14453, 14465, 14469, 14477, 14483, 14490, 14495, 14501,
+    14510, 14515, 14518, 14523, 14527, 14535, 14543, 14553, 14565, 14571, 14577, 14586,
+    14592, 14599, 14604, 14612, 14618, 14626, 14632, 14643, 14650, 14660, 14673, 14678,
+    14685, 14693, 14697, 14704, 14710, 14715, 14720, 14726, 14735, 14741, 14747, 14752,
+    14757, 14763, 14770, 14773, 14780, 14785, 14792, 14800, 14807, 14817, 14824, 14832,
+    14838, 14844, 14855, 14859, 14865, 14871, 14879, 14891, 14895, 14901, 14907, 14915,
+    14921, 14931, 14939, 14947, 14953, 14958, 14967, 14979, 14991, 15003, 15009, 15018,
+    15023, 15029, 15036, 15042, 15048, 15057, 15066, 15073, 15082, 15089, 15095, 15103,
+    15107, 15114, 15122, 15126, 15130, 15137, 15143, 15150, 15156, 15163, 15171, 15178,
+    15186, 15191, 15201, 15208, 15215, 15218, 15225, 15230, 15237, 15245, 15249, 15260,
+    15266, 15268, 15273, 15280, 15284, 15290, 15293, 15301, 15310, 15313, 15322, 15333,
+    15343, 15349, 15359, 15364, 15372, 15380, 15388, 15394, 15406, 15412, 15422, 15433,
+    15440, 15447, 15456, 15465, 15473, 15476, 15483, 15487, 15494, 15498, 15502, 15506,
+    15511, 15517, 15522, 15531, 15539, 15548, 15556, 15558, 15565, 15572, 15578, 15584,
+    15588, 15594, 15600, 15607, 15612, 15617, 15628, 15634, 15643, 15648, 15652, 15660,
+    15667, 15672, 15678, 15684, 15690, 15695, 15706, 15713, 15719, 15724, 15730, 15737,
+    15743, 15751, 15756, 15763, 15769, 15772, 15778, 15782, 15792, 15800, 15811, 15818,
+    15824, 15829, 15832, 15838, 15840, 15847, 15853, 15860, 15867, 15875, 15880, 15887,
+    15892, 15896, 15906, 15914, 15919, 15926, 15934, 15940, 15949, 15955, 15965, 15976,
+    15981, 15990, 15994, 15999, 16004, 16010, 16014, 16021, 16029, 16036, 16041, 16047,
+    16054, 16061, 16066, 16072, 16081, 16087, 16093, 16104, 16111, 16119, 16127, 16133,
+    16139, 16144, 16150, 16156, 16161, 16171, 16176, 16181, 16188, 16196, 16205, 16210,
+    16215, 16222, 16228, 16244, 16250, 16255, 16259, 16266, 16274, 16279, 16284, 16288,
+    16294, 16299, 16309, 16314, 16322, 16330, 16341, 16352, 16360, 16368, 16375, 16382,
+    16386, 16388, 16393, 16398, 16404, 16411, 16413, 16419, 16426, 16433, 16438, 16443,
+    16448, 16452, 16457, 16461, 16466, 16470, 16476, 16484, 16486, 16491, 16495, 16500,
+    16506, 16513,
+};
+
+const quint32 faKeywordIconBegin[] = {
+    0, 5, 6, 26, 27, 41, 42, 55, 56, 57, 67, 68,
+    76, 77, 81, 85, 89, 90, 97, 98, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 120, 121, 122, 123, 124,
+    125, 126, 127, 128, 130, 132, 133, 136, 137, 141, 147, 148,
+    149, 150, 154, 165, 166, 169, 170, 174, 404, 407, 408, 409,
+    410, 411, 412, 413, 417, 418, 421, 422, 427, 437, 442, 443,
+    444, 455, 459, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+    470, 472, 473, 480, 484, 486, 487, 488, 489, 490, 670, 703,
+    704, 705, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+    719, 720, 721, 723, 724, 727, 728, 729, 730, 731, 732, 734,
+    735, 736, 737, 740, 746, 749, 750, 752, 757, 759, 771, 772,
+    773, 779, 780, 781, 782, 789, 790, 791, 792, 793, 794, 795,
+    796, 797, 800, 801, 802, 821, 822, 823, 826, 830, 831, 832,
+    834, 835, 836, 837, 839, 841, 845, 846, 847, 857, 859, 861,
+    863, 866, 867, 868, 869, 879, 882, 883, 890, 891, 892, 893,
+    898, 899, 901, 903, 912, 913, 916, 917, 918, 919, 920, 921,
+    922, 923, 924, 928, 930, 931, 940, 942, 943, 948, 949, 950,
+    952, 953, 955, 956, 958, 960, 961, 963, 964, 965, 978, 980,
+    982, 983, 986, 991, 992, 994, 995, 996, 998, 1002, 1003, 1024,
+    1025, 1027, 1028, 1029, 1054, 1059, 1061, 1062, 1066, 1068, 1069, 1081,
+    1082, 1083, 1084, 1089, 1096, 1097, 1098, 1099, 1109, 1112, 1133, 1138,
+    1139, 1155, 1158, 1159, 1163, 1164, 1166, 1167, 1170, 1172, 1173, 1175,
+    1176, 1184, 1189, 1190, 1194, 1196, 1197, 1198, 1200, 1202, 1204, 1205,
+    1208, 1209, 1211, 1212, 1213, 1214, 1217, 1218, 1233, 1234, 1235, 1236,
+    1237, 1240, 1241, 1242, 1243, 1244, 1250, 1251, 1252, 1253, 1254, 1260,
+    1265, 1267, 1269, 1273, 1274, 1275, 1276, 1279, 1280, 1281, 1282, 1283,
+    1284, 1286, 1289, 1313, 1314, 1315, 1329, 1330, 1331, 1332, 1346, 1347,
+    1348, 1349, 1350, 1351, 1355, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+    1366, 1368, 1388, 1390, 1403, 1404, 1408, 1422, 1423, 1424, 1426, 1427,
+    1444, 1445, 1446, 1449, 1450, 1453, 1454, 1464, 1465, 1466, 1468, 1469,
+    1472, 1473, 1482, 1483, 1484, 1486, 1490, 1492, 1495, 1497, 1498, 1524,
+    1525, 1574, 1575, 1576, 1579, 1580, 1582, 1583, 1599, 1600, 1601, 1617,
+    1621, 1626, 1627, 1635, 1636, 1639, 1641, 1642, 1643, 1644, 1852, 1853,
+    1857, 1861, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1873, 1882,
+    1883, 1920, 1921, 1923, 1929, 1930, 1964, 1965, 1969, 1970, 1971, 1972,
+    1973, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 2001, 2002, 2003, 2008,
+    2010, 2014, 2015, 2019, 2020, 2021, 2024, 2026, 2029, 2033, 2034, 2035,
+    2036, 2037, 2038, 2086, 2087, 2093, 2094, 2108, 2109, 2110, 2113, 2118,
+    2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2135, 2137,
+    2140, 2141, 2142, 2144, 2147, 2148, 2150, 2152, 2153, 2154, 2156, 2157,
+    2158, 2161, 2163, 2164, 2165, 2167, 2169, 2171, 2175, 2176, 2177, 2182,
+    2184, 2186, 2187, 2201, 2204, 2205, 2206, 2207, 2208, 2209, 2211, 2215,
+    2216, 2217, 2220, 2221, 2224, 2225, 2226, 2227, 2228, 2229, 2231, 2232,
+    2233, 2235, 2236, 2239, 2240, 2241, 2244, 2245, 2246, 2247, 2249, 2250,
+    2251, 2252, 2253, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266,
+    2267, 2268, 2269, 2270, 2271, 2272, 2273, 2278, 2279, 2280, 2282, 2283,
+    2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2293, 2294, 2296, 2297,
+    2298, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2310, 2312, 2314, 2315,
+    2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2339, 2347, 2352,
+    2353, 2366, 2367, 2369, 2371, 2372, 2373, 2374, 2375, 2376, 2379, 2380,
+    2381, 2382, 2383, 2384, 2385, 2389, 2390, 2395, 2397, 2398, 2403, 2404,
+    2405, 2406, 2407, 2408, 2409, 2413, 2416, 2436, 2437, 2444, 2445, 2446,
+    2447, 2448, 2449, 2452, 2458, 2467, 2478, 2490, 2491, 2492, 2596, 2597,
+    2602, 2603, 2604, 2605, 2606, 2609, 2610, 2618, 2620, 2623, 2627, 2628,
+    2629, 2631, 2632, 2633, 2634, 2645, 2648, 2649, 2651, 2653, 2654, 2656,
+    2657, 2658, 2660, 2661, 2662, 2663, 2666, 2670, 2671, 2676, 2677, 2679,
+    2681, 2690, 2692, 2693, 2695, 2696, 2697, 2698, 2699, 2700, 2702, 2710,
+    2711, 2712, 2714, 2715, 2734, 2735, 2739, 2740, 2742, 2750, 2752, 2753,
+    2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
+    2768, 2769, 2770, 2771, 2774, 2816, 2817, 2818, 2819, 2824, 2825, 2826,
+    2827, 2828, 2829, 2830, 2831, 2835, 2836, 2844, 2845, 2846, 2851, 2855,
+    2968, 2972, 2975, 2976, 2978, 2981, 2983, 2985, 2986, 2987, 2994, 2996,
+    2998, 2999, 3000, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010,
+    3011, 3015, 3017, 3018, 3072, 3074, 3075, 3077, 3083, 3084, 3090, 3091,
+    3092, 3093, 3094, 3095, 3096, 3112, 3114, 3115, 3116, 3119, 3120, 3124,
+    3125, 3127, 3128, 3131, 3143, 3146, 3147, 3151, 3152, 3157, 3159, 3160,
+    3161, 3168, 3169, 3172, 3173, 3178, 3179, 3182, 3183, 3184, 3185, 3186,
+    3188, 3189, 3190, 3208, 3209, 3210, 3216, 3218, 3222, 3224, 3227, 3228,
+    3229, 3232, 3233, 3241, 3244, 3245, 3247, 3250, 3251, 3252, 3253, 3254,
+    3255, 3256, 3257, 3258, 3259, 3261, 3262, 3263, 3298, 3305, 3306, 3309,
+    3310, 3311, 3312, 3321, 3322, 3323, 3324, 3330, 3332, 3333, 3334, 3337,
+    3339, 3340, 3341, 3345, 3346, 3348, 3349, 3362, 3363, 3364, 3365, 3369,
+    3370, 3371, 3372, 3373, 3375, 3377, 3378, 3380, 3381, 3382, 3385, 3388,
+    3389, 3390, 3391, 3420, 3424, 3426, 3434, 3435, 3436, 3437, 3438, 3439,
+    3440, 3443, 3445, 3447, 3455, 3456, 3457, 3458, 3459, 3460, 3462, 3463,
+    3464, 3465, 3467, 3468, 3476, 3477, 3490, 3496, 3497, 3498, 3507, 3508,
+    3509, 3510, 3513, 3514, 3515, 3519, 3531, 3532, 3533, 3534, 3535, 3536,
+    3537, 3539, 3540, 3542, 3554, 3568, 3569, 3570, 3571, 3574, 3575, 3616,
+    3617, 3619, 3633, 3638, 3639, 3641, 3644, 3645, 3646, 3650, 3651, 3652,
+    3655, 3666, 3667, 3668, 3669, 3683, 3684, 3685, 3688, 3690, 3691, 3722,
+    3723, 3725, 3727, 3728, 3729, 3731, 3733, 3738, 3739, 3740, 3750, 3757,
+    3759, 3760, 3761, 3763, 3764, 3765, 3766, 3771, 3772, 3777, 3778, 3795,
+    3797, 3798, 3799, 3805, 3807, 3808, 3809, 3810, 3820, 3821, 3822, 3825,
+    3828, 3830, 3833, 3834, 3840, 3841, 3842, 3843, 3848, 3885, 3886, 3887,
+    3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897, 3901, 3905,
+    3907, 3908, 3910, 3913, 3914, 3915, 3916, 3930, 3932, 3933, 3934, 3938,
+    3942, 3943, 3944, 3945, 3946, 3948, 3949, 3954, 3955, 3956, 3957, 3958,
+    3961, 3962, 3964, 3965, 3966, 3967, 3968, 3970, 3971, 3972, 3973, 3974,
+    3975, 3976, 3977, 3978, 3980, 3981, 3983, 3984, 3985, 3986, 3987, 3988,
+    3989, 3991, 3994, 3995, 3997, 3998, 3999, 4001, 4002, 4004, 4005, 4006,
+    4007, 4008, 4009, 4010, 4011, 4012, 4015, 4016, 4018, 4019, 4020, 4021,
+    4025, 4026, 4027, 4028, 4029, 4030, 4031, 4034, 4035, 4042, 4043, 4047,
+    4048, 4049, 4051, 4052, 4054, 4055, 4059, 4060, 4062, 4063, 4065, 4068,
+    4070, 4071, 4072, 4075, 4077, 4078, 4079, 4083, 4084, 4087, 4089, 4092,
+    4093, 4101, 4102, 4110, 4111, 4114, 4116, 4118, 4122, 4123, 4124, 4127,
+    4128, 4133, 4134, 4135, 4136, 4137, 4138, 4139, 4216, 4217, 4218, 4219,
+    4222, 4223, 4227, 4229, 4230, 4232, 4233, 4243, 4249, 4250, 4251, 4305,
+    4320, 4330, 4332, 4333, 4334, 4335, 4337, 4355, 4356, 4357, 4358, 4359,
+    4360, 4362, 4363, 4364, 4384, 4408, 4409, 4410, 4411, 4412, 4430, 4431,
+    4432, 4433, 4443, 4444, 4445, 4447, 4449, 4450, 4451, 4455, 4456, 4458,
+    4459, 4462, 4463, 4474, 4478, 4479, 4480, 4481, 4482, 4483, 4484, 4485,
+    4486, 4487, 4488, 4489, 4507, 4509, 4510, 4512, 4525, 4526, 4534, 4535,
+    4536, 4539, 4547, 4548, 4549, 4550, 4551, 4554, 4555, 4558, 4560, 4561,
+    4562, 4563, 4564, 4569, 4570, 4571, 4599, 4601, 4602, 4603, 4604, 4605,
+    4606, 4609, 4611, 4612, 4616, 4617, 4618, 4619, 4620, 4622, 4650, 4653,
+    4654, 4655, 4656, 4657, 4661, 4662, 4664, 4671, 4672, 4673, 4674, 4679,
+    4682, 4683, 4686, 4687, 4688, 4691, 4717, 4718, 4719, 4720, 4721, 4722,
+    4723, 4726, 4727, 4728, 4737, 4738, 4739, 4740, 4758, 4759, 4760, 4761,
+    4762, 4766, 4767, 4778, 4779, 4780, 4782, 4783, 4785, 4786, 4787, 4791,
+    4792, 4795, 4798, 4799, 4800, 4801, 4802, 4803, 4811, 4812, 4813, 4814,
+    4815, 4816, 4831, 4832, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4845,
+    4846, 4847, 4848, 4849, 4852, 4854, 4855, 4857, 4858, 4859, 4868, 4869,
+    4871, 4872, 4874, 4875, 4876, 4877, 4879, 4880, 4882, 4885, 4886, 4887,
+    4888, 4889, 4891, 4893, 4894, 4901, 4902, 4904, 4905, 4906, 4912, 4915,
+    4916, 4920, 4921, 4927, 4934, 4935, 4936, 4937, 4944, 4945, 4947, 4952,
+    4957, 4959, 4963, 4964, 4966, 4968, 4969, 4970, 4980, 4983, 4984, 5002,
+    5003, 5004, 5005, 5006, 5007, 5008, 5011, 5012, 5013, 5014, 5018, 5019,
+    5020, 5021, 5022, 5023, 5026, 5027, 5028, 5032, 5033, 5034, 5035, 5036,
+    5037, 5041, 5042, 5043, 5044, 5047, 5051, 5053, 5054, 5057, 5059, 5061,
+    5062, 5065, 5066, 5069, 5078, 5080, 5081, 5083, 5084, 5085, 5089, 5093,
+    5094, 5095, 5096, 5097, 5099, 5100, 5103, 5106, 5108, 5113, 5115, 5117,
+    5118, 5120, 5121, 5122, 5123, 5124, 5125, 5126, 5127, 5128, 5129, 5156,
+    5162, 5163, 5164, 5179, 5181, 5182, 5185, 5186, 5187, 5188, 5189, 5190,
+    5258, 5259, 5260, 5261, 5262, 5264, 5286, 5288, 5289, 5291, 5293, 5294,
+    5295, 5296, 5300, 5308, 5313, 5314, 5315, 5316, 5317, 5318, 5320, 5325,
+    5326, 5328, 5329, 5330, 5331, 5334, 5341, 5346, 5347, 5348, 5350, 5351,
+    5368, 5370, 5372, 5373, 5375, 5380, 5381, 5382, 5383, 5384, 5391, 5434,
+    5435, 5436, 5438, 5448, 5449, 5452, 5453, 5454, 5455, 5458, 5460, 5463,
+    5466, 5468, 5469, 5470, 5472, 5474, 5475, 5476, 5477, 5479, 5481, 5483,
+    5484, 5488, 5489, 5490, 5491, 5492, 5493, 5494, 5495, 5496, 5498, 5499,
+    5500, 5505, 5506, 5507, 5508, 5509, 5512, 5513, 5514, 5515, 5516, 5517,
+    5519, 5520, 5521, 5523, 5526, 5527, 5530, 5536, 5537, 5538, 5541, 5542,
+    5543, 5546, 5547, 5548, 5551, 5552, 5557, 5559, 5574, 5575, 5576, 5577,
+    5583, 5584, 5585, 5589, 5591, 5592, 5594, 5596, 5599, 5602, 5604, 5605,
+    5608, 5609, 5613, 5614, 5615, 5616, 5617, 5619, 5620, 5621, 5622, 5624,
+    5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636,
+    5637, 5654, 5655, 5656, 5658, 5661, 5662, 5664, 5666, 5667, 5668, 5669,
+    5670, 5671, 5672, 5673, 5675, 5676, 5677, 5681, 5684, 5685, 5687, 5688,
+    5691, 5692, 5693, 5696, 5698, 5701, 5702, 5704, 5705, 5708, 5709, 5713,
+    5714, 5717, 5815, 5818, 5819, 5820, 5821, 5822, 5823, 5831, 5832, 5837,
+    5838, 5840, 5841, 5842, 5843, 5844, 5846, 5847, 5848, 5850, 5852, 5853,
+    5855, 5857, 5858, 5859, 5869, 5870, 5876, 5879, 5880, 5881, 5883, 5884,
+    5885, 5886, 5887, 5888, 5889, 5891, 5892, 5898, 5901, 5903, 5904, 5905,
+    5906, 5910, 5911, 5914, 5917, 5918, 5919, 5921, 5922, 5923, 5924, 5925,
+    5926, 5928, 5929, 5930, 5931, 5932, 5934, 5936, 5937, 5940, 5941, 5943,
+    5947, 5949, 5950, 5954, 5955, 5956, 5959, 5960, 5969, 5971, 5972, 5973,
+    5974, 5980, 5981, 5982, 5983, 5985, 5986, 5987, 5991, 5992, 5993, 5994,
+    5997, 6000, 6008, 6009, 6012, 6013, 6016, 6017, 6019, 6020, 6021, 6022,
+    6023, 6026, 6031, 6033, 6034, 6035, 6037, 6039, 6040, 6041, 6046, 6053,
+    6056, 6057, 6058, 6059, 6060, 6061, 6063, 6064, 6065, 6083, 6084, 6086,
+    6090, 6091, 6092, 6093, 6094, 6097, 6098, 6104, 6105, 6109, 6110, 6112,
+    6114, 6117, 6118, 6119, 6120, 6121, 6122, 6124, 6125, 6126, 6139, 6141,
+    6142, 6186, 6203, 6207, 6208, 6209, 6210, 6212, 6253, 6254, 6255, 6256,
+    6258, 6259, 6260, 6261, 6262, 6265, 6270, 6271, 6272, 6275, 6276, 6280,
+    6282, 6287, 6288, 6289, 6290, 6291, 6369, 6370, 6371, 6372, 6373, 6374,
+    6375, 6382, 6383, 6388, 6389, 6390, 6394, 6397, 6399, 6406, 6407, 6421,
+    6422, 6423, 6424, 6427, 6430, 6432, 6434, 6436, 6438, 6439, 6444, 6445,
+    6446, 6447, 6449, 6450, 6451, 6452, 6454, 6455, 6456, 6457, 6459, 6461,
+    6490, 6491, 6492, 6493, 6494, 6498, 6500, 6502, 6503, 6510, 6511, 6514,
+    6515, 6516, 6517, 6520, 6521, 6522, 6524, 6525, 6527, 6528, 6529, 6531,
+    6532, 6533, 6535, 6536, 6538, 6539, 6540, 6690, 6691, 6692, 6693, 6697,
+    6698, 6699, 6701, 6703, 6704, 6706, 6707, 6708, 6709, 6711, 6712, 6730,
+    6733, 6736, 6738, 6739, 6742, 6743, 6744, 6748, 6749, 6750, 6752, 6753,
+    6754, 6758, 6759, 6760, 6761, 6762, 6763, 6764, 6767, 6769, 6770, 6777,
+    6778, 6779, 6781, 6782, 6785, 6787, 6788, 6789, 6792, 6802, 6805, 6806,
+    6807, 6808, 6810, 6812, 6813, 6814, 6816, 6818, 6819, 6823, 6836, 6838,
+    6839, 6840, 6841, 6842, 6843, 6844, 6845, 6847, 6848, 6849, 6850, 6851,
+    6856, 6857, 6858, 6860, 6861, 6862, 6865, 6866, 6869, 6871, 6875, 6876,
+    6877, 6878, 6880, 6881, 6882, 6883, 6887, 6899, 6904, 6905, 6906, 6916,
+    6917, 6918, 6920, 6921, 6922, 6923, 6924, 6929, 6930, 6931, 6933, 6935,
+    6936, 6938, 6940, 6942, 6944, 6945, 6946, 6948, 6951, 6952, 6953, 6955,
+    6956, 6957, 6959, 6960, 6961, 6974, 6976, 6977, 6978, 6980, 6985, 6986,
+    6989, 6999, 7002, 7006, 7008, 7009, 7010, 7011, 7018, 7019, 7020, 7021,
+    7022, 7034, 7035, 7036, 7042, 7043, 7044, 7045, 7047, 7048, 7051, 7052,
+    7055, 7056, 7062, 7063, 7064, 7065, 7068, 7069, 7072, 7073, 7090, 7092,
+    7096, 7097, 7099, 7145, 7147, 7148, 7156, 7157, 7158, 7160, 7166, 7167,
+    7168, 7169, 7170, 7181, 7182, 7183, 7184, 7185, 7186, 7190, 7191, 7192,
+    7193, 7194, 7199, 7200, 7206, 7207, 7208, 7209, 7210, 7219, 7239, 7240,
+    7254, 7255, 7256, 7259, 7260, 7272, 7273, 7275, 7276, 7278, 7300, 7301,
+    7302, 7303, 7304, 7306, 7307, 7308, 7309, 7311, 7312, 7315, 7316, 7317,
+    7318, 7333, 7334, 7335, 7336, 7339, 7341, 7343, 7344, 7346, 7349, 7350,
+    7351, 7354, 7355, 7356, 7358, 7359, 7360, 7361, 7364, 7367, 7368, 7370,
+    7371, 7374, 7375, 7379, 7380, 7381, 7382, 7384, 7385, 7386, 7387, 7388,
+    7389, 7392, 7393, 7394, 7395, 7504, 7509, 7510, 7511, 7512, 7514, 7520,
+    7594, 7605, 7606, 7607, 7610, 7614, 7616, 7628, 7629, 7631, 7632, 7633,
+    7634, 7635, 7636, 7639, 7640, 7641, 7642, 7647, 7665, 7667, 7668, 7669,
+    7671, 7675, 7676, 7677, 7686, 7687, 7690, 7691, 7694, 7695, 7696, 7697,
+    7706, 7707, 7708, 7709, 7710, 7711, 7714, 7715, 7716, 7717, 7718, 7725,
+    7726, 7728, 7730, 7731, 7735, 7736, 7737, 7738, 7739, 7745, 7746, 7748,
+    7752, 7753, 7755, 7760, 7762, 7763, 7764, 7769, 7770, 7786, 7787, 7788,
+    7796, 7801, 7802, 7803, 7806, 7807, 7810, 7812, 7813, 7814, 7815, 7817,
+    7819, 7820, 7821, 7822, 7824, 7833, 7835, 7837, 7838, 7840, 7841, 7842,
+    7843, 7852, 7853, 7854, 7859, 7860, 7862, 7865, 7876, 7878, 7879, 7884,
+    7889, 7890, 7891, 7892, 7893, 7894, 7895, 7896, 7897, 7898, 7899, 7900,
+    7901, 7903, 7905, 7906, 7907, 7908, 7909, 7910, 7911, 7912, 7913, 7917,
+    7918, 7922, 7923, 7925, 7963, 7966, 7970, 7971, 7972, 7974, 7975, 7976,
+    7977, 7978, 7979, 7980, 7981, 7982, 7983, 7985, 7992, 7993, 7994, 7995,
+    7996, 7998, 7999,
+};
+
+const quint16 faKeywordIcons[] = {
+    15, 275, 625, 1777, 1833, 1101, 16, 129, 216, 276, 626, 688, 1559, 1671, 1672, 1785,
+    1832, 1964, 1965, 1989, 2233, 2552, 2557, 2580, 3006, 3007, 1028, 17, 130, 277, 440, 441,
+    627, 689, 1559, 1776, 1788, 1831, 2553, 2558, 2581, 168, 18, 131, 278, 439, 628, 690,
+    843, 1729, 1775, 1787, 1830, 2554, 2559, 750, 270, 19, 279, 442, 629, 691, 705, 1774,
+    1829, 2555, 2556, 3139, 20, 280, 443, 630, 706, 1422, 1773, 2568, 3282, 21, 281, 631,
+    707, 22, 282, 632, 708, 23, 283, 633, 943, 3111, 24, 284, 634, 1671, 1672, 3006,
+    3007, 181, 32, 285, 635, 1034, 1075, 1667, 1668, 3001, 3002, 3386, 2477, 2576, 61, 1812,
+    3329, 3330, 2584, 1170, 2478, 10, 1824, 1825, 1461, 3183, 682, 3331, 1369, 3332, 2297, 526,
+    2055, 2078, 2371, 3109, 3564, 609, 694, 695, 178, 1945, 2939, 2940, 2941, 1138, 1139, 1140,
+    1141, 3030, 3031, 103, 3333, 2585, 135, 3110, 3111, 3288, 933, 934, 935, 936, 937, 938,
+    1451, 1452, 1453, 1454, 2942, 3532, 1620, 1966, 2948, 2054, 1667, 1668, 3001, 3002, 66, 114,
+    118, 122, 152, 169, 179, 214, 231, 317, 322, 462, 509, 510, 512, 514, 515, 516,
+    518, 520, 534, 555, 560, 592, 617, 681, 682, 683, 699, 713, 728, 745, 746, 1424,
+    1431, 1445, 1501, 1529, 1547, 1583, 1584, 1590, 1608, 1609, 1641, 1666, 1721, 1722, 1758, 1798,
+    1807, 1848, 1852, 1853, 1855, 1858, 1862, 1863, 1866, 1875, 1877, 1881, 1882, 1883, 1884, 1885,
+    1901, 1923, 1924, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1946, 1947, 1948, 1949, 1950,
+    1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1963, 1965, 1974, 1975, 1976,
+    1977, 1979, 1980, 1981, 1983, 1984, 1985, 1986, 1988, 1989, 1991, 1994, 1999, 2001, 2002, 2003,
+    2005, 2007, 2009, 2010, 2020, 2023, 2025, 2027, 2029, 2031, 2033, 2056, 2061, 2068, 2074, 2077,
+    2083, 2087, 2090, 2105, 2110, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2137,
+    2153, 2182, 2231, 2233, 2235, 2252, 2267, 2274, 2280, 2296, 2302, 2316, 2331, 2338, 2358, 2370,
+    2372, 2374, 2380, 2385, 2407, 2421, 2450, 2451, 2452, 2453, 2454, 2488, 2490, 2492, 2494, 2556,
+    2557, 2558, 2559, 2560, 2564, 2662, 2691, 2693, 2732, 2734, 2740, 2792, 2828, 2861, 2877, 2926,
+    2928, 2956, 2968, 2970, 2976, 2982, 2987, 2993, 2995, 3001, 3002, 3003, 3004, 3005, 3006, 3007,
+    3009, 3011, 3013, 3015, 3022, 3045, 3058, 3074, 3076, 3077, 3084, 3112, 3171, 3214, 3328, 3355,
+    3374, 3492, 3505, 3576, 3283, 3473, 3474, 1591, 2298, 1818, 2298, 3243, 3334, 1669, 1670, 3004,
+    3005, 3032, 5, 286, 636, 2479, 1165, 1166, 1167, 1168, 1640, 185, 199, 1183, 1286, 1757,
+    2009, 2010, 2565, 3357, 3535, 1987, 1988, 2000, 2001, 3189, 2777, 3249, 180, 181, 1597, 1598,
+    1599, 1600, 1601, 1602, 1603, 1604, 2151, 1597, 1598, 1599, 1600, 850, 2259, 3335, 851, 3463,
+    2480, 725, 852, 1102, 751, 6, 3336, 3337, 3338, 182, 743, 2372, 2586, 3187, 3453, 3454,
+    1169, 1172, 1173, 1175, 1683, 1710, 2260, 1737, 2344, 82, 125, 126, 143, 144, 183, 184,
+    185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+    224, 225, 227, 228, 247, 248, 287, 288, 289, 290, 360, 361, 362, 377, 391, 418,
+    488, 509, 510, 511, 580, 581, 637, 638, 639, 697, 740, 741, 752, 762, 958, 959,
+    960, 983, 984, 985, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1204, 1266,
+    1284, 1305, 1306, 1330, 1331, 1332, 1374, 1375, 1376, 1387, 1429, 1485, 1486, 1487, 1488, 1489,
+    1519, 1521, 1522, 1538, 1539, 1540, 1541, 1575, 1582, 1583, 1584, 1621, 1649, 1650, 1653, 1667,
+    1668, 1669, 1670, 1671, 1672, 1675, 1676, 1677, 1678, 1747, 1778, 1881, 1882, 1883, 1884, 1888,
+    1889, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939,
+    1940, 1941, 1942, 1943, 1944, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956,
+    1957, 2282, 2283, 2284, 2289, 2418, 2484, 2531, 2594, 2773, 2774, 2927, 2928, 3001, 3002, 3003,
+    3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3021, 3022, 161, 201,
+    202, 203, 204, 205, 206, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189,
+    1241, 1377, 1430, 1464, 1511, 1512, 1547, 1900, 1901, 1923, 1924, 1960, 1963, 1965, 2792, 955,
+    3541, 1573, 1667, 1669, 1671, 1369, 2299, 1818, 1817, 9, 853, 749, 2183, 3339, 31, 2261,
+    3542, 2373, 2374, 3340, 207, 1711, 1814, 208, 221, 1701, 3459, 1258, 2450, 2455, 3341, 3464,
+    209, 210, 2262, 2405, 1010, 3292, 3314, 3328, 3374, 3466, 745, 804, 1400, 3342, 2587, 2588,
+    33, 291, 640, 3298, 3348, 2778, 2779, 59, 448, 449, 450, 451, 452, 1090, 1128, 1575,
+    1789, 1852, 2998, 2375, 2263, 1465, 1466, 1467, 1575, 1852, 2999, 2862, 146, 147, 401, 1827,
+    1921, 1922, 2481, 2482, 3033, 2589, 806, 1810, 961, 2943, 962, 2514, 211, 1784, 2198, 2199,
+    1784, 1090, 234, 844, 928, 943, 944, 1724, 2011, 2012, 2013, 2015, 2034, 2037, 2038, 2040,
+    2046, 2050, 2051, 2052, 2780, 753, 754, 2708, 2709, 2711, 1484, 2250, 2436, 2882, 755, 2055,
+    868, 2055, 3319, 756, 3034, 1691, 2166, 977, 1513, 1439, 2056, 2057, 2058, 2972, 1347, 212,
+    213, 1557, 2253, 2556, 2557, 2558, 2559, 2560, 2926, 2011, 2012, 214, 1811, 2013, 2014, 2011,
+    2034, 2590, 1835, 1835, 3515, 215, 216, 1773, 1774, 1775, 1776, 1777, 1967, 1968, 2386, 2588,
+    2640, 3565, 2367, 134, 1122, 2303, 2304, 2323, 2326, 2351, 356, 357, 953, 1770, 2091, 3112,
+    3113, 3114, 217, 218, 1594, 3217, 3218, 785, 1588, 1731, 2271, 2376, 2377, 2944, 2945, 3115,
+    2781, 373, 2067, 2068, 757, 2816, 3035, 1393, 3535, 2264, 2483, 1742, 3012, 3013, 3014, 3015,
+    2946, 2947, 3149, 531, 532, 1291, 1292, 1293, 1565, 1989, 2232, 2233, 533, 534, 3343, 407,
+    807, 808, 809, 810, 1726, 2782, 1103, 2228, 1736, 2019, 2020, 3184, 219, 3344, 2273, 2621,
+    3345, 2684, 3286, 3346, 2204, 239, 699, 922, 996, 1133, 1218, 1509, 1632, 1972, 2334, 2380,
+    2691, 2693, 963, 2108, 2200, 2591, 1813, 3116, 3117, 3118, 220, 964, 965, 966, 1104, 2783,
+    3347, 3348, 2754, 758, 3297, 3298, 1692, 2021, 2975, 2976, 1447, 221, 222, 223, 292, 523,
+    641, 704, 812, 813, 815, 954, 1148, 1247, 1340, 1577, 1967, 2748, 2765, 2766, 2767, 2981,
+    1723, 2378, 2379, 773, 2265, 224, 225, 226, 227, 228, 229, 230, 231, 232, 293, 1442,
+    1824, 2109, 2201, 2261, 2380, 2381, 2483, 2518, 2547, 2592, 2593, 2863, 2864, 2925, 226, 233,
+    294, 424, 1443, 2382, 2865, 3036, 811, 950, 951, 2784, 2710, 2744, 3566, 2948, 2949, 2950,
+    2951, 2952, 2953, 2954, 2955, 2956, 2957, 3028, 3029, 1190, 930, 3147, 1191, 1192, 2089, 2090,
+    2707, 933, 1929, 1933, 1937, 1941, 2949, 2956, 1244, 731, 2594, 759, 760, 761, 967, 968,
+    969, 1105, 1193, 2916, 2921, 234, 2015, 2016, 95, 148, 235, 553, 1683, 2059, 2060, 2071,
+    2080, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2160, 2161, 2162, 2176, 2711, 1194, 2061, 2068,
+    2074, 2087, 2017, 7, 8, 58, 60, 62, 64, 187, 193, 780, 781, 1226, 1392, 1519,
+    1522, 1862, 1863, 236, 2866, 2867, 1816, 237, 2383, 2531, 2897, 238, 783, 1623, 1106, 970,
+    2868, 2869, 2379, 2991, 1307, 964, 965, 1386, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1348,
+    239, 762, 1546, 2062, 2486, 683, 240, 241, 482, 483, 2958, 2959, 2202, 971, 1624, 2815,
+    2046, 2203, 1969, 3121, 242, 1735, 2266, 2338, 3175, 271, 797, 151, 1202, 3567, 1142, 1684,
+    2882, 1203, 467, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1691, 1695,
+    2961, 243, 2528, 263, 1532, 1642, 2484, 2485, 2387, 3113, 957, 3578, 244, 245, 972, 2874,
+    2894, 2960, 2063, 1236, 3349, 2870, 1215, 1286, 1308, 1317, 1320, 2388, 692, 1743, 2267, 2384,
+    2962, 1090, 2486, 970, 973, 1606, 1607, 1986, 1999, 3579, 3250, 3486, 34, 295, 642, 1702,
+    1107, 2487, 246, 3037, 974, 1736, 1730, 2488, 3105, 247, 248, 249, 250, 251, 252, 253,
+    296, 1108, 1109, 1110, 1111, 1112, 1501, 1633, 1799, 1800, 1801, 1802, 1919, 1920, 2712, 2785,
+    2786, 254, 3038, 255, 256, 257, 297, 1445, 1458, 1514, 2936, 2937, 2981, 3039, 3040, 3042,
+    3119, 3317, 2595, 2596, 551, 709, 710, 711, 712, 713, 714, 975, 1855, 2356, 2371, 2433,
+    2928, 3022, 3543, 1484, 2597, 1736, 264, 976, 977, 2598, 2787, 1309, 1813, 2787, 3053, 2268,
+    378, 1692, 3056, 2064, 347, 1744, 363, 512, 75, 246, 812, 813, 814, 815, 1216, 1217,
+    1701, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2961, 2962, 66, 3120, 978, 979,
+    980, 981, 1529, 1825, 1828, 1972, 1973, 2083, 2511, 2834, 2836, 2701, 605, 621, 982, 1218,
+    1041, 1042, 1566, 1567, 1568, 1569, 1656, 1657, 1658, 1685, 1915, 1916, 1917, 1918, 2779, 2788,
+    2161, 2162, 2963, 258, 259, 260, 983, 984, 985, 986, 987, 988, 989, 1508, 1746, 1747,
+    2073, 2074, 2075, 2329, 2974, 2789, 3035, 3041, 3101, 261, 67, 1362, 2599, 2600, 3240, 3241,
+    3242, 3243, 3244, 3245, 3267, 3268, 3454, 3474, 3042, 262, 86, 1074, 1381, 1115, 1414, 1415,
+    990, 185, 199, 934, 935, 1452, 2009, 2010, 3028, 3029, 3350, 3544, 1533, 2405, 493, 494,
+    1549, 1624, 2601, 2602, 1310, 2204, 2205, 2804, 2805, 2394, 263, 264, 265, 266, 267, 268,
+    269, 270, 271, 272, 273, 1113, 1114, 1285, 1513, 1737, 1738, 1739, 2479, 2489, 2490, 2501,
+    2502, 2573, 2790, 2871, 2932, 235, 307, 372, 507, 709, 715, 808, 839, 986, 1022, 1038,
+    1054, 1145, 1165, 1196, 1205, 1227, 1248, 1260, 1268, 1311, 1334, 1341, 1349, 1356, 1398, 1417,
+    1480, 1544, 1651, 1802, 1864, 1894, 1922, 2060, 2065, 2117, 2127, 2184, 2234, 2235, 2269, 2422,
+    2709, 2713, 2771, 2986, 2987, 3017, 1617, 2805, 2872, 2873, 2874, 2874, 956, 2979, 274, 2018,
+    2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2695,
+    991, 1475, 1476, 1505, 1506, 1636, 1637, 1638, 1639, 1904, 1905, 1906, 1907, 1911, 1912, 1913,
+    1914, 1904, 1905, 1906, 1907, 1219, 1245, 1404, 1405, 1696, 1220, 78, 158, 468, 921, 922,
+    2646, 2791, 2875, 977, 759, 760, 992, 2850, 2856, 3277, 3568, 2206, 110, 111, 112, 197,
+    227, 228, 235, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 413, 418, 419, 507, 559, 738, 808, 813, 984,
+    985, 986, 987, 988, 989, 993, 1054, 1108, 1109, 1110, 1111, 1138, 1139, 1140, 1141, 1145,
+    1146, 1148, 1149, 1150, 1151, 1158, 1159, 1165, 1166, 1167, 1184, 1196, 1197, 1198, 1204, 1205,
+    1206, 1207, 1221, 1227, 1230, 1231, 1232, 1233, 1234, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+    1260, 1261, 1262, 1266, 1268, 1269, 1270, 1311, 1312, 1313, 1314, 1315, 1316, 1334, 1335, 1336,
+    1340, 1341, 1342, 1343, 1344, 1345, 1349, 1350, 1351, 1356, 1357, 1358, 1398, 1400, 1461, 1477,
+    1478, 1479, 1480, 1481, 1482, 1493, 1538, 1539, 1540, 1541, 1611, 1636, 1637, 1638, 1639, 1646,
+    1686, 1715, 1808, 1809, 1826, 1850, 1915, 1916, 1917, 1918, 1954, 1955, 1956, 1957, 2082, 2140,
+    2154, 2400, 2418, 2435, 2436, 2445, 2510, 2775, 2828, 3050, 3209, 3271, 237, 763, 764, 2270,
+    2977, 1174, 1297, 1383, 2491, 343, 344, 458, 3043, 2475, 3047, 2603, 2663, 2875, 560, 1877,
+    2083, 345, 1222, 1580, 1910, 2065, 2066, 2395, 2713, 2876, 2644, 249, 346, 598, 710, 716,
+    816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 1027, 1425, 1717, 1945, 2022, 2023, 2096, 2185, 2486,
+    1783, 1418, 2008, 347, 423, 871, 994, 1744, 2219, 348, 106, 349, 350, 839, 840, 841,
+    842, 1143, 1144, 1223, 1550, 1583, 1584, 2604, 2605, 2714, 2715, 2716, 2717, 2718, 2719, 2720,
+    2721, 2722, 2723, 2724, 2725, 2736, 2742, 2756, 2765, 2766, 2767, 3044, 3136, 1123, 2726, 2727,
+    2728, 3351, 3352, 3353, 351, 978, 1909, 2041, 3268, 3148, 1662, 3538, 792, 2270, 765, 352,
+    353, 354, 355, 364, 392, 513, 643, 790, 994, 995, 1619, 1623, 1713, 1970, 1971, 2412,
+    3317, 3225, 3290, 68, 356, 357, 1589, 2606, 142, 2607, 425, 1423, 2186, 2197, 1516, 996,
+    997, 998, 2964, 2207, 1055, 1140, 1141, 3031, 25, 358, 265, 939, 2501, 843, 1570, 1691,
+    2984, 3263, 2243, 69, 11, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+    370, 509, 510, 512, 514, 515, 516, 518, 520, 1503, 1807, 2117, 2118, 2119, 2120, 2121,
+    2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2492,
+    2493, 2844, 2877, 2878, 3045, 3046, 2128, 371, 372, 1517, 2137, 2494, 2495, 1970, 3269, 3486,
+    3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 2208, 352, 1655, 2277,
+    2396, 204, 1491, 1908, 2009, 2792, 1224, 3047, 3048, 3073, 3074, 2271, 3109, 2468, 1367, 3545,
+    854, 855, 3251, 3057, 114, 2930, 2965, 1824, 1825, 721, 2138, 2174, 3281, 2281, 702, 1815,
+    373, 2067, 2068, 2887, 2272, 2273, 229, 1553, 1733, 182, 2598, 2608, 999, 3578, 2139, 2159,
+    2175, 154, 155, 231, 3103, 1163, 1164, 2609, 3090, 3049, 3050, 856, 3062, 3063, 3099, 3354,
+    1000, 923, 2111, 2142, 2646, 2815, 1020, 2388, 374, 2586, 2902, 3269, 3486, 3487, 3488, 3489,
+    3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 1529, 1972, 1973, 1001, 2565, 2034, 3534,
+    2879, 1622, 2274, 142, 201, 2496, 2678, 2680, 453, 1483, 2417, 2419, 2209, 2210, 2574, 2575,
+    2880, 2881, 375, 2347, 844, 3174, 3355, 2626, 1698, 1225, 1699, 1002, 845, 846, 2606, 1003,
+    2035, 62, 64, 2867, 1779, 2710, 2264, 2531, 2861, 1004, 1552, 1849, 3356, 35, 298, 644,
+    3357, 3535, 2611, 2612, 2613, 2614, 2615, 2616, 2889, 2610, 3126, 2646, 1099, 1010, 1005, 2450,
+    3252, 299, 645, 1332, 2444, 2991, 1704, 2566, 79, 2785, 1501, 2592, 1819, 1819, 2882, 2003,
+    3572, 2857, 1456, 2793, 2794, 3130, 464, 678, 2730, 750, 376, 2263, 3211, 2729, 80, 2345,
+    3141, 3358, 1572, 3001, 3004, 3006, 207, 1814, 84, 346, 3359, 377, 392, 393, 766, 1974,
+    1276, 3536, 3222, 2730, 2497, 3546, 2069, 1124, 378, 379, 380, 381, 1115, 1116, 1117, 1118,
+    1119, 1120, 2239, 382, 383, 384, 385, 386, 387, 388, 389, 979, 1006, 1748, 2081, 2398,
+    3547, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2611, 2612, 2613, 2614, 2615, 2616, 3212, 2965,
+    2966, 2275, 3360, 3268, 2397, 3156, 2398, 857, 915, 2208, 3051, 3361, 3362, 3242, 2883, 858,
+    2832, 418, 419, 420, 1555, 421, 390, 391, 392, 393, 766, 847, 848, 1, 300, 463,
+    549, 646, 2218, 919, 2276, 2070, 2399, 3363, 3364, 1086, 1087, 1585, 2932, 1363, 2617, 2618,
+    3, 1850, 1851, 2116, 2140, 2147, 2152, 2235, 2286, 2481, 2492, 2493, 2494, 2495, 2499, 2510,
+    2524, 2548, 2915, 2987, 932, 2071, 2072, 2073, 2074, 2075, 2163, 2164, 394, 2740, 2140, 395,
+    1007, 1329, 2219, 2220, 401, 1185, 1686, 1984, 2331, 2421, 1016, 1017, 1178, 1188, 1558, 2054,
+    2069, 2118, 2128, 183, 188, 194, 200, 202, 205, 1008, 1009, 1084, 1085, 1125, 736, 1597,
+    1598, 1599, 1600, 1759, 1760, 1904, 1905, 1906, 1907, 2269, 1007, 2141, 111, 125, 143, 183,
+    184, 185, 186, 187, 188, 189, 190, 192, 199, 247, 287, 288, 301, 302, 323, 360,
+    377, 391, 396, 397, 448, 484, 488, 509, 580, 617, 637, 638, 647, 648, 662, 740,
+    752, 800, 895, 960, 984, 1008, 1009, 1041, 1083, 1169, 1170, 1171, 1179, 1180, 1226, 1305,
+    1374, 1377, 1436, 1464, 1488, 1506, 1511, 1537, 1541, 1547, 1566, 1572, 1583, 1600, 1604, 1639,
+    1650, 1656, 1667, 1669, 1671, 1674, 1675, 1747, 1881, 1888, 1904, 1911, 1915, 1924, 1925, 1929,
+    1936, 1940, 1941, 1946, 1950, 1954, 1980, 2009, 2010, 2282, 2489, 2773, 3001, 3003, 3004, 3006,
+    3008, 3009, 3012, 3013, 859, 143, 247, 1427, 1583, 2282, 995, 3365, 2277, 2619, 2400, 2401,
+    2402, 2795, 568, 569, 573, 770, 1317, 1321, 1404, 1679, 3191, 3366, 72, 551, 2291, 1531,
+    3051, 3098, 3380, 1828, 2714, 2967, 2968, 860, 3179, 497, 438, 524, 1191, 1240, 1372, 1388,
+    1462, 2148, 2364, 2730, 2738, 404, 405, 1734, 1318, 2278, 2279, 2620, 2621, 3215, 2969, 2970,
+    2622, 2036, 2796, 2797, 2623, 2757, 3367, 36, 303, 649, 1817, 1819, 2403, 2798, 3368, 1121,
+    2297, 2298, 2299, 2808, 3499, 2731, 2732, 3131, 3289, 1463, 1899, 1919, 2119, 2129, 2187, 2423,
+    2986, 2987, 2884, 2885, 398, 816, 817, 1474, 3060, 3477, 2624, 399, 818, 819, 304, 305,
+    650, 651, 1643, 1644, 1975, 1976, 3526, 3465, 1031, 1032, 3228, 132, 373, 374, 435, 436,
+    610, 721, 1407, 1594, 1734, 1777, 1786, 1833, 2072, 2075, 2164, 2370, 2498, 3114, 1787, 118,
+    400, 682, 2404, 1991, 96, 2399, 306, 401, 1227, 1574, 1690, 1823, 2499, 2500, 402, 2528,
+    3302, 2225, 2229, 2236, 28, 1628, 3369, 403, 3475, 2799, 3321, 3488, 1659, 1659, 2808, 3569,
+    2625, 1046, 1707, 1582, 1961, 3200, 0, 103, 215, 307, 492, 550, 601, 607, 611, 747,
+    987, 1006, 1023, 1108, 1143, 1166, 1197, 1206, 1230, 1249, 1261, 1269, 1312, 1335, 1342, 1350,
+    1357, 1400, 1493, 1499, 1860, 1898, 1903, 1920, 2120, 2130, 2404, 2424, 2525, 2775, 2939, 2944,
+    1152, 1126, 97, 1490, 1900, 1901, 1902, 2010, 3266, 767, 767, 3280, 1228, 2283, 861, 1521,
+    1653, 1958, 1959, 1634, 404, 405, 1186, 1497, 1498, 1734, 1821, 2625, 882, 1734, 849, 862,
+    871, 1131, 2335, 37, 308, 652, 3370, 505, 767, 768, 850, 851, 852, 853, 854, 855,
+    856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871,
+    872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887,
+    888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903,
+    904, 905, 906, 907, 908, 909, 910, 911, 1010, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+    1129, 1130, 1131, 1612, 1613, 1614, 2172, 2259, 2276, 2294, 2295, 2300, 2301, 2302, 2303, 2304,
+    2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2322, 2323, 2324, 2325, 2326, 2327, 2328,
+    2334, 2335, 2347, 2348, 2351, 2352, 2360, 2365, 3160, 3164, 3370, 3371, 2553, 2558, 2581, 1011,
+    1319, 1320, 769, 770, 771, 70, 2971, 561, 2341, 3537, 2972, 259, 1466, 1472, 2095, 2451,
+    2456, 2669, 2452, 2457, 71, 72, 1694, 863, 2221, 2280, 3514, 3548, 3549, 1530, 1679, 772,
+    406, 1229, 3373, 562, 1389, 1390, 2037, 1275, 1593, 3550, 407, 408, 409, 912, 913, 1041,
+    1042, 1145, 1146, 1230, 1231, 1232, 1233, 1234, 1235, 1280, 1580, 1665, 1666, 1705, 1706, 1707,
+    1708, 1709, 1710, 1711, 1712, 1713, 1894, 1895, 1896, 1897, 1898, 1899, 2076, 2077, 2281, 2282,
+    2283, 2284, 2285, 2286, 2287, 2288, 2289, 2405, 2501, 2502, 2503, 2504, 2626, 2973, 2991, 3052,
+    410, 2886, 2487, 2290, 2291, 411, 585, 1413, 1977, 2996, 3053, 412, 212, 413, 414, 415,
+    1545, 2510, 416, 2338, 2895, 2292, 453, 1237, 104, 417, 525, 963, 965, 1047, 1236, 1263,
+    1496, 1634, 2063, 2628, 2733, 2797, 2861, 3087, 3121, 3278, 2800, 965, 2078, 3310, 3505, 3372,
+    773, 1237, 2293, 2887, 914, 1789, 2627, 2476, 820, 821, 2212, 918, 1208, 1264, 1271, 1279,
+    1359, 1433, 1617, 2045, 2734, 2735, 3314, 2063, 2628, 2861, 3054, 1238, 1551, 2629, 2630, 2464,
+    722, 2073, 2074, 2075, 2329, 1012, 1013, 3182, 3537, 322, 619, 2007, 2023, 2199, 2993, 2995,
+    3479, 1265, 1266, 2737, 85, 418, 419, 420, 421, 1555, 422, 2888, 2889, 2890, 2294, 3055,
+    3056, 3455, 915, 2535, 218, 2736, 143, 144, 423, 424, 425, 426, 427, 428, 429, 430,
+    431, 432, 1509, 1510, 2505, 2506, 2507, 2891, 2508, 1014, 230, 1446, 2974, 3314, 3328, 3466,
+    3287, 3373, 975, 1043, 1062, 1193, 2038, 2039, 353, 1845, 1848, 2079, 2997, 1132, 3292, 3374,
+    3253, 14, 1429, 1471, 1472, 1473, 1489, 1866, 2958, 822, 1425, 2213, 3193, 2111, 2142, 140,
+    141, 1147, 3418, 433, 3317, 3375, 120, 2892, 2371, 2885, 2188, 244, 2892, 2761, 2222, 97,
+    183, 193, 194, 195, 197, 199, 202, 203, 780, 781, 1008, 1084, 1172, 1175, 1176, 1177,
+    1306, 1392, 1519, 1521, 1654, 1862, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1958, 2010,
+    2069, 2283, 723, 997, 1090, 1973, 2959, 2968, 3112, 2801, 864, 1613, 2295, 776, 1044, 3506,
+    404, 436, 476, 1773, 1829, 2049, 2105, 2112, 3314, 2509, 2510, 1724, 38, 309, 653, 3169,
+    3304, 3379, 3507, 3508, 73, 916, 2975, 2976, 3057, 1615, 3058, 3537, 266, 74, 75, 76,
+    2389, 1015, 2223, 2406, 2571, 1148, 1149, 1150, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+    2458, 2459, 1010, 1576, 1660, 425, 1423, 2186, 2197, 1516, 1978, 1766, 3274, 3270, 3271, 2631,
+    3307, 434, 1494, 2511, 2802, 2803, 3229, 3230, 3576, 3162, 3165, 3171, 3376, 3299, 3467, 245,
+    429, 435, 436, 539, 1239, 1240, 1284, 1285, 1407, 1409, 1419, 1420, 2111, 2142, 2181, 2270,
+    2296, 2370, 2548, 2549, 2804, 2805, 2806, 2807, 2893, 2912, 2973, 2977, 865, 2224, 2407, 2805,
+    3303, 3304, 1121, 1542, 2297, 2298, 2299, 2408, 2808, 2809, 2017, 2470, 917, 3377, 2639, 3150,
+    918, 2040, 2041, 2554, 2559, 3378, 3379, 3132, 3168, 3169, 3206, 3239, 3313, 3380, 3381, 2512,
+    2189, 1692, 3059, 774, 437, 438, 3195, 3320, 61, 29, 2225, 1029, 426, 439, 440, 441,
+    442, 443, 775, 919, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311,
+    2312, 2313, 1016, 1017, 2314, 2315, 2810, 2811, 3382, 1176, 1241, 1300, 1780, 2188, 2413, 2414,
+    2415, 2575, 3139, 3383, 444, 3137, 2812, 3032, 3060, 3061, 3384, 445, 446, 447, 2092, 39,
+    1512, 1595, 1643, 1720, 1764, 1923, 1975, 1995, 2082, 2542, 3028, 1891, 1892, 1893, 2978, 1018,
+    1019, 3231, 3385, 3527, 2715, 2716, 957, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
+    1096, 1097, 310, 405, 436, 461, 462, 680, 681, 1321, 1461, 1518, 1775, 1788, 1831, 2358,
+    889, 1994, 2894, 1020, 2632, 2633, 2513, 149, 150, 448, 449, 450, 451, 452, 453, 454,
+    455, 456, 457, 459, 866, 867, 1122, 1127, 1242, 1534, 1535, 1536, 1537, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 2054, 2080, 2081, 2143, 2144, 2145, 2146, 2147, 2148, 2627, 2634, 2895,
+    1243, 3038, 3057, 151, 458, 896, 1244, 1245, 1246, 1818, 1820, 2081, 2149, 2150, 2151, 2152,
+    2544, 152, 153, 1822, 2151, 2153, 348, 2171, 2369, 323, 582, 662, 2635, 1322, 1531, 1819,
+    2896, 2930, 3202, 3153, 2, 1021, 1035, 856, 2636, 2637, 2813, 2814, 2896, 2930, 2979, 3062,
+    3063, 3485, 2758, 464, 1531, 154, 155, 156, 157, 460, 767, 868, 2638, 2639, 2801, 2817,
+    2897, 2898, 3064, 1718, 1718, 1434, 2316, 3064, 2317, 2931, 1819, 250, 408, 427, 460, 461,
+    462, 468, 980, 1247, 1248, 1249, 1250, 1251, 1252, 1364, 1410, 1753, 2109, 2113, 2143, 2145,
+    2150, 2154, 2155, 2156, 2158, 2324, 2409, 2432, 2815, 2981, 1753, 890, 2305, 77, 2970, 2722,
+    811, 1449, 2985, 1253, 2226, 1254, 2039, 2640, 2896, 2930, 3386, 2151, 463, 1022, 1023, 1255,
+    1256, 1257, 1856, 1872, 1879, 1890, 382, 383, 464, 1437, 2451, 2456, 2762, 465, 2318, 2440,
+    2641, 1258, 1259, 2642, 3480, 3386, 596, 1157, 1158, 1159, 1717, 3138, 920, 2037, 2042, 2043,
+    2643, 2597, 149, 454, 1128, 1242, 1245, 1246, 2080, 2081, 2144, 2145, 2146, 2147, 2148, 2149,
+    2150, 2152, 2634, 918, 1190, 2821, 2816, 466, 921, 1133, 1424, 2156, 3119, 1024, 2589, 2644,
+    3468, 2014, 493, 494, 775, 847, 934, 1114, 2244, 2314, 2542, 2980, 786, 3516, 459, 850,
+    891, 2645, 2817, 3065, 1025, 1026, 1590, 2082, 2899, 2900, 2319, 2763, 2824, 2908, 2921, 3087,
+    2901, 2320, 3387, 1027, 1785, 1786, 1787, 1788, 78, 79, 80, 81, 82, 83, 158, 159,
+    466, 467, 468, 469, 470, 921, 922, 923, 924, 925, 1133, 1260, 1261, 1262, 1263, 1264,
+    1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1424, 2156, 2646, 2737, 2875, 3284, 2647, 3173,
+    3388, 2738, 1028, 3294, 731, 2739, 869, 417, 12, 40, 311, 654, 1779, 967, 2807, 2818,
+    2902, 870, 2819, 3329, 2981, 2982, 1827, 1828, 2083, 3122, 2820, 1745, 251, 365, 428, 471,
+    472, 473, 474, 514, 1255, 1459, 1709, 1992, 3066, 3108, 475, 1874, 3322, 2284, 1522, 1863,
+    1888, 3170, 476, 1428, 1888, 1889, 477, 580, 1457, 478, 1803, 1979, 2227, 1151, 1231, 1482,
+    1625, 1887, 2410, 2700, 2950, 3139, 479, 480, 481, 478, 3127, 3181, 3140, 1691, 3093, 2515,
+    1052, 3551, 3452, 3280, 1818, 1153, 2516, 2441, 2084, 3552, 2285, 2286, 3570, 118, 682, 3337,
+    3248, 528, 2903, 1448, 3570, 3389, 3390, 41, 312, 655, 1886, 1273, 1274, 3484, 3267, 2517,
+    3509, 3391, 1275, 1593, 3553, 3392, 2321, 3216, 2518, 3067, 3489, 1662, 3393, 3394, 3409, 3226,
+    1276, 3068, 2838, 2838, 1454, 42, 313, 656, 3397, 2519, 3528, 1134, 3069, 2919, 2983, 926,
+    1515, 2648, 3500, 482, 483, 484, 485, 1616, 2093, 3081, 3395, 612, 1641, 1885, 1983, 2520,
+    2521, 3396, 3397, 2411, 2024, 2025, 486, 871, 2322, 2323, 2324, 2078, 1277, 2650, 2649, 776,
+    2228, 1846, 1848, 2650, 2026, 2027, 3476, 1664, 43, 314, 657, 927, 928, 2363, 2522, 84,
+    85, 487, 2157, 1278, 1279, 2523, 2740, 471, 1867, 1693, 1818, 1820, 1886, 159, 488, 489,
+    1280, 1605, 2412, 2904, 2994, 3398, 1005, 1403, 1406, 1414, 2005, 2182, 2858, 3579, 490, 121,
+    122, 123, 491, 3070, 3246, 3247, 2325, 2326, 2327, 2328, 101, 232, 2413, 2414, 2415, 684,
+    1495, 2158, 2651, 2652, 3543, 1029, 378, 1281, 3254, 2618, 80, 58, 62, 161, 184, 185,
+    196, 197, 199, 287, 289, 301, 334, 396, 449, 485, 580, 637, 639, 647, 670, 729,
+    740, 752, 800, 926, 936, 958, 1030, 1181, 1183, 1330, 1375, 1376, 1451, 1464, 1475, 1485,
+    1512, 1535, 1538, 1547, 1568, 1575, 1582, 1597, 1601, 1608, 1636, 1677, 1685, 1717, 1852, 1882,
+    1905, 1912, 1916, 1923, 1926, 1930, 1934, 1935, 1938, 1939, 1942, 1947, 1951, 1955, 1961, 2009,
+    2010, 2198, 2263, 2951, 2955, 2992, 3021, 3022, 3131, 1576, 1525, 27, 2229, 3460, 972, 1649,
+    1650, 1980, 1981, 921, 1424, 1828, 1714, 2447, 2839, 86, 87, 88, 89, 1031, 1032, 2469,
+    2470, 2471, 2472, 492, 1581, 2524, 2525, 2526, 2527, 222, 2821, 183, 188, 194, 200, 202,
+    203, 205, 206, 267, 465, 563, 958, 959, 1008, 1009, 1030, 1067, 1084, 1085, 1170, 1179,
+    1181, 1189, 1301, 1305, 1306, 1332, 1374, 1394, 1739, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+    1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 2069, 2444, 2489, 2501, 2984, 2985, 2991,
+    3399, 252, 317, 339, 1112, 1281, 1393, 1402, 1666, 1985, 2121, 2131, 2231, 2810, 2811, 3107,
+    493, 494, 495, 496, 1521, 1549, 1624, 1653, 1958, 1959, 3161, 3170, 3315, 3190, 2416, 727,
+    1688, 414, 497, 498, 499, 500, 693, 711, 717, 1135, 1416, 1431, 1455, 1544, 1558, 1559,
+    2066, 2713, 3071, 1817, 1817, 501, 1792, 502, 2167, 2176, 2868, 1033, 1282, 1460, 1621, 1984,
+    2330, 2331, 2417, 2418, 2419, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2549,
+    538, 809, 912, 948, 1021, 1034, 1035, 1075, 1160, 1161, 1168, 1171, 1199, 1209, 1267, 1282,
+    1337, 1352, 1360, 1432, 1885, 1982, 1983, 2190, 1283, 3314, 1036, 1036, 945, 958, 959, 1030,
+    1067, 1087, 1089, 1092, 1094, 1097, 1675, 1676, 1677, 1678, 1881, 1882, 1883, 1884, 1330, 455,
+    2159, 216, 241, 384, 387, 483, 1436, 1821, 2453, 2458, 2764, 2773, 2044, 1333, 2329, 160,
+    2420, 3400, 872, 44, 315, 658, 3262, 2653, 952, 3024, 3401, 742, 1563, 2634, 1504, 429,
+    539, 1284, 1285, 1409, 1419, 1420, 2548, 2549, 2912, 2973, 1489, 1620, 1993, 2528, 2905, 3517,
+    1137, 1137, 1680, 2803, 503, 3510, 2654, 777, 504, 272, 1460, 1804, 1805, 1806, 1984, 2330,
+    2331, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2651, 3543, 3529, 2330, 2331,
+    1460, 1984, 2332, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2603, 1286, 1755,
+    1757, 1760, 1761, 1762, 1763, 1764, 2825, 955, 1407, 2270, 2296, 156, 505, 873, 929, 1287,
+    2044, 2643, 2655, 2462, 3241, 3501, 1288, 385, 2452, 2457, 3172, 1837, 1900, 1901, 1585, 2932,
+    3580, 2906, 2717, 2390, 382, 386, 387, 2450, 2455, 2333, 3402, 149, 163, 345, 393, 430,
+    546, 924, 1268, 1269, 1270, 1271, 1591, 1592, 2062, 2076, 2077, 2078, 2085, 2090, 2863, 2865,
+    2875, 2877, 2878, 2886, 2898, 2904, 2934, 2578, 3262, 1592, 3403, 3327, 2529, 3518, 1614, 2334,
+    2335, 778, 779, 1129, 506, 507, 508, 1151, 2230, 3554, 2530, 1756, 1289, 1971, 509, 510,
+    511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 930, 1807, 2117, 2118, 2119, 2120,
+    2121, 2122, 2123, 2124, 2125, 2126, 2492, 2877, 2932, 3045, 521, 2137, 2494, 2118, 3371, 3154,
+    2741, 522, 523, 524, 525, 3123, 526, 1841, 316, 317, 1630, 1631, 1985, 2231, 3072, 2431,
+    3404, 90, 366, 367, 515, 516, 2895, 1323, 1324, 1325, 527, 388, 2454, 2459, 2531, 1278,
+    204, 1838, 2792, 258, 409, 613, 840, 1005, 1059, 1109, 1149, 1232, 1250, 1313, 1343, 1420,
+    1478, 1492, 1648, 1800, 1879, 1880, 1896, 2122, 2132, 2191, 2414, 2425, 2505, 814, 583, 2822,
+    2823, 3405, 3295, 791, 2479, 2716, 3128, 3406, 528, 529, 530, 1290, 1607, 1986, 1987, 1988,
+    2994, 3058, 3291, 3407, 531, 532, 533, 534, 780, 781, 903, 1291, 1292, 1293, 1565, 1989,
+    2232, 2233, 2234, 2235, 2986, 2987, 2432, 3144, 2656, 874, 2473, 2535, 3111, 3264, 2336, 93,
+    113, 114, 1682, 2604, 2718, 2727, 2732, 2742, 2743, 2766, 931, 3050, 1692, 2337, 2532, 1294,
+    1295, 1751, 1296, 1297, 1298, 2657, 2947, 2658, 1778, 3073, 3074, 866, 1122, 1124, 746, 3039,
+    2177, 3075, 2798, 218, 535, 1589, 1594, 2824, 2825, 2988, 2989, 3435, 1090, 1418, 1691, 1037,
+    431, 585, 1408, 2981, 3044, 3045, 3046, 3052, 3071, 3076, 3077, 3078, 3093, 3096, 3100, 2579,
+    45, 318, 659, 3579, 536, 3408, 2659, 875, 1557, 2770, 3487, 3488, 3489, 3490, 3530, 379,
+    932, 917, 1295, 3565, 2660, 2790, 1765, 3231, 3385, 1728, 1116, 537, 538, 539, 540, 541,
+    542, 543, 3156, 3157, 1366, 1256, 1257, 1210, 1156, 2342, 81, 1136, 3519, 823, 824, 2192,
+    3409, 3456, 1221, 1721, 1722, 2952, 760, 2841, 876, 2236, 2399, 528, 1715, 544, 252, 545,
+    546, 1782, 3076, 3077, 3390, 547, 548, 2085, 3410, 3411, 479, 1559, 1671, 1672, 3006, 3007,
+    1091, 1092, 2933, 3412, 46, 319, 660, 1886, 2652, 1152, 1153, 1154, 1155, 1780, 1781, 933,
+    934, 935, 936, 937, 938, 939, 1382, 3360, 1121, 549, 550, 1038, 1857, 1873, 1878, 1880,
+    3141, 3272, 3273, 1819, 2447, 2539, 2566, 3538, 88, 389, 1421, 1435, 1740, 2537, 2602, 551,
+    1299, 2433, 2434, 1559, 2675, 3511, 782, 783, 2533, 2534, 89, 105, 108, 492, 1032, 1216,
+    1278, 1741, 2526, 3115, 825, 826, 2214, 1039, 76, 141, 231, 293, 1510, 1823, 1982, 1983,
+    2112, 2114, 2201, 2220, 2295, 2381, 2461, 2499, 2500, 3117, 3265, 3204, 3279, 3264, 784, 3581,
+    3310, 3505, 3509, 2826, 3457, 2661, 530, 1519, 1862, 1889, 1456, 2953, 581, 91, 92, 866,
+    1122, 2732, 3180, 2990, 47, 320, 661, 3259, 3515, 1194, 508, 2050, 3155, 1040, 1041, 1042,
+    2991, 3413, 3199, 2907, 1735, 2338, 2339, 552, 1735, 2338, 2438, 2087, 2237, 3414, 553, 2086,
+    2087, 2903, 2929, 1043, 1044, 1045, 1046, 1047, 2353, 554, 570, 571, 771, 171, 555, 699,
+    700, 701, 1716, 1790, 2690, 2691, 940, 1554, 2160, 1719, 2992, 236, 7, 2238, 2435, 2436,
+    2437, 785, 786, 877, 1090, 2340, 2535, 1580, 177, 2444, 3107, 3415, 591, 1469, 1808, 1697,
+    2662, 2663, 2028, 2029, 3132, 3453, 3454, 3473, 3474, 3238, 3244, 3491, 3492, 1705, 1795, 2536,
+    556, 3539, 1048, 1049, 787, 557, 558, 1127, 2664, 420, 540, 559, 560, 561, 562, 563,
+    564, 565, 1112, 1156, 1463, 1652, 1876, 1877, 1899, 1919, 2119, 2129, 2187, 2341, 2342, 2343,
+    2423, 2438, 2986, 2987, 552, 566, 1652, 1875, 2343, 2438, 2045, 878, 161, 567, 568, 569,
+    570, 571, 572, 1180, 1300, 1301, 1302, 1303, 1304, 2161, 2747, 1050, 2908, 3142, 4, 2482,
+    2738, 4, 1422, 13, 3416, 879, 80, 82, 96, 97, 573, 574, 575, 576, 577, 788,
+    1051, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319,
+    1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1367, 1679,
+    1680, 1813, 2069, 2162, 2163, 2164, 2257, 2319, 2362, 2543, 2641, 2672, 2744, 2745, 2837, 2838,
+    2839, 2840, 2841, 2842, 2845, 2848, 2946, 2947, 2965, 2966, 578, 579, 2337, 3417, 3418, 3512,
+    321, 322, 323, 580, 581, 582, 583, 584, 662, 1052, 1526, 1527, 1815, 1987, 1990, 2165,
+    2537, 2591, 2993, 2994, 2995, 3079, 585, 2996, 3481, 2538, 3555, 3080, 3081, 1053, 2474, 796,
+    1738, 2490, 2502, 2665, 592, 1629, 2020, 2025, 2027, 2029, 2031, 2033, 3124, 3213, 3214, 3309,
+    3485, 2666, 2166, 2780, 1288, 2088, 732, 733, 234, 1282, 1460, 1804, 2428, 941, 574, 586,
+    789, 2050, 2016, 3166, 3167, 3259, 63, 480, 942, 1054, 1055, 1056, 1057, 3124, 3213, 3214,
+    3309, 3485, 685, 3151, 2909, 2910, 2539, 162, 555, 587, 588, 589, 590, 1334, 1335, 1336,
+    1337, 1391, 1500, 1716, 1991, 2344, 2345, 3318, 93, 94, 1058, 1370, 1361, 1338, 1339, 344,
+    591, 1468, 1646, 3381, 3075, 3419, 880, 2859, 1340, 1341, 1342, 1343, 1344, 1345, 1727, 10,
+    409, 441, 614, 712, 718, 841, 988, 1059, 1110, 1138, 1140, 1150, 1158, 1233, 1251, 1314,
+    1344, 1406, 1419, 1477, 1596, 1746, 1768, 1799, 1872, 1873, 1897, 2123, 2133, 2165, 2179, 2352,
+    2415, 2426, 2506, 2940, 2945, 3050, 3168, 3169, 3313, 3496, 3274, 1836, 2540, 2746, 448, 449,
+    450, 451, 452, 456, 1534, 1535, 1536, 1537, 2280, 1778, 1794, 2485, 1323, 1028, 2629, 472,
+    3040, 3066, 735, 736, 95, 801, 802, 2541, 2542, 2747, 739, 2401, 1060, 2050, 1871, 2748,
+    943, 2363, 2439, 2911, 1061, 1379, 1380, 96, 97, 1868, 1992, 1805, 68, 1014, 1024, 1062,
+    1063, 2630, 1660, 881, 1421, 1708, 3213, 2543, 2543, 2544, 1117, 788, 2089, 2090, 2287, 2346,
+    2395, 2545, 2465, 1064, 1118, 1444, 2546, 2912, 2248, 594, 2091, 3294, 2926, 2239, 3502, 3082,
+    587, 920, 2042, 354, 994, 995, 1302, 1753, 2091, 2409, 163, 164, 1065, 1177, 2223, 2406,
+    2667, 3420, 592, 1066, 1629, 268, 3421, 48, 324, 663, 3233, 1438, 325, 1776, 1832, 1365,
+    331, 993, 1076, 1774, 1830, 2030, 2031, 30, 368, 371, 372, 517, 521, 608, 966, 1144,
+    1222, 1234, 1315, 1481, 1870, 2427, 2046, 3482, 3316, 220, 369, 518, 793, 1608, 1609, 593,
+    2547, 49, 326, 664, 3502, 2668, 2669, 2047, 98, 269, 2827, 2828, 498, 3083, 3084, 2718,
+    2719, 2725, 2720, 2749, 2750, 882, 2627, 3118, 2670, 2167, 2175, 2176, 2178, 1502, 253, 1346,
+    3555, 2409, 2432, 3323, 2107, 99, 1326, 1395, 1405, 3458, 3540, 2057, 2381, 3483, 1106, 2385,
+    3227, 2240, 2081, 576, 3085, 464, 594, 595, 596, 678, 790, 1157, 1158, 1159, 1396, 1431,
+    1867, 1868, 1869, 2008, 2056, 2478, 791, 1700, 3422, 3533, 3207, 3208, 3288, 3556, 1429, 1866,
+    597, 1026, 1430, 100, 2789, 1797, 892, 883, 3493, 1418, 2997, 3198, 2253, 1962, 1963, 1964,
+    1965, 598, 1620, 1993, 3424, 3507, 3511, 2751, 354, 994, 995, 3503, 3425, 1839, 2927, 2928,
+    599, 2829, 1290, 1514, 2004, 82, 1507, 1960, 3520, 699, 700, 701, 600, 450, 456, 2168,
+    2397, 761, 1219, 1324, 1327, 8, 60, 64, 161, 185, 186, 198, 199, 224, 227, 288,
+    290, 302, 335, 362, 376, 397, 418, 451, 511, 581, 638, 648, 730, 741, 762, 926,
+    937, 959, 960, 1067, 1083, 1172, 1173, 1174, 1178, 1181, 1187, 1204, 1266, 1284, 1331, 1332,
+    1375, 1387, 1429, 1453, 1464, 1476, 1486, 1489, 1512, 1519, 1521, 1522, 1534, 1539, 1547, 1569,
+    1582, 1598, 1602, 1609, 1637, 1653, 1658, 1678, 1764, 1862, 1863, 1866, 1883, 1906, 1913, 1917,
+    1923, 1927, 1931, 1934, 1935, 1938, 1939, 1943, 1948, 1952, 1956, 1958, 1959, 1961, 2009, 2010,
+    2199, 2283, 2284, 2398, 2531, 2954, 2956, 1077, 1714, 2671, 94, 2913, 2774, 3422, 1662, 1347,
+    1348, 1349, 1350, 1351, 1352, 1353, 1426, 1303, 136, 139, 749, 1162, 2241, 1789, 101, 1635,
+    3426, 3427, 2807, 1259, 914, 1369, 3534, 1137, 792, 2339, 2335, 2359, 1304, 2032, 2033, 2563,
+    2564, 2564, 3079, 255, 601, 1241, 1429, 1430, 1575, 1717, 1852, 1858, 1866, 1663, 7, 8,
+    236, 2407, 2629, 2630, 2169, 2440, 2441, 3086, 686, 1530, 1645, 2992, 1663, 1663, 2794, 1354,
+    944, 2099, 2466, 2980, 2242, 2243, 2244, 2245, 2343, 2442, 946, 2669, 2672, 478, 1661, 602,
+    3133, 2830, 50, 327, 665, 3471, 3494, 1355, 2914, 2915, 884, 2347, 2348, 3065, 3276, 2896,
+    2930, 1068, 2916, 3571, 1069, 1130, 3495, 3496, 2917, 380, 2813, 3461, 2831, 2832, 535, 1589,
+    2918, 418, 419, 1555, 3087, 3087, 3088, 1784, 2106, 2198, 2199, 2443, 2444, 2058, 2092, 2093,
+    2094, 3108, 2673, 2833, 270, 271, 2871, 3428, 1356, 1357, 1358, 1359, 1360, 2246, 2376, 2377,
+    2384, 1552, 1791, 967, 968, 885, 1986, 1988, 1999, 2001, 2475, 2545, 603, 3158, 257, 2247,
+    2854, 604, 3296, 2397, 2570, 2674, 2675, 3074, 1865, 2676, 605, 678, 2834, 606, 607, 608,
+    429, 1409, 1419, 1420, 2548, 2549, 2912, 2973, 3429, 575, 576, 609, 1750, 232, 1056, 1070,
+    3119, 2146, 2170, 3324, 3255, 26, 3508, 555, 2998, 2999, 102, 103, 104, 105, 106, 1001,
+    1105, 1767, 3430, 1277, 2498, 827, 828, 1069, 734, 2445, 3008, 3009, 3010, 3011, 1489, 1654,
+    1721, 1722, 1966, 2531, 3497, 679, 680, 681, 967, 2677, 1361, 1745, 1328, 610, 2084, 1745,
+    3033, 165, 611, 612, 613, 614, 615, 616, 1211, 1235, 1362, 1363, 1364, 1365, 1632, 1864,
+    1994, 2193, 2678, 1749, 2095, 2096, 945, 946, 947, 2256, 3256, 2919, 2248, 116, 169, 1160,
+    2252, 3129, 214, 259, 1508, 1810, 1811, 2943, 3521, 1669, 1670, 3004, 3005, 974, 2679, 2835,
+    617, 1834, 1223, 2721, 2722, 2550, 1071, 1502, 886, 1072, 1689, 2349, 2048, 2920, 154, 155,
+    156, 157, 460, 815, 2391, 2638, 2639, 2897, 2898, 3063, 3064, 618, 619, 2551, 3, 208,
+    211, 219, 262, 358, 375, 395, 422, 433, 444, 478, 486, 490, 501, 503, 527, 536,
+    578, 579, 602, 726, 727, 756, 990, 1106, 1519, 1522, 1659, 1660, 1661, 1662, 1663, 1664,
+    1688, 1745, 1818, 1820, 1862, 1863, 2171, 2647, 2745, 2852, 83, 529, 530, 541, 620, 1422,
+    2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 3089, 948, 949, 2288, 2350, 1820,
+    1805, 2972, 621, 2836, 66, 152, 210, 214, 355, 495, 496, 531, 532, 534, 569, 571,
+    572, 573, 577, 592, 599, 623, 728, 748, 781, 1113, 1114, 1977, 2002, 2063, 2153, 2267,
+    2274, 2316, 2374, 2455, 2456, 2457, 2458, 2459, 2488, 2490, 2662, 2976, 3449, 3257, 3025, 166,
+    107, 108, 3431, 1578, 3513, 3152, 829, 830, 2215, 3012, 3013, 3014, 3015, 3020, 2818, 2837,
+    926, 2446, 2648, 3557, 950, 951, 2838, 2839, 2840, 2841, 454, 2249, 2592, 2680, 3090, 3258,
+    3192, 3202, 1257, 14, 59, 152, 153, 155, 162, 169, 170, 171, 172, 174, 207, 223,
+    233, 256, 347, 349, 411, 415, 446, 473, 489, 494, 496, 542, 560, 561, 564, 566,
+    590, 615, 620, 701, 713, 719, 766, 804, 805, 810, 913, 949, 1098, 1142, 1156, 1164,
+    1498, 1624, 1631, 1731, 1844, 1968, 1990, 2124, 2134, 2180, 2182, 2194, 2231, 2364, 2377, 2396,
+    2406, 2419, 2421, 2428, 2436, 2437, 2527, 2546, 2560, 2561, 2582, 2681, 2937, 2942, 2997, 3077,
+    3078, 2842, 887, 888, 2723, 945, 2843, 764, 779, 803, 970, 974, 2869, 2910, 622, 623,
+    1720, 1995, 1996, 1997, 3235, 864, 952, 2140, 2770, 2771, 2453, 2458, 2471, 2454, 2459, 328,
+    666, 2159, 3012, 3013, 3014, 3015, 744, 889, 890, 891, 892, 893, 894, 895, 1612, 2125,
+    2135, 2172, 2351, 2352, 2429, 896, 897, 2752, 106, 2733, 2753, 942, 2097, 2250, 519, 2844,
+    1369, 2682, 3307, 3308, 2941, 3000, 929, 2724, 2754, 2761, 2809, 2835, 2845, 1842, 2846, 2801,
+    2847, 2848, 2848, 2849, 164, 167, 1724, 2562, 2960, 1001, 1105, 109, 2353, 110, 111, 112,
+    192, 213, 1571, 1572, 1573, 1667, 1668, 1669, 1670, 1671, 1672, 3001, 3002, 3003, 3004, 3005,
+    3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3223, 2921, 3558, 2354, 67, 113,
+    114, 1689, 847, 848, 981, 1861, 2535, 150, 491, 742, 2371, 2593, 2703, 3016, 3432, 3048,
+    3091, 3572, 3092, 3017, 2593, 2683, 2684, 2685, 1353, 1182, 1610, 1998, 1131, 624, 1183, 2355,
+    1793, 969, 1847, 1073, 3221, 2356, 2371, 2503, 115, 1074, 2170, 3512, 58, 60, 189, 195,
+    625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640,
+    641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656,
+    657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672,
+    673, 674, 675, 676, 793, 794, 1075, 1076, 1077, 1134, 1135, 1366, 1367, 1368, 1463, 1521,
+    1527, 1556, 1595, 1596, 1645, 1648, 1651, 1652, 1653, 1654, 1656, 1657, 1658, 1685, 1690, 1722,
+    1840, 1851, 1870, 1887, 1903, 1911, 1912, 1913, 1914, 1925, 1926, 1927, 1928, 1946, 1947, 1948,
+    1949, 1958, 1959, 1995, 1997, 2049, 2111, 2115, 2155, 2238, 2368, 2402, 2437, 2445, 2541, 2542,
+    2563, 2564, 2866, 2938, 2995, 3008, 3009, 3010, 3011, 3124, 3127, 3159, 3160, 3162, 3167, 3168,
+    3178, 3186, 3201, 3208, 3218, 3220, 3229, 3247, 3273, 3306, 3308, 3328, 3366, 3385, 3394, 3447,
+    3466, 3478, 1455, 3522, 1078, 2306, 2307, 2311, 2327, 2686, 447, 3180, 3200, 1225, 2061, 3577,
+    1369, 2687, 2253, 677, 2357, 2408, 3072, 678, 116, 329, 667, 679, 680, 681, 1346, 1411,
+    1518, 1853, 1860, 2358, 2447, 2565, 2566, 2712, 2746, 2850, 117, 118, 682, 2308, 2743, 2755,
+    119, 120, 1785, 113, 114, 2394, 3433, 2922, 876, 3219, 3220, 3434, 2279, 2448, 1465, 1473,
+    1660, 1586, 920, 927, 928, 2037, 3435, 2043, 1782, 2851, 2449, 2035, 1470, 1809, 2472, 168,
+    1859, 2138, 169, 170, 1161, 2251, 2252, 3336, 3337, 2748, 3469, 845, 846, 795, 620, 2253,
+    3089, 487, 1752, 2923, 1560, 3245, 3470, 3471, 462, 681, 1461, 1762, 1763, 1764, 1975, 1976,
+    2358, 3328, 1729, 2555, 2556, 2254, 3436, 1013, 3209, 3210, 2955, 2956, 1627, 1119, 1154, 1492,
+    703, 1772, 1120, 1587, 1592, 2329, 2359, 683, 1298, 1370, 1681, 2605, 2725, 2728, 2732, 2756,
+    2757, 2758, 2763, 2767, 898, 3018, 2759, 2760, 3325, 1626, 3437, 2360, 3559, 1136, 1137, 1200,
+    2734, 2361, 899, 852, 859, 884, 904, 2304, 3582, 2362, 2362, 2363, 565, 2873, 87, 88,
+    89, 846, 121, 122, 2688, 123, 2689, 1253, 2082, 3157, 3434, 2982, 3573, 2567, 1430, 1858,
+    2098, 109, 1817, 51, 330, 668, 2256, 70, 684, 685, 686, 687, 796, 1414, 1415, 1416,
+    1562, 1570, 2050, 1606, 1999, 2000, 2001, 2099, 2100, 2275, 2450, 2451, 2452, 2453, 2454, 2455,
+    2456, 2457, 2458, 2459, 1520, 2924, 1440, 2195, 1441, 588, 756, 3104, 688, 689, 690, 691,
+    2568, 1079, 2925, 947, 1080, 2173, 3041, 2110, 1371, 1372, 1544, 2926, 692, 1702, 535, 2989,
+    2205, 3504, 893, 2348, 1128, 2307, 2309, 953, 2040, 2460, 2461, 3318, 124, 725, 1725, 1798,
+    2434, 125, 126, 693, 1829, 1830, 1831, 1832, 1833, 2434, 2761, 2762, 2763, 2764, 831, 832,
+    3232, 2852, 2050, 2051, 1373, 1374, 1375, 1376, 1377, 1378, 595, 794, 1618, 370, 481, 520,
+    1449, 1450, 1666, 2500, 2997, 3019, 3020, 1414, 1415, 1416, 27, 29, 2225, 2229, 3533, 3538,
+    2462, 3523, 3312, 900, 1829, 1830, 1831, 1832, 1833, 2101, 2569, 3539, 901, 1998, 817, 819,
+    821, 822, 824, 826, 828, 830, 832, 834, 836, 838, 2115, 797, 331, 833, 834, 1774,
+    1830, 2216, 1051, 1520, 916, 1673, 1674, 1520, 2765, 2766, 2767, 798, 694, 1647, 2002, 695,
+    733, 802, 1093, 1094, 2196, 3286, 3134, 65, 2392, 249, 598, 2486, 2096, 499, 696, 697,
+    698, 419, 616, 1418, 1479, 1769, 1801, 1840, 1856, 1857, 1895, 2008, 2126, 2136, 2430, 2507,
+    2579, 2770, 1462, 2364, 2463, 2464, 2465, 2466, 2365, 148, 902, 96, 185, 187, 188, 189,
+    200, 205, 206, 958, 959, 1009, 1030, 1067, 1085, 1169, 1173, 1174, 1179, 1180, 1181, 1184,
+    1185, 1186, 1188, 1189, 1226, 1305, 1325, 1329, 1374, 1463, 1522, 1863, 1929, 1930, 1931, 1932,
+    1941, 1942, 1943, 1944, 2009, 2140, 2284, 2770, 2771, 1740, 1741, 2606, 171, 699, 700, 701,
+    1379, 2690, 2691, 2853, 1380, 799, 2692, 2693, 894, 903, 904, 2310, 2311, 2312, 2255, 2854,
+    2366, 2467, 367, 516, 555, 938, 947, 1932, 1936, 1940, 1944, 2955, 2957, 2570, 2571, 2768,
+    2094, 724, 702, 1381, 1382, 2202, 1081, 2694, 3514, 1796, 2468, 2469, 2470, 2471, 2472, 127,
+    703, 1081, 1082, 1771, 1772, 2855, 2855, 1291, 704, 1758, 128, 129, 130, 131, 132, 705,
+    706, 707, 708, 332, 543, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    720, 1732, 1855, 2927, 2928, 3021, 3022, 2695, 272, 469, 500, 687, 757, 1383, 1703, 2003,
+    2856, 2857, 2858, 2891, 2903, 2929, 2696, 3194, 190, 191, 1292, 1090, 103, 1499, 1854, 2442,
+    2445, 2965, 3008, 3009, 3010, 3011, 3026, 3093, 1384, 1523, 1853, 2903, 1385, 1386, 721, 722,
+    723, 724, 954, 1387, 1388, 1389, 1390, 1391, 1564, 1591, 2095, 2096, 2174, 2175, 2176, 2177,
+    2178, 2473, 2474, 2859, 3094, 727, 2256, 1272, 725, 1725, 2319, 726, 2890, 3185, 3186, 3084,
+    703, 1082, 1217, 3027, 2697, 727, 752, 800, 960, 1083, 1187, 1188, 1376, 1489, 1649, 1650,
+    1980, 1981, 2398, 3021, 3022, 3095, 470, 2698, 1798, 2004, 3096, 835, 836, 118, 682, 3236,
+    3159, 3163, 837, 838, 2217, 3097, 3472, 52, 333, 669, 3438, 3560, 133, 134, 3439, 1558,
+    3583, 728, 1579, 2367, 1212, 1254, 1390, 905, 2198, 2199, 3143, 699, 700, 701, 1561, 1575,
+    1852, 3021, 3022, 1781, 2699, 955, 1155, 2572, 3440, 3125, 1812, 1691, 1624, 145, 1528, 1641,
+    1571, 3135, 3441, 112, 126, 144, 185, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+    200, 225, 228, 248, 267, 289, 290, 334, 335, 361, 362, 452, 510, 511, 581, 589,
+    590, 639, 670, 729, 730, 741, 983, 985, 1042, 1084, 1085, 1170, 1171, 1175, 1176, 1177,
+    1178, 1183, 1189, 1275, 1292, 1306, 1392, 1437, 1464, 1487, 1505, 1511, 1521, 1536, 1540, 1547,
+    1567, 1573, 1584, 1599, 1603, 1638, 1649, 1653, 1657, 1668, 1670, 1672, 1673, 1676, 1763, 1884,
+    1889, 1907, 1914, 1918, 1924, 1928, 1932, 1933, 1937, 1944, 1949, 1953, 1957, 1958, 1959, 1981,
+    1996, 2009, 2010, 2115, 2289, 2774, 2927, 2928, 3002, 3003, 3005, 3007, 3010, 3011, 3014, 3015,
+    144, 248, 1524, 1584, 2289, 3561, 895, 2735, 3098, 3293, 3, 1850, 1851, 2116, 2147, 2152,
+    135, 136, 137, 145, 158, 432, 466, 472, 474, 475, 671, 731, 732, 733, 734, 801,
+    802, 956, 957, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1111,
+    1139, 1141, 1159, 1162, 1213, 1412, 1585, 1750, 1768, 1769, 1826, 2005, 2182, 2183, 2184, 2185,
+    2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2205, 2504, 2573, 2574, 2575,
+    2700, 2864, 2876, 2899, 2930, 2931, 2932, 2933, 3099, 3100, 172, 1393, 1394, 1395, 1396, 1397,
+    1548, 2197, 2475, 2575, 2934, 3562, 3442, 1845, 1846, 1847, 1098, 1338, 1848, 1849, 735, 736,
+    53, 336, 672, 1511, 1644, 1763, 1924, 1976, 1996, 1997, 3029, 3285, 3443, 138, 139, 2576,
+    1057, 2349, 737, 1825, 738, 739, 2368, 381, 1099, 1287, 1286, 1754, 1757, 1759, 1761, 305,
+    596, 651, 848, 935, 940, 998, 1017, 1256, 1257, 1644, 1868, 1976, 1997, 2245, 2315, 2541,
+    2811, 176, 177, 3101, 3261, 3305, 3306, 1238, 1398, 1399, 2102, 2103, 3444, 337, 740, 741,
+    1458, 1712, 2179, 2180, 2996, 3038, 1752, 257, 768, 1397, 2577, 3201, 3285, 3445, 3224, 3085,
+    3102, 157, 160, 165, 173, 174, 1163, 1164, 1368, 1399, 175, 3240, 1821, 137, 3196, 1095,
+    1096, 1097, 3446, 3023, 2769, 2052, 1435, 1436, 1437, 1815, 1844, 2578, 2579, 906, 2770, 2771,
+    2639, 2701, 3462, 54, 338, 673, 3275, 1100, 3103, 2935, 3104, 1330, 1331, 1332, 1333, 1813,
+    2257, 964, 2258, 3239, 742, 1563, 2702, 2703, 2633, 2104, 2105, 238, 1499, 2404, 2465, 2775,
+    151, 2393, 3024, 3024, 743, 744, 1843, 2476, 3105, 3144, 1080, 1176, 1177, 1192, 1201, 1223,
+    1239, 1240, 1265, 1266, 2148, 2363, 2737, 2772, 2773, 2774, 273, 803, 457, 532, 2232, 2233,
+    2409, 2938, 3025, 3026, 339, 2077, 2432, 3106, 3107, 2115, 3574, 2552, 2557, 2580, 907, 2685,
+    2936, 2937, 2936, 2937, 2913, 3524, 2786, 3197, 3232, 2106, 2369, 3234, 1299, 2704, 3260, 3447,
+    745, 804, 805, 1214, 1274, 1293, 1339, 1400, 2705, 406, 2448, 746, 1687, 2518, 2806, 2807,
+    2053, 3448, 2372, 1590, 1669, 1670, 1869, 1902, 1908, 2302, 3004, 3005, 2684, 1450, 747, 1729,
+    2580, 2581, 2582, 3275, 1058, 1370, 2706, 2775, 3027, 78, 140, 141, 925, 1051, 1837, 1838,
+    1839, 2006, 2007, 2008, 1979, 3188, 2776, 2111, 2142, 2181, 2370, 2707, 2172, 2312, 2313, 2324,
+    2328, 2814, 2660, 3146, 2636, 1813, 3525, 2637, 3538, 3145, 3515, 1664, 908, 350, 1706, 3203,
+    3449, 1401, 909, 2539, 3300, 3326, 3301, 3423, 2860, 748, 1543, 2390, 2854, 3146, 55, 340,
+    674, 2107, 3450, 3177, 3178, 260, 413, 419, 584, 616, 714, 720, 842, 989, 1146, 1167,
+    1198, 1207, 1252, 1262, 1270, 1316, 1336, 1345, 1351, 1355, 1358, 1403, 1418, 1479, 1769, 1801,
+    1840, 1856, 1857, 1895, 2008, 2126, 2136, 2430, 2507, 2579, 2770, 862, 1162, 1402, 56, 341,
+    675, 3263, 3205, 3575, 3451, 3452, 2583, 3563, 867, 2771, 3237, 1662, 3533, 2583, 3311, 3176,
+    3478, 57, 342, 676, 1667, 1668, 3001, 3002, 910, 1577, 3498, 3531, 911, 1710, 3000,
+};
+
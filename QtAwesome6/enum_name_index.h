@@ -1,9 +1,36 @@
+// Generated by tools/faenumgen from icons.txt, do not edit
+
+#ifndef ENUM_NAME_INDEX_H
+#define ENUM_NAME_INDEX_H
+
+#include <QtGlobal>
+#ifdef QTAWESOME_META_ENUM
 #include <QObject>
+#endif
 
 /// A list of all icon-names with the codepoint (unicode-value) on the right
 /// You can use the names on the page https://fa6.dashgame.com/
 namespace fa {
+#ifdef QTAWESOME_META_ENUM
 Q_NAMESPACE
+#endif
+
+/// The font style of an icon. The style is stored in the bits above the code-point,
+/// so every fa::icon value is a style-qualified handle:  style | code-point
+enum style {
+    fa_regular = 0x00000000,
+    fa_brands = 0x01000000
+};
+
+/// Returns the unicode code-point of a style-qualified icon
+constexpr int codepoint(int icon) { return icon & 0x00ffffff; }
+
+/// Returns the font style of a style-qualified icon
+constexpr style iconStyle(int icon) { return style(icon & 0x7f000000); }
+
+/// Combines a font style and a unicode code-point to a style-qualified icon
+constexpr int qualified(style s, int unicode) { return s | unicode; }
+
 enum icon {
     _0 = 0x30,
     _1 = 0x31,
@@ -4106,480 +4133,482 @@ enum icon {
     z = 0x5a,
 
     // brands
-    _42_group = 0xe080,
-    innosoft = 0xe080,
-    _500px = 0xf26e,
-    accessible_icon = 0xf368,
-    accusoft = 0xf369,
-    adn = 0xf170,
-    adversal = 0xf36a,
-    affiliatetheme = 0xf36b,
-    airbnb = 0xf834,
-    algolia = 0xf36c,
-    alipay = 0xf642,
-    amazon = 0xf270,
-    amazon_pay = 0xf42c,
-    amilia = 0xf36d,
-    android = 0xf17b,
-    angellist = 0xf209,
-    angrycreative = 0xf36e,
-    angular = 0xf420,
-    app_store = 0xf36f,
-    app_store_ios = 0xf370,
-    apper = 0xf371,
-    apple = 0xf179,
-    apple_pay = 0xf415,
-    artstation = 0xf77a,
-    asymmetrik = 0xf372,
-    atlassian = 0xf77b,
-    audible = 0xf373,
-    autoprefixer = 0xf41c,
-    avianex = 0xf374,
-    aviato = 0xf421,
-    aws = 0xf375,
-    bandcamp = 0xf2d5,
-    battle_net = 0xf835,
-    behance = 0xf1b4,
-    behance_square = 0xf1b5,
-    bilibili = 0xe3d9,
-    bimobject = 0xf378,
-    bitbucket = 0xf171,
-    bitcoin = 0xf379,
-    bity = 0xf37a,
-    black_tie = 0xf27e,
-    blackberry = 0xf37b,
-    blogger = 0xf37c,
-    blogger_b = 0xf37d,
-    bluetooth = 0xf293,
-    bluetooth_b = 0xf294,
-    bootstrap = 0xf836,
-    bots = 0xe340,
-    btc = 0xf15a,
-    buffer = 0xf837,
-    buromobelexperte = 0xf37f,
-    buy_n_large = 0xf8a6,
-    buysellads = 0xf20d,
-    canadian_maple_leaf = 0xf785,
-    cc_amazon_pay = 0xf42d,
-    cc_amex = 0xf1f3,
-    cc_apple_pay = 0xf416,
-    cc_diners_club = 0xf24c,
-    cc_discover = 0xf1f2,
-    cc_jcb = 0xf24b,
-    cc_mastercard = 0xf1f1,
-    cc_paypal = 0xf1f4,
-    cc_stripe = 0xf1f5,
-    cc_visa = 0xf1f0,
-    centercode = 0xf380,
-    centos = 0xf789,
-    chrome = 0xf268,
-    chromecast = 0xf838,
-    cloudflare = 0xe07d,
-    cloudscale = 0xf383,
-    cloudsmith = 0xf384,
-    cloudversify = 0xf385,
-    cmplid = 0xe360,
-    codepen = 0xf1cb,
-    codiepie = 0xf284,
-    confluence = 0xf78d,
-    connectdevelop = 0xf20e,
-    contao = 0xf26d,
-    cotton_bureau = 0xf89e,
-    cpanel = 0xf388,
-    creative_commons = 0xf25e,
-    creative_commons_by = 0xf4e7,
-    creative_commons_nc = 0xf4e8,
-    creative_commons_nc_eu = 0xf4e9,
-    creative_commons_nc_jp = 0xf4ea,
-    creative_commons_nd = 0xf4eb,
-    creative_commons_pd = 0xf4ec,
-    creative_commons_pd_alt = 0xf4ed,
-    creative_commons_remix = 0xf4ee,
-    creative_commons_sa = 0xf4ef,
-    creative_commons_sampling = 0xf4f0,
-    creative_commons_sampling_plus = 0xf4f1,
-    creative_commons_share = 0xf4f2,
-    creative_commons_zero = 0xf4f3,
-    critical_role = 0xf6c9,
-    css3 = 0xf13c,
-    css3_alt = 0xf38b,
-    cuttlefish = 0xf38c,
-    d_and_d = 0xf38d,
-    d_and_d_beyond = 0xf6ca,
-    dailymotion = 0xe052,
-    dashcube = 0xf210,
-    deezer = 0xe077,
-    delicious = 0xf1a5,
-    deploydog = 0xf38e,
-    deskpro = 0xf38f,
-    dev = 0xf6cc,
-    deviantart = 0xf1bd,
-    dhl = 0xf790,
-    diaspora = 0xf791,
-    digg = 0xf1a6,
-    digital_ocean = 0xf391,
-    discord = 0xf392,
-    discourse = 0xf393,
-    dochub = 0xf394,
-    docker = 0xf395,
-    draft2digital = 0xf396,
-    dribbble = 0xf17d,
-    dribbble_square = 0xf397,
-    dropbox = 0xf16b,
-    drupal = 0xf1a9,
-    dyalog = 0xf399,
-    earlybirds = 0xf39a,
-    ebay = 0xf4f4,
-    edge = 0xf282,
-    edge_legacy = 0xe078,
-    elementor = 0xf430,
-    ello = 0xf5f1,
-    ember = 0xf423,
-    empire = 0xf1d1,
-    envira = 0xf299,
-    erlang = 0xf39d,
-    ethereum = 0xf42e,
-    etsy = 0xf2d7,
-    evernote = 0xf839,
-    expeditedssl = 0xf23e,
-    facebook = 0xf09a,
-    facebook_f = 0xf39e,
-    facebook_messenger = 0xf39f,
-    facebook_square = 0xf082,
-    fantasy_flight_games = 0xf6dc,
-    fedex = 0xf797,
-    fedora = 0xf798,
-    figma = 0xf799,
-    firefox = 0xf269,
-    firefox_browser = 0xe007,
-    first_order = 0xf2b0,
-    first_order_alt = 0xf50a,
-    firstdraft = 0xf3a1,
-    flickr = 0xf16e,
-    flipboard = 0xf44d,
-    fly = 0xf417,
-    font_awesome = 0xf2b4,
-    font_awesome_flag = 0xf2b4,
-    font_awesome_logo_full = 0xf2b4,
-    fonticons = 0xf280,
-    fonticons_fi = 0xf3a2,
-    fort_awesome = 0xf286,
-    fort_awesome_alt = 0xf3a3,
-    forumbee = 0xf211,
-    foursquare = 0xf180,
-    free_code_camp = 0xf2c5,
-    freebsd = 0xf3a4,
-    fulcrum = 0xf50b,
-    galactic_republic = 0xf50c,
-    galactic_senate = 0xf50d,
-    get_pocket = 0xf265,
-    gg = 0xf260,
-    gg_circle = 0xf261,
-    git = 0xf1d3,
-    git_alt = 0xf841,
-    git_square = 0xf1d2,
-    github = 0xf09b,
-    github_alt = 0xf113,
-    github_square = 0xf092,
-    gitkraken = 0xf3a6,
-    gitlab = 0xf296,
-    gitter = 0xf426,
-    glide = 0xf2a5,
-    glide_g = 0xf2a6,
-    gofore = 0xf3a7,
-    golang = 0xe40f,
-    goodreads = 0xf3a8,
-    goodreads_g = 0xf3a9,
-    google = 0xf1a0,
-    google_drive = 0xf3aa,
-    google_pay = 0xe079,
-    google_play = 0xf3ab,
-    google_plus = 0xf2b3,
-    google_plus_g = 0xf0d5,
-    google_plus_square = 0xf0d4,
-    google_wallet = 0xf1ee,
-    gratipay = 0xf184,
-    grav = 0xf2d6,
-    gripfire = 0xf3ac,
-    grunt = 0xf3ad,
-    guilded = 0xe07e,
-    gulp = 0xf3ae,
-    hacker_news = 0xf1d4,
-    hacker_news_square = 0xf3af,
-    hackerrank = 0xf5f7,
-    hashnode = 0xe499,
-    hips = 0xf452,
-    hire_a_helper = 0xf3b0,
-    hive = 0xe07f,
-    hooli = 0xf427,
-    hornbill = 0xf592,
-    hotjar = 0xf3b1,
-    houzz = 0xf27c,
-    html5 = 0xf13b,
-    hubspot = 0xf3b2,
-    ideal = 0xe013,
-    imdb = 0xf2d8,
-    instagram = 0xf16d,
-    instagram_square = 0xe055,
-    instalod = 0xe081,
-    intercom = 0xf7af,
-    internet_explorer = 0xf26b,
-    invision = 0xf7b0,
-    ioxhost = 0xf208,
-    itch_io = 0xf83a,
-    itunes = 0xf3b4,
-    itunes_note = 0xf3b5,
-    java = 0xf4e4,
-    jedi_order = 0xf50e,
-    jenkins = 0xf3b6,
-    jira = 0xf7b1,
-    joget = 0xf3b7,
-    joomla = 0xf1aa,
-    js = 0xf3b8,
-    js_square = 0xf3b9,
-    jsfiddle = 0xf1cc,
-    kaggle = 0xf5fa,
-    keybase = 0xf4f5,
-    keycdn = 0xf3ba,
-    kickstarter = 0xf3bb,
-    kickstarter_k = 0xf3bc,
-    korvue = 0xf42f,
-    laravel = 0xf3bd,
-    lastfm = 0xf202,
-    lastfm_square = 0xf203,
-    leanpub = 0xf212,
-    less = 0xf41d,
-    line = 0xf3c0,
-    linkedin = 0xf08c,
-    linkedin_in = 0xf0e1,
-    linode = 0xf2b8,
-    linux = 0xf17c,
-    lyft = 0xf3c3,
-    magento = 0xf3c4,
-    mailchimp = 0xf59e,
-    mandalorian = 0xf50f,
-    markdown = 0xf60f,
-    mastodon = 0xf4f6,
-    maxcdn = 0xf136,
-    mdb = 0xf8ca,
-    medapps = 0xf3c6,
-    medium = 0xf23a,
-    medium_m = 0xf23a,
-    medrt = 0xf3c8,
-    meetup = 0xf2e0,
-    megaport = 0xf5a3,
-    mendeley = 0xf7b3,
-    meta = 0xe49b,
-    microblog = 0xe01a,
-    microsoft = 0xf3ca,
-    mix = 0xf3cb,
-    mixcloud = 0xf289,
-    mixer = 0xe056,
-    mizuni = 0xf3cc,
-    modx = 0xf285,
-    monero = 0xf3d0,
-    napster = 0xf3d2,
-    neos = 0xf612,
-    nfc_directional = 0xe530,
-    nfc_symbol = 0xe531,
-    nimblr = 0xf5a8,
-    node = 0xf419,
-    node_js = 0xf3d3,
-    npm = 0xf3d4,
-    ns8 = 0xf3d5,
-    nutritionix = 0xf3d6,
-    octopus_deploy = 0xe082,
-    odnoklassniki = 0xf263,
-    odnoklassniki_square = 0xf264,
-    old_republic = 0xf510,
-    opencart = 0xf23d,
-    openid = 0xf19b,
-    opera = 0xf26a,
-    optin_monster = 0xf23c,
-    orcid = 0xf8d2,
-    osi = 0xf41a,
-    padlet = 0xe4a0,
-    page4 = 0xf3d7,
-    pagelines = 0xf18c,
-    palfed = 0xf3d8,
-    patreon = 0xf3d9,
-    paypal = 0xf1ed,
-    perbyte = 0xe083,
-    periscope = 0xf3da,
-    phabricator = 0xf3db,
-    phoenix_framework = 0xf3dc,
-    phoenix_squadron = 0xf511,
-    php = 0xf457,
-    pied_piper = 0xf2ae,
-    pied_piper_alt = 0xf1a8,
-    pied_piper_hat = 0xf4e5,
-    pied_piper_pp = 0xf1a7,
-    pied_piper_square = 0xe01e,
-    pinterest = 0xf0d2,
-    pinterest_p = 0xf231,
-    pinterest_square = 0xf0d3,
-    pix = 0xe43a,
-    playstation = 0xf3df,
-    product_hunt = 0xf288,
-    pushed = 0xf3e1,
-    python = 0xf3e2,
-    qq = 0xf1d6,
-    quinscape = 0xf459,
-    quora = 0xf2c4,
-    r_project = 0xf4f7,
-    raspberry_pi = 0xf7bb,
-    ravelry = 0xf2d9,
-    react = 0xf41b,
-    reacteurope = 0xf75d,
-    readme = 0xf4d5,
-    rebel = 0xf1d0,
-    red_river = 0xf3e3,
-    reddit = 0xf1a1,
-    reddit_alien = 0xf281,
-    reddit_square = 0xf1a2,
-    redhat = 0xf7bc,
-    renren = 0xf18b,
-    replyd = 0xf3e6,
-    researchgate = 0xf4f8,
-    resolving = 0xf3e7,
-    rev = 0xf5b2,
-    rocketchat = 0xf3e8,
-    rockrms = 0xf3e9,
-    rust = 0xe07a,
-    safari = 0xf267,
-    salesforce = 0xf83b,
-    sass = 0xf41e,
-    schlix = 0xf3ea,
-    screenpal = 0xe570,
-    scribd = 0xf28a,
-    searchengin = 0xf3eb,
-    sellcast = 0xf2da,
-    sellsy = 0xf213,
-    servicestack = 0xf3ec,
-    shirtsinbulk = 0xf214,
-    shopify = 0xe057,
-    shopware = 0xf5b5,
-    simplybuilt = 0xf215,
-    sistrix = 0xf3ee,
-    sith = 0xf512,
-    sitrox = 0xe44a,
-    sketch = 0xf7c6,
-    skyatlas = 0xf216,
-    skype = 0xf17e,
-    slack = 0xf198,
-    slack_hash = 0xf198,
-    slideshare = 0xf1e7,
-    snapchat = 0xf2ab,
-    snapchat_ghost = 0xf2ab,
-    snapchat_square = 0xf2ad,
-    soundcloud = 0xf1be,
-    sourcetree = 0xf7d3,
-    speakap = 0xf3f3,
-    speaker_deck = 0xf83c,
-    spotify = 0xf1bc,
-    square_font_awesome = 0xf425,
-    square_font_awesome_stroke = 0xf35c,
-    font_awesome_alt = 0xf35c,
-    squarespace = 0xf5be,
-    stack_exchange = 0xf18d,
-    stack_overflow = 0xf16c,
-    stackpath = 0xf842,
-    staylinked = 0xf3f5,
-    steam = 0xf1b6,
-    steam_square = 0xf1b7,
-    steam_symbol = 0xf3f6,
-    sticker_mule = 0xf3f7,
-    strava = 0xf428,
-    stripe = 0xf429,
-    stripe_s = 0xf42a,
-    studiovinari = 0xf3f8,
-    stumbleupon = 0xf1a4,
-    stumbleupon_circle = 0xf1a3,
-    superpowers = 0xf2dd,
-    supple = 0xf3f9,
-    suse = 0xf7d6,
-    swift = 0xf8e1,
-    symfony = 0xf83d,
-    teamspeak = 0xf4f9,
-    telegram = 0xf2c6,
-    telegram_plane = 0xf2c6,
-    tencent_weibo = 0xf1d5,
-    the_red_yeti = 0xf69d,
-    themeco = 0xf5c6,
-    themeisle = 0xf2b2,
-    think_peaks = 0xf731,
-    tiktok = 0xe07b,
-    trade_federation = 0xf513,
-    trello = 0xf181,
-    tumblr = 0xf173,
-    tumblr_square = 0xf174,
-    twitch = 0xf1e8,
-    twitter = 0xf099,
-    twitter_square = 0xf081,
-    typo3 = 0xf42b,
-    uber = 0xf402,
-    ubuntu = 0xf7df,
-    uikit = 0xf403,
-    umbraco = 0xf8e8,
-    uncharted = 0xe084,
-    uniregistry = 0xf404,
-    unity = 0xe049,
-    unsplash = 0xe07c,
-    untappd = 0xf405,
-    ups = 0xf7e0,
-    usb = 0xf287,
-    usps = 0xf7e1,
-    ussunnah = 0xf407,
-    vaadin = 0xf408,
-    viacoin = 0xf237,
-    viadeo = 0xf2a9,
-    viadeo_square = 0xf2aa,
-    viber = 0xf409,
-    vimeo = 0xf40a,
-    vimeo_square = 0xf194,
-    vimeo_v = 0xf27d,
-    vine = 0xf1ca,
-    vk = 0xf189,
-    vnv = 0xf40b,
-    vuejs = 0xf41f,
-    watchman_monitoring = 0xe087,
-    waze = 0xf83f,
-    weebly = 0xf5cc,
-    weibo = 0xf18a,
-    weixin = 0xf1d7,
-    whatsapp = 0xf232,
-    whatsapp_square = 0xf40c,
-    whmcs = 0xf40d,
-    wikipedia_w = 0xf266,
-    windows = 0xf17a,
-    wirsindhandwerk = 0xe2d0,
-    wsh = 0xe2d0,
-    wix = 0xf5cf,
-    wizards_of_the_coast = 0xf730,
-    wodu = 0xe088,
-    wolf_pack_battalion = 0xf514,
-    wordpress = 0xf19a,
-    wordpress_simple = 0xf411,
-    wpbeginner = 0xf297,
-    wpexplorer = 0xf2de,
-    wpforms = 0xf298,
-    wpressr = 0xf3e4,
-    xbox = 0xf412,
-    xing = 0xf168,
-    xing_square = 0xf169,
-    y_combinator = 0xf23b,
-    yahoo = 0xf19e,
-    yammer = 0xf840,
-    yandex = 0xf413,
-    yandex_international = 0xf414,
-    yarn = 0xf7e3,
-    yelp = 0xf1e9,
-    yoast = 0xf2b1,
-    youtube = 0xf167,
-    youtube_square = 0xf431,
-    zhihu = 0xf63f
+    _42_group = fa_brands | 0xe080,
+    innosoft = fa_brands | 0xe080,
+    _500px = fa_brands | 0xf26e,
+    accessible_icon = fa_brands | 0xf368,
+    accusoft = fa_brands | 0xf369,
+    adn = fa_brands | 0xf170,
+    adversal = fa_brands | 0xf36a,
+    affiliatetheme = fa_brands | 0xf36b,
+    airbnb = fa_brands | 0xf834,
+    algolia = fa_brands | 0xf36c,
+    alipay = fa_brands | 0xf642,
+    amazon = fa_brands | 0xf270,
+    amazon_pay = fa_brands | 0xf42c,
+    amilia = fa_brands | 0xf36d,
+    android = fa_brands | 0xf17b,
+    angellist = fa_brands | 0xf209,
+    angrycreative = fa_brands | 0xf36e,
+    angular = fa_brands | 0xf420,
+    app_store = fa_brands | 0xf36f,
+    app_store_ios = fa_brands | 0xf370,
+    apper = fa_brands | 0xf371,
+    apple = fa_brands | 0xf179,
+    apple_pay = fa_brands | 0xf415,
+    artstation = fa_brands | 0xf77a,
+    asymmetrik = fa_brands | 0xf372,
+    atlassian = fa_brands | 0xf77b,
+    audible = fa_brands | 0xf373,
+    autoprefixer = fa_brands | 0xf41c,
+    avianex = fa_brands | 0xf374,
+    aviato = fa_brands | 0xf421,
+    aws = fa_brands | 0xf375,
+    bandcamp = fa_brands | 0xf2d5,
+    battle_net = fa_brands | 0xf835,
+    behance = fa_brands | 0xf1b4,
+    behance_square = fa_brands | 0xf1b5,
+    bilibili = fa_brands | 0xe3d9,
+    bimobject = fa_brands | 0xf378,
+    bitbucket = fa_brands | 0xf171,
+    bitcoin = fa_brands | 0xf379,
+    bity = fa_brands | 0xf37a,
+    black_tie = fa_brands | 0xf27e,
+    blackberry = fa_brands | 0xf37b,
+    blogger = fa_brands | 0xf37c,
+    blogger_b = fa_brands | 0xf37d,
+    bluetooth = fa_brands | 0xf293,
+    bluetooth_b = fa_brands | 0xf294,
+    bootstrap = fa_brands | 0xf836,
+    bots = fa_brands | 0xe340,
+    btc = fa_brands | 0xf15a,
+    buffer = fa_brands | 0xf837,
+    buromobelexperte = fa_brands | 0xf37f,
+    buy_n_large = fa_brands | 0xf8a6,
+    buysellads = fa_brands | 0xf20d,
+    canadian_maple_leaf = fa_brands | 0xf785,
+    cc_amazon_pay = fa_brands | 0xf42d,
+    cc_amex = fa_brands | 0xf1f3,
+    cc_apple_pay = fa_brands | 0xf416,
+    cc_diners_club = fa_brands | 0xf24c,
+    cc_discover = fa_brands | 0xf1f2,
+    cc_jcb = fa_brands | 0xf24b,
+    cc_mastercard = fa_brands | 0xf1f1,
+    cc_paypal = fa_brands | 0xf1f4,
+    cc_stripe = fa_brands | 0xf1f5,
+    cc_visa = fa_brands | 0xf1f0,
+    centercode = fa_brands | 0xf380,
+    centos = fa_brands | 0xf789,
+    chrome = fa_brands | 0xf268,
+    chromecast = fa_brands | 0xf838,
+    cloudflare = fa_brands | 0xe07d,
+    cloudscale = fa_brands | 0xf383,
+    cloudsmith = fa_brands | 0xf384,
+    cloudversify = fa_brands | 0xf385,
+    cmplid = fa_brands | 0xe360,
+    codepen = fa_brands | 0xf1cb,
+    codiepie = fa_brands | 0xf284,
+    confluence = fa_brands | 0xf78d,
+    connectdevelop = fa_brands | 0xf20e,
+    contao = fa_brands | 0xf26d,
+    cotton_bureau = fa_brands | 0xf89e,
+    cpanel = fa_brands | 0xf388,
+    creative_commons = fa_brands | 0xf25e,
+    creative_commons_by = fa_brands | 0xf4e7,
+    creative_commons_nc = fa_brands | 0xf4e8,
+    creative_commons_nc_eu = fa_brands | 0xf4e9,
+    creative_commons_nc_jp = fa_brands | 0xf4ea,
+    creative_commons_nd = fa_brands | 0xf4eb,
+    creative_commons_pd = fa_brands | 0xf4ec,
+    creative_commons_pd_alt = fa_brands | 0xf4ed,
+    creative_commons_remix = fa_brands | 0xf4ee,
+    creative_commons_sa = fa_brands | 0xf4ef,
+    creative_commons_sampling = fa_brands | 0xf4f0,
+    creative_commons_sampling_plus = fa_brands | 0xf4f1,
+    creative_commons_share = fa_brands | 0xf4f2,
+    creative_commons_zero = fa_brands | 0xf4f3,
+    critical_role = fa_brands | 0xf6c9,
+    css3 = fa_brands | 0xf13c,
+    css3_alt = fa_brands | 0xf38b,
+    cuttlefish = fa_brands | 0xf38c,
+    d_and_d = fa_brands | 0xf38d,
+    d_and_d_beyond = fa_brands | 0xf6ca,
+    dailymotion = fa_brands | 0xe052,
+    dashcube = fa_brands | 0xf210,
+    deezer = fa_brands | 0xe077,
+    delicious = fa_brands | 0xf1a5,
+    deploydog = fa_brands | 0xf38e,
+    deskpro = fa_brands | 0xf38f,
+    dev = fa_brands | 0xf6cc,
+    deviantart = fa_brands | 0xf1bd,
+    dhl = fa_brands | 0xf790,
+    diaspora = fa_brands | 0xf791,
+    digg = fa_brands | 0xf1a6,
+    digital_ocean = fa_brands | 0xf391,
+    discord = fa_brands | 0xf392,
+    discourse = fa_brands | 0xf393,
+    dochub = fa_brands | 0xf394,
+    docker = fa_brands | 0xf395,
+    draft2digital = fa_brands | 0xf396,
+    dribbble = fa_brands | 0xf17d,
+    dribbble_square = fa_brands | 0xf397,
+    dropbox = fa_brands | 0xf16b,
+    drupal = fa_brands | 0xf1a9,
+    dyalog = fa_brands | 0xf399,
+    earlybirds = fa_brands | 0xf39a,
+    ebay = fa_brands | 0xf4f4,
+    edge = fa_brands | 0xf282,
+    edge_legacy = fa_brands | 0xe078,
+    elementor = fa_brands | 0xf430,
+    ello = fa_brands | 0xf5f1,
+    ember = fa_brands | 0xf423,
+    empire = fa_brands | 0xf1d1,
+    envira = fa_brands | 0xf299,
+    erlang = fa_brands | 0xf39d,
+    ethereum = fa_brands | 0xf42e,
+    etsy = fa_brands | 0xf2d7,
+    evernote = fa_brands | 0xf839,
+    expeditedssl = fa_brands | 0xf23e,
+    facebook = fa_brands | 0xf09a,
+    facebook_f = fa_brands | 0xf39e,
+    facebook_messenger = fa_brands | 0xf39f,
+    facebook_square = fa_brands | 0xf082,
+    fantasy_flight_games = fa_brands | 0xf6dc,
+    fedex = fa_brands | 0xf797,
+    fedora = fa_brands | 0xf798,
+    figma = fa_brands | 0xf799,
+    firefox = fa_brands | 0xf269,
+    firefox_browser = fa_brands | 0xe007,
+    first_order = fa_brands | 0xf2b0,
+    first_order_alt = fa_brands | 0xf50a,
+    firstdraft = fa_brands | 0xf3a1,
+    flickr = fa_brands | 0xf16e,
+    flipboard = fa_brands | 0xf44d,
+    fly = fa_brands | 0xf417,
+    font_awesome = fa_brands | 0xf2b4,
+    font_awesome_flag = fa_brands | 0xf2b4,
+    font_awesome_logo_full = fa_brands | 0xf2b4,
+    fonticons = fa_brands | 0xf280,
+    fonticons_fi = fa_brands | 0xf3a2,
+    fort_awesome = fa_brands | 0xf286,
+    fort_awesome_alt = fa_brands | 0xf3a3,
+    forumbee = fa_brands | 0xf211,
+    foursquare = fa_brands | 0xf180,
+    free_code_camp = fa_brands | 0xf2c5,
+    freebsd = fa_brands | 0xf3a4,
+    fulcrum = fa_brands | 0xf50b,
+    galactic_republic = fa_brands | 0xf50c,
+    galactic_senate = fa_brands | 0xf50d,
+    get_pocket = fa_brands | 0xf265,
+    gg = fa_brands | 0xf260,
+    gg_circle = fa_brands | 0xf261,
+    git = fa_brands | 0xf1d3,
+    git_alt = fa_brands | 0xf841,
+    git_square = fa_brands | 0xf1d2,
+    github = fa_brands | 0xf09b,
+    github_alt = fa_brands | 0xf113,
+    github_square = fa_brands | 0xf092,
+    gitkraken = fa_brands | 0xf3a6,
+    gitlab = fa_brands | 0xf296,
+    gitter = fa_brands | 0xf426,
+    glide = fa_brands | 0xf2a5,
+    glide_g = fa_brands | 0xf2a6,
+    gofore = fa_brands | 0xf3a7,
+    golang = fa_brands | 0xe40f,
+    goodreads = fa_brands | 0xf3a8,
+    goodreads_g = fa_brands | 0xf3a9,
+    google = fa_brands | 0xf1a0,
+    google_drive = fa_brands | 0xf3aa,
+    google_pay = fa_brands | 0xe079,
+    google_play = fa_brands | 0xf3ab,
+    google_plus = fa_brands | 0xf2b3,
+    google_plus_g = fa_brands | 0xf0d5,
+    google_plus_square = fa_brands | 0xf0d4,
+    google_wallet = fa_brands | 0xf1ee,
+    gratipay = fa_brands | 0xf184,
+    grav = fa_brands | 0xf2d6,
+    gripfire = fa_brands | 0xf3ac,
+    grunt = fa_brands | 0xf3ad,
+    guilded = fa_brands | 0xe07e,
+    gulp = fa_brands | 0xf3ae,
+    hacker_news = fa_brands | 0xf1d4,
+    hacker_news_square = fa_brands | 0xf3af,
+    hackerrank = fa_brands | 0xf5f7,
+    hashnode = fa_brands | 0xe499,
+    hips = fa_brands | 0xf452,
+    hire_a_helper = fa_brands | 0xf3b0,
+    hive = fa_brands | 0xe07f,
+    hooli = fa_brands | 0xf427,
+    hornbill = fa_brands | 0xf592,
+    hotjar = fa_brands | 0xf3b1,
+    houzz = fa_brands | 0xf27c,
+    html5 = fa_brands | 0xf13b,
+    hubspot = fa_brands | 0xf3b2,
+    ideal = fa_brands | 0xe013,
+    imdb = fa_brands | 0xf2d8,
+    instagram = fa_brands | 0xf16d,
+    instagram_square = fa_brands | 0xe055,
+    instalod = fa_brands | 0xe081,
+    intercom = fa_brands | 0xf7af,
+    internet_explorer = fa_brands | 0xf26b,
+    invision = fa_brands | 0xf7b0,
+    ioxhost = fa_brands | 0xf208,
+    itch_io = fa_brands | 0xf83a,
+    itunes = fa_brands | 0xf3b4,
+    itunes_note = fa_brands | 0xf3b5,
+    java = fa_brands | 0xf4e4,
+    jedi_order = fa_brands | 0xf50e,
+    jenkins = fa_brands | 0xf3b6,
+    jira = fa_brands | 0xf7b1,
+    joget = fa_brands | 0xf3b7,
+    joomla = fa_brands | 0xf1aa,
+    js = fa_brands | 0xf3b8,
+    js_square = fa_brands | 0xf3b9,
+    jsfiddle = fa_brands | 0xf1cc,
+    kaggle = fa_brands | 0xf5fa,
+    keybase = fa_brands | 0xf4f5,
+    keycdn = fa_brands | 0xf3ba,
+    kickstarter = fa_brands | 0xf3bb,
+    kickstarter_k = fa_brands | 0xf3bc,
+    korvue = fa_brands | 0xf42f,
+    laravel = fa_brands | 0xf3bd,
+    lastfm = fa_brands | 0xf202,
+    lastfm_square = fa_brands | 0xf203,
+    leanpub = fa_brands | 0xf212,
+    less = fa_brands | 0xf41d,
+    line = fa_brands | 0xf3c0,
+    linkedin = fa_brands | 0xf08c,
+    linkedin_in = fa_brands | 0xf0e1,
+    linode = fa_brands | 0xf2b8,
+    linux = fa_brands | 0xf17c,
+    lyft = fa_brands | 0xf3c3,
+    magento = fa_brands | 0xf3c4,
+    mailchimp = fa_brands | 0xf59e,
+    mandalorian = fa_brands | 0xf50f,
+    markdown = fa_brands | 0xf60f,
+    mastodon = fa_brands | 0xf4f6,
+    maxcdn = fa_brands | 0xf136,
+    mdb = fa_brands | 0xf8ca,
+    medapps = fa_brands | 0xf3c6,
+    medium = fa_brands | 0xf23a,
+    medium_m = fa_brands | 0xf23a,
+    medrt = fa_brands | 0xf3c8,
+    meetup = fa_brands | 0xf2e0,
+    megaport = fa_brands | 0xf5a3,
+    mendeley = fa_brands | 0xf7b3,
+    meta = fa_brands | 0xe49b,
+    microblog = fa_brands | 0xe01a,
+    microsoft = fa_brands | 0xf3ca,
+    mix = fa_brands | 0xf3cb,
+    mixcloud = fa_brands | 0xf289,
+    mixer = fa_brands | 0xe056,
+    mizuni = fa_brands | 0xf3cc,
+    modx = fa_brands | 0xf285,
+    monero = fa_brands | 0xf3d0,
+    napster = fa_brands | 0xf3d2,
+    neos = fa_brands | 0xf612,
+    nfc_directional = fa_brands | 0xe530,
+    nfc_symbol = fa_brands | 0xe531,
+    nimblr = fa_brands | 0xf5a8,
+    node = fa_brands | 0xf419,
+    node_js = fa_brands | 0xf3d3,
+    npm = fa_brands | 0xf3d4,
+    ns8 = fa_brands | 0xf3d5,
+    nutritionix = fa_brands | 0xf3d6,
+    octopus_deploy = fa_brands | 0xe082,
+    odnoklassniki = fa_brands | 0xf263,
+    odnoklassniki_square = fa_brands | 0xf264,
+    old_republic = fa_brands | 0xf510,
+    opencart = fa_brands | 0xf23d,
+    openid = fa_brands | 0xf19b,
+    opera = fa_brands | 0xf26a,
+    optin_monster = fa_brands | 0xf23c,
+    orcid = fa_brands | 0xf8d2,
+    osi = fa_brands | 0xf41a,
+    padlet = fa_brands | 0xe4a0,
+    page4 = fa_brands | 0xf3d7,
+    pagelines = fa_brands | 0xf18c,
+    palfed = fa_brands | 0xf3d8,
+    patreon = fa_brands | 0xf3d9,
+    paypal = fa_brands | 0xf1ed,
+    perbyte = fa_brands | 0xe083,
+    periscope = fa_brands | 0xf3da,
+    phabricator = fa_brands | 0xf3db,
+    phoenix_framework = fa_brands | 0xf3dc,
+    phoenix_squadron = fa_brands | 0xf511,
+    php = fa_brands | 0xf457,
+    pied_piper = fa_brands | 0xf2ae,
+    pied_piper_alt = fa_brands | 0xf1a8,
+    pied_piper_hat = fa_brands | 0xf4e5,
+    pied_piper_pp = fa_brands | 0xf1a7,
+    pied_piper_square = fa_brands | 0xe01e,
+    pinterest = fa_brands | 0xf0d2,
+    pinterest_p = fa_brands | 0xf231,
+    pinterest_square = fa_brands | 0xf0d3,
+    pix = fa_brands | 0xe43a,
+    playstation = fa_brands | 0xf3df,
+    product_hunt = fa_brands | 0xf288,
+    pushed = fa_brands | 0xf3e1,
+    python = fa_brands | 0xf3e2,
+    qq = fa_brands | 0xf1d6,
+    quinscape = fa_brands | 0xf459,
+    quora = fa_brands | 0xf2c4,
+    r_project = fa_brands | 0xf4f7,
+    raspberry_pi = fa_brands | 0xf7bb,
+    ravelry = fa_brands | 0xf2d9,
+    react = fa_brands | 0xf41b,
+    reacteurope = fa_brands | 0xf75d,
+    readme = fa_brands | 0xf4d5,
+    rebel = fa_brands | 0xf1d0,
+    red_river = fa_brands | 0xf3e3,
+    reddit = fa_brands | 0xf1a1,
+    reddit_alien = fa_brands | 0xf281,
+    reddit_square = fa_brands | 0xf1a2,
+    redhat = fa_brands | 0xf7bc,
+    renren = fa_brands | 0xf18b,
+    replyd = fa_brands | 0xf3e6,
+    researchgate = fa_brands | 0xf4f8,
+    resolving = fa_brands | 0xf3e7,
+    rev = fa_brands | 0xf5b2,
+    rocketchat = fa_brands | 0xf3e8,
+    rockrms = fa_brands | 0xf3e9,
+    rust = fa_brands | 0xe07a,
+    safari = fa_brands | 0xf267,
+    salesforce = fa_brands | 0xf83b,
+    sass = fa_brands | 0xf41e,
+    schlix = fa_brands | 0xf3ea,
+    screenpal = fa_brands | 0xe570,
+    scribd = fa_brands | 0xf28a,
+    searchengin = fa_brands | 0xf3eb,
+    sellcast = fa_brands | 0xf2da,
+    sellsy = fa_brands | 0xf213,
+    servicestack = fa_brands | 0xf3ec,
+    shirtsinbulk = fa_brands | 0xf214,
+    shopify = fa_brands | 0xe057,
+    shopware = fa_brands | 0xf5b5,
+    simplybuilt = fa_brands | 0xf215,
+    sistrix = fa_brands | 0xf3ee,
+    sith = fa_brands | 0xf512,
+    sitrox = fa_brands | 0xe44a,
+    sketch = fa_brands | 0xf7c6,
+    skyatlas = fa_brands | 0xf216,
+    skype = fa_brands | 0xf17e,
+    slack = fa_brands | 0xf198,
+    slack_hash = fa_brands | 0xf198,
+    slideshare = fa_brands | 0xf1e7,
+    snapchat = fa_brands | 0xf2ab,
+    snapchat_ghost = fa_brands | 0xf2ab,
+    snapchat_square = fa_brands | 0xf2ad,
+    soundcloud = fa_brands | 0xf1be,
+    sourcetree = fa_brands | 0xf7d3,
+    speakap = fa_brands | 0xf3f3,
+    speaker_deck = fa_brands | 0xf83c,
+    spotify = fa_brands | 0xf1bc,
+    square_font_awesome = fa_brands | 0xf425,
+    square_font_awesome_stroke = fa_brands | 0xf35c,
+    font_awesome_alt = fa_brands | 0xf35c,
+    squarespace = fa_brands | 0xf5be,
+    stack_exchange = fa_brands | 0xf18d,
+    stack_overflow = fa_brands | 0xf16c,
+    stackpath = fa_brands | 0xf842,
+    staylinked = fa_brands | 0xf3f5,
+    steam = fa_brands | 0xf1b6,
+    steam_square = fa_brands | 0xf1b7,
+    steam_symbol = fa_brands | 0xf3f6,
+    sticker_mule = fa_brands | 0xf3f7,
+    strava = fa_brands | 0xf428,
+    stripe = fa_brands | 0xf429,
+    stripe_s = fa_brands | 0xf42a,
+    studiovinari = fa_brands | 0xf3f8,
+    stumbleupon = fa_brands | 0xf1a4,
+    stumbleupon_circle = fa_brands | 0xf1a3,
+    superpowers = fa_brands | 0xf2dd,
+    supple = fa_brands | 0xf3f9,
+    suse = fa_brands | 0xf7d6,
+    swift = fa_brands | 0xf8e1,
+    symfony = fa_brands | 0xf83d,
+    teamspeak = fa_brands | 0xf4f9,
+    telegram = fa_brands | 0xf2c6,
+    telegram_plane = fa_brands | 0xf2c6,
+    tencent_weibo = fa_brands | 0xf1d5,
+    the_red_yeti = fa_brands | 0xf69d,
+    themeco = fa_brands | 0xf5c6,
+    themeisle = fa_brands | 0xf2b2,
+    think_peaks = fa_brands | 0xf731,
+    tiktok = fa_brands | 0xe07b,
+    trade_federation = fa_brands | 0xf513,
+    trello = fa_brands | 0xf181,
+    tumblr = fa_brands | 0xf173,
+    tumblr_square = fa_brands | 0xf174,
+    twitch = fa_brands | 0xf1e8,
+    twitter = fa_brands | 0xf099,
+    twitter_square = fa_brands | 0xf081,
+    typo3 = fa_brands | 0xf42b,
+    uber = fa_brands | 0xf402,
+    ubuntu = fa_brands | 0xf7df,
+    uikit = fa_brands | 0xf403,
+    umbraco = fa_brands | 0xf8e8,
+    uncharted = fa_brands | 0xe084,
+    uniregistry = fa_brands | 0xf404,
+    unity = fa_brands | 0xe049,
+    unsplash = fa_brands | 0xe07c,
+    untappd = fa_brands | 0xf405,
+    ups = fa_brands | 0xf7e0,
+    usb = fa_brands | 0xf287,
+    usps = fa_brands | 0xf7e1,
+    ussunnah = fa_brands | 0xf407,
+    vaadin = fa_brands | 0xf408,
+    viacoin = fa_brands | 0xf237,
+    viadeo = fa_brands | 0xf2a9,
+    viadeo_square = fa_brands | 0xf2aa,
+    viber = fa_brands | 0xf409,
+    vimeo = fa_brands | 0xf40a,
+    vimeo_square = fa_brands | 0xf194,
+    vimeo_v = fa_brands | 0xf27d,
+    vine = fa_brands | 0xf1ca,
+    vk = fa_brands | 0xf189,
+    vnv = fa_brands | 0xf40b,
+    vuejs = fa_brands | 0xf41f,
+    watchman_monitoring = fa_brands | 0xe087,
+    waze = fa_brands | 0xf83f,
+    weebly = fa_brands | 0xf5cc,
+    weibo = fa_brands | 0xf18a,
+    weixin = fa_brands | 0xf1d7,
+    whatsapp = fa_brands | 0xf232,
+    whatsapp_square = fa_brands | 0xf40c,
+    whmcs = fa_brands | 0xf40d,
+    wikipedia_w = fa_brands | 0xf266,
+    windows = fa_brands | 0xf17a,
+    wirsindhandwerk = fa_brands | 0xe2d0,
+    wsh = fa_brands | 0xe2d0,
+    wix = fa_brands | 0xf5cf,
+    wizards_of_the_coast = fa_brands | 0xf730,
+    wodu = fa_brands | 0xe088,
+    wolf_pack_battalion = fa_brands | 0xf514,
+    wordpress = fa_brands | 0xf19a,
+    wordpress_simple = fa_brands | 0xf411,
+    wpbeginner = fa_brands | 0xf297,
+    wpexplorer = fa_brands | 0xf2de,
+    wpforms = fa_brands | 0xf298,
+    wpressr = fa_brands | 0xf3e4,
+    xbox = fa_brands | 0xf412,
+    xing = fa_brands | 0xf168,
+    xing_square = fa_brands | 0xf169,
+    y_combinator = fa_brands | 0xf23b,
+    yahoo = fa_brands | 0xf19e,
+    yammer = fa_brands | 0xf840,
+    yandex = fa_brands | 0xf413,
+    yandex_international = fa_brands | 0xf414,
+    yarn = fa_brands | 0xf7e3,
+    yelp = fa_brands | 0xf1e9,
+    yoast = fa_brands | 0xf2b1,
+    youtube = fa_brands | 0xf167,
+    youtube_square = fa_brands | 0xf431,
+    zhihu = fa_brands | 0xf63f
 };
-Q_ENUM_NS(icon)
+#ifdef QTAWESOME_META_ENUM
+Q_ENUM_NS(icon)   // opt-in (CONFIG += qtawesome_meta_enum), the names are in faNameIconArray and faIcons
+#endif
 }
 
 struct FANameIcon {
@@ -4587,4577 +4616,31 @@ struct FANameIcon {
     fa::icon icon;
 };
 
-static const FANameIcon faNameIconArray[] = {
-    { "_0", fa::_0 },
-    { "_1", fa::_1 },
-    { "_2", fa::_2 },
-    { "_3", fa::_3 },
-    { "_4", fa::_4 },
-    { "_5", fa::_5 },
-    { "_6", fa::_6 },
-    { "_7", fa::_7 },
-    { "_8", fa::_8 },
-    { "_9", fa::_9 },
-    { "_00", fa::_00 },
-    { "_360_degrees", fa::_360_degrees },
-    { "a", fa::a },
-    { "abacus", fa::abacus },
-    { "accent_grave", fa::accent_grave },
-    { "acorn", fa::acorn },
-    { "address_book", fa::address_book },
-    { "contact_book", fa::address_book },
-    { "address_card", fa::address_card },
-    { "contact_card", fa::address_card },
-    { "vcard", fa::address_card },
-    { "air_conditioner", fa::air_conditioner },
-    { "airplay", fa::airplay },
-    { "alarm_clock", fa::alarm_clock },
-    { "alarm_exclamation", fa::alarm_exclamation },
-    { "alarm_plus", fa::alarm_plus },
-    { "alarm_snooze", fa::alarm_snooze },
-    { "album", fa::album },
-    { "album_circle_plus", fa::album_circle_plus },
-    { "album_circle_user", fa::album_circle_user },
-    { "album_collection", fa::album_collection },
-    { "album_collection_circle_plus", fa::album_collection_circle_plus },
-    { "album_collection_circle_user", fa::album_collection_circle_user },
-    { "alicorn", fa::alicorn },
-    { "alien", fa::alien },
-    { "alien_8bit", fa::alien_8bit },
-    { "alien_monster", fa::alien_8bit },
-    { "align_center", fa::align_center },
-    { "align_justify", fa::align_justify },
-    { "align_left", fa::align_left },
-    { "align_right", fa::align_right },
-    { "align_slash", fa::align_slash },
-    { "alt", fa::alt },
-    { "amp_guitar", fa::amp_guitar },
-    { "ampersand", fa::ampersand },
-    { "anchor", fa::anchor },
-    { "anchor_circle_check", fa::anchor_circle_check },
-    { "anchor_circle_exclamation", fa::anchor_circle_exclamation },
-    { "anchor_circle_xmark", fa::anchor_circle_xmark },
-    { "anchor_lock", fa::anchor_lock },
-    { "angel", fa::angel },
-    { "angle", fa::angle },
-    { "angle_90", fa::angle_90 },
-    { "angle_down", fa::angle_down },
-    { "angle_left", fa::angle_left },
-    { "angle_right", fa::angle_right },
-    { "angle_up", fa::angle_up },
-    { "angles_down", fa::angles_down },
-    { "angle_double_down", fa::angles_down },
-    { "angles_left", fa::angles_left },
-    { "angle_double_left", fa::angles_left },
-    { "angles_right", fa::angles_right },
-    { "angle_double_right", fa::angles_right },
-    { "angles_up", fa::angles_up },
-    { "angle_double_up", fa::angles_up },
-    { "ankh", fa::ankh },
-    { "apartment", fa::apartment },
-    { "aperture", fa::aperture },
-    { "apostrophe", fa::apostrophe },
-    { "apple_core", fa::apple_core },
-    { "apple_whole", fa::apple_whole },
-    { "apple_alt", fa::apple_whole },
-    { "archway", fa::archway },
-    { "arrow_down", fa::arrow_down },
-    { "arrow_down_1_9", fa::arrow_down_1_9 },
-    { "sort_numeric_asc", fa::arrow_down_1_9 },
-    { "sort_numeric_down", fa::arrow_down_1_9 },
-    { "arrow_down_9_1", fa::arrow_down_9_1 },
-    { "sort_numeric_desc", fa::arrow_down_9_1 },
-    { "sort_numeric_down_alt", fa::arrow_down_9_1 },
-    { "arrow_down_a_z", fa::arrow_down_a_z },
-    { "sort_alpha_asc", fa::arrow_down_a_z },
-    { "sort_alpha_down", fa::arrow_down_a_z },
-    { "arrow_down_arrow_up", fa::arrow_down_arrow_up },
-    { "sort_alt", fa::arrow_down_arrow_up },
-    { "arrow_down_big_small", fa::arrow_down_big_small },
-    { "sort_size_down", fa::arrow_down_big_small },
-    { "arrow_down_from_dotted_line", fa::arrow_down_from_dotted_line },
-    { "arrow_down_from_line", fa::arrow_down_from_line },
-    { "arrow_from_top", fa::arrow_down_from_line },
-    { "arrow_down_left", fa::arrow_down_left },
-    { "arrow_down_left_and_arrow_up_right_to_center", fa::arrow_down_left_and_arrow_up_right_to_center },
-    { "arrow_down_long", fa::arrow_down_long },
-    { "long_arrow_down", fa::arrow_down_long },
-    { "arrow_down_right", fa::arrow_down_right },
-    { "arrow_down_short_wide", fa::arrow_down_short_wide },
-    { "sort_amount_desc", fa::arrow_down_short_wide },
-    { "sort_amount_down_alt", fa::arrow_down_short_wide },
-    { "arrow_down_small_big", fa::arrow_down_small_big },
-    { "sort_size_down_alt", fa::arrow_down_small_big },
-    { "arrow_down_square_triangle", fa::arrow_down_square_triangle },
-    { "sort_shapes_down_alt", fa::arrow_down_square_triangle },
-    { "arrow_down_to_arc", fa::arrow_down_to_arc },
-    { "arrow_down_to_bracket", fa::arrow_down_to_bracket },
-    { "arrow_down_to_dotted_line", fa::arrow_down_to_dotted_line },
-    { "arrow_down_to_line", fa::arrow_down_to_line },
-    { "arrow_to_bottom", fa::arrow_down_to_line },
-    { "arrow_down_to_square", fa::arrow_down_to_square },
-    { "arrow_down_triangle_square", fa::arrow_down_triangle_square },
-    { "sort_shapes_down", fa::arrow_down_triangle_square },
-    { "arrow_down_up_across_line", fa::arrow_down_up_across_line },
-    { "arrow_down_up_lock", fa::arrow_down_up_lock },
-    { "arrow_down_wide_short", fa::arrow_down_wide_short },
-    { "sort_amount_asc", fa::arrow_down_wide_short },
-    { "sort_amount_down", fa::arrow_down_wide_short },
-    { "arrow_down_z_a", fa::arrow_down_z_a },
-    { "sort_alpha_desc", fa::arrow_down_z_a },
-    { "sort_alpha_down_alt", fa::arrow_down_z_a },
-    { "arrow_left", fa::arrow_left },
-    { "arrow_left_from_line", fa::arrow_left_from_line },
-    { "arrow_from_right", fa::arrow_left_from_line },
-    { "arrow_left_long", fa::arrow_left_long },
-    { "long_arrow_left", fa::arrow_left_long },
-    { "arrow_left_long_to_line", fa::arrow_left_long_to_line },
-    { "arrow_left_to_line", fa::arrow_left_to_line },
-    { "arrow_to_left", fa::arrow_left_to_line },
-    { "arrow_pointer", fa::arrow_pointer },
-    { "mouse_pointer", fa::arrow_pointer },
-    { "arrow_right", fa::arrow_right },
-    { "arrow_right_arrow_left", fa::arrow_right_arrow_left },
-    { "exchange", fa::arrow_right_arrow_left },
-    { "arrow_right_from_arc", fa::arrow_right_from_arc },
-    { "arrow_right_from_bracket", fa::arrow_right_from_bracket },
-    { "sign_out", fa::arrow_right_from_bracket },
-    { "arrow_right_from_line", fa::arrow_right_from_line },
-    { "arrow_from_left", fa::arrow_right_from_line },
-    { "arrow_right_long", fa::arrow_right_long },
-    { "long_arrow_right", fa::arrow_right_long },
-    { "arrow_right_long_to_line", fa::arrow_right_long_to_line },
-    { "arrow_right_to_arc", fa::arrow_right_to_arc },
-    { "arrow_right_to_bracket", fa::arrow_right_to_bracket },
-    { "sign_in", fa::arrow_right_to_bracket },
-    { "arrow_right_to_city", fa::arrow_right_to_city },
-    { "arrow_right_to_line", fa::arrow_right_to_line },
-    { "arrow_to_right", fa::arrow_right_to_line },
-    { "arrow_rotate_left", fa::arrow_rotate_left },
-    { "arrow_left_rotate", fa::arrow_rotate_left },
-    { "arrow_rotate_back", fa::arrow_rotate_left },
-    { "arrow_rotate_backward", fa::arrow_rotate_left },
-    { "undo", fa::arrow_rotate_left },
-    { "arrow_rotate_right", fa::arrow_rotate_right },
-    { "arrow_right_rotate", fa::arrow_rotate_right },
-    { "arrow_rotate_forward", fa::arrow_rotate_right },
-    { "redo", fa::arrow_rotate_right },
-    { "arrow_trend_down", fa::arrow_trend_down },
-    { "arrow_trend_up", fa::arrow_trend_up },
-    { "arrow_turn_down", fa::arrow_turn_down },
-    { "level_down", fa::arrow_turn_down },
-    { "arrow_turn_down_left", fa::arrow_turn_down_left },
-    { "arrow_turn_down_right", fa::arrow_turn_down_right },
-    { "arrow_turn_up", fa::arrow_turn_up },
-    { "level_up", fa::arrow_turn_up },
-    { "arrow_up", fa::arrow_up },
-    { "arrow_up_1_9", fa::arrow_up_1_9 },
-    { "sort_numeric_up", fa::arrow_up_1_9 },
-    { "arrow_up_9_1", fa::arrow_up_9_1 },
-    { "sort_numeric_up_alt", fa::arrow_up_9_1 },
-    { "arrow_up_a_z", fa::arrow_up_a_z },
-    { "sort_alpha_up", fa::arrow_up_a_z },
-    { "arrow_up_arrow_down", fa::arrow_up_arrow_down },
-    { "sort_up_down", fa::arrow_up_arrow_down },
-    { "arrow_up_big_small", fa::arrow_up_big_small },
-    { "sort_size_up", fa::arrow_up_big_small },
-    { "arrow_up_from_arc", fa::arrow_up_from_arc },
-    { "arrow_up_from_bracket", fa::arrow_up_from_bracket },
-    { "arrow_up_from_dotted_line", fa::arrow_up_from_dotted_line },
-    { "arrow_up_from_ground_water", fa::arrow_up_from_ground_water },
-    { "arrow_up_from_line", fa::arrow_up_from_line },
-    { "arrow_from_bottom", fa::arrow_up_from_line },
-    { "arrow_up_from_square", fa::arrow_up_from_square },
-    { "arrow_up_from_water_pump", fa::arrow_up_from_water_pump },
-    { "arrow_up_left", fa::arrow_up_left },
-    { "arrow_up_left_from_circle", fa::arrow_up_left_from_circle },
-    { "arrow_up_long", fa::arrow_up_long },
-    { "long_arrow_up", fa::arrow_up_long },
-    { "arrow_up_right", fa::arrow_up_right },
-    { "arrow_up_right_and_arrow_down_left_from_center", fa::arrow_up_right_and_arrow_down_left_from_center },
-    { "arrow_up_right_dots", fa::arrow_up_right_dots },
-    { "arrow_up_right_from_square", fa::arrow_up_right_from_square },
-    { "external_link", fa::arrow_up_right_from_square },
-    { "arrow_up_short_wide", fa::arrow_up_short_wide },
-    { "sort_amount_up_alt", fa::arrow_up_short_wide },
-    { "arrow_up_small_big", fa::arrow_up_small_big },
-    { "sort_size_up_alt", fa::arrow_up_small_big },
-    { "arrow_up_square_triangle", fa::arrow_up_square_triangle },
-    { "sort_shapes_up_alt", fa::arrow_up_square_triangle },
-    { "arrow_up_to_dotted_line", fa::arrow_up_to_dotted_line },
-    { "arrow_up_to_line", fa::arrow_up_to_line },
-    { "arrow_to_top", fa::arrow_up_to_line },
-    { "arrow_up_triangle_square", fa::arrow_up_triangle_square },
-    { "sort_shapes_up", fa::arrow_up_triangle_square },
-    { "arrow_up_wide_short", fa::arrow_up_wide_short },
-    { "sort_amount_up", fa::arrow_up_wide_short },
-    { "arrow_up_z_a", fa::arrow_up_z_a },
-    { "sort_alpha_up_alt", fa::arrow_up_z_a },
-    { "arrows_cross", fa::arrows_cross },
-    { "arrows_down_to_line", fa::arrows_down_to_line },
-    { "arrows_down_to_people", fa::arrows_down_to_people },
-    { "arrows_from_dotted_line", fa::arrows_from_dotted_line },
-    { "arrows_from_line", fa::arrows_from_line },
-    { "arrows_left_right", fa::arrows_left_right },
-    { "arrows_h", fa::arrows_left_right },
-    { "arrows_left_right_to_line", fa::arrows_left_right_to_line },
-    { "arrows_maximize", fa::arrows_maximize },
-    { "expand_arrows", fa::arrows_maximize },
-    { "arrows_minimize", fa::arrows_minimize },
-    { "compress_arrows", fa::arrows_minimize },
-    { "arrows_repeat", fa::arrows_repeat },
-    { "repeat_alt", fa::arrows_repeat },
-    { "arrows_repeat_1", fa::arrows_repeat_1 },
-    { "repeat_1_alt", fa::arrows_repeat_1 },
-    { "arrows_retweet", fa::arrows_retweet },
-    { "retweet_alt", fa::arrows_retweet },
-    { "arrows_rotate", fa::arrows_rotate },
-    { "refresh", fa::arrows_rotate },
-    { "sync", fa::arrows_rotate },
-    { "arrows_spin", fa::arrows_spin },
-    { "arrows_split_up_and_left", fa::arrows_split_up_and_left },
-    { "arrows_to_circle", fa::arrows_to_circle },
-    { "arrows_to_dot", fa::arrows_to_dot },
-    { "arrows_to_dotted_line", fa::arrows_to_dotted_line },
-    { "arrows_to_eye", fa::arrows_to_eye },
-    { "arrows_to_line", fa::arrows_to_line },
-    { "arrows_turn_right", fa::arrows_turn_right },
-    { "arrows_turn_to_dots", fa::arrows_turn_to_dots },
-    { "arrows_up_down", fa::arrows_up_down },
-    { "arrows_v", fa::arrows_up_down },
-    { "arrows_up_down_left_right", fa::arrows_up_down_left_right },
-    { "arrows", fa::arrows_up_down_left_right },
-    { "arrows_up_to_line", fa::arrows_up_to_line },
-    { "asterisk", fa::asterisk },
-    { "at", fa::at },
-    { "atom", fa::atom },
-    { "atom_simple", fa::atom_simple },
-    { "atom_alt", fa::atom_simple },
-    { "audio_description", fa::audio_description },
-    { "audio_description_slash", fa::audio_description_slash },
-    { "austral_sign", fa::austral_sign },
-    { "avocado", fa::avocado },
-    { "award", fa::award },
-    { "award_simple", fa::award_simple },
-    { "axe", fa::axe },
-    { "axe_battle", fa::axe_battle },
-    { "b", fa::b },
-    { "baby", fa::baby },
-    { "baby_carriage", fa::baby_carriage },
-    { "carriage_baby", fa::baby_carriage },
-    { "backpack", fa::backpack },
-    { "backward", fa::backward },
-    { "backward_fast", fa::backward_fast },
-    { "fast_backward", fa::backward_fast },
-    { "backward_step", fa::backward_step },
-    { "step_backward", fa::backward_step },
-    { "bacon", fa::bacon },
-    { "bacteria", fa::bacteria },
-    { "bacterium", fa::bacterium },
-    { "badge", fa::badge },
-    { "badge_check", fa::badge_check },
-    { "badge_dollar", fa::badge_dollar },
-    { "badge_percent", fa::badge_percent },
-    { "badge_sheriff", fa::badge_sheriff },
-    { "badger_honey", fa::badger_honey },
-    { "badminton", fa::badminton },
-    { "bag_shopping", fa::bag_shopping },
-    { "shopping_bag", fa::bag_shopping },
-    { "bagel", fa::bagel },
-    { "bags_shopping", fa::bags_shopping },
-    { "baguette", fa::baguette },
-    { "bahai", fa::bahai },
-    { "baht_sign", fa::baht_sign },
-    { "ball_pile", fa::ball_pile },
-    { "balloon", fa::balloon },
-    { "balloons", fa::balloons },
-    { "ballot", fa::ballot },
-    { "ballot_check", fa::ballot_check },
-    { "ban", fa::ban },
-    { "cancel", fa::ban },
-    { "ban_bug", fa::ban_bug },
-    { "debug", fa::ban_bug },
-    { "ban_parking", fa::ban_parking },
-    { "parking_circle_slash", fa::ban_parking },
-    { "ban_smoking", fa::ban_smoking },
-    { "smoking_ban", fa::ban_smoking },
-    { "banana", fa::banana },
-    { "bandage", fa::bandage },
-    { "band_aid", fa::bandage },
-    { "bangladeshi_taka_sign", fa::bangladeshi_taka_sign },
-    { "banjo", fa::banjo },
-    { "barcode", fa::barcode },
-    { "barcode_read", fa::barcode_read },
-    { "barcode_scan", fa::barcode_scan },
-    { "bars", fa::bars },
-    { "navicon", fa::bars },
-    { "bars_filter", fa::bars_filter },
-    { "bars_progress", fa::bars_progress },
-    { "tasks_alt", fa::bars_progress },
-    { "bars_sort", fa::bars_sort },
-    { "bars_staggered", fa::bars_staggered },
-    { "reorder", fa::bars_staggered },
-    { "stream", fa::bars_staggered },
-    { "baseball", fa::baseball },
-    { "baseball_ball", fa::baseball },
-    { "baseball_bat_ball", fa::baseball_bat_ball },
-    { "basket_shopping", fa::basket_shopping },
-    { "shopping_basket", fa::basket_shopping },
-    { "basket_shopping_simple", fa::basket_shopping_simple },
-    { "shopping_basket_alt", fa::basket_shopping_simple },
-    { "basketball", fa::basketball },
-    { "basketball_ball", fa::basketball },
-    { "basketball_hoop", fa::basketball_hoop },
-    { "bat", fa::bat },
-    { "bath", fa::bath },
-    { "bathtub", fa::bath },
-    { "battery_bolt", fa::battery_bolt },
-    { "battery_empty", fa::battery_empty },
-    { "battery_0", fa::battery_empty },
-    { "battery_exclamation", fa::battery_exclamation },
-    { "battery_full", fa::battery_full },
-    { "battery", fa::battery_full },
-    { "battery_5", fa::battery_full },
-    { "battery_half", fa::battery_half },
-    { "battery_3", fa::battery_half },
-    { "battery_low", fa::battery_low },
-    { "battery_1", fa::battery_low },
-    { "battery_quarter", fa::battery_quarter },
-    { "battery_2", fa::battery_quarter },
-    { "battery_slash", fa::battery_slash },
-    { "battery_three_quarters", fa::battery_three_quarters },
-    { "battery_4", fa::battery_three_quarters },
-    { "bed", fa::bed },
-    { "bed_bunk", fa::bed_bunk },
-    { "bed_empty", fa::bed_empty },
-    { "bed_front", fa::bed_front },
-    { "bed_alt", fa::bed_front },
-    { "bed_pulse", fa::bed_pulse },
-    { "procedures", fa::bed_pulse },
-    { "bee", fa::bee },
-    { "beer_mug", fa::beer_mug },
-    { "beer_foam", fa::beer_mug },
-    { "beer_mug_empty", fa::beer_mug_empty },
-    { "beer", fa::beer_mug_empty },
-    { "bell", fa::bell },
-    { "bell_concierge", fa::bell_concierge },
-    { "concierge_bell", fa::bell_concierge },
-    { "bell_exclamation", fa::bell_exclamation },
-    { "bell_on", fa::bell_on },
-    { "bell_plus", fa::bell_plus },
-    { "bell_school", fa::bell_school },
-    { "bell_school_slash", fa::bell_school_slash },
-    { "bell_slash", fa::bell_slash },
-    { "bells", fa::bells },
-    { "bench_tree", fa::bench_tree },
-    { "bezier_curve", fa::bezier_curve },
-    { "bicycle", fa::bicycle },
-    { "binary", fa::binary },
-    { "binary_circle_check", fa::binary_circle_check },
-    { "binary_lock", fa::binary_lock },
-    { "binary_slash", fa::binary_slash },
-    { "binoculars", fa::binoculars },
-    { "biohazard", fa::biohazard },
-    { "bird", fa::bird },
-    { "bitcoin_sign", fa::bitcoin_sign },
-    { "blanket", fa::blanket },
-    { "blanket_fire", fa::blanket_fire },
-    { "blender", fa::blender },
-    { "blender_phone", fa::blender_phone },
-    { "blinds", fa::blinds },
-    { "blinds_open", fa::blinds_open },
-    { "blinds_raised", fa::blinds_raised },
-    { "block", fa::block },
-    { "block_brick", fa::block_brick },
-    { "wall_brick", fa::block_brick },
-    { "block_brick_fire", fa::block_brick_fire },
-    { "firewall", fa::block_brick_fire },
-    { "block_question", fa::block_question },
-    { "block_quote", fa::block_quote },
-    { "blog", fa::blog },
-    { "blueberries", fa::blueberries },
-    { "bold", fa::bold },
-    { "bolt", fa::bolt },
-    { "zap", fa::bolt },
-    { "bolt_auto", fa::bolt_auto },
-    { "bolt_lightning", fa::bolt_lightning },
-    { "bolt_slash", fa::bolt_slash },
-    { "bomb", fa::bomb },
-    { "bone", fa::bone },
-    { "bone_break", fa::bone_break },
-    { "bong", fa::bong },
-    { "book", fa::book },
-    { "book_arrow_right", fa::book_arrow_right },
-    { "book_arrow_up", fa::book_arrow_up },
-    { "book_atlas", fa::book_atlas },
-    { "atlas", fa::book_atlas },
-    { "book_bible", fa::book_bible },
-    { "bible", fa::book_bible },
-    { "book_blank", fa::book_blank },
-    { "book_alt", fa::book_blank },
-    { "book_bookmark", fa::book_bookmark },
-    { "book_circle_arrow_right", fa::book_circle_arrow_right },
-    { "book_circle_arrow_up", fa::book_circle_arrow_up },
-    { "book_copy", fa::book_copy },
-    { "book_font", fa::book_font },
-    { "book_heart", fa::book_heart },
-    { "book_journal_whills", fa::book_journal_whills },
-    { "journal_whills", fa::book_journal_whills },
-    { "book_medical", fa::book_medical },
-    { "book_open", fa::book_open },
-    { "book_open_cover", fa::book_open_cover },
-    { "book_open_alt", fa::book_open_cover },
-    { "book_open_reader", fa::book_open_reader },
-    { "book_reader", fa::book_open_reader },
-    { "book_quran", fa::book_quran },
-    { "quran", fa::book_quran },
-    { "book_section", fa::book_section },
-    { "book_law", fa::book_section },
-    { "book_skull", fa::book_skull },
-    { "book_dead", fa::book_skull },
-    { "book_sparkles", fa::book_sparkles },
-    { "book_spells", fa::book_sparkles },
-    { "book_tanakh", fa::book_tanakh },
-    { "tanakh", fa::book_tanakh },
-    { "book_user", fa::book_user },
-    { "bookmark", fa::bookmark },
-    { "bookmark_slash", fa::bookmark_slash },
-    { "books", fa::books },
-    { "books_medical", fa::books_medical },
-    { "boombox", fa::boombox },
-    { "boot", fa::boot },
-    { "boot_heeled", fa::boot_heeled },
-    { "booth_curtain", fa::booth_curtain },
-    { "border_all", fa::border_all },
-    { "border_bottom", fa::border_bottom },
-    { "border_bottom_right", fa::border_bottom_right },
-    { "border_style_alt", fa::border_bottom_right },
-    { "border_center_h", fa::border_center_h },
-    { "border_center_v", fa::border_center_v },
-    { "border_inner", fa::border_inner },
-    { "border_left", fa::border_left },
-    { "border_none", fa::border_none },
-    { "border_outer", fa::border_outer },
-    { "border_right", fa::border_right },
-    { "border_top", fa::border_top },
-    { "border_top_left", fa::border_top_left },
-    { "border_style", fa::border_top_left },
-    { "bore_hole", fa::bore_hole },
-    { "bottle_droplet", fa::bottle_droplet },
-    { "bottle_water", fa::bottle_water },
-    { "bow_arrow", fa::bow_arrow },
-    { "bowl_chopsticks", fa::bowl_chopsticks },
-    { "bowl_chopsticks_noodles", fa::bowl_chopsticks_noodles },
-    { "bowl_food", fa::bowl_food },
-    { "bowl_hot", fa::bowl_hot },
-    { "soup", fa::bowl_hot },
-    { "bowl_rice", fa::bowl_rice },
-    { "bowl_scoop", fa::bowl_scoop },
-    { "bowl_shaved_ice", fa::bowl_scoop },
-    { "bowl_scoops", fa::bowl_scoops },
-    { "bowl_soft_serve", fa::bowl_soft_serve },
-    { "bowl_spoon", fa::bowl_spoon },
-    { "bowling_ball", fa::bowling_ball },
-    { "bowling_ball_pin", fa::bowling_ball_pin },
-    { "bowling_pins", fa::bowling_pins },
-    { "box", fa::box },
-    { "box_archive", fa::box_archive },
-    { "archive", fa::box_archive },
-    { "box_ballot", fa::box_ballot },
-    { "box_check", fa::box_check },
-    { "box_circle_check", fa::box_circle_check },
-    { "box_dollar", fa::box_dollar },
-    { "box_usd", fa::box_dollar },
-    { "box_heart", fa::box_heart },
-    { "box_open", fa::box_open },
-    { "box_open_full", fa::box_open_full },
-    { "box_full", fa::box_open_full },
-    { "box_taped", fa::box_taped },
-    { "box_alt", fa::box_taped },
-    { "box_tissue", fa::box_tissue },
-    { "boxes_packing", fa::boxes_packing },
-    { "boxes_stacked", fa::boxes_stacked },
-    { "boxes", fa::boxes_stacked },
-    { "boxes_alt", fa::boxes_stacked },
-    { "boxing_glove", fa::boxing_glove },
-    { "glove_boxing", fa::boxing_glove },
-    { "bracket_curly", fa::bracket_curly },
-    { "bracket_curly_left", fa::bracket_curly },
-    { "bracket_curly_right", fa::bracket_curly_right },
-    { "bracket_round", fa::bracket_round },
-    { "parenthesis", fa::bracket_round },
-    { "bracket_round_right", fa::bracket_round_right },
-    { "bracket_square", fa::bracket_square },
-    { "bracket", fa::bracket_square },
-    { "bracket_left", fa::bracket_square },
-    { "bracket_square_right", fa::bracket_square_right },
-    { "brackets_curly", fa::brackets_curly },
-    { "brackets_round", fa::brackets_round },
-    { "parentheses", fa::brackets_round },
-    { "brackets_square", fa::brackets_square },
-    { "brackets", fa::brackets_square },
-    { "braille", fa::braille },
-    { "brain", fa::brain },
-    { "brain_arrow_curved_right", fa::brain_arrow_curved_right },
-    { "mind_share", fa::brain_arrow_curved_right },
-    { "brain_circuit", fa::brain_circuit },
-    { "brake_warning", fa::brake_warning },
-    { "brazilian_real_sign", fa::brazilian_real_sign },
-    { "bread_loaf", fa::bread_loaf },
-    { "bread_slice", fa::bread_slice },
-    { "bread_slice_butter", fa::bread_slice_butter },
-    { "bridge", fa::bridge },
-    { "bridge_circle_check", fa::bridge_circle_check },
-    { "bridge_circle_exclamation", fa::bridge_circle_exclamation },
-    { "bridge_circle_xmark", fa::bridge_circle_xmark },
-    { "bridge_lock", fa::bridge_lock },
-    { "bridge_suspension", fa::bridge_suspension },
-    { "bridge_water", fa::bridge_water },
-    { "briefcase", fa::briefcase },
-    { "briefcase_arrow_right", fa::briefcase_arrow_right },
-    { "briefcase_blank", fa::briefcase_blank },
-    { "briefcase_medical", fa::briefcase_medical },
-    { "brightness", fa::brightness },
-    { "brightness_low", fa::brightness_low },
-    { "bring_forward", fa::bring_forward },
-    { "bring_front", fa::bring_front },
-    { "broccoli", fa::broccoli },
-    { "broom", fa::broom },
-    { "broom_ball", fa::broom_ball },
-    { "quidditch", fa::broom_ball },
-    { "quidditch_broom_ball", fa::broom_ball },
-    { "browser", fa::browser },
-    { "browsers", fa::browsers },
-    { "brush", fa::brush },
-    { "bucket", fa::bucket },
-    { "bug", fa::bug },
-    { "bug_slash", fa::bug_slash },
-    { "bugs", fa::bugs },
-    { "building", fa::building },
-    { "building_circle_arrow_right", fa::building_circle_arrow_right },
-    { "building_circle_check", fa::building_circle_check },
-    { "building_circle_exclamation", fa::building_circle_exclamation },
-    { "building_circle_xmark", fa::building_circle_xmark },
-    { "building_columns", fa::building_columns },
-    { "bank", fa::building_columns },
-    { "institution", fa::building_columns },
-    { "museum", fa::building_columns },
-    { "university", fa::building_columns },
-    { "building_flag", fa::building_flag },
-    { "building_lock", fa::building_lock },
-    { "building_ngo", fa::building_ngo },
-    { "building_shield", fa::building_shield },
-    { "building_un", fa::building_un },
-    { "building_user", fa::building_user },
-    { "building_wheat", fa::building_wheat },
-    { "buildings", fa::buildings },
-    { "bullhorn", fa::bullhorn },
-    { "bullseye", fa::bullseye },
-    { "bullseye_arrow", fa::bullseye_arrow },
-    { "bullseye_pointer", fa::bullseye_pointer },
-    { "burger", fa::burger },
-    { "hamburger", fa::burger },
-    { "burger_cheese", fa::burger_cheese },
-    { "cheeseburger", fa::burger_cheese },
-    { "burger_fries", fa::burger_fries },
-    { "burger_glass", fa::burger_glass },
-    { "burger_lettuce", fa::burger_lettuce },
-    { "burger_soda", fa::burger_soda },
-    { "burrito", fa::burrito },
-    { "burst", fa::burst },
-    { "bus", fa::bus },
-    { "bus_school", fa::bus_school },
-    { "bus_simple", fa::bus_simple },
-    { "bus_alt", fa::bus_simple },
-    { "business_time", fa::business_time },
-    { "briefcase_clock", fa::business_time },
-    { "butter", fa::butter },
-    { "c", fa::c },
-    { "cabin", fa::cabin },
-    { "cabinet_filing", fa::cabinet_filing },
-    { "cable_car", fa::cable_car },
-    { "cactus", fa::cactus },
-    { "cake_candles", fa::cake_candles },
-    { "birthday_cake", fa::cake_candles },
-    { "cake", fa::cake_candles },
-    { "cake_slice", fa::cake_slice },
-    { "shortcake", fa::cake_slice },
-    { "calculator", fa::calculator },
-    { "calculator_simple", fa::calculator_simple },
-    { "calculator_alt", fa::calculator_simple },
-    { "calendar", fa::calendar },
-    { "calendar_arrow_down", fa::calendar_arrow_down },
-    { "calendar_download", fa::calendar_arrow_down },
-    { "calendar_arrow_up", fa::calendar_arrow_up },
-    { "calendar_upload", fa::calendar_arrow_up },
-    { "calendar_check", fa::calendar_check },
-    { "calendar_circle_exclamation", fa::calendar_circle_exclamation },
-    { "calendar_circle_minus", fa::calendar_circle_minus },
-    { "calendar_circle_plus", fa::calendar_circle_plus },
-    { "calendar_circle_user", fa::calendar_circle_user },
-    { "calendar_clock", fa::calendar_clock },
-    { "calendar_time", fa::calendar_clock },
-    { "calendar_day", fa::calendar_day },
-    { "calendar_days", fa::calendar_days },
-    { "calendar_alt", fa::calendar_days },
-    { "calendar_exclamation", fa::calendar_exclamation },
-    { "calendar_heart", fa::calendar_heart },
-    { "calendar_image", fa::calendar_image },
-    { "calendar_lines", fa::calendar_lines },
-    { "calendar_note", fa::calendar_lines },
-    { "calendar_lines_pen", fa::calendar_lines_pen },
-    { "calendar_minus", fa::calendar_minus },
-    { "calendar_pen", fa::calendar_pen },
-    { "calendar_edit", fa::calendar_pen },
-    { "calendar_plus", fa::calendar_plus },
-    { "calendar_range", fa::calendar_range },
-    { "calendar_star", fa::calendar_star },
-    { "calendar_week", fa::calendar_week },
-    { "calendar_xmark", fa::calendar_xmark },
-    { "calendar_times", fa::calendar_xmark },
-    { "calendars", fa::calendars },
-    { "camcorder", fa::camcorder },
-    { "video_handheld", fa::camcorder },
-    { "camera", fa::camera },
-    { "camera_alt", fa::camera },
-    { "camera_cctv", fa::camera_cctv },
-    { "cctv", fa::camera_cctv },
-    { "camera_movie", fa::camera_movie },
-    { "camera_polaroid", fa::camera_polaroid },
-    { "camera_retro", fa::camera_retro },
-    { "camera_rotate", fa::camera_rotate },
-    { "camera_security", fa::camera_security },
-    { "camera_home", fa::camera_security },
-    { "camera_slash", fa::camera_slash },
-    { "camera_viewfinder", fa::camera_viewfinder },
-    { "screenshot", fa::camera_viewfinder },
-    { "camera_web", fa::camera_web },
-    { "webcam", fa::camera_web },
-    { "camera_web_slash", fa::camera_web_slash },
-    { "webcam_slash", fa::camera_web_slash },
-    { "campfire", fa::campfire },
-    { "campground", fa::campground },
-    { "can_food", fa::can_food },
-    { "candle_holder", fa::candle_holder },
-    { "candy", fa::candy },
-    { "candy_bar", fa::candy_bar },
-    { "chocolate_bar", fa::candy_bar },
-    { "candy_cane", fa::candy_cane },
-    { "candy_corn", fa::candy_corn },
-    { "cannabis", fa::cannabis },
-    { "capsules", fa::capsules },
-    { "car", fa::car },
-    { "automobile", fa::car },
-    { "car_battery", fa::car_battery },
-    { "battery_car", fa::car_battery },
-    { "car_bolt", fa::car_bolt },
-    { "car_building", fa::car_building },
-    { "car_bump", fa::car_bump },
-    { "car_burst", fa::car_burst },
-    { "car_crash", fa::car_burst },
-    { "car_bus", fa::car_bus },
-    { "car_circle_bolt", fa::car_circle_bolt },
-    { "car_garage", fa::car_garage },
-    { "car_mirrors", fa::car_mirrors },
-    { "car_on", fa::car_on },
-    { "car_rear", fa::car_rear },
-    { "car_alt", fa::car_rear },
-    { "car_side", fa::car_side },
-    { "car_side_bolt", fa::car_side_bolt },
-    { "car_tilt", fa::car_tilt },
-    { "car_tunnel", fa::car_tunnel },
-    { "car_wash", fa::car_wash },
-    { "car_wrench", fa::car_wrench },
-    { "car_mechanic", fa::car_wrench },
-    { "caravan", fa::caravan },
-    { "caravan_simple", fa::caravan_simple },
-    { "caravan_alt", fa::caravan_simple },
-    { "card_club", fa::card_club },
-    { "card_diamond", fa::card_diamond },
-    { "card_heart", fa::card_heart },
-    { "card_spade", fa::card_spade },
-    { "cards", fa::cards },
-    { "cards_blank", fa::cards_blank },
-    { "caret_down", fa::caret_down },
-    { "caret_left", fa::caret_left },
-    { "caret_right", fa::caret_right },
-    { "caret_up", fa::caret_up },
-    { "carrot", fa::carrot },
-    { "cars", fa::cars },
-    { "cart_arrow_down", fa::cart_arrow_down },
-    { "cart_arrow_up", fa::cart_arrow_up },
-    { "cart_circle_arrow_down", fa::cart_circle_arrow_down },
-    { "cart_circle_arrow_up", fa::cart_circle_arrow_up },
-    { "cart_circle_check", fa::cart_circle_check },
-    { "cart_circle_exclamation", fa::cart_circle_exclamation },
-    { "cart_circle_plus", fa::cart_circle_plus },
-    { "cart_circle_xmark", fa::cart_circle_xmark },
-    { "cart_flatbed", fa::cart_flatbed },
-    { "dolly_flatbed", fa::cart_flatbed },
-    { "cart_flatbed_boxes", fa::cart_flatbed_boxes },
-    { "dolly_flatbed_alt", fa::cart_flatbed_boxes },
-    { "cart_flatbed_empty", fa::cart_flatbed_empty },
-    { "dolly_flatbed_empty", fa::cart_flatbed_empty },
-    { "cart_flatbed_suitcase", fa::cart_flatbed_suitcase },
-    { "luggage_cart", fa::cart_flatbed_suitcase },
-    { "cart_minus", fa::cart_minus },
-    { "cart_plus", fa::cart_plus },
-    { "cart_shopping", fa::cart_shopping },
-    { "shopping_cart", fa::cart_shopping },
-    { "cart_shopping_fast", fa::cart_shopping_fast },
-    { "cart_xmark", fa::cart_xmark },
-    { "cash_register", fa::cash_register },
-    { "cassette_betamax", fa::cassette_betamax },
-    { "betamax", fa::cassette_betamax },
-    { "cassette_tape", fa::cassette_tape },
-    { "cassette_vhs", fa::cassette_vhs },
-    { "vhs", fa::cassette_vhs },
-    { "castle", fa::castle },
-    { "cat", fa::cat },
-    { "cat_space", fa::cat_space },
-    { "cauldron", fa::cauldron },
-    { "cedi_sign", fa::cedi_sign },
-    { "cent_sign", fa::cent_sign },
-    { "certificate", fa::certificate },
-    { "chair", fa::chair },
-    { "chair_office", fa::chair_office },
-    { "chalkboard", fa::chalkboard },
-    { "blackboard", fa::chalkboard },
-    { "chalkboard_user", fa::chalkboard_user },
-    { "chalkboard_teacher", fa::chalkboard_user },
-    { "champagne_glass", fa::champagne_glass },
-    { "glass_champagne", fa::champagne_glass },
-    { "champagne_glasses", fa::champagne_glasses },
-    { "glass_cheers", fa::champagne_glasses },
-    { "charging_station", fa::charging_station },
-    { "chart_area", fa::chart_area },
-    { "area_chart", fa::chart_area },
-    { "chart_bar", fa::chart_bar },
-    { "bar_chart", fa::chart_bar },
-    { "chart_bullet", fa::chart_bullet },
-    { "chart_candlestick", fa::chart_candlestick },
-    { "chart_column", fa::chart_column },
-    { "chart_gantt", fa::chart_gantt },
-    { "chart_line", fa::chart_line },
-    { "line_chart", fa::chart_line },
-    { "chart_line_down", fa::chart_line_down },
-    { "chart_line_up", fa::chart_line_up },
-    { "chart_mixed", fa::chart_mixed },
-    { "analytics", fa::chart_mixed },
-    { "chart_network", fa::chart_network },
-    { "chart_pie", fa::chart_pie },
-    { "pie_chart", fa::chart_pie },
-    { "chart_pie_simple", fa::chart_pie_simple },
-    { "chart_pie_alt", fa::chart_pie_simple },
-    { "chart_pyramid", fa::chart_pyramid },
-    { "chart_radar", fa::chart_radar },
-    { "chart_scatter", fa::chart_scatter },
-    { "chart_scatter_3d", fa::chart_scatter_3d },
-    { "chart_scatter_bubble", fa::chart_scatter_bubble },
-    { "chart_simple", fa::chart_simple },
-    { "chart_simple_horizontal", fa::chart_simple_horizontal },
-    { "chart_tree_map", fa::chart_tree_map },
-    { "chart_user", fa::chart_user },
-    { "user_chart", fa::chart_user },
-    { "chart_waterfall", fa::chart_waterfall },
-    { "check", fa::check },
-    { "check_double", fa::check_double },
-    { "check_to_slot", fa::check_to_slot },
-    { "vote_yea", fa::check_to_slot },
-    { "cheese", fa::cheese },
-    { "cheese_swiss", fa::cheese_swiss },
-    { "cherries", fa::cherries },
-    { "chess", fa::chess },
-    { "chess_bishop", fa::chess_bishop },
-    { "chess_bishop_piece", fa::chess_bishop_piece },
-    { "chess_bishop_alt", fa::chess_bishop_piece },
-    { "chess_board", fa::chess_board },
-    { "chess_clock", fa::chess_clock },
-    { "chess_clock_flip", fa::chess_clock_flip },
-    { "chess_clock_alt", fa::chess_clock_flip },
-    { "chess_king", fa::chess_king },
-    { "chess_king_piece", fa::chess_king_piece },
-    { "chess_king_alt", fa::chess_king_piece },
-    { "chess_knight", fa::chess_knight },
-    { "chess_knight_piece", fa::chess_knight_piece },
-    { "chess_knight_alt", fa::chess_knight_piece },
-    { "chess_pawn", fa::chess_pawn },
-    { "chess_pawn_piece", fa::chess_pawn_piece },
-    { "chess_pawn_alt", fa::chess_pawn_piece },
-    { "chess_queen", fa::chess_queen },
-    { "chess_queen_piece", fa::chess_queen_piece },
-    { "chess_queen_alt", fa::chess_queen_piece },
-    { "chess_rook", fa::chess_rook },
-    { "chess_rook_piece", fa::chess_rook_piece },
-    { "chess_rook_alt", fa::chess_rook_piece },
-    { "chestnut", fa::chestnut },
-    { "chevron_down", fa::chevron_down },
-    { "chevron_left", fa::chevron_left },
-    { "chevron_right", fa::chevron_right },
-    { "chevron_up", fa::chevron_up },
-    { "chevrons_down", fa::chevrons_down },
-    { "chevron_double_down", fa::chevrons_down },
-    { "chevrons_left", fa::chevrons_left },
-    { "chevron_double_left", fa::chevrons_left },
-    { "chevrons_right", fa::chevrons_right },
-    { "chevron_double_right", fa::chevrons_right },
-    { "chevrons_up", fa::chevrons_up },
-    { "chevron_double_up", fa::chevrons_up },
-    { "child", fa::child },
-    { "child_dress", fa::child_dress },
-    { "child_reaching", fa::child_reaching },
-    { "child_rifle", fa::child_rifle },
-    { "children", fa::children },
-    { "chimney", fa::chimney },
-    { "chopsticks", fa::chopsticks },
-    { "church", fa::church },
-    { "circle", fa::circle },
-    { "circle_0", fa::circle_0 },
-    { "circle_1", fa::circle_1 },
-    { "circle_2", fa::circle_2 },
-    { "circle_3", fa::circle_3 },
-    { "circle_4", fa::circle_4 },
-    { "circle_5", fa::circle_5 },
-    { "circle_6", fa::circle_6 },
-    { "circle_7", fa::circle_7 },
-    { "circle_8", fa::circle_8 },
-    { "circle_9", fa::circle_9 },
-    { "circle_a", fa::circle_a },
-    { "circle_ampersand", fa::circle_ampersand },
-    { "circle_arrow_down", fa::circle_arrow_down },
-    { "arrow_circle_down", fa::circle_arrow_down },
-    { "circle_arrow_down_left", fa::circle_arrow_down_left },
-    { "circle_arrow_down_right", fa::circle_arrow_down_right },
-    { "circle_arrow_left", fa::circle_arrow_left },
-    { "arrow_circle_left", fa::circle_arrow_left },
-    { "circle_arrow_right", fa::circle_arrow_right },
-    { "arrow_circle_right", fa::circle_arrow_right },
-    { "circle_arrow_up", fa::circle_arrow_up },
-    { "arrow_circle_up", fa::circle_arrow_up },
-    { "circle_arrow_up_left", fa::circle_arrow_up_left },
-    { "circle_arrow_up_right", fa::circle_arrow_up_right },
-    { "circle_b", fa::circle_b },
-    { "circle_bolt", fa::circle_bolt },
-    { "circle_book_open", fa::circle_book_open },
-    { "book_circle", fa::circle_book_open },
-    { "circle_bookmark", fa::circle_bookmark },
-    { "bookmark_circle", fa::circle_bookmark },
-    { "circle_c", fa::circle_c },
-    { "circle_calendar", fa::circle_calendar },
-    { "calendar_circle", fa::circle_calendar },
-    { "circle_camera", fa::circle_camera },
-    { "camera_circle", fa::circle_camera },
-    { "circle_caret_down", fa::circle_caret_down },
-    { "caret_circle_down", fa::circle_caret_down },
-    { "circle_caret_left", fa::circle_caret_left },
-    { "caret_circle_left", fa::circle_caret_left },
-    { "circle_caret_right", fa::circle_caret_right },
-    { "caret_circle_right", fa::circle_caret_right },
-    { "circle_caret_up", fa::circle_caret_up },
-    { "caret_circle_up", fa::circle_caret_up },
-    { "circle_check", fa::circle_check },
-    { "check_circle", fa::circle_check },
-    { "circle_chevron_down", fa::circle_chevron_down },
-    { "chevron_circle_down", fa::circle_chevron_down },
-    { "circle_chevron_left", fa::circle_chevron_left },
-    { "chevron_circle_left", fa::circle_chevron_left },
-    { "circle_chevron_right", fa::circle_chevron_right },
-    { "chevron_circle_right", fa::circle_chevron_right },
-    { "circle_chevron_up", fa::circle_chevron_up },
-    { "chevron_circle_up", fa::circle_chevron_up },
-    { "circle_d", fa::circle_d },
-    { "circle_dashed", fa::circle_dashed },
-    { "circle_divide", fa::circle_divide },
-    { "circle_dollar", fa::circle_dollar },
-    { "dollar_circle", fa::circle_dollar },
-    { "usd_circle", fa::circle_dollar },
-    { "circle_dollar_to_slot", fa::circle_dollar_to_slot },
-    { "donate", fa::circle_dollar_to_slot },
-    { "circle_dot", fa::circle_dot },
-    { "dot_circle", fa::circle_dot },
-    { "circle_down", fa::circle_down },
-    { "arrow_alt_circle_down", fa::circle_down },
-    { "circle_down_left", fa::circle_down_left },
-    { "circle_down_right", fa::circle_down_right },
-    { "circle_e", fa::circle_e },
-    { "circle_ellipsis", fa::circle_ellipsis },
-    { "circle_ellipsis_vertical", fa::circle_ellipsis_vertical },
-    { "circle_envelope", fa::circle_envelope },
-    { "envelope_circle", fa::circle_envelope },
-    { "circle_exclamation", fa::circle_exclamation },
-    { "exclamation_circle", fa::circle_exclamation },
-    { "circle_exclamation_check", fa::circle_exclamation_check },
-    { "circle_f", fa::circle_f },
-    { "circle_g", fa::circle_g },
-    { "circle_h", fa::circle_h },
-    { "hospital_symbol", fa::circle_h },
-    { "circle_half", fa::circle_half },
-    { "circle_half_stroke", fa::circle_half_stroke },
-    { "adjust", fa::circle_half_stroke },
-    { "circle_heart", fa::circle_heart },
-    { "heart_circle", fa::circle_heart },
-    { "circle_i", fa::circle_i },
-    { "circle_info", fa::circle_info },
-    { "info_circle", fa::circle_info },
-    { "circle_j", fa::circle_j },
-    { "circle_k", fa::circle_k },
-    { "circle_l", fa::circle_l },
-    { "circle_left", fa::circle_left },
-    { "arrow_alt_circle_left", fa::circle_left },
-    { "circle_location_arrow", fa::circle_location_arrow },
-    { "location_circle", fa::circle_location_arrow },
-    { "circle_m", fa::circle_m },
-    { "circle_microphone", fa::circle_microphone },
-    { "microphone_circle", fa::circle_microphone },
-    { "circle_microphone_lines", fa::circle_microphone_lines },
-    { "microphone_circle_alt", fa::circle_microphone_lines },
-    { "circle_minus", fa::circle_minus },
-    { "minus_circle", fa::circle_minus },
-    { "circle_n", fa::circle_n },
-    { "circle_nodes", fa::circle_nodes },
-    { "circle_notch", fa::circle_notch },
-    { "circle_o", fa::circle_o },
-    { "circle_p", fa::circle_p },
-    { "circle_parking", fa::circle_parking },
-    { "parking_circle", fa::circle_parking },
-    { "circle_pause", fa::circle_pause },
-    { "pause_circle", fa::circle_pause },
-    { "circle_phone", fa::circle_phone },
-    { "phone_circle", fa::circle_phone },
-    { "circle_phone_flip", fa::circle_phone_flip },
-    { "phone_circle_alt", fa::circle_phone_flip },
-    { "circle_phone_hangup", fa::circle_phone_hangup },
-    { "phone_circle_down", fa::circle_phone_hangup },
-    { "circle_play", fa::circle_play },
-    { "play_circle", fa::circle_play },
-    { "circle_plus", fa::circle_plus },
-    { "plus_circle", fa::circle_plus },
-    { "circle_q", fa::circle_q },
-    { "circle_quarter", fa::circle_quarter },
-    { "circle_quarters", fa::circle_quarters },
-    { "circle_question", fa::circle_question },
-    { "question_circle", fa::circle_question },
-    { "circle_r", fa::circle_r },
-    { "circle_radiation", fa::circle_radiation },
-    { "radiation_alt", fa::circle_radiation },
-    { "circle_right", fa::circle_right },
-    { "arrow_alt_circle_right", fa::circle_right },
-    { "circle_s", fa::circle_s },
-    { "circle_small", fa::circle_small },
-    { "circle_sort", fa::circle_sort },
-    { "sort_circle", fa::circle_sort },
-    { "circle_sort_down", fa::circle_sort_down },
-    { "sort_circle_down", fa::circle_sort_down },
-    { "circle_sort_up", fa::circle_sort_up },
-    { "sort_circle_up", fa::circle_sort_up },
-    { "circle_star", fa::circle_star },
-    { "star_circle", fa::circle_star },
-    { "circle_stop", fa::circle_stop },
-    { "stop_circle", fa::circle_stop },
-    { "circle_t", fa::circle_t },
-    { "circle_three_quarters", fa::circle_three_quarters },
-    { "circle_trash", fa::circle_trash },
-    { "trash_circle", fa::circle_trash },
-    { "circle_u", fa::circle_u },
-    { "circle_up", fa::circle_up },
-    { "arrow_alt_circle_up", fa::circle_up },
-    { "circle_up_left", fa::circle_up_left },
-    { "circle_up_right", fa::circle_up_right },
-    { "circle_user", fa::circle_user },
-    { "user_circle", fa::circle_user },
-    { "circle_v", fa::circle_v },
-    { "circle_video", fa::circle_video },
-    { "video_circle", fa::circle_video },
-    { "circle_w", fa::circle_w },
-    { "circle_waveform_lines", fa::circle_waveform_lines },
-    { "waveform_circle", fa::circle_waveform_lines },
-    { "circle_x", fa::circle_x },
-    { "circle_xmark", fa::circle_xmark },
-    { "times_circle", fa::circle_xmark },
-    { "xmark_circle", fa::circle_xmark },
-    { "circle_y", fa::circle_y },
-    { "circle_z", fa::circle_z },
-    { "citrus", fa::citrus },
-    { "citrus_slice", fa::citrus_slice },
-    { "city", fa::city },
-    { "clapperboard", fa::clapperboard },
-    { "clapperboard_play", fa::clapperboard_play },
-    { "clarinet", fa::clarinet },
-    { "claw_marks", fa::claw_marks },
-    { "clipboard", fa::clipboard },
-    { "clipboard_check", fa::clipboard_check },
-    { "clipboard_list", fa::clipboard_list },
-    { "clipboard_list_check", fa::clipboard_list_check },
-    { "clipboard_medical", fa::clipboard_medical },
-    { "clipboard_prescription", fa::clipboard_prescription },
-    { "clipboard_question", fa::clipboard_question },
-    { "clipboard_user", fa::clipboard_user },
-    { "clock", fa::clock },
-    { "clock_four", fa::clock },
-    { "clock_desk", fa::clock_desk },
-    { "clock_eight", fa::clock_eight },
-    { "clock_eight_thirty", fa::clock_eight_thirty },
-    { "clock_eleven", fa::clock_eleven },
-    { "clock_eleven_thirty", fa::clock_eleven_thirty },
-    { "clock_five", fa::clock_five },
-    { "clock_five_thirty", fa::clock_five_thirty },
-    { "clock_four_thirty", fa::clock_four_thirty },
-    { "clock_nine", fa::clock_nine },
-    { "clock_nine_thirty", fa::clock_nine_thirty },
-    { "clock_one", fa::clock_one },
-    { "clock_one_thirty", fa::clock_one_thirty },
-    { "clock_rotate_left", fa::clock_rotate_left },
-    { "history", fa::clock_rotate_left },
-    { "clock_seven", fa::clock_seven },
-    { "clock_seven_thirty", fa::clock_seven_thirty },
-    { "clock_six", fa::clock_six },
-    { "clock_six_thirty", fa::clock_six_thirty },
-    { "clock_ten", fa::clock_ten },
-    { "clock_ten_thirty", fa::clock_ten_thirty },
-    { "clock_three", fa::clock_three },
-    { "clock_three_thirty", fa::clock_three_thirty },
-    { "clock_twelve", fa::clock_twelve },
-    { "clock_twelve_thirty", fa::clock_twelve_thirty },
-    { "clock_two", fa::clock_two },
-    { "clock_two_thirty", fa::clock_two_thirty },
-    { "clone", fa::clone },
-    { "closed_captioning", fa::closed_captioning },
-    { "closed_captioning_slash", fa::closed_captioning_slash },
-    { "clothes_hanger", fa::clothes_hanger },
-    { "cloud", fa::cloud },
-    { "cloud_arrow_down", fa::cloud_arrow_down },
-    { "cloud_download", fa::cloud_arrow_down },
-    { "cloud_download_alt", fa::cloud_arrow_down },
-    { "cloud_arrow_up", fa::cloud_arrow_up },
-    { "cloud_upload", fa::cloud_arrow_up },
-    { "cloud_upload_alt", fa::cloud_arrow_up },
-    { "cloud_bolt", fa::cloud_bolt },
-    { "thunderstorm", fa::cloud_bolt },
-    { "cloud_bolt_moon", fa::cloud_bolt_moon },
-    { "thunderstorm_moon", fa::cloud_bolt_moon },
-    { "cloud_bolt_sun", fa::cloud_bolt_sun },
-    { "thunderstorm_sun", fa::cloud_bolt_sun },
-    { "cloud_check", fa::cloud_check },
-    { "cloud_drizzle", fa::cloud_drizzle },
-    { "cloud_exclamation", fa::cloud_exclamation },
-    { "cloud_fog", fa::cloud_fog },
-    { "fog", fa::cloud_fog },
-    { "cloud_hail", fa::cloud_hail },
-    { "cloud_hail_mixed", fa::cloud_hail_mixed },
-    { "cloud_meatball", fa::cloud_meatball },
-    { "cloud_minus", fa::cloud_minus },
-    { "cloud_moon", fa::cloud_moon },
-    { "cloud_moon_rain", fa::cloud_moon_rain },
-    { "cloud_music", fa::cloud_music },
-    { "cloud_plus", fa::cloud_plus },
-    { "cloud_question", fa::cloud_question },
-    { "cloud_rain", fa::cloud_rain },
-    { "cloud_rainbow", fa::cloud_rainbow },
-    { "cloud_showers", fa::cloud_showers },
-    { "cloud_showers_heavy", fa::cloud_showers_heavy },
-    { "cloud_showers_water", fa::cloud_showers_water },
-    { "cloud_slash", fa::cloud_slash },
-    { "cloud_sleet", fa::cloud_sleet },
-    { "cloud_snow", fa::cloud_snow },
-    { "cloud_sun", fa::cloud_sun },
-    { "cloud_sun_rain", fa::cloud_sun_rain },
-    { "cloud_word", fa::cloud_word },
-    { "cloud_xmark", fa::cloud_xmark },
-    { "clouds", fa::clouds },
-    { "clouds_moon", fa::clouds_moon },
-    { "clouds_sun", fa::clouds_sun },
-    { "clover", fa::clover },
-    { "club", fa::club },
-    { "coconut", fa::coconut },
-    { "code", fa::code },
-    { "code_branch", fa::code_branch },
-    { "code_commit", fa::code_commit },
-    { "code_compare", fa::code_compare },
-    { "code_fork", fa::code_fork },
-    { "code_merge", fa::code_merge },
-    { "code_pull_request", fa::code_pull_request },
-    { "code_pull_request_closed", fa::code_pull_request_closed },
-    { "code_pull_request_draft", fa::code_pull_request_draft },
-    { "code_simple", fa::code_simple },
-    { "coffee_bean", fa::coffee_bean },
-    { "coffee_beans", fa::coffee_beans },
-    { "coffee_pot", fa::coffee_pot },
-    { "coffin", fa::coffin },
-    { "coffin_cross", fa::coffin_cross },
-    { "coin", fa::coin },
-    { "coin_blank", fa::coin_blank },
-    { "coin_front", fa::coin_front },
-    { "coin_vertical", fa::coin_vertical },
-    { "coins", fa::coins },
-    { "colon", fa::colon },
-    { "colon_sign", fa::colon_sign },
-    { "columns_3", fa::columns_3 },
-    { "comet", fa::comet },
-    { "comma", fa::comma },
-    { "command", fa::command },
-    { "comment", fa::comment },
-    { "comment_arrow_down", fa::comment_arrow_down },
-    { "comment_arrow_up", fa::comment_arrow_up },
-    { "comment_arrow_up_right", fa::comment_arrow_up_right },
-    { "comment_captions", fa::comment_captions },
-    { "comment_check", fa::comment_check },
-    { "comment_code", fa::comment_code },
-    { "comment_dollar", fa::comment_dollar },
-    { "comment_dots", fa::comment_dots },
-    { "commenting", fa::comment_dots },
-    { "comment_exclamation", fa::comment_exclamation },
-    { "comment_image", fa::comment_image },
-    { "comment_lines", fa::comment_lines },
-    { "comment_medical", fa::comment_medical },
-    { "comment_middle", fa::comment_middle },
-    { "comment_middle_top", fa::comment_middle_top },
-    { "comment_minus", fa::comment_minus },
-    { "comment_music", fa::comment_music },
-    { "comment_pen", fa::comment_pen },
-    { "comment_edit", fa::comment_pen },
-    { "comment_plus", fa::comment_plus },
-    { "comment_question", fa::comment_question },
-    { "comment_quote", fa::comment_quote },
-    { "comment_slash", fa::comment_slash },
-    { "comment_smile", fa::comment_smile },
-    { "comment_sms", fa::comment_sms },
-    { "sms", fa::comment_sms },
-    { "comment_text", fa::comment_text },
-    { "comment_xmark", fa::comment_xmark },
-    { "comment_times", fa::comment_xmark },
-    { "comments", fa::comments },
-    { "comments_dollar", fa::comments_dollar },
-    { "comments_question", fa::comments_question },
-    { "comments_question_check", fa::comments_question_check },
-    { "compact_disc", fa::compact_disc },
-    { "compass", fa::compass },
-    { "compass_drafting", fa::compass_drafting },
-    { "drafting_compass", fa::compass_drafting },
-    { "compass_slash", fa::compass_slash },
-    { "compress", fa::compress },
-    { "compress_wide", fa::compress_wide },
-    { "computer", fa::computer },
-    { "computer_classic", fa::computer_classic },
-    { "computer_mouse", fa::computer_mouse },
-    { "mouse", fa::computer_mouse },
-    { "computer_mouse_scrollwheel", fa::computer_mouse_scrollwheel },
-    { "mouse_alt", fa::computer_mouse_scrollwheel },
-    { "computer_speaker", fa::computer_speaker },
-    { "container_storage", fa::container_storage },
-    { "conveyor_belt", fa::conveyor_belt },
-    { "conveyor_belt_boxes", fa::conveyor_belt_boxes },
-    { "conveyor_belt_alt", fa::conveyor_belt_boxes },
-    { "conveyor_belt_empty", fa::conveyor_belt_empty },
-    { "cookie", fa::cookie },
-    { "cookie_bite", fa::cookie_bite },
-    { "copy", fa::copy },
-    { "copyright", fa::copyright },
-    { "corn", fa::corn },
-    { "corner", fa::corner },
-    { "couch", fa::couch },
-    { "cow", fa::cow },
-    { "cowbell", fa::cowbell },
-    { "cowbell_circle_plus", fa::cowbell_circle_plus },
-    { "cowbell_more", fa::cowbell_circle_plus },
-    { "crab", fa::crab },
-    { "crate_apple", fa::crate_apple },
-    { "apple_crate", fa::crate_apple },
-    { "crate_empty", fa::crate_empty },
-    { "credit_card", fa::credit_card },
-    { "credit_card_alt", fa::credit_card },
-    { "credit_card_blank", fa::credit_card_blank },
-    { "credit_card_front", fa::credit_card_front },
-    { "cricket_bat_ball", fa::cricket_bat_ball },
-    { "cricket", fa::cricket_bat_ball },
-    { "croissant", fa::croissant },
-    { "crop", fa::crop },
-    { "crop_simple", fa::crop_simple },
-    { "crop_alt", fa::crop_simple },
-    { "cross", fa::cross },
-    { "crosshairs", fa::crosshairs },
-    { "crow", fa::crow },
-    { "crown", fa::crown },
-    { "crutch", fa::crutch },
-    { "crutches", fa::crutches },
-    { "cruzeiro_sign", fa::cruzeiro_sign },
-    { "crystal_ball", fa::crystal_ball },
-    { "cube", fa::cube },
-    { "cubes", fa::cubes },
-    { "cubes_stacked", fa::cubes_stacked },
-    { "cucumber", fa::cucumber },
-    { "cup_straw", fa::cup_straw },
-    { "cup_straw_swoosh", fa::cup_straw_swoosh },
-    { "cup_togo", fa::cup_togo },
-    { "coffee_togo", fa::cup_togo },
-    { "cupcake", fa::cupcake },
-    { "curling_stone", fa::curling_stone },
-    { "curling", fa::curling_stone },
-    { "custard", fa::custard },
-    { "d", fa::d },
-    { "dagger", fa::dagger },
-    { "dash", fa::dash },
-    { "minus_large", fa::dash },
-    { "database", fa::database },
-    { "deer", fa::deer },
-    { "deer_rudolph", fa::deer_rudolph },
-    { "delete_left", fa::delete_left },
-    { "backspace", fa::delete_left },
-    { "delete_right", fa::delete_right },
-    { "democrat", fa::democrat },
-    { "desktop", fa::desktop },
-    { "desktop_alt", fa::desktop },
-    { "desktop_arrow_down", fa::desktop_arrow_down },
-    { "dharmachakra", fa::dharmachakra },
-    { "diagram_cells", fa::diagram_cells },
-    { "diagram_lean_canvas", fa::diagram_lean_canvas },
-    { "diagram_nested", fa::diagram_nested },
-    { "diagram_next", fa::diagram_next },
-    { "diagram_predecessor", fa::diagram_predecessor },
-    { "diagram_previous", fa::diagram_previous },
-    { "diagram_project", fa::diagram_project },
-    { "project_diagram", fa::diagram_project },
-    { "diagram_sankey", fa::diagram_sankey },
-    { "diagram_subtask", fa::diagram_subtask },
-    { "diagram_successor", fa::diagram_successor },
-    { "diagram_venn", fa::diagram_venn },
-    { "dial", fa::dial },
-    { "dial_med_high", fa::dial },
-    { "dial_high", fa::dial_high },
-    { "dial_low", fa::dial_low },
-    { "dial_max", fa::dial_max },
-    { "dial_med", fa::dial_med },
-    { "dial_med_low", fa::dial_med_low },
-    { "dial_min", fa::dial_min },
-    { "dial_off", fa::dial_off },
-    { "diamond", fa::diamond },
-    { "diamond_exclamation", fa::diamond_exclamation },
-    { "diamond_turn_right", fa::diamond_turn_right },
-    { "directions", fa::diamond_turn_right },
-    { "dice", fa::dice },
-    { "dice_d10", fa::dice_d10 },
-    { "dice_d12", fa::dice_d12 },
-    { "dice_d20", fa::dice_d20 },
-    { "dice_d4", fa::dice_d4 },
-    { "dice_d6", fa::dice_d6 },
-    { "dice_d8", fa::dice_d8 },
-    { "dice_five", fa::dice_five },
-    { "dice_four", fa::dice_four },
-    { "dice_one", fa::dice_one },
-    { "dice_six", fa::dice_six },
-    { "dice_three", fa::dice_three },
-    { "dice_two", fa::dice_two },
-    { "diploma", fa::diploma },
-    { "scroll_ribbon", fa::diploma },
-    { "disc_drive", fa::disc_drive },
-    { "disease", fa::disease },
-    { "display", fa::display },
-    { "display_arrow_down", fa::display_arrow_down },
-    { "display_code", fa::display_code },
-    { "desktop_code", fa::display_code },
-    { "display_medical", fa::display_medical },
-    { "desktop_medical", fa::display_medical },
-    { "display_slash", fa::display_slash },
-    { "desktop_slash", fa::display_slash },
-    { "distribute_spacing_horizontal", fa::distribute_spacing_horizontal },
-    { "distribute_spacing_vertical", fa::distribute_spacing_vertical },
-    { "ditto", fa::ditto },
-    { "divide", fa::divide },
-    { "dna", fa::dna },
-    { "do_not_enter", fa::do_not_enter },
-    { "dog", fa::dog },
-    { "dog_leashed", fa::dog_leashed },
-    { "dollar_sign", fa::dollar_sign },
-    { "dollar", fa::dollar_sign },
-    { "usd", fa::dollar_sign },
-    { "dolly", fa::dolly },
-    { "dolly_box", fa::dolly },
-    { "dolly_empty", fa::dolly_empty },
-    { "dolphin", fa::dolphin },
-    { "dong_sign", fa::dong_sign },
-    { "donut", fa::donut },
-    { "doughnut", fa::donut },
-    { "door_closed", fa::door_closed },
-    { "door_open", fa::door_open },
-    { "dove", fa::dove },
-    { "down", fa::down },
-    { "arrow_alt_down", fa::down },
-    { "down_from_dotted_line", fa::down_from_dotted_line },
-    { "down_from_line", fa::down_from_line },
-    { "arrow_alt_from_top", fa::down_from_line },
-    { "down_left", fa::down_left },
-    { "down_left_and_up_right_to_center", fa::down_left_and_up_right_to_center },
-    { "compress_alt", fa::down_left_and_up_right_to_center },
-    { "down_long", fa::down_long },
-    { "long_arrow_alt_down", fa::down_long },
-    { "down_right", fa::down_right },
-    { "down_to_bracket", fa::down_to_bracket },
-    { "down_to_dotted_line", fa::down_to_dotted_line },
-    { "down_to_line", fa::down_to_line },
-    { "arrow_alt_to_bottom", fa::down_to_line },
-    { "download", fa::download },
-    { "dragon", fa::dragon },
-    { "draw_circle", fa::draw_circle },
-    { "draw_polygon", fa::draw_polygon },
-    { "draw_square", fa::draw_square },
-    { "dreidel", fa::dreidel },
-    { "drone", fa::drone },
-    { "drone_front", fa::drone_front },
-    { "drone_alt", fa::drone_front },
-    { "droplet", fa::droplet },
-    { "tint", fa::droplet },
-    { "droplet_degree", fa::droplet_degree },
-    { "dewpoint", fa::droplet_degree },
-    { "droplet_percent", fa::droplet_percent },
-    { "humidity", fa::droplet_percent },
-    { "droplet_slash", fa::droplet_slash },
-    { "tint_slash", fa::droplet_slash },
-    { "drum", fa::drum },
-    { "drum_steelpan", fa::drum_steelpan },
-    { "drumstick", fa::drumstick },
-    { "drumstick_bite", fa::drumstick_bite },
-    { "dryer", fa::dryer },
-    { "dryer_heat", fa::dryer_heat },
-    { "dryer_alt", fa::dryer_heat },
-    { "duck", fa::duck },
-    { "dumbbell", fa::dumbbell },
-    { "dumpster", fa::dumpster },
-    { "dumpster_fire", fa::dumpster_fire },
-    { "dungeon", fa::dungeon },
-    { "e", fa::e },
-    { "ear", fa::ear },
-    { "ear_deaf", fa::ear_deaf },
-    { "deaf", fa::ear_deaf },
-    { "deafness", fa::ear_deaf },
-    { "hard_of_hearing", fa::ear_deaf },
-    { "ear_listen", fa::ear_listen },
-    { "assistive_listening_systems", fa::ear_listen },
-    { "ear_muffs", fa::ear_muffs },
-    { "earth_africa", fa::earth_africa },
-    { "globe_africa", fa::earth_africa },
-    { "earth_americas", fa::earth_americas },
-    { "earth", fa::earth_americas },
-    { "earth_america", fa::earth_americas },
-    { "globe_americas", fa::earth_americas },
-    { "earth_asia", fa::earth_asia },
-    { "globe_asia", fa::earth_asia },
-    { "earth_europe", fa::earth_europe },
-    { "globe_europe", fa::earth_europe },
-    { "earth_oceania", fa::earth_oceania },
-    { "globe_oceania", fa::earth_oceania },
-    { "eclipse", fa::eclipse },
-    { "egg", fa::egg },
-    { "egg_fried", fa::egg_fried },
-    { "eggplant", fa::eggplant },
-    { "eject", fa::eject },
-    { "elephant", fa::elephant },
-    { "elevator", fa::elevator },
-    { "ellipsis", fa::ellipsis },
-    { "ellipsis_h", fa::ellipsis },
-    { "ellipsis_stroke", fa::ellipsis_stroke },
-    { "ellipsis_h_alt", fa::ellipsis_stroke },
-    { "ellipsis_stroke_vertical", fa::ellipsis_stroke_vertical },
-    { "ellipsis_v_alt", fa::ellipsis_stroke_vertical },
-    { "ellipsis_vertical", fa::ellipsis_vertical },
-    { "ellipsis_v", fa::ellipsis_vertical },
-    { "empty_set", fa::empty_set },
-    { "engine", fa::engine },
-    { "engine_warning", fa::engine_warning },
-    { "engine_exclamation", fa::engine_warning },
-    { "envelope", fa::envelope },
-    { "envelope_circle_check", fa::envelope_circle_check },
-    { "envelope_dot", fa::envelope_dot },
-    { "envelope_badge", fa::envelope_dot },
-    { "envelope_open", fa::envelope_open },
-    { "envelope_open_dollar", fa::envelope_open_dollar },
-    { "envelope_open_text", fa::envelope_open_text },
-    { "envelopes", fa::envelopes },
-    { "envelopes_bulk", fa::envelopes_bulk },
-    { "mail_bulk", fa::envelopes_bulk },
-    { "equals", fa::equals },
-    { "eraser", fa::eraser },
-    { "escalator", fa::escalator },
-    { "ethernet", fa::ethernet },
-    { "euro_sign", fa::euro_sign },
-    { "eur", fa::euro_sign },
-    { "euro", fa::euro_sign },
-    { "exclamation", fa::exclamation },
-    { "expand", fa::expand },
-    { "expand_wide", fa::expand_wide },
-    { "explosion", fa::explosion },
-    { "eye", fa::eye },
-    { "eye_dropper", fa::eye_dropper },
-    { "eye_dropper_empty", fa::eye_dropper },
-    { "eyedropper", fa::eye_dropper },
-    { "eye_dropper_full", fa::eye_dropper_full },
-    { "eye_dropper_half", fa::eye_dropper_half },
-    { "eye_evil", fa::eye_evil },
-    { "eye_low_vision", fa::eye_low_vision },
-    { "low_vision", fa::eye_low_vision },
-    { "eye_slash", fa::eye_slash },
-    { "eyes", fa::eyes },
-    { "f", fa::f },
-    { "face_angry", fa::face_angry },
-    { "angry", fa::face_angry },
-    { "face_angry_horns", fa::face_angry_horns },
-    { "face_anguished", fa::face_anguished },
-    { "face_anxious_sweat", fa::face_anxious_sweat },
-    { "face_astonished", fa::face_astonished },
-    { "face_awesome", fa::face_awesome },
-    { "gave_dandy", fa::face_awesome },
-    { "face_beam_hand_over_mouth", fa::face_beam_hand_over_mouth },
-    { "face_clouds", fa::face_clouds },
-    { "face_confounded", fa::face_confounded },
-    { "face_confused", fa::face_confused },
-    { "face_cowboy_hat", fa::face_cowboy_hat },
-    { "face_diagonal_mouth", fa::face_diagonal_mouth },
-    { "face_disappointed", fa::face_disappointed },
-    { "face_disguise", fa::face_disguise },
-    { "face_dizzy", fa::face_dizzy },
-    { "dizzy", fa::face_dizzy },
-    { "face_dotted", fa::face_dotted },
-    { "face_downcast_sweat", fa::face_downcast_sweat },
-    { "face_drooling", fa::face_drooling },
-    { "face_exhaling", fa::face_exhaling },
-    { "face_explode", fa::face_explode },
-    { "exploding_head", fa::face_explode },
-    { "face_expressionless", fa::face_expressionless },
-    { "face_eyes_xmarks", fa::face_eyes_xmarks },
-    { "face_fearful", fa::face_fearful },
-    { "face_flushed", fa::face_flushed },
-    { "flushed", fa::face_flushed },
-    { "face_frown", fa::face_frown },
-    { "frown", fa::face_frown },
-    { "face_frown_open", fa::face_frown_open },
-    { "frown_open", fa::face_frown_open },
-    { "face_frown_slight", fa::face_frown_slight },
-    { "face_glasses", fa::face_glasses },
-    { "face_grimace", fa::face_grimace },
-    { "grimace", fa::face_grimace },
-    { "face_grin", fa::face_grin },
-    { "grin", fa::face_grin },
-    { "face_grin_beam", fa::face_grin_beam },
-    { "grin_beam", fa::face_grin_beam },
-    { "face_grin_beam_sweat", fa::face_grin_beam_sweat },
-    { "grin_beam_sweat", fa::face_grin_beam_sweat },
-    { "face_grin_hearts", fa::face_grin_hearts },
-    { "grin_hearts", fa::face_grin_hearts },
-    { "face_grin_squint", fa::face_grin_squint },
-    { "grin_squint", fa::face_grin_squint },
-    { "face_grin_squint_tears", fa::face_grin_squint_tears },
-    { "grin_squint_tears", fa::face_grin_squint_tears },
-    { "face_grin_stars", fa::face_grin_stars },
-    { "grin_stars", fa::face_grin_stars },
-    { "face_grin_tears", fa::face_grin_tears },
-    { "grin_tears", fa::face_grin_tears },
-    { "face_grin_tongue", fa::face_grin_tongue },
-    { "grin_tongue", fa::face_grin_tongue },
-    { "face_grin_tongue_squint", fa::face_grin_tongue_squint },
-    { "grin_tongue_squint", fa::face_grin_tongue_squint },
-    { "face_grin_tongue_wink", fa::face_grin_tongue_wink },
-    { "grin_tongue_wink", fa::face_grin_tongue_wink },
-    { "face_grin_wide", fa::face_grin_wide },
-    { "grin_alt", fa::face_grin_wide },
-    { "face_grin_wink", fa::face_grin_wink },
-    { "grin_wink", fa::face_grin_wink },
-    { "face_hand_over_mouth", fa::face_hand_over_mouth },
-    { "face_hand_peeking", fa::face_hand_peeking },
-    { "face_hand_yawn", fa::face_hand_yawn },
-    { "face_head_bandage", fa::face_head_bandage },
-    { "face_holding_back_tears", fa::face_holding_back_tears },
-    { "face_hushed", fa::face_hushed },
-    { "face_icicles", fa::face_icicles },
-    { "face_kiss", fa::face_kiss },
-    { "kiss", fa::face_kiss },
-    { "face_kiss_beam", fa::face_kiss_beam },
-    { "kiss_beam", fa::face_kiss_beam },
-    { "face_kiss_closed_eyes", fa::face_kiss_closed_eyes },
-    { "face_kiss_wink_heart", fa::face_kiss_wink_heart },
-    { "kiss_wink_heart", fa::face_kiss_wink_heart },
-    { "face_laugh", fa::face_laugh },
-    { "laugh", fa::face_laugh },
-    { "face_laugh_beam", fa::face_laugh_beam },
-    { "laugh_beam", fa::face_laugh_beam },
-    { "face_laugh_squint", fa::face_laugh_squint },
-    { "laugh_squint", fa::face_laugh_squint },
-    { "face_laugh_wink", fa::face_laugh_wink },
-    { "laugh_wink", fa::face_laugh_wink },
-    { "face_lying", fa::face_lying },
-    { "face_mask", fa::face_mask },
-    { "face_meh", fa::face_meh },
-    { "meh", fa::face_meh },
-    { "face_meh_blank", fa::face_meh_blank },
-    { "meh_blank", fa::face_meh_blank },
-    { "face_melting", fa::face_melting },
-    { "face_monocle", fa::face_monocle },
-    { "face_nauseated", fa::face_nauseated },
-    { "face_nose_steam", fa::face_nose_steam },
-    { "face_party", fa::face_party },
-    { "face_pensive", fa::face_pensive },
-    { "face_persevering", fa::face_persevering },
-    { "face_pleading", fa::face_pleading },
-    { "face_pouting", fa::face_pouting },
-    { "face_raised_eyebrow", fa::face_raised_eyebrow },
-    { "face_relieved", fa::face_relieved },
-    { "face_rolling_eyes", fa::face_rolling_eyes },
-    { "meh_rolling_eyes", fa::face_rolling_eyes },
-    { "face_sad_cry", fa::face_sad_cry },
-    { "sad_cry", fa::face_sad_cry },
-    { "face_sad_sweat", fa::face_sad_sweat },
-    { "face_sad_tear", fa::face_sad_tear },
-    { "sad_tear", fa::face_sad_tear },
-    { "face_saluting", fa::face_saluting },
-    { "face_scream", fa::face_scream },
-    { "face_shush", fa::face_shush },
-    { "face_sleeping", fa::face_sleeping },
-    { "face_sleepy", fa::face_sleepy },
-    { "face_smile", fa::face_smile },
-    { "smile", fa::face_smile },
-    { "face_smile_beam", fa::face_smile_beam },
-    { "smile_beam", fa::face_smile_beam },
-    { "face_smile_halo", fa::face_smile_halo },
-    { "face_smile_hearts", fa::face_smile_hearts },
-    { "face_smile_horns", fa::face_smile_horns },
-    { "face_smile_plus", fa::face_smile_plus },
-    { "smile_plus", fa::face_smile_plus },
-    { "face_smile_relaxed", fa::face_smile_relaxed },
-    { "face_smile_tear", fa::face_smile_tear },
-    { "face_smile_tongue", fa::face_smile_tongue },
-    { "face_smile_upside_down", fa::face_smile_upside_down },
-    { "face_smile_wink", fa::face_smile_wink },
-    { "smile_wink", fa::face_smile_wink },
-    { "face_smiling_hands", fa::face_smiling_hands },
-    { "face_smirking", fa::face_smirking },
-    { "face_spiral_eyes", fa::face_spiral_eyes },
-    { "face_sunglasses", fa::face_sunglasses },
-    { "face_surprise", fa::face_surprise },
-    { "surprise", fa::face_surprise },
-    { "face_swear", fa::face_swear },
-    { "face_thermometer", fa::face_thermometer },
-    { "face_thinking", fa::face_thinking },
-    { "face_tired", fa::face_tired },
-    { "tired", fa::face_tired },
-    { "face_tissue", fa::face_tissue },
-    { "face_tongue_money", fa::face_tongue_money },
-    { "face_tongue_sweat", fa::face_tongue_sweat },
-    { "face_unamused", fa::face_unamused },
-    { "face_viewfinder", fa::face_viewfinder },
-    { "face_vomit", fa::face_vomit },
-    { "face_weary", fa::face_weary },
-    { "face_woozy", fa::face_woozy },
-    { "face_worried", fa::face_worried },
-    { "face_zany", fa::face_zany },
-    { "face_zipper", fa::face_zipper },
-    { "falafel", fa::falafel },
-    { "family", fa::family },
-    { "family_dress", fa::family_dress },
-    { "family_pants", fa::family_pants },
-    { "fan", fa::fan },
-    { "fan_table", fa::fan_table },
-    { "farm", fa::farm },
-    { "barn_silo", fa::farm },
-    { "faucet", fa::faucet },
-    { "faucet_drip", fa::faucet_drip },
-    { "fax", fa::fax },
-    { "feather", fa::feather },
-    { "feather_pointed", fa::feather_pointed },
-    { "feather_alt", fa::feather_pointed },
-    { "fence", fa::fence },
-    { "ferris_wheel", fa::ferris_wheel },
-    { "ferry", fa::ferry },
-    { "field_hockey_stick_ball", fa::field_hockey_stick_ball },
-    { "field_hockey", fa::field_hockey_stick_ball },
-    { "file", fa::file },
-    { "file_arrow_down", fa::file_arrow_down },
-    { "file_download", fa::file_arrow_down },
-    { "file_arrow_up", fa::file_arrow_up },
-    { "file_upload", fa::file_arrow_up },
-    { "file_audio", fa::file_audio },
-    { "file_binary", fa::file_binary },
-    { "file_certificate", fa::file_certificate },
-    { "file_award", fa::file_certificate },
-    { "file_chart_column", fa::file_chart_column },
-    { "file_chart_line", fa::file_chart_column },
-    { "file_chart_pie", fa::file_chart_pie },
-    { "file_check", fa::file_check },
-    { "file_circle_check", fa::file_circle_check },
-    { "file_circle_exclamation", fa::file_circle_exclamation },
-    { "file_circle_info", fa::file_circle_info },
-    { "file_circle_minus", fa::file_circle_minus },
-    { "file_circle_plus", fa::file_circle_plus },
-    { "file_circle_question", fa::file_circle_question },
-    { "file_circle_xmark", fa::file_circle_xmark },
-    { "file_code", fa::file_code },
-    { "file_contract", fa::file_contract },
-    { "file_csv", fa::file_csv },
-    { "file_dashed_line", fa::file_dashed_line },
-    { "page_break", fa::file_dashed_line },
-    { "file_excel", fa::file_excel },
-    { "file_exclamation", fa::file_exclamation },
-    { "file_export", fa::file_export },
-    { "arrow_right_from_file", fa::file_export },
-    { "file_heart", fa::file_heart },
-    { "file_image", fa::file_image },
-    { "file_import", fa::file_import },
-    { "arrow_right_to_file", fa::file_import },
-    { "file_invoice", fa::file_invoice },
-    { "file_invoice_dollar", fa::file_invoice_dollar },
-    { "file_lines", fa::file_lines },
-    { "file_alt", fa::file_lines },
-    { "file_text", fa::file_lines },
-    { "file_lock", fa::file_lock },
-    { "file_magnifying_glass", fa::file_magnifying_glass },
-    { "file_search", fa::file_magnifying_glass },
-    { "file_medical", fa::file_medical },
-    { "file_minus", fa::file_minus },
-    { "file_music", fa::file_music },
-    { "file_pdf", fa::file_pdf },
-    { "file_pen", fa::file_pen },
-    { "file_edit", fa::file_pen },
-    { "file_plus", fa::file_plus },
-    { "file_plus_minus", fa::file_plus_minus },
-    { "file_powerpoint", fa::file_powerpoint },
-    { "file_prescription", fa::file_prescription },
-    { "file_shield", fa::file_shield },
-    { "file_signature", fa::file_signature },
-    { "file_slash", fa::file_slash },
-    { "file_spreadsheet", fa::file_spreadsheet },
-    { "file_user", fa::file_user },
-    { "file_video", fa::file_video },
-    { "file_waveform", fa::file_waveform },
-    { "file_medical_alt", fa::file_waveform },
-    { "file_word", fa::file_word },
-    { "file_xmark", fa::file_xmark },
-    { "file_times", fa::file_xmark },
-    { "file_zipper", fa::file_zipper },
-    { "file_archive", fa::file_zipper },
-    { "files", fa::files },
-    { "files_medical", fa::files_medical },
-    { "fill", fa::fill },
-    { "fill_drip", fa::fill_drip },
-    { "film", fa::film },
-    { "film_canister", fa::film_canister },
-    { "film_simple", fa::film_simple },
-    { "film_alt", fa::film_simple },
-    { "film_slash", fa::film_slash },
-    { "films", fa::films },
-    { "filter", fa::filter },
-    { "filter_circle_dollar", fa::filter_circle_dollar },
-    { "funnel_dollar", fa::filter_circle_dollar },
-    { "filter_circle_xmark", fa::filter_circle_xmark },
-    { "filter_list", fa::filter_list },
-    { "filter_slash", fa::filter_slash },
-    { "filters", fa::filters },
-    { "fingerprint", fa::fingerprint },
-    { "fire", fa::fire },
-    { "fire_burner", fa::fire_burner },
-    { "fire_extinguisher", fa::fire_extinguisher },
-    { "fire_flame", fa::fire_flame },
-    { "flame", fa::fire_flame },
-    { "fire_flame_curved", fa::fire_flame_curved },
-    { "fire_alt", fa::fire_flame_curved },
-    { "fire_flame_simple", fa::fire_flame_simple },
-    { "burn", fa::fire_flame_simple },
-    { "fire_hydrant", fa::fire_hydrant },
-    { "fire_smoke", fa::fire_smoke },
-    { "fireplace", fa::fireplace },
-    { "fish", fa::fish },
-    { "fish_bones", fa::fish_bones },
-    { "fish_cooked", fa::fish_cooked },
-    { "fish_fins", fa::fish_fins },
-    { "fishing_rod", fa::fishing_rod },
-    { "flag", fa::flag },
-    { "flag_checkered", fa::flag_checkered },
-    { "flag_pennant", fa::flag_pennant },
-    { "pennant", fa::flag_pennant },
-    { "flag_swallowtail", fa::flag_swallowtail },
-    { "flag_alt", fa::flag_swallowtail },
-    { "flag_usa", fa::flag_usa },
-    { "flashlight", fa::flashlight },
-    { "flask", fa::flask },
-    { "flask_round_poison", fa::flask_round_poison },
-    { "flask_poison", fa::flask_round_poison },
-    { "flask_round_potion", fa::flask_round_potion },
-    { "flask_potion", fa::flask_round_potion },
-    { "flask_vial", fa::flask_vial },
-    { "flatbread", fa::flatbread },
-    { "flatbread_stuffed", fa::flatbread_stuffed },
-    { "floppy_disk", fa::floppy_disk },
-    { "save", fa::floppy_disk },
-    { "floppy_disk_circle_arrow_right", fa::floppy_disk_circle_arrow_right },
-    { "save_circle_arrow_right", fa::floppy_disk_circle_arrow_right },
-    { "floppy_disk_circle_xmark", fa::floppy_disk_circle_xmark },
-    { "floppy_disk_times", fa::floppy_disk_circle_xmark },
-    { "save_circle_xmark", fa::floppy_disk_circle_xmark },
-    { "save_times", fa::floppy_disk_circle_xmark },
-    { "floppy_disk_pen", fa::floppy_disk_pen },
-    { "floppy_disks", fa::floppy_disks },
-    { "florin_sign", fa::florin_sign },
-    { "flower", fa::flower },
-    { "flower_daffodil", fa::flower_daffodil },
-    { "flower_tulip", fa::flower_tulip },
-    { "flute", fa::flute },
-    { "flux_capacitor", fa::flux_capacitor },
-    { "flying_disc", fa::flying_disc },
-    { "folder", fa::folder },
-    { "folder_blank", fa::folder },
-    { "folder_arrow_down", fa::folder_arrow_down },
-    { "folder_download", fa::folder_arrow_down },
-    { "folder_arrow_up", fa::folder_arrow_up },
-    { "folder_upload", fa::folder_arrow_up },
-    { "folder_bookmark", fa::folder_bookmark },
-    { "folder_closed", fa::folder_closed },
-    { "folder_gear", fa::folder_gear },
-    { "folder_cog", fa::folder_gear },
-    { "folder_grid", fa::folder_grid },
-    { "folder_heart", fa::folder_heart },
-    { "folder_image", fa::folder_image },
-    { "folder_magnifying_glass", fa::folder_magnifying_glass },
-    { "folder_search", fa::folder_magnifying_glass },
-    { "folder_medical", fa::folder_medical },
-    { "folder_minus", fa::folder_minus },
-    { "folder_music", fa::folder_music },
-    { "folder_open", fa::folder_open },
-    { "folder_plus", fa::folder_plus },
-    { "folder_tree", fa::folder_tree },
-    { "folder_user", fa::folder_user },
-    { "folder_xmark", fa::folder_xmark },
-    { "folder_times", fa::folder_xmark },
-    { "folders", fa::folders },
-    { "fondue_pot", fa::fondue_pot },
-    { "font", fa::font },
-    { "font_case", fa::font_case },
-    { "football", fa::football },
-    { "football_ball", fa::football },
-    { "football_helmet", fa::football_helmet },
-    { "fork", fa::fork },
-    { "utensil_fork", fa::fork },
-    { "fork_knife", fa::fork_knife },
-    { "utensils_alt", fa::fork_knife },
-    { "forklift", fa::forklift },
-    { "fort", fa::fort },
-    { "forward", fa::forward },
-    { "forward_fast", fa::forward_fast },
-    { "fast_forward", fa::forward_fast },
-    { "forward_step", fa::forward_step },
-    { "step_forward", fa::forward_step },
-    { "frame", fa::frame },
-    { "franc_sign", fa::franc_sign },
-    { "french_fries", fa::french_fries },
-    { "frog", fa::frog },
-    { "function", fa::function },
-    { "futbol", fa::futbol },
-    { "futbol_ball", fa::futbol },
-    { "soccer_ball", fa::futbol },
-    { "g", fa::g },
-    { "galaxy", fa::galaxy },
-    { "gallery_thumbnails", fa::gallery_thumbnails },
-    { "game_board", fa::game_board },
-    { "game_board_simple", fa::game_board_simple },
-    { "game_board_alt", fa::game_board_simple },
-    { "game_console_handheld", fa::game_console_handheld },
-    { "gamepad", fa::gamepad },
-    { "gamepad_modern", fa::gamepad_modern },
-    { "gamepad_alt", fa::gamepad_modern },
-    { "garage", fa::garage },
-    { "garage_car", fa::garage_car },
-    { "garage_open", fa::garage_open },
-    { "garlic", fa::garlic },
-    { "gas_pump", fa::gas_pump },
-    { "gas_pump_slash", fa::gas_pump_slash },
-    { "gauge", fa::gauge },
-    { "dashboard", fa::gauge },
-    { "gauge_med", fa::gauge },
-    { "tachometer_alt_average", fa::gauge },
-    { "gauge_circle_bolt", fa::gauge_circle_bolt },
-    { "gauge_circle_minus", fa::gauge_circle_minus },
-    { "gauge_circle_plus", fa::gauge_circle_plus },
-    { "gauge_high", fa::gauge_high },
-    { "tachometer_alt", fa::gauge_high },
-    { "tachometer_alt_fast", fa::gauge_high },
-    { "gauge_low", fa::gauge_low },
-    { "tachometer_alt_slow", fa::gauge_low },
-    { "gauge_max", fa::gauge_max },
-    { "tachometer_alt_fastest", fa::gauge_max },
-    { "gauge_min", fa::gauge_min },
-    { "tachometer_alt_slowest", fa::gauge_min },
-    { "gauge_simple", fa::gauge_simple },
-    { "gauge_simple_med", fa::gauge_simple },
-    { "tachometer_average", fa::gauge_simple },
-    { "gauge_simple_high", fa::gauge_simple_high },
-    { "tachometer", fa::gauge_simple_high },
-    { "tachometer_fast", fa::gauge_simple_high },
-    { "gauge_simple_low", fa::gauge_simple_low },
-    { "tachometer_slow", fa::gauge_simple_low },
-    { "gauge_simple_max", fa::gauge_simple_max },
-    { "tachometer_fastest", fa::gauge_simple_max },
-    { "gauge_simple_min", fa::gauge_simple_min },
-    { "tachometer_slowest", fa::gauge_simple_min },
-    { "gavel", fa::gavel },
-    { "legal", fa::gavel },
-    { "gear", fa::gear },
-    { "cog", fa::gear },
-    { "gears", fa::gears },
-    { "cogs", fa::gears },
-    { "gem", fa::gem },
-    { "genderless", fa::genderless },
-    { "ghost", fa::ghost },
-    { "gif", fa::gif },
-    { "gift", fa::gift },
-    { "gift_card", fa::gift_card },
-    { "gifts", fa::gifts },
-    { "gingerbread_man", fa::gingerbread_man },
-    { "glass", fa::glass },
-    { "glass_citrus", fa::glass_citrus },
-    { "glass_empty", fa::glass_empty },
-    { "glass_half", fa::glass_half },
-    { "glass_half_empty", fa::glass_half },
-    { "glass_half_full", fa::glass_half },
-    { "glass_water", fa::glass_water },
-    { "glass_water_droplet", fa::glass_water_droplet },
-    { "glasses", fa::glasses },
-    { "glasses_round", fa::glasses_round },
-    { "glasses_alt", fa::glasses_round },
-    { "globe", fa::globe },
-    { "globe_snow", fa::globe_snow },
-    { "globe_stand", fa::globe_stand },
-    { "goal_net", fa::goal_net },
-    { "golf_ball_tee", fa::golf_ball_tee },
-    { "golf_ball", fa::golf_ball_tee },
-    { "golf_club", fa::golf_club },
-    { "golf_flag_hole", fa::golf_flag_hole },
-    { "gopuram", fa::gopuram },
-    { "graduation_cap", fa::graduation_cap },
-    { "mortar_board", fa::graduation_cap },
-    { "gramophone", fa::gramophone },
-    { "grapes", fa::grapes },
-    { "grate", fa::grate },
-    { "grate_droplet", fa::grate_droplet },
-    { "greater_than", fa::greater_than },
-    { "greater_than_equal", fa::greater_than_equal },
-    { "grid", fa::grid },
-    { "grid_3", fa::grid },
-    { "grid_2", fa::grid_2 },
-    { "grid_2_plus", fa::grid_2_plus },
-    { "grid_4", fa::grid_4 },
-    { "grid_5", fa::grid_5 },
-    { "grid_dividers", fa::grid_dividers },
-    { "grid_horizontal", fa::grid_horizontal },
-    { "grip", fa::grip },
-    { "grip_horizontal", fa::grip },
-    { "grip_dots", fa::grip_dots },
-    { "grip_dots_vertical", fa::grip_dots_vertical },
-    { "grip_lines", fa::grip_lines },
-    { "grip_lines_vertical", fa::grip_lines_vertical },
-    { "grip_vertical", fa::grip_vertical },
-    { "group_arrows_rotate", fa::group_arrows_rotate },
-    { "guarani_sign", fa::guarani_sign },
-    { "guitar", fa::guitar },
-    { "guitar_electric", fa::guitar_electric },
-    { "guitars", fa::guitars },
-    { "gun", fa::gun },
-    { "gun_slash", fa::gun_slash },
-    { "gun_squirt", fa::gun_squirt },
-    { "h", fa::h },
-    { "h1", fa::h1 },
-    { "h2", fa::h2 },
-    { "h3", fa::h3 },
-    { "h4", fa::h4 },
-    { "h5", fa::h5 },
-    { "h6", fa::h6 },
-    { "hammer", fa::hammer },
-    { "hammer_crash", fa::hammer_crash },
-    { "hammer_war", fa::hammer_war },
-    { "hamsa", fa::hamsa },
-    { "hand", fa::hand },
-    { "hand_paper", fa::hand },
-    { "hand_back_fist", fa::hand_back_fist },
-    { "hand_rock", fa::hand_back_fist },
-    { "hand_back_point_down", fa::hand_back_point_down },
-    { "hand_back_point_left", fa::hand_back_point_left },
-    { "hand_back_point_ribbon", fa::hand_back_point_ribbon },
-    { "hand_back_point_right", fa::hand_back_point_right },
-    { "hand_back_point_up", fa::hand_back_point_up },
-    { "hand_dots", fa::hand_dots },
-    { "allergies", fa::hand_dots },
-    { "hand_fingers_crossed", fa::hand_fingers_crossed },
-    { "hand_fist", fa::hand_fist },
-    { "fist_raised", fa::hand_fist },
-    { "hand_heart", fa::hand_heart },
-    { "hand_holding", fa::hand_holding },
-    { "hand_holding_box", fa::hand_holding_box },
-    { "hand_holding_dollar", fa::hand_holding_dollar },
-    { "hand_holding_usd", fa::hand_holding_dollar },
-    { "hand_holding_droplet", fa::hand_holding_droplet },
-    { "hand_holding_water", fa::hand_holding_droplet },
-    { "hand_holding_hand", fa::hand_holding_hand },
-    { "hand_holding_heart", fa::hand_holding_heart },
-    { "hand_holding_magic", fa::hand_holding_magic },
-    { "hand_holding_medical", fa::hand_holding_medical },
-    { "hand_holding_seedling", fa::hand_holding_seedling },
-    { "hand_holding_skull", fa::hand_holding_skull },
-    { "hand_horns", fa::hand_horns },
-    { "hand_lizard", fa::hand_lizard },
-    { "hand_love", fa::hand_love },
-    { "hand_middle_finger", fa::hand_middle_finger },
-    { "hand_peace", fa::hand_peace },
-    { "hand_point_down", fa::hand_point_down },
-    { "hand_point_left", fa::hand_point_left },
-    { "hand_point_ribbon", fa::hand_point_ribbon },
-    { "hand_point_right", fa::hand_point_right },
-    { "hand_point_up", fa::hand_point_up },
-    { "hand_pointer", fa::hand_pointer },
-    { "hand_scissors", fa::hand_scissors },
-    { "hand_sparkles", fa::hand_sparkles },
-    { "hand_spock", fa::hand_spock },
-    { "hand_wave", fa::hand_wave },
-    { "handcuffs", fa::handcuffs },
-    { "hands", fa::hands },
-    { "sign_language", fa::hands },
-    { "signing", fa::hands },
-    { "hands_asl_interpreting", fa::hands_asl_interpreting },
-    { "american_sign_language_interpreting", fa::hands_asl_interpreting },
-    { "asl_interpreting", fa::hands_asl_interpreting },
-    { "hands_american_sign_language_interpreting", fa::hands_asl_interpreting },
-    { "hands_bound", fa::hands_bound },
-    { "hands_bubbles", fa::hands_bubbles },
-    { "hands_wash", fa::hands_bubbles },
-    { "hands_clapping", fa::hands_clapping },
-    { "hands_holding", fa::hands_holding },
-    { "hands_holding_child", fa::hands_holding_child },
-    { "hands_holding_circle", fa::hands_holding_circle },
-    { "hands_holding_diamond", fa::hands_holding_diamond },
-    { "hand_receiving", fa::hands_holding_diamond },
-    { "hands_holding_dollar", fa::hands_holding_dollar },
-    { "hands_usd", fa::hands_holding_dollar },
-    { "hands_holding_heart", fa::hands_holding_heart },
-    { "hands_heart", fa::hands_holding_heart },
-    { "hands_praying", fa::hands_praying },
-    { "praying_hands", fa::hands_praying },
-    { "handshake", fa::handshake },
-    { "handshake_angle", fa::handshake_angle },
-    { "hands_helping", fa::handshake_angle },
-    { "handshake_simple", fa::handshake_simple },
-    { "handshake_alt", fa::handshake_simple },
-    { "handshake_simple_slash", fa::handshake_simple_slash },
-    { "handshake_alt_slash", fa::handshake_simple_slash },
-    { "handshake_slash", fa::handshake_slash },
-    { "hanukiah", fa::hanukiah },
-    { "hard_drive", fa::hard_drive },
-    { "hdd", fa::hard_drive },
-    { "hashtag", fa::hashtag },
-    { "hashtag_lock", fa::hashtag_lock },
-    { "hat_chef", fa::hat_chef },
-    { "hat_cowboy", fa::hat_cowboy },
-    { "hat_cowboy_side", fa::hat_cowboy_side },
-    { "hat_santa", fa::hat_santa },
-    { "hat_winter", fa::hat_winter },
-    { "hat_witch", fa::hat_witch },
-    { "hat_wizard", fa::hat_wizard },
-    { "head_side", fa::head_side },
-    { "head_side_brain", fa::head_side_brain },
-    { "head_side_cough", fa::head_side_cough },
-    { "head_side_cough_slash", fa::head_side_cough_slash },
-    { "head_side_goggles", fa::head_side_goggles },
-    { "head_vr", fa::head_side_goggles },
-    { "head_side_headphones", fa::head_side_headphones },
-    { "head_side_heart", fa::head_side_heart },
-    { "head_side_mask", fa::head_side_mask },
-    { "head_side_medical", fa::head_side_medical },
-    { "head_side_virus", fa::head_side_virus },
-    { "heading", fa::heading },
-    { "header", fa::heading },
-    { "headphones", fa::headphones },
-    { "headphones_simple", fa::headphones_simple },
-    { "headphones_alt", fa::headphones_simple },
-    { "headset", fa::headset },
-    { "heart", fa::heart },
-    { "heart_circle_bolt", fa::heart_circle_bolt },
-    { "heart_circle_check", fa::heart_circle_check },
-    { "heart_circle_exclamation", fa::heart_circle_exclamation },
-    { "heart_circle_minus", fa::heart_circle_minus },
-    { "heart_circle_plus", fa::heart_circle_plus },
-    { "heart_circle_xmark", fa::heart_circle_xmark },
-    { "heart_crack", fa::heart_crack },
-    { "heart_broken", fa::heart_crack },
-    { "heart_half", fa::heart_half },
-    { "heart_half_stroke", fa::heart_half_stroke },
-    { "heart_half_alt", fa::heart_half_stroke },
-    { "heart_pulse", fa::heart_pulse },
-    { "heartbeat", fa::heart_pulse },
-    { "heat", fa::heat },
-    { "helicopter", fa::helicopter },
-    { "helicopter_symbol", fa::helicopter_symbol },
-    { "helmet_battle", fa::helmet_battle },
-    { "helmet_safety", fa::helmet_safety },
-    { "hard_hat", fa::helmet_safety },
-    { "hat_hard", fa::helmet_safety },
-    { "helmet_un", fa::helmet_un },
-    { "hexagon", fa::hexagon },
-    { "hexagon_check", fa::hexagon_check },
-    { "hexagon_divide", fa::hexagon_divide },
-    { "hexagon_exclamation", fa::hexagon_exclamation },
-    { "hexagon_image", fa::hexagon_image },
-    { "hexagon_minus", fa::hexagon_minus },
-    { "minus_hexagon", fa::hexagon_minus },
-    { "hexagon_plus", fa::hexagon_plus },
-    { "plus_hexagon", fa::hexagon_plus },
-    { "hexagon_vertical_nft", fa::hexagon_vertical_nft },
-    { "hexagon_vertical_nft_slanted", fa::hexagon_vertical_nft_slanted },
-    { "hexagon_xmark", fa::hexagon_xmark },
-    { "times_hexagon", fa::hexagon_xmark },
-    { "xmark_hexagon", fa::hexagon_xmark },
-    { "high_definition", fa::high_definition },
-    { "rectangle_hd", fa::high_definition },
-    { "highlighter", fa::highlighter },
-    { "highlighter_line", fa::highlighter_line },
-    { "hill_avalanche", fa::hill_avalanche },
-    { "hill_rockslide", fa::hill_rockslide },
-    { "hippo", fa::hippo },
-    { "hockey_mask", fa::hockey_mask },
-    { "hockey_puck", fa::hockey_puck },
-    { "hockey_stick_puck", fa::hockey_stick_puck },
-    { "hockey_sticks", fa::hockey_sticks },
-    { "holly_berry", fa::holly_berry },
-    { "honey_pot", fa::honey_pot },
-    { "hood_cloak", fa::hood_cloak },
-    { "horizontal_rule", fa::horizontal_rule },
-    { "horse", fa::horse },
-    { "horse_head", fa::horse_head },
-    { "horse_saddle", fa::horse_saddle },
-    { "hose", fa::hose },
-    { "hose_reel", fa::hose_reel },
-    { "hospital", fa::hospital },
-    { "hospital_alt", fa::hospital },
-    { "hospital_wide", fa::hospital },
-    { "hospital_user", fa::hospital_user },
-    { "hospitals", fa::hospitals },
-    { "hot_tub_person", fa::hot_tub_person },
-    { "hot_tub", fa::hot_tub_person },
-    { "hotdog", fa::hotdog },
-    { "hotel", fa::hotel },
-    { "hourglass", fa::hourglass },
-    { "hourglass_2", fa::hourglass },
-    { "hourglass_half", fa::hourglass },
-    { "hourglass_clock", fa::hourglass_clock },
-    { "hourglass_empty", fa::hourglass_empty },
-    { "hourglass_end", fa::hourglass_end },
-    { "hourglass_3", fa::hourglass_end },
-    { "hourglass_start", fa::hourglass_start },
-    { "hourglass_1", fa::hourglass_start },
-    { "house", fa::house },
-    { "home", fa::house },
-    { "home_alt", fa::house },
-    { "home_lg_alt", fa::house },
-    { "house_blank", fa::house_blank },
-    { "home_blank", fa::house_blank },
-    { "house_building", fa::house_building },
-    { "house_chimney", fa::house_chimney },
-    { "home_lg", fa::house_chimney },
-    { "house_chimney_blank", fa::house_chimney_blank },
-    { "house_chimney_crack", fa::house_chimney_crack },
-    { "house_damage", fa::house_chimney_crack },
-    { "house_chimney_heart", fa::house_chimney_heart },
-    { "house_chimney_medical", fa::house_chimney_medical },
-    { "clinic_medical", fa::house_chimney_medical },
-    { "house_chimney_user", fa::house_chimney_user },
-    { "house_chimney_window", fa::house_chimney_window },
-    { "house_circle_check", fa::house_circle_check },
-    { "house_circle_exclamation", fa::house_circle_exclamation },
-    { "house_circle_xmark", fa::house_circle_xmark },
-    { "house_crack", fa::house_crack },
-    { "house_day", fa::house_day },
-    { "house_fire", fa::house_fire },
-    { "house_flag", fa::house_flag },
-    { "house_flood_water", fa::house_flood_water },
-    { "house_flood_water_circle_arrow_right", fa::house_flood_water_circle_arrow_right },
-    { "house_heart", fa::house_heart },
-    { "home_heart", fa::house_heart },
-    { "house_laptop", fa::house_laptop },
-    { "laptop_house", fa::house_laptop },
-    { "house_lock", fa::house_lock },
-    { "house_medical", fa::house_medical },
-    { "house_medical_circle_check", fa::house_medical_circle_check },
-    { "house_medical_circle_exclamation", fa::house_medical_circle_exclamation },
-    { "house_medical_circle_xmark", fa::house_medical_circle_xmark },
-    { "house_medical_flag", fa::house_medical_flag },
-    { "house_night", fa::house_night },
-    { "house_person_leave", fa::house_person_leave },
-    { "house_leave", fa::house_person_leave },
-    { "house_person_depart", fa::house_person_leave },
-    { "house_person_return", fa::house_person_return },
-    { "house_person_arrive", fa::house_person_return },
-    { "house_return", fa::house_person_return },
-    { "house_signal", fa::house_signal },
-    { "house_tree", fa::house_tree },
-    { "house_tsunami", fa::house_tsunami },
-    { "house_turret", fa::house_turret },
-    { "house_user", fa::house_user },
-    { "home_user", fa::house_user },
-    { "house_water", fa::house_water },
-    { "house_flood", fa::house_water },
-    { "house_window", fa::house_window },
-    { "hryvnia_sign", fa::hryvnia_sign },
-    { "hryvnia", fa::hryvnia_sign },
-    { "hundred_points", fa::hundred_points },
-    { "_100", fa::hundred_points },
-    { "hurricane", fa::hurricane },
-    { "hyphen", fa::hyphen },
-    { "i", fa::i },
-    { "i_cursor", fa::i_cursor },
-    { "ice_cream", fa::ice_cream },
-    { "ice_skate", fa::ice_skate },
-    { "icicles", fa::icicles },
-    { "icons", fa::icons },
-    { "heart_music_camera_bolt", fa::icons },
-    { "id_badge", fa::id_badge },
-    { "id_card", fa::id_card },
-    { "drivers_license", fa::id_card },
-    { "id_card_clip", fa::id_card_clip },
-    { "id_card_alt", fa::id_card_clip },
-    { "igloo", fa::igloo },
-    { "image", fa::image },
-    { "image_landscape", fa::image_landscape },
-    { "landscape", fa::image_landscape },
-    { "image_polaroid", fa::image_polaroid },
-    { "image_polaroid_user", fa::image_polaroid_user },
-    { "image_portrait", fa::image_portrait },
-    { "portrait", fa::image_portrait },
-    { "image_slash", fa::image_slash },
-    { "image_user", fa::image_user },
-    { "images", fa::images },
-    { "images_user", fa::images_user },
-    { "inbox", fa::inbox },
-    { "inbox_full", fa::inbox_full },
-    { "inbox_in", fa::inbox_in },
-    { "inbox_arrow_down", fa::inbox_in },
-    { "inbox_out", fa::inbox_out },
-    { "inbox_arrow_up", fa::inbox_out },
-    { "inboxes", fa::inboxes },
-    { "indent", fa::indent },
-    { "indian_rupee_sign", fa::indian_rupee_sign },
-    { "indian_rupee", fa::indian_rupee_sign },
-    { "inr", fa::indian_rupee_sign },
-    { "industry", fa::industry },
-    { "industry_windows", fa::industry_windows },
-    { "industry_alt", fa::industry_windows },
-    { "infinity", fa::infinity },
-    { "info", fa::info },
-    { "inhaler", fa::inhaler },
-    { "input_numeric", fa::input_numeric },
-    { "input_pipe", fa::input_pipe },
-    { "input_text", fa::input_text },
-    { "integral", fa::integral },
-    { "intersection", fa::intersection },
-    { "island_tropical", fa::island_tropical },
-    { "island_tree_palm", fa::island_tropical },
-    { "italic", fa::italic },
-    { "j", fa::j },
-    { "jack_o_lantern", fa::jack_o_lantern },
-    { "jar", fa::jar },
-    { "jar_wheat", fa::jar_wheat },
-    { "jedi", fa::jedi },
-    { "jet_fighter", fa::jet_fighter },
-    { "fighter_jet", fa::jet_fighter },
-    { "jet_fighter_up", fa::jet_fighter_up },
-    { "joint", fa::joint },
-    { "joystick", fa::joystick },
-    { "jug", fa::jug },
-    { "jug_detergent", fa::jug_detergent },
-    { "k", fa::k },
-    { "kaaba", fa::kaaba },
-    { "kazoo", fa::kazoo },
-    { "kerning", fa::kerning },
-    { "key", fa::key },
-    { "key_skeleton", fa::key_skeleton },
-    { "key_skeleton_left_right", fa::key_skeleton_left_right },
-    { "keyboard", fa::keyboard },
-    { "keyboard_brightness", fa::keyboard_brightness },
-    { "keyboard_brightness_low", fa::keyboard_brightness_low },
-    { "keyboard_down", fa::keyboard_down },
-    { "keyboard_left", fa::keyboard_left },
-    { "keynote", fa::keynote },
-    { "khanda", fa::khanda },
-    { "kidneys", fa::kidneys },
-    { "kip_sign", fa::kip_sign },
-    { "kit_medical", fa::kit_medical },
-    { "first_aid", fa::kit_medical },
-    { "kitchen_set", fa::kitchen_set },
-    { "kite", fa::kite },
-    { "kiwi_bird", fa::kiwi_bird },
-    { "kiwi_fruit", fa::kiwi_fruit },
-    { "knife", fa::knife },
-    { "utensil_knife", fa::knife },
-    { "knife_kitchen", fa::knife_kitchen },
-    { "l", fa::l },
-    { "lacrosse_stick", fa::lacrosse_stick },
-    { "lacrosse_stick_ball", fa::lacrosse_stick_ball },
-    { "lambda", fa::lambda },
-    { "lamp", fa::lamp },
-    { "lamp_desk", fa::lamp_desk },
-    { "lamp_floor", fa::lamp_floor },
-    { "lamp_street", fa::lamp_street },
-    { "land_mine_on", fa::land_mine_on },
-    { "landmark", fa::landmark },
-    { "landmark_dome", fa::landmark_dome },
-    { "landmark_alt", fa::landmark_dome },
-    { "landmark_flag", fa::landmark_flag },
-    { "language", fa::language },
-    { "laptop", fa::laptop },
-    { "laptop_arrow_down", fa::laptop_arrow_down },
-    { "laptop_code", fa::laptop_code },
-    { "laptop_file", fa::laptop_file },
-    { "laptop_medical", fa::laptop_medical },
-    { "laptop_mobile", fa::laptop_mobile },
-    { "phone_laptop", fa::laptop_mobile },
-    { "laptop_slash", fa::laptop_slash },
-    { "lari_sign", fa::lari_sign },
-    { "lasso", fa::lasso },
-    { "lasso_sparkles", fa::lasso_sparkles },
-    { "layer_group", fa::layer_group },
-    { "layer_minus", fa::layer_minus },
-    { "layer_group_minus", fa::layer_minus },
-    { "layer_plus", fa::layer_plus },
-    { "layer_group_plus", fa::layer_plus },
-    { "leaf", fa::leaf },
-    { "leaf_heart", fa::leaf_heart },
-    { "leaf_maple", fa::leaf_maple },
-    { "leaf_oak", fa::leaf_oak },
-    { "leafy_green", fa::leafy_green },
-    { "left", fa::left },
-    { "arrow_alt_left", fa::left },
-    { "left_from_line", fa::left_from_line },
-    { "arrow_alt_from_right", fa::left_from_line },
-    { "left_long", fa::left_long },
-    { "long_arrow_alt_left", fa::left_long },
-    { "left_long_to_line", fa::left_long_to_line },
-    { "left_right", fa::left_right },
-    { "arrows_alt_h", fa::left_right },
-    { "left_to_line", fa::left_to_line },
-    { "arrow_alt_to_left", fa::left_to_line },
-    { "lemon", fa::lemon },
-    { "less_than", fa::less_than },
-    { "less_than_equal", fa::less_than_equal },
-    { "life_ring", fa::life_ring },
-    { "light_ceiling", fa::light_ceiling },
-    { "light_emergency", fa::light_emergency },
-    { "light_emergency_on", fa::light_emergency_on },
-    { "light_switch", fa::light_switch },
-    { "light_switch_off", fa::light_switch_off },
-    { "light_switch_on", fa::light_switch_on },
-    { "lightbulb", fa::lightbulb },
-    { "lightbulb_dollar", fa::lightbulb_dollar },
-    { "lightbulb_exclamation", fa::lightbulb_exclamation },
-    { "lightbulb_exclamation_on", fa::lightbulb_exclamation_on },
-    { "lightbulb_on", fa::lightbulb_on },
-    { "lightbulb_slash", fa::lightbulb_slash },
-    { "lights_holiday", fa::lights_holiday },
-    { "line_columns", fa::line_columns },
-    { "line_height", fa::line_height },
-    { "lines_leaning", fa::lines_leaning },
-    { "link", fa::link },
-    { "chain", fa::link },
-    { "link_horizontal", fa::link_horizontal },
-    { "chain_horizontal", fa::link_horizontal },
-    { "link_horizontal_slash", fa::link_horizontal_slash },
-    { "chain_horizontal_slash", fa::link_horizontal_slash },
-    { "link_simple", fa::link_simple },
-    { "link_simple_slash", fa::link_simple_slash },
-    { "link_slash", fa::link_slash },
-    { "chain_broken", fa::link_slash },
-    { "chain_slash", fa::link_slash },
-    { "unlink", fa::link_slash },
-    { "lips", fa::lips },
-    { "lira_sign", fa::lira_sign },
-    { "list", fa::list },
-    { "list_squares", fa::list },
-    { "list_check", fa::list_check },
-    { "tasks", fa::list_check },
-    { "list_dropdown", fa::list_dropdown },
-    { "list_music", fa::list_music },
-    { "list_ol", fa::list_ol },
-    { "list_1_2", fa::list_ol },
-    { "list_numeric", fa::list_ol },
-    { "list_radio", fa::list_radio },
-    { "list_timeline", fa::list_timeline },
-    { "list_tree", fa::list_tree },
-    { "list_ul", fa::list_ul },
-    { "list_dots", fa::list_ul },
-    { "litecoin_sign", fa::litecoin_sign },
-    { "loader", fa::loader },
-    { "lobster", fa::lobster },
-    { "location_arrow", fa::location_arrow },
-    { "location_check", fa::location_check },
-    { "map_marker_check", fa::location_check },
-    { "location_crosshairs", fa::location_crosshairs },
-    { "location", fa::location_crosshairs },
-    { "location_crosshairs_slash", fa::location_crosshairs_slash },
-    { "location_slash", fa::location_crosshairs_slash },
-    { "location_dot", fa::location_dot },
-    { "map_marker_alt", fa::location_dot },
-    { "location_dot_slash", fa::location_dot_slash },
-    { "map_marker_alt_slash", fa::location_dot_slash },
-    { "location_exclamation", fa::location_exclamation },
-    { "map_marker_exclamation", fa::location_exclamation },
-    { "location_minus", fa::location_minus },
-    { "map_marker_minus", fa::location_minus },
-    { "location_pen", fa::location_pen },
-    { "map_marker_edit", fa::location_pen },
-    { "location_pin", fa::location_pin },
-    { "map_marker", fa::location_pin },
-    { "location_pin_lock", fa::location_pin_lock },
-    { "location_pin_slash", fa::location_pin_slash },
-    { "map_marker_slash", fa::location_pin_slash },
-    { "location_plus", fa::location_plus },
-    { "map_marker_plus", fa::location_plus },
-    { "location_question", fa::location_question },
-    { "map_marker_question", fa::location_question },
-    { "location_smile", fa::location_smile },
-    { "map_marker_smile", fa::location_smile },
-    { "location_xmark", fa::location_xmark },
-    { "map_marker_times", fa::location_xmark },
-    { "map_marker_xmark", fa::location_xmark },
-    { "lock", fa::lock },
-    { "lock_a", fa::lock_a },
-    { "lock_hashtag", fa::lock_hashtag },
-    { "lock_keyhole", fa::lock_keyhole },
-    { "lock_alt", fa::lock_keyhole },
-    { "lock_keyhole_open", fa::lock_keyhole_open },
-    { "lock_open_alt", fa::lock_keyhole_open },
-    { "lock_open", fa::lock_open },
-    { "locust", fa::locust },
-    { "lollipop", fa::lollipop },
-    { "lollypop", fa::lollipop },
-    { "loveseat", fa::loveseat },
-    { "couch_small", fa::loveseat },
-    { "luchador_mask", fa::luchador_mask },
-    { "luchador", fa::luchador_mask },
-    { "mask_luchador", fa::luchador_mask },
-    { "lungs", fa::lungs },
-    { "lungs_virus", fa::lungs_virus },
-    { "m", fa::m },
-    { "mace", fa::mace },
-    { "magnet", fa::magnet },
-    { "magnifying_glass", fa::magnifying_glass },
-    { "search", fa::magnifying_glass },
-    { "magnifying_glass_arrow_right", fa::magnifying_glass_arrow_right },
-    { "magnifying_glass_chart", fa::magnifying_glass_chart },
-    { "magnifying_glass_dollar", fa::magnifying_glass_dollar },
-    { "search_dollar", fa::magnifying_glass_dollar },
-    { "magnifying_glass_location", fa::magnifying_glass_location },
-    { "search_location", fa::magnifying_glass_location },
-    { "magnifying_glass_minus", fa::magnifying_glass_minus },
-    { "search_minus", fa::magnifying_glass_minus },
-    { "magnifying_glass_plus", fa::magnifying_glass_plus },
-    { "search_plus", fa::magnifying_glass_plus },
-    { "mailbox", fa::mailbox },
-    { "manat_sign", fa::manat_sign },
-    { "mandolin", fa::mandolin },
-    { "mango", fa::mango },
-    { "manhole", fa::manhole },
-    { "map", fa::map },
-    { "map_location", fa::map_location },
-    { "map_marked", fa::map_location },
-    { "map_location_dot", fa::map_location_dot },
-    { "map_marked_alt", fa::map_location_dot },
-    { "map_pin", fa::map_pin },
-    { "marker", fa::marker },
-    { "mars", fa::mars },
-    { "mars_and_venus", fa::mars_and_venus },
-    { "mars_and_venus_burst", fa::mars_and_venus_burst },
-    { "mars_double", fa::mars_double },
-    { "mars_stroke", fa::mars_stroke },
-    { "mars_stroke_right", fa::mars_stroke_right },
-    { "mars_stroke_h", fa::mars_stroke_right },
-    { "mars_stroke_up", fa::mars_stroke_up },
-    { "mars_stroke_v", fa::mars_stroke_up },
-    { "martini_glass", fa::martini_glass },
-    { "glass_martini_alt", fa::martini_glass },
-    { "martini_glass_citrus", fa::martini_glass_citrus },
-    { "cocktail", fa::martini_glass_citrus },
-    { "martini_glass_empty", fa::martini_glass_empty },
-    { "glass_martini", fa::martini_glass_empty },
-    { "mask", fa::mask },
-    { "mask_face", fa::mask_face },
-    { "mask_snorkel", fa::mask_snorkel },
-    { "mask_ventilator", fa::mask_ventilator },
-    { "masks_theater", fa::masks_theater },
-    { "theater_masks", fa::masks_theater },
-    { "mattress_pillow", fa::mattress_pillow },
-    { "maximize", fa::maximize },
-    { "expand_arrows_alt", fa::maximize },
-    { "meat", fa::meat },
-    { "medal", fa::medal },
-    { "megaphone", fa::megaphone },
-    { "melon", fa::melon },
-    { "melon_slice", fa::melon_slice },
-    { "memo", fa::memo },
-    { "memo_circle_check", fa::memo_circle_check },
-    { "memo_circle_info", fa::memo_circle_info },
-    { "memo_pad", fa::memo_pad },
-    { "memory", fa::memory },
-    { "menorah", fa::menorah },
-    { "mercury", fa::mercury },
-    { "merge", fa::merge },
-    { "message", fa::message },
-    { "comment_alt", fa::message },
-    { "message_arrow_down", fa::message_arrow_down },
-    { "comment_alt_arrow_down", fa::message_arrow_down },
-    { "message_arrow_up", fa::message_arrow_up },
-    { "comment_alt_arrow_up", fa::message_arrow_up },
-    { "message_arrow_up_right", fa::message_arrow_up_right },
-    { "message_bot", fa::message_bot },
-    { "message_captions", fa::message_captions },
-    { "comment_alt_captions", fa::message_captions },
-    { "message_check", fa::message_check },
-    { "comment_alt_check", fa::message_check },
-    { "message_code", fa::message_code },
-    { "message_dollar", fa::message_dollar },
-    { "comment_alt_dollar", fa::message_dollar },
-    { "message_dots", fa::message_dots },
-    { "comment_alt_dots", fa::message_dots },
-    { "messaging", fa::message_dots },
-    { "message_exclamation", fa::message_exclamation },
-    { "comment_alt_exclamation", fa::message_exclamation },
-    { "message_image", fa::message_image },
-    { "comment_alt_image", fa::message_image },
-    { "message_lines", fa::message_lines },
-    { "comment_alt_lines", fa::message_lines },
-    { "message_medical", fa::message_medical },
-    { "comment_alt_medical", fa::message_medical },
-    { "message_middle", fa::message_middle },
-    { "comment_middle_alt", fa::message_middle },
-    { "message_middle_top", fa::message_middle_top },
-    { "comment_middle_top_alt", fa::message_middle_top },
-    { "message_minus", fa::message_minus },
-    { "comment_alt_minus", fa::message_minus },
-    { "message_music", fa::message_music },
-    { "comment_alt_music", fa::message_music },
-    { "message_pen", fa::message_pen },
-    { "comment_alt_edit", fa::message_pen },
-    { "message_edit", fa::message_pen },
-    { "message_plus", fa::message_plus },
-    { "comment_alt_plus", fa::message_plus },
-    { "message_question", fa::message_question },
-    { "message_quote", fa::message_quote },
-    { "comment_alt_quote", fa::message_quote },
-    { "message_slash", fa::message_slash },
-    { "comment_alt_slash", fa::message_slash },
-    { "message_smile", fa::message_smile },
-    { "comment_alt_smile", fa::message_smile },
-    { "message_sms", fa::message_sms },
-    { "message_text", fa::message_text },
-    { "comment_alt_text", fa::message_text },
-    { "message_xmark", fa::message_xmark },
-    { "comment_alt_times", fa::message_xmark },
-    { "message_times", fa::message_xmark },
-    { "messages", fa::messages },
-    { "comments_alt", fa::messages },
-    { "messages_dollar", fa::messages_dollar },
-    { "comments_alt_dollar", fa::messages_dollar },
-    { "messages_question", fa::messages_question },
-    { "meteor", fa::meteor },
-    { "meter", fa::meter },
-    { "meter_bolt", fa::meter_bolt },
-    { "meter_droplet", fa::meter_droplet },
-    { "meter_fire", fa::meter_fire },
-    { "microchip", fa::microchip },
-    { "microchip_ai", fa::microchip_ai },
-    { "microphone", fa::microphone },
-    { "microphone_lines", fa::microphone_lines },
-    { "microphone_alt", fa::microphone_lines },
-    { "microphone_lines_slash", fa::microphone_lines_slash },
-    { "microphone_alt_slash", fa::microphone_lines_slash },
-    { "microphone_slash", fa::microphone_slash },
-    { "microphone_stand", fa::microphone_stand },
-    { "microscope", fa::microscope },
-    { "microwave", fa::microwave },
-    { "mill_sign", fa::mill_sign },
-    { "minimize", fa::minimize },
-    { "compress_arrows_alt", fa::minimize },
-    { "minus", fa::minus },
-    { "subtract", fa::minus },
-    { "mistletoe", fa::mistletoe },
-    { "mitten", fa::mitten },
-    { "mobile", fa::mobile },
-    { "mobile_android", fa::mobile },
-    { "mobile_phone", fa::mobile },
-    { "mobile_button", fa::mobile_button },
-    { "mobile_notch", fa::mobile_notch },
-    { "mobile_iphone", fa::mobile_notch },
-    { "mobile_retro", fa::mobile_retro },
-    { "mobile_screen", fa::mobile_screen },
-    { "mobile_android_alt", fa::mobile_screen },
-    { "mobile_screen_button", fa::mobile_screen_button },
-    { "mobile_alt", fa::mobile_screen_button },
-    { "mobile_signal", fa::mobile_signal },
-    { "mobile_signal_out", fa::mobile_signal_out },
-    { "money_bill", fa::money_bill },
-    { "money_bill_1", fa::money_bill_1 },
-    { "money_bill_alt", fa::money_bill_1 },
-    { "money_bill_1_wave", fa::money_bill_1_wave },
-    { "money_bill_wave_alt", fa::money_bill_1_wave },
-    { "money_bill_simple", fa::money_bill_simple },
-    { "money_bill_simple_wave", fa::money_bill_simple_wave },
-    { "money_bill_transfer", fa::money_bill_transfer },
-    { "money_bill_trend_up", fa::money_bill_trend_up },
-    { "money_bill_wave", fa::money_bill_wave },
-    { "money_bill_wheat", fa::money_bill_wheat },
-    { "money_bills", fa::money_bills },
-    { "money_bills_simple", fa::money_bills_simple },
-    { "money_bills_alt", fa::money_bills_simple },
-    { "money_check", fa::money_check },
-    { "money_check_dollar", fa::money_check_dollar },
-    { "money_check_alt", fa::money_check_dollar },
-    { "money_check_dollar_pen", fa::money_check_dollar_pen },
-    { "money_check_edit_alt", fa::money_check_dollar_pen },
-    { "money_check_pen", fa::money_check_pen },
-    { "money_check_edit", fa::money_check_pen },
-    { "money_from_bracket", fa::money_from_bracket },
-    { "money_simple_from_bracket", fa::money_simple_from_bracket },
-    { "monitor_waveform", fa::monitor_waveform },
-    { "monitor_heart_rate", fa::monitor_waveform },
-    { "monkey", fa::monkey },
-    { "monument", fa::monument },
-    { "moon", fa::moon },
-    { "moon_cloud", fa::moon_cloud },
-    { "moon_over_sun", fa::moon_over_sun },
-    { "eclipse_alt", fa::moon_over_sun },
-    { "moon_stars", fa::moon_stars },
-    { "moped", fa::moped },
-    { "mortar_pestle", fa::mortar_pestle },
-    { "mosque", fa::mosque },
-    { "mosquito", fa::mosquito },
-    { "mosquito_net", fa::mosquito_net },
-    { "motorcycle", fa::motorcycle },
-    { "mound", fa::mound },
-    { "mountain", fa::mountain },
-    { "mountain_city", fa::mountain_city },
-    { "mountain_sun", fa::mountain_sun },
-    { "mountains", fa::mountains },
-    { "mp3_player", fa::mp3_player },
-    { "mug", fa::mug },
-    { "mug_hot", fa::mug_hot },
-    { "mug_marshmallows", fa::mug_marshmallows },
-    { "mug_saucer", fa::mug_saucer },
-    { "coffee", fa::mug_saucer },
-    { "mug_tea", fa::mug_tea },
-    { "mug_tea_saucer", fa::mug_tea_saucer },
-    { "mushroom", fa::mushroom },
-    { "music", fa::music },
-    { "music_note", fa::music_note },
-    { "music_alt", fa::music_note },
-    { "music_note_slash", fa::music_note_slash },
-    { "music_alt_slash", fa::music_note_slash },
-    { "music_slash", fa::music_slash },
-    { "n", fa::n },
-    { "naira_sign", fa::naira_sign },
-    { "narwhal", fa::narwhal },
-    { "nesting_dolls", fa::nesting_dolls },
-    { "network_wired", fa::network_wired },
-    { "neuter", fa::neuter },
-    { "newspaper", fa::newspaper },
-    { "nfc", fa::nfc },
-    { "nfc_lock", fa::nfc_lock },
-    { "nfc_magnifying_glass", fa::nfc_magnifying_glass },
-    { "nfc_pen", fa::nfc_pen },
-    { "nfc_signal", fa::nfc_signal },
-    { "nfc_slash", fa::nfc_slash },
-    { "nfc_trash", fa::nfc_trash },
-    { "not_equal", fa::not_equal },
-    { "notdef", fa::notdef },
-    { "note", fa::note },
-    { "note_medical", fa::note_medical },
-    { "note_sticky", fa::note_sticky },
-    { "sticky_note", fa::note_sticky },
-    { "notebook", fa::notebook },
-    { "notes", fa::notes },
-    { "notes_medical", fa::notes_medical },
-    { "o", fa::o },
-    { "object_exclude", fa::object_exclude },
-    { "object_group", fa::object_group },
-    { "object_intersect", fa::object_intersect },
-    { "object_subtract", fa::object_subtract },
-    { "object_ungroup", fa::object_ungroup },
-    { "object_union", fa::object_union },
-    { "objects_align_bottom", fa::objects_align_bottom },
-    { "objects_align_center_horizontal", fa::objects_align_center_horizontal },
-    { "objects_align_center_vertical", fa::objects_align_center_vertical },
-    { "objects_align_left", fa::objects_align_left },
-    { "objects_align_right", fa::objects_align_right },
-    { "objects_align_top", fa::objects_align_top },
-    { "objects_column", fa::objects_column },
-    { "octagon", fa::octagon },
-    { "octagon_check", fa::octagon_check },
-    { "octagon_divide", fa::octagon_divide },
-    { "octagon_exclamation", fa::octagon_exclamation },
-    { "octagon_minus", fa::octagon_minus },
-    { "minus_octagon", fa::octagon_minus },
-    { "octagon_plus", fa::octagon_plus },
-    { "plus_octagon", fa::octagon_plus },
-    { "octagon_xmark", fa::octagon_xmark },
-    { "times_octagon", fa::octagon_xmark },
-    { "xmark_octagon", fa::octagon_xmark },
-    { "oil_can", fa::oil_can },
-    { "oil_can_drip", fa::oil_can_drip },
-    { "oil_temperature", fa::oil_temperature },
-    { "oil_temp", fa::oil_temperature },
-    { "oil_well", fa::oil_well },
-    { "olive", fa::olive },
-    { "olive_branch", fa::olive_branch },
-    { "om", fa::om },
-    { "omega", fa::omega },
-    { "onion", fa::onion },
-    { "option", fa::option },
-    { "ornament", fa::ornament },
-    { "otter", fa::otter },
-    { "outdent", fa::outdent },
-    { "dedent", fa::outdent },
-    { "outlet", fa::outlet },
-    { "oven", fa::oven },
-    { "overline", fa::overline },
-    { "p", fa::p },
-    { "page", fa::page },
-    { "page_caret_down", fa::page_caret_down },
-    { "file_caret_down", fa::page_caret_down },
-    { "page_caret_up", fa::page_caret_up },
-    { "file_caret_up", fa::page_caret_up },
-    { "pager", fa::pager },
-    { "paint_roller", fa::paint_roller },
-    { "paintbrush", fa::paintbrush },
-    { "paint_brush", fa::paintbrush },
-    { "paintbrush_fine", fa::paintbrush_fine },
-    { "paint_brush_alt", fa::paintbrush_fine },
-    { "paint_brush_fine", fa::paintbrush_fine },
-    { "paintbrush_alt", fa::paintbrush_fine },
-    { "paintbrush_pencil", fa::paintbrush_pencil },
-    { "palette", fa::palette },
-    { "pallet", fa::pallet },
-    { "pallet_box", fa::pallet_box },
-    { "pallet_boxes", fa::pallet_boxes },
-    { "palette_boxes", fa::pallet_boxes },
-    { "pallet_alt", fa::pallet_boxes },
-    { "pan_food", fa::pan_food },
-    { "pan_frying", fa::pan_frying },
-    { "pancakes", fa::pancakes },
-    { "panel_ews", fa::panel_ews },
-    { "panel_fire", fa::panel_fire },
-    { "panorama", fa::panorama },
-    { "paper_plane", fa::paper_plane },
-    { "paper_plane_top", fa::paper_plane_top },
-    { "paper_plane_alt", fa::paper_plane_top },
-    { "send", fa::paper_plane_top },
-    { "paperclip", fa::paperclip },
-    { "paperclip_vertical", fa::paperclip_vertical },
-    { "parachute_box", fa::parachute_box },
-    { "paragraph", fa::paragraph },
-    { "paragraph_left", fa::paragraph_left },
-    { "paragraph_rtl", fa::paragraph_left },
-    { "party_bell", fa::party_bell },
-    { "party_horn", fa::party_horn },
-    { "passport", fa::passport },
-    { "paste", fa::paste },
-    { "file_clipboard", fa::paste },
-    { "pause", fa::pause },
-    { "paw", fa::paw },
-    { "paw_claws", fa::paw_claws },
-    { "paw_simple", fa::paw_simple },
-    { "paw_alt", fa::paw_simple },
-    { "peace", fa::peace },
-    { "peach", fa::peach },
-    { "peanut", fa::peanut },
-    { "peanuts", fa::peanuts },
-    { "peapod", fa::peapod },
-    { "pear", fa::pear },
-    { "pedestal", fa::pedestal },
-    { "pegasus", fa::pegasus },
-    { "pen", fa::pen },
-    { "pen_circle", fa::pen_circle },
-    { "pen_clip", fa::pen_clip },
-    { "pen_alt", fa::pen_clip },
-    { "pen_clip_slash", fa::pen_clip_slash },
-    { "pen_alt_slash", fa::pen_clip_slash },
-    { "pen_fancy", fa::pen_fancy },
-    { "pen_fancy_slash", fa::pen_fancy_slash },
-    { "pen_field", fa::pen_field },
-    { "pen_line", fa::pen_line },
-    { "pen_nib", fa::pen_nib },
-    { "pen_nib_slash", fa::pen_nib_slash },
-    { "pen_paintbrush", fa::pen_paintbrush },
-    { "pencil_paintbrush", fa::pen_paintbrush },
-    { "pen_ruler", fa::pen_ruler },
-    { "pencil_ruler", fa::pen_ruler },
-    { "pen_slash", fa::pen_slash },
-    { "pen_swirl", fa::pen_swirl },
-    { "pen_to_square", fa::pen_to_square },
-    { "edit", fa::pen_to_square },
-    { "pencil", fa::pencil },
-    { "pencil_alt", fa::pencil },
-    { "pencil_slash", fa::pencil_slash },
-    { "people", fa::people },
-    { "people_arrows_left_right", fa::people_arrows_left_right },
-    { "people_arrows", fa::people_arrows_left_right },
-    { "people_carry_box", fa::people_carry_box },
-    { "people_carry", fa::people_carry_box },
-    { "people_dress", fa::people_dress },
-    { "people_dress_simple", fa::people_dress_simple },
-    { "people_group", fa::people_group },
-    { "people_line", fa::people_line },
-    { "people_pants", fa::people_pants },
-    { "people_pants_simple", fa::people_pants_simple },
-    { "people_pulling", fa::people_pulling },
-    { "people_robbery", fa::people_robbery },
-    { "people_roof", fa::people_roof },
-    { "people_simple", fa::people_simple },
-    { "pepper", fa::pepper },
-    { "pepper_hot", fa::pepper_hot },
-    { "percent", fa::percent },
-    { "percentage", fa::percent },
-    { "period", fa::period },
-    { "person", fa::person },
-    { "male", fa::person },
-    { "person_arrow_down_to_line", fa::person_arrow_down_to_line },
-    { "person_arrow_up_from_line", fa::person_arrow_up_from_line },
-    { "person_biking", fa::person_biking },
-    { "biking", fa::person_biking },
-    { "person_biking_mountain", fa::person_biking_mountain },
-    { "biking_mountain", fa::person_biking_mountain },
-    { "person_booth", fa::person_booth },
-    { "person_breastfeeding", fa::person_breastfeeding },
-    { "person_burst", fa::person_burst },
-    { "person_cane", fa::person_cane },
-    { "person_carry_box", fa::person_carry_box },
-    { "person_carry", fa::person_carry_box },
-    { "person_chalkboard", fa::person_chalkboard },
-    { "person_circle_check", fa::person_circle_check },
-    { "person_circle_exclamation", fa::person_circle_exclamation },
-    { "person_circle_minus", fa::person_circle_minus },
-    { "person_circle_plus", fa::person_circle_plus },
-    { "person_circle_question", fa::person_circle_question },
-    { "person_circle_xmark", fa::person_circle_xmark },
-    { "person_digging", fa::person_digging },
-    { "digging", fa::person_digging },
-    { "person_dolly", fa::person_dolly },
-    { "person_dolly_empty", fa::person_dolly_empty },
-    { "person_dots_from_line", fa::person_dots_from_line },
-    { "diagnoses", fa::person_dots_from_line },
-    { "person_dress", fa::person_dress },
-    { "female", fa::person_dress },
-    { "person_dress_burst", fa::person_dress_burst },
-    { "person_dress_simple", fa::person_dress_simple },
-    { "person_drowning", fa::person_drowning },
-    { "person_falling", fa::person_falling },
-    { "person_falling_burst", fa::person_falling_burst },
-    { "person_from_portal", fa::person_from_portal },
-    { "portal_exit", fa::person_from_portal },
-    { "person_half_dress", fa::person_half_dress },
-    { "person_harassing", fa::person_harassing },
-    { "person_hiking", fa::person_hiking },
-    { "hiking", fa::person_hiking },
-    { "person_military_pointing", fa::person_military_pointing },
-    { "person_military_rifle", fa::person_military_rifle },
-    { "person_military_to_person", fa::person_military_to_person },
-    { "person_pinball", fa::person_pinball },
-    { "person_praying", fa::person_praying },
-    { "pray", fa::person_praying },
-    { "person_pregnant", fa::person_pregnant },
-    { "person_rays", fa::person_rays },
-    { "person_rifle", fa::person_rifle },
-    { "person_running", fa::person_running },
-    { "running", fa::person_running },
-    { "person_seat", fa::person_seat },
-    { "person_seat_reclined", fa::person_seat_reclined },
-    { "person_shelter", fa::person_shelter },
-    { "person_sign", fa::person_sign },
-    { "person_simple", fa::person_simple },
-    { "person_skating", fa::person_skating },
-    { "skating", fa::person_skating },
-    { "person_ski_jumping", fa::person_ski_jumping },
-    { "ski_jump", fa::person_ski_jumping },
-    { "person_ski_lift", fa::person_ski_lift },
-    { "ski_lift", fa::person_ski_lift },
-    { "person_skiing", fa::person_skiing },
-    { "skiing", fa::person_skiing },
-    { "person_skiing_nordic", fa::person_skiing_nordic },
-    { "skiing_nordic", fa::person_skiing_nordic },
-    { "person_sledding", fa::person_sledding },
-    { "sledding", fa::person_sledding },
-    { "person_snowboarding", fa::person_snowboarding },
-    { "snowboarding", fa::person_snowboarding },
-    { "person_snowmobiling", fa::person_snowmobiling },
-    { "snowmobile", fa::person_snowmobiling },
-    { "person_swimming", fa::person_swimming },
-    { "swimmer", fa::person_swimming },
-    { "person_through_window", fa::person_through_window },
-    { "person_to_door", fa::person_to_door },
-    { "person_to_portal", fa::person_to_portal },
-    { "portal_enter", fa::person_to_portal },
-    { "person_walking", fa::person_walking },
-    { "walking", fa::person_walking },
-    { "person_walking_arrow_loop_left", fa::person_walking_arrow_loop_left },
-    { "person_walking_arrow_right", fa::person_walking_arrow_right },
-    { "person_walking_dashed_line_arrow_right", fa::person_walking_dashed_line_arrow_right },
-    { "person_walking_luggage", fa::person_walking_luggage },
-    { "person_walking_with_cane", fa::person_walking_with_cane },
-    { "blind", fa::person_walking_with_cane },
-    { "peseta_sign", fa::peseta_sign },
-    { "peso_sign", fa::peso_sign },
-    { "phone", fa::phone },
-    { "phone_arrow_down_left", fa::phone_arrow_down_left },
-    { "phone_arrow_down", fa::phone_arrow_down_left },
-    { "phone_incoming", fa::phone_arrow_down_left },
-    { "phone_arrow_up_right", fa::phone_arrow_up_right },
-    { "phone_arrow_up", fa::phone_arrow_up_right },
-    { "phone_outgoing", fa::phone_arrow_up_right },
-    { "phone_flip", fa::phone_flip },
-    { "phone_alt", fa::phone_flip },
-    { "phone_hangup", fa::phone_hangup },
-    { "phone_intercom", fa::phone_intercom },
-    { "phone_missed", fa::phone_missed },
-    { "phone_office", fa::phone_office },
-    { "phone_plus", fa::phone_plus },
-    { "phone_rotary", fa::phone_rotary },
-    { "phone_slash", fa::phone_slash },
-    { "phone_volume", fa::phone_volume },
-    { "volume_control_phone", fa::phone_volume },
-    { "phone_xmark", fa::phone_xmark },
-    { "photo_film", fa::photo_film },
-    { "photo_video", fa::photo_film },
-    { "photo_film_music", fa::photo_film_music },
-    { "pi", fa::pi },
-    { "piano", fa::piano },
-    { "piano_keyboard", fa::piano_keyboard },
-    { "pickleball", fa::pickleball },
-    { "pie", fa::pie },
-    { "pig", fa::pig },
-    { "piggy_bank", fa::piggy_bank },
-    { "pills", fa::pills },
-    { "pinata", fa::pinata },
-    { "pinball", fa::pinball },
-    { "pineapple", fa::pineapple },
-    { "pipe", fa::pipe },
-    { "pipe_circle_check", fa::pipe_circle_check },
-    { "pipe_collar", fa::pipe_collar },
-    { "pipe_section", fa::pipe_section },
-    { "pipe_smoking", fa::pipe_smoking },
-    { "pipe_valve", fa::pipe_valve },
-    { "pizza", fa::pizza },
-    { "pizza_slice", fa::pizza_slice },
-    { "place_of_worship", fa::place_of_worship },
-    { "plane", fa::plane },
-    { "plane_arrival", fa::plane_arrival },
-    { "plane_circle_check", fa::plane_circle_check },
-    { "plane_circle_exclamation", fa::plane_circle_exclamation },
-    { "plane_circle_xmark", fa::plane_circle_xmark },
-    { "plane_departure", fa::plane_departure },
-    { "plane_engines", fa::plane_engines },
-    { "plane_alt", fa::plane_engines },
-    { "plane_lock", fa::plane_lock },
-    { "plane_prop", fa::plane_prop },
-    { "plane_slash", fa::plane_slash },
-    { "plane_tail", fa::plane_tail },
-    { "plane_up", fa::plane_up },
-    { "plane_up_slash", fa::plane_up_slash },
-    { "planet_moon", fa::planet_moon },
-    { "planet_ringed", fa::planet_ringed },
-    { "plant_wilt", fa::plant_wilt },
-    { "plate_utensils", fa::plate_utensils },
-    { "plate_wheat", fa::plate_wheat },
-    { "play", fa::play },
-    { "play_pause", fa::play_pause },
-    { "plug", fa::plug },
-    { "plug_circle_bolt", fa::plug_circle_bolt },
-    { "plug_circle_check", fa::plug_circle_check },
-    { "plug_circle_exclamation", fa::plug_circle_exclamation },
-    { "plug_circle_minus", fa::plug_circle_minus },
-    { "plug_circle_plus", fa::plug_circle_plus },
-    { "plug_circle_xmark", fa::plug_circle_xmark },
-    { "plus", fa::plus },
-    { "add", fa::plus },
-    { "plus_large", fa::plus_large },
-    { "plus_minus", fa::plus_minus },
-    { "podcast", fa::podcast },
-    { "podium", fa::podium },
-    { "podium_star", fa::podium_star },
-    { "police_box", fa::police_box },
-    { "poll_people", fa::poll_people },
-    { "pompebled", fa::pompebled },
-    { "poo", fa::poo },
-    { "poo_storm", fa::poo_storm },
-    { "poo_bolt", fa::poo_storm },
-    { "pool_8_ball", fa::pool_8_ball },
-    { "poop", fa::poop },
-    { "popcorn", fa::popcorn },
-    { "popsicle", fa::popsicle },
-    { "pot_food", fa::pot_food },
-    { "potato", fa::potato },
-    { "power_off", fa::power_off },
-    { "prescription", fa::prescription },
-    { "prescription_bottle", fa::prescription_bottle },
-    { "prescription_bottle_medical", fa::prescription_bottle_medical },
-    { "prescription_bottle_alt", fa::prescription_bottle_medical },
-    { "presentation_screen", fa::presentation_screen },
-    { "presentation", fa::presentation_screen },
-    { "pretzel", fa::pretzel },
-    { "print", fa::print },
-    { "print_magnifying_glass", fa::print_magnifying_glass },
-    { "print_search", fa::print_magnifying_glass },
-    { "print_slash", fa::print_slash },
-    { "projector", fa::projector },
-    { "pump", fa::pump },
-    { "pump_medical", fa::pump_medical },
-    { "pump_soap", fa::pump_soap },
-    { "pumpkin", fa::pumpkin },
-    { "puzzle", fa::puzzle },
-    { "puzzle_piece", fa::puzzle_piece },
-    { "puzzle_piece_simple", fa::puzzle_piece_simple },
-    { "puzzle_piece_alt", fa::puzzle_piece_simple },
-    { "q", fa::q },
-    { "qrcode", fa::qrcode },
-    { "question", fa::question },
-    { "quote_left", fa::quote_left },
-    { "quote_left_alt", fa::quote_left },
-    { "quote_right", fa::quote_right },
-    { "quote_right_alt", fa::quote_right },
-    { "quotes", fa::quotes },
-    { "r", fa::r },
-    { "rabbit", fa::rabbit },
-    { "rabbit_running", fa::rabbit_running },
-    { "rabbit_fast", fa::rabbit_running },
-    { "racquet", fa::racquet },
-    { "radar", fa::radar },
-    { "radiation", fa::radiation },
-    { "radio", fa::radio },
-    { "radio_tuner", fa::radio_tuner },
-    { "radio_alt", fa::radio_tuner },
-    { "rainbow", fa::rainbow },
-    { "raindrops", fa::raindrops },
-    { "ram", fa::ram },
-    { "ramp_loading", fa::ramp_loading },
-    { "ranking_star", fa::ranking_star },
-    { "raygun", fa::raygun },
-    { "receipt", fa::receipt },
-    { "record_vinyl", fa::record_vinyl },
-    { "rectangle", fa::rectangle },
-    { "rectangle_landscape", fa::rectangle },
-    { "rectangle_ad", fa::rectangle_ad },
-    { "ad", fa::rectangle_ad },
-    { "rectangle_barcode", fa::rectangle_barcode },
-    { "barcode_alt", fa::rectangle_barcode },
-    { "rectangle_code", fa::rectangle_code },
-    { "rectangle_history", fa::rectangle_history },
-    { "rectangle_history_circle_plus", fa::rectangle_history_circle_plus },
-    { "rectangle_history_circle_user", fa::rectangle_history_circle_user },
-    { "rectangle_list", fa::rectangle_list },
-    { "list_alt", fa::rectangle_list },
-    { "rectangle_pro", fa::rectangle_pro },
-    { "pro", fa::rectangle_pro },
-    { "rectangle_terminal", fa::rectangle_terminal },
-    { "rectangle_vertical", fa::rectangle_vertical },
-    { "rectangle_portrait", fa::rectangle_vertical },
-    { "rectangle_vertical_history", fa::rectangle_vertical_history },
-    { "rectangle_wide", fa::rectangle_wide },
-    { "rectangle_xmark", fa::rectangle_xmark },
-    { "rectangle_times", fa::rectangle_xmark },
-    { "times_rectangle", fa::rectangle_xmark },
-    { "window_close", fa::rectangle_xmark },
-    { "rectangles_mixed", fa::rectangles_mixed },
-    { "recycle", fa::recycle },
-    { "reel", fa::reel },
-    { "refrigerator", fa::refrigerator },
-    { "registered", fa::registered },
-    { "repeat", fa::repeat },
-    { "repeat_1", fa::repeat_1 },
-    { "reply", fa::reply },
-    { "mail_reply", fa::reply },
-    { "reply_all", fa::reply_all },
-    { "mail_reply_all", fa::reply_all },
-    { "reply_clock", fa::reply_clock },
-    { "reply_time", fa::reply_clock },
-    { "republican", fa::republican },
-    { "restroom", fa::restroom },
-    { "restroom_simple", fa::restroom_simple },
-    { "retweet", fa::retweet },
-    { "rhombus", fa::rhombus },
-    { "ribbon", fa::ribbon },
-    { "right", fa::right },
-    { "arrow_alt_right", fa::right },
-    { "right_from_bracket", fa::right_from_bracket },
-    { "sign_out_alt", fa::right_from_bracket },
-    { "right_from_line", fa::right_from_line },
-    { "arrow_alt_from_left", fa::right_from_line },
-    { "right_left", fa::right_left },
-    { "exchange_alt", fa::right_left },
-    { "right_long", fa::right_long },
-    { "long_arrow_alt_right", fa::right_long },
-    { "right_long_to_line", fa::right_long_to_line },
-    { "right_to_bracket", fa::right_to_bracket },
-    { "sign_in_alt", fa::right_to_bracket },
-    { "right_to_line", fa::right_to_line },
-    { "arrow_alt_to_right", fa::right_to_line },
-    { "ring", fa::ring },
-    { "rings_wedding", fa::rings_wedding },
-    { "road", fa::road },
-    { "road_barrier", fa::road_barrier },
-    { "road_bridge", fa::road_bridge },
-    { "road_circle_check", fa::road_circle_check },
-    { "road_circle_exclamation", fa::road_circle_exclamation },
-    { "road_circle_xmark", fa::road_circle_xmark },
-    { "road_lock", fa::road_lock },
-    { "road_spikes", fa::road_spikes },
-    { "robot", fa::robot },
-    { "robot_astromech", fa::robot_astromech },
-    { "rocket", fa::rocket },
-    { "rocket_launch", fa::rocket_launch },
-    { "roller_coaster", fa::roller_coaster },
-    { "rotate", fa::rotate },
-    { "sync_alt", fa::rotate },
-    { "rotate_exclamation", fa::rotate_exclamation },
-    { "rotate_left", fa::rotate_left },
-    { "rotate_back", fa::rotate_left },
-    { "rotate_backward", fa::rotate_left },
-    { "undo_alt", fa::rotate_left },
-    { "rotate_right", fa::rotate_right },
-    { "redo_alt", fa::rotate_right },
-    { "rotate_forward", fa::rotate_right },
-    { "route", fa::route },
-    { "route_highway", fa::route_highway },
-    { "route_interstate", fa::route_interstate },
-    { "router", fa::router },
-    { "rss", fa::rss },
-    { "feed", fa::rss },
-    { "ruble_sign", fa::ruble_sign },
-    { "rouble", fa::ruble_sign },
-    { "rub", fa::ruble_sign },
-    { "ruble", fa::ruble_sign },
-    { "rug", fa::rug },
-    { "rugby_ball", fa::rugby_ball },
-    { "ruler", fa::ruler },
-    { "ruler_combined", fa::ruler_combined },
-    { "ruler_horizontal", fa::ruler_horizontal },
-    { "ruler_triangle", fa::ruler_triangle },
-    { "ruler_vertical", fa::ruler_vertical },
-    { "rupee_sign", fa::rupee_sign },
-    { "rupee", fa::rupee_sign },
-    { "rupiah_sign", fa::rupiah_sign },
-    { "rv", fa::rv },
-    { "s", fa::s },
-    { "sack", fa::sack },
-    { "sack_dollar", fa::sack_dollar },
-    { "sack_xmark", fa::sack_xmark },
-    { "sailboat", fa::sailboat },
-    { "salad", fa::salad },
-    { "bowl_salad", fa::salad },
-    { "salt_shaker", fa::salt_shaker },
-    { "sandwich", fa::sandwich },
-    { "satellite", fa::satellite },
-    { "satellite_dish", fa::satellite_dish },
-    { "sausage", fa::sausage },
-    { "saxophone", fa::saxophone },
-    { "saxophone_fire", fa::saxophone_fire },
-    { "sax_hot", fa::saxophone_fire },
-    { "scale_balanced", fa::scale_balanced },
-    { "balance_scale", fa::scale_balanced },
-    { "scale_unbalanced", fa::scale_unbalanced },
-    { "balance_scale_left", fa::scale_unbalanced },
-    { "scale_unbalanced_flip", fa::scale_unbalanced_flip },
-    { "balance_scale_right", fa::scale_unbalanced_flip },
-    { "scalpel", fa::scalpel },
-    { "scalpel_line_dashed", fa::scalpel_line_dashed },
-    { "scalpel_path", fa::scalpel_line_dashed },
-    { "scanner", fa::scanner },
-    { "scanner_image", fa::scanner },
-    { "scanner_gun", fa::scanner_gun },
-    { "scanner_keyboard", fa::scanner_keyboard },
-    { "scanner_touchscreen", fa::scanner_touchscreen },
-    { "scarecrow", fa::scarecrow },
-    { "scarf", fa::scarf },
-    { "school", fa::school },
-    { "school_circle_check", fa::school_circle_check },
-    { "school_circle_exclamation", fa::school_circle_exclamation },
-    { "school_circle_xmark", fa::school_circle_xmark },
-    { "school_flag", fa::school_flag },
-    { "school_lock", fa::school_lock },
-    { "scissors", fa::scissors },
-    { "cut", fa::scissors },
-    { "screen_users", fa::screen_users },
-    { "users_class", fa::screen_users },
-    { "screencast", fa::screencast },
-    { "screwdriver", fa::screwdriver },
-    { "screwdriver_wrench", fa::screwdriver_wrench },
-    { "tools", fa::screwdriver_wrench },
-    { "scribble", fa::scribble },
-    { "scroll", fa::scroll },
-    { "scroll_old", fa::scroll_old },
-    { "scroll_torah", fa::scroll_torah },
-    { "torah", fa::scroll_torah },
-    { "scrubber", fa::scrubber },
-    { "scythe", fa::scythe },
-    { "sd_card", fa::sd_card },
-    { "sd_cards", fa::sd_cards },
-    { "seal", fa::seal },
-    { "seal_exclamation", fa::seal_exclamation },
-    { "seal_question", fa::seal_question },
-    { "seat_airline", fa::seat_airline },
-    { "section", fa::section },
-    { "seedling", fa::seedling },
-    { "sprout", fa::seedling },
-    { "semicolon", fa::semicolon },
-    { "send_back", fa::send_back },
-    { "send_backward", fa::send_backward },
-    { "sensor", fa::sensor },
-    { "sensor_cloud", fa::sensor_cloud },
-    { "sensor_smoke", fa::sensor_cloud },
-    { "sensor_fire", fa::sensor_fire },
-    { "sensor_on", fa::sensor_on },
-    { "sensor_triangle_exclamation", fa::sensor_triangle_exclamation },
-    { "sensor_alert", fa::sensor_triangle_exclamation },
-    { "server", fa::server },
-    { "shapes", fa::shapes },
-    { "triangle_circle_square", fa::shapes },
-    { "share", fa::share },
-    { "arrow_turn_right", fa::share },
-    { "mail_forward", fa::share },
-    { "share_all", fa::share_all },
-    { "share_from_square", fa::share_from_square },
-    { "share_square", fa::share_from_square },
-    { "share_nodes", fa::share_nodes },
-    { "share_alt", fa::share_nodes },
-    { "sheep", fa::sheep },
-    { "sheet_plastic", fa::sheet_plastic },
-    { "shekel_sign", fa::shekel_sign },
-    { "ils", fa::shekel_sign },
-    { "shekel", fa::shekel_sign },
-    { "sheqel", fa::shekel_sign },
-    { "sheqel_sign", fa::shekel_sign },
-    { "shelves", fa::shelves },
-    { "inventory", fa::shelves },
-    { "shelves_empty", fa::shelves_empty },
-    { "shield", fa::shield },
-    { "shield_blank", fa::shield },
-    { "shield_cat", fa::shield_cat },
-    { "shield_check", fa::shield_check },
-    { "shield_cross", fa::shield_cross },
-    { "shield_dog", fa::shield_dog },
-    { "shield_exclamation", fa::shield_exclamation },
-    { "shield_halved", fa::shield_halved },
-    { "shield_alt", fa::shield_halved },
-    { "shield_heart", fa::shield_heart },
-    { "shield_keyhole", fa::shield_keyhole },
-    { "shield_minus", fa::shield_minus },
-    { "shield_plus", fa::shield_plus },
-    { "shield_quartered", fa::shield_quartered },
-    { "shield_slash", fa::shield_slash },
-    { "shield_virus", fa::shield_virus },
-    { "shield_xmark", fa::shield_xmark },
-    { "shield_times", fa::shield_xmark },
-    { "ship", fa::ship },
-    { "shirt", fa::shirt },
-    { "t_shirt", fa::shirt },
-    { "tshirt", fa::shirt },
-    { "shirt_long_sleeve", fa::shirt_long_sleeve },
-    { "shirt_running", fa::shirt_running },
-    { "shirt_tank_top", fa::shirt_tank_top },
-    { "shish_kebab", fa::shish_kebab },
-    { "shoe_prints", fa::shoe_prints },
-    { "shop", fa::shop },
-    { "store_alt", fa::shop },
-    { "shop_lock", fa::shop_lock },
-    { "shop_slash", fa::shop_slash },
-    { "store_alt_slash", fa::shop_slash },
-    { "shovel", fa::shovel },
-    { "shovel_snow", fa::shovel_snow },
-    { "shower", fa::shower },
-    { "shower_down", fa::shower_down },
-    { "shower_alt", fa::shower_down },
-    { "shredder", fa::shredder },
-    { "shrimp", fa::shrimp },
-    { "shuffle", fa::shuffle },
-    { "random", fa::shuffle },
-    { "shutters", fa::shutters },
-    { "shuttle_space", fa::shuttle_space },
-    { "space_shuttle", fa::shuttle_space },
-    { "shuttlecock", fa::shuttlecock },
-    { "sickle", fa::sickle },
-    { "sidebar", fa::sidebar },
-    { "sidebar_flip", fa::sidebar_flip },
-    { "sigma", fa::sigma },
-    { "sign_hanging", fa::sign_hanging },
-    { "sign", fa::sign_hanging },
-    { "signal", fa::signal },
-    { "signal_5", fa::signal },
-    { "signal_perfect", fa::signal },
-    { "signal_bars", fa::signal_bars },
-    { "signal_alt", fa::signal_bars },
-    { "signal_alt_4", fa::signal_bars },
-    { "signal_bars_strong", fa::signal_bars },
-    { "signal_bars_fair", fa::signal_bars_fair },
-    { "signal_alt_2", fa::signal_bars_fair },
-    { "signal_bars_good", fa::signal_bars_good },
-    { "signal_alt_3", fa::signal_bars_good },
-    { "signal_bars_slash", fa::signal_bars_slash },
-    { "signal_alt_slash", fa::signal_bars_slash },
-    { "signal_bars_weak", fa::signal_bars_weak },
-    { "signal_alt_1", fa::signal_bars_weak },
-    { "signal_fair", fa::signal_fair },
-    { "signal_2", fa::signal_fair },
-    { "signal_good", fa::signal_good },
-    { "signal_3", fa::signal_good },
-    { "signal_slash", fa::signal_slash },
-    { "signal_stream", fa::signal_stream },
-    { "signal_stream_slash", fa::signal_stream_slash },
-    { "signal_strong", fa::signal_strong },
-    { "signal_4", fa::signal_strong },
-    { "signal_weak", fa::signal_weak },
-    { "signal_1", fa::signal_weak },
-    { "signature", fa::signature },
-    { "signature_lock", fa::signature_lock },
-    { "signature_slash", fa::signature_slash },
-    { "signs_post", fa::signs_post },
-    { "map_signs", fa::signs_post },
-    { "sim_card", fa::sim_card },
-    { "sim_cards", fa::sim_cards },
-    { "sink", fa::sink },
-    { "siren", fa::siren },
-    { "siren_on", fa::siren_on },
-    { "sitemap", fa::sitemap },
-    { "skeleton", fa::skeleton },
-    { "ski_boot", fa::ski_boot },
-    { "ski_boot_ski", fa::ski_boot_ski },
-    { "skull", fa::skull },
-    { "skull_cow", fa::skull_cow },
-    { "skull_crossbones", fa::skull_crossbones },
-    { "slash", fa::slash },
-    { "slash_back", fa::slash_back },
-    { "slash_forward", fa::slash_forward },
-    { "sleigh", fa::sleigh },
-    { "slider", fa::slider },
-    { "sliders", fa::sliders },
-    { "sliders_h", fa::sliders },
-    { "sliders_simple", fa::sliders_simple },
-    { "sliders_up", fa::sliders_up },
-    { "sliders_v", fa::sliders_up },
-    { "slot_machine", fa::slot_machine },
-    { "smog", fa::smog },
-    { "smoke", fa::smoke },
-    { "smoking", fa::smoking },
-    { "snake", fa::snake },
-    { "snooze", fa::snooze },
-    { "zzz", fa::snooze },
-    { "snow_blowing", fa::snow_blowing },
-    { "snowflake", fa::snowflake },
-    { "snowflakes", fa::snowflakes },
-    { "snowman", fa::snowman },
-    { "snowman_head", fa::snowman_head },
-    { "frosty_head", fa::snowman_head },
-    { "snowplow", fa::snowplow },
-    { "soap", fa::soap },
-    { "socks", fa::socks },
-    { "soft_serve", fa::soft_serve },
-    { "creemee", fa::soft_serve },
-    { "solar_panel", fa::solar_panel },
-    { "solar_system", fa::solar_system },
-    { "sort", fa::sort },
-    { "unsorted", fa::sort },
-    { "sort_down", fa::sort_down },
-    { "sort_desc", fa::sort_down },
-    { "sort_up", fa::sort_up },
-    { "sort_asc", fa::sort_up },
-    { "spa", fa::spa },
-    { "space_station_moon", fa::space_station_moon },
-    { "space_station_moon_construction", fa::space_station_moon_construction },
-    { "space_station_moon_alt", fa::space_station_moon_construction },
-    { "spade", fa::spade },
-    { "spaghetti_monster_flying", fa::spaghetti_monster_flying },
-    { "pastafarianism", fa::spaghetti_monster_flying },
-    { "sparkles", fa::sparkles },
-    { "speaker", fa::speaker },
-    { "speakers", fa::speakers },
-    { "spell_check", fa::spell_check },
-    { "spider", fa::spider },
-    { "spider_black_widow", fa::spider_black_widow },
-    { "spider_web", fa::spider_web },
-    { "spinner", fa::spinner },
-    { "spinner_third", fa::spinner_third },
-    { "split", fa::split },
-    { "splotch", fa::splotch },
-    { "spoon", fa::spoon },
-    { "utensil_spoon", fa::spoon },
-    { "sportsball", fa::sportsball },
-    { "spray_can", fa::spray_can },
-    { "spray_can_sparkles", fa::spray_can_sparkles },
-    { "air_freshener", fa::spray_can_sparkles },
-    { "sprinkler", fa::sprinkler },
-    { "sprinkler_ceiling", fa::sprinkler_ceiling },
-    { "square", fa::square },
-    { "square_0", fa::square_0 },
-    { "square_1", fa::square_1 },
-    { "square_2", fa::square_2 },
-    { "square_3", fa::square_3 },
-    { "square_4", fa::square_4 },
-    { "square_5", fa::square_5 },
-    { "square_6", fa::square_6 },
-    { "square_7", fa::square_7 },
-    { "square_8", fa::square_8 },
-    { "square_9", fa::square_9 },
-    { "square_a", fa::square_a },
-    { "square_a_lock", fa::square_a_lock },
-    { "square_ampersand", fa::square_ampersand },
-    { "square_arrow_down", fa::square_arrow_down },
-    { "arrow_square_down", fa::square_arrow_down },
-    { "square_arrow_down_left", fa::square_arrow_down_left },
-    { "square_arrow_down_right", fa::square_arrow_down_right },
-    { "square_arrow_left", fa::square_arrow_left },
-    { "arrow_square_left", fa::square_arrow_left },
-    { "square_arrow_right", fa::square_arrow_right },
-    { "arrow_square_right", fa::square_arrow_right },
-    { "square_arrow_up", fa::square_arrow_up },
-    { "arrow_square_up", fa::square_arrow_up },
-    { "square_arrow_up_left", fa::square_arrow_up_left },
-    { "square_arrow_up_right", fa::square_arrow_up_right },
-    { "external_link_square", fa::square_arrow_up_right },
-    { "square_b", fa::square_b },
-    { "square_bolt", fa::square_bolt },
-    { "square_c", fa::square_c },
-    { "square_caret_down", fa::square_caret_down },
-    { "caret_square_down", fa::square_caret_down },
-    { "square_caret_left", fa::square_caret_left },
-    { "caret_square_left", fa::square_caret_left },
-    { "square_caret_right", fa::square_caret_right },
-    { "caret_square_right", fa::square_caret_right },
-    { "square_caret_up", fa::square_caret_up },
-    { "caret_square_up", fa::square_caret_up },
-    { "square_check", fa::square_check },
-    { "check_square", fa::square_check },
-    { "square_chevron_down", fa::square_chevron_down },
-    { "chevron_square_down", fa::square_chevron_down },
-    { "square_chevron_left", fa::square_chevron_left },
-    { "chevron_square_left", fa::square_chevron_left },
-    { "square_chevron_right", fa::square_chevron_right },
-    { "chevron_square_right", fa::square_chevron_right },
-    { "square_chevron_up", fa::square_chevron_up },
-    { "chevron_square_up", fa::square_chevron_up },
-    { "square_code", fa::square_code },
-    { "square_d", fa::square_d },
-    { "square_dashed", fa::square_dashed },
-    { "square_divide", fa::square_divide },
-    { "square_dollar", fa::square_dollar },
-    { "dollar_square", fa::square_dollar },
-    { "usd_square", fa::square_dollar },
-    { "square_down", fa::square_down },
-    { "arrow_alt_square_down", fa::square_down },
-    { "square_down_left", fa::square_down_left },
-    { "square_down_right", fa::square_down_right },
-    { "square_e", fa::square_e },
-    { "square_ellipsis", fa::square_ellipsis },
-    { "square_ellipsis_vertical", fa::square_ellipsis_vertical },
-    { "square_envelope", fa::square_envelope },
-    { "envelope_square", fa::square_envelope },
-    { "square_exclamation", fa::square_exclamation },
-    { "exclamation_square", fa::square_exclamation },
-    { "square_f", fa::square_f },
-    { "square_fragile", fa::square_fragile },
-    { "box_fragile", fa::square_fragile },
-    { "square_wine_glass_crack", fa::square_fragile },
-    { "square_full", fa::square_full },
-    { "square_g", fa::square_g },
-    { "square_h", fa::square_h },
-    { "h_square", fa::square_h },
-    { "square_heart", fa::square_heart },
-    { "heart_square", fa::square_heart },
-    { "square_i", fa::square_i },
-    { "square_info", fa::square_info },
-    { "info_square", fa::square_info },
-    { "square_j", fa::square_j },
-    { "square_k", fa::square_k },
-    { "square_kanban", fa::square_kanban },
-    { "square_l", fa::square_l },
-    { "square_left", fa::square_left },
-    { "arrow_alt_square_left", fa::square_left },
-    { "square_list", fa::square_list },
-    { "square_m", fa::square_m },
-    { "square_minus", fa::square_minus },
-    { "minus_square", fa::square_minus },
-    { "square_n", fa::square_n },
-    { "square_nfi", fa::square_nfi },
-    { "square_o", fa::square_o },
-    { "square_p", fa::square_p },
-    { "square_parking", fa::square_parking },
-    { "parking", fa::square_parking },
-    { "square_parking_slash", fa::square_parking_slash },
-    { "parking_slash", fa::square_parking_slash },
-    { "square_pen", fa::square_pen },
-    { "pen_square", fa::square_pen },
-    { "pencil_square", fa::square_pen },
-    { "square_person_confined", fa::square_person_confined },
-    { "square_phone", fa::square_phone },
-    { "phone_square", fa::square_phone },
-    { "square_phone_flip", fa::square_phone_flip },
-    { "phone_square_alt", fa::square_phone_flip },
-    { "square_phone_hangup", fa::square_phone_hangup },
-    { "phone_square_down", fa::square_phone_hangup },
-    { "square_plus", fa::square_plus },
-    { "plus_square", fa::square_plus },
-    { "square_poll_horizontal", fa::square_poll_horizontal },
-    { "poll_h", fa::square_poll_horizontal },
-    { "square_poll_vertical", fa::square_poll_vertical },
-    { "poll", fa::square_poll_vertical },
-    { "square_q", fa::square_q },
-    { "square_quarters", fa::square_quarters },
-    { "square_question", fa::square_question },
-    { "question_square", fa::square_question },
-    { "square_quote", fa::square_quote },
-    { "square_r", fa::square_r },
-    { "square_right", fa::square_right },
-    { "arrow_alt_square_right", fa::square_right },
-    { "square_ring", fa::square_ring },
-    { "square_root", fa::square_root },
-    { "square_rootiable", fa::square_rootiable },
-    { "square_root_alt", fa::square_rootiable },
-    { "square_rss", fa::square_rss },
-    { "rss_square", fa::square_rss },
-    { "square_s", fa::square_s },
-    { "square_share_nodes", fa::square_share_nodes },
-    { "share_alt_square", fa::square_share_nodes },
-    { "square_sliders", fa::square_sliders },
-    { "sliders_h_square", fa::square_sliders },
-    { "square_sliders_vertical", fa::square_sliders_vertical },
-    { "sliders_v_square", fa::square_sliders_vertical },
-    { "square_small", fa::square_small },
-    { "square_star", fa::square_star },
-    { "square_t", fa::square_t },
-    { "square_terminal", fa::square_terminal },
-    { "square_this_way_up", fa::square_this_way_up },
-    { "box_up", fa::square_this_way_up },
-    { "square_u", fa::square_u },
-    { "square_up", fa::square_up },
-    { "arrow_alt_square_up", fa::square_up },
-    { "square_up_left", fa::square_up_left },
-    { "square_up_right", fa::square_up_right },
-    { "external_link_square_alt", fa::square_up_right },
-    { "square_user", fa::square_user },
-    { "square_v", fa::square_v },
-    { "square_virus", fa::square_virus },
-    { "square_w", fa::square_w },
-    { "square_x", fa::square_x },
-    { "square_xmark", fa::square_xmark },
-    { "times_square", fa::square_xmark },
-    { "xmark_square", fa::square_xmark },
-    { "square_y", fa::square_y },
-    { "square_z", fa::square_z },
-    { "squid", fa::squid },
-    { "squirrel", fa::squirrel },
-    { "staff", fa::staff },
-    { "staff_aesculapius", fa::staff_aesculapius },
-    { "rod_asclepius", fa::staff_aesculapius },
-    { "rod_snake", fa::staff_aesculapius },
-    { "staff_snake", fa::staff_aesculapius },
-    { "stairs", fa::stairs },
-    { "stamp", fa::stamp },
-    { "standard_definition", fa::standard_definition },
-    { "rectangle_sd", fa::standard_definition },
-    { "star", fa::star },
-    { "star_and_crescent", fa::star_and_crescent },
-    { "star_christmas", fa::star_christmas },
-    { "star_exclamation", fa::star_exclamation },
-    { "star_half", fa::star_half },
-    { "star_half_stroke", fa::star_half_stroke },
-    { "star_half_alt", fa::star_half_stroke },
-    { "star_of_david", fa::star_of_david },
-    { "star_of_life", fa::star_of_life },
-    { "star_sharp", fa::star_sharp },
-    { "star_sharp_half", fa::star_sharp_half },
-    { "star_sharp_half_stroke", fa::star_sharp_half_stroke },
-    { "star_sharp_half_alt", fa::star_sharp_half_stroke },
-    { "star_shooting", fa::star_shooting },
-    { "starfighter", fa::starfighter },
-    { "starfighter_twin_ion_engine", fa::starfighter_twin_ion_engine },
-    { "starfighter_alt", fa::starfighter_twin_ion_engine },
-    { "starfighter_twin_ion_engine_advanced", fa::starfighter_twin_ion_engine_advanced },
-    { "starfighter_alt_advanced", fa::starfighter_twin_ion_engine_advanced },
-    { "stars", fa::stars },
-    { "starship", fa::starship },
-    { "starship_freighter", fa::starship_freighter },
-    { "steak", fa::steak },
-    { "steering_wheel", fa::steering_wheel },
-    { "sterling_sign", fa::sterling_sign },
-    { "gbp", fa::sterling_sign },
-    { "pound_sign", fa::sterling_sign },
-    { "stethoscope", fa::stethoscope },
-    { "stocking", fa::stocking },
-    { "stomach", fa::stomach },
-    { "stop", fa::stop },
-    { "stopwatch", fa::stopwatch },
-    { "stopwatch_20", fa::stopwatch_20 },
-    { "store", fa::store },
-    { "store_lock", fa::store_lock },
-    { "store_slash", fa::store_slash },
-    { "strawberry", fa::strawberry },
-    { "street_view", fa::street_view },
-    { "stretcher", fa::stretcher },
-    { "strikethrough", fa::strikethrough },
-    { "stroopwafel", fa::stroopwafel },
-    { "subscript", fa::subscript },
-    { "suitcase", fa::suitcase },
-    { "suitcase_medical", fa::suitcase_medical },
-    { "medkit", fa::suitcase_medical },
-    { "suitcase_rolling", fa::suitcase_rolling },
-    { "sun", fa::sun },
-    { "sun_bright", fa::sun_bright },
-    { "sun_alt", fa::sun_bright },
-    { "sun_cloud", fa::sun_cloud },
-    { "sun_dust", fa::sun_dust },
-    { "sun_haze", fa::sun_haze },
-    { "sun_plant_wilt", fa::sun_plant_wilt },
-    { "sunglasses", fa::sunglasses },
-    { "sunrise", fa::sunrise },
-    { "sunset", fa::sunset },
-    { "superscript", fa::superscript },
-    { "sushi", fa::sushi },
-    { "nigiri", fa::sushi },
-    { "sushi_roll", fa::sushi_roll },
-    { "maki_roll", fa::sushi_roll },
-    { "makizushi", fa::sushi_roll },
-    { "swatchbook", fa::swatchbook },
-    { "sword", fa::sword },
-    { "sword_laser", fa::sword_laser },
-    { "sword_laser_alt", fa::sword_laser_alt },
-    { "swords", fa::swords },
-    { "swords_laser", fa::swords_laser },
-    { "symbols", fa::symbols },
-    { "icons_alt", fa::symbols },
-    { "synagogue", fa::synagogue },
-    { "syringe", fa::syringe },
-    { "t", fa::t },
-    { "table", fa::table },
-    { "table_cells", fa::table_cells },
-    { "th", fa::table_cells },
-    { "table_cells_large", fa::table_cells_large },
-    { "th_large", fa::table_cells_large },
-    { "table_columns", fa::table_columns },
-    { "columns", fa::table_columns },
-    { "table_layout", fa::table_layout },
-    { "table_list", fa::table_list },
-    { "th_list", fa::table_list },
-    { "table_picnic", fa::table_picnic },
-    { "table_pivot", fa::table_pivot },
-    { "table_rows", fa::table_rows },
-    { "rows", fa::table_rows },
-    { "table_tennis_paddle_ball", fa::table_tennis_paddle_ball },
-    { "ping_pong_paddle_ball", fa::table_tennis_paddle_ball },
-    { "table_tennis", fa::table_tennis_paddle_ball },
-    { "table_tree", fa::table_tree },
-    { "tablet", fa::tablet },
-    { "tablet_android", fa::tablet },
-    { "tablet_button", fa::tablet_button },
-    { "tablet_rugged", fa::tablet_rugged },
-    { "tablet_screen", fa::tablet_screen },
-    { "tablet_android_alt", fa::tablet_screen },
-    { "tablet_screen_button", fa::tablet_screen_button },
-    { "tablet_alt", fa::tablet_screen_button },
-    { "tablets", fa::tablets },
-    { "tachograph_digital", fa::tachograph_digital },
-    { "digital_tachograph", fa::tachograph_digital },
-    { "taco", fa::taco },
-    { "tag", fa::tag },
-    { "tags", fa::tags },
-    { "tally", fa::tally },
-    { "tally_5", fa::tally },
-    { "tally_1", fa::tally_1 },
-    { "tally_2", fa::tally_2 },
-    { "tally_3", fa::tally_3 },
-    { "tally_4", fa::tally_4 },
-    { "tamale", fa::tamale },
-    { "tank_water", fa::tank_water },
-    { "tape", fa::tape },
-    { "tarp", fa::tarp },
-    { "tarp_droplet", fa::tarp_droplet },
-    { "taxi", fa::taxi },
-    { "cab", fa::taxi },
-    { "taxi_bus", fa::taxi_bus },
-    { "teddy_bear", fa::teddy_bear },
-    { "teeth", fa::teeth },
-    { "teeth_open", fa::teeth_open },
-    { "telescope", fa::telescope },
-    { "temperature_arrow_down", fa::temperature_arrow_down },
-    { "temperature_down", fa::temperature_arrow_down },
-    { "temperature_arrow_up", fa::temperature_arrow_up },
-    { "temperature_up", fa::temperature_arrow_up },
-    { "temperature_empty", fa::temperature_empty },
-    { "temperature_0", fa::temperature_empty },
-    { "thermometer_0", fa::temperature_empty },
-    { "thermometer_empty", fa::temperature_empty },
-    { "temperature_full", fa::temperature_full },
-    { "temperature_4", fa::temperature_full },
-    { "thermometer_4", fa::temperature_full },
-    { "thermometer_full", fa::temperature_full },
-    { "temperature_half", fa::temperature_half },
-    { "temperature_2", fa::temperature_half },
-    { "thermometer_2", fa::temperature_half },
-    { "thermometer_half", fa::temperature_half },
-    { "temperature_high", fa::temperature_high },
-    { "temperature_list", fa::temperature_list },
-    { "temperature_low", fa::temperature_low },
-    { "temperature_quarter", fa::temperature_quarter },
-    { "temperature_1", fa::temperature_quarter },
-    { "thermometer_1", fa::temperature_quarter },
-    { "thermometer_quarter", fa::temperature_quarter },
-    { "temperature_snow", fa::temperature_snow },
-    { "temperature_frigid", fa::temperature_snow },
-    { "temperature_sun", fa::temperature_sun },
-    { "temperature_hot", fa::temperature_sun },
-    { "temperature_three_quarters", fa::temperature_three_quarters },
-    { "temperature_3", fa::temperature_three_quarters },
-    { "thermometer_3", fa::temperature_three_quarters },
-    { "thermometer_three_quarters", fa::temperature_three_quarters },
-    { "tenge_sign", fa::tenge_sign },
-    { "tenge", fa::tenge_sign },
-    { "tennis_ball", fa::tennis_ball },
-    { "tent", fa::tent },
-    { "tent_arrow_down_to_line", fa::tent_arrow_down_to_line },
-    { "tent_arrow_left_right", fa::tent_arrow_left_right },
-    { "tent_arrow_turn_left", fa::tent_arrow_turn_left },
-    { "tent_arrows_down", fa::tent_arrows_down },
-    { "tents", fa::tents },
-    { "terminal", fa::terminal },
-    { "text", fa::text },
-    { "text_height", fa::text_height },
-    { "text_size", fa::text_size },
-    { "text_slash", fa::text_slash },
-    { "remove_format", fa::text_slash },
-    { "text_width", fa::text_width },
-    { "thermometer", fa::thermometer },
-    { "theta", fa::theta },
-    { "thought_bubble", fa::thought_bubble },
-    { "thumbs_down", fa::thumbs_down },
-    { "thumbs_up", fa::thumbs_up },
-    { "thumbtack", fa::thumbtack },
-    { "thumb_tack", fa::thumbtack },
-    { "tick", fa::tick },
-    { "ticket", fa::ticket },
-    { "ticket_airline", fa::ticket_airline },
-    { "ticket_simple", fa::ticket_simple },
-    { "ticket_alt", fa::ticket_simple },
-    { "tickets_airline", fa::tickets_airline },
-    { "tilde", fa::tilde },
-    { "timeline", fa::timeline },
-    { "timeline_arrow", fa::timeline_arrow },
-    { "timer", fa::timer },
-    { "tire", fa::tire },
-    { "tire_flat", fa::tire_flat },
-    { "tire_pressure_warning", fa::tire_pressure_warning },
-    { "tire_rugged", fa::tire_rugged },
-    { "toggle_off", fa::toggle_off },
-    { "toggle_on", fa::toggle_on },
-    { "toilet", fa::toilet },
-    { "toilet_paper", fa::toilet_paper },
-    { "toilet_paper_blank", fa::toilet_paper_blank },
-    { "toilet_paper_alt", fa::toilet_paper_blank },
-    { "toilet_paper_blank_under", fa::toilet_paper_blank_under },
-    { "toilet_paper_reverse_alt", fa::toilet_paper_blank_under },
-    { "toilet_paper_slash", fa::toilet_paper_slash },
-    { "toilet_paper_under", fa::toilet_paper_under },
-    { "toilet_paper_reverse", fa::toilet_paper_under },
-    { "toilet_paper_under_slash", fa::toilet_paper_under_slash },
-    { "toilet_paper_reverse_slash", fa::toilet_paper_under_slash },
-    { "toilet_portable", fa::toilet_portable },
-    { "toilets_portable", fa::toilets_portable },
-    { "tomato", fa::tomato },
-    { "tombstone", fa::tombstone },
-    { "tombstone_blank", fa::tombstone_blank },
-    { "tombstone_alt", fa::tombstone_blank },
-    { "toolbox", fa::toolbox },
-    { "tooth", fa::tooth },
-    { "toothbrush", fa::toothbrush },
-    { "torii_gate", fa::torii_gate },
-    { "tornado", fa::tornado },
-    { "tower_broadcast", fa::tower_broadcast },
-    { "broadcast_tower", fa::tower_broadcast },
-    { "tower_cell", fa::tower_cell },
-    { "tower_control", fa::tower_control },
-    { "tower_observation", fa::tower_observation },
-    { "tractor", fa::tractor },
-    { "trademark", fa::trademark },
-    { "traffic_cone", fa::traffic_cone },
-    { "traffic_light", fa::traffic_light },
-    { "traffic_light_go", fa::traffic_light_go },
-    { "traffic_light_slow", fa::traffic_light_slow },
-    { "traffic_light_stop", fa::traffic_light_stop },
-    { "trailer", fa::trailer },
-    { "train", fa::train },
-    { "train_subway", fa::train_subway },
-    { "subway", fa::train_subway },
-    { "train_subway_tunnel", fa::train_subway_tunnel },
-    { "subway_tunnel", fa::train_subway_tunnel },
-    { "train_track", fa::train_track },
-    { "train_tram", fa::train_tram },
-    { "tram", fa::train_tram },
-    { "train_tunnel", fa::train_tunnel },
-    { "transformer_bolt", fa::transformer_bolt },
-    { "transgender", fa::transgender },
-    { "transgender_alt", fa::transgender },
-    { "transporter", fa::transporter },
-    { "transporter_1", fa::transporter_1 },
-    { "transporter_2", fa::transporter_2 },
-    { "transporter_3", fa::transporter_3 },
-    { "transporter_4", fa::transporter_4 },
-    { "transporter_5", fa::transporter_5 },
-    { "transporter_6", fa::transporter_6 },
-    { "transporter_7", fa::transporter_7 },
-    { "transporter_empty", fa::transporter_empty },
-    { "trash", fa::trash },
-    { "trash_arrow_up", fa::trash_arrow_up },
-    { "trash_restore", fa::trash_arrow_up },
-    { "trash_can", fa::trash_can },
-    { "trash_alt", fa::trash_can },
-    { "trash_can_arrow_up", fa::trash_can_arrow_up },
-    { "trash_restore_alt", fa::trash_can_arrow_up },
-    { "trash_can_check", fa::trash_can_check },
-    { "trash_can_clock", fa::trash_can_clock },
-    { "trash_can_list", fa::trash_can_list },
-    { "trash_can_plus", fa::trash_can_plus },
-    { "trash_can_slash", fa::trash_can_slash },
-    { "trash_alt_slash", fa::trash_can_slash },
-    { "trash_can_undo", fa::trash_can_undo },
-    { "trash_can_arrow_turn_left", fa::trash_can_undo },
-    { "trash_undo_alt", fa::trash_can_undo },
-    { "trash_can_xmark", fa::trash_can_xmark },
-    { "trash_check", fa::trash_check },
-    { "trash_clock", fa::trash_clock },
-    { "trash_list", fa::trash_list },
-    { "trash_plus", fa::trash_plus },
-    { "trash_slash", fa::trash_slash },
-    { "trash_undo", fa::trash_undo },
-    { "trash_arrow_turn_left", fa::trash_undo },
-    { "trash_xmark", fa::trash_xmark },
-    { "treasure_chest", fa::treasure_chest },
-    { "tree", fa::tree },
-    { "tree_christmas", fa::tree_christmas },
-    { "tree_city", fa::tree_city },
-    { "tree_deciduous", fa::tree_deciduous },
-    { "tree_alt", fa::tree_deciduous },
-    { "tree_decorated", fa::tree_decorated },
-    { "tree_large", fa::tree_large },
-    { "tree_palm", fa::tree_palm },
-    { "trees", fa::trees },
-    { "triangle", fa::triangle },
-    { "triangle_exclamation", fa::triangle_exclamation },
-    { "exclamation_triangle", fa::triangle_exclamation },
-    { "warning", fa::triangle_exclamation },
-    { "triangle_instrument", fa::triangle_instrument },
-    { "triangle_music", fa::triangle_instrument },
-    { "triangle_person_digging", fa::triangle_person_digging },
-    { "construction", fa::triangle_person_digging },
-    { "trillium", fa::trillium },
-    { "trophy", fa::trophy },
-    { "trophy_star", fa::trophy_star },
-    { "trophy_alt", fa::trophy_star },
-    { "trowel", fa::trowel },
-    { "trowel_bricks", fa::trowel_bricks },
-    { "truck", fa::truck },
-    { "truck_arrow_right", fa::truck_arrow_right },
-    { "truck_bolt", fa::truck_bolt },
-    { "truck_clock", fa::truck_clock },
-    { "shipping_timed", fa::truck_clock },
-    { "truck_container", fa::truck_container },
-    { "truck_container_empty", fa::truck_container_empty },
-    { "truck_droplet", fa::truck_droplet },
-    { "truck_fast", fa::truck_fast },
-    { "shipping_fast", fa::truck_fast },
-    { "truck_field", fa::truck_field },
-    { "truck_field_un", fa::truck_field_un },
-    { "truck_flatbed", fa::truck_flatbed },
-    { "truck_front", fa::truck_front },
-    { "truck_medical", fa::truck_medical },
-    { "ambulance", fa::truck_medical },
-    { "truck_monster", fa::truck_monster },
-    { "truck_moving", fa::truck_moving },
-    { "truck_pickup", fa::truck_pickup },
-    { "truck_plane", fa::truck_plane },
-    { "truck_plow", fa::truck_plow },
-    { "truck_ramp", fa::truck_ramp },
-    { "truck_ramp_box", fa::truck_ramp_box },
-    { "truck_loading", fa::truck_ramp_box },
-    { "truck_ramp_couch", fa::truck_ramp_couch },
-    { "truck_couch", fa::truck_ramp_couch },
-    { "truck_tow", fa::truck_tow },
-    { "trumpet", fa::trumpet },
-    { "tty", fa::tty },
-    { "teletype", fa::tty },
-    { "tty_answer", fa::tty_answer },
-    { "teletype_answer", fa::tty_answer },
-    { "tugrik_sign", fa::tugrik_sign },
-    { "turkey", fa::turkey },
-    { "turkish_lira_sign", fa::turkish_lira_sign },
-    { "fa_try", fa::turkish_lira_sign },
-    { "turkish_lira", fa::turkish_lira_sign },
-    { "turn_down", fa::turn_down },
-    { "level_down_alt", fa::turn_down },
-    { "turn_down_left", fa::turn_down_left },
-    { "turn_down_right", fa::turn_down_right },
-    { "turn_up", fa::turn_up },
-    { "level_up_alt", fa::turn_up },
-    { "turntable", fa::turntable },
-    { "turtle", fa::turtle },
-    { "tv", fa::tv },
-    { "television", fa::tv },
-    { "tv_alt", fa::tv },
-    { "tv_music", fa::tv_music },
-    { "tv_retro", fa::tv_retro },
-    { "typewriter", fa::typewriter },
-    { "u", fa::u },
-    { "ufo", fa::ufo },
-    { "ufo_beam", fa::ufo_beam },
-    { "umbrella", fa::umbrella },
-    { "umbrella_beach", fa::umbrella_beach },
-    { "umbrella_simple", fa::umbrella_simple },
-    { "umbrella_alt", fa::umbrella_simple },
-    { "underline", fa::underline },
-    { "unicorn", fa::unicorn },
-    { "uniform_martial_arts", fa::uniform_martial_arts },
-    { "_union", fa::_union },
-    { "universal_access", fa::universal_access },
-    { "unlock", fa::unlock },
-    { "unlock_keyhole", fa::unlock_keyhole },
-    { "unlock_alt", fa::unlock_keyhole },
-    { "up", fa::up },
-    { "arrow_alt_up", fa::up },
-    { "up_down", fa::up_down },
-    { "arrows_alt_v", fa::up_down },
-    { "up_down_left_right", fa::up_down_left_right },
-    { "arrows_alt", fa::up_down_left_right },
-    { "up_from_bracket", fa::up_from_bracket },
-    { "up_from_dotted_line", fa::up_from_dotted_line },
-    { "up_from_line", fa::up_from_line },
-    { "arrow_alt_from_bottom", fa::up_from_line },
-    { "up_left", fa::up_left },
-    { "up_long", fa::up_long },
-    { "long_arrow_alt_up", fa::up_long },
-    { "up_right", fa::up_right },
-    { "up_right_and_down_left_from_center", fa::up_right_and_down_left_from_center },
-    { "expand_alt", fa::up_right_and_down_left_from_center },
-    { "up_right_from_square", fa::up_right_from_square },
-    { "external_link_alt", fa::up_right_from_square },
-    { "up_to_dotted_line", fa::up_to_dotted_line },
-    { "up_to_line", fa::up_to_line },
-    { "arrow_alt_to_top", fa::up_to_line },
-    { "upload", fa::upload },
-    { "usb_drive", fa::usb_drive },
-    { "user", fa::user },
-    { "user_alien", fa::user_alien },
-    { "user_astronaut", fa::user_astronaut },
-    { "user_bounty_hunter", fa::user_bounty_hunter },
-    { "user_check", fa::user_check },
-    { "user_chef", fa::user_chef },
-    { "user_clock", fa::user_clock },
-    { "user_cowboy", fa::user_cowboy },
-    { "user_crown", fa::user_crown },
-    { "user_doctor", fa::user_doctor },
-    { "user_md", fa::user_doctor },
-    { "user_doctor_hair", fa::user_doctor_hair },
-    { "user_doctor_hair_long", fa::user_doctor_hair_long },
-    { "user_doctor_message", fa::user_doctor_message },
-    { "user_md_chat", fa::user_doctor_message },
-    { "user_gear", fa::user_gear },
-    { "user_cog", fa::user_gear },
-    { "user_graduate", fa::user_graduate },
-    { "user_group", fa::user_group },
-    { "user_friends", fa::user_group },
-    { "user_group_crown", fa::user_group_crown },
-    { "users_crown", fa::user_group_crown },
-    { "user_hair", fa::user_hair },
-    { "user_hair_buns", fa::user_hair_buns },
-    { "user_hair_long", fa::user_hair_long },
-    { "user_hair_mullet", fa::user_hair_mullet },
-    { "business_front", fa::user_hair_mullet },
-    { "party_back", fa::user_hair_mullet },
-    { "trian_balbot", fa::user_hair_mullet },
-    { "user_headset", fa::user_headset },
-    { "user_helmet_safety", fa::user_helmet_safety },
-    { "user_construction", fa::user_helmet_safety },
-    { "user_hard_hat", fa::user_helmet_safety },
-    { "user_injured", fa::user_injured },
-    { "user_large", fa::user_large },
-    { "user_alt", fa::user_large },
-    { "user_large_slash", fa::user_large_slash },
-    { "user_alt_slash", fa::user_large_slash },
-    { "user_lock", fa::user_lock },
-    { "user_minus", fa::user_minus },
-    { "user_music", fa::user_music },
-    { "user_ninja", fa::user_ninja },
-    { "user_nurse", fa::user_nurse },
-    { "user_nurse_hair", fa::user_nurse_hair },
-    { "user_nurse_hair_long", fa::user_nurse_hair_long },
-    { "user_pen", fa::user_pen },
-    { "user_edit", fa::user_pen },
-    { "user_pilot", fa::user_pilot },
-    { "user_pilot_tie", fa::user_pilot_tie },
-    { "user_plus", fa::user_plus },
-    { "user_police", fa::user_police },
-    { "user_police_tie", fa::user_police_tie },
-    { "user_robot", fa::user_robot },
-    { "user_robot_xmarks", fa::user_robot_xmarks },
-    { "user_secret", fa::user_secret },
-    { "user_shakespeare", fa::user_shakespeare },
-    { "user_shield", fa::user_shield },
-    { "user_slash", fa::user_slash },
-    { "user_tag", fa::user_tag },
-    { "user_tie", fa::user_tie },
-    { "user_tie_hair", fa::user_tie_hair },
-    { "user_tie_hair_long", fa::user_tie_hair_long },
-    { "user_unlock", fa::user_unlock },
-    { "user_visor", fa::user_visor },
-    { "user_vneck", fa::user_vneck },
-    { "user_vneck_hair", fa::user_vneck_hair },
-    { "user_vneck_hair_long", fa::user_vneck_hair_long },
-    { "user_xmark", fa::user_xmark },
-    { "user_times", fa::user_xmark },
-    { "users", fa::users },
-    { "users_between_lines", fa::users_between_lines },
-    { "users_gear", fa::users_gear },
-    { "users_cog", fa::users_gear },
-    { "users_line", fa::users_line },
-    { "users_medical", fa::users_medical },
-    { "users_rays", fa::users_rays },
-    { "users_rectangle", fa::users_rectangle },
-    { "users_slash", fa::users_slash },
-    { "users_viewfinder", fa::users_viewfinder },
-    { "utensils", fa::utensils },
-    { "cutlery", fa::utensils },
-    { "utensils_slash", fa::utensils_slash },
-    { "utility_pole", fa::utility_pole },
-    { "utility_pole_double", fa::utility_pole_double },
-    { "v", fa::v },
-    { "vacuum", fa::vacuum },
-    { "vacuum_robot", fa::vacuum_robot },
-    { "value_absolute", fa::value_absolute },
-    { "van_shuttle", fa::van_shuttle },
-    { "shuttle_van", fa::van_shuttle },
-    { "vault", fa::vault },
-    { "vector_circle", fa::vector_circle },
-    { "vector_polygon", fa::vector_polygon },
-    { "vector_square", fa::vector_square },
-    { "vent_damper", fa::vent_damper },
-    { "venus", fa::venus },
-    { "venus_double", fa::venus_double },
-    { "venus_mars", fa::venus_mars },
-    { "vest", fa::vest },
-    { "vest_patches", fa::vest_patches },
-    { "vial", fa::vial },
-    { "vial_circle_check", fa::vial_circle_check },
-    { "vial_virus", fa::vial_virus },
-    { "vials", fa::vials },
-    { "video", fa::video },
-    { "video_camera", fa::video },
-    { "video_arrow_down_left", fa::video_arrow_down_left },
-    { "video_arrow_up_right", fa::video_arrow_up_right },
-    { "video_plus", fa::video_plus },
-    { "video_slash", fa::video_slash },
-    { "vihara", fa::vihara },
-    { "violin", fa::violin },
-    { "virus", fa::virus },
-    { "virus_covid", fa::virus_covid },
-    { "virus_covid_slash", fa::virus_covid_slash },
-    { "virus_slash", fa::virus_slash },
-    { "viruses", fa::viruses },
-    { "voicemail", fa::voicemail },
-    { "volcano", fa::volcano },
-    { "volleyball", fa::volleyball },
-    { "volleyball_ball", fa::volleyball },
-    { "volume", fa::volume },
-    { "volume_medium", fa::volume },
-    { "volume_high", fa::volume_high },
-    { "volume_up", fa::volume_high },
-    { "volume_low", fa::volume_low },
-    { "volume_down", fa::volume_low },
-    { "volume_off", fa::volume_off },
-    { "volume_slash", fa::volume_slash },
-    { "volume_xmark", fa::volume_xmark },
-    { "volume_mute", fa::volume_xmark },
-    { "volume_times", fa::volume_xmark },
-    { "vr_cardboard", fa::vr_cardboard },
-    { "w", fa::w },
-    { "waffle", fa::waffle },
-    { "wagon_covered", fa::wagon_covered },
-    { "walker", fa::walker },
-    { "walkie_talkie", fa::walkie_talkie },
-    { "wallet", fa::wallet },
-    { "wand", fa::wand },
-    { "wand_magic", fa::wand_magic },
-    { "magic", fa::wand_magic },
-    { "wand_magic_sparkles", fa::wand_magic_sparkles },
-    { "magic_wand_sparkles", fa::wand_magic_sparkles },
-    { "wand_sparkles", fa::wand_sparkles },
-    { "warehouse", fa::warehouse },
-    { "warehouse_full", fa::warehouse_full },
-    { "warehouse_alt", fa::warehouse_full },
-    { "washing_machine", fa::washing_machine },
-    { "washer", fa::washing_machine },
-    { "watch", fa::watch },
-    { "watch_apple", fa::watch_apple },
-    { "watch_calculator", fa::watch_calculator },
-    { "watch_fitness", fa::watch_fitness },
-    { "watch_smart", fa::watch_smart },
-    { "water", fa::water },
-    { "water_arrow_down", fa::water_arrow_down },
-    { "water_lower", fa::water_arrow_down },
-    { "water_arrow_up", fa::water_arrow_up },
-    { "water_rise", fa::water_arrow_up },
-    { "water_ladder", fa::water_ladder },
-    { "ladder_water", fa::water_ladder },
-    { "swimming_pool", fa::water_ladder },
-    { "watermelon_slice", fa::watermelon_slice },
-    { "wave_pulse", fa::wave_pulse },
-    { "heart_rate", fa::wave_pulse },
-    { "wave_sine", fa::wave_sine },
-    { "wave_square", fa::wave_square },
-    { "wave_triangle", fa::wave_triangle },
-    { "waveform", fa::waveform },
-    { "waveform_lines", fa::waveform_lines },
-    { "waveform_path", fa::waveform_lines },
-    { "weight_hanging", fa::weight_hanging },
-    { "weight_scale", fa::weight_scale },
-    { "weight", fa::weight_scale },
-    { "whale", fa::whale },
-    { "wheat", fa::wheat },
-    { "wheat_awn", fa::wheat_awn },
-    { "wheat_alt", fa::wheat_awn },
-    { "wheat_awn_circle_exclamation", fa::wheat_awn_circle_exclamation },
-    { "wheat_awn_slash", fa::wheat_awn_slash },
-    { "wheat_slash", fa::wheat_slash },
-    { "wheelchair", fa::wheelchair },
-    { "wheelchair_move", fa::wheelchair_move },
-    { "wheelchair_alt", fa::wheelchair_move },
-    { "whiskey_glass", fa::whiskey_glass },
-    { "glass_whiskey", fa::whiskey_glass },
-    { "whiskey_glass_ice", fa::whiskey_glass_ice },
-    { "glass_whiskey_rocks", fa::whiskey_glass_ice },
-    { "whistle", fa::whistle },
-    { "wifi", fa::wifi },
-    { "wifi_3", fa::wifi },
-    { "wifi_strong", fa::wifi },
-    { "wifi_exclamation", fa::wifi_exclamation },
-    { "wifi_fair", fa::wifi_fair },
-    { "wifi_2", fa::wifi_fair },
-    { "wifi_slash", fa::wifi_slash },
-    { "wifi_weak", fa::wifi_weak },
-    { "wifi_1", fa::wifi_weak },
-    { "wind", fa::wind },
-    { "wind_turbine", fa::wind_turbine },
-    { "wind_warning", fa::wind_warning },
-    { "wind_circle_exclamation", fa::wind_warning },
-    { "window", fa::window },
-    { "window_flip", fa::window_flip },
-    { "window_alt", fa::window_flip },
-    { "window_frame", fa::window_frame },
-    { "window_frame_open", fa::window_frame_open },
-    { "window_maximize", fa::window_maximize },
-    { "window_minimize", fa::window_minimize },
-    { "window_restore", fa::window_restore },
-    { "windsock", fa::windsock },
-    { "wine_bottle", fa::wine_bottle },
-    { "wine_glass", fa::wine_glass },
-    { "wine_glass_crack", fa::wine_glass_crack },
-    { "fragile", fa::wine_glass_crack },
-    { "wine_glass_empty", fa::wine_glass_empty },
-    { "wine_glass_alt", fa::wine_glass_empty },
-    { "won_sign", fa::won_sign },
-    { "krw", fa::won_sign },
-    { "won", fa::won_sign },
-    { "worm", fa::worm },
-    { "wreath", fa::wreath },
-    { "wrench", fa::wrench },
-    { "wrench_simple", fa::wrench_simple },
-    { "x", fa::x },
-    { "x_ray", fa::x_ray },
-    { "xmark", fa::xmark },
-    { "close", fa::xmark },
-    { "multiply", fa::xmark },
-    { "remove", fa::xmark },
-    { "times", fa::xmark },
-    { "xmark_large", fa::xmark_large },
-    { "xmark_to_slot", fa::xmark_to_slot },
-    { "times_to_slot", fa::xmark_to_slot },
-    { "vote_nay", fa::xmark_to_slot },
-    { "xmarks_lines", fa::xmarks_lines },
-    { "y", fa::y },
-    { "yen_sign", fa::yen_sign },
-    { "cny", fa::yen_sign },
-    { "jpy", fa::yen_sign },
-    { "rmb", fa::yen_sign },
-    { "yen", fa::yen_sign },
-    { "yin_yang", fa::yin_yang },
-    { "z", fa::z },
-    { "_42_group", fa::_42_group },
-    { "innosoft", fa::_42_group },
-    { "_500px", fa::_500px },
-    { "accessible_icon", fa::accessible_icon },
-    { "accusoft", fa::accusoft },
-    { "adn", fa::adn },
-    { "adversal", fa::adversal },
-    { "affiliatetheme", fa::affiliatetheme },
-    { "airbnb", fa::airbnb },
-    { "algolia", fa::algolia },
-    { "alipay", fa::alipay },
-    { "amazon", fa::amazon },
-    { "amazon_pay", fa::amazon_pay },
-    { "amilia", fa::amilia },
-    { "android", fa::android },
-    { "angellist", fa::angellist },
-    { "angrycreative", fa::angrycreative },
-    { "angular", fa::angular },
-    { "app_store", fa::app_store },
-    { "app_store_ios", fa::app_store_ios },
-    { "apper", fa::apper },
-    { "apple", fa::apple },
-    { "apple_pay", fa::apple_pay },
-    { "artstation", fa::artstation },
-    { "asymmetrik", fa::asymmetrik },
-    { "atlassian", fa::atlassian },
-    { "audible", fa::audible },
-    { "autoprefixer", fa::autoprefixer },
-    { "avianex", fa::avianex },
-    { "aviato", fa::aviato },
-    { "aws", fa::aws },
-    { "bandcamp", fa::bandcamp },
-    { "battle_net", fa::battle_net },
-    { "behance", fa::behance },
-    { "behance_square", fa::behance_square },
-    { "bilibili", fa::bilibili },
-    { "bimobject", fa::bimobject },
-    { "bitbucket", fa::bitbucket },
-    { "bitcoin", fa::bitcoin },
-    { "bity", fa::bity },
-    { "black_tie", fa::black_tie },
-    { "blackberry", fa::blackberry },
-    { "blogger", fa::blogger },
-    { "blogger_b", fa::blogger_b },
-    { "bluetooth", fa::bluetooth },
-    { "bluetooth_b", fa::bluetooth_b },
-    { "bootstrap", fa::bootstrap },
-    { "bots", fa::bots },
-    { "btc", fa::btc },
-    { "buffer", fa::buffer },
-    { "buromobelexperte", fa::buromobelexperte },
-    { "buy_n_large", fa::buy_n_large },
-    { "buysellads", fa::buysellads },
-    { "canadian_maple_leaf", fa::canadian_maple_leaf },
-    { "cc_amazon_pay", fa::cc_amazon_pay },
-    { "cc_amex", fa::cc_amex },
-    { "cc_apple_pay", fa::cc_apple_pay },
-    { "cc_diners_club", fa::cc_diners_club },
-    { "cc_discover", fa::cc_discover },
-    { "cc_jcb", fa::cc_jcb },
-    { "cc_mastercard", fa::cc_mastercard },
-    { "cc_paypal", fa::cc_paypal },
-    { "cc_stripe", fa::cc_stripe },
-    { "cc_visa", fa::cc_visa },
-    { "centercode", fa::centercode },
-    { "centos", fa::centos },
-    { "chrome", fa::chrome },
-    { "chromecast", fa::chromecast },
-    { "cloudflare", fa::cloudflare },
-    { "cloudscale", fa::cloudscale },
-    { "cloudsmith", fa::cloudsmith },
-    { "cloudversify", fa::cloudversify },
-    { "cmplid", fa::cmplid },
-    { "codepen", fa::codepen },
-    { "codiepie", fa::codiepie },
-    { "confluence", fa::confluence },
-    { "connectdevelop", fa::connectdevelop },
-    { "contao", fa::contao },
-    { "cotton_bureau", fa::cotton_bureau },
-    { "cpanel", fa::cpanel },
-    { "creative_commons", fa::creative_commons },
-    { "creative_commons_by", fa::creative_commons_by },
-    { "creative_commons_nc", fa::creative_commons_nc },
-    { "creative_commons_nc_eu", fa::creative_commons_nc_eu },
-    { "creative_commons_nc_jp", fa::creative_commons_nc_jp },
-    { "creative_commons_nd", fa::creative_commons_nd },
-    { "creative_commons_pd", fa::creative_commons_pd },
-    { "creative_commons_pd_alt", fa::creative_commons_pd_alt },
-    { "creative_commons_remix", fa::creative_commons_remix },
-    { "creative_commons_sa", fa::creative_commons_sa },
-    { "creative_commons_sampling", fa::creative_commons_sampling },
-    { "creative_commons_sampling_plus", fa::creative_commons_sampling_plus },
-    { "creative_commons_share", fa::creative_commons_share },
-    { "creative_commons_zero", fa::creative_commons_zero },
-    { "critical_role", fa::critical_role },
-    { "css3", fa::css3 },
-    { "css3_alt", fa::css3_alt },
-    { "cuttlefish", fa::cuttlefish },
-    { "d_and_d", fa::d_and_d },
-    { "d_and_d_beyond", fa::d_and_d_beyond },
-    { "dailymotion", fa::dailymotion },
-    { "dashcube", fa::dashcube },
-    { "deezer", fa::deezer },
-    { "delicious", fa::delicious },
-    { "deploydog", fa::deploydog },
-    { "deskpro", fa::deskpro },
-    { "dev", fa::dev },
-    { "deviantart", fa::deviantart },
-    { "dhl", fa::dhl },
-    { "diaspora", fa::diaspora },
-    { "digg", fa::digg },
-    { "digital_ocean", fa::digital_ocean },
-    { "discord", fa::discord },
-    { "discourse", fa::discourse },
-    { "dochub", fa::dochub },
-    { "docker", fa::docker },
-    { "draft2digital", fa::draft2digital },
-    { "dribbble", fa::dribbble },
-    { "dribbble_square", fa::dribbble_square },
-    { "dropbox", fa::dropbox },
-    { "drupal", fa::drupal },
-    { "dyalog", fa::dyalog },
-    { "earlybirds", fa::earlybirds },
-    { "ebay", fa::ebay },
-    { "edge", fa::edge },
-    { "edge_legacy", fa::edge_legacy },
-    { "elementor", fa::elementor },
-    { "ello", fa::ello },
-    { "ember", fa::ember },
-    { "empire", fa::empire },
-    { "envira", fa::envira },
-    { "erlang", fa::erlang },
-    { "ethereum", fa::ethereum },
-    { "etsy", fa::etsy },
-    { "evernote", fa::evernote },
-    { "expeditedssl", fa::expeditedssl },
-    { "facebook", fa::facebook },
-    { "facebook_f", fa::facebook_f },
-    { "facebook_messenger", fa::facebook_messenger },
-    { "facebook_square", fa::facebook_square },
-    { "fantasy_flight_games", fa::fantasy_flight_games },
-    { "fedex", fa::fedex },
-    { "fedora", fa::fedora },
-    { "figma", fa::figma },
-    { "firefox", fa::firefox },
-    { "firefox_browser", fa::firefox_browser },
-    { "first_order", fa::first_order },
-    { "first_order_alt", fa::first_order_alt },
-    { "firstdraft", fa::firstdraft },
-    { "flickr", fa::flickr },
-    { "flipboard", fa::flipboard },
-    { "fly", fa::fly },
-    { "font_awesome", fa::font_awesome },
-    { "font_awesome_flag", fa::font_awesome },
-    { "font_awesome_logo_full", fa::font_awesome },
-    { "fonticons", fa::fonticons },
-    { "fonticons_fi", fa::fonticons_fi },
-    { "fort_awesome", fa::fort_awesome },
-    { "fort_awesome_alt", fa::fort_awesome_alt },
-    { "forumbee", fa::forumbee },
-    { "foursquare", fa::foursquare },
-    { "free_code_camp", fa::free_code_camp },
-    { "freebsd", fa::freebsd },
-    { "fulcrum", fa::fulcrum },
-    { "galactic_republic", fa::galactic_republic },
-    { "galactic_senate", fa::galactic_senate },
-    { "get_pocket", fa::get_pocket },
-    { "gg", fa::gg },
-    { "gg_circle", fa::gg_circle },
-    { "git", fa::git },
-    { "git_alt", fa::git_alt },
-    { "git_square", fa::git_square },
-    { "github", fa::github },
-    { "github_alt", fa::github_alt },
-    { "github_square", fa::github_square },
-    { "gitkraken", fa::gitkraken },
-    { "gitlab", fa::gitlab },
-    { "gitter", fa::gitter },
-    { "glide", fa::glide },
-    { "glide_g", fa::glide_g },
-    { "gofore", fa::gofore },
-    { "golang", fa::golang },
-    { "goodreads", fa::goodreads },
-    { "goodreads_g", fa::goodreads_g },
-    { "google", fa::google },
-    { "google_drive", fa::google_drive },
-    { "google_pay", fa::google_pay },
-    { "google_play", fa::google_play },
-    { "google_plus", fa::google_plus },
-    { "google_plus_g", fa::google_plus_g },
-    { "google_plus_square", fa::google_plus_square },
-    { "google_wallet", fa::google_wallet },
-    { "gratipay", fa::gratipay },
-    { "grav", fa::grav },
-    { "gripfire", fa::gripfire },
-    { "grunt", fa::grunt },
-    { "guilded", fa::guilded },
-    { "gulp", fa::gulp },
-    { "hacker_news", fa::hacker_news },
-    { "hacker_news_square", fa::hacker_news_square },
-    { "hackerrank", fa::hackerrank },
-    { "hashnode", fa::hashnode },
-    { "hips", fa::hips },
-    { "hire_a_helper", fa::hire_a_helper },
-    { "hive", fa::hive },
-    { "hooli", fa::hooli },
-    { "hornbill", fa::hornbill },
-    { "hotjar", fa::hotjar },
-    { "houzz", fa::houzz },
-    { "html5", fa::html5 },
-    { "hubspot", fa::hubspot },
-    { "ideal", fa::ideal },
-    { "imdb", fa::imdb },
-    { "instagram", fa::instagram },
-    { "instagram_square", fa::instagram_square },
-    { "instalod", fa::instalod },
-    { "intercom", fa::intercom },
-    { "internet_explorer", fa::internet_explorer },
-    { "invision", fa::invision },
-    { "ioxhost", fa::ioxhost },
-    { "itch_io", fa::itch_io },
-    { "itunes", fa::itunes },
-    { "itunes_note", fa::itunes_note },
-    { "java", fa::java },
-    { "jedi_order", fa::jedi_order },
-    { "jenkins", fa::jenkins },
-    { "jira", fa::jira },
-    { "joget", fa::joget },
-    { "joomla", fa::joomla },
-    { "js", fa::js },
-    { "js_square", fa::js_square },
-    { "jsfiddle", fa::jsfiddle },
-    { "kaggle", fa::kaggle },
-    { "keybase", fa::keybase },
-    { "keycdn", fa::keycdn },
-    { "kickstarter", fa::kickstarter },
-    { "kickstarter_k", fa::kickstarter_k },
-    { "korvue", fa::korvue },
-    { "laravel", fa::laravel },
-    { "lastfm", fa::lastfm },
-    { "lastfm_square", fa::lastfm_square },
-    { "leanpub", fa::leanpub },
-    { "less", fa::less },
-    { "line", fa::line },
-    { "linkedin", fa::linkedin },
-    { "linkedin_in", fa::linkedin_in },
-    { "linode", fa::linode },
-    { "linux", fa::linux },
-    { "lyft", fa::lyft },
-    { "magento", fa::magento },
-    { "mailchimp", fa::mailchimp },
-    { "mandalorian", fa::mandalorian },
-    { "markdown", fa::markdown },
-    { "mastodon", fa::mastodon },
-    { "maxcdn", fa::maxcdn },
-    { "mdb", fa::mdb },
-    { "medapps", fa::medapps },
-    { "medium", fa::medium },
-    { "medium_m", fa::medium },
-    { "medrt", fa::medrt },
-    { "meetup", fa::meetup },
-    { "megaport", fa::megaport },
-    { "mendeley", fa::mendeley },
-    { "meta", fa::meta },
-    { "microblog", fa::microblog },
-    { "microsoft", fa::microsoft },
-    { "mix", fa::mix },
-    { "mixcloud", fa::mixcloud },
-    { "mixer", fa::mixer },
-    { "mizuni", fa::mizuni },
-    { "modx", fa::modx },
-    { "monero", fa::monero },
-    { "napster", fa::napster },
-    { "neos", fa::neos },
-    { "nfc_directional", fa::nfc_directional },
-    { "nfc_symbol", fa::nfc_symbol },
-    { "nimblr", fa::nimblr },
-    { "node", fa::node },
-    { "node_js", fa::node_js },
-    { "npm", fa::npm },
-    { "ns8", fa::ns8 },
-    { "nutritionix", fa::nutritionix },
-    { "octopus_deploy", fa::octopus_deploy },
-    { "odnoklassniki", fa::odnoklassniki },
-    { "odnoklassniki_square", fa::odnoklassniki_square },
-    { "old_republic", fa::old_republic },
-    { "opencart", fa::opencart },
-    { "openid", fa::openid },
-    { "opera", fa::opera },
-    { "optin_monster", fa::optin_monster },
-    { "orcid", fa::orcid },
-    { "osi", fa::osi },
-    { "padlet", fa::padlet },
-    { "page4", fa::page4 },
-    { "pagelines", fa::pagelines },
-    { "palfed", fa::palfed },
-    { "patreon", fa::patreon },
-    { "paypal", fa::paypal },
-    { "perbyte", fa::perbyte },
-    { "periscope", fa::periscope },
-    { "phabricator", fa::phabricator },
-    { "phoenix_framework", fa::phoenix_framework },
-    { "phoenix_squadron", fa::phoenix_squadron },
-    { "php", fa::php },
-    { "pied_piper", fa::pied_piper },
-    { "pied_piper_alt", fa::pied_piper_alt },
-    { "pied_piper_hat", fa::pied_piper_hat },
-    { "pied_piper_pp", fa::pied_piper_pp },
-    { "pied_piper_square", fa::pied_piper_square },
-    { "pinterest", fa::pinterest },
-    { "pinterest_p", fa::pinterest_p },
-    { "pinterest_square", fa::pinterest_square },
-    { "pix", fa::pix },
-    { "playstation", fa::playstation },
-    { "product_hunt", fa::product_hunt },
-    { "pushed", fa::pushed },
-    { "python", fa::python },
-    { "qq", fa::qq },
-    { "quinscape", fa::quinscape },
-    { "quora", fa::quora },
-    { "r_project", fa::r_project },
-    { "raspberry_pi", fa::raspberry_pi },
-    { "ravelry", fa::ravelry },
-    { "react", fa::react },
-    { "reacteurope", fa::reacteurope },
-    { "readme", fa::readme },
-    { "rebel", fa::rebel },
-    { "red_river", fa::red_river },
-    { "reddit", fa::reddit },
-    { "reddit_alien", fa::reddit_alien },
-    { "reddit_square", fa::reddit_square },
-    { "redhat", fa::redhat },
-    { "renren", fa::renren },
-    { "replyd", fa::replyd },
-    { "researchgate", fa::researchgate },
-    { "resolving", fa::resolving },
-    { "rev", fa::rev },
-    { "rocketchat", fa::rocketchat },
-    { "rockrms", fa::rockrms },
-    { "rust", fa::rust },
-    { "safari", fa::safari },
-    { "salesforce", fa::salesforce },
-    { "sass", fa::sass },
-    { "schlix", fa::schlix },
-    { "screenpal", fa::screenpal },
-    { "scribd", fa::scribd },
-    { "searchengin", fa::searchengin },
-    { "sellcast", fa::sellcast },
-    { "sellsy", fa::sellsy },
-    { "servicestack", fa::servicestack },
-    { "shirtsinbulk", fa::shirtsinbulk },
-    { "shopify", fa::shopify },
-    { "shopware", fa::shopware },
-    { "simplybuilt", fa::simplybuilt },
-    { "sistrix", fa::sistrix },
-    { "sith", fa::sith },
-    { "sitrox", fa::sitrox },
-    { "sketch", fa::sketch },
-    { "skyatlas", fa::skyatlas },
-    { "skype", fa::skype },
-    { "slack", fa::slack },
-    { "slack_hash", fa::slack },
-    { "slideshare", fa::slideshare },
-    { "snapchat", fa::snapchat },
-    { "snapchat_ghost", fa::snapchat },
-    { "snapchat_square", fa::snapchat_square },
-    { "soundcloud", fa::soundcloud },
-    { "sourcetree", fa::sourcetree },
-    { "speakap", fa::speakap },
-    { "speaker_deck", fa::speaker_deck },
-    { "spotify", fa::spotify },
-    { "square_font_awesome", fa::square_font_awesome },
-    { "square_font_awesome_stroke", fa::square_font_awesome_stroke },
-    { "font_awesome_alt", fa::square_font_awesome_stroke },
-    { "squarespace", fa::squarespace },
-    { "stack_exchange", fa::stack_exchange },
-    { "stack_overflow", fa::stack_overflow },
-    { "stackpath", fa::stackpath },
-    { "staylinked", fa::staylinked },
-    { "steam", fa::steam },
-    { "steam_square", fa::steam_square },
-    { "steam_symbol", fa::steam_symbol },
-    { "sticker_mule", fa::sticker_mule },
-    { "strava", fa::strava },
-    { "stripe", fa::stripe },
-    { "stripe_s", fa::stripe_s },
-    { "studiovinari", fa::studiovinari },
-    { "stumbleupon", fa::stumbleupon },
-    { "stumbleupon_circle", fa::stumbleupon_circle },
-    { "superpowers", fa::superpowers },
-    { "supple", fa::supple },
-    { "suse", fa::suse },
-    { "swift", fa::swift },
-    { "symfony", fa::symfony },
-    { "teamspeak", fa::teamspeak },
-    { "telegram", fa::telegram },
-    { "telegram_plane", fa::telegram },
-    { "tencent_weibo", fa::tencent_weibo },
-    { "the_red_yeti", fa::the_red_yeti },
-    { "themeco", fa::themeco },
-    { "themeisle", fa::themeisle },
-    { "think_peaks", fa::think_peaks },
-    { "tiktok", fa::tiktok },
-    { "trade_federation", fa::trade_federation },
-    { "trello", fa::trello },
-    { "tumblr", fa::tumblr },
-    { "tumblr_square", fa::tumblr_square },
-    { "twitch", fa::twitch },
-    { "twitter", fa::twitter },
-    { "twitter_square", fa::twitter_square },
-    { "typo3", fa::typo3 },
-    { "uber", fa::uber },
-    { "ubuntu", fa::ubuntu },
-    { "uikit", fa::uikit },
-    { "umbraco", fa::umbraco },
-    { "uncharted", fa::uncharted },
-    { "uniregistry", fa::uniregistry },
-    { "unity", fa::unity },
-    { "unsplash", fa::unsplash },
-    { "untappd", fa::untappd },
-    { "ups", fa::ups },
-    { "usb", fa::usb },
-    { "usps", fa::usps },
-    { "ussunnah", fa::ussunnah },
-    { "vaadin", fa::vaadin },
-    { "viacoin", fa::viacoin },
-    { "viadeo", fa::viadeo },
-    { "viadeo_square", fa::viadeo_square },
-    { "viber", fa::viber },
-    { "vimeo", fa::vimeo },
-    { "vimeo_square", fa::vimeo_square },
-    { "vimeo_v", fa::vimeo_v },
-    { "vine", fa::vine },
-    { "vk", fa::vk },
-    { "vnv", fa::vnv },
-    { "vuejs", fa::vuejs },
-    { "watchman_monitoring", fa::watchman_monitoring },
-    { "waze", fa::waze },
-    { "weebly", fa::weebly },
-    { "weibo", fa::weibo },
-    { "weixin", fa::weixin },
-    { "whatsapp", fa::whatsapp },
-    { "whatsapp_square", fa::whatsapp_square },
-    { "whmcs", fa::whmcs },
-    { "wikipedia_w", fa::wikipedia_w },
-    { "windows", fa::windows },
-    { "wirsindhandwerk", fa::wirsindhandwerk },
-    { "wsh", fa::wirsindhandwerk },
-    { "wix", fa::wix },
-    { "wizards_of_the_coast", fa::wizards_of_the_coast },
-    { "wodu", fa::wodu },
-    { "wolf_pack_battalion", fa::wolf_pack_battalion },
-    { "wordpress", fa::wordpress },
-    { "wordpress_simple", fa::wordpress_simple },
-    { "wpbeginner", fa::wpbeginner },
-    { "wpexplorer", fa::wpexplorer },
-    { "wpforms", fa::wpforms },
-    { "wpressr", fa::wpressr },
-    { "xbox", fa::xbox },
-    { "xing", fa::xing },
-    { "xing_square", fa::xing_square },
-    { "y_combinator", fa::y_combinator },
-    { "yahoo", fa::yahoo },
-    { "yammer", fa::yammer },
-    { "yandex", fa::yandex },
-    { "yandex_international", fa::yandex_international },
-    { "yarn", fa::yarn },
-    { "yelp", fa::yelp },
-    { "yoast", fa::yoast },
-    { "youtube", fa::youtube },
-    { "youtube_square", fa::youtube_square },
-    { "zhihu", fa::zhihu },
-};
+/// All icon-names (including aliases) with their icon, defined once in enum_name_index.cpp
+/// The canonical name of an icon is directly followed by its aliases
+extern const FANameIcon faNameIconArray[];
+extern const int faNameIconCount;
+
+/// The icons (without aliases) sorted by their style-qualified value, as parallel arrays of faIconCount entries
+extern const int faIconCount;
+extern const int faIcons[];
+/// The index of the canonical name of an icon in faNameIconArray
+extern const quint16 faIconNames[];
+/// The number of names of an icon: the canonical name and its aliases
+extern const quint8 faIconNameCounts[];
+
+/// The reverse index of faIcons, a two-level table over the 256 pages of 256 code-points of both styles.
+/// The index in faIcons of the style-qualified value v is (0xffff when there's no icon):
+///   faIconPageEntries[faIconPages[(fa::iconStyle(v) ? 256 : 0) + ((v >> 8) & 0xff)] * 256 + (v & 0xff)]
+extern const quint16 faIconPages[512];
+extern const quint16 faIconPageEntries[];
+
+/// The search keywords (the words of the names and the search terms), sorted, as parallel arrays of faKeywordCount entries
+/// The icons of keyword k are faIcons[faKeywordIcons[j]] for j in [faKeywordIconBegin[k], faKeywordIconBegin[k + 1])
+extern const int faKeywordCount;
+extern const char faKeywordPool[];
+extern const quint32 faKeywordOffsets[];
+extern const quint32 faKeywordIconBegin[];
+extern const quint16 faKeywordIcons[];
 
+#endif // ENUM_NAME_INDEX_H
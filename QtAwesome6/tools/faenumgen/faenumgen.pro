@@ -0,0 +1,20 @@
+# Generates enum_name_index.h and enum_name_index.cpp from icons.txt and the fonts
+#
+#   qmake && make && ./faenumgen ../../icons.txt ../../fonts ../..
+#
+# or run "make generate" to build the tool and regenerate the index and enum_name_hash.h in place
+# (the "generate" target runs faindexgen, build tools/tools.pro to have both tools)
+
+TEMPLATE = app
+TARGET = faenumgen
+
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += \
+    main.cpp
+
+generate.commands = $$OUT_PWD/$$TARGET $$PWD/../../icons.txt $$PWD/../../fonts $$PWD/../.. && \
+    $$OUT_PWD/../faindexgen/faindexgen $$PWD/../../enum_name_index.cpp $$PWD/../../enum_name_hash.h
+generate.depends = $$TARGET
+QMAKE_EXTRA_TARGETS += generate
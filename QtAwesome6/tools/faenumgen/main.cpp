@@ -0,0 +1,457 @@
+/**
+ * faenumgen - generates the icon index of QtAwesome from the icon metadata and the fonts
+ *
+ * usage: faenumgen <icons.txt> <fonts dir> <output dir>
+ *
+ * Every line of icons.txt describes one icon: "<style> <unicode> <name> [<alias>...] [: <search term>...]".
+ * The output directory receives:
+ *   - enum_name_index.h with the fa::icon enum (style-qualified values) and the declarations of the tables
+ *   - enum_name_index.cpp with the tables:
+ *       faNameIconArray     all names (canonical name followed by its aliases) in the order of icons.txt
+ *       faIcons             the icons sorted by their style-qualified value, with the index of their names
+ *       faIconPages...      the reverse index: a two-level table from the style-qualified value to the icon
+ *       faKeyword...        the sorted search keywords with the icons they refer to
+ * Every icon is verified against the cmap of the font of its style.
+ * Run faindexgen on the generated enum_name_index.cpp to create the matching enum_name_hash.h.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+struct Icon
+{
+    bool brands;
+    uint32_t unicode;
+    std::vector<std::string> names;     // the canonical name followed by the aliases (Font Awesome names)
+    std::vector<std::string> terms;     // the additional search terms
+};
+
+static const uint32_t brandsBit = 0x01000000;
+
+//---------------------------------------------------------------------------------------
+
+static uint16_t read16( const Bytes& data, size_t offset )
+{
+    return uint16_t( (data.at(offset) << 8) | data.at(offset + 1) );
+}
+
+static uint32_t read32( const Bytes& data, size_t offset )
+{
+    return (uint32_t(read16(data, offset)) << 16) | read16(data, offset + 2);
+}
+
+/// Reads the code-points of the (3,10) or (3,1) cmap subtable of a TrueType font
+static bool readCodepoints( const std::string& fileName, std::set<uint32_t>* codepoints )
+{
+    std::ifstream in( fileName, std::ios::binary );
+    if( !in ) {
+        std::cerr << "Can't read " << fileName << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+    Bytes data( text.begin(), text.end() );
+    if( data.size() < 12 || read32(data, 0) != 0x00010000 ) {
+        std::cerr << fileName << " is not a TrueType font" << std::endl;
+        return false;
+    }
+
+    size_t cmap = 0;
+    for( uint16_t i = 0; i < read16(data, 4); ++i ) {
+        if( std::string(data.begin() + 12 + 16 * i, data.begin() + 16 + 16 * i) == "cmap" ) {
+            cmap = read32( data, 12 + 16 * i + 8 );
+        }
+    }
+    if( !cmap ) {
+        std::cerr << fileName << " has no cmap" << std::endl;
+        return false;
+    }
+
+    uint16_t numSubtables = read16( data, cmap + 2 );
+    for( int pass = 0; pass < 2; ++pass ) {
+        for( uint16_t i = 0; i < numSubtables; ++i ) {
+            uint16_t platform = read16( data, cmap + 4 + 8 * i );
+            uint16_t encoding = read16( data, cmap + 6 + 8 * i );
+            size_t offset = cmap + read32( data, cmap + 8 + 8 * i );
+            uint16_t format = read16( data, offset );
+            if( pass == 0 && platform == 3 && encoding == 10 && format == 12 ) {
+                uint32_t groups = read32( data, offset + 12 );
+                for( uint32_t g = 0; g < groups; ++g ) {
+                    for( uint32_t c = read32(data, offset + 16 + 12 * g); c <= read32(data, offset + 20 + 12 * g); ++c ) {
+                        codepoints->insert( c );
+                    }
+                }
+                return true;
+            }
+            if( pass == 1 && ((platform == 3 && encoding == 1) || platform == 0) && format == 4 ) {
+                uint16_t segCount = read16( data, offset + 6 ) / 2;
+                size_t ends = offset + 14, starts = ends + 2 * segCount + 2;
+                for( uint16_t s = 0; s < segCount; ++s ) {
+                    uint16_t end = read16( data, ends + 2 * s ), start = read16( data, starts + 2 * s );
+                    for( uint32_t c = start; c <= end && c != 0xffff; ++c ) {
+                        codepoints->insert( c );
+                    }
+                }
+                return true;
+            }
+        }
+    }
+    std::cerr << fileName << " has no unicode cmap" << std::endl;
+    return false;
+}
+
+//---------------------------------------------------------------------------------------
+
+/// Converts a Font Awesome name to the C++ enumerator name
+static std::string cppName( const std::string& name )
+{
+    // the C++ keywords keep the names of the former hand-written index
+    static const std::map<std::string, std::string> keywords = { { "try", "fa_try" }, { "union", "_union" } };
+    auto keyword = keywords.find( name );
+    if( keyword != keywords.end() ) {
+        return keyword->second;
+    }
+    std::string result = name;
+    std::replace( result.begin(), result.end(), '-', '_' );
+    if( std::isdigit((unsigned char)result[0]) ) {
+        result = "_" + result;
+    }
+    return result;
+}
+
+static bool readIcons( const std::string& fileName, std::vector<Icon>* icons )
+{
+    std::ifstream in( fileName );
+    if( !in ) {
+        std::cerr << "Can't read " << fileName << std::endl;
+        return false;
+    }
+    std::string line;
+    int lineNumber = 0;
+    while( std::getline(in, line) ) {
+        ++lineNumber;
+        line = line.substr( 0, line.find('#') );
+        std::stringstream words( line );
+        std::string style, unicode, word;
+        if( !(words >> style) ) {
+            continue;
+        }
+        Icon icon;
+        icon.brands = style == "brands";
+        if( (style != "regular" && !icon.brands) || !(words >> unicode) ) {
+            std::cerr << fileName << ":" << lineNumber << ": expected <regular|brands> <unicode>" << std::endl;
+            return false;
+        }
+        icon.unicode = uint32_t(std::stoul( unicode, nullptr, 16 ));
+        bool terms = false;
+        while( words >> word ) {
+            if( word == ":" ) {
+                terms = true;
+            } else {
+                std::transform( word.begin(), word.end(), word.begin(), ::tolower );
+                if( word.find_first_not_of("abcdefghijklmnopqrstuvwxyz0123456789-") != std::string::npos ) {
+                    std::cerr << fileName << ":" << lineNumber << ": invalid name or search term: " << word << std::endl;
+                    return false;
+                }
+                (terms ? icon.terms : icon.names).push_back( word );
+            }
+        }
+        if( icon.names.empty() ) {
+            std::cerr << fileName << ":" << lineNumber << ": the icon has no name" << std::endl;
+            return false;
+        }
+        icons->push_back( icon );
+    }
+    return !icons->empty();
+}
+
+static std::string hex( uint32_t value )
+{
+    std::stringstream text;
+    text << "0x" << std::hex << value;
+    return text.str();
+}
+
+//---------------------------------------------------------------------------------------
+
+static void writeHeader( std::ostream& out, const std::vector<Icon>& icons )
+{
+    out << "// Generated by tools/faenumgen from icons.txt, do not edit\n"
+           "\n"
+           "#ifndef ENUM_NAME_INDEX_H\n"
+           "#define ENUM_NAME_INDEX_H\n"
+           "\n"
+           "#include <QtGlobal>\n"
+           "#ifdef QTAWESOME_META_ENUM\n"
+           "#include <QObject>\n"
+           "#endif\n"
+           "\n"
+           "/// A list of all icon-names with the codepoint (unicode-value) on the right\n"
+           "/// You can use the names on the page https://fa6.dashgame.com/\n"
+           "namespace fa {\n"
+           "#ifdef QTAWESOME_META_ENUM\n"
+           "Q_NAMESPACE\n"
+           "#endif\n"
+           "\n"
+           "/// The font style of an icon. The style is stored in the bits above the code-point,\n"
+           "/// so every fa::icon value is a style-qualified handle:  style | code-point\n"
+           "enum style {\n"
+           "    fa_regular = 0x00000000,\n"
+           "    fa_brands = 0x01000000\n"
+           "};\n"
+           "\n"
+           "/// Returns the unicode code-point of a style-qualified icon\n"
+           "constexpr int codepoint(int icon) { return icon & 0x00ffffff; }\n"
+           "\n"
+           "/// Returns the font style of a style-qualified icon\n"
+           "constexpr style iconStyle(int icon) { return style(icon & 0x7f000000); }\n"
+           "\n"
+           "/// Combines a font style and a unicode code-point to a style-qualified icon\n"
+           "constexpr int qualified(style s, int unicode) { return s | unicode; }\n"
+           "\n"
+           "enum icon {";
+    bool first = true, brands = false;
+    for( const Icon& icon : icons ) {
+        for( const std::string& name : icon.names ) {
+            out << (first ? "\n" : ",\n");
+            first = false;
+            if( icon.brands && !brands ) {
+                out << "\n    // brands\n";
+                brands = true;
+            }
+            out << "    " << cppName(name) << " = " << (icon.brands ? "fa_brands | " : "") << hex(icon.unicode);
+        }
+    }
+    out << "\n"
+           "};\n"
+           "#ifdef QTAWESOME_META_ENUM\n"
+           "Q_ENUM_NS(icon)   // opt-in (CONFIG += qtawesome_meta_enum), the names are in faNameIconArray and faIcons\n"
+           "#endif\n"
+           "}\n"
+           "\n"
+           "struct FANameIcon {\n"
+           "    const char *name;\n"
+           "    fa::icon icon;\n"
+           "};\n"
+           "\n"
+           "/// All icon-names (including aliases) with their icon, defined once in enum_name_index.cpp\n"
+           "/// The canonical name of an icon is directly followed by its aliases\n"
+           "extern const FANameIcon faNameIconArray[];\n"
+           "extern const int faNameIconCount;\n"
+           "\n"
+           "/// The icons (without aliases) sorted by their style-qualified value, as parallel arrays of faIconCount entries\n"
+           "extern const int faIconCount;\n"
+           "extern const int faIcons[];\n"
+           "/// The index of the canonical name of an icon in faNameIconArray\n"
+           "extern const quint16 faIconNames[];\n"
+           "/// The number of names of an icon: the canonical name and its aliases\n"
+           "extern const quint8 faIconNameCounts[];\n"
+           "\n"
+           "/// The reverse index of faIcons, a two-level table over the 256 pages of 256 code-points of both styles.\n"
+           "/// The index in faIcons of the style-qualified value v is (0xffff when there's no icon):\n"
+           "///   faIconPageEntries[faIconPages[(fa::iconStyle(v) ? 256 : 0) + ((v >> 8) & 0xff)] * 256 + (v & 0xff)]\n"
+           "extern const quint16 faIconPages[512];\n"
+           "extern const quint16 faIconPageEntries[];\n"
+           "\n"
+           "/// The search keywords (the words of the names and the search terms), sorted, as parallel arrays of faKeywordCount entries\n"
+           "/// The icons of keyword k are faIcons[faKeywordIcons[j]] for j in [faKeywordIconBegin[k], faKeywordIconBegin[k + 1])\n"
+           "extern const int faKeywordCount;\n"
+           "extern const char faKeywordPool[];\n"
+           "extern const quint32 faKeywordOffsets[];\n"
+           "extern const quint32 faKeywordIconBegin[];\n"
+           "extern const quint16 faKeywordIcons[];\n"
+           "\n"
+           "#endif // ENUM_NAME_INDEX_H\n";
+}
+
+template <typename T, typename Format>
+static void writeArray( std::ostream& out, const char* declaration, const std::vector<T>& values, int perLine, Format format )
+{
+    out << declaration << " = {";
+    for( size_t i = 0; i < values.size(); ++i ) {
+        out << (i % perLine ? " " : "\n    ") << format(values[i]) << ",";
+    }
+    out << "\n};\n\n";
+}
+
+static void writeSource( std::ostream& out, const std::vector<Icon>& icons )
+{
+    out << "// Generated by tools/faenumgen from icons.txt, do not edit\n"
+           "\n"
+           "#include \"enum_name_index.h\"\n"
+           "\n"
+           "const FANameIcon faNameIconArray[] = {\n";
+    std::vector<uint32_t> firstName;
+    uint32_t nameCount = 0;
+    for( const Icon& icon : icons ) {
+        firstName.push_back( nameCount );
+        for( const std::string& name : icon.names ) {
+            out << "    { \"" << cppName(name) << "\", fa::" << cppName(icon.names.front()) << " },\n";
+            ++nameCount;
+        }
+    }
+    out << "};\n"
+           "\n"
+           "const int faNameIconCount = sizeof(faNameIconArray) / sizeof(FANameIcon);\n"
+           "\n";
+
+    // the icon table, sorted by the style-qualified value
+    std::vector<size_t> order( icons.size() );
+    for( size_t i = 0; i < order.size(); ++i ) { order[i] = i; }
+    auto value = [&]( size_t i ) { return (icons[i].brands ? brandsBit : 0) | icons[i].unicode; };
+    std::sort( order.begin(), order.end(), [&]( size_t a, size_t b ) { return value(a) < value(b); } );
+    std::vector<uint32_t> values, names, counts;
+    std::vector<size_t> sortedIndex( icons.size() );
+    for( size_t i = 0; i < order.size(); ++i ) {
+        values.push_back( value(order[i]) );
+        names.push_back( firstName[order[i]] );
+        counts.push_back( uint32_t(icons[order[i]].names.size()) );
+        sortedIndex[order[i]] = i;
+    }
+    auto decimal = []( uint32_t v ) { return std::to_string(v); };
+    out << "const int faIconCount = " << icons.size() << ";\n\n";
+    writeArray( out, "const int faIcons[]", values, 12, hex );
+    writeArray( out, "const quint16 faIconNames[]", names, 16, decimal );
+    writeArray( out, "const quint8 faIconNameCounts[]", counts, 32, decimal );
+
+    // the reverse index, page 0 is the empty page shared by all pages without icons
+    std::vector<uint32_t> pages( 512, 0 ), entries( 256, 0xffff );
+    for( size_t i = 0; i < values.size(); ++i ) {
+        uint32_t page = (values[i] & brandsBit ? 256 : 0) + ((values[i] >> 8) & 0xff);
+        if( !pages[page] ) {
+            pages[page] = uint32_t(entries.size() / 256);
+            entries.resize( entries.size() + 256, 0xffff );
+        }
+        entries[pages[page] * 256 + (values[i] & 0xff)] = uint32_t(i);
+    }
+    writeArray( out, "const quint16 faIconPages[512]", pages, 32, decimal );
+    writeArray( out, "const quint16 faIconPageEntries[]", entries, 16, decimal );
+
+    // the keyword index: every word of the names and every search term, with the (sorted) icon indexes
+    std::map<std::string, std::set<uint32_t>> keywords;
+    for( size_t i = 0; i < icons.size(); ++i ) {
+        std::vector<std::string> words = icons[i].terms;
+        for( const std::string& name : icons[i].names ) {
+            std::stringstream parts( name );
+            std::string part;
+            while( std::getline(parts, part, '-') ) {
+                words.push_back( part );
+            }
+        }
+        for( const std::string& word : words ) {
+            if( !word.empty() ) {
+                keywords[word].insert( uint32_t(sortedIndex[i]) );
+            }
+        }
+    }
+    std::vector<uint32_t> offsets, begins, postings;
+    uint32_t offset = 0;
+    out << "const int faKeywordCount = " << keywords.size() << ";\n"
+           "\n"
+           "const char faKeywordPool[] =";
+    std::string line;
+    for( const auto& keyword : keywords ) {
+        offsets.push_back( offset );
+        begins.push_back( uint32_t(postings.size()) );
+        postings.insert( postings.end(), keyword.second.begin(), keyword.second.end() );
+        offset += uint32_t(keyword.first.size() + 1);
+        line += keyword.first + "\\000";   // three octal digits, a keyword can start with a digit
+        if( line.size() > 100 ) {
+            out << "\n    \"" << line << "\"";
+            line.clear();
+        }
+    }
+    if( !line.empty() ) {
+        out << "\n    \"" << line << "\"";
+    }
+    out << ";\n\n";
+    begins.push_back( uint32_t(postings.size()) );
+    writeArray( out, "const quint32 faKeywordOffsets[]", offsets, 12, decimal );
+    writeArray( out, "const quint32 faKeywordIconBegin[]", begins, 12, decimal );
+    writeArray( out, "const quint16 faKeywordIcons[]", postings, 16, decimal );
+}
+
+//---------------------------------------------------------------------------------------
+
+int main( int argc, char* argv[] )
+{
+    if( argc != 4 ) {
+        std::cerr << "usage: faenumgen <icons.txt> <fonts dir> <output dir>" << std::endl;
+        return 1;
+    }
+    const std::string fontsDir = argv[2];
+    const std::string outputDir = argv[3];
+
+    std::vector<Icon> icons;
+    if( !readIcons( argv[1], &icons ) ) {
+        return 1;
+    }
+
+    // the brands icons follow the regular ones, so the enum has a single brands section
+    std::stable_partition( icons.begin(), icons.end(), []( const Icon& icon ) { return !icon.brands; } );
+
+    std::set<uint32_t> regular, brands;
+    if( !readCodepoints( fontsDir + "/fa-regular-400.ttf", &regular ) || !readCodepoints( fontsDir + "/fa-brands-400.ttf", &brands ) ) {
+        return 1;
+    }
+
+    // verify the metadata: unique names and values, and every icon is in the font of its style
+    std::set<std::string> names;
+    std::set<uint32_t> values;
+    bool ok = true;
+    for( const Icon& icon : icons ) {
+        for( const std::string& name : icon.names ) {
+            if( !names.insert(cppName(name)).second ) {
+                std::cerr << "Duplicate icon name: " << name << std::endl;
+                ok = false;
+            }
+        }
+        if( !values.insert((icon.brands ? brandsBit : 0) | icon.unicode).second ) {
+            std::cerr << "Duplicate icon: " << icon.names.front() << std::endl;
+            ok = false;
+        }
+        if( !(icon.brands ? brands : regular).count(icon.unicode) ) {
+            std::cerr << icon.names.front() << " (" << hex(icon.unicode) << ") is not in the " << (icon.brands ? "brands" : "regular") << " font" << std::endl;
+            ok = false;
+        }
+    }
+    if( !ok ) {
+        return 1;
+    }
+    // the limits of the table types: quint16 name and icon indexes
+    if( names.size() >= 0xffff || icons.size() >= 0xffff || std::any_of(icons.begin(), icons.end(), []( const Icon& icon ) { return icon.unicode > 0xffff; }) ) {
+        std::cerr << "The index only supports less than 65535 names and code-points up to 0xffff" << std::endl;
+        return 1;
+    }
+    for( int style = 0; style < 2; ++style ) {
+        size_t unnamed = 0;
+        for( uint32_t c : (style ? brands : regular) ) {
+            unnamed += c > 0x20 && !values.count((style ? brandsBit : 0) | c);
+        }
+        if( unnamed ) {
+            std::cout << "warning: " << unnamed << " code-points of the " << (style ? "brands" : "regular") << " font have no icon" << std::endl;
+        }
+    }
+
+    std::ofstream header( outputDir + "/enum_name_index.h" );
+    std::ofstream source( outputDir + "/enum_name_index.cpp" );
+    if( !header || !source ) {
+        std::cerr << "Can't write the index to " << outputDir << std::endl;
+        return 1;
+    }
+    writeHeader( header, icons );
+    writeSource( source, icons );
+    std::cout << "Generated the index of " << icons.size() << " icons with " << names.size() << " names in " << outputDir << std::endl;
+    return 0;
+}
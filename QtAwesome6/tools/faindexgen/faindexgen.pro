@@ -0,0 +1,18 @@
+# Generates enum_name_hash.h from enum_name_index.cpp
+#
+#   qmake && make && ./faindexgen ../../enum_name_index.cpp ../../enum_name_hash.h
+#
+# or run "make generate" to build the tool and regenerate the header in place
+
+TEMPLATE = app
+TARGET = faindexgen
+
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += \
+    main.cpp
+
+generate.commands = $$OUT_PWD/$$TARGET $$PWD/../../enum_name_index.cpp $$PWD/../../enum_name_hash.h
+generate.depends = $$TARGET
+QMAKE_EXTRA_TARGETS += generate
@@ -0,0 +1,312 @@
+/**
+ * faindexgen - generates the compile-time icon name index of QtAwesome
+ *
+ * usage: faindexgen <enum_name_index.cpp> <enum_name_hash.h>
+ *
+ * The name/icon pairs of faNameIconArray are read from enum_name_index.cpp and a minimal perfect hash
+ * (hash and displace) is written to enum_name_hash.h. The generated tables are constexpr, so the
+ * name lookup doesn't need any table construction at runtime, and QTAWESOME_ICON("name") (or
+ * fa::byName() and the "name"_fa literal with C++20) resolve a name at compile time.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Entry
+{
+    std::string name;
+    std::string icon;   // the fa::icon enumerator
+};
+
+// must be identical to fa::detail::nameHash in the generated header
+static uint32_t nameHash( uint32_t seed, const std::string& name )
+{
+    uint32_t h = seed ? seed : 0x01000193u;
+    for( unsigned char c : name ) {
+        h = (h * 0x01000193u) ^ c;
+    }
+    // mix the high bits into the low bits, the slot of a small index only depends on the low bits
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    return h;
+}
+
+static bool readEntries( const std::string& fileName, std::vector<Entry>* entries )
+{
+    std::ifstream in( fileName );
+    if( !in ) {
+        std::cerr << "Can't open " << fileName << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+
+    size_t start = text.find( "faNameIconArray[]" );
+    if( start == std::string::npos ) {
+        std::cerr << "faNameIconArray not found in " << fileName << std::endl;
+        return false;
+    }
+
+    std::regex entryRegex( "\\{ \"(\\w+)\", fa::(\\w+) \\}" );
+    auto begin = std::sregex_iterator( text.begin() + start, text.end(), entryRegex );
+    for( auto itr = begin; itr != std::sregex_iterator(); ++itr ) {
+        entries->push_back( Entry{ (*itr)[1].str(), (*itr)[2].str() } );
+    }
+    return !entries->empty();
+}
+
+// builds the displacement table: for every bucket a seed, or -(slot + 1) for a bucket with a single key
+static bool buildPerfectHash( const std::vector<Entry>& entries, std::vector<int32_t>* displacements, std::vector<int>* slots )
+{
+    const size_t count = entries.size();
+    std::vector<std::vector<size_t>> buckets( count );
+    for( size_t i = 0; i < count; ++i ) {
+        buckets[nameHash(0, entries[i].name) % count].push_back(i);
+    }
+
+    std::vector<size_t> order( count );
+    for( size_t i = 0; i < count; ++i ) { order[i] = i; }
+    std::stable_sort( order.begin(), order.end(), [&]( size_t a, size_t b ) { return buckets[a].size() > buckets[b].size(); } );
+
+    displacements->assign( count, 0 );
+    slots->assign( count, -1 );
+
+    size_t b = 0;
+    for( ; b < count && buckets[order[b]].size() > 1; ++b ) {
+        const std::vector<size_t>& bucket = buckets[order[b]];
+        for( uint32_t seed = 1; ; ++seed ) {
+            if( seed == 0x7fffffff ) {
+                return false;
+            }
+            std::vector<size_t> used;
+            bool ok = true;
+            for( size_t key : bucket ) {
+                size_t slot = nameHash(seed, entries[key].name) % count;
+                if( (*slots)[slot] >= 0 || std::find(used.begin(), used.end(), slot) != used.end() ) {
+                    ok = false;
+                    break;
+                }
+                used.push_back( slot );
+            }
+            if( ok ) {
+                for( size_t i = 0; i < bucket.size(); ++i ) {
+                    (*slots)[used[i]] = int(bucket[i]);
+                }
+                (*displacements)[order[b]] = int32_t(seed);
+                break;
+            }
+        }
+    }
+
+    // the buckets with a single key are placed directly in the free slots
+    size_t freeSlot = 0;
+    for( ; b < count && buckets[order[b]].size() == 1; ++b ) {
+        while( (*slots)[freeSlot] >= 0 ) { ++freeSlot; }
+        (*slots)[freeSlot] = int(buckets[order[b]].front());
+        (*displacements)[order[b]] = -int32_t(freeSlot) - 1;
+    }
+    return true;
+}
+
+static void writeHeader( std::ostream& out, const std::vector<Entry>& entries, const std::vector<int32_t>& displacements, const std::vector<int>& slots )
+{
+    out << "// Generated by tools/faindexgen from enum_name_index.cpp, do not edit\n"
+           "\n"
+           "#ifndef ENUM_NAME_HASH_H\n"
+           "#define ENUM_NAME_HASH_H\n"
+           "\n"
+           "#include \"enum_name_index.h\"\n"
+           "\n"
+           "#include <cstddef>\n"
+           "#include <cstdint>\n"
+           "#include <type_traits>\n"
+           "\n"
+           "namespace fa {\n"
+           "namespace detail {\n"
+           "\n"
+           "/// The number of icon names (including aliases)\n"
+           "constexpr int nameCount = " << entries.size() << ";\n"
+           "\n"
+           "/// The hash used by the perfect hash. A seed of 0 selects the bucket, the other seeds select the slot\n"
+           "template <typename Char>\n"
+           "constexpr uint32_t nameHash( uint32_t seed, const Char* name, int length )\n"
+           "{\n"
+           "    uint32_t h = seed ? seed : 0x01000193u;\n"
+           "    for( int i = 0; i < length; ++i ) {\n"
+           "        h = (h * 0x01000193u) ^ uint32_t(name[i]);\n"
+           "    }\n"
+           "    h ^= h >> 16;\n"
+           "    h *= 0x7feb352du;\n"
+           "    h ^= h >> 15;\n"
+           "    return h;\n"
+           "}\n"
+           "\n";
+
+    // all names in a single string pool, so the table contains no pointers (and no relocations)
+    std::vector<size_t> offsets;
+    std::string pool;
+    for( int slot : slots ) {
+        offsets.push_back( pool.size() );
+        pool += entries[slot].name;
+        pool += '\0';
+    }
+
+    out << "/// The bucket displacements: a seed for the slot hash, or -(slot + 1) for a bucket with a single name\n"
+           "inline constexpr int32_t nameDisplacements[nameCount] = {";
+    for( size_t i = 0; i < displacements.size(); ++i ) {
+        out << (i % 16 ? " " : "\n    ") << displacements[i] << ",";
+    }
+    out << "\n};\n\n";
+
+    out << "/// The names of all slots, separated by a 0\n"
+           "inline constexpr char namePool[] =";
+    std::string line;
+    for( int slot : slots ) {
+        line += entries[slot].name + "\\0";
+        if( line.size() > 100 ) {
+            out << "\n    \"" << line << "\"";
+            line.clear();
+        }
+    }
+    if( !line.empty() ) {
+        out << "\n    \"" << line << "\"";
+    }
+    out << ";\n\n";
+
+    out << "/// The offset of the name of every slot in the name pool\n"
+           "inline constexpr uint32_t nameOffsets[nameCount] = {";
+    for( size_t i = 0; i < offsets.size(); ++i ) {
+        out << (i % 12 ? " " : "\n    ") << offsets[i] << ",";
+    }
+    out << "\n};\n\n";
+
+    out << "/// The icon of every slot\n"
+           "inline constexpr int nameIcons[nameCount] = {";
+    for( size_t i = 0; i < slots.size(); ++i ) {
+        out << "\n    fa::" << entries[slots[i]].icon << ",";
+    }
+    out << "\n};\n"
+           "\n"
+           "/// Returns the slot of the given name, or -1 if the name is unknown\n"
+           "template <typename Char>\n"
+           "constexpr int nameSlot( const Char* name, int length )\n"
+           "{\n"
+           "    int32_t displacement = nameDisplacements[nameHash(0, name, length) % nameCount];\n"
+           "    int slot = displacement < 0 ? -displacement - 1 : int(nameHash(uint32_t(displacement), name, length) % nameCount);\n"
+           "    const char* candidate = namePool + nameOffsets[slot];\n"
+           "    for( int i = 0; i < length; ++i ) {\n"
+           "        if( candidate[i] == 0 || uint32_t(candidate[i]) != uint32_t(name[i]) ) {\n"
+           "            return -1;\n"
+           "        }\n"
+           "    }\n"
+           "    return candidate[length] == 0 ? slot : -1;\n"
+           "}\n"
+           "\n"
+           "/// Not constexpr on purpose: an unknown name in a compile-time lookup ends up here and fails to compile\n"
+           "inline int unknownIconName()\n"
+           "{\n"
+           "    return -1;\n"
+           "}\n"
+           "\n"
+           "} // namespace detail\n"
+           "\n"
+           "/// Returns the style-qualified icon with the given name, or -1 if the name is unknown\n"
+           "template <typename Char>\n"
+           "constexpr int iconByName( const Char* name, int length )\n"
+           "{\n"
+           "    int slot = detail::nameSlot( name, length );\n"
+           "    return slot < 0 ? -1 : detail::nameIcons[slot];\n"
+           "}\n"
+           "\n"
+           "namespace detail {\n"
+           "\n"
+           "/// Returns the style-qualified icon with the given name. An unknown name isn't a constant expression\n"
+           "template <int N>\n"
+           "constexpr int checkedIconByName( const char (&name)[N] )\n"
+           "{\n"
+           "    return iconByName( name, N - 1 ) >= 0 ? iconByName( name, N - 1 ) : unknownIconName();\n"
+           "}\n"
+           "\n"
+           "} // namespace detail\n"
+           "\n"
+           "#if defined(__cpp_consteval)\n"
+           "/// Returns the style-qualified icon with the given name, resolved at compile time (C++20):\n"
+           "///   int music = fa::byName(\"music\");\n"
+           "/// An unknown name doesn't compile. Use QTAWESOME_ICON() before C++20\n"
+           "template <int N>\n"
+           "consteval int byName( const char (&name)[N] )\n"
+           "{\n"
+           "    return detail::checkedIconByName( name );\n"
+           "}\n"
+           "#endif\n"
+           "\n"
+           "inline namespace literals {\n"
+           "\n"
+           "#if defined(__cpp_consteval)\n"
+           "/// The icon literal, resolved at compile time like fa::byName() (C++20):\n"
+           "///   using namespace fa::literals;\n"
+           "///   QIcon icon = awesome->icon( \"music\"_fa );\n"
+           "consteval int operator\"\"_fa( const char* name, std::size_t length )\n"
+           "{\n"
+           "    return iconByName( name, int(length) ) >= 0 ? iconByName( name, int(length) ) : detail::unknownIconName();\n"
+           "}\n"
+           "#endif\n"
+           "\n"
+           "} // namespace literals\n"
+           "\n"
+           "} // namespace fa\n"
+           "\n"
+           "/// The style-qualified icon with the given name, resolved at compile time with every C++ standard:\n"
+           "///   QIcon icon = awesome->icon( QTAWESOME_ICON(\"music\") );\n"
+           "/// An unknown name doesn't compile: the template argument must be a constant expression\n"
+           "#define QTAWESOME_ICON(name) (std::integral_constant<int, fa::detail::checkedIconByName( name )>::value)\n"
+           "\n"
+           "#endif // ENUM_NAME_HASH_H\n";
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc != 3 ) {
+        std::cerr << "usage: faindexgen <enum_name_index.cpp> <enum_name_hash.h>" << std::endl;
+        return 1;
+    }
+
+    std::vector<Entry> entries;
+    if( !readEntries( argv[1], &entries ) ) {
+        return 1;
+    }
+
+    std::map<std::string, int> unique;
+    for( const Entry& entry : entries ) {
+        if( ++unique[entry.name] > 1 ) {
+            std::cerr << "Duplicate icon name: " << entry.name << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<int32_t> displacements;
+    std::vector<int> slots;
+    if( !buildPerfectHash( entries, &displacements, &slots ) ) {
+        std::cerr << "No perfect hash found" << std::endl;
+        return 1;
+    }
+
+    std::ofstream out( argv[2] );
+    if( !out ) {
+        std::cerr << "Can't write " << argv[2] << std::endl;
+        return 1;
+    }
+    writeHeader( out, entries, displacements, slots );
+    std::cout << "Generated " << argv[2] << " with " << entries.size() << " names" << std::endl;
+    return 0;
+}
@@ -0,0 +1,30 @@
+# Creates a per-application subset of the fonts and the icon index
+#
+#   qmake FA_SUBSET_NAMES=<names file> FA_SUBSET_OUT=<output dir> && make subset
+#
+# The icon names can also be found by scanning the sources: FA_SUBSET_SCAN=<source dir>
+# Use the output directory in the application .pro file:
+#
+#   QTAWESOME_SUBSET_DIR = <output dir>
+#   include(QtAwesome6/QtAwesome.pri)
+#
+# The "subset" target runs faenumgen and faindexgen on the trimmed icons.txt, build tools/tools.pro to have all tools.
+
+TEMPLATE = app
+TARGET = fasubset
+
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += \
+    main.cpp
+
+SUBSET_ARGS =
+!isEmpty(FA_SUBSET_NAMES): SUBSET_ARGS += --names $$FA_SUBSET_NAMES
+!isEmpty(FA_SUBSET_SCAN): SUBSET_ARGS += --scan $$FA_SUBSET_SCAN
+
+subset.commands = $$OUT_PWD/$$TARGET $$PWD/../.. $$FA_SUBSET_OUT $$SUBSET_ARGS && \
+    $$OUT_PWD/../faenumgen/faenumgen $$FA_SUBSET_OUT/icons.txt $$FA_SUBSET_OUT/fonts $$FA_SUBSET_OUT && \
+    $$OUT_PWD/../faindexgen/faindexgen $$FA_SUBSET_OUT/enum_name_index.cpp $$FA_SUBSET_OUT/enum_name_hash.h
+subset.depends = $$TARGET
+QMAKE_EXTRA_TARGETS += subset
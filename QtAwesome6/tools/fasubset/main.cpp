@@ -0,0 +1,521 @@
+/**
+ * fasubset - creates a per-application subset of the QtAwesome fonts and icon index
+ *
+ * usage: fasubset <QtAwesome6 dir> <output dir> [--names <file>] [--scan <file or dir>]...
+ *
+ * The used icons are read from a names file (one name per line, with or without the "fa::" prefix)
+ * and/or found by scanning sources for fa::<name>, "<name>"_fa, fa::byName("<name>") and
+ * QTAWESOME_ICON("<name>"). The output directory receives:
+ *   - fonts/fa-regular-400.ttf and fonts/fa-brands-400.ttf with only the glyphs of the used icons
+ *   - QtAwesome.qrc for these fonts
+ *   - icons.txt with only the used icons (with all their names)
+ * Run faenumgen on the trimmed icons.txt and fonts to create the index of the subset, and faindexgen
+ * on the generated enum_name_index.cpp to create the matching enum_name_hash.h.
+ *
+ * The fonts keep their glyph ids: the outlines of unused glyphs are removed and the cmap only maps
+ * the used code-points. The glyph names in the post table are dropped.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+//---------------------------------------------------------------------------------------
+
+static uint16_t read16( const Bytes& data, size_t offset )
+{
+    return uint16_t( (data.at(offset) << 8) | data.at(offset + 1) );
+}
+
+static uint32_t read32( const Bytes& data, size_t offset )
+{
+    return (uint32_t(read16(data, offset)) << 16) | read16(data, offset + 2);
+}
+
+static void write16( Bytes& data, size_t offset, uint16_t value )
+{
+    data.at(offset) = uint8_t(value >> 8);
+    data.at(offset + 1) = uint8_t(value);
+}
+
+static void write32( Bytes& data, size_t offset, uint32_t value )
+{
+    write16( data, offset, uint16_t(value >> 16) );
+    write16( data, offset + 2, uint16_t(value) );
+}
+
+static void append16( Bytes& data, uint16_t value )
+{
+    data.push_back( uint8_t(value >> 8) );
+    data.push_back( uint8_t(value) );
+}
+
+static void append32( Bytes& data, uint32_t value )
+{
+    append16( data, uint16_t(value >> 16) );
+    append16( data, uint16_t(value) );
+}
+
+static uint32_t checksum( const Bytes& data )
+{
+    uint32_t sum = 0;
+    for( size_t i = 0; i < data.size(); i += 4 ) {
+        uint32_t value = 0;
+        for( size_t j = 0; j < 4; ++j ) {
+            value = (value << 8) | (i + j < data.size() ? data[i + j] : 0);
+        }
+        sum += value;
+    }
+    return sum;
+}
+
+static bool readFile( const std::string& fileName, std::string* text )
+{
+    std::ifstream in( fileName, std::ios::binary );
+    if( !in ) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    *text = buffer.str();
+    return true;
+}
+
+static bool writeFile( const std::string& fileName, const std::string& text )
+{
+    std::ofstream out( fileName, std::ios::binary );
+    out << text;
+    return bool(out);
+}
+
+//---------------------------------------------------------------------------------------
+
+/// A TrueType font split into its tables
+class Font
+{
+public:
+    bool load( const std::string& fileName ) {
+        std::string text;
+        if( !readFile( fileName, &text ) ) {
+            std::cerr << "Can't read " << fileName << std::endl;
+            return false;
+        }
+        Bytes data( text.begin(), text.end() );
+        if( data.size() < 12 || read32(data, 0) != 0x00010000 ) {
+            std::cerr << fileName << " is not a TrueType font" << std::endl;
+            return false;
+        }
+        uint16_t numTables = read16( data, 4 );
+        for( uint16_t i = 0; i < numTables; ++i ) {
+            size_t record = 12 + 16 * i;
+            std::string tag( data.begin() + record, data.begin() + record + 4 );
+            uint32_t offset = read32( data, record + 8 );
+            uint32_t length = read32( data, record + 12 );
+            tables[tag] = Bytes( data.begin() + offset, data.begin() + offset + length );
+        }
+        return tables.count("head") && tables.count("maxp") && tables.count("loca") && tables.count("glyf") && tables.count("cmap");
+    }
+
+    std::string save() const {
+        Bytes data;
+        uint16_t numTables = uint16_t(tables.size());
+        uint16_t searchRange = 1, entrySelector = 0;
+        while( searchRange * 2 <= numTables ) { searchRange *= 2; ++entrySelector; }
+        searchRange *= 16;
+
+        append32( data, 0x00010000 );
+        append16( data, numTables );
+        append16( data, searchRange );
+        append16( data, entrySelector );
+        append16( data, uint16_t(numTables * 16 - searchRange) );
+
+        size_t offset = 12 + 16 * tables.size();
+        size_t headOffset = 0;
+        for( const auto& table : tables ) {   // std::map is sorted by tag
+            data.insert( data.end(), table.first.begin(), table.first.end() );
+            append32( data, checksum(table.second) );
+            append32( data, uint32_t(offset) );
+            append32( data, uint32_t(table.second.size()) );
+            if( table.first == "head" ) { headOffset = offset; }
+            offset += (table.second.size() + 3) & ~size_t(3);
+        }
+        for( const auto& table : tables ) {
+            data.insert( data.end(), table.second.begin(), table.second.end() );
+            data.resize( (data.size() + 3) & ~size_t(3), 0 );
+        }
+        write32( data, headOffset + 8, 0xb1b0afbau - checksum(data) );
+        return std::string( data.begin(), data.end() );
+    }
+
+    /// Returns the glyph id of every code-point in the (3,10) or (3,1) cmap subtable
+    std::map<uint32_t, uint16_t> characterMap() const {
+        std::map<uint32_t, uint16_t> result;
+        const Bytes& cmap = tables.at("cmap");
+        uint16_t numSubtables = read16( cmap, 2 );
+        for( uint16_t i = 0; i < numSubtables; ++i ) {
+            uint16_t platform = read16( cmap, 4 + 8 * i );
+            uint16_t encoding = read16( cmap, 6 + 8 * i );
+            uint32_t offset = read32( cmap, 8 + 8 * i );
+            uint16_t format = read16( cmap, offset );
+            if( platform == 3 && encoding == 10 && format == 12 ) {
+                uint32_t groups = read32( cmap, offset + 12 );
+                for( uint32_t g = 0; g < groups; ++g ) {
+                    size_t group = offset + 16 + 12 * g;
+                    uint32_t start = read32( cmap, group ), end = read32( cmap, group + 4 ), glyph = read32( cmap, group + 8 );
+                    for( uint32_t c = start; c <= end; ++c ) {
+                        result[c] = uint16_t(glyph + c - start);
+                    }
+                }
+                return result;
+            }
+        }
+        for( uint16_t i = 0; i < numSubtables; ++i ) {
+            uint16_t platform = read16( cmap, 4 + 8 * i );
+            uint16_t encoding = read16( cmap, 6 + 8 * i );
+            uint32_t offset = read32( cmap, 8 + 8 * i );
+            uint16_t format = read16( cmap, offset );
+            if( (platform == 3 && encoding == 1) || platform == 0 ) {
+                if( format != 4 ) { continue; }
+                uint16_t segCount = read16( cmap, offset + 6 ) / 2;
+                size_t ends = offset + 14, starts = ends + 2 * segCount + 2;
+                size_t deltas = starts + 2 * segCount, rangeOffsets = deltas + 2 * segCount;
+                for( uint16_t s = 0; s < segCount; ++s ) {
+                    uint16_t end = read16( cmap, ends + 2 * s ), start = read16( cmap, starts + 2 * s );
+                    uint16_t delta = read16( cmap, deltas + 2 * s ), rangeOffset = read16( cmap, rangeOffsets + 2 * s );
+                    for( uint32_t c = start; c <= end && c != 0xffff; ++c ) {
+                        uint16_t glyph = 0;
+                        if( rangeOffset == 0 ) {
+                            glyph = uint16_t(c + delta);
+                        } else {
+                            uint16_t index = read16( cmap, rangeOffsets + 2 * s + rangeOffset + 2 * (c - start) );
+                            glyph = index ? uint16_t(index + delta) : 0;
+                        }
+                        if( glyph ) { result[c] = glyph; }
+                    }
+                }
+                return result;
+            }
+        }
+        return result;
+    }
+
+    /// Keeps only the outlines of the given glyphs (and their components) and maps only the given code-points
+    void subset( const std::map<uint32_t, uint16_t>& characters ) {
+        const Bytes& head = tables.at("head");
+        const Bytes& loca = tables.at("loca");
+        const Bytes& glyf = tables.at("glyf");
+        bool longLoca = read16( head, 50 ) != 0;
+        uint16_t numGlyphs = read16( tables.at("maxp"), 4 );
+
+        auto glyphRange = [&]( uint16_t glyph ) {
+            if( longLoca ) {
+                return std::make_pair( size_t(read32(loca, 4 * glyph)), size_t(read32(loca, 4 * glyph + 4)) );
+            }
+            return std::make_pair( size_t(read16(loca, 2 * glyph)) * 2, size_t(read16(loca, 2 * glyph + 2)) * 2 );
+        };
+
+        // collect the glyphs, including the components of composite glyphs
+        std::set<uint16_t> keep;
+        std::vector<uint16_t> pending( 1, 0 );   // .notdef is always kept
+        for( const auto& character : characters ) {
+            pending.push_back( character.second );
+        }
+        while( !pending.empty() ) {
+            uint16_t glyph = pending.back();
+            pending.pop_back();
+            if( glyph >= numGlyphs || !keep.insert(glyph).second ) {
+                continue;
+            }
+            std::pair<size_t, size_t> range = glyphRange( glyph );
+            if( range.second - range.first < 10 || int16_t(read16(glyf, range.first)) >= 0 ) {
+                continue;
+            }
+            size_t offset = range.first + 10;
+            uint16_t flags = 0;
+            do {
+                flags = read16( glyf, offset );
+                pending.push_back( read16(glyf, offset + 2) );
+                offset += 4 + ((flags & 0x0001) ? 4 : 2);
+                if( flags & 0x0008 ) { offset += 2; }
+                else if( flags & 0x0040 ) { offset += 4; }
+                else if( flags & 0x0080 ) { offset += 8; }
+            } while( flags & 0x0020 );
+        }
+
+        // rebuild glyf and loca (long format), the glyph ids don't change
+        Bytes newGlyf, newLoca;
+        for( uint16_t glyph = 0; glyph < numGlyphs; ++glyph ) {
+            append32( newLoca, uint32_t(newGlyf.size()) );
+            if( keep.count(glyph) ) {
+                std::pair<size_t, size_t> range = glyphRange( glyph );
+                newGlyf.insert( newGlyf.end(), glyf.begin() + range.first, glyf.begin() + range.second );
+                newGlyf.resize( (newGlyf.size() + 3) & ~size_t(3), 0 );
+            }
+        }
+        append32( newLoca, uint32_t(newGlyf.size()) );
+        tables["glyf"] = newGlyf;
+        tables["loca"] = newLoca;
+        write16( tables["head"], 50, 1 );
+        write32( tables["head"], 8, 0 );
+
+        // a format 4 cmap with one segment per run of consecutive code-points and glyphs
+        std::vector<std::pair<uint32_t, uint32_t>> segments;    // first, last code-point
+        for( const auto& character : characters ) {
+            if( character.first >= 0xffff ) { continue; }
+            if( !segments.empty() && segments.back().second + 1 == character.first
+                    && characters.at(segments.back().second) + 1 == character.second ) {
+                segments.back().second = character.first;
+            } else {
+                segments.push_back( std::make_pair(character.first, character.first) );
+            }
+        }
+        segments.push_back( std::make_pair(0xffff, 0xffff) );
+
+        uint16_t segCount = uint16_t(segments.size());
+        uint16_t searchRange = 1, entrySelector = 0;
+        while( searchRange * 2 <= segCount ) { searchRange *= 2; ++entrySelector; }
+        searchRange *= 2;
+
+        Bytes subtable;
+        append16( subtable, 4 );
+        append16( subtable, uint16_t(16 + 8 * segCount) );
+        append16( subtable, 0 );
+        append16( subtable, uint16_t(segCount * 2) );
+        append16( subtable, searchRange );
+        append16( subtable, entrySelector );
+        append16( subtable, uint16_t(segCount * 2 - searchRange) );
+        for( const auto& segment : segments ) { append16( subtable, uint16_t(segment.second) ); }
+        append16( subtable, 0 );
+        for( const auto& segment : segments ) { append16( subtable, uint16_t(segment.first) ); }
+        for( const auto& segment : segments ) {
+            uint16_t glyph = segment.first == 0xffff ? 0 : characters.at(segment.first);
+            append16( subtable, segment.first == 0xffff ? 1 : uint16_t(glyph - segment.first) );
+        }
+        for( size_t i = 0; i < segments.size(); ++i ) { append16( subtable, 0 ); }
+
+        Bytes cmap;
+        append16( cmap, 0 );
+        append16( cmap, 2 );
+        append16( cmap, 0 ); append16( cmap, 3 ); append32( cmap, 20 );
+        append16( cmap, 3 ); append16( cmap, 1 ); append32( cmap, 20 );
+        cmap.insert( cmap.end(), subtable.begin(), subtable.end() );
+        tables["cmap"] = cmap;
+
+        // post format 3: no glyph names
+        if( tables.count("post") && tables["post"].size() >= 32 ) {
+            tables["post"].resize( 32 );
+            write32( tables["post"], 0, 0x00030000 );
+        }
+    }
+
+    std::map<std::string, Bytes> tables;
+};
+
+//---------------------------------------------------------------------------------------
+
+struct IndexEntry
+{
+    std::string name;
+    std::string icon;   // the canonical fa::icon enumerator
+};
+
+// adds the icons used in the given source file: fa::<name>, "<name>"_fa, fa::byName("<name>") and QTAWESOME_ICON("<name>")
+static bool scanSource( const std::filesystem::path& path, const std::map<std::string, IndexEntry>& index, std::set<std::string>* used )
+{
+    static const std::regex sourceRegex( ".*\\.(h|hpp|hxx|c|cc|cpp|cxx|mm)$" );
+    std::string fileName = path.generic_string();
+    if( !std::regex_match(fileName, sourceRegex) || fileName.find("enum_name_") != std::string::npos ) {
+        return true;
+    }
+    std::string text;
+    if( !readFile( fileName, &text ) ) {
+        std::cerr << "Can't read " << fileName << std::endl;
+        return false;
+    }
+
+    // the name lookups come first, otherwise fa::byName would be taken for an icon
+    static const std::regex iconRegex( "(?:fa::byName|QTAWESOME_ICON)\\(\\s*\"(\\w+)\"\\s*\\)|\"(\\w+)\"_fa\\b|fa::(\\w+)" );
+    for( auto itr = std::sregex_iterator(text.begin(), text.end(), iconRegex); itr != std::sregex_iterator(); ++itr ) {
+        for( size_t group = 1; group < itr->size(); ++group ) {
+            if( (*itr)[group].matched && index.count((*itr)[group].str()) ) {
+                used->insert( (*itr)[group].str() );
+            }
+        }
+    }
+    return true;
+}
+
+// adds the icons used in the given source file or in all source files below the given directory
+static bool scanSources( const std::string& path, const std::map<std::string, IndexEntry>& index, std::set<std::string>* used )
+{
+    std::error_code error;
+    if( !std::filesystem::is_directory(path, error) ) {
+        if( !std::filesystem::exists(path, error) ) {
+            std::cerr << "Can't read " << path << std::endl;
+            return false;
+        }
+        return scanSource( path, index, used );
+    }
+
+    std::filesystem::recursive_directory_iterator itr( path, error ), end;
+    for( ; !error && itr != end; itr.increment(error) ) {
+        if( itr->is_regular_file(error) && !scanSource( itr->path(), index, used ) ) {
+            return false;
+        }
+    }
+    if( error ) {
+        std::cerr << "Can't read " << path << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool readNames( const std::string& fileName, const std::map<std::string, IndexEntry>& index, std::set<std::string>* used )
+{
+    std::ifstream in( fileName );
+    if( !in ) {
+        std::cerr << "Can't read " << fileName << std::endl;
+        return false;
+    }
+    std::string line;
+    while( std::getline(in, line) ) {
+        line = line.substr( 0, line.find('#') );
+        line.erase( std::remove_if(line.begin(), line.end(), ::isspace), line.end() );
+        if( line.compare(0, 4, "fa::") == 0 ) { line = line.substr(4); }
+        if( line.empty() ) { continue; }
+        if( !index.count(line) ) {
+            std::cerr << "Unknown icon name: " << line << std::endl;
+            return false;
+        }
+        used->insert( line );
+    }
+    return true;
+}
+
+// removes the icons that are not used from icons.txt
+static std::string trimIcons( const std::string& text, const std::set<uint32_t>& values )
+{
+    std::stringstream in( text ), out;
+    std::string line;
+    static const std::regex iconLineRegex( "(regular|brands) ([0-9a-f]+) .*" );
+    std::smatch match;
+    out << "# Generated by tools/fasubset, contains only the icons used by the application\n";
+    while( std::getline(in, line) ) {
+        if( std::regex_match(line, match, iconLineRegex) ) {
+            uint32_t value = uint32_t(std::stoul(match[2].str(), nullptr, 16)) | (match[1].str() == "brands" ? 0x01000000u : 0);
+            if( !values.count(value) ) {
+                continue;
+            }
+        }
+        out << line << "\n";
+    }
+    return out.str();
+}
+
+int main( int argc, char* argv[] )
+{
+    if( argc < 5 ) {
+        std::cerr << "usage: fasubset <QtAwesome6 dir> <output dir> [--names <file>] [--scan <file or dir>]..." << std::endl;
+        return 1;
+    }
+    std::string sourceDir = argv[1];
+    std::string outputDir = argv[2];
+
+    std::string headerText, sourceText, iconsText;
+    if( !readFile( sourceDir + "/enum_name_index.h", &headerText ) || !readFile( sourceDir + "/enum_name_index.cpp", &sourceText )
+            || !readFile( sourceDir + "/icons.txt", &iconsText ) ) {
+        std::cerr << "Can't read the index in " << sourceDir << std::endl;
+        return 1;
+    }
+    std::string indexText = headerText + sourceText;
+
+    // the enumerators with their values, and the names with their canonical enumerator
+    std::map<std::string, uint32_t> values;
+    static const std::regex valueRegex( "\\n\\s+(\\w+) = (fa_brands \\| )?0x([0-9a-f]+),?" );
+    for( auto itr = std::sregex_iterator(indexText.begin(), indexText.end(), valueRegex); itr != std::sregex_iterator(); ++itr ) {
+        values[(*itr)[1].str()] = uint32_t(std::stoul((*itr)[3].str(), nullptr, 16)) | ((*itr)[2].matched ? 0x01000000u : 0);
+    }
+    std::map<std::string, IndexEntry> index;
+    static const std::regex entryRegex( "\\{ \"(\\w+)\", fa::(\\w+) \\}" );
+    for( auto itr = std::sregex_iterator(indexText.begin(), indexText.end(), entryRegex); itr != std::sregex_iterator(); ++itr ) {
+        index[(*itr)[1].str()] = IndexEntry{ (*itr)[1].str(), (*itr)[2].str() };
+    }
+
+    std::set<std::string> used;
+    for( int i = 3; i + 1 < argc; i += 2 ) {
+        if( std::strcmp(argv[i], "--names") == 0 ) {
+            if( !readNames( argv[i + 1], index, &used ) ) { return 1; }
+        } else if( std::strcmp(argv[i], "--scan") == 0 ) {
+            if( !scanSources( argv[i + 1], index, &used ) ) { return 1; }
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+    if( used.empty() ) {
+        std::cerr << "No icons found" << std::endl;
+        return 1;
+    }
+
+    // the values of the used icons
+    std::set<uint32_t> keep;
+    for( const std::string& name : used ) {
+        keep.insert( values[index[name].icon] );
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories( outputDir + "/fonts", error );
+    if( error ) {
+        std::cerr << "Can't create " << outputDir << "/fonts: " << error.message() << std::endl;
+        return 1;
+    }
+
+    static const char* const fontFiles[] = { "fa-regular-400.ttf", "fa-brands-400.ttf" };
+    for( int style = 0; style < 2; ++style ) {
+        Font font;
+        if( !font.load( sourceDir + "/fonts/" + fontFiles[style] ) ) {
+            return 1;
+        }
+        std::map<uint32_t, uint16_t> cmap = font.characterMap();
+        std::map<uint32_t, uint16_t> characters;
+        for( uint32_t value : keep ) {
+            if( bool(value & 0x01000000u) == bool(style) && cmap.count(value & 0x00ffffff) ) {
+                characters[value & 0x00ffffff] = cmap[value & 0x00ffffff];
+            }
+        }
+        font.subset( characters );
+        if( !writeFile( outputDir + "/fonts/" + fontFiles[style], font.save() ) ) {
+            std::cerr << "Can't write " << outputDir << "/fonts/" << fontFiles[style] << std::endl;
+            return 1;
+        }
+        std::cout << fontFiles[style] << ": " << characters.size() << " glyphs" << std::endl;
+    }
+
+    // the trimmed icons, faenumgen generates the index of the subset
+    if( !writeFile( outputDir + "/icons.txt", trimIcons( iconsText, keep ) ) ) {
+        std::cerr << "Can't write " << outputDir << "/icons.txt" << std::endl;
+        return 1;
+    }
+
+    writeFile( outputDir + "/QtAwesome.qrc",
+               "<RCC>\n"
+               "    <qresource prefix=\"/\">\n"
+               "        <file compress=\"0\" compression-algorithm=\"none\">fonts/fa-regular-400.ttf</file>\n"
+               "        <file compress=\"0\" compression-algorithm=\"none\">fonts/fa-brands-400.ttf</file>\n"
+               "    </qresource>\n"
+               "</RCC>\n" );
+
+    std::cout << "Generated the subset of " << used.size() << " icons in " << outputDir << std::endl;
+    return 0;
+}
@@ -0,0 +1,12 @@
+# The build-time tools of QtAwesome
+#   faenumgen  - generates enum_name_index.h and enum_name_index.cpp from icons.txt and the fonts
+#   faindexgen - generates enum_name_hash.h
+#   fasubset   - creates a per-application subset of the fonts and the icon index
+
+TEMPLATE = subdirs
+CONFIG += ordered
+
+SUBDIRS += \
+    faenumgen \
+    faindexgen \
+    fasubset
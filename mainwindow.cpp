@@ -8,7 +8,6 @@
 #include <QSpinBox>
 #include <QTextEdit>
 #include <QTableWidget>
-#include <QMetaEnum>
 #include <QDebug>
 #include <QFileDialog>
 #include <QApplication>
@@ -22,10 +21,8 @@ MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
 {
     QAwesome->initFontAwesome();
-    m_enum = QMetaEnum::fromType<fa::icon>();
-    int count = m_enum.keyCount();
-    for (int i = 0; i < count ; i++) {
-        m_iconIndexs.push_back(m_enum.value(i));
+    for (int i = 0; i < faNameIconCount; i++) {
+        m_iconIndexs.push_back(faNameIconArray[i].icon);
     }
     m_searchedIconIndexs = m_iconIndexs;
     setupUI();
@@ -153,10 +150,13 @@ void MainWindow::updateShowIcon()
     m_iconLabel->setPixmap(pixmap);
     m_iconLabel->setAlignment(Qt::AlignCenter);
 
+    QStringList names = QAwesome->iconNames(id);
     m_iconInfoLabel->setText(QString("Enum : fa::%1\r\n"
-                                     "Index : %2")
-                             .arg(m_enum.valueToKey(id))
-                             .arg(id));
+                                     "Aliases : %2\r\n"
+                                     "Index : 0x%3")
+                             .arg(names.value(0))
+                             .arg(names.mid(1).join(", "))
+                             .arg(fa::codepoint(id), 0, 16));
 }
 
 void MainWindow::updateCode()
@@ -170,8 +170,8 @@ void MainWindow::updateCode()
                                 "QIcon icon = QAwesome->icon(fa::%2/*0x%3*/, QColor(%4,%5,%6));\r\n"
                                 "QPixmap pixmap = icon.pixmap(QSize(%7, %7));")
                         .arg(m_iconScale)
-                        .arg(m_enum.valueToKey(id))
-                        .arg(id, 0, 16)
+                        .arg(QAwesome->iconName(id))
+                        .arg(fa::codepoint(id), 0, 16)
                         .arg(m_color.red())
                         .arg(m_color.green())
                         .arg(m_color.blue())
@@ -185,23 +185,25 @@ void MainWindow::updateTable()
     m_iconTableWgt->setRowCount(m_searchedIconIndexs.size() / MaxTableCols + (m_searchedIconIndexs.size() % MaxTableCols > 0 ? 1 : 0));
     m_iconTableWgt->setColumnCount(MaxTableCols);
 
-    QAwesome->setDefaultOption( "scale-factor", 0.7 );
     QList<int> addedIndexs;
     int addedCount = 0;
-    for (int i = 0; i < m_searchedIconIndexs.size(); ++i) {
-        int id = m_searchedIconIndexs[i];
-        if(addedIndexs.contains(id)) { continue; }
-        addedIndexs.push_back(id);
-        QTableWidgetItem* item = new QTableWidgetItem(QAwesome->icon(id), ("0x" + QString::number(id, 16)));
-        item->setData(Qt::UserRole, i);
-
-        m_iconTableWgt->setItem(addedCount / MaxTableCols, addedCount % MaxTableCols, item);
-        addedCount++;
+    {
+        // the table icons are painted smaller than the selected icon
+        QtAwesomeOptionScope tableOptions( QVariantMap{{"scale-factor", 0.7}} );
+        for (int i = 0; i < m_searchedIconIndexs.size(); ++i) {
+            int id = m_searchedIconIndexs[i];
+            if(addedIndexs.contains(id)) { continue; }
+            addedIndexs.push_back(id);
+            QTableWidgetItem* item = new QTableWidgetItem(QAwesome->icon(id), ("0x" + QString::number(fa::codepoint(id), 16)));
+            item->setData(Qt::UserRole, i);
+
+            m_iconTableWgt->setItem(addedCount / MaxTableCols, addedCount % MaxTableCols, item);
+            addedCount++;
+        }
     }
     // reset row & col with addedCount
     m_iconTableWgt->setRowCount(addedCount / MaxTableCols + (addedCount % MaxTableCols > 0 ? 1 : 0));
     m_iconTableWgt->setColumnCount(addedIndexs.size() >= MaxTableCols ? MaxTableCols : addedIndexs.size());
-    QAwesome->setDefaultOption("scale-factor", m_iconScale);
     m_iconTableWgt->repaint();
     m_selectIndex = m_searchedIconIndexs.size() > 0 ? 0 : INT_MIN;
     if(m_searchedIconIndexs.size() > 0) {
@@ -263,7 +265,7 @@ void MainWindow::onSaveBtnClicked()
     savePath = settings.value("SavePath", defaultPath).toString();
     QDir().mkpath(savePath);
     QString fileName = QFileDialog::getSaveFileName(this, QString("Save *.png file with size : (%1,%1)").arg(m_pixmapSize),
-                       savePath + QString("/%1_%2.png").arg(m_enum.valueToKey(m_searchedIconIndexs[m_selectIndex])).arg(m_pixmapSize), "*.png");
+                       savePath + QString("/%1_%2.png").arg(QAwesome->iconName(m_searchedIconIndexs[m_selectIndex])).arg(m_pixmapSize), "*.png");
     if(!fileName.isEmpty()) {
         savePath = fileName.left(fileName.lastIndexOf("/"));
         QPixmap pixmap = QAwesome->icon(m_searchedIconIndexs[m_selectIndex], m_color).pixmap(QSize(m_pixmapSize, m_pixmapSize));
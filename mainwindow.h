@@ -2,7 +2,6 @@
 #define MAINWINDOW_H
 
 #include <QtWidgets/QMainWindow>
-#include <QMetaEnum>
 
 class QPushButton;
 class QLabel;
@@ -46,7 +45,6 @@ private:
     QString savePath;
     QTextEdit* m_codeEdit;
 
-    QMetaEnum m_enum;
     QList<int> m_iconIndexs;
     QList<int> m_searchedIconIndexs;
     QTableWidget* m_iconTableWgt;
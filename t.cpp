@@ -0,0 +1,6 @@
+#include "enum_name_hash.h"
+#include <cstdio>
+using namespace fa::literals;
+int f(int);
+int main(){ int a = f("musik"_fa); int b = fa::byName("muisc"); printf("%d %d %d\n", a, b, "music"_fa); }
+int f(int x){return x;}